@@ -0,0 +1,518 @@
+/*
+    Copyright (C) 2024, Chuck Garcia
+
+    This file is part of libfqam and is available under the 3-Clause
+    BSD license, which can be found in the LICENSE file at the top-level
+    directory, or at http://opensource.org/licenses/BSD-3-Clause
+*/
+
+#include <math.h>
+#include <omp.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "FLAME.h"
+#include "FQAM.h"
+#include "__FQAM_Stage.h"
+#include "__kernels.h"
+#include "assertf.h"
+
+/*
+Benchmark harness, run by 'make bench'.
+
+    usage: fqam_bench [-o results.json] [-r repetitions]
+
+Every case is run a few times to warm up, then timed 'repetitions' times. The
+minimum, 10th percentile, median, 90th percentile and maximum are reported,
+with bandwidth and arithmetic throughput of the median from each case's traffic
+and flop model (a complex multiply-add counts 8 flops). Results are printed and
+written as JSON for regression tracking:
+
+    {"threads": 8, "repetitions": 15, "timestamp": 1700000000,
+     "results": [{"name": "apply", "params": {"qubits": 20, "gate": "h_low"},
+                  "seconds": {"min": ..., "p10": ..., "median": ...,
+                              "p90": ..., "max": ...},
+                  "gb_per_s": ..., "gflop_per_s": ..., "skipped": false}, ...]}
+
+Rendering needs a display (raylib window), and is recorded as skipped without
+one.
+*/
+
+#define WARMUP 2
+#define DEFAULT_REPETITIONS 15
+
+/* Timings of one case */
+typedef struct
+{
+  char name[32];
+  char params[128]; // Members of the JSON params object
+  double min, p10, median, p90, max;
+  double bytes, flops; // Per repetition
+  bool skipped;
+} bench_result;
+
+typedef void (*bench_fn) (void *ctx);
+
+static bench_result *results;
+static size_t num_results, results_capacity;
+static int repetitions = DEFAULT_REPETITIONS;
+
+static double now (void)
+{
+  struct timespec t;
+
+  clock_gettime (CLOCK_MONOTONIC, &t);
+  return t.tv_sec + 1e-9 * t.tv_nsec;
+}
+
+static int compare_double (const void *a, const void *b)
+{
+  double x = *(const double *)a, y = *(const double *)b;
+  return (x > y) - (x < y);
+}
+
+/* Nearest rank percentile of sorted 'samples' */
+static double percentile (const double *samples, int n, double p)
+{
+  int rank = (int)ceil (p * n) - 1;
+  return samples[rank < 0 ? 0 : rank];
+}
+
+static bench_result *result_new (const char *name, const char *params)
+{
+  if (num_results == results_capacity)
+  {
+    results_capacity = results_capacity ? 2 * results_capacity : 32;
+    results = realloc (results, results_capacity * sizeof (bench_result));
+    assertf (results, "Error: Failed to allocate benchmark results");
+  }
+
+  bench_result *r = &results[num_results++];
+
+  memset (r, 0, sizeof (bench_result));
+  snprintf (r->name, sizeof (r->name), "%s", name);
+  snprintf (r->params, sizeof (r->params), "%s", params);
+  return r;
+}
+
+/* Times 'fn' 'repetitions' times after warming up, each run moving 'bytes' and
+ * computing 'flops' */
+static void measure (const char *name, const char *params, double bytes, double flops,
+                     bench_fn fn, void *ctx)
+{
+  double *samples = malloc (repetitions * sizeof (double));
+  bench_result *r = result_new (name, params);
+
+  assertf (samples, "Error: Failed to allocate benchmark samples");
+
+  for (int i = 0; i < WARMUP + repetitions; i++)
+  {
+    double t = now ();
+
+    fn (ctx);
+    t = now () - t;
+    if (i >= WARMUP)
+      samples[i - WARMUP] = t;
+  }
+
+  qsort (samples, repetitions, sizeof (double), compare_double);
+  r->min = samples[0];
+  r->p10 = percentile (samples, repetitions, 0.1);
+  r->median = percentile (samples, repetitions, 0.5);
+  r->p90 = percentile (samples, repetitions, 0.9);
+  r->max = samples[repetitions - 1];
+  r->bytes = bytes;
+  r->flops = flops;
+  free (samples);
+
+  fprintf (stderr, "%-12s %-44s median %10.3e s  %8.2f GB/s  %8.2f GFLOP/s\n", name,
+           params, r->median, bytes / r->median * 1e-9, flops / r->median * 1e-9);
+}
+
+/* Fills 'A' with pseudo-random entries of magnitude below one */
+static void fill_random (FLA_Obj A, FQAM_Rng *rng)
+{
+  dcomplex *a = FLA_Obj_buffer_at_view (A);
+  dim_t cs = FLA_Obj_col_stride (A);
+
+  for (dim_t j = 0; j < FLA_Obj_width (A); j++)
+    for (dim_t i = 0; i < FLA_Obj_length (A); i++)
+      a[i + j * cs] = (dcomplex){FQAM_Rng_uniform (rng) - 0.5, FQAM_Rng_uniform (rng) - 0.5};
+}
+
+/* ---- Kronecker products ---- */
+
+typedef struct
+{
+  FLA_Obj A, B, C;
+  int nb_alg;
+} kron_ctx;
+
+static void kron_run (void *ctx)
+{
+  kron_ctx *k = ctx;
+  kernel_kron_prod_rec (k->A, k->B, k->C, k->nb_alg);
+}
+
+/* kernel_kron_prod_rec of an m x m A with a p x p B. Its 2 x 2 recursion only
+ * keeps blocks of A square for nb_alg = 2, so only the sizes vary */
+static void bench_kron (void)
+{
+  static const int cases[][2] = {{16, 16}, {32, 16}, {64, 16}, {16, 64}};
+  FQAM_Rng rng;
+
+  FLA_Init ();
+  FQAM_Rng_init (&rng, 1, 0);
+
+  for (size_t c = 0; c < sizeof (cases) / sizeof (cases[0]); c++)
+  {
+    kron_ctx k = {.nb_alg = 2};
+    int m = cases[c][0], p = cases[c][1];
+    double entries = (double)m * m * p * p;
+    char params[128];
+
+    FLA_Obj_create (FLA_DOUBLE_COMPLEX, m, m, 0, 0, &k.A);
+    FLA_Obj_create (FLA_DOUBLE_COMPLEX, p, p, 0, 0, &k.B);
+    FLA_Obj_create (FLA_DOUBLE_COMPLEX, m * p, m * p, 0, 0, &k.C);
+    fill_random (k.A, &rng);
+    fill_random (k.B, &rng);
+    FLA_Set (FLA_ZERO, k.C);
+
+    // C += a_ij B per block: C read and written once
+    snprintf (params, sizeof (params), "\"m\": %d, \"p\": %d, \"nb_alg\": %d", m, p,
+              k.nb_alg);
+    measure ("kron", params, 32 * entries, 8 * entries, kron_run, &k);
+
+    FLA_Obj_free (&k.A);
+    FLA_Obj_free (&k.B);
+    FLA_Obj_free (&k.C);
+  }
+
+  FLA_Finalize ();
+}
+
+/* ---- Staged gates ---- */
+
+typedef struct
+{
+  FQAM_Op *op;
+  int targets[FQAM_MAX_TARGETS];
+  int num_targets;
+  FQAM_Op *layer;
+  int *layer_targets, *layer_sizes, num_gates;
+  FQAM_Pauli_term *rotations;
+  int num_rotations;
+} apply_ctx;
+
+/* Stages one more step and applies it. The checkpoint budget is zero, so only
+ * the new step is computed */
+static void apply_run (void *ctx)
+{
+  apply_ctx *a = ctx;
+
+  if (a->layer)
+    FQAM_stage_append_layer (a->layer, a->layer_targets, a->layer_sizes, a->num_gates);
+  else if (a->rotations)
+    FQAM_stage_append_rotations (a->rotations, a->num_rotations);
+  else if (a->num_targets)
+    FQAM_stage_append_on (*a->op, a->targets, a->num_targets);
+  else
+    FQAM_stage_append (*a->op);
+
+  FQAM_compute_outcomes ();
+}
+
+/* H^{(x) k}, a dense k qubit unitary */
+static void hadamards (FQAM_Op *op, int k)
+{
+  FQAM_Op_create (op, "H^k", k);
+
+  dcomplex *u = FLA_Obj_buffer_at_view (op->mat_repr);
+  dim_t cs = FLA_Obj_col_stride (op->mat_repr);
+  double scale = pow (2.0, -0.5 * k);
+
+  for (int c = 0; c < 1 << k; c++)
+    for (int r = 0; r < 1 << k; r++)
+      u[r + c * cs].real = __builtin_parity (r & c) ? -scale : scale;
+}
+
+/*
+FQAM_compute_outcomes on 'n' qubits for one gate type. Traffic assumes each gate
+reads and writes the statevector once; a k qubit gate costs 2^k complex
+multiply-adds per amplitude and a Pauli rotation about 14 flops per amplitude.
+*/
+static void bench_apply_gate (int n, const char *gate)
+{
+  FQAM_Config config = FQAM_CONFIG_DEFAULT;
+  FQAM_Op op;
+  apply_ctx a = {.op = &op};
+  int sites[64], sizes[64];
+  FQAM_Op layer[64];
+  FQAM_Pauli_term rotations[4];
+  double N = ldexp (1.0, n), bytes = 32 * N, flops;
+  char params[128];
+
+  FQAM_init_config (n, 0, config);
+  FQAM_stage_set_checkpoint_budget (0);
+
+  if (!strcmp (gate, "h_low") || !strcmp (gate, "h_high"))
+  {
+    FQAM_hadamard (&op);
+    a.targets[0] = !strcmp (gate, "h_low") ? 0 : n - 1;
+    a.num_targets = 1;
+    flops = 8 * 2 * N;
+  }
+  else if (!strcmp (gate, "cx"))
+  {
+    FQAM_cnot (&op);
+    a.targets[0] = n - 1;
+    a.targets[1] = 0;
+    a.num_targets = 2;
+    flops = 8 * 4 * N;
+  }
+  else if (!strcmp (gate, "h3"))
+  {
+    hadamards (&op, 3);
+    a.targets[0] = 1;
+    a.targets[1] = n / 2;
+    a.targets[2] = n - 1;
+    a.num_targets = 3;
+    flops = 8 * 8 * N;
+  }
+  else if (!strcmp (gate, "layer_h"))
+  {
+    FQAM_hadamard (&op);
+    for (int q = 0; q < n; q++)
+    {
+      layer[q] = op;
+      sites[q] = q;
+      sizes[q] = 1;
+    }
+    a.layer = layer;
+    a.layer_targets = sites;
+    a.layer_sizes = sizes;
+    a.num_gates = n;
+    bytes *= n;
+    flops = 8 * 2 * N * n;
+  }
+  else if (!strcmp (gate, "rotations"))
+  {
+    // X_0 X_1, Y_0 Y_1 sharing x_mask and commuting diagonal Z_0 Z_1, Z_2 Z_{n-1}
+    rotations[0] = (FQAM_Pauli_term){0.1, 3, 0};
+    rotations[1] = (FQAM_Pauli_term){0.2, 3, 3};
+    rotations[2] = (FQAM_Pauli_term){0.3, 0, 3};
+    rotations[3] = (FQAM_Pauli_term){0.4, 0, 1ULL << (n - 1) | 4};
+    a.rotations = rotations;
+    a.num_rotations = 4;
+    flops = 14 * N * 4;
+  }
+  else
+  {
+    // Whole register operator, applied densely
+    hadamards (&op, n);
+    bytes = 16 * N * N;
+    flops = 8 * N * N;
+  }
+
+  snprintf (params, sizeof (params), "\"qubits\": %d, \"gate\": \"%s\"", n, gate);
+  measure ("apply", params, bytes, flops, apply_run, &a);
+
+  FQAM_finalize ();
+}
+
+static void bench_apply (void)
+{
+  static const char *gates[] = {"h_low", "h_high", "cx", "h3", "layer_h", "rotations"};
+  static const int qubits[] = {16, 20, 24};
+
+  for (size_t q = 0; q < sizeof (qubits) / sizeof (qubits[0]); q++)
+    for (size_t g = 0; g < sizeof (gates) / sizeof (gates[0]); g++)
+      bench_apply_gate (qubits[q], gates[g]);
+
+  bench_apply_gate (8, "dense");
+  bench_apply_gate (10, "dense");
+}
+
+/* ---- Probability adjacency matrices ---- */
+
+typedef struct
+{
+  FLA_Obj A, state, C;
+} adjacency_ctx;
+
+static void adjacency_run (void *ctx)
+{
+  adjacency_ctx *a = ctx;
+  compute_probability_adjacency_matrix (a->A, a->state, a->C);
+}
+
+/* compute_probability_adjacency_matrix of a 2^n x 2^n operator: A read, C read
+ * and written once */
+static void bench_adjacency (void)
+{
+  FQAM_Rng rng;
+
+  FLA_Init ();
+  FQAM_Rng_init (&rng, 2, 0);
+
+  for (int n = 6; n <= 10; n += 2)
+  {
+    adjacency_ctx a;
+    double N = ldexp (1.0, n);
+    char params[128];
+
+    FLA_Obj_create (FLA_DOUBLE_COMPLEX, N, N, 0, 0, &a.A);
+    FLA_Obj_create (FLA_DOUBLE_COMPLEX, N, 1, 0, 0, &a.state);
+    FLA_Obj_create (FLA_DOUBLE_COMPLEX, N, N, 0, 0, &a.C);
+    fill_random (a.A, &rng);
+    fill_random (a.state, &rng);
+    FLA_Set (FLA_ZERO, a.C);
+
+    snprintf (params, sizeof (params), "\"qubits\": %d", n);
+    measure ("adjacency", params, 48 * N * N, 8 * N * N, adjacency_run, &a);
+
+    FLA_Obj_free (&a.A);
+    FLA_Obj_free (&a.state);
+    FLA_Obj_free (&a.C);
+  }
+
+  FLA_Finalize ();
+}
+
+/* ---- Operator construction ---- */
+
+typedef struct
+{
+  int k;
+  FQAM_Op op;
+} op_add_ctx;
+
+/* Accumulates the outer products |i><j| of basis states i, j <= k into a k qubit
+ * operator (FQAM_Basis_create accepts indices up to the qubit count) */
+static void op_add_run (void *ctx)
+{
+  op_add_ctx *o = ctx;
+
+  FLA_Set (FLA_ZERO, o->op.mat_repr);
+  for (int i = 0; i <= o->k; i++)
+    for (int j = 0; j <= o->k; j++)
+    {
+      FQAM_Op outer;
+
+      FQAM_Basis_outer (FQAM_Basis_create (o->k, 0, i), FQAM_Basis_create (o->k, 0, j),
+                        &outer);
+      FQAM_Op_add (FQAM_ONE, outer, &o->op);
+    }
+}
+
+/* FQAM_Op_add: each term is a rank one update of the whole 4^k matrix */
+static void bench_op_add (void)
+{
+  for (int k = 2; k <= 6; k += 2)
+  {
+    op_add_ctx o = {.k = k};
+    double terms = (k + 1) * (k + 1), entries = ldexp (1.0, 2 * k);
+    char params[128];
+
+    FQAM_init (1, 0);
+    FQAM_Op_create (&o.op, "sum", k);
+
+    snprintf (params, sizeof (params), "\"qubits\": %d, \"terms\": %d", k, (int)terms);
+    measure ("op_add", params, 32 * entries * terms, 8 * entries * terms, op_add_run,
+             &o);
+
+    FQAM_Operator_free (&o.op);
+    FQAM_finalize ();
+  }
+}
+
+/* ---- Rendering ---- */
+
+static void render_run (void *ctx)
+{
+  (void)ctx;
+  FQAM_Render_feynman_diagram ();
+}
+
+/* FQAM_Render_feynman_diagram of a 3 qubit circuit of 4 steps, drawn to
+ * saved_image.png. No traffic model: rates are reported as zero */
+static void bench_render (void)
+{
+  const char *params = "\"qubits\": 3, \"steps\": 4";
+
+  if (getenv ("DISPLAY") == NULL)
+  {
+    result_new ("render", params)->skipped = true;
+    fprintf (stderr, "%-12s %-44s skipped, no display\n", "render", params);
+    return;
+  }
+
+  FQAM_Op H, cx;
+
+  FQAM_init (3, 0);
+  FQAM_hadamard (&H);
+  FQAM_cnot (&cx);
+  FQAM_stage_append_on (H, (int[]){0}, 1);
+  FQAM_stage_append_on (cx, (int[]){0, 1}, 2);
+  FQAM_stage_append_on (cx, (int[]){1, 2}, 2);
+  FQAM_stage_append_on (H, (int[]){2}, 1);
+
+  measure ("render", params, 0, 0, render_run, NULL);
+  FQAM_finalize ();
+}
+
+static void write_json (const char *path)
+{
+  FILE *f = fopen (path, "w");
+  assertf (f, "Error: Failed to open %s", path);
+
+  fprintf (f, "{\"threads\": %d, \"repetitions\": %d, \"timestamp\": %lld,\n",
+           omp_get_max_threads (), repetitions, (long long)time (NULL));
+  fprintf (f, " \"results\": [\n");
+
+  for (size_t i = 0; i < num_results; i++)
+  {
+    bench_result *r = &results[i];
+    double gbs = r->skipped ? 0.0 : r->bytes / r->median * 1e-9;
+    double gflops = r->skipped ? 0.0 : r->flops / r->median * 1e-9;
+
+    fprintf (f,
+             "  {\"name\": \"%s\", \"params\": {%s},\n"
+             "   \"seconds\": {\"min\": %.9g, \"p10\": %.9g, \"median\": %.9g, "
+             "\"p90\": %.9g, \"max\": %.9g},\n"
+             "   \"gb_per_s\": %.6g, \"gflop_per_s\": %.6g, \"skipped\": %s}%s\n",
+             r->name, r->params, r->min, r->p10, r->median, r->p90, r->max, gbs, gflops,
+             r->skipped ? "true" : "false", i + 1 < num_results ? "," : "");
+  }
+
+  fprintf (f, " ]}\n");
+  fclose (f);
+}
+
+int main (int argc, char **argv)
+{
+  const char *out = "bench.json";
+
+  for (int i = 1; i < argc; i++)
+  {
+    if (!strcmp (argv[i], "-o") && i + 1 < argc)
+      out = argv[++i];
+    else if (!strcmp (argv[i], "-r") && i + 1 < argc)
+      repetitions = atoi (argv[++i]);
+    else
+      assertf (false, "usage: %s [-o results.json] [-r repetitions]", argv[0]);
+  }
+  assertf (repetitions > 0, "Error: Expected a positive repetition count");
+
+  bench_kron ();
+  bench_apply ();
+  bench_adjacency ();
+  bench_op_add ();
+  bench_render ();
+
+  write_json (out);
+  fprintf (stderr, "Wrote %zu results to %s\n", num_results, out);
+  free (results);
+  return 0;
+}
@@ -6,10 +6,12 @@ BIN_DIR    := $(ROOT_DIR)/bin
 LIB_DIR    := $(ROOT_DIR)/lib
 RAYLIB_SRC := $(ROOT_DIR)/raylib/src
 
-# Main library paths
-TARGET   := fqam.o
-FQAM_LIB := $(BIN_DIR)/$(TARGET)
-FQAM_INC := $(ROOT_DIR)/include/
+# Main library paths: static archive linked by tests, tools and benchmarks, and
+# shared library for other consumers
+TARGET      := libfqam.a
+FQAM_LIB    := $(BIN_DIR)/$(TARGET)
+FQAM_SHARED := $(BIN_DIR)/libfqam.so
+FQAM_INC    := $(ROOT_DIR)/include/
 
 # Shared library paths
 BLAS_LIB  := $(HOME)/blis/lib/libblis.a
@@ -19,9 +21,32 @@ FLAME_INC := $(HOME)/libflame/include/
 # ---- Compiler settings -----
 CC          := gcc
 LINKER      := $(CC)
-CFLAGS      := -O3 -Wall -m64 -msse3
+AR          := gcc-ar
+CFLAGS      := -O3 -Wall -m64 -msse3 -fopenmp -fPIC
 DEBUG_FLAGS := -g -O0
 
+# Link time optimization (make LTO=0 to disable). Library objects carry both
+# GIMPLE and machine code, so executables linked with LTO_FLAGS inline across
+# library modules and others still link
+LTO ?= 1
+ifeq ($(LTO), 1)
+LTO_FLAGS := -flto=auto -ffat-lto-objects
+CFLAGS    += $(LTO_FLAGS)
+endif
+
+# Target CPU. By default hot kernels are cloned per x86-64 level and dispatched
+# at load time (see KERNEL_CLONES), so one build runs on every generation.
+# Building for a single CPU (e.g. make MARCH=native) compiles everything for it
+ifdef MARCH
+CFLAGS += -march=$(MARCH) -DFQAM_NO_CLONES
+endif
+
+# Optional zstd compression of block snapshots (make ZSTD=1)
+ifeq ($(ZSTD), 1)
+CFLAGS   += -DFQAM_ZSTD
+ZSTD_LIB := -lzstd
+endif
+
 # Include flags
 IFLAGS := -I$(FQAM_INC)
 IFLAGS += -I$(FLAME_INC) 
\ No newline at end of file
@@ -5,10 +5,23 @@
 #include <stdbool.h>
 
 #include "__FQAM_Types.h"
+#include "__FQAM_Random.h"
 #include "__FQAM_Main.h"
 #include "__FQAM_Operator.h"
 #include "__FQAM_Pauli.h"
 #include "__FQAM_Rendering.h"
+#include "__FQAM_Measure.h"
+#include "__FQAM_Observable.h"
+#include "__FQAM_Pathsum.h"
+#include "__FQAM_Lattice.h"
+#include "__FQAM_Trotter.h"
+#include "__FQAM_Mps.h"
+#include "__FQAM_Stabilizer.h"
+#include "__FQAM_Density.h"
+#include "__FQAM_Trajectory.h"
+#include "__FQAM_Circuit.h"
+#include "__FQAM_Snapshot.h"
+#include "__FQAM_Profile.h"
 
 
 
@@ -0,0 +1,20 @@
+#include "FQAM.h"
+
+/*
+Staged circuits saved to and loaded from binary circuit files (see
+FQAM_Circuit.c for the layout), so circuits need not be compiled in.
+tools/fqam_convert.c converts a text description into this format.
+*/
+
+/* Operators of a loaded circuit. The stage refers to them, so they must outlive
+ * it: free with FQAM_circuit_free after FQAM_finalize */
+typedef struct
+{
+  FQAM_Op *ops;     // Deduplicated operator table of the file
+  size_t num_ops;   // Entries of 'ops'
+  size_t num_steps; // Steps appended to the stage
+} FQAM_Circuit;
+
+void FQAM_circuit_save (const char *path);
+void FQAM_circuit_load (const char *path, FQAM_Circuit *circuit);
+void FQAM_circuit_free (FQAM_Circuit *circuit);
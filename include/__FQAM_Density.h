@@ -0,0 +1,14 @@
+#include "FQAM.h"
+
+/*
+Noise channels, run by the density matrix backend (FQAM_BACKEND_DENSITY). A
+channel maps rho to sum_i K_i rho K_i^H for Kraus operators K_i with
+sum_i K_i^H K_i = I.
+*/
+void FQAM_stage_append_channel (const FQAM_Op *kraus, int num_kraus, const int *targets,
+                                int num_targets);
+void FQAM_stage_append_depolarizing (int qubit, double p);
+void FQAM_stage_append_dephasing (int qubit, double p);
+void FQAM_stage_append_amplitude_damping (int qubit, double gamma);
+
+double FQAM_density_purity (void);
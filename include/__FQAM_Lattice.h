@@ -0,0 +1,25 @@
+#include "FQAM.h"
+
+/*
+Qubits placed on a 1D chain or 2D grid. Site (row, col) is qubit
+row * cols + col, a chain being a single row.
+*/
+typedef struct
+{
+  int rows;
+  int cols;
+  bool periodic; // Wrap neighborhoods around the boundary
+} FQAM_Lattice;
+
+/* Partitions of the lattice into non-overlapping neighborhoods */
+typedef enum
+{
+  FQAM_PARTITION_BRICKWALL,    // Two site bonds, even then odd, along each axis
+  FQAM_PARTITION_CHECKERBOARD, // 2 x 2 blocks (2 sites on chains), then shifted by one site
+} FQAM_Partition;
+
+FQAM_Lattice FQAM_Lattice_1d (int length, bool periodic);
+FQAM_Lattice FQAM_Lattice_2d (int rows, int cols, bool periodic);
+int FQAM_Lattice_site (FQAM_Lattice lattice, int row, int col);
+
+int FQAM_Part_as_lattice (FQAM_Lattice lattice, FQAM_Op rule, FQAM_Partition partition);
@@ -1,10 +1,54 @@
+/* Simulation backends */
+typedef enum
+{
+  FQAM_BACKEND_STATEVECTOR, // Dense 2^n statevector
+  FQAM_BACKEND_PATHSUM,     // No statevector, amplitudes by Feynman path sums
+  FQAM_BACKEND_MPS,         // Matrix product state, for low entanglement chains
+  FQAM_BACKEND_STABILIZER,  // Clifford tableau, statevector once non-Clifford
+  FQAM_BACKEND_DENSITY,     // Density matrix, for noise channels
+  FQAM_BACKEND_SPARSE,      // Nonzero amplitudes, statevector once dense enough
+} FQAM_Backend;
+
+/* Amplitude precision of statevectors */
+typedef enum
+{
+  FQAM_PRECISION_DOUBLE, // Double complex amplitudes
+  FQAM_PRECISION_SINGLE, // Single complex amplitudes, half the memory and bandwidth
+} FQAM_Precision;
+
+/* Initialization options */
+typedef struct
+{
+  FQAM_Backend backend;
+  size_t mps_max_bond; // Largest MPS bond dimension kept
+  double mps_cutoff;   // Singular values below cutoff * largest are discarded
+  FQAM_Precision precision; // Statevector amplitudes, operators stay double
+  const char *state_dir;    // If set, the statevector maps a scratch file here
+  int chunk_qubits;         // Out-of-core chunks of 2^chunk_qubits amplitudes, 0: off
+  double sparse_density;    // Sparse backend densifies past this nonzero fraction
+} FQAM_Config;
+
+#define FQAM_CONFIG_DEFAULT                                                          \
+  ((FQAM_Config){.backend = FQAM_BACKEND_STATEVECTOR, .mps_max_bond = 64,           \
+                 .mps_cutoff = 1e-12, .precision = FQAM_PRECISION_DOUBLE,          \
+                 .state_dir = NULL, .chunk_qubits = 0,                        \
+                 .sparse_density = 1.0 / 32})
+
 /*Life Cycle */
 void FQAM_init (size_t dim, unsigned int initial_state);
+void FQAM_init_config (size_t dim, uint64_t initial_state, FQAM_Config config);
 void FQAM_finalize (void);
 
 /* Stage Commands */
 void FQAM_stage_append (FQAM_Op operator); // Adds operator to staging list
+void FQAM_stage_append_on (FQAM_Op operator, const int *targets, int num_targets);
+void FQAM_stage_append_layer (const FQAM_Op *operators, const int *targets,
+                              const int *num_targets, int num_operators);
+void FQAM_stage_append_repeated (FQAM_Op operator, const int *sites, int num_sites);
 void FQAM_stage_show (void);
+void FQAM_stage_replace (size_t idx, FQAM_Op operator);
+void FQAM_stage_pop (void);
+void FQAM_stage_set_checkpoint_budget (size_t bytes);
 
 void FQAM_compute_outcomes (void);
 void _debug_FQAM_show_stage (void);
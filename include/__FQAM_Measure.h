@@ -0,0 +1,9 @@
+#include "FQAM.h"
+
+/* Sampling */
+void FQAM_sample (size_t shots, uint64_t seed, unsigned long *outcomes);
+
+/* Marginals and partial measurement */
+void FQAM_marginal (const int *qubits, int num_qubits, double *probs);
+unsigned long FQAM_measure (const int *qubits, int num_qubits, FQAM_Rng *rng);
+double FQAM_collapse (const int *qubits, int num_qubits, unsigned long outcome);
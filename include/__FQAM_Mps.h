@@ -0,0 +1,12 @@
+#include "FQAM.h"
+
+/*
+Matrix product state backend (FQAM_BACKEND_MPS). Sites are qubits, and the
+state is only formed for windows of a few sites, so chains may be far wider
+than a statevector allows. Accuracy is set by FQAM_Config.mps_max_bond and
+FQAM_Config.mps_cutoff.
+*/
+dcomplex FQAM_mps_amplitude (const unsigned char *bits);
+void FQAM_mps_window_probabilities (int first, int width, double *probs);
+double FQAM_mps_truncation_error (void);
+size_t FQAM_mps_max_bond (void);
@@ -0,0 +1,34 @@
+#include "FQAM.h"
+
+/*
+Pauli string P = coeff * i^{|x & z|} X^x Z^z, with x_mask and z_mask selecting the
+qubits acted on by X and Z respectively. Qubits in both masks are acted on by
+Y = [[0, -i], [i, 0]].
+*/
+typedef struct
+{
+  double coeff;    // Real weight
+  uint64_t x_mask; // Qubits acted on by X or Y
+  uint64_t z_mask; // Qubits acted on by Z or Y
+} FQAM_Pauli_term;
+
+/* Weighted sum of Pauli strings, e.g. a Hamiltonian */
+typedef struct
+{
+  FQAM_Pauli_term *terms;
+  size_t size;
+  size_t capacity;
+  bool grouped; // Terms sorted so terms sharing x_mask are adjacent
+} FQAM_Pauli_sum;
+
+/*Life Cycle*/
+void FQAM_Pauli_sum_create (FQAM_Pauli_sum *H);
+void FQAM_Pauli_sum_free (FQAM_Pauli_sum *H);
+
+/* Term Construction */
+void FQAM_Pauli_sum_add (FQAM_Pauli_sum *H, double coeff, const char *pauli);
+void FQAM_Pauli_sum_add_masks (FQAM_Pauli_sum *H, double coeff, uint64_t x_mask,
+                               uint64_t z_mask);
+
+/* Expectation values */
+double FQAM_expectation (FQAM_Pauli_sum *H);
@@ -1,7 +1,7 @@
 
 /*Life Cycle*/
 FQAM_Error FQAM_Op_create (FQAM_Op *operator, char *name, int dim);
-FQAM_Error FQAM_operator_free (FQAM_Op *operator);
+FQAM_Error FQAM_Operator_free (FQAM_Op *operator);
 
 /* Operator Generation Functions */
 
@@ -0,0 +1,22 @@
+#include "FQAM.h"
+
+/*
+Feynman path sums: output amplitudes <output|U_D ... U_1|initial> computed by
+summing the amplitude of every path of basis states through the staged steps.
+Memory is O(depth) per path prefix, independent of the statevector size, so
+these work with FQAM_BACKEND_PATHSUM on registers too wide for a statevector.
+Run time grows with the number of nonzero paths, so they suit shallow circuits.
+*/
+dcomplex FQAM_amplitude (uint64_t output);
+void FQAM_amplitudes (const uint64_t *outputs, size_t num_outputs, dcomplex *result);
+
+/* Single Feynman path through the stage */
+typedef struct
+{
+  double probability; // |amplitude|^2
+  dcomplex amplitude; // Product of the entries taken along the path
+  uint64_t *states;   // states[d]: basis state after d steps, d = 0..depth
+} FQAM_Path;
+
+size_t FQAM_dominant_paths (size_t max_paths, double threshold, FQAM_Path **paths);
+void FQAM_paths_free (FQAM_Path *paths, size_t num_paths);
@@ -0,0 +1,19 @@
+#include "FQAM.h"
+
+/*
+Profiling of FQAM_compute_outcomes and FQAM_Render_feynman_diagram. While
+recording, each phase (checkpoint restores and stores, every staged step, dense
+Gemv, adjacency matrices, rasterization, operator construction) is timed as a
+scope, optionally with hardware counters. Scopes are exported as a Chrome trace
+(chrome://tracing, Perfetto) or summarized per phase and operator.
+*/
+
+/* Starts recording, dropping earlier scopes. With 'counters', cycles,
+ * instructions and cache misses are read through perf_event_open when the
+ * kernel allows it */
+void FQAM_profile_start (bool counters);
+void FQAM_profile_stop (void);
+
+/* Prints total time per phase and operator */
+void FQAM_profile_report (void);
+void FQAM_profile_write_trace (const char *path);
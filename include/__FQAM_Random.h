@@ -0,0 +1,46 @@
+#ifndef __FQAM_RANDOM_H
+#define __FQAM_RANDOM_H
+
+#include <stdint.h>
+
+/*
+Counter-based pseudo-random number generator (Philox4x32-10).
+
+Every generator is fully determined by a (seed, stream) pair, so independent
+streams are obtained by giving each thread, trajectory or block of work its own
+stream index rather than sharing a generator. No global state is kept.
+*/
+typedef struct
+{
+  uint32_t key[2];  // Derived from seed
+  uint32_t ctr[4];  // ctr[0..1]: block counter, ctr[2..3]: stream index
+  uint32_t out[4];  // Buffered output of current block
+  int idx;          // Next unread word of 'out'
+} FQAM_Rng;
+
+void FQAM_Rng_init (FQAM_Rng *rng, uint64_t seed, uint64_t stream);
+void FQAM_Rng_block (FQAM_Rng *rng);
+
+/* Returns next uniformly distributed 32-bit word */
+static inline uint32_t FQAM_Rng_u32 (FQAM_Rng *rng)
+{
+  if (rng->idx == 4)
+    FQAM_Rng_block (rng);
+
+  return rng->out[rng->idx++];
+}
+
+/* Returns next uniformly distributed 64-bit word */
+static inline uint64_t FQAM_Rng_u64 (FQAM_Rng *rng)
+{
+  uint64_t hi = FQAM_Rng_u32 (rng);
+  return (hi << 32) | FQAM_Rng_u32 (rng);
+}
+
+/* Returns uniformly distributed double in [0, 1) with 53 bits of precision */
+static inline double FQAM_Rng_uniform (FQAM_Rng *rng)
+{
+  return (FQAM_Rng_u64 (rng) >> 11) * 0x1.0p-53;
+}
+
+#endif
@@ -1,3 +1,6 @@
 #include "FQAM.h"
 
-FQAM_Error FQAM_Render_feynman_diagram (void);
\ No newline at end of file
+FQAM_Error FQAM_Render_feynman_diagram (void);
+FQAM_Error FQAM_Render_dominant_paths (size_t max_paths, double threshold);
+FQAM_Error FQAM_Render_mps_window (int first, int width);
+FQAM_Error FQAM_Render_populations (void);
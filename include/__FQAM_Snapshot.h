@@ -0,0 +1,18 @@
+#include "FQAM.h"
+
+/*
+Binary snapshots of the statevector (vec(rho) on the density backend), to
+checkpoint long evolutions and move states between processes. See
+FQAM_Snapshot.c for the layout.
+*/
+
+/* Snapshot encodings */
+typedef enum
+{
+  FQAM_SNAPSHOT_RAW,    // Page aligned amplitudes, loaded by mapping the file
+  FQAM_SNAPSHOT_BLOCKS, // Blocks of amplitudes, all zero blocks elided and the
+                        // rest compressed when built with zstd (FQAM_ZSTD)
+} FQAM_Snapshot_encoding;
+
+void FQAM_snapshot_save (const char *path, FQAM_Snapshot_encoding encoding);
+void FQAM_snapshot_load (const char *path);
@@ -0,0 +1,8 @@
+#include "FQAM.h"
+
+/*
+Stabilizer backend (FQAM_BACKEND_STABILIZER). Stages of Clifford operators run on
+a tableau in polynomial time, so registers may hold thousands of qubits. Once a
+non-Clifford operator is staged, the stage is replayed on a statevector instead.
+*/
+bool FQAM_stage_is_clifford (void);
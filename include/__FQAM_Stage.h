@@ -0,0 +1,213 @@
+/*
+    Copyright (C) 2024, Chuck Garcia
+
+    This file is part of libfqam and is available under the 3-Clause
+    BSD license, which can be found in the LICENSE file at the top-level
+    directory, or at http://opensource.org/licenses/BSD-3-Clause
+*/
+
+/* Internal stage definition shared between FQAM modules. Not part of the public
+ * API, hence not included by FQAM.h */
+#ifndef __FQAM_STAGE_H
+#define __FQAM_STAGE_H
+
+#include "FQAM.h"
+
+/* Default bytes set aside for cached statevector checkpoints */
+#define FQAM_DEFAULT_CHECKPOINT_BUDGET (256UL << 20)
+
+/* Channels act on at most this many qubits, so that their superoperator acts on
+ * at most FQAM_MAX_TARGETS qubits of vec(rho) */
+#define CHANNEL_MAX_TARGETS (FQAM_MAX_TARGETS / 2)
+
+/* Kinds of staged computation steps */
+typedef enum
+{
+  STEP_OPERATOR, // Operator on the whole register or on target qubits
+  STEP_LAYER,    // Operators on pairwise disjoint targets, applied in one sweep
+  STEP_REPEATED, // One operator applied at each of a list of sites
+  STEP_PAULI,    // Commuting Pauli rotations e^{-i theta P}
+  STEP_CHANNEL,  // Noise channel given by Kraus operators on target qubits
+} stage_step_kind;
+
+/* Local operator of a layer */
+typedef struct
+{
+  FQAM_Op *op;
+  int targets[FQAM_MAX_TARGETS];
+  int num_targets;
+} stage_gate;
+
+/* Staged computation step */
+typedef struct
+{
+  stage_step_kind kind;
+  FQAM_Op *op;                   // Operator applied by step (first gate of layers)
+  int targets[FQAM_MAX_TARGETS]; // Target j is acted on by bit j of op's index
+  int num_targets;               // Zero when op spans the whole register
+
+  // Layers
+  stage_gate *gates;
+  int num_gates;
+
+  // Repeated operators: op applied at sites[s * num_targets], s < num_sites
+  int *sites;
+  int num_sites;
+
+  // Pauli rotations, angle theta stored as coefficient. Rotations on at most
+  // FQAM_MAX_TARGETS qubits are also kept as gates on their support, owning
+  // their operators, for path sums and rendering
+  FQAM_Pauli_term *rotations;
+  int num_rotations;
+
+  // Channels: owned[0..num_kraus) are the Kraus operators and op, owned too, the
+  // superoperator acting on targets and their column copies (see FQAM_Density.c)
+  int num_kraus;
+
+  FQAM_Op *owned; // Operators freed with the step
+  int num_owned;
+} stage_step;
+
+/* Matrix product state. Site q holds tensor A[l, s, r] of shape
+ * (bond[q], 2, bond[q + 1]), stored as a column major (2 bond[q]) x bond[q + 1]
+ * matrix with row l + bond[q] * s */
+typedef struct
+{
+  dcomplex **tensors;
+  size_t *bond;
+  size_t computed_steps;   // Steps applied (SIZE_MAX if stale)
+  double truncation_error; // Discarded weight summed over truncations
+  FLA_Obj swap;            // Two qubit SWAP, for routing distant targets
+} stage_mps;
+
+/* Stabilizer tableau (Aaronson-Gottesman) of n qubits. Rows 0..n-1 hold the
+ * destabilizers, n..2n-1 the stabilizers and row 2n is scratch. Row i packs the
+ * X bits of all qubits into 'words' words at rows + 2 i words, followed by its Z
+ * bits, and signs[i] is set for a -1 phase */
+typedef struct
+{
+  uint64_t *rows;
+  unsigned char *signs;
+  size_t n;
+  size_t words;
+} tableau;
+
+/* Stabilizer backend state */
+typedef struct
+{
+  tableau state;         // Tableau after 'computed_steps' steps
+  tableau base;          // Tableau at the stage's base step (initial or collapsed)
+  size_t computed_steps; // Steps applied to 'state' (SIZE_MAX if stale)
+  bool fallback;         // Non-Clifford step staged, statevector replays stage
+} stage_stabilizer;
+
+/* Nonzero amplitude of a sparse state */
+typedef struct
+{
+  uint64_t index;
+  dcomplex amp;
+} sparse_entry;
+
+/* Sparse state: nonzero amplitudes sorted by basis index */
+typedef struct
+{
+  sparse_entry *entries;
+  size_t size;
+  size_t capacity;
+} sparse_state;
+
+/* Sparse backend state */
+typedef struct
+{
+  sparse_state state;    // State after 'computed_steps' steps
+  sparse_state base;     // State at the stage's base step (initial or collapsed)
+  size_t computed_steps; // Steps applied to 'state' (SIZE_MAX if stale)
+  bool dense;            // Densified, statevector continues the stage
+} stage_sparse;
+
+/* Stage Struct */
+struct stage
+{
+  FLA_Obj statevector;        // Quantum statevector
+  size_t dim;                 // Dimension of hilbertspace
+  size_t state_space;         // Statevector size
+  size_t amp_size;            // Bytes per amplitude (double or single complex)
+  bool state_mapped;          // Statevector buffer maps a file (config.state_dir)
+  struct arraylist *stage;    // Contain sequence applied computation steps (stage_step)
+  uint64_t initial_state;     // Basis state statevector is initialized to
+  FQAM_Config config;         // Options passed at initialization
+  unsigned long state_version; // Bumped whenever statevector contents change
+
+  // Checkpointing
+  size_t computed_steps;       // Steps applied to statevector (SIZE_MAX if stale)
+  size_t checkpoint_budget;    // Bytes available for cached checkpoints
+  size_t checkpoint_stride;    // Distance in steps between cached checkpoints
+  size_t checkpoint_capacity;  // Allocated length of 'checkpoints'
+  size_t base_step;            // Earliest reachable step (last collapse)
+  bool base_mapped;            // Base checkpoint maps a snapshot file read only
+  void **checkpoints;          // checkpoints[s]: state after s steps, or NULL
+
+  stage_mps mps;               // State of the MPS backend
+  stage_stabilizer stabilizer; // State of the stabilizer backend
+  stage_sparse sparse;         // State of the sparse backend
+};
+
+extern struct stage main_stage;
+
+/* Profiled scope (see FQAM_Profile.c): index of its event, SIZE_MAX when not
+ * recording */
+typedef size_t profile_scope;
+
+profile_scope profile_begin (const char *phase, const char *detail, long step);
+void profile_end (profile_scope scope);
+
+void *stage_state_alloc (void);
+void stage_state_free (void);
+void apply_operator (FLA_Obj A);
+void stage_apply_step (stage_step *step, FLA_Obj state);
+void stage_apply_rotations (FLA_Obj state, const FQAM_Pauli_term *rotations,
+                            int num_rotations);
+stage_step *stage_get (size_t idx);
+void stage_step_free (stage_step *step);
+int stage_step_size (stage_step *step);
+FQAM_Op *stage_step_gate (stage_step *step, int i, const int **targets,
+                          int *num_targets);
+void stage_seek (size_t step);
+void stage_rebase (void);
+void stage_rebase_onto (void *base, bool mapped);
+void measure_free (void);
+
+bool chunks_active (void);
+void chunks_apply (size_t begin, size_t end);
+
+void mps_create (void);
+void mps_free (void);
+void mps_seek (size_t step);
+void mps_window_probabilities (int first, int width, double *probs);
+
+void pauli_sum_group (FQAM_Pauli_sum *H);
+double pauli_sum_expectation (FLA_Obj state, const FQAM_Pauli_sum *H);
+
+void density_apply_step (stage_step *step, FLA_Obj rho);
+void density_marginal (const int *qubits, int num_qubits, double *probs);
+double density_expectation (const FQAM_Pauli_term *term);
+
+void stabilizer_create (void);
+void stabilizer_free (void);
+void stabilizer_seek (size_t step);
+bool stabilizer_active (void);
+void stabilizer_marginal (const int *qubits, int num_qubits, double *probs);
+double stabilizer_collapse (const int *qubits, int num_qubits, unsigned long outcome);
+void stabilizer_sample (size_t shots, uint64_t seed, unsigned long *outcomes);
+double stabilizer_expectation (const FQAM_Pauli_term *term);
+
+void sparse_create (void);
+void sparse_free (void);
+void sparse_seek (size_t step);
+bool sparse_active (void);
+void sparse_marginal (const int *qubits, int num_qubits, double *probs);
+void sparse_collapse (const int *qubits, int num_qubits, unsigned long outcome, double p);
+void sparse_sample (size_t shots, uint64_t seed, unsigned long *outcomes);
+double sparse_expectation (const FQAM_Pauli_term *term);
+
+#endif
@@ -0,0 +1,17 @@
+#include "FQAM.h"
+
+/* Aggregate of an observable over trajectories */
+typedef struct
+{
+  size_t count;     // Trajectories aggregated
+  double mean;      // Mean of <psi_t|H|psi_t> over trajectories
+  double variance;  // Sample variance over trajectories
+  double std_error; // Standard error of 'mean', sqrt (variance / count)
+} FQAM_Trajectory_stats;
+
+/*
+Quantum trajectories (Monte Carlo wavefunction) for stages with noise channels,
+run on the statevector backend in place of the 4^n density matrix.
+*/
+void FQAM_trajectories (size_t trajectories, uint64_t seed, FQAM_Pauli_sum *H,
+                        unsigned long *outcomes, FQAM_Trajectory_stats *stats);
@@ -0,0 +1,7 @@
+#include "FQAM.h"
+
+/* Commuting Pauli rotations prod_t e^{-i theta_t P_t}, theta_t given as coeff */
+void FQAM_stage_append_rotations (const FQAM_Pauli_term *rotations, int num_rotations);
+
+/* Trotterized time evolution e^{-i H time} */
+int FQAM_stage_append_trotter (FQAM_Pauli_sum *H, double time, int steps, int order);
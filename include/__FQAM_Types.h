@@ -7,6 +7,9 @@
 #define FQAM_CMPXA(angle) ((dcomplex){.real = cos (angle), .imag = sin (angle)})
 #define FQAM_CMPX(real, imag) ((dcomplex){real, imag})
 
+/* Largest number of qubits a local operator may act on */
+#define FQAM_MAX_TARGETS 8
+
 #define FQAM_SUCCESS (-1)
 #define FQAM_FAILURE (-2)
 
@@ -1,6 +1,99 @@
 #include "FLAME.h"
+#include "FQAM.h"
+#include <stdint.h>
+
+/* Hot sweeps are compiled for x86-64-v3 (AVX2, FMA) and x86-64-v4 (AVX-512)
+ * besides the baseline, and the variant matching the CPU is picked once at load
+ * time (function multiversioning), so one build runs on every x86-64
+ * generation. Builds for a single CPU (make MARCH=...) define FQAM_NO_CLONES */
+#if defined(__x86_64__) && defined(__GNUC__) && !defined(__clang__) && __GNUC__ >= 11 && \
+    !defined(FQAM_NO_CLONES)
+#define KERNEL_CLONES \
+  __attribute__ ((target_clones ("arch=x86-64-v3", "arch=x86-64-v4", "default")))
+#else
+#define KERNEL_CLONES
+#endif
+
+/* Byte-wise gather tables. table[b][v] holds the bits selected by a qubit subset
+ * from byte 'b' of a basis index whose value is 'v', packed so that qubit j of
+ * the subset lands on bit j. The packed bits of index 'i' are the OR over bytes
+ * of table[b][(i >> 8b) & 0xFF] */
+typedef struct
+{
+  uint64_t table[8][256];
+  int bytes;
+} kernel_gather_t;
+
+void kernel_gather_init (kernel_gather_t *g, int dim, const int *qubits, int num_qubits);
+
+/* Packed bits of every index sharing the bits of 'i' above the lowest byte */
+static inline uint64_t kernel_gather_high (const kernel_gather_t *g, uint64_t i)
+{
+  uint64_t key = 0;
+  for (int b = 1; b < g->bytes; b++)
+    key |= g->table[b][(i >> (8 * b)) & 0xFF];
+  return key;
+}
+
+/* Statevectors hold double complex amplitudes, or single complex ones in single
+ * precision mode (FQAM_PRECISION_SINGLE). Kernels load and store amplitudes
+ * through kernel_amp_get and kernel_amp_set and compute in double precision.
+ * The precision flag is loop invariant, so compilers unswitch kernel loops into
+ * one loop per precision */
+static inline bool kernel_is_single (FLA_Obj state)
+{
+  return FLA_Obj_datatype (state) == FLA_COMPLEX;
+}
+
+static inline dcomplex kernel_amp_get (const void *psi, uint64_t i, bool single)
+{
+  if (single)
+  {
+    scomplex a = ((const scomplex *)psi)[i];
+    return (dcomplex){a.real, a.imag};
+  }
+  return ((const dcomplex *)psi)[i];
+}
+
+static inline void kernel_amp_set (void *psi, uint64_t i, dcomplex a, bool single)
+{
+  if (single)
+    ((scomplex *)psi)[i] = (scomplex){(float)a.real, (float)a.imag};
+  else
+    ((dcomplex *)psi)[i] = a;
+}
+
+/* Address of amplitude 'i' */
+static inline void *kernel_amp_at (void *psi, uint64_t i, bool single)
+{
+  return (char *)psi + i * (single ? sizeof (scomplex) : sizeof (dcomplex));
+}
+
+/* Local operator U applied to 'targets', see kernel_apply_local */
+typedef struct
+{
+  FLA_Obj U;
+  const int *targets;
+  int num_targets;
+} kernel_gate_t;
 
 int kernel_kron_prod_rec (FLA_Obj A, FLA_Obj B, FLA_Obj C, int nb_alg);
 
 // int kernel_kron_prod (FLA_Obj A, FLA_Obj B, FLA_Obj C);
-int compute_probability_adjacency_matrix (FLA_Obj A, FLA_Obj state, FLA_Obj C);
\ No newline at end of file
+int compute_probability_adjacency_matrix (FLA_Obj A, FLA_Obj state, FLA_Obj C);
+int kernel_marginal_probabilities (FLA_Obj state, const int *qubits, int num_qubits,
+                                   double *probs);
+int kernel_collapse (FLA_Obj state, const int *qubits, int num_qubits,
+                     uint64_t outcome, double scale);
+void kernel_walsh_hadamard (double *w, uint64_t size);
+int kernel_pauli_expectation (FLA_Obj state, const FQAM_Pauli_term *terms,
+                              size_t num_terms, double *result);
+int kernel_pauli_rotations (FLA_Obj state, const FQAM_Pauli_term *rotations,
+                            size_t num_rotations);
+int kernel_apply_local (FLA_Obj state, FLA_Obj U, const int *targets, int k);
+int kernel_apply_layer (FLA_Obj state, const kernel_gate_t *gates, int num_gates);
+int kernel_apply_sequence (FLA_Obj state, const kernel_gate_t *gates, int num_gates);
+int kernel_apply_repeated (FLA_Obj state, FLA_Obj U, const int *sites, int num_sites,
+                           int k);
+int kernel_swap_qubits (FLA_Obj state, const int *a, const int *b, int num_pairs);
+int kernel_expand_local (FLA_Obj U, const int *targets, int k, FLA_Obj C);
@@ -0,0 +1,383 @@
+/*
+    Copyright (C) 2024, Chuck Garcia
+
+    This file is part of libfqam and is available under the 3-Clause
+    BSD license, which can be found in the LICENSE file at the top-level
+    directory, or at http://opensource.org/licenses/BSD-3-Clause
+*/
+
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+
+#include "FQAM.h"
+#include "__FQAM_Stage.h"
+#include "__kernels.h"
+#include "arraylist.h"
+#include "assertf.h"
+
+/* Steps looked ahead when choosing which local qubit to swap out */
+#define SCHEDULE_LOOKAHEAD 64
+
+/*
+Out-of-core execution (config.chunk_qubits = L). The statevector is cut into
+contiguous chunks of 2^L amplitudes, within which the L lowest (physical) qubits
+are local. The scheduler keeps a permutation of logical qubits onto physical
+ones and inserts qubit swaps so that every step acts on local qubits only. The
+executor then applies each run of consecutive local steps chunk by chunk, so a
+run reads and writes every chunk once however many steps it holds, and each
+swap takes one sweep over two strided streams (see kernel_swap_qubits). The identity permutation is restored at the
+end, leaving the statevector in logical order.
+*/
+
+/* Kinds of schedule entries */
+typedef enum
+{
+  PLAN_RUN,    // Steps [begin, end) on local qubits, applied chunk by chunk
+  PLAN_SWAP,   // Exchange of physical qubit pairs a[j], b[j]
+  PLAN_DIRECT, // Step 'begin' applied to the whole statevector in logical order
+} plan_kind;
+
+/* Schedule entry */
+typedef struct
+{
+  plan_kind kind;
+  size_t begin, end;
+  int perm[64]; // Runs: physical qubit of each logical qubit
+  int a[64], b[64];
+  int num_pairs;
+} plan_entry;
+
+/* Schedule of a range of steps */
+typedef struct
+{
+  plan_entry *entries;
+  size_t size;
+  size_t capacity;
+} plan;
+
+/* Returns true when staged steps run out of core, see FQAM_Config.chunk_qubits */
+bool chunks_active (void)
+{
+  int L = main_stage.config.chunk_qubits;
+
+  return L > 0 && (size_t)L < main_stage.dim &&
+         main_stage.config.backend != FQAM_BACKEND_DENSITY;
+}
+
+static plan_entry *plan_add (plan *p, plan_kind kind)
+{
+  if (p->size == p->capacity)
+  {
+    p->capacity = p->capacity ? 2 * p->capacity : 16;
+    p->entries = realloc (p->entries, p->capacity * sizeof (plan_entry));
+    assertf (p->entries, "Error: Failed to allocate schedule");
+  }
+
+  plan_entry *e = &p->entries[p->size++];
+  e->kind = kind;
+  e->num_pairs = 0;
+  return e;
+}
+
+/* Logical qubits acted on by 'step', or all of them for whole register steps */
+static uint64_t step_support (stage_step *step)
+{
+  uint64_t support = 0;
+  uint64_t all = main_stage.dim < 64 ? (1ULL << main_stage.dim) - 1 : ~0ULL;
+
+  if (step->kind == STEP_PAULI)
+  {
+    for (int t = 0; t < step->num_rotations; t++)
+      support |= step->rotations[t].x_mask | step->rotations[t].z_mask;
+    return support;
+  }
+
+  for (int i = 0; i < stage_step_size (step); i++)
+  {
+    const int *targets;
+    int k;
+
+    stage_step_gate (step, i, &targets, &k);
+    if (k == 0)
+      return all;
+    for (int j = 0; j < k; j++)
+      support |= 1ULL << targets[j];
+  }
+
+  return support;
+}
+
+/* Maps logical qubit mask 'm' to physical qubits */
+static uint64_t map_mask (uint64_t m, const int *perm)
+{
+  uint64_t mapped = 0;
+
+  for (; m; m &= m - 1)
+    mapped |= 1ULL << perm[__builtin_ctzll (m)];
+  return mapped;
+}
+
+/* Records swaps of the pairs of 'e' in the permutation */
+static void swap_pairs (const plan_entry *e, int *perm, int *inv)
+{
+  for (int j = 0; j < e->num_pairs; j++)
+  {
+    int x = e->a[j], y = e->b[j], t = inv[x];
+
+    inv[x] = inv[y];
+    inv[y] = t;
+    perm[inv[x]] = x;
+    perm[inv[y]] = y;
+  }
+}
+
+/* Appends run of steps [begin, end) under permutation 'perm', if not empty */
+static void plan_run (plan *p, size_t begin, size_t end, const int *perm)
+{
+  if (begin == end)
+    return;
+
+  plan_entry *e = plan_add (p, PLAN_RUN);
+  e->begin = begin;
+  e->end = end;
+  memcpy (e->perm, perm, sizeof (e->perm));
+}
+
+/* Appends rounds of disjoint swaps bringing every logical qubit home */
+static void plan_restore (plan *p, int *perm, int *inv)
+{
+  int n = main_stage.dim;
+
+  for (;;)
+  {
+    plan_entry round = {.kind = PLAN_SWAP, .num_pairs = 0};
+    uint64_t used = 0;
+
+    for (int q = 0; q < n; q++)
+    {
+      int at = perm[q];
+
+      if (at == q || ((used >> q) & 1) || ((used >> at) & 1))
+        continue;
+
+      round.a[round.num_pairs] = q;
+      round.b[round.num_pairs++] = at;
+      used |= (1ULL << q) | (1ULL << at);
+    }
+
+    if (round.num_pairs == 0)
+      return;
+
+    swap_pairs (&round, perm, inv);
+    *plan_add (p, PLAN_SWAP) = round;
+  }
+}
+
+/*
+Appends swaps bringing the logical qubits 'support' of step 's' onto local
+qubits. Each nonlocal qubit takes the place of the local qubit, outside of the
+support, whose next use within SCHEDULE_LOOKAHEAD steps is farthest away.
+*/
+static void plan_localize (plan *p, size_t s, size_t end, uint64_t support, int L,
+                           int *perm, int *inv)
+{
+  size_t next_use[64];
+  uint64_t seen = 0, taken = map_mask (support, perm);
+  plan_entry *e = plan_add (p, PLAN_SWAP);
+
+  for (int v = 0; v < L; v++)
+    next_use[v] = SIZE_MAX;
+
+  for (size_t t = s + 1; t < end && t <= s + SCHEDULE_LOOKAHEAD; t++)
+  {
+    uint64_t fresh = step_support (stage_get (t)) & ~seen;
+
+    seen |= fresh;
+    for (; fresh; fresh &= fresh - 1)
+    {
+      int v = perm[__builtin_ctzll (fresh)];
+      if (v < L)
+        next_use[v] = t;
+    }
+  }
+
+  for (uint64_t m = support; m; m &= m - 1)
+  {
+    int q = __builtin_ctzll (m), victim = -1;
+
+    if (perm[q] < L)
+      continue;
+
+    for (int v = 0; v < L; v++)
+      if (!((taken >> v) & 1) && (victim < 0 || next_use[v] > next_use[victim]))
+        victim = v;
+
+    e->a[e->num_pairs] = victim;
+    e->b[e->num_pairs++] = perm[q];
+    taken |= 1ULL << victim;
+  }
+
+  swap_pairs (e, perm, inv);
+}
+
+/* Schedules steps [begin, end) on chunks of 2^L amplitudes */
+static void schedule (size_t begin, size_t end, int L, plan *p)
+{
+  int n = main_stage.dim, perm[64], inv[64];
+  size_t run = begin;
+
+  for (int q = 0; q < n; q++)
+    perm[q] = inv[q] = q;
+
+  for (size_t s = begin; s < end; s++)
+  {
+    uint64_t support = step_support (stage_get (s));
+    bool direct = __builtin_popcountll (support) > L;
+
+    if (!direct && map_mask (support, perm) < (1ULL << L))
+      continue;
+
+    plan_run (p, run, s, perm);
+
+    // Steps wider than a chunk (e.g. whole register operators) see logical order
+    if (direct)
+    {
+      plan_restore (p, perm, inv);
+      plan_add (p, PLAN_DIRECT)->begin = s;
+      run = s + 1;
+      continue;
+    }
+
+    plan_localize (p, s, end, support, L, perm, inv);
+    run = s;
+  }
+
+  plan_run (p, run, end, perm);
+  plan_restore (p, perm, inv);
+}
+
+/* Applies local 'step' to 'chunk', mapping its qubits by 'perm' */
+static void chunk_apply_step (stage_step *step, FLA_Obj chunk, const int *perm)
+{
+  switch (step->kind)
+  {
+  case STEP_PAULI:
+  {
+    FQAM_Pauli_term *mapped = malloc (step->num_rotations * sizeof (FQAM_Pauli_term));
+    assertf (mapped, "Error: Failed to allocate rotations");
+
+    // Relabeling keeps rotations sharing x_mask adjacent
+    for (int t = 0; t < step->num_rotations; t++)
+      mapped[t] = (FQAM_Pauli_term){step->rotations[t].coeff,
+                                    map_mask (step->rotations[t].x_mask, perm),
+                                    map_mask (step->rotations[t].z_mask, perm)};
+
+    stage_apply_rotations (chunk, mapped, step->num_rotations);
+    free (mapped);
+    break;
+  }
+
+  case STEP_LAYER:
+  {
+    kernel_gate_t *gates = malloc (step->num_gates * sizeof (kernel_gate_t));
+    int *targets = malloc (step->num_gates * FQAM_MAX_TARGETS * sizeof (int));
+    assertf (gates && targets, "Error: Failed to allocate layer");
+
+    for (int i = 0; i < step->num_gates; i++)
+    {
+      int *t = targets + i * FQAM_MAX_TARGETS;
+
+      for (int j = 0; j < step->gates[i].num_targets; j++)
+        t[j] = perm[step->gates[i].targets[j]];
+      gates[i] = (kernel_gate_t){step->gates[i].op->mat_repr, t,
+                                 step->gates[i].num_targets};
+    }
+
+    kernel_apply_layer (chunk, gates, step->num_gates);
+    free (gates);
+    free (targets);
+    break;
+  }
+
+  case STEP_REPEATED:
+  {
+    int k = step->num_targets;
+    int *sites = malloc (step->num_sites * k * sizeof (int));
+    assertf (sites, "Error: Failed to allocate sites");
+
+    for (int i = 0; i < step->num_sites * k; i++)
+      sites[i] = perm[step->sites[i]];
+
+    kernel_apply_repeated (chunk, step->op->mat_repr, sites, step->num_sites, k);
+    free (sites);
+    break;
+  }
+
+  default:
+  {
+    int targets[FQAM_MAX_TARGETS];
+
+    for (int j = 0; j < step->num_targets; j++)
+      targets[j] = perm[step->targets[j]];
+    kernel_apply_local (chunk, step->op->mat_repr, targets, step->num_targets);
+  }
+  }
+}
+
+/* Applies run 'e' to every chunk in turn. Mapped statevectors read the next
+ * chunk ahead while the current one is processed */
+static void run_apply (const plan_entry *e, int L)
+{
+  FLA_Obj state = main_stage.statevector;
+  void *psi = FLA_Obj_buffer_at_view (state);
+  bool single = kernel_is_single (state);
+  uint64_t chunk = 1ULL << L, chunks = main_stage.state_space >> L;
+  size_t chunk_bytes = chunk * main_stage.amp_size;
+
+  for (uint64_t c = 0; c < chunks; c++)
+  {
+    FLA_Obj view;
+
+    if (main_stage.state_mapped && c + 1 < chunks)
+      madvise (kernel_amp_at (psi, (c + 1) * chunk, single), chunk_bytes,
+               MADV_WILLNEED);
+
+    FLA_Obj_create_without_buffer (FLA_Obj_datatype (state), chunk, 1, &view);
+    FLA_Obj_attach_buffer (kernel_amp_at (psi, c * chunk, single), 1, chunk, &view);
+
+    for (size_t s = e->begin; s < e->end; s++)
+      chunk_apply_step (stage_get (s), view, e->perm);
+
+    FLA_Obj_free_without_buffer (&view);
+  }
+}
+
+/* Applies steps [begin, end) to the statevector out of core */
+void chunks_apply (size_t begin, size_t end)
+{
+  int L = main_stage.config.chunk_qubits;
+  plan p = {NULL, 0, 0};
+
+  schedule (begin, end, L, &p);
+
+  for (size_t i = 0; i < p.size; i++)
+  {
+    const plan_entry *e = &p.entries[i];
+
+    switch (e->kind)
+    {
+    case PLAN_RUN:
+      run_apply (e, L);
+      break;
+    case PLAN_SWAP:
+      kernel_swap_qubits (main_stage.statevector, e->a, e->b, e->num_pairs);
+      break;
+    case PLAN_DIRECT:
+      stage_apply_step (stage_get (e->begin), main_stage.statevector);
+      break;
+    }
+  }
+
+  free (p.entries);
+}
@@ -0,0 +1,548 @@
+/*
+    Copyright (C) 2024, Chuck Garcia
+
+    This file is part of libfqam and is available under the 3-Clause
+    BSD license, which can be found in the LICENSE file at the top-level
+    directory, or at http://opensource.org/licenses/BSD-3-Clause
+*/
+
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "FQAM.h"
+#include "__FQAM_Stage.h"
+#include "arraylist.h"
+#include "assertf.h"
+
+#define CIRCUIT_MAGIC "FQAMCIRC"
+#define CIRCUIT_VERSION 1
+
+/* Targets per gate record, fixed by the format */
+#define CIRCUIT_MAX_TARGETS 8
+
+/* Largest operator stored, bounding matrix sizes read from files */
+#define CIRCUIT_MAX_OP_QUBITS 24
+
+_Static_assert (FQAM_MAX_TARGETS <= CIRCUIT_MAX_TARGETS,
+                "Gate records hold at most CIRCUIT_MAX_TARGETS targets");
+
+/*
+Circuit files hold fixed size, native endian records, so loading reads them in
+place from a read only mapping with no parsing:
+
+    header                         circuit_header
+    operator table                 circuit_op[num_ops]
+    steps                          circuit_step[num_steps]
+    gates                          circuit_gate[num_gates]
+    rotations                      circuit_rotation[num_rotations]
+    matrices                       2^k x 2^k column major dcomplex per operator
+
+Sections are located by the offsets in the header. Operators with equal
+matrices are stored once and shared by every gate applying them. Steps refer to
+a range of gate records (operators, layers, repeated operators, and the Kraus
+operators of channels) or of rotation records (Pauli rotations).
+*/
+
+/* Step kinds as stored in files, independent of stage_step_kind */
+enum
+{
+  CIRCUIT_OPERATOR = 0,
+  CIRCUIT_LAYER = 1,
+  CIRCUIT_REPEATED = 2,
+  CIRCUIT_PAULI = 3,
+  CIRCUIT_CHANNEL = 4,
+};
+
+typedef struct
+{
+  char magic[8];
+  uint32_t version;
+  uint32_t num_qubits;
+  uint32_t num_ops;
+  uint32_t num_steps;
+  uint32_t num_gates;
+  uint32_t num_rotations;
+  uint64_t ops_offset;
+  uint64_t steps_offset;
+  uint64_t gates_offset;
+  uint64_t rotations_offset;
+} circuit_header;
+
+typedef struct
+{
+  char name[32];
+  uint32_t dimension; // Qubits acted on
+  uint32_t reserved;
+  uint64_t matrix;    // Offset of the matrix
+} circuit_op;
+
+typedef struct
+{
+  uint32_t kind;
+  uint32_t count; // Gate or rotation records of the step
+  uint64_t first; // Index of its first record
+} circuit_step;
+
+typedef struct
+{
+  uint32_t op;          // Index into the operator table
+  uint32_t num_targets; // Zero for operators spanning the register
+  int32_t targets[CIRCUIT_MAX_TARGETS];
+} circuit_gate;
+
+typedef struct
+{
+  double theta;
+  uint64_t x_mask;
+  uint64_t z_mask;
+} circuit_rotation;
+
+/* Records of a circuit file being saved */
+typedef struct
+{
+  FQAM_Op **ops;
+  uint64_t *hashes;
+  size_t num_ops, ops_capacity;
+
+  circuit_step *steps;
+  size_t num_steps, steps_capacity;
+
+  circuit_gate *gates;
+  size_t num_gates, gates_capacity;
+
+  circuit_rotation *rotations;
+  size_t num_rotations, rotations_capacity;
+} circuit_tables;
+
+/* Returns a new element at the end of '*array' of 'elem' bytes per element,
+ * growing it as needed */
+static void *table_add (void **array, size_t *size, size_t *capacity, size_t elem)
+{
+  if (*size == *capacity)
+  {
+    *capacity = *capacity ? 2 * *capacity : 16;
+    *array = realloc (*array, *capacity * elem);
+    assertf (*array, "Error: Failed to allocate circuit tables");
+  }
+
+  return (char *)*array + (*size)++ * elem;
+}
+
+/* Returns the FNV-1a hash of the matrix of 'op' */
+static uint64_t op_hash (FQAM_Op *op)
+{
+  const dcomplex *a = FLA_Obj_buffer_at_view (op->mat_repr);
+  dim_t m = FLA_Obj_length (op->mat_repr), cs = FLA_Obj_col_stride (op->mat_repr);
+  uint64_t hash = 0xcbf29ce484222325ULL;
+
+  for (dim_t c = 0; c < m; c++)
+  {
+    const unsigned char *bytes = (const unsigned char *)(a + c * cs);
+
+    for (size_t i = 0; i < m * sizeof (dcomplex); i++)
+      hash = (hash ^ bytes[i]) * 0x100000001b3ULL;
+  }
+
+  return hash;
+}
+
+static bool op_equal (FQAM_Op *a, FQAM_Op *b)
+{
+  const dcomplex *x = FLA_Obj_buffer_at_view (a->mat_repr);
+  const dcomplex *y = FLA_Obj_buffer_at_view (b->mat_repr);
+  dim_t m = FLA_Obj_length (a->mat_repr);
+  dim_t xs = FLA_Obj_col_stride (a->mat_repr), ys = FLA_Obj_col_stride (b->mat_repr);
+
+  if (a->dimension != b->dimension)
+    return false;
+
+  for (dim_t c = 0; c < m; c++)
+    if (memcmp (x + c * xs, y + c * ys, m * sizeof (dcomplex)))
+      return false;
+
+  return true;
+}
+
+/* Returns the operator table index of 'op', adding it unless an operator with
+ * an equal matrix is stored already */
+static uint32_t table_op (circuit_tables *t, FQAM_Op *op)
+{
+  uint64_t hash = op_hash (op);
+
+  for (size_t i = 0; i < t->num_ops; i++)
+    if (t->ops[i] == op || (t->hashes[i] == hash && op_equal (t->ops[i], op)))
+      return i;
+
+  assertf (op->dimension <= CIRCUIT_MAX_OP_QUBITS,
+           "Error: Operator on %d qubits too large for circuit files", op->dimension);
+
+  size_t capacity = t->ops_capacity;
+  *(FQAM_Op **)table_add ((void **)&t->ops, &t->num_ops, &t->ops_capacity,
+                          sizeof (FQAM_Op *)) = op;
+
+  if (t->ops_capacity != capacity)
+  {
+    t->hashes = realloc (t->hashes, t->ops_capacity * sizeof (uint64_t));
+    assertf (t->hashes, "Error: Failed to allocate circuit tables");
+  }
+  t->hashes[t->num_ops - 1] = hash;
+
+  return t->num_ops - 1;
+}
+
+/* Appends a gate record applying 'op' to 'targets' */
+static void table_gate (circuit_tables *t, FQAM_Op *op, const int *targets,
+                        int num_targets)
+{
+  circuit_gate *g = table_add ((void **)&t->gates, &t->num_gates, &t->gates_capacity,
+                               sizeof (circuit_gate));
+
+  memset (g, 0, sizeof (circuit_gate));
+  g->op = table_op (t, op);
+  g->num_targets = num_targets;
+  for (int j = 0; j < num_targets; j++)
+    g->targets[j] = targets[j];
+}
+
+/* Appends the records of 'step' */
+static void table_step (circuit_tables *t, stage_step *step)
+{
+  circuit_step *s = table_add ((void **)&t->steps, &t->num_steps, &t->steps_capacity,
+                               sizeof (circuit_step));
+
+  switch (step->kind)
+  {
+  case STEP_PAULI:
+    s->kind = CIRCUIT_PAULI;
+    s->first = t->num_rotations;
+    for (int r = 0; r < step->num_rotations; r++)
+      *(circuit_rotation *)table_add ((void **)&t->rotations, &t->num_rotations,
+                                      &t->rotations_capacity, sizeof (circuit_rotation)) =
+          (circuit_rotation){step->rotations[r].coeff, step->rotations[r].x_mask,
+                             step->rotations[r].z_mask};
+    break;
+
+  case STEP_CHANNEL:
+    s->kind = CIRCUIT_CHANNEL;
+    s->first = t->num_gates;
+    for (int i = 0; i < step->num_kraus; i++)
+      table_gate (t, &step->owned[i], step->targets, step->num_targets);
+    break;
+
+  default:
+    s->kind = step->kind == STEP_LAYER      ? CIRCUIT_LAYER
+              : step->kind == STEP_REPEATED ? CIRCUIT_REPEATED
+                                            : CIRCUIT_OPERATOR;
+    s->first = t->num_gates;
+    for (int i = 0; i < stage_step_size (step); i++)
+    {
+      const int *targets;
+      int k;
+      FQAM_Op *op = stage_step_gate (step, i, &targets, &k);
+
+      table_gate (t, op, targets, k);
+    }
+  }
+
+  s->count = step->kind == STEP_PAULI ? t->num_rotations - s->first
+                                      : t->num_gates - s->first;
+}
+
+static void write_all (FILE *f, const void *data, size_t size, const char *path)
+{
+  assertf (size == 0 || fwrite (data, size, 1, f) == 1,
+           "Error: Failed to write circuit file %s", path);
+}
+
+/*
+Saves the staged steps to the circuit file 'path', see FQAM_circuit_load.
+
+Notes:
+ - Operators with equal matrices are stored once, however many steps apply them.
+ - Rotations are saved as angles and masks, channels by their Kraus operators.
+ - Steps before the last measurement are saved too, the collapse itself is not.
+*/
+void FQAM_circuit_save (const char *path)
+{
+  assertf (FQAM_initialized (), "Error: Expected stage initialized");
+
+  circuit_tables t = {0};
+  circuit_header h = {0};
+
+  for (size_t s = 0; s < main_stage.stage->size; s++)
+    table_step (&t, stage_get (s));
+
+  memcpy (h.magic, CIRCUIT_MAGIC, sizeof (h.magic));
+  h.version = CIRCUIT_VERSION;
+  h.num_qubits = main_stage.dim;
+  h.num_ops = t.num_ops;
+  h.num_steps = t.num_steps;
+  h.num_gates = t.num_gates;
+  h.num_rotations = t.num_rotations;
+  h.ops_offset = sizeof (circuit_header);
+  h.steps_offset = h.ops_offset + t.num_ops * sizeof (circuit_op);
+  h.gates_offset = h.steps_offset + t.num_steps * sizeof (circuit_step);
+  h.rotations_offset = h.gates_offset + t.num_gates * sizeof (circuit_gate);
+
+  FILE *f = fopen (path, "wb");
+  assertf (f, "Error: Failed to create circuit file %s", path);
+
+  write_all (f, &h, sizeof (h), path);
+
+  uint64_t matrix = h.rotations_offset + t.num_rotations * sizeof (circuit_rotation);
+
+  for (size_t i = 0; i < t.num_ops; i++)
+  {
+    circuit_op op = {0};
+
+    memcpy (op.name, t.ops[i]->name, strnlen (t.ops[i]->name, sizeof (op.name) - 1));
+    op.dimension = t.ops[i]->dimension;
+    op.matrix = matrix;
+    matrix += (sizeof (dcomplex) << op.dimension) << op.dimension;
+
+    write_all (f, &op, sizeof (op), path);
+  }
+
+  write_all (f, t.steps, t.num_steps * sizeof (circuit_step), path);
+  write_all (f, t.gates, t.num_gates * sizeof (circuit_gate), path);
+  write_all (f, t.rotations, t.num_rotations * sizeof (circuit_rotation), path);
+
+  for (size_t i = 0; i < t.num_ops; i++)
+  {
+    FLA_Obj A = t.ops[i]->mat_repr;
+    const dcomplex *a = FLA_Obj_buffer_at_view (A);
+    dim_t m = FLA_Obj_length (A);
+
+    for (dim_t c = 0; c < m; c++)
+      write_all (f, a + c * FLA_Obj_col_stride (A), m * sizeof (dcomplex), path);
+  }
+
+  assertf (fclose (f) == 0, "Error: Failed to write circuit file %s", path);
+
+  free (t.ops);
+  free (t.hashes);
+  free (t.steps);
+  free (t.gates);
+  free (t.rotations);
+}
+
+/* Returns the section of 'count' records of 'elem' bytes at 'offset' of mapped
+ * file 'base' of 'size' bytes, checked to lie within the file */
+static const void *section (const char *base, size_t size, uint64_t offset,
+                            uint64_t count, size_t elem, const char *path)
+{
+  assertf (offset <= size && count <= (size - offset) / elem,
+           "Error: Circuit file %s is truncated or corrupt", path);
+
+  return base + offset;
+}
+
+/* Appends step 's', whose records were checked to lie within the file */
+static void load_step (const circuit_step *s, const circuit_gate *gates,
+                       const circuit_rotation *rotations, FQAM_Circuit *circuit,
+                       bool *staged, const char *path)
+{
+  const circuit_gate *g = gates + s->first;
+  int n = s->count;
+
+  // Every step holds a gate, which 'g' is read as below
+  assertf (n >= 1, "Error: Circuit file %s is corrupt", path);
+
+  for (int i = 0; s->kind != CIRCUIT_PAULI && i < n; i++)
+    assertf (g[i].op < circuit->num_ops && g[i].num_targets <= FQAM_MAX_TARGETS,
+             "Error: Circuit file %s is corrupt", path);
+
+  switch (s->kind)
+  {
+  case CIRCUIT_OPERATOR:
+    assertf (n == 1, "Error: Circuit file %s is corrupt", path);
+    FQAM_stage_append_on (circuit->ops[g->op], g->targets, g->num_targets);
+    staged[g->op] = true;
+    break;
+
+  case CIRCUIT_LAYER:
+  case CIRCUIT_CHANNEL:
+  {
+    FQAM_Op *ops = malloc (n * sizeof (FQAM_Op));
+    int *targets = malloc (n * FQAM_MAX_TARGETS * sizeof (int));
+    int *num_targets = malloc (n * sizeof (int)), total = 0;
+
+    assertf (ops && targets && num_targets, "Error: Failed to allocate step");
+
+    for (int i = 0; i < n; i++)
+    {
+      ops[i] = circuit->ops[g[i].op];
+      num_targets[i] = g[i].num_targets;
+      memcpy (targets + total, g[i].targets, g[i].num_targets * sizeof (int));
+      total += g[i].num_targets;
+    }
+
+    // Channels copy their Kraus operators, layers refer to the table
+    if (s->kind == CIRCUIT_CHANNEL)
+      FQAM_stage_append_channel (ops, n, g->targets, g->num_targets);
+    else
+    {
+      FQAM_stage_append_layer (ops, targets, num_targets, n);
+      for (int i = 0; i < n; i++)
+        staged[g[i].op] = true;
+    }
+
+    free (ops);
+    free (targets);
+    free (num_targets);
+    break;
+  }
+
+  case CIRCUIT_REPEATED:
+  {
+    int k = g->num_targets;
+    int *sites = malloc (n * k * sizeof (int));
+
+    assertf (sites, "Error: Failed to allocate step");
+
+    for (int i = 0; i < n; i++)
+    {
+      assertf (g[i].op == g->op && g[i].num_targets == k,
+               "Error: Circuit file %s is corrupt", path);
+      memcpy (sites + i * k, g[i].targets, k * sizeof (int));
+    }
+
+    FQAM_stage_append_repeated (circuit->ops[g->op], sites, n);
+    staged[g->op] = true;
+    free (sites);
+    break;
+  }
+
+  case CIRCUIT_PAULI:
+  {
+    FQAM_Pauli_term *terms = malloc (n * sizeof (FQAM_Pauli_term));
+
+    assertf (terms, "Error: Failed to allocate step");
+
+    for (int r = 0; r < n; r++)
+      terms[r] = (FQAM_Pauli_term){rotations[s->first + r].theta,
+                                   rotations[s->first + r].x_mask,
+                                   rotations[s->first + r].z_mask};
+
+    FQAM_stage_append_rotations (terms, n);
+    free (terms);
+    break;
+  }
+
+  default:
+    assertf (false, "Error: Unknown step kind %u in circuit file %s", s->kind, path);
+  }
+}
+
+/*
+Appends the steps of circuit file 'path' to the stage.
+
+Arguments:
+    path: Circuit file, e.g. written by FQAM_circuit_save or tools/fqam_convert,
+          on as many qubits as the stage
+    circuit: Receives the operator table the stage refers to. Free with
+             FQAM_circuit_free after FQAM_finalize.
+
+Notes:
+ - The file is mapped read only and its records read in place. Only the
+   deduplicated operator matrices are copied, once each, into operators shared
+   by every step applying them.
+ - Steps are validated as when appended through the stage API.
+*/
+void FQAM_circuit_load (const char *path, FQAM_Circuit *circuit)
+{
+  assertf (FQAM_initialized (), "Error: Expected stage initialized");
+
+  int fd = open (path, O_RDONLY);
+  struct stat st;
+
+  assertf (fd >= 0, "Error: Failed to open circuit file %s", path);
+  assertf (fstat (fd, &st) == 0 && (size_t)st.st_size >= sizeof (circuit_header),
+           "Error: Circuit file %s is truncated", path);
+
+  size_t size = st.st_size;
+  const char *base = mmap (NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+  close (fd);
+  assertf (base != MAP_FAILED, "Error: Failed to map circuit file %s", path);
+  madvise ((void *)base, size, MADV_SEQUENTIAL);
+
+  const circuit_header *h = (const circuit_header *)base;
+
+  assertf (memcmp (h->magic, CIRCUIT_MAGIC, sizeof (h->magic)) == 0,
+           "Error: %s is not a circuit file", path);
+  assertf (h->version == CIRCUIT_VERSION,
+           "Error: Circuit file %s has unsupported version %u", path, h->version);
+  assertf (h->num_qubits == main_stage.dim,
+           "Error: Circuit on %u qubits loaded into %zu qubit stage", h->num_qubits,
+           main_stage.dim);
+
+  const circuit_op *ops =
+      section (base, size, h->ops_offset, h->num_ops, sizeof (circuit_op), path);
+  const circuit_step *steps =
+      section (base, size, h->steps_offset, h->num_steps, sizeof (circuit_step), path);
+  const circuit_gate *gates =
+      section (base, size, h->gates_offset, h->num_gates, sizeof (circuit_gate), path);
+  const circuit_rotation *rotations = section (
+      base, size, h->rotations_offset, h->num_rotations, sizeof (circuit_rotation), path);
+
+  circuit->num_ops = h->num_ops;
+  circuit->num_steps = h->num_steps;
+  circuit->ops = malloc (h->num_ops * sizeof (FQAM_Op));
+  bool *staged = calloc (h->num_ops + 1, sizeof (bool));
+  assertf (circuit->ops && staged, "Error: Failed to allocate circuit");
+
+  for (size_t i = 0; i < h->num_ops; i++)
+  {
+    int k = ops[i].dimension;
+    char name[sizeof (ops[i].name) + 1] = {0};
+
+    assertf (k <= CIRCUIT_MAX_OP_QUBITS, "Error: Circuit file %s is corrupt", path);
+
+    uint64_t d = 1ULL << k;
+    const dcomplex *matrix =
+        section (base, size, ops[i].matrix, d * d, sizeof (dcomplex), path);
+
+    memcpy (name, ops[i].name, sizeof (ops[i].name));
+    FQAM_Op_create (&circuit->ops[i], name, k);
+
+    dcomplex *a = FLA_Obj_buffer_at_view (circuit->ops[i].mat_repr);
+    dim_t cs = FLA_Obj_col_stride (circuit->ops[i].mat_repr);
+
+    for (uint64_t c = 0; c < d; c++)
+      memcpy (a + c * cs, matrix + c * d, d * sizeof (dcomplex));
+  }
+
+  for (size_t s = 0; s < h->num_steps; s++)
+  {
+    uint64_t records = steps[s].kind == CIRCUIT_PAULI ? h->num_rotations : h->num_gates;
+
+    assertf (steps[s].first <= records && steps[s].count <= records - steps[s].first,
+             "Error: Circuit file %s is corrupt", path);
+
+    load_step (&steps[s], gates, rotations, circuit, staged, path);
+  }
+
+  // Operators only used by channels were copied into their steps
+  for (size_t i = 0; i < h->num_ops; i++)
+    if (!staged[i])
+      FQAM_Operator_free (&circuit->ops[i]);
+
+  free (staged);
+  munmap ((void *)base, size);
+}
+
+/* Frees the operator table of 'circuit'. The stage refers to its operators,
+ * whose matrices FQAM_finalize frees, so call once finalized */
+void FQAM_circuit_free (FQAM_Circuit *circuit)
+{
+  free (circuit->ops);
+  circuit->ops = NULL;
+  circuit->num_ops = 0;
+  circuit->num_steps = 0;
+}
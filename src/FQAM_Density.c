@@ -0,0 +1,374 @@
+/*
+    Copyright (C) 2024, Chuck Garcia
+
+    This file is part of libfqam and is available under the 3-Clause
+    BSD license, which can be found in the LICENSE file at the top-level
+    directory, or at http://opensource.org/licenses/BSD-3-Clause
+*/
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "FQAM.h"
+#include "__FQAM_Stage.h"
+#include "__kernels.h"
+#include "arraylist.h"
+#include "assertf.h"
+
+/* Tolerance of the trace preservation check on Kraus operators */
+#define KRAUS_TOL 1e-9
+
+/*
+The density backend stores rho (2^n x 2^n, column major) as vec(rho), whose
+entry r + 2^n c is rho[r, c]. Viewed as a statevector of 2n qubits, qubit q < n
+indexes rows (kets) and qubit n + q columns (bras), so U rho U^H is U on the
+targets followed by conj(U) on the targets shifted by n.
+*/
+
+/* Stores the entrywise conjugate of U into new object 'Ubar' */
+static void conjugate_copy (FLA_Obj U, FLA_Obj *Ubar)
+{
+  FLA_Obj_create_conf_to (FLA_NO_TRANSPOSE, U, Ubar);
+  FLA_Copy (U, *Ubar);
+
+  dcomplex *buf = FLA_Obj_buffer_at_view (*Ubar);
+  dim_t cs = FLA_Obj_col_stride (*Ubar);
+
+  for (dim_t c = 0; c < FLA_Obj_width (*Ubar); c++)
+    for (dim_t r = 0; r < FLA_Obj_length (*Ubar); r++)
+      buf[r + c * cs].imag = -buf[r + c * cs].imag;
+}
+
+/* rho := U rho U^H for operator U on 'targets', zero targets denoting the
+ * whole register */
+static void gate_apply (FLA_Obj rho, FLA_Obj U, const int *targets, int k)
+{
+  int n = main_stage.dim, bra[FQAM_MAX_TARGETS];
+  FLA_Obj Ubar;
+
+  // Whole register: two products with rho as a 2^n x 2^n matrix
+  if (k == 0)
+  {
+    dim_t N = (dim_t)1 << n;
+    FLA_Obj R, T;
+
+    FLA_Obj_create_without_buffer (FLA_DOUBLE_COMPLEX, N, N, &R);
+    FLA_Obj_attach_buffer (FLA_Obj_buffer_at_view (rho), 1, N, &R);
+    FLA_Obj_create (FLA_DOUBLE_COMPLEX, N, N, 0, 0, &T);
+
+    FLA_Gemm (FLA_NO_TRANSPOSE, FLA_NO_TRANSPOSE, FLA_ONE, U, R, FLA_ZERO, T);
+    FLA_Gemm (FLA_NO_TRANSPOSE, FLA_CONJ_TRANSPOSE, FLA_ONE, T, U, FLA_ZERO, R);
+
+    FLA_Obj_free_without_buffer (&R);
+    FLA_Obj_free (&T);
+    return;
+  }
+
+  for (int j = 0; j < k; j++)
+    bra[j] = targets[j] + n;
+
+  conjugate_copy (U, &Ubar);
+  kernel_apply_local (rho, U, targets, k);
+  kernel_apply_local (rho, Ubar, bra, k);
+  FLA_Obj_free (&Ubar);
+}
+
+/* Applies staged step to vec(rho) in place */
+void density_apply_step (stage_step *step, FLA_Obj rho)
+{
+  int n = main_stage.dim;
+
+  switch (step->kind)
+  {
+  case STEP_CHANNEL:
+  {
+    int k = step->num_targets, targets[FQAM_MAX_TARGETS];
+
+    for (int j = 0; j < k; j++)
+    {
+      targets[j] = step->targets[j];
+      targets[k + j] = step->targets[j] + n;
+    }
+
+    kernel_apply_local (rho, step->op->mat_repr, targets, 2 * k);
+    break;
+  }
+
+  case STEP_PAULI:
+  {
+    // conj(e^{-i theta P}) = e^{-i theta' P} with theta' = -(-1)^{|x & z|} theta,
+    // as conj(P) = (-1)^{|x & z|} P
+    FQAM_Pauli_term *bra = malloc (step->num_rotations * sizeof (FQAM_Pauli_term));
+    assertf (bra, "Error: Failed to allocate rotations");
+
+    for (int t = 0; t < step->num_rotations; t++)
+    {
+      const FQAM_Pauli_term *r = &step->rotations[t];
+      double sign = __builtin_parityll (r->x_mask & r->z_mask) ? 1.0 : -1.0;
+
+      bra[t] = (FQAM_Pauli_term){sign * r->coeff, r->x_mask << n, r->z_mask << n};
+    }
+
+    stage_apply_rotations (rho, step->rotations, step->num_rotations);
+    stage_apply_rotations (rho, bra, step->num_rotations);
+    free (bra);
+    break;
+  }
+
+  default:
+    for (int i = 0; i < stage_step_size (step); i++)
+    {
+      const int *targets;
+      int num_targets;
+      FQAM_Op *op = stage_step_gate (step, i, &targets, &num_targets);
+
+      gate_apply (rho, op->mat_repr, targets, num_targets);
+    }
+  }
+}
+
+/* Builds superoperator S = sum_i conj(K_i) (x) K_i into 'S' (2k qubits): local
+ * index a + 2^k b holds ket bits a and bra bits b */
+static void superoperator (const FQAM_Op *kraus, int num_kraus, int k, FQAM_Op *S)
+{
+  int d = 1 << k;
+  dcomplex *s = FLA_Obj_buffer_at_view (S->mat_repr);
+  dim_t s_cs = FLA_Obj_col_stride (S->mat_repr);
+
+  for (int i = 0; i < num_kraus; i++)
+  {
+    const dcomplex *K = FLA_Obj_buffer_at_view (kraus[i].mat_repr);
+    dim_t cs = FLA_Obj_col_stride (kraus[i].mat_repr);
+
+    for (int a = 0; a < d; a++)
+      for (int b = 0; b < d; b++)
+        for (int a2 = 0; a2 < d; a2++)
+          for (int b2 = 0; b2 < d; b2++)
+          {
+            // K[a2, a] conj(K[b2, b])
+            dcomplex u = K[a2 + a * cs], v = K[b2 + b * cs];
+            dcomplex *e = &s[(a2 + d * b2) + (a + d * b) * s_cs];
+
+            e->real += u.real * v.real + u.imag * v.imag;
+            e->imag += u.imag * v.real - u.real * v.imag;
+          }
+  }
+}
+
+/*
+Appends noise channel with Kraus operators 'kraus' acting on qubits 'targets'.
+The operators are copied, so they may be freed once appended.
+
+Arguments:
+    kraus: Kraus operators on 'num_targets' qubits, e.g. built with FQAM_Op_add
+           from outer products. Must satisfy sum_i K_i^H K_i = I.
+    num_kraus: Number of Kraus operators
+    targets: Distinct target qubits, target j acted on by bit j of the index
+    num_targets: Number of targets, at most FQAM_MAX_TARGETS / 2
+*/
+void FQAM_stage_append_channel (const FQAM_Op *kraus, int num_kraus, const int *targets,
+                                int num_targets)
+{
+  assertf (FQAM_initialized (), "Error: Expected stage initialized");
+  assertf (num_kraus > 0, "Error: Expected at least one Kraus operator");
+  assertf (num_targets > 0 && num_targets <= CHANNEL_MAX_TARGETS,
+           "Error: Channels act on 1 to %d qubits", CHANNEL_MAX_TARGETS);
+
+  int k = num_targets, d = 1 << k;
+
+  for (int j = 0; j < k; j++)
+  {
+    assertf (targets[j] >= 0 && targets[j] < (int)main_stage.dim,
+             "Error: Target %d outside of register", targets[j]);
+    for (int i = 0; i < j; i++)
+      assertf (targets[i] != targets[j], "Error: Repeated target %d", targets[j]);
+  }
+
+  // Trace preservation: sum_i K_i^H K_i = I
+  FLA_Obj sum;
+  FLA_Obj_create (FLA_DOUBLE_COMPLEX, d, d, 0, 0, &sum);
+  FLA_Set (FLA_ZERO, sum);
+
+  for (int i = 0; i < num_kraus; i++)
+  {
+    assertf (kraus[i].initialized && kraus[i].dimension == k,
+             "Error: Kraus operator %d must be initialized on %d qubits", i, k);
+    FLA_Gemm (FLA_CONJ_TRANSPOSE, FLA_NO_TRANSPOSE, FLA_ONE, kraus[i].mat_repr,
+              kraus[i].mat_repr, FLA_ONE, sum);
+  }
+
+  const dcomplex *sb = FLA_Obj_buffer_at_view (sum);
+  for (int c = 0; c < d; c++)
+    for (int r = 0; r < d; r++)
+      assertf (fabs (sb[r + c * d].real - (r == c)) < KRAUS_TOL &&
+                   fabs (sb[r + c * d].imag) < KRAUS_TOL,
+               "Error: Kraus operators are not trace preserving");
+  FLA_Obj_free (&sum);
+
+  stage_step *step = calloc (1, sizeof (stage_step));
+  assertf (step, "Error: Failed to allocate stage step");
+
+  step->kind = STEP_CHANNEL;
+  step->num_targets = k;
+  memcpy (step->targets, targets, k * sizeof (int));
+
+  // Owned copies of the Kraus operators, then the superoperator
+  step->num_kraus = num_kraus;
+  step->num_owned = num_kraus + 1;
+  step->owned = malloc (step->num_owned * sizeof (FQAM_Op));
+  assertf (step->owned, "Error: Failed to allocate stage step");
+
+  for (int i = 0; i < num_kraus; i++)
+  {
+    FQAM_Op_create (&step->owned[i], (char *)kraus[i].name, k);
+    FLA_Copy (kraus[i].mat_repr, step->owned[i].mat_repr);
+  }
+
+  step->op = &step->owned[num_kraus];
+  FQAM_Op_create (step->op, (char *)kraus[0].name, 2 * k);
+  superoperator (step->owned, num_kraus, k, step->op);
+
+  arraylist_add (main_stage.stage, step);
+}
+
+/* Creates single qubit operator with entries [[a, b], [c, d]] */
+static void qubit_operator (FQAM_Op *A, char *name, double a, double b, double c,
+                            double d)
+{
+  FQAM_Op_create (A, name, 1);
+
+  dcomplex *buf = FLA_Obj_buffer_at_view (A->mat_repr);
+  dim_t cs = FLA_Obj_col_stride (A->mat_repr);
+
+  buf[0].real = a;
+  buf[cs].real = b;
+  buf[1].real = c;
+  buf[1 + cs].real = d;
+}
+
+/* Appends single qubit channel from 'num_kraus' Kraus operators and frees them */
+static void append_qubit_channel (FQAM_Op *kraus, int num_kraus, int qubit)
+{
+  FQAM_stage_append_channel (kraus, num_kraus, &qubit, 1);
+  for (int i = 0; i < num_kraus; i++)
+    FQAM_Operator_free (&kraus[i]);
+}
+
+/* Appends depolarizing channel: rho -> (1 - p) rho + p/3 (X rho X + Y rho Y + Z rho Z) */
+void FQAM_stage_append_depolarizing (int qubit, double p)
+{
+  assertf (p >= 0.0 && p <= 1.0, "Error: Probability %g outside of [0, 1]", p);
+
+  FQAM_Op K[4];
+  double a = sqrt (1.0 - p), b = sqrt (p / 3.0);
+
+  qubit_operator (&K[0], "Depolarizing", a, 0, 0, a);
+  qubit_operator (&K[1], "Depolarizing", 0, b, b, 0);
+  qubit_operator (&K[3], "Depolarizing", b, 0, 0, -b);
+
+  // Y = [[0, -i], [i, 0]]
+  qubit_operator (&K[2], "Depolarizing", 0, 0, 0, 0);
+  dcomplex *y = FLA_Obj_buffer_at_view (K[2].mat_repr);
+  y[FLA_Obj_col_stride (K[2].mat_repr)].imag = -b;
+  y[1].imag = b;
+
+  append_qubit_channel (K, 4, qubit);
+}
+
+/* Appends dephasing channel: rho -> (1 - p) rho + p Z rho Z */
+void FQAM_stage_append_dephasing (int qubit, double p)
+{
+  assertf (p >= 0.0 && p <= 1.0, "Error: Probability %g outside of [0, 1]", p);
+
+  FQAM_Op K[2];
+  double a = sqrt (1.0 - p), b = sqrt (p);
+
+  qubit_operator (&K[0], "Dephasing", a, 0, 0, a);
+  qubit_operator (&K[1], "Dephasing", b, 0, 0, -b);
+  append_qubit_channel (K, 2, qubit);
+}
+
+/* Appends amplitude damping channel, decaying |1> to |0> with probability gamma */
+void FQAM_stage_append_amplitude_damping (int qubit, double gamma)
+{
+  assertf (gamma >= 0.0 && gamma <= 1.0, "Error: Probability %g outside of [0, 1]",
+           gamma);
+
+  FQAM_Op K[2];
+
+  qubit_operator (&K[0], "Damping", 1, 0, 0, sqrt (1.0 - gamma));
+  qubit_operator (&K[1], "Damping", 0, sqrt (gamma), 0, 0);
+  append_qubit_channel (K, 2, qubit);
+}
+
+/* Marginal distribution of 'qubits' from the diagonal of rho, see FQAM_marginal */
+void density_marginal (const int *qubits, int num_qubits, double *probs)
+{
+  const dcomplex *rho = FLA_Obj_buffer_at_view (main_stage.statevector);
+  uint64_t N = 1ULL << main_stage.dim;
+
+  for (int j = 0; j < num_qubits; j++)
+    assertf (qubits[j] >= 0 && qubits[j] < (int)main_stage.dim,
+             "Error: Qubit %d out of range", qubits[j]);
+
+  memset (probs, 0, (1UL << num_qubits) * sizeof (double));
+
+  for (uint64_t b = 0; b < N; b++)
+  {
+    unsigned long key = 0;
+    for (int j = 0; j < num_qubits; j++)
+      key |= ((b >> qubits[j]) & 1) << j;
+
+    probs[key] += rho[b + N * b].real;
+  }
+}
+
+/*
+Returns Tr (P rho) for Pauli string 'term' (without its coefficient). As
+P[b ^ x, b] = i^{|x & z|} (-1)^{|b & z|}, Tr (P rho) = sum_b P[b ^ x, b] rho[b, b ^ x].
+*/
+double density_expectation (const FQAM_Pauli_term *term)
+{
+  const dcomplex *rho = FLA_Obj_buffer_at_view (main_stage.statevector);
+  uint64_t N = 1ULL << main_stage.dim, x = term->x_mask, z = term->z_mask;
+  double re = 0.0, im = 0.0;
+
+  assertf ((x | z) >> main_stage.dim == 0, "Error: Pauli term acts outside of register");
+
+#pragma omp parallel for reduction(+ : re, im) schedule(static)
+  for (uint64_t b = 0; b < N; b++)
+  {
+    double sign = __builtin_parityll (b & z) ? -1.0 : 1.0;
+    re += sign * rho[b + N * (b ^ x)].real;
+    im += sign * rho[b + N * (b ^ x)].imag;
+  }
+
+  // Multiply by i^{|x & z|}, keeping the real part
+  switch (__builtin_popcountll (x & z) & 3)
+  {
+  case 0: return re;
+  case 1: return -im;
+  case 2: return -re;
+  default: return im;
+  }
+}
+
+/* Returns purity Tr (rho^2) of the final density matrix, 1 for pure states */
+double FQAM_density_purity (void)
+{
+  assertf (FQAM_initialized (), "Error: Expected stage initialized");
+  assertf (main_stage.config.backend == FQAM_BACKEND_DENSITY,
+           "Error: Expected density matrix backend");
+
+  FQAM_compute_outcomes ();
+
+  const dcomplex *rho = FLA_Obj_buffer_at_view (main_stage.statevector);
+  double purity = 0.0;
+
+  // Tr (rho^2) = sum |rho_rc|^2 for Hermitian rho
+#pragma omp parallel for reduction(+ : purity) schedule(static)
+  for (size_t i = 0; i < main_stage.state_space; i++)
+    purity += rho[i].real * rho[i].real + rho[i].imag * rho[i].imag;
+
+  return purity;
+}
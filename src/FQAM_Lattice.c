@@ -0,0 +1,166 @@
+/*
+    Copyright (C) 2024, Chuck Garcia
+
+    This file is part of libfqam and is available under the 3-Clause
+    BSD license, which can be found in the LICENSE file at the top-level
+    directory, or at http://opensource.org/licenses/BSD-3-Clause
+*/
+
+#include <stdlib.h>
+
+#include "FQAM.h"
+#include "__FQAM_Stage.h"
+#include "assertf.h"
+
+/* Chain of 'length' sites */
+FQAM_Lattice FQAM_Lattice_1d (int length, bool periodic)
+{
+  return FQAM_Lattice_2d (1, length, periodic);
+}
+
+/* Grid of 'rows' x 'cols' sites */
+FQAM_Lattice FQAM_Lattice_2d (int rows, int cols, bool periodic)
+{
+  assertf (rows > 0 && cols > 0, "Error: Expected nonempty lattice");
+
+  return (FQAM_Lattice){.rows = rows, .cols = cols, .periodic = periodic};
+}
+
+/* Returns qubit at site (row, col), wrapping periodic lattices, or -1 when the
+ * site lies outside an open lattice */
+int FQAM_Lattice_site (FQAM_Lattice lattice, int row, int col)
+{
+  if (lattice.periodic)
+  {
+    row = ((row % lattice.rows) + lattice.rows) % lattice.rows;
+    col = ((col % lattice.cols) + lattice.cols) % lattice.cols;
+  }
+  else if (row < 0 || row >= lattice.rows || col < 0 || col >= lattice.cols)
+    return -1;
+
+  return row * lattice.cols + col;
+}
+
+/* Neighborhoods of one layer, collected for FQAM_stage_append_repeated */
+typedef struct
+{
+  int *sites;
+  int size;
+} lattice_layer;
+
+/* Adds neighborhood of 'k' sites at 'sites' unless a site lies off the lattice */
+static void layer_add (lattice_layer *layer, const int *sites, int k)
+{
+  for (int j = 0; j < k; j++)
+    if (sites[j] < 0)
+      return;
+
+  for (int j = 0; j < k; j++)
+    layer->sites[layer->size * k + j] = sites[j];
+  layer->size++;
+}
+
+/* Stages 'layer' if nonempty and resets it. Returns number of staged layers */
+static int layer_flush (lattice_layer *layer, FQAM_Op rule)
+{
+  int staged = layer->size > 0;
+
+  if (staged)
+    FQAM_stage_append_repeated (rule, layer->sites, layer->size);
+  layer->size = 0;
+
+  return staged;
+}
+
+/*
+Stages one update of a quantum cellular automaton: 'rule' applied to every
+neighborhood of 'partition', as a sequence of layers of non-overlapping
+neighborhoods. Each layer is a single stage step storing 'rule' once, applied
+in one cache tiled sweep per 12 qubits it touches (see kernel_apply_layer).
+
+Arguments:
+    lattice: Placement of qubits, must fit in the register
+    rule: Local update rule. Acts on 2 sites for brick-wall partitions, and on
+          the block sites in row major order for checkerboard partitions.
+    partition: Neighborhoods rule is applied to, see FQAM_Partition
+
+Returns number of staged layers.
+
+Notes:
+  - Periodic lattices need even extents along partitioned axes, so that
+    neighborhoods wrapping around the boundary do not overlap.
+  - Neighborhoods extending past an open boundary are skipped.
+*/
+int FQAM_Part_as_lattice (FQAM_Lattice lattice, FQAM_Op rule, FQAM_Partition partition)
+{
+  assertf (FQAM_initialized (), "Error: Expected stage initialized");
+  assertf ((size_t)lattice.rows * lattice.cols <= main_stage.dim,
+           "Error: Lattice of %d x %d sites exceeds %zu qubit register", lattice.rows,
+           lattice.cols, main_stage.dim);
+  assertf (!lattice.periodic ||
+               ((lattice.rows == 1 || lattice.rows % 2 == 0) &&
+                (lattice.cols == 1 || lattice.cols % 2 == 0)),
+           "Error: Periodic lattices need even extents");
+
+  int sites = lattice.rows * lattice.cols, staged = 0;
+  int block_rows = lattice.rows > 1 ? 2 : 1;
+  int block_cols = lattice.cols > 1 ? 2 : 1;
+  int k = partition == FQAM_PARTITION_BRICKWALL ? 2 : block_rows * block_cols;
+  lattice_layer layer = {.size = 0};
+
+  assertf (sites > 1, "Error: Expected lattice of at least two sites");
+  assertf (rule.dimension == k, "Error: Partition needs a rule on %d sites, got %d", k,
+           rule.dimension);
+
+  layer.sites = malloc (sites * k * sizeof (int));
+  assertf (layer.sites, "Error: Failed to allocate lattice layer");
+
+  switch (partition)
+  {
+  case FQAM_PARTITION_BRICKWALL:
+    // Horizontal bonds, then vertical bonds, each even then odd
+    for (int axis = 0; axis < 2; axis++)
+    {
+      if ((axis == 0 ? lattice.cols : lattice.rows) == 1)
+        continue;
+
+      for (int parity = 0; parity < 2; parity++)
+      {
+        for (int r = 0; r < lattice.rows; r++)
+          for (int c = 0; c < lattice.cols; c++)
+          {
+            if ((axis == 0 ? c : r) % 2 != parity)
+              continue;
+
+            int bond[2] = {FQAM_Lattice_site (lattice, r, c),
+                           FQAM_Lattice_site (lattice, r + axis, c + !axis)};
+            layer_add (&layer, bond, 2);
+          }
+        staged += layer_flush (&layer, rule);
+      }
+    }
+    break;
+
+  case FQAM_PARTITION_CHECKERBOARD:
+    // Blocks at even sites, then shifted by one site along every axis
+    for (int shift = 0; shift < 2; shift++)
+    {
+      for (int r = shift * (block_rows - 1); r < lattice.rows; r += block_rows)
+        for (int c = shift * (block_cols - 1); c < lattice.cols; c += block_cols)
+        {
+          int block[4], j = 0;
+
+          for (int dr = 0; dr < block_rows; dr++)
+            for (int dc = 0; dc < block_cols; dc++)
+              block[j++] = FQAM_Lattice_site (lattice, r + dr, c + dc);
+          layer_add (&layer, block, k);
+        }
+      staged += layer_flush (&layer, rule);
+    }
+    break;
+  }
+
+  free (layer.sites);
+
+  return staged;
+}
@@ -6,25 +6,40 @@
     directory, or at http://opensource.org/licenses/BSD-3-Clause
 */
 
+#include <fcntl.h>
 #include <math.h>
 #include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <unistd.h>
 
 #include "FQAM.h"
+#include "__FQAM_Stage.h"
+#include "__kernels.h"
 #include "arraylist.h"
 #include "assertf.h"
 
 static bool _FQAM_initialized = false;
 
-/* Stage Struct */
-struct stage
-{
-  FLA_Obj statevector; // Quantum statevector
-  size_t dim;          // Dimension of hilbertspace
-  size_t state_space;  // Statevector size
-  arraylist *stage;    // Contain sequence applied computation steps
-} main_stage;
+struct stage main_stage;
 
 void _debug_show_state_data (void);
+static void checkpoints_trim (void);
+static void checkpoint_free (size_t step);
+static void checkpoints_invalidate_after (size_t step);
+static void apply_dense (FLA_Obj A, FLA_Obj x);
+
+/* Statevector index of the initial basis state; for the density backend, its
+ * diagonal entry of vec(rho) */
+static uint64_t initial_index (void)
+{
+  uint64_t s = main_stage.initial_state;
+
+  if (main_stage.config.backend == FQAM_BACKEND_DENSITY)
+    return s | s << main_stage.dim;
+  return s;
+}
 
 /*
 Arguments:
@@ -33,44 +48,158 @@ Arguments:
 */
 void FQAM_init (size_t dim, unsigned int initial_state)
 {
-  assertf (initial_state < pow (2, dim),
+  FQAM_init_config (dim, initial_state, FQAM_CONFIG_DEFAULT);
+}
+
+/*
+Arguments:
+    size_t dim: Dimension of Hilbert space
+    uint64_t initial_state: Nonnegative integer to initialize statevector to
+    FQAM_Config config: Initialization options, see FQAM_CONFIG_DEFAULT
+*/
+void FQAM_init_config (size_t dim, uint64_t initial_state, FQAM_Config config)
+{
+  bool mps = config.backend == FQAM_BACKEND_MPS;
+  bool stabilizer = config.backend == FQAM_BACKEND_STABILIZER;
+  bool sparse = config.backend == FQAM_BACKEND_SPARSE;
+  bool density = config.backend == FQAM_BACKEND_DENSITY;
+  bool single = config.precision == FQAM_PRECISION_SINGLE;
+
+  // Basis indices are 64-bit, the MPS and stabilizer backends index qubits instead
+  assertf (dim > 0 && (dim < 64 || mps || stabilizer),
+           "Error: At most 63 qubits are supported");
+  assertf (dim >= 64 || initial_state < (1ULL << dim),
            "Error: Initial state must be within hilbert space");
+  assertf (!density || dim < 32, "Error: Density matrices support at most 31 qubits");
+  assertf (!single || config.backend == FQAM_BACKEND_STATEVECTOR || stabilizer || sparse,
+           "Error: Single precision needs the statevector, stabilizer or sparse backend");
+  assertf (!sparse || config.sparse_density > 0.0,
+           "Error: Sparse density threshold must be positive");
 
   // Initialize Flame
   FLA_Init ();
 
-  // Initialize Statevector buffer
-  dcomplex *buf;
-  int state_space = pow (2, dim);
+  // Initialize Statevector buffer. The density backend keeps vec(rho) instead,
+  // the column major 2^n x 2^n density matrix as a statevector of 2n qubits
+  void *buf = NULL;
+  size_t state_space = dim < 64 ? 1ULL << dim : 0;
 
-  buf = (dcomplex *)calloc (sizeof (dcomplex), pow (2, dim));
-  assertf (buf, "Error: Failed to allocate statevector");
+  if (density)
+    state_space *= state_space;
 
-  buf[initial_state].real = 1.0;
-  buf[initial_state].imag = 0.0;
+  main_stage.state_space = state_space;
+  main_stage.amp_size = single ? sizeof (scomplex) : sizeof (dcomplex);
+  main_stage.state_mapped = false;
+  main_stage.config = config;
 
-  // Initialize Stage
-  FLA_Obj_create_without_buffer (FLA_DOUBLE_COMPLEX, state_space, 1,
-                                 &main_stage.statevector);
-  FLA_Obj_attach_buffer (buf, 1, state_space, &main_stage.statevector);
+  if (config.backend == FQAM_BACKEND_STATEVECTOR || density)
+    buf = stage_state_alloc ();
+
+  // Initialize Stage. Only statevector and density backends allocate one up front
+  FLA_Obj_create_without_buffer (single ? FLA_COMPLEX : FLA_DOUBLE_COMPLEX,
+                                 state_space, 1, &main_stage.statevector);
+  if (buf)
+    FLA_Obj_attach_buffer (buf, 1, state_space, &main_stage.statevector);
 
-  main_stage.state_space = state_space;
   main_stage.dim = dim;
   main_stage.stage = arraylist_create ();
+  main_stage.initial_state = initial_state;
+  main_stage.state_version = 0;
+
+  // Checkpoints are kept in memory, which mapped statevectors are meant to exceed
+  main_stage.computed_steps = 0;
+  main_stage.checkpoint_budget = config.state_dir ? 0 : FQAM_DEFAULT_CHECKPOINT_BUDGET;
+  main_stage.checkpoint_stride = 0;
+  main_stage.checkpoint_capacity = 0;
+  main_stage.checkpoints = NULL;
+  main_stage.base_step = 0;
+  main_stage.base_mapped = false;
   _FQAM_initialized = true;
 
-  FLA_Obj_buffer_at_view (main_stage.statevector);
+  if (buf)
+    kernel_amp_set (buf, initial_index (), (dcomplex){1.0, 0.0}, single);
+
+  if (mps)
+    mps_create ();
+  if (stabilizer)
+    stabilizer_create ();
+  if (sparse)
+    sparse_create ();
 
   // TODO: Add way to pass if built in operators should be initialized
   // pauli_ops_init_ ();
   printf ("FQAM: Initialized\n");
 }
 
-typedef int Local;
+/*
+Returns a zeroed buffer for the statevector. With config.state_dir set, the
+buffer maps an unlinked scratch file in that directory rather than memory, so
+registers larger than RAM page to fast storage (e.g. NVMe).
+
+Notes:
+ - The file is sized sparse, so untouched zero amplitudes cost no IO. It is
+   unlinked once mapped, releasing its storage when unmapped or on exit.
+ - Kernels sweep the statevector with a static schedule, each thread streaming
+   one or two contiguous runs per gate (see kernel_apply_local), so the mapping
+   is advised for sequential access: pages are read ahead in large chunks and
+   evicted soon after use. Huge pages are requested where the kernel supports
+   them for file mappings.
+*/
+void *stage_state_alloc (void)
+{
+  size_t bytes = main_stage.state_space * main_stage.amp_size;
+  const char *dir = main_stage.config.state_dir;
+
+  if (dir == NULL)
+  {
+    void *buf = calloc (main_stage.state_space, main_stage.amp_size);
+    assertf (buf, "Error: Failed to allocate statevector");
+    return buf;
+  }
+
+  size_t length = strlen (dir) + sizeof ("/fqam_state_XXXXXX");
+  char *path = malloc (length);
+  assertf (path, "Error: Failed to allocate statevector file name");
+  snprintf (path, length, "%s/fqam_state_XXXXXX", dir);
+
+  int fd = mkstemp (path);
+  assertf (fd >= 0, "Error: Failed to create statevector file in %s", dir);
+  unlink (path);
+  free (path);
+
+  assertf (ftruncate (fd, bytes) == 0,
+           "Error: Failed to size statevector file to %zu bytes", bytes);
+
+  void *buf = mmap (NULL, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  close (fd);
+  assertf (buf != MAP_FAILED, "Error: Failed to map statevector file");
+
+  // Hints only, failures are harmless
+  madvise (buf, bytes, MADV_SEQUENTIAL);
+#ifdef MADV_HUGEPAGE
+  madvise (buf, bytes, MADV_HUGEPAGE);
+#endif
+
+  main_stage.state_mapped = true;
+  return buf;
+}
+
+/* Releases the statevector buffer, if any */
+void stage_state_free (void)
+{
+  if (FLA_Obj_buffer_is_null (main_stage.statevector))
+    return;
+
+  void *buf = FLA_Obj_buffer_at_view (main_stage.statevector);
+
+  if (main_stage.state_mapped)
+    munmap (buf, main_stage.state_space * main_stage.amp_size);
+  else
+    free (buf);
 
-void FQAM_Part_as_lattice (Local neigh) {
-  //
-};
+  FLA_Obj_free_without_buffer (&main_stage.statevector);
+  main_stage.state_mapped = false;
+}
 
 /*
 Free resources in FQAM. Includes all FQAM modules.
@@ -79,14 +208,36 @@ void FQAM_finalize (void)
 {
   assertf (FQAM_initialized (), "Error: Tried to finalize uninitialized FQAM");
 
-  // Free all operator matrices
+  // Free all operator matrices and steps
   for (int idx = 0; idx < main_stage.stage->size; idx++)
   {
-    FQAM_Op *operator= arraylist_get (main_stage.stage, idx);
-    FQAM_Operator_free (operator->stack_addr);
+    stage_step *step = stage_get (idx);
+
+    // Rotation and channel steps own their operators
+    if (step->kind != STEP_PAULI && step->kind != STEP_CHANNEL)
+    {
+      FQAM_Operator_free (step->op);
+      for (int i = 0; i < step->num_gates; i++)
+        FQAM_Operator_free (step->gates[i].op);
+    }
+    stage_step_free (step);
   }
 
-  FLA_Set (FLA_ZERO, main_stage.statevector);
+  for (size_t s = 0; s < main_stage.checkpoint_capacity; s++)
+    checkpoint_free (s);
+  free (main_stage.checkpoints);
+  main_stage.checkpoints = NULL;
+  main_stage.checkpoint_capacity = 0;
+
+  if (main_stage.config.backend == FQAM_BACKEND_MPS)
+    mps_free ();
+  if (main_stage.config.backend == FQAM_BACKEND_STABILIZER)
+    stabilizer_free ();
+  if (main_stage.config.backend == FQAM_BACKEND_SPARSE)
+    sparse_free ();
+
+  measure_free ();
+  stage_state_free ();
   FLA_Finalize ();
   arraylist_destroy (main_stage.stage);
 
@@ -116,48 +267,765 @@ Arguments:
              fault is triggered.
 */
 void FQAM_stage_append (FQAM_Op operator)
+{
+  int targets[FQAM_MAX_TARGETS];
+
+  // Whole register operators keep the dense path, smaller ones act on the
+  // lowest qubits
+  if (operator.dimension == main_stage.dim)
+  {
+    FQAM_stage_append_on (operator, NULL, 0);
+    return;
+  }
+
+  assertf (operator.dimension <= FQAM_MAX_TARGETS,
+           "Error: Operator on %d qubits needs explicit targets", operator.dimension);
+
+  for (int j = 0; j < operator.dimension; j++)
+    targets[j] = j;
+
+  FQAM_stage_append_on (operator, targets, operator.dimension);
+}
+
+/* Validates operator applied to 'targets' */
+static void check_operator (FQAM_Op operator, const int *targets, int num_targets)
 {
   // Ensure operator has been initialized
+  assertf (FQAM_initialized (), "Error: Expected stage initialized");
   assertf (FQAM_Operator_initialized (operator.stack_addr),
            "Error: Tried appending uninitialized operator object");
   assertf (FLA_Obj_buffer_is_null (operator.mat_repr) == 0,
            "Error: Tried appending operator with null matrix representation");
+  assertf (num_targets <= FQAM_MAX_TARGETS,
+           "Error: Operator targets %d qubits, at most %d supported", num_targets,
+           FQAM_MAX_TARGETS);
 
-  arraylist_add (main_stage.stage, operator.stack_addr);
+  if (num_targets == 0)
+    assertf (operator.dimension == main_stage.dim,
+             "Error: Operator of %d qubits applied to %zu qubit register",
+             operator.dimension, main_stage.dim);
+  else
+    assertf (operator.dimension == num_targets,
+             "Error: Operator of %d qubits applied to %d targets",
+             operator.dimension, num_targets);
 
-  return FQAM_SUCCESS;
+  for (int j = 0; j < num_targets; j++)
+  {
+    assertf (targets[j] >= 0 && targets[j] < main_stage.dim,
+             "Error: Target qubit %d outside of register", targets[j]);
+    for (int k = 0; k < j; k++)
+      assertf (targets[j] != targets[k], "Error: Target qubit %d repeated",
+               targets[j]);
+  }
+}
+
+/* Validates operator and targets and returns a new step applying it */
+static stage_step *step_create (FQAM_Op operator, const int *targets, int num_targets)
+{
+  check_operator (operator, targets, num_targets);
+
+  stage_step *step = malloc (sizeof (stage_step));
+  assertf (step, "Error: Failed to allocate stage step");
+
+  step->kind = STEP_OPERATOR;
+  step->op = operator.stack_addr;
+  step->num_targets = num_targets;
+  for (int j = 0; j < num_targets; j++)
+    step->targets[j] = targets[j];
+
+  step->gates = NULL;
+  step->num_gates = 0;
+  step->sites = NULL;
+  step->num_sites = 0;
+  step->rotations = NULL;
+  step->num_rotations = 0;
+  step->num_kraus = 0;
+  step->owned = NULL;
+  step->num_owned = 0;
+
+  return step;
+}
+
+/* Frees step and the operators it owns, but not those passed by the user */
+void stage_step_free (stage_step *step)
+{
+  if (step->owned)
+  {
+    for (int i = 0; i < step->num_owned; i++)
+      FQAM_Operator_free (&step->owned[i]);
+    free (step->owned);
+  }
+
+  free (step->gates);
+  free (step->sites);
+  free (step->rotations);
+  free (step);
+}
+
+/* Returns number of local operators applied by step */
+int stage_step_size (stage_step *step)
+{
+  switch (step->kind)
+  {
+  case STEP_LAYER: return step->num_gates;
+  case STEP_REPEATED: return step->num_sites;
+  case STEP_PAULI: return step->num_rotations;
+  default: return 1;
+  }
+}
+
+/* Returns operator 'i' applied by step and sets its targets, in order of
+ * application. Zero targets denote the whole register */
+FQAM_Op *stage_step_gate (stage_step *step, int i, const int **targets,
+                          int *num_targets)
+{
+  switch (step->kind)
+  {
+  case STEP_CHANNEL:
+    assertf (false, "Error: Noise channels have no operator form");
+    // fallthrough
+  case STEP_PAULI:
+    assertf (step->num_gates == step->num_rotations,
+             "Error: Pauli rotations on over %d qubits have no operator form",
+             FQAM_MAX_TARGETS);
+    // fallthrough
+  case STEP_LAYER:
+    *targets = step->gates[i].targets;
+    *num_targets = step->gates[i].num_targets;
+    return step->gates[i].op;
+
+  case STEP_REPEATED:
+    *targets = step->sites + i * step->num_targets;
+    *num_targets = step->num_targets;
+    return step->op;
+
+  default:
+    *targets = step->targets;
+    *num_targets = step->num_targets;
+    return step->op;
+  }
+}
+
+/*
+Appends operator acting on qubits 'targets' to stage. Qubit q is bit q of a
+basis state index, and target j is acted on by bit j of the operator's index.
+
+Arguments:
+    operator: Operator object of 'num_targets' qubits. Must be initialized.
+    targets: Distinct target qubits
+    num_targets: Number of targets, zero for an operator spanning the register
+*/
+void FQAM_stage_append_on (FQAM_Op operator, const int *targets, int num_targets)
+{
+  arraylist_add (main_stage.stage, step_create (operator, targets, num_targets));
+}
+
+/*
+Appends a layer of operators on pairwise disjoint targets to stage. The layer is
+a single step, applied by one sweep over the statevector where possible.
+
+Arguments:
+    operators: Operators of the layer, operator i acts on 'num_targets[i]' qubits
+    targets: Targets of every operator, concatenated in order
+    num_targets: Number of targets of each operator, at least one
+    num_operators: Number of operators, at least one
+*/
+void FQAM_stage_append_layer (const FQAM_Op *operators, const int *targets,
+                              const int *num_targets, int num_operators)
+{
+  assertf (num_operators > 0, "Error: Expected nonempty layer");
+
+  stage_step *step = malloc (sizeof (stage_step));
+  stage_gate *gates = malloc (num_operators * sizeof (stage_gate));
+  bool *touched = calloc (main_stage.dim, sizeof (bool)); // Registers may exceed 64 qubits
+
+  assertf (step && gates && touched, "Error: Failed to allocate stage step");
+
+  for (int i = 0; i < num_operators; i++)
+  {
+    assertf (num_targets[i] > 0, "Error: Layer operators need explicit targets");
+    check_operator (operators[i], targets, num_targets[i]);
+
+    gates[i].op = operators[i].stack_addr;
+    gates[i].num_targets = num_targets[i];
+    for (int j = 0; j < num_targets[i]; j++)
+    {
+      assertf (!touched[targets[j]], "Error: Layer operators overlap on qubit %d",
+               targets[j]);
+      touched[targets[j]] = true;
+      gates[i].targets[j] = targets[j];
+    }
+
+    targets += num_targets[i];
+  }
+  free (touched);
+
+  step->kind = STEP_LAYER;
+  step->op = gates[0].op;
+  step->num_targets = gates[0].num_targets;
+  for (int j = 0; j < step->num_targets; j++)
+    step->targets[j] = gates[0].targets[j];
+  step->gates = gates;
+  step->num_gates = num_operators;
+  step->sites = NULL;
+  step->num_sites = 0;
+  step->rotations = NULL;
+  step->num_rotations = 0;
+  step->num_kraus = 0;
+  step->owned = NULL;
+  step->num_owned = 0;
+
+  arraylist_add (main_stage.stage, step);
+}
+
+/*
+Appends 'operator' applied at each of 'num_sites' sites to stage, as a single
+step storing the operator once, e.g. a translation invariant layer.
+
+Arguments:
+    operator: Local operator, on at most FQAM_MAX_TARGETS qubits
+    sites: Targets of application s at sites[s * dimension], applied in order.
+           Applications may overlap.
+    num_sites: Number of applications, at least one
+*/
+void FQAM_stage_append_repeated (FQAM_Op operator, const int *sites, int num_sites)
+{
+  int k = operator.dimension;
+
+  assertf (num_sites > 0, "Error: Expected at least one site");
+  for (int s = 0; s < num_sites; s++)
+    check_operator (operator, sites + s * k, k);
+
+  stage_step *step = step_create (operator, sites, k);
+
+  step->kind = STEP_REPEATED;
+  step->sites = malloc (num_sites * k * sizeof (int));
+  assertf (step->sites, "Error: Failed to allocate stage step");
+  memcpy (step->sites, sites, num_sites * k * sizeof (int));
+  step->num_sites = num_sites;
+
+  arraylist_add (main_stage.stage, step);
+}
+
+/* Returns staged step at 'idx' */
+stage_step *stage_get (size_t idx)
+{
+  return arraylist_get (main_stage.stage, idx);
 }
 
 bool FQAM_initialized (void) { return _FQAM_initialized; }
 
+/*
+Replaces the operator at stage index 'idx'. Cached checkpoints past 'idx' are
+dropped, so the next computation resumes from the nearest checkpoint at or
+before 'idx'.
+
+Arguments:
+    idx: Index of staged operator to replace. Must be within the stage.
+    operator: Operator object. Must be initialized.
+*/
+void FQAM_stage_replace (size_t idx, FQAM_Op operator)
+{
+  assertf (FQAM_initialized (), "Error: Expected stage initialized");
+  assertf (idx < main_stage.stage->size,
+           "Error: Stage index %zu out of range", idx);
+  assertf (idx >= main_stage.base_step,
+           "Error: Stage index %zu precedes last measurement", idx);
+  // Replacement acts on the same targets
+  stage_step *step = stage_get (idx);
+  assertf (step->kind == STEP_OPERATOR, "Error: Only operator steps can be replaced");
+  stage_step *replacement = step_create (operator, step->targets, step->num_targets);
+
+  stage_step_free (step);
+  arraylist_set (main_stage.stage, idx, replacement);
+  checkpoints_invalidate_after (idx);
+}
+
+/* Removes the last staged operator */
+void FQAM_stage_pop (void)
+{
+  assertf (FQAM_initialized (), "Error: Expected stage initialized");
+  assertf (main_stage.stage->size > main_stage.base_step,
+           "Error: Tried popping empty stage or past last measurement");
+
+  stage_step_free (arraylist_pop (main_stage.stage));
+  checkpoints_invalidate_after (main_stage.stage->size);
+}
+
+/*
+Sets the memory budget in bytes for cached statevector checkpoints. When the
+stage depth fits, every step is cached; otherwise checkpoints are kept roughly
+every sqrt(depth) steps, widened further until they fit within budget. A budget
+of zero disables checkpointing.
+*/
+void FQAM_stage_set_checkpoint_budget (size_t bytes)
+{
+  assertf (FQAM_initialized (), "Error: Expected stage initialized");
+
+  main_stage.checkpoint_budget = bytes;
+  checkpoints_trim ();
+}
+
 /* Applys operator to state vector */
 void apply_operator (FLA_Obj A)
 {
-  FLA_Obj x, y_tmp;
-  x = main_stage.statevector;
+  apply_dense (A, main_stage.statevector);
+}
+
+/* Stores single precision copy of double complex operator A into new object 'As' */
+static void operator_to_single (FLA_Obj A, FLA_Obj *As)
+{
+  dim_t m = FLA_Obj_length (A), n = FLA_Obj_width (A);
+  const dcomplex *a = FLA_Obj_buffer_at_view (A);
+  dim_t rs = FLA_Obj_row_stride (A), cs = FLA_Obj_col_stride (A);
+
+  FLA_Obj_create (FLA_COMPLEX, m, n, 0, 0, As);
+
+  scomplex *s = FLA_Obj_buffer_at_view (*As);
+  dim_t s_cs = FLA_Obj_col_stride (*As);
+
+  for (dim_t c = 0; c < n; c++)
+    for (dim_t r = 0; r < m; r++)
+      s[r + c * s_cs] = (scomplex){a[r * rs + c * cs].real, a[r * rs + c * cs].imag};
+}
+
+/* Applys whole register operator A to 'x' in place */
+static void apply_dense (FLA_Obj A, FLA_Obj x)
+{
+  FLA_Obj y_tmp, As;
+  bool single = kernel_is_single (x);
+
+  // Operators are double complex, single precision states take a converted copy
+  if (single)
+  {
+    operator_to_single (A, &As);
+    A = As;
+  }
+
   FLA_Obj_create_conf_to (FLA_NO_TRANSPOSE, x, &y_tmp); // Temp
 
   /* y = A * x */
+  profile_scope scope = profile_begin ("gemv", NULL, -1);
   FLA_Gemv (FLA_NO_TRANSPOSE, FLA_ONE, A, x, FLA_ZERO, y_tmp);
+  profile_end (scope);
 
   // Copy y_tmp back to x
   FLA_Copy (y_tmp, x);
 
   // Free the temporary object
   FLA_Obj_free (&y_tmp);
+  if (single)
+    FLA_Obj_free (&As);
 }
 
-void FQAM_compute_outcomes (void)
+/* Applies commuting Pauli rotations, sorted by x_mask, to 'state' in place with
+ * one sweep per distinct mask */
+void stage_apply_rotations (FLA_Obj state, const FQAM_Pauli_term *rotations,
+                            int num_rotations)
 {
-  assertf (FQAM_initialized (), "Error: Computing in uninitialized stage\n");
+  for (int begin = 0, end; begin < num_rotations; begin = end)
+  {
+    end = begin + 1;
+    while (end < num_rotations && rotations[end].x_mask == rotations[begin].x_mask)
+      end++;
 
-  for (int idx = 0; idx < main_stage.stage->size; idx++)
+    kernel_pauli_rotations (state, rotations + begin, end - begin);
+  }
+}
+
+/* Applies staged step to 'state' in place */
+void stage_apply_step (stage_step *step, FLA_Obj state)
+{
+  if (main_stage.config.backend == FQAM_BACKEND_DENSITY)
+  {
+    density_apply_step (step, state);
+    return;
+  }
+
+  switch (step->kind)
+  {
+  case STEP_OPERATOR:
+    if (step->num_targets == 0)
+      apply_dense (step->op->mat_repr, state);
+    else
+      kernel_apply_local (state, step->op->mat_repr, step->targets,
+                          step->num_targets);
+    break;
+
+  case STEP_LAYER:
+  {
+    kernel_gate_t *gates = malloc (step->num_gates * sizeof (kernel_gate_t));
+    assertf (gates, "Error: Failed to allocate layer");
+
+    for (int i = 0; i < step->num_gates; i++)
+    {
+      gates[i].U = step->gates[i].op->mat_repr;
+      gates[i].targets = step->gates[i].targets;
+      gates[i].num_targets = step->gates[i].num_targets;
+    }
+
+    kernel_apply_layer (state, gates, step->num_gates);
+    free (gates);
+    break;
+  }
+
+  case STEP_REPEATED:
+    kernel_apply_repeated (state, step->op->mat_repr, step->sites, step->num_sites,
+                           step->num_targets);
+    break;
+
+  case STEP_PAULI:
+    stage_apply_rotations (state, step->rotations, step->num_rotations);
+    break;
+
+  case STEP_CHANNEL:
+    assertf (false,
+             "Error: Noise channels need the density matrix backend or trajectories");
+  }
+}
+
+/* Returns true if 'step' only applies local operators, so that it may share
+ * cache blocked sweeps with neighbouring steps */
+static bool step_fusable (stage_step *step)
+{
+  if (main_stage.config.backend == FQAM_BACKEND_DENSITY)
+    return false;
+
+  switch (step->kind)
+  {
+  case STEP_LAYER:
+  case STEP_REPEATED: return true;
+  case STEP_OPERATOR: return step->num_targets > 0;
+  default: return false;
+  }
+}
+
+/* Returns the end of the run of fusable steps starting at 'begin', stopping at
+ * 'step' and at checkpointed steps */
+static size_t fused_end (size_t begin, size_t step)
+{
+  size_t end = begin + 1, stride = main_stage.checkpoint_stride;
+
+  if (!step_fusable (stage_get (begin)))
+    return end;
+
+  while (end < step && !(stride && end % stride == 0) && step_fusable (stage_get (end)))
+    end++;
+
+  return end;
+}
+
+/*
+Applies fusable steps [begin, end) to 'state' as one sequence of local operators.
+Consecutive operators on low qubits are applied tile by tile in a single sweep
+(see kernel_apply_sequence), so a run of such steps costs one pass over the
+statevector instead of one per step.
+*/
+static void apply_fused (size_t begin, size_t end, FLA_Obj state)
+{
+  int num_gates = 0, g = 0;
+
+  for (size_t s = begin; s < end; s++)
+    num_gates += stage_step_size (stage_get (s));
+
+  kernel_gate_t *gates = malloc (num_gates * sizeof (kernel_gate_t));
+  assertf (gates, "Error: Failed to allocate gates");
+
+  for (size_t s = begin; s < end; s++)
+  {
+    stage_step *step = stage_get (s);
+
+    for (int i = 0; i < stage_step_size (step); i++, g++)
+      gates[g].U = stage_step_gate (step, i, &gates[g].targets,
+                                    &gates[g].num_targets)->mat_repr;
+  }
+
+  kernel_apply_sequence (state, gates, num_gates);
+  free (gates);
+}
+
+/* Returns the checkpoint stride for a stage of 'depth' steps, or zero when no
+ * checkpoint fits in the budget or there is no statevector to checkpoint */
+static size_t checkpoint_stride (size_t depth)
+{
+  size_t state_bytes, slots, stride;
+
+  // Registers of 64 or more qubits have no basis indexed statevector
+  state_bytes = main_stage.state_space * main_stage.amp_size;
+  if (state_bytes == 0 || FLA_Obj_buffer_is_null (main_stage.statevector))
+    return 0;
+
+  slots = main_stage.checkpoint_budget / state_bytes;
+
+  if (slots == 0)
+    return 0;
+  if (depth <= slots)
+    return 1;
+
+  stride = (size_t)ceil (sqrt ((double)depth));
+  while (depth / stride > slots)
+    stride++;
+
+  return stride;
+}
+
+/* Releases checkpoint at 'step', if any, including the base checkpoint */
+static void checkpoint_free (size_t step)
+{
+  if (step >= main_stage.checkpoint_capacity || !main_stage.checkpoints[step])
+    return;
+
+  if (step == main_stage.base_step && main_stage.base_mapped)
+    munmap (main_stage.checkpoints[step], main_stage.state_space * main_stage.amp_size);
+  else
+    free (main_stage.checkpoints[step]);
+
+  main_stage.checkpoints[step] = NULL;
+}
+
+/* Frees checkpoint at 'step' if one is cached. The base checkpoint may be the
+ * only copy of a collapsed state and is never dropped */
+static void checkpoint_drop (size_t step)
+{
+  if (step == main_stage.base_step)
+    return;
+
+  if (step < main_stage.checkpoint_capacity && main_stage.checkpoints[step])
   {
-    FQAM_Op *operator= arraylist_get (main_stage.stage, idx);
-    apply_operator (operator->mat_repr);
+    free (main_stage.checkpoints[step]);
+    main_stage.checkpoints[step] = NULL;
   }
 }
 
+/* Frees every checkpoint past 'step' and marks statevector stale if it was
+ * computed past 'step' */
+static void checkpoints_invalidate_after (size_t step)
+{
+  for (size_t s = step + 1; s < main_stage.checkpoint_capacity; s++)
+    checkpoint_drop (s);
+
+  if (main_stage.computed_steps != SIZE_MAX && main_stage.computed_steps > step)
+    main_stage.computed_steps = SIZE_MAX;
+  if (main_stage.mps.computed_steps != SIZE_MAX && main_stage.mps.computed_steps > step)
+    main_stage.mps.computed_steps = SIZE_MAX;
+  if (main_stage.stabilizer.computed_steps != SIZE_MAX &&
+      main_stage.stabilizer.computed_steps > step)
+    main_stage.stabilizer.computed_steps = SIZE_MAX;
+  if (main_stage.sparse.computed_steps != SIZE_MAX &&
+      main_stage.sparse.computed_steps > step)
+    main_stage.sparse.computed_steps = SIZE_MAX;
+}
+
+/* Recomputes the checkpoint stride for the current depth and frees checkpoints
+ * which no longer land on it */
+static void checkpoints_trim (void)
+{
+  size_t stride = checkpoint_stride (main_stage.stage->size);
+
+  if (stride == main_stage.checkpoint_stride)
+    return;
+
+  for (size_t s = 1; s < main_stage.checkpoint_capacity; s++)
+    if (stride == 0 || s % stride != 0)
+      checkpoint_drop (s);
+
+  main_stage.checkpoint_stride = stride;
+}
+
+/* Grows checkpoint table to hold 'step' */
+static void checkpoint_reserve (size_t step)
+{
+  if (step >= main_stage.checkpoint_capacity)
+  {
+    size_t capacity = main_stage.checkpoint_capacity ? main_stage.checkpoint_capacity : 8;
+    while (capacity <= step)
+      capacity *= 2;
+
+    main_stage.checkpoints =
+        realloc (main_stage.checkpoints, capacity * sizeof (void *));
+    assertf (main_stage.checkpoints, "Error: Failed to allocate checkpoint table");
+
+    memset (main_stage.checkpoints + main_stage.checkpoint_capacity, 0,
+            (capacity - main_stage.checkpoint_capacity) * sizeof (void *));
+    main_stage.checkpoint_capacity = capacity;
+  }
+}
+
+/* Caches current statevector as the checkpoint for 'step' */
+static void checkpoint_store (size_t step)
+{
+  size_t stride = main_stage.checkpoint_stride;
+
+  if (step == 0 || stride == 0 || step % stride != 0)
+    return;
+
+  checkpoint_reserve (step);
+  if (main_stage.checkpoints[step])
+    return;
+
+  size_t bytes = main_stage.state_space * main_stage.amp_size;
+  void *copy = malloc (bytes);
+
+  // Out of memory is not fatal; the step is simply recomputed when needed
+  if (copy == NULL)
+    return;
+
+  profile_scope scope = profile_begin ("checkpoint_store", NULL, step);
+  memcpy (copy, FLA_Obj_buffer_at_view (main_stage.statevector), bytes);
+  main_stage.checkpoints[step] = copy;
+  profile_end (scope);
+}
+
+/* Loads the state after 'step' steps from its checkpoint. Unless collapsed by a
+ * measurement, step 0 is regenerated from the initial basis state rather than
+ * cached */
+static void checkpoint_restore (size_t step)
+{
+  void *buf = FLA_Obj_buffer_at_view (main_stage.statevector);
+  size_t bytes = main_stage.state_space * main_stage.amp_size;
+  profile_scope scope = profile_begin ("checkpoint_restore", NULL, step);
+
+  if (step < main_stage.checkpoint_capacity && main_stage.checkpoints[step])
+    memcpy (buf, main_stage.checkpoints[step], bytes);
+  else
+  {
+    memset (buf, 0, bytes);
+    kernel_amp_set (buf, initial_index (), (dcomplex){1.0, 0.0},
+                    kernel_is_single (main_stage.statevector));
+  }
+
+  main_stage.computed_steps = step;
+  main_stage.state_version++;
+  profile_end (scope);
+}
+
+/* Returns the nearest step at or before 'step' with a cached checkpoint */
+static size_t checkpoint_nearest (size_t step)
+{
+  size_t s = min (step, main_stage.checkpoint_capacity ? main_stage.checkpoint_capacity - 1 : 0);
+
+  for (; s > main_stage.base_step; s--)
+    if (main_stage.checkpoints[s])
+      return s;
+
+  return main_stage.base_step;
+}
+
+/*
+Brings the statevector to the state after the first 'step' staged operators.
+Resumes from the current statevector when it is at or before 'step', jumping
+ahead to a closer checkpoint when one exists. Otherwise restarts from the
+nearest checkpoint at or before 'step'.
+*/
+void stage_seek (size_t step)
+{
+  assertf (step <= main_stage.stage->size,
+           "Error: Seek to step %zu past stage depth %u", step,
+           main_stage.stage->size);
+  assertf (step >= main_stage.base_step,
+           "Error: Seek to step %zu precedes last measurement", step);
+  assertf (!FLA_Obj_buffer_is_null (main_stage.statevector),
+           "Error: Backend keeps no statevector");
+
+  checkpoints_trim ();
+
+  size_t nearest = checkpoint_nearest (step);
+  size_t computed = main_stage.computed_steps;
+
+  if (computed == SIZE_MAX || computed > step || (computed < nearest))
+    checkpoint_restore (nearest);
+
+  // Out-of-core statevectors apply the whole range chunk by chunk
+  if (chunks_active () && main_stage.computed_steps < step)
+  {
+    profile_scope scope = profile_begin ("apply_chunks", NULL, main_stage.computed_steps);
+    chunks_apply (main_stage.computed_steps, step);
+    profile_end (scope);
+
+    main_stage.computed_steps = step;
+    main_stage.state_version++;
+    checkpoint_store (step);
+  }
+
+  while (main_stage.computed_steps < step)
+  {
+    size_t begin = main_stage.computed_steps, end = fused_end (begin, step);
+
+    // Fused runs are one scope, named after their first operator. Rotations
+    // with wide support keep no operator
+    stage_step *first = stage_get (begin);
+    profile_scope scope = profile_begin (end - begin > 1 ? "apply_fused" : "apply",
+                                         first->op ? first->op->name : "rotations",
+                                         begin);
+
+    if (end - begin > 1)
+      apply_fused (begin, end, main_stage.statevector);
+    else
+      stage_apply_step (stage_get (begin), main_stage.statevector);
+    profile_end (scope);
+
+    main_stage.computed_steps = end;
+    main_stage.state_version++;
+    checkpoint_store (end);
+  }
+}
+
+/*
+Makes the current statevector the earliest reachable state of the stage. Called
+after the statevector is modified outside of staged operators (e.g. measurement
+collapse): every checkpoint is dropped and the current state is kept as the
+base checkpoint, which later recomputations resume from.
+*/
+void stage_rebase (void)
+{
+  size_t bytes = main_stage.state_space * main_stage.amp_size;
+  void *base = malloc (bytes);
+
+  assertf (base, "Error: Failed to allocate base checkpoint");
+  memcpy (base, FLA_Obj_buffer_at_view (main_stage.statevector), bytes);
+
+  stage_rebase_onto (base, false);
+}
+
+/* Rebases the stage as stage_rebase, taking 'base', a copy of the current
+ * statevector, as the base checkpoint. 'base' is malloc'd, or a read only
+ * mapping of the statevector's size when 'mapped' (see FQAM_Snapshot.c) */
+void stage_rebase_onto (void *base, bool mapped)
+{
+  size_t step = main_stage.computed_steps;
+
+  assertf (step != SIZE_MAX, "Error: Rebasing stale statevector");
+
+  for (size_t s = 0; s < main_stage.checkpoint_capacity; s++)
+    checkpoint_free (s);
+
+  checkpoint_reserve (step);
+  main_stage.checkpoints[step] = base;
+  main_stage.base_step = step;
+  main_stage.base_mapped = mapped;
+  main_stage.state_version++;
+}
+
+/* Brings statevector up to date with the stage. Only operators appended or
+ * edited since the last computation are (re)applied */
+void FQAM_compute_outcomes (void)
+{
+  assertf (FQAM_initialized (), "Error: Computing in uninitialized stage\n");
+
+  profile_scope scope = profile_begin ("compute_outcomes", NULL, -1);
+
+  if (main_stage.config.backend == FQAM_BACKEND_MPS)
+    mps_seek (main_stage.stage->size);
+  else if (main_stage.config.backend == FQAM_BACKEND_STABILIZER)
+    stabilizer_seek (main_stage.stage->size);
+  else if (main_stage.config.backend == FQAM_BACKEND_SPARSE)
+    sparse_seek (main_stage.stage->size);
+  else
+    stage_seek (main_stage.stage->size);
+
+  profile_end (scope);
+}
+
 /*
 Debug function which prints the stage list
 */
@@ -171,8 +1039,18 @@ void _debug_FQAM_show_stage (void)
   {
     printf ("Index: %d\n", idx);
 
-    FQAM_Op *op = arraylist_get (main_stage.stage, idx);
-    FQAM_Operator_show (op);
+    stage_step *step = stage_get (idx);
+    if (step->kind == STEP_LAYER)
+      printf ("Layer of %d operators, first shown\n", step->num_gates);
+    if (step->kind == STEP_REPEATED)
+      printf ("Repeated at %d sites, first shown\n", step->num_sites);
+    if (step->kind == STEP_PAULI)
+      printf ("Pauli rotations: %d\n", step->num_rotations);
+    if (!step->op)
+      continue;
+    for (int j = 0; j < step->num_targets; j++)
+      printf ("Target %d: %d\n", j, step->targets[j]);
+    FQAM_Operator_show (step->op);
   }
 
   printf ("----Debug: Done stage----\n");
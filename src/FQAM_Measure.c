@@ -0,0 +1,348 @@
+/*
+    Copyright (C) 2024, Chuck Garcia
+
+    This file is part of libfqam and is available under the 3-Clause
+    BSD license, which can be found in the LICENSE file at the top-level
+    directory, or at http://opensource.org/licenses/BSD-3-Clause
+*/
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "FQAM.h"
+#include "__FQAM_Stage.h"
+#include "__kernels.h"
+#include "assertf.h"
+
+/* Shots drawn per PRNG stream. Fixing the block size, rather than deriving it
+ * from the thread count, keeps samples reproducible across machines */
+#define SAMPLE_BLOCK 4096
+
+/* Largest qubit subset measured at once; bounds the marginal buffer */
+#define MEASURE_MAX_QUBITS 24
+
+/* Walker/Vose alias table over the outcome distribution of the statevector */
+static struct
+{
+  double *prob;          // Acceptance probability of each column
+  uint64_t *alias;       // Fallback outcome of each column
+  size_t size;           // Number of columns (statevector size)
+  unsigned long version; // Statevector version table was built from
+  bool valid;
+} alias_table;
+
+/* Allocates alias table for 'size' outcomes, reusing the current buffers when
+ * they are large enough */
+static void alias_reserve (size_t size)
+{
+  if (alias_table.prob && alias_table.size == size)
+    return;
+
+  free (alias_table.prob);
+  free (alias_table.alias);
+
+  alias_table.prob = malloc (size * sizeof (double));
+  alias_table.alias = malloc (size * sizeof (uint64_t));
+  assertf (alias_table.prob && alias_table.alias,
+           "Error: Failed to allocate alias table");
+
+  alias_table.size = size;
+}
+
+/* Frees the alias table. State versions restart with each session, so a table
+ * kept across FQAM_finalize could match a new state's version */
+void measure_free (void)
+{
+  free (alias_table.prob);
+  free (alias_table.alias);
+  alias_table.prob = NULL;
+  alias_table.alias = NULL;
+  alias_table.size = 0;
+  alias_table.valid = false;
+}
+
+/*
+Builds the alias table from the current statevector in O(N). Probabilities are
+computed in one parallel sweep and rescaled by their sum so accumulated rounding
+in the statevector does not bias the table. For the density backend they are the
+diagonal of rho.
+*/
+static void alias_build (void)
+{
+  const void *state = FLA_Obj_buffer_at_view (main_stage.statevector);
+  bool single = kernel_is_single (main_stage.statevector);
+  bool density = main_stage.config.backend == FQAM_BACKEND_DENSITY;
+  size_t N = density ? (size_t)1 << main_stage.dim : main_stage.state_space;
+  size_t stride = density ? N + 1 : 1;
+  double total = 0.0;
+
+  alias_reserve (N);
+  double *q = alias_table.prob;
+  uint64_t *alias = alias_table.alias;
+
+#pragma omp parallel for reduction(+ : total) schedule(static)
+  for (size_t i = 0; i < N; i++)
+  {
+    const dcomplex a = kernel_amp_get (state, i * stride, single);
+    q[i] = density ? a.real : a.real * a.real + a.imag * a.imag;
+    total += q[i];
+  }
+
+  assertf (total > 0.0, "Error: Cannot sample from zero statevector");
+
+  // Worklist holds small columns growing from the front, large from the back
+  uint64_t *work = malloc (N * sizeof (uint64_t));
+  assertf (work, "Error: Failed to allocate alias worklist");
+
+  size_t n_small = 0, n_large = 0;
+  double scale = (double)N / total;
+
+  for (size_t i = 0; i < N; i++)
+  {
+    q[i] *= scale;
+    if (q[i] < 1.0)
+      work[n_small++] = i;
+    else
+      work[N - 1 - n_large++] = i;
+  }
+
+  while (n_small > 0 && n_large > 0)
+  {
+    uint64_t s = work[--n_small];
+    uint64_t l = work[N - n_large];
+
+    alias[s] = l;
+    q[l] -= 1.0 - q[s];
+
+    if (q[l] < 1.0)
+    {
+      n_large--;
+      work[n_small++] = l;
+    }
+  }
+
+  // Remaining columns are full up to rounding
+  while (n_large > 0)
+  {
+    uint64_t l = work[N - n_large--];
+    q[l] = 1.0;
+    alias[l] = l;
+  }
+  while (n_small > 0)
+  {
+    uint64_t s = work[--n_small];
+    q[s] = 1.0;
+    alias[s] = s;
+  }
+
+  free (work);
+
+  alias_table.version = main_stage.state_version;
+  alias_table.valid = true;
+}
+
+/*
+Draws 'shots' measurement outcomes of all qubits from the final statevector,
+storing basis state indices into 'outcomes'.
+
+The statevector is first brought up to date with the stage. An alias table is
+built once per statevector and reused across calls, after which each shot costs
+O(1). Shots are drawn in parallel, block 'b' of SAMPLE_BLOCK shots using PRNG
+stream 'b' under 'seed', so results depend only on 'seed'.
+
+Outcomes hold one bit per qubit, so at most 64 qubits are sampled. Statevector
+and density matrix backends are further limited to 32 qubits by the alias table.
+
+Arguments:
+    shots: Number of samples to draw
+    seed: PRNG seed
+    outcomes: Buffer of at least 'shots' elements
+*/
+void FQAM_sample (size_t shots, uint64_t seed, unsigned long *outcomes)
+{
+  assertf (FQAM_initialized (), "Error: Expected stage initialized");
+  assertf (main_stage.config.backend != FQAM_BACKEND_MPS,
+           "Error: Sampling is not supported on the MPS backend");
+  assertf (main_stage.dim <= 64, "Error: Sampling supports at most 64 qubits");
+
+  FQAM_compute_outcomes ();
+
+  if (stabilizer_active ())
+  {
+    stabilizer_sample (shots, seed, outcomes);
+    return;
+  }
+
+  if (sparse_active ())
+  {
+    sparse_sample (shots, seed, outcomes);
+    return;
+  }
+
+  // Columns are drawn from 32 random bits
+  assertf (main_stage.dim <= 32,
+           "Error: Sampling a statevector supports at most 32 qubits");
+
+  if (!alias_table.valid || alias_table.version != main_stage.state_version)
+    alias_build ();
+
+  const double *prob = alias_table.prob;
+  const uint64_t *alias = alias_table.alias;
+  const uint64_t N = alias_table.size;
+  size_t blocks = (shots + SAMPLE_BLOCK - 1) / SAMPLE_BLOCK;
+
+#pragma omp parallel for schedule(static)
+  for (size_t b = 0; b < blocks; b++)
+  {
+    FQAM_Rng rng;
+    size_t begin = b * SAMPLE_BLOCK;
+    size_t end = min (begin + SAMPLE_BLOCK, shots);
+
+    FQAM_Rng_init (&rng, seed, b);
+
+    for (size_t shot = begin; shot < end; shot++)
+    {
+      // Column from high word by multiply-shift, coin flip from low bits
+      uint64_t r = FQAM_Rng_u64 (&rng);
+      uint64_t column = ((r >> 32) * N) >> 32;
+      double coin = (r & 0xFFFFFFFFu) * 0x1.0p-32;
+
+      outcomes[shot] = coin < prob[column] ? column : alias[column];
+    }
+  }
+}
+
+/*
+Computes the marginal distribution of the qubit subset 'qubits' of the final
+statevector in one parallel pass, without copying the statevector.
+
+Arguments:
+    qubits: Qubits to keep. Bit j of an outcome is the value of qubits[j]
+    num_qubits: Number of qubits to keep
+    probs: Buffer of 2^num_qubits elements
+*/
+void FQAM_marginal (const int *qubits, int num_qubits, double *probs)
+{
+  assertf (FQAM_initialized (), "Error: Expected stage initialized");
+  assertf (main_stage.config.backend != FQAM_BACKEND_MPS,
+           "Error: Marginals are not supported on the MPS backend, see "
+           "FQAM_mps_window_probabilities");
+
+  FQAM_compute_outcomes ();
+
+  if (stabilizer_active ())
+    stabilizer_marginal (qubits, num_qubits, probs);
+  else if (sparse_active ())
+    sparse_marginal (qubits, num_qubits, probs);
+  else if (main_stage.config.backend == FQAM_BACKEND_DENSITY)
+    density_marginal (qubits, num_qubits, probs);
+  else
+    kernel_marginal_probabilities (main_stage.statevector, qubits, num_qubits, probs);
+}
+
+/* Projects the final state onto 'outcome' of probability 'p' and makes it the
+ * base step of the stage */
+static void collapse_onto (const int *qubits, int num_qubits, unsigned long outcome,
+                           double p)
+{
+  if (stabilizer_active ())
+    stabilizer_collapse (qubits, num_qubits, outcome);
+  else if (sparse_active ())
+    sparse_collapse (qubits, num_qubits, outcome, p);
+  else if (main_stage.config.backend == FQAM_BACKEND_DENSITY)
+  {
+    // P rho P / p: rows and columns of 'qubits' both project onto 'outcome'
+    int both[2 * MEASURE_MAX_QUBITS];
+
+    for (int j = 0; j < num_qubits; j++)
+    {
+      both[j] = qubits[j];
+      both[num_qubits + j] = qubits[j] + main_stage.dim;
+    }
+
+    kernel_collapse (main_stage.statevector, both, 2 * num_qubits,
+                     outcome | outcome << num_qubits, 1.0 / p);
+    stage_rebase ();
+  }
+  else
+  {
+    kernel_collapse (main_stage.statevector, qubits, num_qubits, outcome,
+                     1.0 / sqrt (p));
+    stage_rebase ();
+  }
+}
+
+/*
+Projects the final statevector in place onto the outcome 'outcome' of qubits
+'qubits' and renormalizes it. Operators staged afterwards act on the collapsed
+state, and staged operators before this point can no longer be edited.
+
+Returns:
+    Probability of 'outcome' before the collapse
+*/
+double FQAM_collapse (const int *qubits, int num_qubits, unsigned long outcome)
+{
+  assertf (FQAM_initialized (), "Error: Expected stage initialized");
+  assertf (main_stage.config.backend != FQAM_BACKEND_MPS,
+           "Error: Collapse is not supported on the MPS backend");
+  assertf (num_qubits <= MEASURE_MAX_QUBITS,
+           "Error: Collapse supports at most %d qubits", MEASURE_MAX_QUBITS);
+  assertf (outcome < (1UL << num_qubits), "Error: Outcome out of range");
+
+  double p, *probs = malloc ((1UL << num_qubits) * sizeof (double));
+  assertf (probs, "Error: Failed to allocate marginal buffer");
+
+  FQAM_marginal (qubits, num_qubits, probs);
+  p = probs[outcome];
+  free (probs);
+
+  assertf (p > 0.0, "Error: Collapse onto zero probability outcome");
+
+  collapse_onto (qubits, num_qubits, outcome, p);
+  return p;
+}
+
+/*
+Measures qubits 'qubits' of the final statevector, collapsing it onto the drawn
+outcome (see FQAM_collapse).
+
+Returns:
+    Measured outcome, bit j being the value of qubits[j]
+*/
+unsigned long FQAM_measure (const int *qubits, int num_qubits, FQAM_Rng *rng)
+{
+  assertf (FQAM_initialized (), "Error: Expected stage initialized");
+  assertf (main_stage.config.backend != FQAM_BACKEND_MPS,
+           "Error: Measurement is not supported on the MPS backend");
+  assertf (num_qubits <= MEASURE_MAX_QUBITS,
+           "Error: Measurement supports at most %d qubits", MEASURE_MAX_QUBITS);
+
+  double *probs = malloc ((1UL << num_qubits) * sizeof (double));
+  unsigned long outcome, last = 0;
+  double u, p, total = 0.0;
+
+  assertf (probs, "Error: Failed to allocate marginal buffer");
+  FQAM_marginal (qubits, num_qubits, probs);
+
+  for (outcome = 0; outcome < (1UL << num_qubits); outcome++)
+    total += probs[outcome];
+
+  // Inverse CDF, skipping zero probability outcomes at the boundary
+  u = FQAM_Rng_uniform (rng) * total;
+  for (outcome = 0; outcome < (1UL << num_qubits); outcome++)
+  {
+    if (probs[outcome] == 0.0)
+      continue;
+
+    last = outcome;
+    if (u < probs[outcome])
+      break;
+    u -= probs[outcome];
+  }
+
+  p = probs[last];
+  free (probs);
+
+  collapse_onto (qubits, num_qubits, last, p);
+  return last;
+}
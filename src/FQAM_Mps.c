@@ -0,0 +1,527 @@
+/*
+    Copyright (C) 2024, Chuck Garcia
+
+    This file is part of libfqam and is available under the 3-Clause
+    BSD license, which can be found in the LICENSE file at the top-level
+    directory, or at http://opensource.org/licenses/BSD-3-Clause
+*/
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "FQAM.h"
+#include "__FQAM_Stage.h"
+#include "__kernels.h"
+#include "arraylist.h"
+#include "assertf.h"
+
+/* Operators are applied to the window of sites spanning their targets when it
+ * holds at most this many sites besides the targets. Otherwise targets are
+ * first swapped next to each other */
+#define MPS_MAX_SPECTATORS 2
+
+/* Largest window of contracted sites */
+#define MPS_MAX_WINDOW 14
+
+/* Wraps column major buffer with leading dimension 'ld' as an m x n FLA_Obj.
+ * Release with FLA_Obj_free_without_buffer */
+static FLA_Obj wrap (dcomplex *buf, dim_t m, dim_t n, dim_t ld)
+{
+  FLA_Obj A;
+
+  FLA_Obj_create_without_buffer (FLA_DOUBLE_COMPLEX, m, n, &A);
+  FLA_Obj_attach_buffer (buf, 1, ld, &A);
+  return A;
+}
+
+/* Resets MPS to the initial product state (bond dimension one) */
+static void mps_reset (void)
+{
+  for (size_t q = 0; q < main_stage.dim; q++)
+  {
+    int bit = q < 64 ? (main_stage.initial_state >> q) & 1 : 0;
+
+    free (main_stage.mps.tensors[q]);
+    main_stage.mps.tensors[q] = calloc (2, sizeof (dcomplex));
+    assertf (main_stage.mps.tensors[q], "Error: Failed to allocate MPS");
+
+    main_stage.mps.tensors[q][bit].real = 1.0;
+    main_stage.mps.bond[q] = 1;
+  }
+
+  main_stage.mps.bond[main_stage.dim] = 1;
+  main_stage.mps.computed_steps = 0;
+  main_stage.mps.truncation_error = 0.0;
+}
+
+/* Allocates MPS of main stage in its initial state */
+void mps_create (void)
+{
+  size_t n = main_stage.dim;
+
+  assertf (main_stage.config.mps_max_bond > 0, "Error: Expected positive bond dimension");
+
+  main_stage.mps.tensors = calloc (n, sizeof (dcomplex *));
+  main_stage.mps.bond = malloc ((n + 1) * sizeof (size_t));
+  assertf (main_stage.mps.tensors && main_stage.mps.bond,
+           "Error: Failed to allocate MPS");
+
+  // SWAP |ab> -> |ba>
+  FLA_Obj_create (FLA_DOUBLE_COMPLEX, 4, 4, 0, 0, &main_stage.mps.swap);
+  FLA_Set (FLA_ZERO, main_stage.mps.swap);
+  dcomplex *swap = FLA_Obj_buffer_at_view (main_stage.mps.swap);
+  dim_t cs = FLA_Obj_col_stride (main_stage.mps.swap);
+  swap[0 + 0 * cs].real = 1.0;
+  swap[2 + 1 * cs].real = 1.0;
+  swap[1 + 2 * cs].real = 1.0;
+  swap[3 + 3 * cs].real = 1.0;
+
+  mps_reset ();
+}
+
+void mps_free (void)
+{
+  for (size_t q = 0; q < main_stage.dim; q++)
+    free (main_stage.mps.tensors[q]);
+
+  free (main_stage.mps.tensors);
+  free (main_stage.mps.bond);
+  FLA_Obj_free (&main_stage.mps.swap);
+  memset (&main_stage.mps, 0, sizeof (stage_mps));
+}
+
+/* Contracts sites [lo, lo + w) into theta[l + bond[lo] * (S + 2^w * r)], where
+ * bit j of S is the state of site lo + j. Returns theta */
+static dcomplex *window_contract (size_t lo, int w)
+{
+  size_t rows = 2 * main_stage.mps.bond[lo];
+  dcomplex *theta = malloc (rows * main_stage.mps.bond[lo + 1] * sizeof (dcomplex));
+
+  assertf (theta, "Error: Failed to allocate MPS window");
+  memcpy (theta, main_stage.mps.tensors[lo],
+          rows * main_stage.mps.bond[lo + 1] * sizeof (dcomplex));
+
+  // (rows x bond) * (bond x 2 bond') is read as (2 rows x bond')
+  for (int j = 1; j < w; j++)
+  {
+    size_t q = lo + j;
+    dcomplex *next = malloc (rows * 2 * main_stage.mps.bond[q + 1] * sizeof (dcomplex));
+    assertf (next, "Error: Failed to allocate MPS window");
+
+    FLA_Obj T = wrap (theta, rows, main_stage.mps.bond[q], rows);
+    FLA_Obj A = wrap (main_stage.mps.tensors[q], main_stage.mps.bond[q],
+                      2 * main_stage.mps.bond[q + 1], main_stage.mps.bond[q]);
+    FLA_Obj C = wrap (next, rows, 2 * main_stage.mps.bond[q + 1], rows);
+
+    FLA_Gemm (FLA_NO_TRANSPOSE, FLA_NO_TRANSPOSE, FLA_ONE, T, A, FLA_ZERO, C);
+
+    FLA_Obj_free_without_buffer (&T);
+    FLA_Obj_free_without_buffer (&A);
+    FLA_Obj_free_without_buffer (&C);
+    free (theta);
+
+    theta = next;
+    rows *= 2;
+  }
+
+  return theta;
+}
+
+/* Applies U to the sites 'targets' (relative to lo) of window theta */
+static void window_apply (dcomplex *theta, size_t lo, int w, FLA_Obj U,
+                          const int *targets, int k)
+{
+  size_t L = main_stage.mps.bond[lo], R = main_stage.mps.bond[lo + w], S = 1ULL << w;
+  dcomplex *psi = malloc (L * S * R * sizeof (dcomplex));
+
+  assertf (psi, "Error: Failed to allocate MPS window");
+
+  // Site bits lowest, so the window reads as a batch of statevectors
+  for (size_t r = 0; r < R; r++)
+    for (size_t s = 0; s < S; s++)
+      for (size_t l = 0; l < L; l++)
+        psi[s + S * (l + L * r)] = theta[l + L * (s + S * r)];
+
+  FLA_Obj state = wrap (psi, L * S * R, 1, L * S * R);
+  kernel_apply_local (state, U, targets, k);
+  FLA_Obj_free_without_buffer (&state);
+
+  for (size_t r = 0; r < R; r++)
+    for (size_t s = 0; s < S; s++)
+      for (size_t l = 0; l < L; l++)
+        theta[l + L * (s + S * r)] = psi[s + S * (l + L * r)];
+
+  free (psi);
+}
+
+/* Splits window theta back into sites [lo, lo + w) by successive SVDs,
+ * truncating every bond. Frees theta */
+static void window_split (dcomplex *theta, size_t lo, int w)
+{
+  size_t a = main_stage.mps.bond[lo], R = main_stage.mps.bond[lo + w];
+
+  for (int j = 0; j < w - 1; j++)
+  {
+    size_t q = lo + j;
+    size_t m = 2 * a, n = (1ULL << (w - 1 - j)) * R, kk = min (m, n);
+    FLA_Obj M, s, U, V;
+
+    M = wrap (theta, m, n, m);
+    FLA_Obj_create (FLA_DOUBLE, kk, 1, 0, 0, &s);
+    FLA_Obj_create (FLA_DOUBLE_COMPLEX, m, kk, 0, 0, &U);
+    FLA_Obj_create (FLA_DOUBLE_COMPLEX, n, kk, 0, 0, &V);
+
+    // M = U diag(s) V^H, singular values in decreasing order
+    FLA_Svd (FLA_SVD_VECTORS_MIN_COPY, FLA_SVD_VECTORS_MIN_COPY, M, s, U, V);
+    FLA_Obj_free_without_buffer (&M);
+
+    const double *sv = FLA_Obj_buffer_at_view (s);
+    const dcomplex *ub = FLA_Obj_buffer_at_view (U);
+    const dcomplex *vb = FLA_Obj_buffer_at_view (V);
+    dim_t u_cs = FLA_Obj_col_stride (U), v_cs = FLA_Obj_col_stride (V);
+    double total = 0.0, kept = 0.0;
+    size_t chi = 0;
+
+    for (size_t i = 0; i < kk; i++)
+      total += sv[i] * sv[i];
+    while (chi < kk && chi < main_stage.config.mps_max_bond &&
+           (chi == 0 || sv[chi] > main_stage.config.mps_cutoff * sv[0]))
+    {
+      kept += sv[chi] * sv[chi];
+      chi++;
+    }
+
+    double scale = kept > 0.0 ? sqrt (total / kept) : 1.0;
+    main_stage.mps.truncation_error += total > 0.0 ? (total - kept) / total : 0.0;
+
+    // Site q: first chi left singular vectors
+    free (main_stage.mps.tensors[q]);
+    main_stage.mps.tensors[q] = malloc (m * chi * sizeof (dcomplex));
+    assertf (main_stage.mps.tensors[q], "Error: Failed to allocate MPS");
+    for (size_t c = 0; c < chi; c++)
+      memcpy (main_stage.mps.tensors[q] + c * m, ub + c * u_cs, m * sizeof (dcomplex));
+
+    // Remainder diag(s) V^H, rescaled to keep the norm
+    dcomplex *rest = malloc (chi * n * sizeof (dcomplex));
+    assertf (rest, "Error: Failed to allocate MPS window");
+    for (size_t c = 0; c < n; c++)
+      for (size_t i = 0; i < chi; i++)
+      {
+        const dcomplex v = vb[c + i * v_cs];
+        rest[i + chi * c].real = scale * sv[i] * v.real;
+        rest[i + chi * c].imag = -scale * sv[i] * v.imag;
+      }
+
+    FLA_Obj_free (&s);
+    FLA_Obj_free (&U);
+    FLA_Obj_free (&V);
+    free (theta);
+
+    theta = rest;
+    main_stage.mps.bond[q + 1] = chi;
+    a = chi;
+  }
+
+  free (main_stage.mps.tensors[lo + w - 1]);
+  main_stage.mps.tensors[lo + w - 1] = theta;
+}
+
+/* Applies U to contiguous sites [lo, lo + w), targets relative to lo */
+static void mps_apply_window (FLA_Obj U, size_t lo, int w, const int *targets, int k)
+{
+  assertf (w <= MPS_MAX_WINDOW, "Error: MPS window of %d sites exceeds %d", w,
+           MPS_MAX_WINDOW);
+
+  dcomplex *theta = window_contract (lo, w);
+  window_apply (theta, lo, w, U, targets, k);
+  window_split (theta, lo, w);
+}
+
+/* Swaps sites q and q + 1 */
+static void mps_swap (size_t q)
+{
+  int targets[2] = {0, 1};
+  mps_apply_window (main_stage.mps.swap, q, 2, targets, 2);
+}
+
+/* Applies operator U to sites 'targets' */
+static void mps_apply (FLA_Obj U, const int *targets, int k)
+{
+  int lo = targets[0], hi = targets[0];
+  int local[FQAM_MAX_TARGETS];
+
+  for (int j = 1; j < k; j++)
+  {
+    lo = min (lo, targets[j]);
+    hi = max (hi, targets[j]);
+  }
+
+  if (hi - lo + 1 <= k + MPS_MAX_SPECTATORS)
+  {
+    for (int j = 0; j < k; j++)
+      local[j] = targets[j] - lo;
+    mps_apply_window (U, lo, hi - lo + 1, local, k);
+    return;
+  }
+
+  // Route: swap targets next to the lowest one, apply, then swap back
+  int position[FQAM_MAX_TARGETS], order[FQAM_MAX_TARGETS];
+  size_t *swaps = malloc ((size_t)k * (hi - lo) * sizeof (size_t));
+  size_t num_swaps = 0;
+
+  assertf (swaps, "Error: Failed to allocate MPS routing");
+
+  for (int j = 0; j < k; j++)
+  {
+    int pos = j;
+    while (pos > 0 && targets[order[pos - 1]] > targets[j])
+    {
+      order[pos] = order[pos - 1];
+      pos--;
+    }
+    order[pos] = j;
+  }
+
+  for (int i = 0; i < k; i++)
+  {
+    position[order[i]] = targets[order[i]];
+    while (i > 0 && position[order[i]] > position[order[i - 1]] + 1)
+    {
+      swaps[num_swaps++] = --position[order[i]];
+      mps_swap (position[order[i]]);
+    }
+    local[order[i]] = position[order[i]] - lo;
+  }
+
+  mps_apply_window (U, lo, k, local, k);
+
+  while (num_swaps > 0)
+    mps_swap (swaps[--num_swaps]);
+  free (swaps);
+}
+
+/* Brings MPS to the state after 'step' staged steps */
+void mps_seek (size_t step)
+{
+  assertf (main_stage.config.backend == FQAM_BACKEND_MPS,
+           "Error: Expected MPS backend");
+  assertf (step <= main_stage.stage->size, "Error: Seek to step %zu past stage", step);
+
+  if (main_stage.mps.computed_steps > step)
+    mps_reset ();
+
+  while (main_stage.mps.computed_steps < step)
+  {
+    stage_step *s = stage_get (main_stage.mps.computed_steps);
+
+    for (int i = 0; i < stage_step_size (s); i++)
+    {
+      const int *targets;
+      int num_targets, all[FQAM_MAX_TARGETS];
+      FQAM_Op *op = stage_step_gate (s, i, &targets, &num_targets);
+
+      // Whole register operators act on every site in order
+      if (num_targets == 0)
+      {
+        assertf (main_stage.dim <= FQAM_MAX_TARGETS,
+                 "Error: MPS needs targeted operators on chains over %d sites",
+                 FQAM_MAX_TARGETS);
+        for (size_t q = 0; q < main_stage.dim; q++)
+          all[q] = q;
+        targets = all;
+        num_targets = main_stage.dim;
+      }
+
+      mps_apply (op->mat_repr, targets, num_targets);
+    }
+
+    main_stage.mps.computed_steps++;
+  }
+}
+
+/* Multiplies row vector v (1 x bond[q]) by A[:, s, :] of site q, into 'out' */
+static void site_multiply (const dcomplex *v, size_t q, int s, dcomplex *out)
+{
+  size_t L = main_stage.mps.bond[q], R = main_stage.mps.bond[q + 1];
+  const dcomplex *A = main_stage.mps.tensors[q];
+
+  for (size_t r = 0; r < R; r++)
+  {
+    double re = 0.0, im = 0.0;
+    for (size_t l = 0; l < L; l++)
+    {
+      const dcomplex a = A[l + L * (s + 2 * r)];
+      re += v[l].real * a.real - v[l].imag * a.imag;
+      im += v[l].real * a.imag + v[l].imag * a.real;
+    }
+    out[r].real = re;
+    out[r].imag = im;
+  }
+}
+
+/*
+Returns amplitude of the basis state with site q in state bits[q] (0 or 1), after
+all staged steps.
+*/
+dcomplex FQAM_mps_amplitude (const unsigned char *bits)
+{
+  assertf (FQAM_initialized (), "Error: Expected stage initialized");
+  mps_seek (main_stage.stage->size);
+
+  size_t width = 1;
+  for (size_t q = 0; q <= main_stage.dim; q++)
+    width = max (width, main_stage.mps.bond[q]);
+
+  dcomplex *buf = calloc (2 * width, sizeof (dcomplex));
+  dcomplex *v = buf, *w = buf + width, result;
+
+  assertf (buf, "Error: Failed to allocate MPS contraction");
+  v[0].real = 1.0;
+
+  for (size_t q = 0; q < main_stage.dim; q++)
+  {
+    dcomplex *t;
+
+    site_multiply (v, q, bits[q] & 1, w);
+    t = v;
+    v = w;
+    w = t;
+  }
+
+  result = v[0];
+  free (buf);
+  return result;
+}
+
+/* E := sum over s in 'states' of A_s^H E A_s (left) or A_s E A_s^H (right) for
+ * site q, where A_s is the bond[q] x bond[q + 1] slice of site state s */
+static void environment_update (dcomplex **E, size_t q, int first_state, int num_states,
+                                bool left)
+{
+  size_t L = main_stage.mps.bond[q], R = main_stage.mps.bond[q + 1];
+  size_t in = left ? L : R, out = left ? R : L;
+  dcomplex *next = calloc (out * out, sizeof (dcomplex));
+  dcomplex *work = malloc (L * R * sizeof (dcomplex));
+
+  assertf (next && work, "Error: Failed to allocate MPS environment");
+
+  FLA_Obj En = wrap (*E, in, in, in);
+  FLA_Obj N = wrap (next, out, out, out);
+  FLA_Obj X = left ? wrap (work, L, R, L) : wrap (work, R, L, R);
+
+  for (int s = first_state; s < first_state + num_states; s++)
+  {
+    FLA_Obj A = wrap (main_stage.mps.tensors[q] + L * s, L, R, 2 * L);
+
+    if (left)
+    {
+      FLA_Gemm (FLA_NO_TRANSPOSE, FLA_NO_TRANSPOSE, FLA_ONE, En, A, FLA_ZERO, X);
+      FLA_Gemm (FLA_CONJ_TRANSPOSE, FLA_NO_TRANSPOSE, FLA_ONE, A, X, FLA_ONE, N);
+    }
+    else
+    {
+      FLA_Gemm (FLA_NO_TRANSPOSE, FLA_CONJ_TRANSPOSE, FLA_ONE, En, A, FLA_ZERO, X);
+      FLA_Gemm (FLA_NO_TRANSPOSE, FLA_NO_TRANSPOSE, FLA_ONE, A, X, FLA_ONE, N);
+    }
+
+    FLA_Obj_free_without_buffer (&A);
+  }
+
+  FLA_Obj_free_without_buffer (&En);
+  FLA_Obj_free_without_buffer (&N);
+  FLA_Obj_free_without_buffer (&X);
+  free (work);
+  free (*E);
+  *E = next;
+}
+
+/* Accumulates probabilities of window states, see FQAM_mps_window_probabilities */
+static void window_probabilities (const dcomplex *E, const dcomplex *R, size_t q,
+                                  int first, int width, uint64_t prefix, double *probs)
+{
+  size_t bond = main_stage.mps.bond[q];
+
+  if ((int)(q - first) == width)
+  {
+    // Tr (E R)
+    double p = 0.0;
+    for (size_t a = 0; a < bond; a++)
+      for (size_t b = 0; b < bond; b++)
+        p += E[a + bond * b].real * R[b + bond * a].real -
+             E[a + bond * b].imag * R[b + bond * a].imag;
+    probs[prefix] = p;
+    return;
+  }
+
+  for (int s = 0; s < 2; s++)
+  {
+    dcomplex *next = malloc (bond * bond * sizeof (dcomplex));
+    assertf (next, "Error: Failed to allocate MPS environment");
+    memcpy (next, E, bond * bond * sizeof (dcomplex));
+
+    environment_update (&next, q, s, 1, true);
+    window_probabilities (next, R, q + 1, first, width,
+                          prefix | ((uint64_t)s << (q - first)), probs);
+    free (next);
+  }
+}
+
+/* Computes probabilities of window states for the current MPS, see
+ * FQAM_mps_window_probabilities */
+void mps_window_probabilities (int first, int width, double *probs)
+{
+  assertf (first >= 0 && width > 0 && first + width <= (int)main_stage.dim,
+           "Error: Window outside of chain");
+  assertf (width <= MPS_MAX_WINDOW, "Error: Window of %d sites exceeds %d", width,
+           MPS_MAX_WINDOW);
+
+  dcomplex *E = calloc (1, sizeof (dcomplex));
+  dcomplex *R = calloc (1, sizeof (dcomplex));
+  assertf (E && R, "Error: Failed to allocate MPS environment");
+  E[0].real = 1.0;
+  R[0].real = 1.0;
+
+  for (int q = 0; q < first; q++)
+    environment_update (&E, q, 0, 2, true);
+  for (int q = main_stage.dim - 1; q >= first + width; q--)
+    environment_update (&R, q, 0, 2, false);
+
+  window_probabilities (E, R, first, first, width, 0, probs);
+
+  free (E);
+  free (R);
+}
+
+/*
+Computes the probabilities of the 2^width states of sites [first, first + width)
+after all staged steps, with bit j of an index giving site first + j.
+
+Notes:
+  - Sites outside of the window are traced out by contracting left and right
+    environments, so the cost is linear in the chain length.
+*/
+void FQAM_mps_window_probabilities (int first, int width, double *probs)
+{
+  assertf (FQAM_initialized (), "Error: Expected stage initialized");
+
+  mps_seek (main_stage.stage->size);
+  mps_window_probabilities (first, width, probs);
+}
+
+/* Returns weight discarded by truncations since the last reset of the MPS */
+double FQAM_mps_truncation_error (void)
+{
+  mps_seek (main_stage.stage->size);
+  return main_stage.mps.truncation_error;
+}
+
+/* Returns largest bond dimension of the MPS after all staged steps */
+size_t FQAM_mps_max_bond (void)
+{
+  size_t bond = 1;
+
+  mps_seek (main_stage.stage->size);
+  for (size_t q = 0; q <= main_stage.dim; q++)
+    bond = max (bond, main_stage.mps.bond[q]);
+  return bond;
+}
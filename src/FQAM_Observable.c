@@ -0,0 +1,165 @@
+/*
+    Copyright (C) 2024, Chuck Garcia
+
+    This file is part of libfqam and is available under the 3-Clause
+    BSD license, which can be found in the LICENSE file at the top-level
+    directory, or at http://opensource.org/licenses/BSD-3-Clause
+*/
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "FQAM.h"
+#include "__FQAM_Stage.h"
+#include "__kernels.h"
+#include "assertf.h"
+
+/* Initializes empty Pauli sum */
+void FQAM_Pauli_sum_create (FQAM_Pauli_sum *H)
+{
+  H->terms = NULL;
+  H->size = 0;
+  H->capacity = 0;
+  H->grouped = true;
+}
+
+/* Frees terms of Pauli sum. Idempotent */
+void FQAM_Pauli_sum_free (FQAM_Pauli_sum *H)
+{
+  free (H->terms);
+  FQAM_Pauli_sum_create (H);
+}
+
+/*
+Adds term coeff * X^x Z^z (up to the Y phase, see FQAM_Pauli_term) to 'H'.
+*/
+void FQAM_Pauli_sum_add_masks (FQAM_Pauli_sum *H, double coeff, uint64_t x_mask,
+                               uint64_t z_mask)
+{
+  if (H->size == H->capacity)
+  {
+    H->capacity = H->capacity ? 2 * H->capacity : 16;
+    H->terms = realloc (H->terms, H->capacity * sizeof (FQAM_Pauli_term));
+    assertf (H->terms, "Error: Failed to allocate Pauli sum");
+  }
+
+  H->terms[H->size++] = (FQAM_Pauli_term){coeff, x_mask, z_mask};
+  H->grouped = false;
+}
+
+/*
+Adds Pauli string term to 'H'.
+
+Arguments:
+    coeff: Real weight of term
+    pauli: String over 'I', 'X', 'Y', 'Z' where character k acts on qubit k,
+           e.g. "ZZI" is Z on qubits 0 and 1.
+*/
+void FQAM_Pauli_sum_add (FQAM_Pauli_sum *H, double coeff, const char *pauli)
+{
+  uint64_t x_mask = 0, z_mask = 0;
+  size_t length = strlen (pauli);
+
+  assertf (length <= 64, "Error: Pauli strings support at most 64 qubits");
+
+  for (size_t q = 0; q < length; q++)
+  {
+    switch (pauli[q])
+    {
+    case 'I': case 'i': break;
+    case 'X': case 'x': x_mask |= 1ULL << q; break;
+    case 'Z': case 'z': z_mask |= 1ULL << q; break;
+    case 'Y': case 'y':
+      x_mask |= 1ULL << q;
+      z_mask |= 1ULL << q;
+      break;
+    default:
+      assertf (false, "Error: Unexpected Pauli character '%c'", pauli[q]);
+    }
+  }
+
+  FQAM_Pauli_sum_add_masks (H, coeff, x_mask, z_mask);
+}
+
+static int compare_x_mask (const void *a, const void *b)
+{
+  uint64_t x = ((const FQAM_Pauli_term *)a)->x_mask;
+  uint64_t y = ((const FQAM_Pauli_term *)b)->x_mask;
+  return (x > y) - (x < y);
+}
+
+/* Sorts the terms of 'H' so terms sharing x_mask are adjacent */
+void pauli_sum_group (FQAM_Pauli_sum *H)
+{
+  if (!H->grouped)
+  {
+    qsort (H->terms, H->size, sizeof (FQAM_Pauli_term), compare_x_mask);
+    H->grouped = true;
+  }
+}
+
+/* Returns <psi|H|psi> for statevector 'state', one sweep per group of grouped 'H' */
+double pauli_sum_expectation (FLA_Obj state, const FQAM_Pauli_sum *H)
+{
+  double total = 0.0;
+
+  assertf (H->grouped, "Error: Expected grouped Pauli sum");
+
+  for (size_t begin = 0, end; begin < H->size; begin = end)
+  {
+    double group;
+
+    end = begin + 1;
+    while (end < H->size && H->terms[end].x_mask == H->terms[begin].x_mask)
+      end++;
+
+    kernel_pauli_expectation (state, H->terms + begin, end - begin, &group);
+    total += group;
+  }
+
+  return total;
+}
+
+/*
+Returns <psi|H|psi> for the final statevector.
+
+Terms are grouped by the qubits they flip (x_mask), reordering 'H' in place, and
+each group is evaluated in a single sweep over the statevector. Hamiltonians of
+thousands of terms over a few distinct flip patterns (e.g. all-diagonal plus a
+transverse field) therefore cost a handful of sweeps.
+*/
+double FQAM_expectation (FQAM_Pauli_sum *H)
+{
+  assertf (FQAM_initialized (), "Error: Expected stage initialized");
+  assertf (main_stage.config.backend != FQAM_BACKEND_MPS,
+           "Error: Expectation values are not supported on the MPS backend");
+
+  double total = 0.0;
+
+  FQAM_compute_outcomes ();
+
+  // Clifford stages on the stabilizer backend: each term is 0 or +-1
+  if (stabilizer_active ())
+  {
+    for (size_t t = 0; t < H->size; t++)
+      total += H->terms[t].coeff * stabilizer_expectation (&H->terms[t]);
+    return total;
+  }
+
+  if (sparse_active ())
+  {
+    for (size_t t = 0; t < H->size; t++)
+      total += H->terms[t].coeff * sparse_expectation (&H->terms[t]);
+    return total;
+  }
+
+  if (main_stage.config.backend == FQAM_BACKEND_DENSITY)
+  {
+    for (size_t t = 0; t < H->size; t++)
+      total += H->terms[t].coeff * density_expectation (&H->terms[t]);
+    return total;
+  }
+
+  pauli_sum_group (H);
+  return pauli_sum_expectation (main_stage.statevector, H);
+}
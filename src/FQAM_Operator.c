@@ -7,6 +7,7 @@
 */
 
 #include "FQAM.h"
+#include "__FQAM_Stage.h"
 #include "assertf.h"
 #include "stdbool.h"
 
@@ -23,9 +24,11 @@ FQAM_Error FQAM_Op_create (FQAM_Op *operator, char * name, int dim)
   strcpy (operator->name, name);
   operator->initialized = true;
   operator->stack_addr = operator;
-  
+  operator->dimension = dim;
+
   FLA_Obj_create (FLA_DOUBLE_COMPLEX, pow (2, dim), pow (2, dim), 0, 0,
                   &operator->mat_repr);
+  FLA_Set (FLA_ZERO, operator->mat_repr); // Terms are accumulated by FQAM_Op_add
 
   return FQAM_SUCCESS;
 }
@@ -105,6 +108,7 @@ void FQAM_Op_add (dcomplex alpha, FQAM_Op term, FQAM_Op *result)
 
   // Get matrix representations of basis states
   FLA_Obj ket0_mat, ket1_mat, alpha_obj;
+  profile_scope scope = profile_begin ("op_add", result->name, -1);
 
   // Generate FLA matrices
   gen_basis_matrix (term.outer_ket0, &ket0_mat);
@@ -116,6 +120,7 @@ void FQAM_Op_add (dcomplex alpha, FQAM_Op term, FQAM_Op *result)
   /* A =  alpha * x * y' + A */
   FLA_Gerc (FLA_NO_CONJUGATE, FLA_CONJUGATE, alpha_obj, ket0_mat, ket1_mat,
             result->mat_repr);
+  profile_end (scope);
 }
 
 void FQAM_Op_tensor_prod (FQAM_Op A, FQAM_Op B, FQAM_Op C)
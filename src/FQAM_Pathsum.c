@@ -0,0 +1,541 @@
+/*
+    Copyright (C) 2024, Chuck Garcia
+
+    This file is part of libfqam and is available under the 3-Clause
+    BSD license, which can be found in the LICENSE file at the top-level
+    directory, or at http://opensource.org/licenses/BSD-3-Clause
+*/
+
+#include <stdlib.h>
+
+#include "FQAM.h"
+#include "__FQAM_Stage.h"
+#include "arraylist.h"
+#include "assertf.h"
+
+/* Operator entries below this magnitude start no paths */
+#define PATHSUM_ZERO_TOL 1e-15
+
+/* Path prefixes expanded breadth first before the parallel depth first sweep */
+#define PATHSUM_FRONTIER 4096
+
+/* Staged step in compressed sparse column form over its targets */
+typedef struct
+{
+  int num_targets;
+  int targets[FQAM_MAX_TARGETS];
+  uint64_t mask;      // Target qubits
+  uint32_t *col_ptr;  // Entries of local column c: [col_ptr[c], col_ptr[c + 1])
+  uint64_t *row_bits; // Local row index of entry, deposited onto 'mask'
+  dcomplex *val;      // Value of entry
+  double max_abs;     // Largest magnitude over all entries
+} pathsum_step;
+
+/* Compiled stage. Layers and repeated operators compile to one step per
+ * operator applied */
+typedef struct
+{
+  size_t depth;
+  size_t num_stages;   // Staged steps compiled
+  size_t *stage_begin; // stage_begin[s]: first compiled step of staged step s
+  pathsum_step *steps;
+  uint64_t *fixed; // fixed[d]: qubits no step from d onwards acts on
+  double *bound;   // bound[d]: largest path probability gain over steps d onwards
+} pathsum_program;
+
+/* Path prefix: basis state after 'depth' steps and its summed amplitude */
+typedef struct
+{
+  uint64_t state;
+  dcomplex amp;
+} pathsum_prefix;
+
+/* Compiles operator 'op' on 'targets' (zero for the whole register) */
+static void compile_step (FQAM_Op *op, const int *targets, int num_targets,
+                          pathsum_step *out)
+{
+  FLA_Obj U = op->mat_repr;
+  const dcomplex *buf = FLA_Obj_buffer_at_view (U);
+  dim_t rs = FLA_Obj_row_stride (U);
+  dim_t cs = FLA_Obj_col_stride (U);
+
+  // Whole register steps act on every qubit in order
+  out->num_targets = num_targets;
+  if (num_targets == 0)
+  {
+    assertf (main_stage.dim <= FQAM_MAX_TARGETS,
+             "Error: Path sums need targeted operators on registers over %d qubits",
+             FQAM_MAX_TARGETS);
+    out->num_targets = main_stage.dim;
+  }
+
+  int k = out->num_targets;
+  uint32_t size = 1U << k, nnz = 0;
+
+  out->mask = 0;
+  for (int j = 0; j < k; j++)
+  {
+    out->targets[j] = num_targets ? targets[j] : j;
+    out->mask |= 1ULL << out->targets[j];
+  }
+
+  out->col_ptr = malloc ((size + 1) * sizeof (uint32_t));
+  out->row_bits = malloc ((size_t)size * size * sizeof (uint64_t));
+  out->val = malloc ((size_t)size * size * sizeof (dcomplex));
+  assertf (out->col_ptr && out->row_bits && out->val,
+           "Error: Failed to allocate path sum step");
+
+  out->max_abs = 0.0;
+  for (uint32_t c = 0; c < size; c++)
+  {
+    out->col_ptr[c] = nnz;
+    for (uint32_t r = 0; r < size; r++)
+    {
+      dcomplex v = buf[r * rs + c * cs];
+      double abs = sqrt (v.real * v.real + v.imag * v.imag);
+
+      if (abs <= PATHSUM_ZERO_TOL)
+        continue;
+
+      out->row_bits[nnz] = 0;
+      for (int j = 0; j < k; j++)
+        if ((r >> j) & 1)
+          out->row_bits[nnz] |= 1ULL << out->targets[j];
+
+      out->val[nnz++] = v;
+      out->max_abs = max (out->max_abs, abs);
+    }
+  }
+  out->col_ptr[size] = nnz;
+}
+
+/* Compiles every staged step into 'prog' */
+static void program_compile (pathsum_program *prog)
+{
+  size_t num_stages = main_stage.stage->size, depth = 0;
+  uint64_t touched = 0;
+
+  prog->num_stages = num_stages;
+  prog->stage_begin = malloc ((num_stages + 1) * sizeof (size_t));
+  assertf (prog->stage_begin, "Error: Failed to allocate path sum program");
+
+  for (size_t s = 0; s < num_stages; s++)
+  {
+    prog->stage_begin[s] = depth;
+    depth += stage_step_size (stage_get (s));
+  }
+  prog->stage_begin[num_stages] = depth;
+
+  prog->depth = depth;
+  prog->steps = malloc ((depth + 1) * sizeof (pathsum_step));
+  prog->fixed = malloc ((depth + 1) * sizeof (uint64_t));
+  prog->bound = malloc ((depth + 1) * sizeof (double));
+  assertf (prog->steps && prog->fixed && prog->bound,
+           "Error: Failed to allocate path sum program");
+
+  for (size_t s = 0; s < num_stages; s++)
+  {
+    stage_step *step = stage_get (s);
+    pathsum_step *out = &prog->steps[prog->stage_begin[s]];
+
+    for (int i = 0; i < stage_step_size (step); i++)
+    {
+      const int *targets;
+      int num_targets;
+      FQAM_Op *op = stage_step_gate (step, i, &targets, &num_targets);
+
+      compile_step (op, targets, num_targets, &out[i]);
+    }
+  }
+
+  // Light cone: qubits untouched by the remaining steps must already match
+  prog->fixed[depth] = ~0ULL;
+  prog->bound[depth] = 1.0;
+  for (size_t d = depth; d-- > 0;)
+  {
+    touched |= prog->steps[d].mask;
+    prog->fixed[d] = ~touched;
+    prog->bound[d] = prog->bound[d + 1] * prog->steps[d].max_abs * prog->steps[d].max_abs;
+  }
+}
+
+static void program_free (pathsum_program *prog)
+{
+  for (size_t d = 0; d < prog->depth; d++)
+  {
+    free (prog->steps[d].col_ptr);
+    free (prog->steps[d].row_bits);
+    free (prog->steps[d].val);
+  }
+
+  free (prog->steps);
+  free (prog->stage_begin);
+  free (prog->fixed);
+  free (prog->bound);
+}
+
+/* Local column index of 'state' over the targets of 'step' */
+static inline uint32_t local_index (const pathsum_step *step, uint64_t state)
+{
+  uint32_t c = 0;
+  for (int j = 0; j < step->num_targets; j++)
+    c |= ((state >> step->targets[j]) & 1) << j;
+  return c;
+}
+
+/* Sums amplitudes of all paths from 'state' after 'd' steps to 'output' */
+static void path_sum (const pathsum_program *prog, size_t d, uint64_t state,
+                      double ar, double ai, uint64_t output, double *sr, double *si)
+{
+  if ((state ^ output) & prog->fixed[d])
+    return;
+
+  if (d == prog->depth)
+  {
+    *sr += ar;
+    *si += ai;
+    return;
+  }
+
+  const pathsum_step *step = &prog->steps[d];
+  uint32_t c = local_index (step, state);
+  uint64_t rest = state & ~step->mask;
+
+  for (uint32_t e = step->col_ptr[c]; e < step->col_ptr[c + 1]; e++)
+  {
+    const dcomplex v = step->val[e];
+    path_sum (prog, d + 1, rest | step->row_bits[e], v.real * ar - v.imag * ai,
+              v.real * ai + v.imag * ar, output, sr, si);
+  }
+}
+
+static int compare_prefix (const void *a, const void *b)
+{
+  uint64_t x = ((const pathsum_prefix *)a)->state;
+  uint64_t y = ((const pathsum_prefix *)b)->state;
+  return (x > y) - (x < y);
+}
+
+/* Advances every prefix in 'frontier' by one step, merging paths which meet at
+ * the same basis state. Returns the new frontier, sets 'size' */
+static pathsum_prefix *frontier_advance (const pathsum_program *prog, size_t d,
+                                         pathsum_prefix *frontier, size_t *size,
+                                         uint64_t output)
+{
+  const pathsum_step *step = &prog->steps[d];
+  size_t count = 0, merged = 0;
+
+  for (size_t p = 0; p < *size; p++)
+  {
+    uint32_t c = local_index (step, frontier[p].state);
+    count += step->col_ptr[c + 1] - step->col_ptr[c];
+  }
+
+  pathsum_prefix *next = malloc ((count + 1) * sizeof (pathsum_prefix));
+  assertf (next, "Error: Failed to allocate path sum frontier");
+
+  count = 0;
+  for (size_t p = 0; p < *size; p++)
+  {
+    uint64_t state = frontier[p].state;
+    uint32_t c = local_index (step, state);
+    dcomplex a = frontier[p].amp;
+
+    for (uint32_t e = step->col_ptr[c]; e < step->col_ptr[c + 1]; e++)
+    {
+      const dcomplex v = step->val[e];
+      uint64_t s = (state & ~step->mask) | step->row_bits[e];
+
+      if ((s ^ output) & prog->fixed[d + 1])
+        continue;
+
+      next[count].state = s;
+      next[count].amp.real = v.real * a.real - v.imag * a.imag;
+      next[count].amp.imag = v.real * a.imag + v.imag * a.real;
+      count++;
+    }
+  }
+
+  qsort (next, count, sizeof (pathsum_prefix), compare_prefix);
+  for (size_t p = 0; p < count; p++)
+  {
+    if (merged > 0 && next[merged - 1].state == next[p].state)
+    {
+      next[merged - 1].amp.real += next[p].amp.real;
+      next[merged - 1].amp.imag += next[p].amp.imag;
+    }
+    else
+      next[merged++] = next[p];
+  }
+
+  free (frontier);
+  *size = merged;
+  return next;
+}
+
+/* Returns <output|U_D ... U_1|initial> of compiled stage 'prog' */
+static dcomplex program_amplitude (const pathsum_program *prog, uint64_t output)
+{
+  pathsum_prefix *frontier = malloc (sizeof (pathsum_prefix));
+  size_t size = 1, d = 0;
+  double sr = 0.0, si = 0.0;
+
+  assertf (frontier, "Error: Failed to allocate path sum frontier");
+  frontier[0].state = main_stage.initial_state;
+  frontier[0].amp.real = 1.0;
+  frontier[0].amp.imag = 0.0;
+
+  if ((frontier[0].state ^ output) & prog->fixed[0])
+    size = 0;
+
+  // Breadth first until there are enough prefixes to spread over threads
+  while (d < prog->depth && size > 0 && size < PATHSUM_FRONTIER)
+    frontier = frontier_advance (prog, d++, frontier, &size, output);
+
+#pragma omp parallel for reduction(+ : sr, si) schedule(dynamic, 16)
+  for (size_t p = 0; p < size; p++)
+    path_sum (prog, d, frontier[p].state, frontier[p].amp.real, frontier[p].amp.imag,
+              output, &sr, &si);
+
+  free (frontier);
+  return (dcomplex){.real = sr, .imag = si};
+}
+
+/*
+Returns amplitude of basis state 'output' after all staged steps, computed as a
+Feynman path sum without forming the statevector.
+
+Notes:
+  - Paths are followed depth first through each step's nonzero entries. Paths
+    leaving the light cone of 'output', i.e. differing from it on a qubit no
+    remaining step acts on, are pruned.
+  - A breadth first prefix of the paths is expanded first, merging prefixes
+    meeting at the same basis state, and the prefixes are summed in parallel.
+  - Operators spanning the whole register need at most FQAM_MAX_TARGETS qubits,
+    wider registers must stage targeted operators (FQAM_stage_append_on).
+*/
+dcomplex FQAM_amplitude (uint64_t output)
+{
+  dcomplex result;
+
+  FQAM_amplitudes (&output, 1, &result);
+  return result;
+}
+
+/* Computes FQAM_amplitude of every state in 'outputs' into 'result' */
+void FQAM_amplitudes (const uint64_t *outputs, size_t num_outputs, dcomplex *result)
+{
+  assertf (FQAM_initialized (), "Error: Expected stage initialized");
+  assertf (main_stage.base_step == 0,
+           "Error: Path sums are unavailable after a measurement collapse");
+
+  pathsum_program prog;
+  program_compile (&prog);
+
+  for (size_t i = 0; i < num_outputs; i++)
+  {
+    assertf (outputs[i] < main_stage.state_space,
+             "Error: Output state must be within hilbert space");
+    result[i] = program_amplitude (&prog, outputs[i]);
+  }
+
+  program_free (&prog);
+}
+
+/* Partial path in best first search, linked to the node it extends */
+typedef struct
+{
+  uint64_t state;
+  dcomplex amp;
+  double priority; // |amp|^2 times the largest gain of the remaining steps
+  size_t depth;
+  size_t parent;
+} pathsum_node;
+
+/* Best first search state: node arena and a max heap of node indices */
+typedef struct
+{
+  pathsum_node *nodes;
+  size_t num_nodes, node_capacity;
+  size_t *heap;
+  size_t heap_size, heap_capacity;
+} pathsum_search;
+
+static void heap_push (pathsum_search *search, size_t node)
+{
+  if (search->heap_size == search->heap_capacity)
+  {
+    search->heap_capacity = search->heap_capacity ? 2 * search->heap_capacity : 256;
+    search->heap = realloc (search->heap, search->heap_capacity * sizeof (size_t));
+    assertf (search->heap, "Error: Failed to allocate path search heap");
+  }
+
+  size_t i = search->heap_size++;
+  double priority = search->nodes[node].priority;
+
+  while (i > 0 && search->nodes[search->heap[(i - 1) / 2]].priority < priority)
+  {
+    search->heap[i] = search->heap[(i - 1) / 2];
+    i = (i - 1) / 2;
+  }
+  search->heap[i] = node;
+}
+
+static size_t heap_pop (pathsum_search *search)
+{
+  size_t top = search->heap[0];
+  size_t last = search->heap[--search->heap_size];
+  double priority = search->nodes[last].priority;
+  size_t i = 0;
+
+  for (;;)
+  {
+    size_t child = 2 * i + 1;
+    if (child >= search->heap_size)
+      break;
+    if (child + 1 < search->heap_size &&
+        search->nodes[search->heap[child + 1]].priority >
+            search->nodes[search->heap[child]].priority)
+      child++;
+    if (search->nodes[search->heap[child]].priority <= priority)
+      break;
+
+    search->heap[i] = search->heap[child];
+    i = child;
+  }
+  search->heap[i] = last;
+
+  return top;
+}
+
+/* Adds node to arena, returns its index */
+static size_t node_add (pathsum_search *search, pathsum_node node)
+{
+  if (search->num_nodes == search->node_capacity)
+  {
+    search->node_capacity = search->node_capacity ? 2 * search->node_capacity : 256;
+    search->nodes = realloc (search->nodes, search->node_capacity * sizeof (pathsum_node));
+    assertf (search->nodes, "Error: Failed to allocate path search nodes");
+  }
+
+  search->nodes[search->num_nodes] = node;
+  return search->num_nodes++;
+}
+
+/* Copies the path ending at complete node 'leaf' into 'path', keeping the
+ * states between staged steps */
+static void path_extract (const pathsum_search *search, size_t leaf,
+                          const pathsum_program *prog, FQAM_Path *path)
+{
+  const pathsum_node *node = &search->nodes[leaf];
+
+  path->amplitude = node->amp;
+  path->probability = node->amp.real * node->amp.real + node->amp.imag * node->amp.imag;
+  path->states = malloc ((prog->num_stages + 1) * sizeof (uint64_t));
+  assertf (path->states, "Error: Failed to allocate path");
+
+  for (size_t s = prog->num_stages + 1; s-- > 0;)
+  {
+    while (node->depth > prog->stage_begin[s])
+      node = &search->nodes[node->parent];
+    path->states[s] = node->state;
+  }
+}
+
+/*
+Finds the most probable Feynman paths through the staged steps, from the
+initial state to any output.
+
+Arguments:
+    max_paths: Largest number of paths returned, zero for no limit
+    threshold: Smallest path probability returned
+    paths: Set to array of found paths, in decreasing order of probability.
+           Release with FQAM_paths_free.
+
+Returns number of paths found.
+
+Notes:
+  - A path's probability is |amplitude|^2 of the path alone. Paths reaching the
+    same output interfere, so these are not output probabilities.
+  - Paths are expanded best first by |amplitude|^2 times the largest factor the
+    remaining steps can contribute (product of squared largest entry
+    magnitudes). The bound never underestimates, so completed paths leave the
+    queue in order and partial paths bounded below 'threshold' are never pushed.
+*/
+size_t FQAM_dominant_paths (size_t max_paths, double threshold, FQAM_Path **paths)
+{
+  assertf (FQAM_initialized (), "Error: Expected stage initialized");
+  assertf (main_stage.base_step == 0,
+           "Error: Path sums are unavailable after a measurement collapse");
+  assertf (max_paths > 0 || threshold > 0.0,
+           "Error: Expected a path limit or a positive threshold");
+
+  pathsum_program prog;
+  pathsum_search search = {0};
+  size_t found = 0, capacity = 0;
+
+  program_compile (&prog);
+  *paths = NULL;
+
+  pathsum_node root = {.state = main_stage.initial_state,
+                       .amp = {.real = 1.0, .imag = 0.0},
+                       .priority = prog.bound[0],
+                       .depth = 0,
+                       .parent = 0};
+  heap_push (&search, node_add (&search, root));
+
+  while (search.heap_size > 0 && (max_paths == 0 || found < max_paths))
+  {
+    size_t idx = heap_pop (&search);
+    pathsum_node node = search.nodes[idx];
+
+    if (node.priority < threshold)
+      break;
+
+    if (node.depth == prog.depth)
+    {
+      if (found == capacity)
+      {
+        capacity = capacity ? 2 * capacity : 16;
+        *paths = realloc (*paths, capacity * sizeof (FQAM_Path));
+        assertf (*paths, "Error: Failed to allocate paths");
+      }
+
+      path_extract (&search, idx, &prog, &(*paths)[found++]);
+      continue;
+    }
+
+    const pathsum_step *step = &prog.steps[node.depth];
+    uint32_t c = local_index (step, node.state);
+    uint64_t rest = node.state & ~step->mask;
+
+    for (uint32_t e = step->col_ptr[c]; e < step->col_ptr[c + 1]; e++)
+    {
+      const dcomplex v = step->val[e];
+      pathsum_node child = {.state = rest | step->row_bits[e], .depth = node.depth + 1,
+                            .parent = idx};
+
+      child.amp.real = v.real * node.amp.real - v.imag * node.amp.imag;
+      child.amp.imag = v.real * node.amp.imag + v.imag * node.amp.real;
+      child.priority = (child.amp.real * child.amp.real + child.amp.imag * child.amp.imag) *
+                       prog.bound[child.depth];
+
+      if (child.priority >= threshold)
+        heap_push (&search, node_add (&search, child));
+    }
+  }
+
+  free (search.nodes);
+  free (search.heap);
+  program_free (&prog);
+
+  return found;
+}
+
+/* Frees paths returned by FQAM_dominant_paths */
+void FQAM_paths_free (FQAM_Path *paths, size_t num_paths)
+{
+  for (size_t i = 0; i < num_paths; i++)
+    free (paths[i].states);
+  free (paths);
+}
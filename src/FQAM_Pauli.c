@@ -129,6 +129,22 @@ void FQAM_hadamard (FQAM_Op *A)
   FQAM_Op_add (FQAM_7PI4, outer3, A);
 }
 
+/* Stores controlled NOT into operator A: target 1 is flipped when target 0 is
+ * set, i.e. |b0 b1> -> |b0, b0 ^ b1> */
+void FQAM_cnot (FQAM_Op *A)
+{
+  FQAM_Op_create (A, "CNOT\0", 2 * pauli_dim);
+
+  dcomplex *buf = FLA_Obj_buffer_at_view (A->mat_repr);
+  dim_t cs = FLA_Obj_col_stride (A->mat_repr);
+
+  for (int in = 0; in < 4; in++)
+  {
+    int out = in & 1 ? in ^ 2 : in;
+    buf[out + in * cs] = FQAM_ONE;
+  }
+}
+
 // void FQAM_CNOT (FQAM_Op *A)
 // {
 //   FQAM_Basis ket0, ket1;
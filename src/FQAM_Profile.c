@@ -0,0 +1,318 @@
+/*
+    Copyright (C) 2024, Chuck Garcia
+
+    This file is part of libfqam and is available under the 3-Clause
+    BSD license, which can be found in the LICENSE file at the top-level
+    directory, or at http://opensource.org/licenses/BSD-3-Clause
+*/
+
+#include <omp.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#endif
+
+#include "FQAM.h"
+#include "__FQAM_Stage.h"
+#include "assertf.h"
+
+/*
+Scoped timers. Modules wrap phases in profile_begin / profile_end, which cost a
+branch when not recording. Each scope records its phase, an optional detail
+(e.g. operator name), the stage step it belongs to, begin and end times, and
+the change of each hardware counter across it.
+
+Counters are opened with perf_event_open for the calling thread, inherited by
+threads it creates afterwards. OpenMP worker threads created before
+FQAM_profile_start are not counted, so counters read low for threaded kernels
+unless profiling starts before the first parallel region. Cache misses are last
+level misses, and bandwidth is estimated as one 64 byte line per miss.
+
+Scopes are recorded by one thread at a time. Scopes opened inside a parallel
+region (e.g. by each trajectory of FQAM_trajectories) are dropped, the region
+being timed by the scope around it.
+*/
+
+#define PROFILE_COUNTERS 3
+#define PROFILE_LINE_BYTES 64
+
+static const char *counter_names[PROFILE_COUNTERS] = {"cycles", "instructions",
+                                                      "cache_misses"};
+
+typedef struct
+{
+  const char *phase;
+  char detail[32];
+  long step;             // Stage step, -1 if none
+  double begin, end;     // Microseconds since FQAM_profile_start
+  uint64_t counters[PROFILE_COUNTERS]; // Counts at begin, deltas once ended
+} profile_event;
+
+static struct
+{
+  bool recording;
+  bool counters; // Counters were read by the last recording
+  int fds[PROFILE_COUNTERS];
+  struct timespec origin;
+  profile_event *events;
+  size_t size, capacity;
+} profile = {.fds = {-1, -1, -1}};
+
+static double elapsed_us (void)
+{
+  struct timespec t;
+
+  clock_gettime (CLOCK_MONOTONIC, &t);
+  return (t.tv_sec - profile.origin.tv_sec) * 1e6 +
+         (t.tv_nsec - profile.origin.tv_nsec) * 1e-3;
+}
+
+static void counters_close (void)
+{
+  for (int c = 0; c < PROFILE_COUNTERS; c++)
+  {
+    if (profile.fds[c] >= 0)
+      close (profile.fds[c]);
+    profile.fds[c] = -1;
+  }
+}
+
+/* Opens the hardware counters, returning false if any is unavailable */
+static bool counters_open (void)
+{
+#ifdef __linux__
+  static const uint64_t configs[PROFILE_COUNTERS] = {
+      PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS, PERF_COUNT_HW_CACHE_MISSES};
+
+  for (int c = 0; c < PROFILE_COUNTERS; c++)
+  {
+    struct perf_event_attr attr;
+
+    memset (&attr, 0, sizeof (attr));
+    attr.size = sizeof (attr);
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.config = configs[c];
+    attr.inherit = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+
+    profile.fds[c] = syscall (SYS_perf_event_open, &attr, 0, -1, -1, 0);
+    if (profile.fds[c] < 0)
+    {
+      counters_close ();
+      return false;
+    }
+  }
+  return true;
+#else
+  return false;
+#endif
+}
+
+static void counters_read (uint64_t *values)
+{
+  for (int c = 0; c < PROFILE_COUNTERS; c++)
+    if (profile.fds[c] < 0 ||
+        read (profile.fds[c], &values[c], sizeof (uint64_t)) != sizeof (uint64_t))
+      values[c] = 0;
+}
+
+/*
+Starts recording scopes, dropping those recorded before.
+
+Arguments:
+    counters: Also read hardware counters. Falls back to timers only, with a
+              warning, when perf_event_open is not permitted (see
+              /proc/sys/kernel/perf_event_paranoid) or not supported
+*/
+void FQAM_profile_start (bool counters)
+{
+  counters_close ();
+  profile.counters = counters && counters_open ();
+  if (counters && !profile.counters)
+    fprintf (stderr, "FQAM: Hardware counters unavailable, profiling timers only\n");
+
+  profile.size = 0;
+  profile.recording = true;
+  clock_gettime (CLOCK_MONOTONIC, &profile.origin);
+}
+
+/* Stops recording. Recorded scopes are kept for export */
+void FQAM_profile_stop (void)
+{
+  profile.recording = false;
+  counters_close ();
+}
+
+/* Opens a scope of 'phase' (a string literal), with optional 'detail' and stage
+ * 'step' (-1 if none) */
+profile_scope profile_begin (const char *phase, const char *detail, long step)
+{
+  // Events are grown without locking, so worker threads record nothing
+  if (!profile.recording || omp_get_level () > 0)
+    return SIZE_MAX;
+
+  if (profile.size == profile.capacity)
+  {
+    size_t capacity = profile.capacity ? 2 * profile.capacity : 256;
+    profile_event *events = realloc (profile.events, capacity * sizeof (profile_event));
+
+    // Out of memory only loses the scope
+    if (events == NULL)
+      return SIZE_MAX;
+
+    profile.events = events;
+    profile.capacity = capacity;
+  }
+
+  profile_event *e = &profile.events[profile.size];
+
+  e->phase = phase;
+  snprintf (e->detail, sizeof (e->detail), "%s", detail ? detail : "");
+  e->step = step;
+  counters_read (e->counters);
+  e->begin = elapsed_us ();
+  e->end = e->begin;
+  return profile.size++;
+}
+
+void profile_end (profile_scope scope)
+{
+  if (scope == SIZE_MAX || scope >= profile.size)
+    return;
+
+  profile_event *e = &profile.events[scope];
+  uint64_t now[PROFILE_COUNTERS];
+
+  e->end = elapsed_us ();
+  counters_read (now);
+  for (int c = 0; c < PROFILE_COUNTERS; c++)
+    e->counters[c] = now[c] - e->counters[c];
+}
+
+/* Writes 's' as a JSON string */
+static void write_string (FILE *f, const char *s)
+{
+  fputc ('"', f);
+  for (; *s; s++)
+  {
+    if (*s == '"' || *s == '\\')
+      fprintf (f, "\\%c", *s);
+    else if ((unsigned char)*s < 0x20)
+      fprintf (f, "\\u%04x", *s);
+    else
+      fputc (*s, f);
+  }
+  fputc ('"', f);
+}
+
+/*
+Writes recorded scopes to 'path' as a Chrome trace of complete ("X") events.
+Events are named by their detail (operator name) when they have one and
+categorized by phase. Arguments carry the stage step and, when read, counter
+deltas with the estimated cache miss bandwidth.
+*/
+void FQAM_profile_write_trace (const char *path)
+{
+  FILE *f = fopen (path, "w");
+  assertf (f, "Error: Failed to open trace file %s", path);
+
+  fprintf (f, "{\"displayTimeUnit\": \"ms\", \"traceEvents\": [\n");
+
+  for (size_t i = 0; i < profile.size; i++)
+  {
+    profile_event *e = &profile.events[i];
+    double dur = e->end - e->begin;
+
+    fprintf (f, "  {\"name\": ");
+    write_string (f, e->detail[0] ? e->detail : e->phase);
+    fprintf (f, ", \"cat\": \"%s\", \"ph\": \"X\", \"pid\": 0, \"tid\": 0, ", e->phase);
+    fprintf (f, "\"ts\": %.3f, \"dur\": %.3f, \"args\": {\"step\": %ld", e->begin, dur,
+             e->step);
+
+    if (profile.counters)
+    {
+      for (int c = 0; c < PROFILE_COUNTERS; c++)
+        fprintf (f, ", \"%s\": %llu", counter_names[c],
+                 (unsigned long long)e->counters[c]);
+      fprintf (f, ", \"miss_gb_per_s\": %.3f",
+               dur > 0 ? e->counters[2] * PROFILE_LINE_BYTES / dur * 1e-3 : 0.0);
+    }
+
+    fprintf (f, "}}%s\n", i + 1 < profile.size ? "," : "");
+  }
+
+  fprintf (f, "]}\n");
+  fclose (f);
+}
+
+/* Totals of one phase and detail */
+typedef struct
+{
+  const char *phase;
+  const char *detail;
+  size_t calls;
+  double us;
+  uint64_t counters[PROFILE_COUNTERS];
+} profile_total;
+
+static int compare_total (const void *a, const void *b)
+{
+  double x = ((const profile_total *)a)->us, y = ((const profile_total *)b)->us;
+  return (x < y) - (x > y);
+}
+
+/* Prints time per phase and operator, longest first. Nested scopes are also
+ * counted in their enclosing phase */
+void FQAM_profile_report (void)
+{
+  profile_total *totals = calloc (profile.size ? profile.size : 1, sizeof (profile_total));
+  size_t n = 0;
+
+  assertf (totals, "Error: Failed to allocate profile report");
+
+  for (size_t i = 0; i < profile.size; i++)
+  {
+    profile_event *e = &profile.events[i];
+    size_t t = 0;
+
+    while (t < n && !(totals[t].phase == e->phase && !strcmp (totals[t].detail, e->detail)))
+      t++;
+    if (t == n)
+    {
+      totals[n].phase = e->phase;
+      totals[n++].detail = e->detail;
+    }
+
+    totals[t].calls++;
+    totals[t].us += e->end - e->begin;
+    for (int c = 0; c < PROFILE_COUNTERS; c++)
+      totals[t].counters[c] += e->counters[c];
+  }
+
+  qsort (totals, n, sizeof (profile_total), compare_total);
+
+  printf ("%-20s %-24s %8s %14s", "phase", "detail", "calls", "ms");
+  if (profile.counters)
+    printf (" %14s %14s %14s", "cycles", "instructions", "cache misses");
+  printf ("\n");
+
+  for (size_t t = 0; t < n; t++)
+  {
+    printf ("%-20s %-24s %8zu %14.3f", totals[t].phase, totals[t].detail, totals[t].calls,
+            totals[t].us * 1e-3);
+    if (profile.counters)
+      for (int c = 0; c < PROFILE_COUNTERS; c++)
+        printf (" %14llu", (unsigned long long)totals[t].counters[c]);
+    printf ("\n");
+  }
+
+  free (totals);
+}
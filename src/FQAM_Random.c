@@ -0,0 +1,71 @@
+/*
+    Copyright (C) 2024, Chuck Garcia
+
+    This file is part of libfqam and is available under the 3-Clause
+    BSD license, which can be found in the LICENSE file at the top-level
+    directory, or at http://opensource.org/licenses/BSD-3-Clause
+*/
+
+#include "FQAM.h"
+
+/* Philox4x32 constants, see Salmon et al. "Parallel Random Numbers: As Easy as
+ * 1, 2, 3" (SC11) */
+#define PHILOX_M0 0xD2511F53u
+#define PHILOX_M1 0xCD9E8D57u
+#define PHILOX_W0 0x9E3779B9u
+#define PHILOX_W1 0xBB67AE85u
+#define PHILOX_ROUNDS 10
+
+/*
+Initializes generator 'rng' to the start of stream 'stream' under 'seed'.
+Generators with equal seeds but distinct streams produce independent sequences.
+*/
+void FQAM_Rng_init (FQAM_Rng *rng, uint64_t seed, uint64_t stream)
+{
+  rng->key[0] = (uint32_t)seed;
+  rng->key[1] = (uint32_t)(seed >> 32);
+
+  rng->ctr[0] = 0;
+  rng->ctr[1] = 0;
+  rng->ctr[2] = (uint32_t)stream;
+  rng->ctr[3] = (uint32_t)(stream >> 32);
+
+  rng->idx = 4;
+}
+
+/* Encrypts the current counter into 'out' and advances the block counter */
+void FQAM_Rng_block (FQAM_Rng *rng)
+{
+  uint32_t c0, c1, c2, c3, k0, k1;
+
+  c0 = rng->ctr[0];
+  c1 = rng->ctr[1];
+  c2 = rng->ctr[2];
+  c3 = rng->ctr[3];
+  k0 = rng->key[0];
+  k1 = rng->key[1];
+
+  for (int round = 0; round < PHILOX_ROUNDS; round++)
+  {
+    uint64_t p0 = (uint64_t)PHILOX_M0 * c0;
+    uint64_t p1 = (uint64_t)PHILOX_M1 * c2;
+
+    c0 = (uint32_t)(p1 >> 32) ^ c1 ^ k0;
+    c1 = (uint32_t)p1;
+    c2 = (uint32_t)(p0 >> 32) ^ c3 ^ k1;
+    c3 = (uint32_t)p0;
+
+    k0 += PHILOX_W0;
+    k1 += PHILOX_W1;
+  }
+
+  rng->out[0] = c0;
+  rng->out[1] = c1;
+  rng->out[2] = c2;
+  rng->out[3] = c3;
+  rng->idx = 0;
+
+  // 64-bit block counter
+  if (++rng->ctr[0] == 0)
+    rng->ctr[1]++;
+}
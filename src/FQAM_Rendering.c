@@ -7,12 +7,15 @@
 
 */
 #include "FQAM.h"
+#include "__FQAM_Stage.h"
 #include "__kernels.h"
 #include "arraylist.h"
 #include "assertf.h"
 #include "raylib.h"
 
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 
 #define RECS_SIZE 50
 
@@ -25,16 +28,6 @@
 #define GET_X_POS(X) (((RECS_SIZE + spacing_x) * (X)) + ORIGIN_X)
 #define GET_Y_POS(Y) (((RECS_SIZE + spacing_y) * (Y)) + ORIGIN_Y)
 
-struct stage
-{
-  FLA_Obj statevector; // Quantum statevector
-  size_t dim;          // Dimension of hilbertspace
-  size_t state_space;  // Statevector size
-  arraylist *stage;    // Contain sequence applied computation steps
-};
-
-// Extern declaration of main_stage
-extern struct stage main_stage;
 extern Color get_color_from_complex_amplitude (FLA_Obj amplitude);
 
 int compute_probability_adjacency_matrix (FLA_Obj A, FLA_Obj state, FLA_Obj C);
@@ -49,6 +42,65 @@ void ImageDrawLineEx (Image *dst, Vector2 start, Vector2 end, int thick,
                       Color color);
 Color get_color_from_probability (FLA_Obj amplitude);
 
+/* Expands step 'step' of local operators into whole register operator 'C' */
+static void expand_step (stage_step *step, FLA_Obj C)
+{
+  FLA_Obj gate, product;
+  const int *targets;
+  int num_targets;
+  FQAM_Op *op;
+
+  op = stage_step_gate (step, 0, &targets, &num_targets);
+  kernel_expand_local (op->mat_repr, targets, num_targets, C);
+
+  if (stage_step_size (step) == 1)
+    return;
+
+  // Product of the step's operators, in order of application
+  FLA_Obj_create_conf_to (FLA_NO_TRANSPOSE, C, &gate);
+  FLA_Obj_create_conf_to (FLA_NO_TRANSPOSE, C, &product);
+
+  for (int i = 1; i < stage_step_size (step); i++)
+  {
+    op = stage_step_gate (step, i, &targets, &num_targets);
+    kernel_expand_local (op->mat_repr, targets, num_targets, gate);
+    FLA_Gemm (FLA_NO_TRANSPOSE, FLA_NO_TRANSPOSE, FLA_ONE, gate, C, FLA_ZERO, product);
+    FLA_Copy (product, C);
+  }
+
+  FLA_Obj_free (&gate);
+  FLA_Obj_free (&product);
+}
+
+/* Label of step 'step'. Pauli rotations of wide support have no operator */
+static char *step_name (stage_step *step)
+{
+  return step->op ? step->op->name : "Rotations";
+}
+
+/* Whole register operator of step 'step' for adjacency matrices: the step's own
+ * operator, or its local operators expanded into 'expanded'. Returns false for
+ * Pauli rotations of wide support, which have no dense operator and are drawn
+ * without transitions */
+static bool step_matrix (stage_step *step, FLA_Obj expanded, int time_step, FLA_Obj *A)
+{
+  if (step->op == NULL)
+    return false;
+
+  if (step->kind == STEP_OPERATOR && step->num_targets == 0)
+  {
+    *A = step->op->mat_repr;
+    return true;
+  }
+
+  profile_scope scope = profile_begin ("expand_step", step->op->name, time_step - 1);
+  expand_step (step, expanded);
+  profile_end (scope);
+
+  *A = expanded;
+  return true;
+}
+
 FQAM_Error FQAM_Render_feynman_diagram_no_lines (void)
 {
   assertf (FQAM_initialized (), "Error: Expected core initialized");
@@ -76,18 +128,19 @@ FQAM_Error FQAM_Render_feynman_diagram_no_lines (void)
   // Create result image object
   result_image = GenImageColor (screenWidth, screenHeight, WHITE);
 
-  // Draw initial state
-  draw_next_state (&result_image, main_stage.statevector, 0, spacing_x, spacing_y);
+  // Draw initial state (or the last collapsed state)
+  stage_seek (main_stage.base_step);
+  draw_next_state (&result_image, main_stage.statevector, main_stage.base_step,
+                   spacing_x, spacing_y);
 
   // Compute and draw transition probabilities
-  for (int time_step = 1; time_step < depth; time_step++)
+  for (int time_step = main_stage.base_step + 1; time_step < depth; time_step++)
   {
-    FLA_Obj operator, state;
+    FLA_Obj state;
 
-    // Compute next state and adjacency matrix
-    operator= ((FQAM_Op *)arraylist_get (main_stage.stage, time_step - 1))->mat_repr;
+    // Compute next state, resuming from cached checkpoints where possible
     state = main_stage.statevector;
-    apply_operator (operator);
+    stage_seek (time_step);
     draw_next_state (&result_image, state, time_step, spacing_x, spacing_y);
 
     printf ("Drew state: %d\n", time_step);
@@ -102,10 +155,11 @@ FQAM_Error FQAM_Render_feynman_diagram (void)
 {
   assertf (FQAM_initialized (), "Error: Expected core initialized");
 
+  profile_scope render_scope = profile_begin ("render", NULL, -1), scope;
   int screenWidth, screenHeight, depth, spacing_x, spacing_y, thickness;
   float rotation;
 
-  FLA_Obj adjacency_matrix;
+  FLA_Obj adjacency_matrix, expanded;
 
   dim_t input_states, output_states;
   Image result_image;
@@ -135,38 +189,454 @@ FQAM_Error FQAM_Render_feynman_diagram (void)
   // Create adjacency matrix buffer and set to zeros
   FLA_Obj_create (FLA_DOUBLE_COMPLEX, output_states, input_states, 0, 0,
                   &adjacency_matrix);
+  FLA_Obj_create (FLA_DOUBLE_COMPLEX, output_states, input_states, 0, 0,
+                  &expanded);
 
-  // Draw initial state
-  draw_next_state (&result_image, main_stage.statevector, 0, spacing_x, spacing_y);
+  // Draw initial state (or the last collapsed state)
+  stage_seek (main_stage.base_step);
+  scope = profile_begin ("draw_state", NULL, main_stage.base_step);
+  draw_next_state (&result_image, main_stage.statevector, main_stage.base_step,
+                   spacing_x, spacing_y);
+  profile_end (scope);
 
   // Compute and draw transition probabilities
-  for (int time_step = 1; time_step < depth; time_step++)
+  for (int time_step = main_stage.base_step + 1; time_step < depth; time_step++)
   {
-    FLA_Obj state;
-    FQAM_Op *operator;
-
-    // Compute next state and adjacency matrix
-    operator= ((FQAM_Op *)arraylist_get (main_stage.stage, time_step - 1));
+    FLA_Obj state, A;
+    stage_step *step;
 
+    // Compute next state and adjacency matrix. Local operators are expanded to
+    // the whole register for drawing
+    step = stage_get (time_step - 1);
     state = main_stage.statevector;
 
+    if (!step_matrix (step, expanded, time_step, &A))
+    {
+      stage_seek (time_step);
+      draw_next_state (&result_image, state, time_step, spacing_x, spacing_y);
+      continue;
+    }
+
+    scope = profile_begin ("adjacency", step_name (step), time_step - 1);
     FLA_Set (FLA_ZERO, adjacency_matrix);
-    compute_probability_adjacency_matrix (operator->mat_repr, state,
-                                          adjacency_matrix);
-    apply_operator (operator->mat_repr);
+    compute_probability_adjacency_matrix (A, state, adjacency_matrix);
+    profile_end (scope);
+    stage_seek (time_step);
 
     // TODO: Rethink ordering computation so transpose is completely avoided
     FLA_Transpose (adjacency_matrix);
     printf ("---Showing Adjacency---\n");
     _debug_show_fla_meta_data (adjacency_matrix);
-    draw_transition_lines (&result_image, adjacency_matrix, operator->name,
+    scope = profile_begin ("draw_lines", step_name (step), time_step - 1);
+    draw_transition_lines (&result_image, adjacency_matrix, step_name (step),
                            time_step, spacing_x, spacing_y, thickness);
+    profile_end (scope);
+
+    scope = profile_begin ("draw_state", NULL, time_step);
     draw_next_state (&result_image, state, time_step, spacing_x, spacing_y);
+    profile_end (scope);
     printf ("Drew state: %d\n", time_step);
   }
 
+  scope = profile_begin ("export_image", NULL, -1);
+  ExportImage (result_image, "saved_image.png");
+  profile_end (scope);
+
+  UnloadImage (result_image);
+  FLA_Obj_free (&adjacency_matrix);
+  FLA_Obj_free (&expanded);
+  profile_end (render_scope);
+  return 0;
+}
+
+/* Accumulates probability 'p' with phase of 'amp' into entry 'entry' */
+static void accumulate_path (dcomplex *entry, dcomplex amp, double p)
+{
+  double prob = entry->real * entry->real + entry->imag * entry->imag + p;
+  double norm = sqrt (amp.real * amp.real + amp.imag * amp.imag);
+
+  entry->real = norm > 0 ? sqrt (prob) * amp.real / norm : sqrt (prob);
+  entry->imag = norm > 0 ? sqrt (prob) * amp.imag / norm : 0.0;
+}
+
+/* Transition taken by a drawn path between rows of visited states */
+typedef struct
+{
+  size_t in, out;
+  dcomplex amplitude;
+  double probability;
+} path_edge;
+
+static int compare_states (const void *a, const void *b)
+{
+  uint64_t x = *(const uint64_t *)a, y = *(const uint64_t *)b;
+  return (x > y) - (x < y);
+}
+
+static int compare_edges (const void *a, const void *b)
+{
+  const path_edge *x = a, *y = b;
+
+  if (x->in != y->in)
+    return (x->in > y->in) - (x->in < y->in);
+  return (x->out > y->out) - (x->out < y->out);
+}
+
+/* Row of basis state 'state' among the 'num_rows' sorted visited states */
+static size_t state_row (const uint64_t *rows, size_t num_rows, uint64_t state)
+{
+  const uint64_t *row = bsearch (&state, rows, num_rows, sizeof (uint64_t),
+                                 compare_states);
+  return row - rows;
+}
+
+/* Draws visited basis state 'state' in row 'row', shaded by 'amplitude' (a 1x1
+ * object), as draw_next_state does */
+static void draw_path_state (Image *image, FLA_Obj amplitude, uint64_t state, size_t row,
+                             int time_step, const int spacing_x, const int spacing_y)
+{
+  int x_pos = GET_X_POS (time_step) + ORIGIN_X;
+  int y_pos = GET_Y_POS (row) + ORIGIN_Y;
+  char state_label[32];
+
+  snprintf (state_label, sizeof (state_label), "|%llu>", (unsigned long long)state);
+
+  ImageDrawRectangleRec (image, (Rectangle){x_pos, y_pos, RECS_SIZE, RECS_SIZE},
+                         get_color_from_probability (amplitude));
+  ImageDrawText (image, state_label, x_pos + RECS_SIZE * 0.40, y_pos + RECS_SIZE * 0.40,
+                 13, BLUE);
+}
+
+/*
+Renders only the most probable Feynman paths, see FQAM_dominant_paths.
+
+Arguments:
+    max_paths: Largest number of paths drawn, zero for no limit
+    threshold: Smallest probability of drawn paths
+
+Notes:
+  - States are shaded by the total probability of drawn paths visiting them,
+    and edges by the total probability of drawn paths taking them.
+  - One row is drawn per basis state visited by a drawn path, in increasing
+    order, and edges are drawn from the paths directly. No statevector or
+    adjacency matrix is needed, so this also renders path sum backend stages.
+*/
+FQAM_Error FQAM_Render_dominant_paths (size_t max_paths, double threshold)
+{
+  assertf (FQAM_initialized (), "Error: Expected core initialized");
+
+  int screenWidth, screenHeight, depth, spacing_x, spacing_y, thickness;
+  size_t num_paths, num_rows = 0;
+
+  FLA_Obj entry;
+  FQAM_Path *paths;
+  Image result_image;
+
+  num_paths = FQAM_dominant_paths (max_paths, threshold, &paths);
+  depth = main_stage.stage->size + 1;
+
+  // Rows: distinct basis states visited by any drawn path
+  uint64_t *rows = malloc ((num_paths * depth + 1) * sizeof (uint64_t));
+  dcomplex *states = malloc ((num_paths * depth + 1) * sizeof (dcomplex));
+  path_edge *edges = malloc ((num_paths + 1) * sizeof (path_edge));
+
+  assertf (rows && states && edges, "Error: Failed to allocate path layout");
+
+  for (size_t p = 0; p < num_paths; p++)
+    memcpy (rows + p * depth, paths[p].states, depth * sizeof (uint64_t));
+  qsort (rows, num_paths * depth, sizeof (uint64_t), compare_states);
+  for (size_t i = 0; i < num_paths * depth; i++)
+    if (num_rows == 0 || rows[i] != rows[num_rows - 1])
+      rows[num_rows++] = rows[i];
+
+  InitWindow (1, 1, "FQAM Rendering: Dominant Feynman paths");
+
+  // Rendering settings
+  thickness = 10;
+
+  spacing_x = RECS_SIZE * 1.2;
+  spacing_y = RECS_SIZE * 1.2;
+
+  screenWidth = depth * (RECS_SIZE + spacing_x);
+  screenHeight = max (num_rows, 1) * (RECS_SIZE + spacing_y);
+
+  result_image = GenImageColor (screenWidth, screenHeight, WHITE);
+
+  // Amplitudes are shaded through a single entry, as drawn states and edges are
+  FLA_Obj_create (FLA_DOUBLE_COMPLEX, 1, 1, 0, 0, &entry);
+  dcomplex *value = FLA_Obj_buffer_at_view (entry);
+
+  for (int time_step = 0; time_step < depth; time_step++)
+  {
+    size_t num_edges = 0;
+
+    memset (states, 0, num_rows * sizeof (dcomplex));
+
+    for (size_t p = 0; p < num_paths; p++)
+    {
+      size_t out = state_row (rows, num_rows, paths[p].states[time_step]);
+
+      accumulate_path (states + out, paths[p].amplitude, paths[p].probability);
+      if (time_step > 0)
+        edges[num_edges++] = (path_edge){
+            state_row (rows, num_rows, paths[p].states[time_step - 1]), out,
+            paths[p].amplitude, paths[p].probability};
+    }
+
+    if (time_step > 0)
+    {
+      int curr_x_pos = GET_X_POS (time_step - 1) + RECS_SIZE;
+      int next_pos_x = GET_X_POS (time_step) + RECS_SIZE / 2;
+
+      // Paths taking the same edge are drawn as one
+      qsort (edges, num_edges, sizeof (path_edge), compare_edges);
+      for (size_t e = 0; e < num_edges;)
+      {
+        size_t f = e;
+
+        *value = (dcomplex){0.0, 0.0};
+        for (; f < num_edges && !compare_edges (&edges[e], &edges[f]); f++)
+          accumulate_path (value, edges[f].amplitude, edges[f].probability);
+
+        if (get_probability (entry) > 0.01)
+          ImageDrawLineEx (&result_image,
+                           (Vector2){curr_x_pos, GET_Y_POS (edges[e].in) + RECS_SIZE / 2},
+                           (Vector2){next_pos_x, GET_Y_POS (edges[e].out) + RECS_SIZE / 2},
+                           thickness, get_color_from_complex_amplitude (entry));
+        e = f;
+      }
+
+      ImageDrawText (&result_image, step_name (stage_get (time_step - 1)),
+                     curr_x_pos + RECS_SIZE * 0.40, RECS_SIZE * .1, 13, BLUE);
+    }
+
+    for (size_t r = 0; r < num_rows; r++)
+    {
+      *value = states[r];
+      draw_path_state (&result_image, entry, rows[r], r, time_step, spacing_x,
+                       spacing_y);
+    }
+  }
+
+  ExportImage (result_image, "saved_image.png");
+  UnloadImage (result_image);
+  FLA_Obj_free (&entry);
+  free (rows);
+  free (states);
+  free (edges);
+  FQAM_paths_free (paths, num_paths);
+  return 0;
+}
+
+/* Expands the operators of 'step' acting only on sites [first, first + width)
+ * into window operator 'C', in order of application */
+static void expand_window_step (stage_step *step, int first, int width, FLA_Obj C)
+{
+  FLA_Obj gate, product;
+  int shifted[FQAM_MAX_TARGETS];
+
+  FLA_Obj_create_conf_to (FLA_NO_TRANSPOSE, C, &gate);
+  FLA_Obj_create_conf_to (FLA_NO_TRANSPOSE, C, &product);
+  FLA_Set_to_identity (C);
+
+  for (int i = 0; i < stage_step_size (step); i++)
+  {
+    const int *targets;
+    int num_targets;
+    bool inside;
+    FQAM_Op *op = stage_step_gate (step, i, &targets, &num_targets);
+
+    inside = num_targets > 0 || (first == 0 && width == (int)main_stage.dim);
+    for (int j = 0; j < num_targets; j++)
+    {
+      shifted[j] = targets[j] - first;
+      inside &= shifted[j] >= 0 && shifted[j] < width;
+    }
+
+    if (!inside)
+      continue;
+
+    kernel_expand_local (op->mat_repr, shifted, num_targets, gate);
+    FLA_Gemm (FLA_NO_TRANSPOSE, FLA_NO_TRANSPOSE, FLA_ONE, gate, C, FLA_ZERO, product);
+    FLA_Copy (product, C);
+  }
+
+  FLA_Obj_free (&gate);
+  FLA_Obj_free (&product);
+}
+
+/*
+Renders the states of a window of sites of an MPS backend stage, see
+FQAM_mps_window_probabilities.
+
+Arguments:
+    first: Lowest site of the window
+    width: Number of sites in the window
+
+Notes:
+  - States are shaded by their marginal probability, the rest of the chain
+    being traced out, so only probabilities (not phases) are drawn.
+  - Transitions are drawn for the operators acting only on window sites.
+    Operators reaching outside of the window are omitted.
+*/
+FQAM_Error FQAM_Render_mps_window (int first, int width)
+{
+  assertf (FQAM_initialized (), "Error: Expected core initialized");
+  assertf (main_stage.config.backend == FQAM_BACKEND_MPS, "Error: Expected MPS backend");
+
+  int screenWidth, screenHeight, depth, spacing_x, spacing_y, thickness;
+  uint64_t window_space = 1ULL << width;
+
+  FLA_Obj adjacency_matrix, window_op, previous, state;
+  Image result_image;
+
+  InitWindow (1, 1, "FQAM Rendering: MPS window");
+
+  // Rendering settings
+  depth = main_stage.stage->size + 1;
+  thickness = 10;
+
+  spacing_x = RECS_SIZE * 1.2;
+  spacing_y = RECS_SIZE * 1.2;
+
+  screenWidth = depth * (RECS_SIZE + spacing_x);
+  screenHeight = window_space * (RECS_SIZE + spacing_y);
+
+  result_image = GenImageColor (screenWidth, screenHeight, WHITE);
+
+  FLA_Obj_create (FLA_DOUBLE_COMPLEX, window_space, window_space, 0, 0,
+                  &adjacency_matrix);
+  FLA_Obj_create (FLA_DOUBLE_COMPLEX, window_space, window_space, 0, 0, &window_op);
+  FLA_Obj_create (FLA_DOUBLE_COMPLEX, window_space, 1, 0, 0, &previous);
+  FLA_Obj_create (FLA_DOUBLE_COMPLEX, window_space, 1, 0, 0, &state);
+
+  dcomplex *vec = FLA_Obj_buffer_at_view (state);
+  double *probs = malloc (window_space * sizeof (double));
+  assertf (probs, "Error: Failed to allocate window probabilities");
+
+  for (int time_step = 0; time_step < depth; time_step++)
+  {
+    FLA_Copy (state, previous);
+
+    mps_seek (time_step);
+    mps_window_probabilities (first, width, probs);
+
+    for (uint64_t i = 0; i < window_space; i++)
+    {
+      vec[i].real = sqrt (max (probs[i], 0.0));
+      vec[i].imag = 0.0;
+    }
+
+    // Pauli rotations of wide support have no dense operator to draw transitions of
+    if (time_step > 0 && stage_get (time_step - 1)->op)
+    {
+      stage_step *step = stage_get (time_step - 1);
+
+      expand_window_step (step, first, width, window_op);
+      FLA_Set (FLA_ZERO, adjacency_matrix);
+      compute_probability_adjacency_matrix (window_op, previous, adjacency_matrix);
+      FLA_Transpose (adjacency_matrix);
+      draw_transition_lines (&result_image, adjacency_matrix, step->op->name,
+                             time_step, spacing_x, spacing_y, thickness);
+    }
+    draw_next_state (&result_image, state, time_step, spacing_x, spacing_y);
+  }
+
+  ExportImage (result_image, "saved_image.png");
+  UnloadImage (result_image);
+  FLA_Obj_free (&adjacency_matrix);
+  FLA_Obj_free (&window_op);
+  FLA_Obj_free (&previous);
+  FLA_Obj_free (&state);
+  free (probs);
+  return 0;
+}
+
+/*
+Renders a density matrix backend stage with states shaded by their populations,
+the diagonal entries of rho.
+
+Notes:
+  - Transitions are drawn for operator steps, weighted by the populations they
+    act on. Noise channels mix states without a transition amplitude, so their
+    columns are drawn without lines, as are Pauli rotations of wide support.
+*/
+FQAM_Error FQAM_Render_populations (void)
+{
+  assertf (FQAM_initialized (), "Error: Expected core initialized");
+  assertf (main_stage.config.backend == FQAM_BACKEND_DENSITY,
+           "Error: Expected density matrix backend");
+
+  int screenWidth, screenHeight, depth, spacing_x, spacing_y, thickness;
+  uint64_t N = 1ULL << main_stage.dim;
+  int *qubits = malloc (main_stage.dim * sizeof (int));
+  double *probs = malloc (N * sizeof (double));
+
+  FLA_Obj adjacency_matrix, expanded, previous, state;
+  Image result_image;
+
+  assertf (qubits && probs, "Error: Failed to allocate populations");
+  for (size_t q = 0; q < main_stage.dim; q++)
+    qubits[q] = q;
+
+  InitWindow (1, 1, "FQAM Rendering: Populations");
+
+  // Rendering settings
+  depth = main_stage.stage->size + 1;
+  thickness = 10;
+
+  spacing_x = RECS_SIZE * 1.2;
+  spacing_y = RECS_SIZE * 1.2;
+
+  screenWidth = depth * (RECS_SIZE + spacing_x);
+  screenHeight = N * (RECS_SIZE + spacing_y);
+
+  result_image = GenImageColor (screenWidth, screenHeight, WHITE);
+
+  FLA_Obj_create (FLA_DOUBLE_COMPLEX, N, N, 0, 0, &adjacency_matrix);
+  FLA_Obj_create (FLA_DOUBLE_COMPLEX, N, N, 0, 0, &expanded);
+  FLA_Obj_create (FLA_DOUBLE_COMPLEX, N, 1, 0, 0, &previous);
+  FLA_Obj_create (FLA_DOUBLE_COMPLEX, N, 1, 0, 0, &state);
+
+  dcomplex *vec = FLA_Obj_buffer_at_view (state);
+
+  for (int time_step = main_stage.base_step; time_step < depth; time_step++)
+  {
+    FLA_Copy (state, previous);
+
+    stage_seek (time_step);
+    density_marginal (qubits, main_stage.dim, probs);
+
+    for (uint64_t i = 0; i < N; i++)
+    {
+      vec[i].real = sqrt (max (probs[i], 0.0));
+      vec[i].imag = 0.0;
+    }
+
+    stage_step *step = NULL;
+    FLA_Obj A;
+    if (time_step > (int)main_stage.base_step)
+      step = stage_get (time_step - 1);
+
+    if (step && step->kind != STEP_CHANNEL && step_matrix (step, expanded, time_step, &A))
+    {
+      FLA_Set (FLA_ZERO, adjacency_matrix);
+      compute_probability_adjacency_matrix (A, previous, adjacency_matrix);
+      FLA_Transpose (adjacency_matrix);
+      draw_transition_lines (&result_image, adjacency_matrix, step_name (step),
+                             time_step, spacing_x, spacing_y, thickness);
+    }
+    draw_next_state (&result_image, state, time_step, spacing_x, spacing_y);
+  }
+
   ExportImage (result_image, "saved_image.png");
   UnloadImage (result_image);
+  FLA_Obj_free (&adjacency_matrix);
+  FLA_Obj_free (&expanded);
+  FLA_Obj_free (&previous);
+  FLA_Obj_free (&state);
+  free (qubits);
+  free (probs);
   return 0;
 }
 
@@ -284,8 +754,8 @@ void draw_transition_lines (Image *image, FLA_Obj A, char *op_name, int time_ste
   }
 }
 
-/* Returns scalar probability (Double) from given double complex FLA_Obj amplitude
- * object */
+/* Returns scalar probability (Double) from given double or single complex FLA_Obj
+ * amplitude object */
 double get_probability (FLA_Obj amplitude)
 {
   double probability;
@@ -293,11 +763,23 @@ double get_probability (FLA_Obj amplitude)
 
   // Convert to C complex
   double x, y;
-  x = FLA_DOUBLE_COMPLEX_PTR (amplitude)->real;
-  y = FLA_DOUBLE_COMPLEX_PTR (amplitude)->imag;
+  if (kernel_is_single (amplitude))
+  {
+    x = FLA_COMPLEX_PTR (amplitude)->real;
+    y = FLA_COMPLEX_PTR (amplitude)->imag;
+  }
+  else
+  {
+    x = FLA_DOUBLE_COMPLEX_PTR (amplitude)->real;
+    y = FLA_DOUBLE_COMPLEX_PTR (amplitude)->imag;
+  }
 
   probability = x * x + y * y;
 
+  // Single precision amplitudes may round slightly past one
+  if (kernel_is_single (amplitude) && probability > 1.0 && probability < 1.0 + 1e-6)
+    probability = 1.0;
+
   assertf (probability <= 1.0,
            "Error: Somehow statevector has real probability > 1");
   assertf (probability >= 0.0,
@@ -0,0 +1,382 @@
+/*
+    Copyright (C) 2024, Chuck Garcia
+
+    This file is part of libfqam and is available under the 3-Clause
+    BSD license, which can be found in the LICENSE file at the top-level
+    directory, or at http://opensource.org/licenses/BSD-3-Clause
+*/
+
+#include <fcntl.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#ifdef FQAM_ZSTD
+#include <zstd.h>
+#endif
+
+#include "FQAM.h"
+#include "__FQAM_Stage.h"
+#include "arraylist.h"
+#include "assertf.h"
+
+#define SNAPSHOT_MAGIC "FQAMSNAP"
+#define SNAPSHOT_VERSION 1
+
+/* Bytes reserved for the header, a page so raw amplitudes can be mapped */
+#define SNAPSHOT_HEADER_SIZE 4096
+
+/* Bytes of amplitudes per block of block encoded snapshots */
+#define SNAPSHOT_BLOCK_BYTES (1UL << 20)
+
+#ifdef FQAM_ZSTD
+/* Fast levels keep compression near disk speed, sparse states compress well anyway */
+#define SNAPSHOT_ZSTD_LEVEL 3
+#endif
+
+/*
+Snapshots hold native endian amplitudes after a header padded to
+SNAPSHOT_HEADER_SIZE bytes. Raw snapshots follow it with the statevector as is,
+written in one pass, so loading maps the file as the statevector without
+reading it. Block snapshots follow it with a table of snapshot_block entries,
+one per SNAPSHOT_BLOCK_BYTES of amplitudes, then the stored blocks: all zero
+blocks, common in sparse states, take no space, and with FQAM_ZSTD the others
+are compressed when that saves space.
+*/
+
+/* Block encodings */
+enum
+{
+  BLOCK_ZERO = 0, // All amplitudes zero, nothing stored
+  BLOCK_RAW = 1,  // Amplitudes as is
+  BLOCK_ZSTD = 2, // zstd frame of the amplitudes
+};
+
+typedef struct
+{
+  char magic[8];
+  uint32_t version;
+  uint32_t encoding;     // FQAM_Snapshot_encoding
+  uint32_t backend;      // FQAM_Backend of the stage saved
+  uint32_t num_qubits;
+  uint32_t amp_size;     // Bytes per amplitude
+  uint32_t reserved;
+  uint64_t state_space;  // Amplitudes
+  uint64_t num_blocks;   // Blocks: entries of the block table
+  uint64_t data_offset;  // Raw: amplitudes, Blocks: block table
+} snapshot_header;
+
+typedef struct
+{
+  uint32_t encoding;
+  uint32_t reserved;
+  uint64_t offset;
+  uint64_t size; // Bytes stored
+} snapshot_block;
+
+_Static_assert (sizeof (snapshot_header) <= SNAPSHOT_HEADER_SIZE,
+                "Snapshot header exceeds its page");
+
+static void write_full (int fd, const void *data, size_t size, off_t offset,
+                        const char *path)
+{
+  while (size > 0)
+  {
+    ssize_t written = pwrite (fd, data, size, offset);
+
+    assertf (written > 0, "Error: Failed to write snapshot %s", path);
+    data = (const char *)data + written;
+    size -= written;
+    offset += written;
+  }
+}
+
+static void read_full (int fd, void *data, size_t size, off_t offset, const char *path)
+{
+  while (size > 0)
+  {
+    ssize_t got = pread (fd, data, size, offset);
+
+    assertf (got > 0, "Error: Snapshot %s is truncated", path);
+    data = (char *)data + got;
+    size -= got;
+    offset += got;
+  }
+}
+
+static bool block_zero (const void *data, size_t size)
+{
+  const uint64_t *w = data;
+
+  for (size_t i = 0; i < size / sizeof (uint64_t); i++)
+    if (w[i])
+      return false;
+  return true;
+}
+
+/* Writes 'bytes' of amplitudes 'psi' as blocks after the header */
+static void blocks_write (int fd, const char *psi, size_t bytes, snapshot_header *h,
+                          const char *path)
+{
+  size_t num_blocks = (bytes + SNAPSHOT_BLOCK_BYTES - 1) / SNAPSHOT_BLOCK_BYTES;
+  snapshot_block *table = calloc (num_blocks, sizeof (snapshot_block));
+  off_t offset = SNAPSHOT_HEADER_SIZE + num_blocks * sizeof (snapshot_block);
+
+  assertf (table, "Error: Failed to allocate snapshot blocks");
+
+#ifdef FQAM_ZSTD
+  size_t capacity = ZSTD_compressBound (SNAPSHOT_BLOCK_BYTES);
+  void *compressed = malloc (capacity);
+  assertf (compressed, "Error: Failed to allocate snapshot blocks");
+#endif
+
+  for (size_t b = 0; b < num_blocks; b++)
+  {
+    const char *data = psi + b * SNAPSHOT_BLOCK_BYTES;
+    size_t size = min (SNAPSHOT_BLOCK_BYTES, bytes - b * SNAPSHOT_BLOCK_BYTES);
+
+    table[b].offset = offset;
+
+    if (block_zero (data, size))
+    {
+      table[b].encoding = BLOCK_ZERO;
+      continue;
+    }
+
+    table[b].encoding = BLOCK_RAW;
+    table[b].size = size;
+
+#ifdef FQAM_ZSTD
+    size_t packed = ZSTD_compress (compressed, capacity, data, size, SNAPSHOT_ZSTD_LEVEL);
+
+    if (!ZSTD_isError (packed) && packed < size)
+    {
+      table[b].encoding = BLOCK_ZSTD;
+      table[b].size = packed;
+      data = compressed;
+    }
+#endif
+
+    write_full (fd, data, table[b].size, offset, path);
+    offset += table[b].size;
+  }
+
+  write_full (fd, table, num_blocks * sizeof (snapshot_block), SNAPSHOT_HEADER_SIZE, path);
+
+  h->num_blocks = num_blocks;
+  h->data_offset = SNAPSHOT_HEADER_SIZE;
+
+  free (table);
+#ifdef FQAM_ZSTD
+  free (compressed);
+#endif
+}
+
+/* Reads the blocks of snapshot 'h' into zeroed amplitudes 'psi' of 'bytes' */
+static void blocks_read (int fd, char *psi, size_t bytes, const snapshot_header *h,
+                         size_t file_size, const char *path)
+{
+  size_t num_blocks = (bytes + SNAPSHOT_BLOCK_BYTES - 1) / SNAPSHOT_BLOCK_BYTES;
+
+  assertf (h->num_blocks == num_blocks, "Error: Snapshot %s is corrupt", path);
+
+  snapshot_block *table = malloc (num_blocks * sizeof (snapshot_block));
+  void *packed = malloc (SNAPSHOT_BLOCK_BYTES);
+  assertf (table && packed, "Error: Failed to allocate snapshot blocks");
+
+  read_full (fd, table, num_blocks * sizeof (snapshot_block), h->data_offset, path);
+
+  for (size_t b = 0; b < num_blocks; b++)
+  {
+    char *data = psi + b * SNAPSHOT_BLOCK_BYTES;
+    size_t size = min (SNAPSHOT_BLOCK_BYTES, bytes - b * SNAPSHOT_BLOCK_BYTES);
+    const snapshot_block *e = &table[b];
+
+    assertf (e->offset <= file_size && e->size <= file_size - e->offset,
+             "Error: Snapshot %s is truncated", path);
+
+    switch (e->encoding)
+    {
+    case BLOCK_ZERO:
+      break;
+
+    case BLOCK_RAW:
+      assertf (e->size == size, "Error: Snapshot %s is corrupt", path);
+      read_full (fd, data, size, e->offset, path);
+      break;
+
+    case BLOCK_ZSTD:
+#ifdef FQAM_ZSTD
+      assertf (e->size <= SNAPSHOT_BLOCK_BYTES, "Error: Snapshot %s is corrupt", path);
+      read_full (fd, packed, e->size, e->offset, path);
+      assertf (ZSTD_decompress (data, size, packed, e->size) == size,
+               "Error: Snapshot %s is corrupt", path);
+      break;
+#else
+      assertf (false, "Error: Snapshot %s is compressed, rebuild with FQAM_ZSTD", path);
+#endif
+
+    default:
+      assertf (false, "Error: Snapshot %s is corrupt", path);
+    }
+  }
+
+  free (table);
+  free (packed);
+}
+
+static void check_backend (void)
+{
+  assertf (FQAM_initialized (), "Error: Expected stage initialized");
+  assertf (main_stage.config.backend == FQAM_BACKEND_STATEVECTOR ||
+               main_stage.config.backend == FQAM_BACKEND_DENSITY,
+           "Error: Snapshots need the statevector or density backend");
+}
+
+/*
+Saves the state after every staged step to snapshot 'path', computing it first
+if needed.
+
+Arguments:
+    path: Snapshot file, replaced if it exists
+    encoding: FQAM_SNAPSHOT_RAW to restore by mapping the file, or
+              FQAM_SNAPSHOT_BLOCKS to elide all zero blocks (and compress the
+              rest when built with FQAM_ZSTD)
+
+Notes:
+ - Amplitudes are written in native byte order and precision.
+*/
+void FQAM_snapshot_save (const char *path, FQAM_Snapshot_encoding encoding)
+{
+  check_backend ();
+  stage_seek (main_stage.stage->size);
+
+  const char *psi = FLA_Obj_buffer_at_view (main_stage.statevector);
+  size_t bytes = main_stage.state_space * main_stage.amp_size;
+  char *header = calloc (1, SNAPSHOT_HEADER_SIZE);
+  snapshot_header h = {0};
+
+  assertf (header, "Error: Failed to allocate snapshot header");
+
+  memcpy (h.magic, SNAPSHOT_MAGIC, sizeof (h.magic));
+  h.version = SNAPSHOT_VERSION;
+  h.encoding = encoding;
+  h.backend = main_stage.config.backend;
+  h.num_qubits = main_stage.dim;
+  h.amp_size = main_stage.amp_size;
+  h.state_space = main_stage.state_space;
+
+  int fd = open (path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+  assertf (fd >= 0, "Error: Failed to create snapshot %s", path);
+
+  if (encoding == FQAM_SNAPSHOT_RAW)
+  {
+    h.data_offset = SNAPSHOT_HEADER_SIZE;
+    write_full (fd, psi, bytes, h.data_offset, path);
+  }
+  else
+    blocks_write (fd, psi, bytes, &h, path);
+
+  // Header last, so interrupted saves leave no valid snapshot
+  memcpy (header, &h, sizeof (h));
+  write_full (fd, header, SNAPSHOT_HEADER_SIZE, 0, path);
+
+  assertf (close (fd) == 0, "Error: Failed to write snapshot %s", path);
+  free (header);
+}
+
+/* Attaches 'buf' as the statevector, once the previous one is freed */
+static void state_replace (void *buf, bool mapped)
+{
+  bool single = main_stage.amp_size == sizeof (scomplex);
+
+  FLA_Obj_create_without_buffer (single ? FLA_COMPLEX : FLA_DOUBLE_COMPLEX,
+                                 main_stage.state_space, 1, &main_stage.statevector);
+  FLA_Obj_attach_buffer (buf, 1, main_stage.state_space, &main_stage.statevector);
+  main_stage.state_mapped = mapped;
+}
+
+/*
+Loads snapshot 'path' as the state after the steps staged so far. As after a
+measurement, those steps can no longer be edited, and steps staged afterwards
+act on the loaded state.
+
+Notes:
+ - The snapshot must come from a stage of the same backend, register size and
+   precision.
+ - Raw snapshots are mapped copy on write as the statevector, and read only as
+   the base checkpoint, so nothing is read or copied up front: pages fault in
+   from the file as they are used. The file must not change while loaded.
+ - With config.state_dir set, or for block snapshots, amplitudes are read into
+   a new statevector and the base checkpoint is a copy in memory.
+*/
+void FQAM_snapshot_load (const char *path)
+{
+  check_backend ();
+
+  int fd = open (path, O_RDONLY);
+  struct stat st;
+  snapshot_header h;
+
+  assertf (fd >= 0, "Error: Failed to open snapshot %s", path);
+  assertf (fstat (fd, &st) == 0 && (size_t)st.st_size >= SNAPSHOT_HEADER_SIZE,
+           "Error: Snapshot %s is truncated", path);
+  read_full (fd, &h, sizeof (h), 0, path);
+
+  size_t bytes = main_stage.state_space * main_stage.amp_size;
+
+  assertf (memcmp (h.magic, SNAPSHOT_MAGIC, sizeof (h.magic)) == 0,
+           "Error: %s is not a snapshot", path);
+  assertf (h.version == SNAPSHOT_VERSION, "Error: Snapshot %s has unsupported version %u",
+           path, h.version);
+  assertf (h.backend == main_stage.config.backend && h.num_qubits == main_stage.dim,
+           "Error: Snapshot %s is of another backend or register size", path);
+  assertf (h.amp_size == main_stage.amp_size && h.state_space == main_stage.state_space,
+           "Error: Snapshot %s is of another precision", path);
+
+  bool raw = h.encoding == FQAM_SNAPSHOT_RAW;
+
+  assertf (raw || h.encoding == FQAM_SNAPSHOT_BLOCKS, "Error: Snapshot %s is corrupt",
+           path);
+  assertf (!raw || (h.data_offset <= (size_t)st.st_size &&
+                    bytes <= (size_t)st.st_size - h.data_offset),
+           "Error: Snapshot %s is truncated", path);
+
+  void *base = NULL;
+
+  stage_state_free ();
+
+  if (raw && main_stage.config.state_dir == NULL &&
+      h.data_offset % sysconf (_SC_PAGESIZE) == 0)
+  {
+    void *buf = mmap (NULL, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd,
+                      h.data_offset);
+    base = mmap (NULL, bytes, PROT_READ, MAP_PRIVATE, fd, h.data_offset);
+
+    assertf (buf != MAP_FAILED && base != MAP_FAILED,
+             "Error: Failed to map snapshot %s", path);
+    state_replace (buf, true);
+  }
+  else
+  {
+    void *buf = stage_state_alloc ();
+    bool mapped = main_stage.state_mapped;
+
+    if (raw)
+      read_full (fd, buf, bytes, h.data_offset, path);
+    else
+      blocks_read (fd, buf, bytes, &h, st.st_size, path);
+
+    state_replace (buf, mapped);
+  }
+
+  close (fd);
+
+  main_stage.computed_steps = main_stage.stage->size;
+  if (base)
+    stage_rebase_onto (base, true);
+  else
+    stage_rebase ();
+}
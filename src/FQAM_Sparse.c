@@ -0,0 +1,538 @@
+/*
+    Copyright (C) 2024, Chuck Garcia
+
+    This file is part of libfqam and is available under the 3-Clause
+    BSD license, which can be found in the LICENSE file at the top-level
+    directory, or at http://opensource.org/licenses/BSD-3-Clause
+*/
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "FQAM.h"
+#include "__FQAM_Stage.h"
+#include "__kernels.h"
+#include "arraylist.h"
+#include "assertf.h"
+
+/*
+Sparse backend (FQAM_BACKEND_SPARSE). The state is kept as its nonzero
+amplitudes, sorted by basis index, so that a step costs time proportional to the
+number of nonzero amplitudes rather than to 2^n. Circuits starting from a basis
+state often stay sparse for their first layers (permutations, phases, a few
+Hadamards), which lets registers far past memory for a dense statevector start
+cheaply.
+
+Once the nonzero fraction of the state crosses config.sparse_density, or a whole
+register operator is staged, the backend densifies for good: the sparse state
+is scattered into a statevector, which continues the stage from there.
+*/
+
+/* Amplitudes of smaller squared magnitude are dropped from the sparse state */
+#define SPARSE_DROP_TOL 1e-30
+
+/* Shots per PRNG stream in sparse_sample */
+#define SPARSE_SAMPLE_BLOCK 256
+
+/* Amplitude of basis index 'rest' with target bits 'local', see apply_gate */
+typedef struct
+{
+  uint64_t rest;
+  uint64_t local;
+  dcomplex amp;
+} sparse_group_entry;
+
+static void state_reserve (sparse_state *s, size_t capacity)
+{
+  if (capacity <= s->capacity)
+    return;
+
+  s->entries = realloc (s->entries, capacity * sizeof (sparse_entry));
+  assertf (s->entries, "Error: Failed to allocate %zu sparse amplitudes", capacity);
+  s->capacity = capacity;
+}
+
+static void state_copy (sparse_state *dst, const sparse_state *src)
+{
+  state_reserve (dst, src->size);
+  memcpy (dst->entries, src->entries, src->size * sizeof (sparse_entry));
+  dst->size = src->size;
+}
+
+static void state_free (sparse_state *s)
+{
+  free (s->entries);
+  memset (s, 0, sizeof (sparse_state));
+}
+
+static int compare_index (const void *a, const void *b)
+{
+  uint64_t x = ((const sparse_entry *)a)->index, y = ((const sparse_entry *)b)->index;
+  return (x > y) - (x < y);
+}
+
+static int compare_rest (const void *a, const void *b)
+{
+  const sparse_group_entry *x = a, *y = b;
+
+  if (x->rest != y->rest)
+    return (x->rest > y->rest) - (x->rest < y->rest);
+  return (x->local > y->local) - (x->local < y->local);
+}
+
+static inline double norm2 (dcomplex a) { return a.real * a.real + a.imag * a.imag; }
+
+/* Sorts entries by index, summing entries of equal index and dropping those of
+ * negligible weight */
+static void state_normalize (sparse_state *s, bool sorted)
+{
+  size_t n = 0;
+
+  if (!sorted)
+    qsort (s->entries, s->size, sizeof (sparse_entry), compare_index);
+
+  for (size_t i = 0; i < s->size; i++)
+  {
+    sparse_entry e = s->entries[i];
+
+    while (i + 1 < s->size && s->entries[i + 1].index == e.index)
+    {
+      i++;
+      e.amp.real += s->entries[i].amp.real;
+      e.amp.imag += s->entries[i].amp.imag;
+    }
+
+    if (norm2 (e.amp) >= SPARSE_DROP_TOL)
+      s->entries[n++] = e;
+  }
+  s->size = n;
+}
+
+/* Returns the entry of basis index 'index', or NULL if its amplitude is zero */
+static const sparse_entry *state_find (const sparse_state *s, uint64_t index)
+{
+  size_t lo = 0, hi = s->size;
+
+  while (lo < hi)
+  {
+    size_t mid = lo + (hi - lo) / 2;
+
+    if (s->entries[mid].index < index)
+      lo = mid + 1;
+    else
+      hi = mid;
+  }
+  return lo < s->size && s->entries[lo].index == index ? &s->entries[lo] : NULL;
+}
+
+/* Bits of 'targets' in 'index', bit j holding targets[j] */
+static inline uint64_t gather_bits (uint64_t index, const int *targets, int num_targets)
+{
+  uint64_t local = 0;
+
+  for (int j = 0; j < num_targets; j++)
+    local |= ((index >> targets[j]) & 1) << j;
+  return local;
+}
+
+/* Index with target bits 'local' spread onto 'targets' over 'rest' */
+static inline uint64_t scatter_bits (uint64_t rest, uint64_t local, const int *targets,
+                                     int num_targets)
+{
+  for (int j = 0; j < num_targets; j++)
+    rest |= ((local >> j) & 1) << targets[j];
+  return rest;
+}
+
+static inline dcomplex cmul (dcomplex a, dcomplex b)
+{
+  return (dcomplex){a.real * b.real - a.imag * b.imag, a.real * b.imag + a.imag * b.real};
+}
+
+/* Returns true if the d x d column major 'u' is diagonal */
+static bool is_diagonal (const dcomplex *u, dim_t cs, int d)
+{
+  for (int c = 0; c < d; c++)
+    for (int r = 0; r < d; r++)
+      if (r != c && (u[r + c * cs].real != 0.0 || u[r + c * cs].imag != 0.0))
+        return false;
+  return true;
+}
+
+/*
+Applies operator U to 'targets' of the sparse state. Diagonal operators scale
+amplitudes in place. Otherwise amplitudes are grouped by their bits outside of
+'targets', each group being a vector of at most 2^k entries that U maps to the
+amplitudes of the same group, so a gate costs O(m log m + m 2^k) for m nonzero
+amplitudes.
+*/
+static void apply_gate (sparse_state *s, FLA_Obj U, const int *targets, int num_targets)
+{
+  const dcomplex *u = FLA_Obj_buffer_at_view (U);
+  dim_t cs = FLA_Obj_col_stride (U);
+  int d = 1 << num_targets;
+  uint64_t mask = scatter_bits (0, d - 1, targets, num_targets);
+
+  if (is_diagonal (u, cs, d))
+  {
+    for (size_t i = 0; i < s->size; i++)
+    {
+      uint64_t local = gather_bits (s->entries[i].index, targets, num_targets);
+      s->entries[i].amp = cmul (u[local + local * cs], s->entries[i].amp);
+    }
+    state_normalize (s, true);
+    return;
+  }
+
+  sparse_group_entry *groups = malloc (s->size * sizeof (sparse_group_entry));
+  dcomplex *v = malloc (d * sizeof (dcomplex));
+  bool *present = malloc (d * sizeof (bool));
+  size_t num_groups = 0;
+
+  assertf (groups && v && present, "Error: Failed to allocate sparse gate");
+
+  for (size_t i = 0; i < s->size; i++)
+    groups[i] = (sparse_group_entry){s->entries[i].index & ~mask,
+                                     gather_bits (s->entries[i].index, targets,
+                                                  num_targets),
+                                     s->entries[i].amp};
+  qsort (groups, s->size, sizeof (sparse_group_entry), compare_rest);
+
+  for (size_t i = 0; i < s->size; i++)
+    if (i == 0 || groups[i].rest != groups[i - 1].rest)
+      num_groups++;
+
+  // Every group fills at most d amplitudes
+  sparse_state out = {0};
+  state_reserve (&out, num_groups * d);
+
+  for (size_t begin = 0, end; begin < s->size; begin = end)
+  {
+    memset (v, 0, d * sizeof (dcomplex));
+    memset (present, 0, d * sizeof (bool));
+
+    for (end = begin; end < s->size && groups[end].rest == groups[begin].rest; end++)
+    {
+      v[groups[end].local] = groups[end].amp;
+      present[groups[end].local] = true;
+    }
+
+    for (int r = 0; r < d; r++)
+    {
+      dcomplex a = {0.0, 0.0};
+
+      for (int c = 0; c < d; c++)
+        if (present[c])
+        {
+          dcomplex p = cmul (u[r + c * cs], v[c]);
+          a.real += p.real;
+          a.imag += p.imag;
+        }
+
+      if (norm2 (a) >= SPARSE_DROP_TOL)
+        out.entries[out.size++] =
+            (sparse_entry){scatter_bits (groups[begin].rest, r, targets, num_targets), a};
+    }
+  }
+
+  // Groups are disjoint, so indices are distinct
+  state_free (s);
+  *s = out;
+  state_normalize (s, false);
+
+  free (groups);
+  free (v);
+  free (present);
+}
+
+/*
+Applies rotation e^{-i theta P} = cos(theta) I - i sin(theta) P, where
+P|b> = i^{|x & z|} (-1)^{|b & z|} |b ^ x> (see kernel_pauli_rotation.c)
+*/
+static void apply_rotation (sparse_state *s, const FQAM_Pauli_term *r)
+{
+  double c = cos (r->coeff), sn = sin (r->coeff);
+
+  // -i i^{|x & z|} sin(theta)
+  int e = (__builtin_popcountll (r->x_mask & r->z_mask) + 3) & 3;
+  dcomplex k = {e == 0 ? sn : e == 2 ? -sn : 0.0, e == 1 ? sn : e == 3 ? -sn : 0.0};
+
+  if (r->x_mask == 0)
+  {
+    // Diagonal: a *= cos(theta) + k (-1)^{|b & z|}
+    for (size_t i = 0; i < s->size; i++)
+    {
+      double sign = __builtin_parityll (s->entries[i].index & r->z_mask) ? -1.0 : 1.0;
+      dcomplex f = {c + sign * k.real, sign * k.imag};
+      s->entries[i].amp = cmul (f, s->entries[i].amp);
+    }
+    state_normalize (s, true);
+    return;
+  }
+
+  size_t n = s->size;
+  state_reserve (s, 2 * n);
+
+  for (size_t i = 0; i < n; i++)
+  {
+    sparse_entry *b = &s->entries[i];
+    double sign = __builtin_parityll (b->index & r->z_mask) ? -1.0 : 1.0;
+    dcomplex f = {sign * k.real, sign * k.imag};
+
+    s->entries[n + i] = (sparse_entry){b->index ^ r->x_mask, cmul (f, b->amp)};
+    b->amp.real *= c;
+    b->amp.imag *= c;
+  }
+
+  s->size = 2 * n;
+  state_normalize (s, false);
+}
+
+/* Applies 'step' to the sparse state. Returns false, leaving the state as is, if
+ * the step spans the whole register */
+static bool apply_step (sparse_state *s, stage_step *step)
+{
+  assertf (step->kind != STEP_CHANNEL,
+           "Error: Noise channels need the density matrix backend or trajectories");
+
+  if (step->kind == STEP_PAULI)
+  {
+    for (int r = 0; r < step->num_rotations; r++)
+      apply_rotation (s, &step->rotations[r]);
+    return true;
+  }
+
+  if (step->kind == STEP_OPERATOR && step->num_targets == 0)
+    return false;
+
+  for (int i = 0; i < stage_step_size (step); i++)
+  {
+    const int *targets;
+    int num_targets;
+    FQAM_Op *op = stage_step_gate (step, i, &targets, &num_targets);
+
+    apply_gate (s, op->mat_repr, targets, num_targets);
+  }
+  return true;
+}
+
+void sparse_create (void)
+{
+  stage_sparse *sp = &main_stage.sparse;
+
+  memset (sp, 0, sizeof (stage_sparse));
+  state_reserve (&sp->base, 1);
+  sp->base.entries[0] = (sparse_entry){main_stage.initial_state, {1.0, 0.0}};
+  sp->base.size = 1;
+  state_copy (&sp->state, &sp->base);
+}
+
+void sparse_free (void)
+{
+  state_free (&main_stage.sparse.state);
+  state_free (&main_stage.sparse.base);
+  memset (&main_stage.sparse, 0, sizeof (stage_sparse));
+}
+
+/* Writes sparse state 's' into the zeroed statevector buffer 'buf' */
+static void scatter (const sparse_state *s, void *buf)
+{
+  bool single = kernel_is_single (main_stage.statevector);
+
+  for (size_t i = 0; i < s->size; i++)
+    kernel_amp_set (buf, s->entries[i].index, s->entries[i].amp, single);
+}
+
+/* Switches to a statevector holding the sparse state. A collapsed base state is
+ * kept as the base checkpoint of the statevector */
+static void sparse_densify (void)
+{
+  stage_sparse *sp = &main_stage.sparse;
+  void *buf = stage_state_alloc ();
+
+  FLA_Obj_attach_buffer (buf, 1, main_stage.state_space, &main_stage.statevector);
+
+  if (main_stage.base_step > 0)
+  {
+    scatter (&sp->base, buf);
+    main_stage.computed_steps = main_stage.base_step;
+    stage_rebase ();
+    memset (buf, 0, main_stage.state_space * main_stage.amp_size);
+  }
+
+  scatter (&sp->state, buf);
+  main_stage.computed_steps = sp->computed_steps;
+  main_stage.state_version++;
+
+  state_free (&sp->state);
+  state_free (&sp->base);
+  sp->dense = true;
+}
+
+/*
+Brings the sparse backend to the state after 'step' staged steps. Steps are
+applied to the sparse state until it grows past config.sparse_density of the
+state space or reaches a whole register operator, from where a statevector
+continues the stage for good.
+*/
+void sparse_seek (size_t step)
+{
+  stage_sparse *sp = &main_stage.sparse;
+  double limit = main_stage.config.sparse_density * main_stage.state_space;
+
+  assertf (main_stage.config.backend == FQAM_BACKEND_SPARSE,
+           "Error: Expected sparse backend");
+  assertf (step <= main_stage.stage->size, "Error: Seek to step %zu past stage", step);
+  assertf (step >= main_stage.base_step,
+           "Error: Seek to step %zu precedes last measurement", step);
+
+  if (sp->dense)
+  {
+    stage_seek (step);
+    return;
+  }
+
+  if (sp->computed_steps > step)
+  {
+    state_copy (&sp->state, &sp->base);
+    sp->computed_steps = main_stage.base_step;
+  }
+
+  while (sp->computed_steps < step)
+  {
+    if (!apply_step (&sp->state, stage_get (sp->computed_steps)))
+    {
+      sparse_densify ();
+      stage_seek (step);
+      return;
+    }
+
+    sp->computed_steps++;
+
+    if (sp->state.size > limit)
+    {
+      sparse_densify ();
+      stage_seek (step);
+      return;
+    }
+  }
+}
+
+/* Returns true if the sparse backend holds the final state in its sparse state,
+ * i.e. it has not densified. Call after FQAM_compute_outcomes */
+bool sparse_active (void)
+{
+  return main_stage.config.backend == FQAM_BACKEND_SPARSE && !main_stage.sparse.dense;
+}
+
+/* Marginal distribution of 'qubits' from the sparse state, see FQAM_marginal */
+void sparse_marginal (const int *qubits, int num_qubits, double *probs)
+{
+  const sparse_state *s = &main_stage.sparse.state;
+
+  memset (probs, 0, (1UL << num_qubits) * sizeof (double));
+  for (size_t i = 0; i < s->size; i++)
+    probs[gather_bits (s->entries[i].index, qubits, num_qubits)] += norm2 (s->entries[i].amp);
+}
+
+/* Projects the sparse state onto 'outcome' of probability 'p', see
+ * FQAM_collapse. The collapsed state becomes the base step of the stage */
+void sparse_collapse (const int *qubits, int num_qubits, unsigned long outcome, double p)
+{
+  stage_sparse *sp = &main_stage.sparse;
+  double scale = 1.0 / sqrt (p);
+  size_t n = 0;
+
+  for (size_t i = 0; i < sp->state.size; i++)
+  {
+    sparse_entry e = sp->state.entries[i];
+
+    if (gather_bits (e.index, qubits, num_qubits) != outcome)
+      continue;
+
+    e.amp.real *= scale;
+    e.amp.imag *= scale;
+    sp->state.entries[n++] = e;
+  }
+  sp->state.size = n;
+
+  state_copy (&sp->base, &sp->state);
+  main_stage.base_step = sp->computed_steps;
+  main_stage.state_version++;
+}
+
+/* Draws measurement outcomes of all qubits from the sparse state, see
+ * FQAM_sample. Each shot is a binary search of the cumulative distribution */
+void sparse_sample (size_t shots, uint64_t seed, unsigned long *outcomes)
+{
+  const sparse_state *s = &main_stage.sparse.state;
+  size_t blocks = (shots + SPARSE_SAMPLE_BLOCK - 1) / SPARSE_SAMPLE_BLOCK;
+  double *cdf = malloc (s->size * sizeof (double)), total = 0.0;
+
+  assertf (cdf, "Error: Failed to allocate sampling table");
+  for (size_t i = 0; i < s->size; i++)
+    cdf[i] = total += norm2 (s->entries[i].amp);
+
+#pragma omp parallel for schedule(static)
+  for (size_t b = 0; b < blocks; b++)
+  {
+    FQAM_Rng rng;
+    size_t end = min ((b + 1) * SPARSE_SAMPLE_BLOCK, shots);
+
+    FQAM_Rng_init (&rng, seed, b);
+
+    for (size_t shot = b * SPARSE_SAMPLE_BLOCK; shot < end; shot++)
+    {
+      double u = FQAM_Rng_uniform (&rng) * total;
+      size_t lo = 0, hi = s->size - 1;
+
+      while (lo < hi)
+      {
+        size_t mid = lo + (hi - lo) / 2;
+
+        if (cdf[mid] <= u)
+          lo = mid + 1;
+        else
+          hi = mid;
+      }
+      outcomes[shot] = s->entries[lo].index;
+    }
+  }
+
+  free (cdf);
+}
+
+/* Returns <P> for Pauli string 'term' (without its coefficient) from the sparse
+ * state, looking up the partner b ^ x of every nonzero amplitude b */
+double sparse_expectation (const FQAM_Pauli_term *term)
+{
+  const sparse_state *s = &main_stage.sparse.state;
+  int e = __builtin_popcountll (term->x_mask & term->z_mask) & 3;
+  dcomplex sum = {0.0, 0.0};
+
+  for (size_t i = 0; i < s->size; i++)
+  {
+    const sparse_entry *b = &s->entries[i];
+    const sparse_entry *a = state_find (s, b->index ^ term->x_mask);
+
+    if (a == NULL)
+      continue;
+
+    // conj(psi[b ^ x]) (-1)^{|b & z|} psi[b]
+    double sign = __builtin_parityll (b->index & term->z_mask) ? -1.0 : 1.0;
+    dcomplex p = cmul ((dcomplex){a->amp.real, -a->amp.imag}, b->amp);
+
+    sum.real += sign * p.real;
+    sum.imag += sign * p.imag;
+  }
+
+  // Times i^{|x & z|}, real for Hermitian P
+  switch (e)
+  {
+  case 0: return sum.real;
+  case 1: return -sum.imag;
+  case 2: return -sum.real;
+  default: return sum.imag;
+  }
+}
@@ -0,0 +1,610 @@
+/*
+    Copyright (C) 2024, Chuck Garcia
+
+    This file is part of libfqam and is available under the 3-Clause
+    BSD license, which can be found in the LICENSE file at the top-level
+    directory, or at http://opensource.org/licenses/BSD-3-Clause
+*/
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "FQAM.h"
+#include "__FQAM_Stage.h"
+#include "arraylist.h"
+#include "assertf.h"
+
+/* Operators on more targets are not tested for being Clifford, and fall back
+ * to the statevector */
+#define STABILIZER_MAX_TARGETS 4
+
+/* Tolerance of Clifford detection on operator entries */
+#define CLIFFORD_TOL 1e-9
+
+/* Shots per PRNG stream in stabilizer_sample */
+#define STABILIZER_SAMPLE_BLOCK 256
+
+/* Images U P U^H of the local generators X_0..X_{k-1}, Z_0..Z_{k-1} under a
+ * Clifford operator U on k qubits, as signed Pauli strings in standard form */
+typedef struct
+{
+  int k;
+  uint64_t x[2 * STABILIZER_MAX_TARGETS];
+  uint64_t z[2 * STABILIZER_MAX_TARGETS];
+  int sign[2 * STABILIZER_MAX_TARGETS];
+} clifford_map;
+
+static inline uint64_t *row_x (const tableau *t, size_t i)
+{
+  return t->rows + 2 * i * t->words;
+}
+
+static inline uint64_t *row_z (const tableau *t, size_t i)
+{
+  return t->rows + (2 * i + 1) * t->words;
+}
+
+static inline int get_bit (const uint64_t *w, size_t q)
+{
+  return (w[q >> 6] >> (q & 63)) & 1;
+}
+
+static inline void set_bit (uint64_t *w, size_t q, int bit)
+{
+  w[q >> 6] = (w[q >> 6] & ~(1ULL << (q & 63))) | ((uint64_t)bit << (q & 63));
+}
+
+static void tableau_alloc (tableau *t, size_t n)
+{
+  t->n = n;
+  t->words = (n + 63) / 64;
+  t->rows = calloc ((2 * n + 1) * 2 * t->words, sizeof (uint64_t));
+  t->signs = calloc (2 * n + 1, 1);
+  assertf (t->rows && t->signs, "Error: Failed to allocate stabilizer tableau");
+}
+
+static void tableau_copy (tableau *dst, const tableau *src)
+{
+  memcpy (dst->rows, src->rows, (2 * src->n + 1) * 2 * src->words * sizeof (uint64_t));
+  memcpy (dst->signs, src->signs, 2 * src->n + 1);
+}
+
+static void tableau_free (tableau *t)
+{
+  free (t->rows);
+  free (t->signs);
+  memset (t, 0, sizeof (tableau));
+}
+
+/*
+Sets row h to the product P_i P_h of rows i and h, word by word.
+
+The phase picked up at each qubit, a power of i in {-1, 0, 1} (see Aaronson and
+Gottesman, "Improved simulation of stabilizer circuits", 2004), is found for 64
+qubits at once as masks of the qubits contributing +1 and -1.
+*/
+static void tableau_rowsum (tableau *t, size_t h, size_t i)
+{
+  uint64_t *xh = row_x (t, h), *zh = row_z (t, h);
+  const uint64_t *xi = row_x (t, i), *zi = row_z (t, i);
+  long phase = 2 * t->signs[h] + 2 * t->signs[i];
+
+  for (size_t w = 0; w < t->words; w++)
+  {
+    uint64_t x1 = xi[w], z1 = zi[w], x2 = xh[w], z2 = zh[w];
+    uint64_t plus = (x1 & z1 & z2 & ~x2) | (x1 & ~z1 & x2 & z2) | (~x1 & z1 & x2 & ~z2);
+    uint64_t minus = (x1 & z1 & x2 & ~z2) | (x1 & ~z1 & ~x2 & z2) | (~x1 & z1 & x2 & z2);
+
+    phase += __builtin_popcountll (plus) - __builtin_popcountll (minus);
+    xh[w] = x1 ^ x2;
+    zh[w] = z1 ^ z2;
+  }
+
+  t->signs[h] = (phase & 3) == 2;
+}
+
+/* Clears row i to the identity */
+static void tableau_row_clear (tableau *t, size_t i)
+{
+  memset (row_x (t, i), 0, 2 * t->words * sizeof (uint64_t));
+  t->signs[i] = 0;
+}
+
+/* Resets tableau to basis state 'state' (qubits past 64 in |0>) */
+static void tableau_reset (tableau *t, uint64_t state)
+{
+  size_t n = t->n;
+
+  memset (t->rows, 0, (2 * n + 1) * 2 * t->words * sizeof (uint64_t));
+  memset (t->signs, 0, 2 * n + 1);
+
+  // Destabilizers X_q, stabilizers (-1)^{b_q} Z_q
+  for (size_t q = 0; q < n; q++)
+  {
+    set_bit (row_x (t, q), q, 1);
+    set_bit (row_z (t, n + q), q, 1);
+    t->signs[n + q] = q < 64 ? (state >> q) & 1 : 0;
+  }
+}
+
+/* Multiplies i^e X^x Z^z by i^{e2} X^{x2} Z^{z2} on the right */
+static inline void xz_multiply (int *e, uint64_t *x, uint64_t *z, int e2, uint64_t x2,
+                                uint64_t z2)
+{
+  // Z^z X^{x2} = (-1)^{|z & x2|} X^{x2} Z^z
+  *e += e2 + 2 * __builtin_popcountll (*z & x2);
+  *x ^= x2;
+  *z ^= z2;
+}
+
+/*
+Conjugates every row of 't' by Clifford 'map' acting on qubits 'targets'. The
+part P = i^{|x & z|} X^x Z^z of a row on the targets maps to the ordered product
+of generator images, the rest of the row being unchanged.
+*/
+static void tableau_apply (tableau *t, const clifford_map *map, const int *targets)
+{
+  int k = map->k, e_image[2 * STABILIZER_MAX_TARGETS];
+
+  // Images in X^x Z^z form: s sigma(x, z) = i^{2 [s < 0] + |x & z|} X^x Z^z
+  for (int g = 0; g < 2 * k; g++)
+    e_image[g] = 2 * map->sign[g] + __builtin_popcountll (map->x[g] & map->z[g]);
+
+#pragma omp parallel for schedule(static) if (t->n > 1024)
+  for (size_t i = 0; i < 2 * t->n; i++)
+  {
+    uint64_t *xr = row_x (t, i), *zr = row_z (t, i);
+    uint64_t lx = 0, lz = 0, x = 0, z = 0;
+    int e;
+
+    for (int j = 0; j < k; j++)
+    {
+      lx |= (uint64_t)get_bit (xr, targets[j]) << j;
+      lz |= (uint64_t)get_bit (zr, targets[j]) << j;
+    }
+
+    if ((lx | lz) == 0)
+      continue;
+
+    e = __builtin_popcountll (lx & lz);
+    for (int j = 0; j < k; j++)
+      if ((lx >> j) & 1)
+        xz_multiply (&e, &x, &z, e_image[j], map->x[j], map->z[j]);
+    for (int j = 0; j < k; j++)
+      if ((lz >> j) & 1)
+        xz_multiply (&e, &x, &z, e_image[k + j], map->x[k + j], map->z[k + j]);
+
+    // Back to standard form; the result is Hermitian, so the phase is +-1
+    e -= __builtin_popcountll (x & z);
+    t->signs[i] ^= (e & 3) == 2;
+
+    for (int j = 0; j < k; j++)
+    {
+      set_bit (xr, targets[j], (x >> j) & 1);
+      set_bit (zr, targets[j], (z >> j) & 1);
+    }
+  }
+}
+
+/*
+Measures qubit q in the computational basis, collapsing 't'.
+
+Arguments:
+    forced: Outcome to project onto when the outcome is random, or -1 to draw it
+            from 'rng'
+    prob: Probability of the returned outcome (1/2 or 1), or 0 if 'forced'
+          contradicts a deterministic outcome
+
+Returns:
+    Measured outcome
+*/
+static int tableau_measure (tableau *t, size_t q, int forced, FQAM_Rng *rng, double *prob)
+{
+  size_t n = t->n, p;
+  int outcome;
+
+  for (p = n; p < 2 * n; p++)
+    if (get_bit (row_x (t, p), q))
+      break;
+
+  // Deterministic: Z_q is +-(product of stabilizers), found in the scratch row
+  if (p == 2 * n)
+  {
+    tableau_row_clear (t, 2 * n);
+    for (size_t i = 0; i < n; i++)
+      if (get_bit (row_x (t, i), q))
+        tableau_rowsum (t, 2 * n, i + n);
+
+    outcome = t->signs[2 * n];
+    *prob = forced < 0 || forced == outcome ? 1.0 : 0.0;
+    return outcome;
+  }
+
+  // Random: stabilizer p anticommutes with Z_q and is replaced by +-Z_q
+  for (size_t i = 0; i < 2 * n; i++)
+    if (i != p && get_bit (row_x (t, i), q))
+      tableau_rowsum (t, i, p);
+
+  outcome = forced >= 0 ? forced : FQAM_Rng_u32 (rng) & 1;
+
+  memcpy (row_x (t, p - n), row_x (t, p), 2 * t->words * sizeof (uint64_t));
+  t->signs[p - n] = t->signs[p];
+  tableau_row_clear (t, p);
+  set_bit (row_z (t, p), q, 1);
+  t->signs[p] = outcome;
+
+  *prob = 0.5;
+  return outcome;
+}
+
+/* Loads 2^k x 2^k operator into row major buffer 'u' */
+static void load_operator (FLA_Obj U, int k, dcomplex *u)
+{
+  const dcomplex *buf = FLA_Obj_buffer_at_view (U);
+  dim_t rs = FLA_Obj_row_stride (U), cs = FLA_Obj_col_stride (U);
+  int d = 1 << k;
+
+  for (int r = 0; r < d; r++)
+    for (int c = 0; c < d; c++)
+      u[r * d + c] = buf[r * rs + c * cs];
+}
+
+/* Returns true if |a - b| is within tolerance */
+static inline bool near (dcomplex a, double re, double im)
+{
+  return fabs (a.real - re) < CLIFFORD_TOL && fabs (a.imag - im) < CLIFFORD_TOL;
+}
+
+/* Returns true if 2^k x 2^k row major 'm' is s sigma(x, z), storing s, x and z.
+ * sigma(x, z) has entry i^{|x & z|} (-1)^{|b & z|} at (b ^ x, b) */
+static bool match_pauli (const dcomplex *m, int k, uint64_t *x, uint64_t *z, int *sign)
+{
+  int d = 1 << k;
+  dcomplex v, phase;
+
+  for (*x = 0; *x < (uint64_t)d; (*x)++)
+    if (fabs (m[*x * d].real) + fabs (m[*x * d].imag) > 0.5)
+      break;
+  if (*x == (uint64_t)d)
+    return false;
+
+  *z = 0;
+  for (int j = 0; j < k; j++)
+  {
+    uint64_t b = 1ULL << j;
+    v = m[(b ^ *x) * d + b];
+    if (!near (v, m[*x * d].real, m[*x * d].imag))
+      *z |= b;
+  }
+
+  // Entry at column 0 is s i^{|x & z|}
+  phase = m[*x * d];
+  switch (__builtin_popcountll (*x & *z) & 3)
+  {
+  case 0: v = phase; break;
+  case 1: v = (dcomplex){phase.imag, -phase.real}; break;
+  case 2: v = (dcomplex){-phase.real, -phase.imag}; break;
+  default: v = (dcomplex){-phase.imag, phase.real}; break;
+  }
+  if (!near (v, 1.0, 0.0) && !near (v, -1.0, 0.0))
+    return false;
+  *sign = v.real < 0;
+
+  for (int b = 0; b < d; b++)
+    for (int r = 0; r < d; r++)
+    {
+      double s = __builtin_parityll (b & *z) ? -1.0 : 1.0;
+      if (r == (int)(b ^ *x) ? !near (m[r * d + b], s * phase.real, s * phase.imag)
+                             : !near (m[r * d + b], 0.0, 0.0))
+        return false;
+    }
+
+  return true;
+}
+
+/*
+Tests whether operator U on k qubits is Clifford, i.e. unitary and mapping every
+Pauli string to a signed Pauli string under conjugation, storing the images of
+the generators into 'map'.
+*/
+static bool clifford_classify (FLA_Obj U, int k, clifford_map *map)
+{
+  if (k > STABILIZER_MAX_TARGETS)
+    return false;
+
+  int d = 1 << k;
+  dcomplex *u = malloc (2 * d * d * sizeof (dcomplex));
+  dcomplex *m = u + d * d;
+  bool clifford = true;
+
+  assertf (u, "Error: Failed to allocate Clifford test");
+  load_operator (U, k, u);
+  map->k = k;
+
+  // Generator g: X_g for g < k, Z_{g - k} otherwise. Identity for g = 2k, as a
+  // unitarity check
+  for (int g = 0; g <= 2 * k && clifford; g++)
+  {
+    uint64_t flip = g < k ? 1ULL << g : 0;
+    uint64_t phase = g >= k && g < 2 * k ? 1ULL << (g - k) : 0;
+
+    // m = U G U^H, G |a> = (-1)^{|a & phase|} |a ^ flip>
+    for (int r = 0; r < d; r++)
+      for (int c = 0; c < d; c++)
+      {
+        double re = 0.0, im = 0.0;
+        for (int a = 0; a < d; a++)
+        {
+          dcomplex ur = u[r * d + (a ^ flip)], uc = u[c * d + a];
+          double s = __builtin_parityll (a & phase) ? -1.0 : 1.0;
+          re += s * (ur.real * uc.real + ur.imag * uc.imag);
+          im += s * (ur.imag * uc.real - ur.real * uc.imag);
+        }
+        m[r * d + c] = (dcomplex){re, im};
+      }
+
+    if (g == 2 * k)
+    {
+      uint64_t x, z;
+      int sign;
+      clifford = match_pauli (m, k, &x, &z, &sign) && x == 0 && z == 0 && !sign;
+    }
+    else
+      clifford = match_pauli (m, k, &map->x[g], &map->z[g], &map->sign[g]);
+  }
+
+  free (u);
+  return clifford;
+}
+
+/* Returns operator 'i' of 'step' and its targets if it is Clifford, NULL
+ * otherwise. Whole register operators target every qubit in order */
+static FQAM_Op *step_clifford_gate (stage_step *step, int i, int *targets,
+                                    clifford_map *map)
+{
+  const int *step_targets;
+  int num_targets;
+  FQAM_Op *op;
+
+  // Rotations on wide supports have no operator form
+  if (step->kind == STEP_PAULI && step->num_gates != step->num_rotations)
+    return NULL;
+
+  op = stage_step_gate (step, i, &step_targets, &num_targets);
+  if (num_targets == 0)
+  {
+    if (main_stage.dim > STABILIZER_MAX_TARGETS)
+      return NULL;
+    num_targets = main_stage.dim;
+    for (int j = 0; j < num_targets; j++)
+      targets[j] = j;
+  }
+  else
+    memcpy (targets, step_targets, num_targets * sizeof (int));
+
+  return clifford_classify (op->mat_repr, num_targets, map) ? op : NULL;
+}
+
+/*
+Returns true if every staged operator is Clifford (e.g. Hadamard, Pauli, S and
+CNOT), so that the stabilizer backend can run the stage on a tableau.
+*/
+bool FQAM_stage_is_clifford (void)
+{
+  assertf (FQAM_initialized (), "Error: Expected stage initialized");
+
+  for (size_t s = 0; s < main_stage.stage->size; s++)
+  {
+    stage_step *step = stage_get (s);
+    int targets[FQAM_MAX_TARGETS];
+    clifford_map map;
+
+    for (int i = 0; i < stage_step_size (step); i++)
+      if (!step_clifford_gate (step, i, targets, &map))
+        return false;
+  }
+
+  return true;
+}
+
+void stabilizer_create (void)
+{
+  tableau_alloc (&main_stage.stabilizer.state, main_stage.dim);
+  tableau_alloc (&main_stage.stabilizer.base, main_stage.dim);
+  tableau_reset (&main_stage.stabilizer.base, main_stage.initial_state);
+  tableau_copy (&main_stage.stabilizer.state, &main_stage.stabilizer.base);
+
+  main_stage.stabilizer.computed_steps = 0;
+  main_stage.stabilizer.fallback = false;
+}
+
+void stabilizer_free (void)
+{
+  tableau_free (&main_stage.stabilizer.state);
+  tableau_free (&main_stage.stabilizer.base);
+  memset (&main_stage.stabilizer, 0, sizeof (stage_stabilizer));
+}
+
+/* Switches to replaying the stage on a statevector */
+static void stabilizer_fall_back (void)
+{
+  assertf (main_stage.dim < 64, "Error: Non-Clifford stage on %zu qubits",
+           main_stage.dim);
+  assertf (main_stage.base_step == 0,
+           "Error: Non-Clifford stage after a stabilizer measurement");
+
+  void *buf = stage_state_alloc ();
+
+  FLA_Obj_attach_buffer (buf, 1, main_stage.state_space, &main_stage.statevector);
+  main_stage.computed_steps = SIZE_MAX;
+  main_stage.stabilizer.fallback = true;
+}
+
+/*
+Brings the stabilizer backend to the state after 'step' staged steps. Clifford
+steps are applied to the tableau in O(n) per operator. At the first non-Clifford
+step the backend falls back for good to a statevector, which replays the stage.
+*/
+void stabilizer_seek (size_t step)
+{
+  assertf (main_stage.config.backend == FQAM_BACKEND_STABILIZER,
+           "Error: Expected stabilizer backend");
+  assertf (step <= main_stage.stage->size, "Error: Seek to step %zu past stage", step);
+  assertf (step >= main_stage.base_step,
+           "Error: Seek to step %zu precedes last measurement", step);
+
+  if (main_stage.stabilizer.fallback)
+  {
+    stage_seek (step);
+    return;
+  }
+
+  if (main_stage.stabilizer.computed_steps > step)
+  {
+    tableau_copy (&main_stage.stabilizer.state, &main_stage.stabilizer.base);
+    main_stage.stabilizer.computed_steps = main_stage.base_step;
+  }
+
+  while (main_stage.stabilizer.computed_steps < step)
+  {
+    stage_step *s = stage_get (main_stage.stabilizer.computed_steps);
+    int targets[FQAM_MAX_TARGETS];
+    clifford_map map;
+
+    for (int i = 0; i < stage_step_size (s); i++)
+    {
+      if (!step_clifford_gate (s, i, targets, &map))
+      {
+        stabilizer_fall_back ();
+        stage_seek (step);
+        return;
+      }
+
+      tableau_apply (&main_stage.stabilizer.state, &map, targets);
+    }
+
+    main_stage.stabilizer.computed_steps++;
+  }
+}
+
+/* Returns true if the stabilizer backend holds the final state in its tableau,
+ * i.e. the stage is Clifford. Call after FQAM_compute_outcomes */
+bool stabilizer_active (void)
+{
+  return main_stage.config.backend == FQAM_BACKEND_STABILIZER &&
+         !main_stage.stabilizer.fallback;
+}
+
+/* Recursively branches on the outcomes of qubits[j..], see stabilizer_marginal */
+static void marginal_branch (tableau *t, const int *qubits, int num_qubits, int j,
+                             unsigned long prefix, double p, double *probs)
+{
+  if (j == num_qubits)
+  {
+    probs[prefix] += p;
+    return;
+  }
+
+  tableau branch = {0};
+  double q;
+
+  tableau_alloc (&branch, t->n);
+  for (int outcome = 0; outcome < 2; outcome++)
+  {
+    tableau_copy (&branch, t);
+    tableau_measure (&branch, qubits[j], outcome, NULL, &q);
+
+    if (q > 0.0)
+      marginal_branch (&branch, qubits, num_qubits, j + 1,
+                       prefix | ((unsigned long)outcome << j), p * q, probs);
+  }
+  tableau_free (&branch);
+}
+
+/* Marginal distribution of 'qubits' from the tableau, see FQAM_marginal.
+ * Probabilities of stabilizer states are 0 or powers of 1/2 */
+void stabilizer_marginal (const int *qubits, int num_qubits, double *probs)
+{
+  memset (probs, 0, (1UL << num_qubits) * sizeof (double));
+  marginal_branch (&main_stage.stabilizer.state, qubits, num_qubits, 0, 0, 1.0, probs);
+}
+
+/* Projects the tableau onto 'outcome' of 'qubits', see FQAM_collapse. The
+ * collapsed tableau becomes the base step of the stage */
+double stabilizer_collapse (const int *qubits, int num_qubits, unsigned long outcome)
+{
+  tableau *t = &main_stage.stabilizer.state;
+  double p = 1.0, q;
+
+  for (int j = 0; j < num_qubits; j++)
+  {
+    tableau_measure (t, qubits[j], (outcome >> j) & 1, NULL, &q);
+    p *= q;
+  }
+
+  assertf (p > 0.0, "Error: Collapse onto zero probability outcome");
+
+  tableau_copy (&main_stage.stabilizer.base, t);
+  main_stage.base_step = main_stage.stabilizer.computed_steps;
+  return p;
+}
+
+/* Draws measurement outcomes of all qubits from the tableau, see FQAM_sample.
+ * Each shot measures a copy of the tableau qubit by qubit */
+void stabilizer_sample (size_t shots, uint64_t seed, unsigned long *outcomes)
+{
+  size_t blocks = (shots + STABILIZER_SAMPLE_BLOCK - 1) / STABILIZER_SAMPLE_BLOCK;
+
+#pragma omp parallel for schedule(dynamic)
+  for (size_t b = 0; b < blocks; b++)
+  {
+    tableau t;
+    FQAM_Rng rng;
+    double p;
+    size_t end = min ((b + 1) * STABILIZER_SAMPLE_BLOCK, shots);
+
+    tableau_alloc (&t, main_stage.dim);
+    FQAM_Rng_init (&rng, seed, b);
+
+    for (size_t shot = b * STABILIZER_SAMPLE_BLOCK; shot < end; shot++)
+    {
+      tableau_copy (&t, &main_stage.stabilizer.state);
+      outcomes[shot] = 0;
+      for (size_t q = 0; q < main_stage.dim; q++)
+        outcomes[shot] |= (unsigned long)tableau_measure (&t, q, -1, &rng, &p) << q;
+    }
+
+    tableau_free (&t);
+  }
+}
+
+/*
+Returns <P> for Pauli string 'term' (without its coefficient) from the tableau:
+0 if P anticommutes with a stabilizer, otherwise +-1 as P is then, up to sign, the
+product of the stabilizers whose destabilizers anticommute with it.
+*/
+double stabilizer_expectation (const FQAM_Pauli_term *term)
+{
+  tableau *t = &main_stage.stabilizer.state;
+  size_t n = t->n;
+
+  // Parity of |x_P & z_i| + |z_P & x_i| over the first 64 qubits
+#define ANTICOMMUTES(i) __builtin_parityll ((term->x_mask & row_z (t, i)[0]) ^ \
+                                            (term->z_mask & row_x (t, i)[0]))
+
+  assertf (n >= 64 || ((term->x_mask | term->z_mask) >> n) == 0,
+           "Error: Pauli term acts outside of register");
+
+  for (size_t i = n; i < 2 * n; i++)
+    if (ANTICOMMUTES (i))
+      return 0.0;
+
+  tableau_row_clear (t, 2 * n);
+  for (size_t i = 0; i < n; i++)
+    if (ANTICOMMUTES (i))
+      tableau_rowsum (t, 2 * n, i + n);
+
+#undef ANTICOMMUTES
+
+  return t->signs[2 * n] ? -1.0 : 1.0;
+}
@@ -0,0 +1,338 @@
+/*
+    Copyright (C) 2024, Chuck Garcia
+
+    This file is part of libfqam and is available under the 3-Clause
+    BSD license, which can be found in the LICENSE file at the top-level
+    directory, or at http://opensource.org/licenses/BSD-3-Clause
+*/
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "FQAM.h"
+#include "__FQAM_Stage.h"
+#include "__kernels.h"
+#include "arraylist.h"
+#include "assertf.h"
+
+/* Tolerance for recognizing K^H K as a multiple of the identity */
+#define JUMP_FIXED_TOL 1e-12
+
+/*
+A trajectory evolves a pure state through the stage, replacing every channel by
+a quantum jump: Kraus operator K_i is drawn with probability
+p_i = |K_i psi|^2 and psi := K_i psi / sqrt(p_i). Averaging over trajectories
+reproduces sum_i K_i rho K_i^H, so only one statevector per thread is kept.
+*/
+
+/* Running mean and sum of squared deviations (Welford) */
+typedef struct
+{
+  size_t count;
+  double mean;
+  double m2;
+} running_stats;
+
+static void stats_add (running_stats *s, double x)
+{
+  double delta = x - s->mean;
+
+  s->count++;
+  s->mean += delta / s->count;
+  s->m2 += delta * (x - s->mean);
+}
+
+/* Folds 'b' into 'a' (Chan et al. pairwise update) */
+static void stats_merge (running_stats *a, const running_stats *b)
+{
+  size_t count = a->count + b->count;
+
+  if (b->count == 0)
+    return;
+
+  double delta = b->mean - a->mean;
+
+  a->m2 += b->m2 + delta * delta * ((double)a->count * b->count / count);
+  a->mean += delta * b->count / count;
+  a->count = count;
+}
+
+/*
+Stores into 'weights' the state independent jump probabilities of channel 'step'
+when every K_i^H K_i = p_i I (mixed unitary channels such as depolarizing and
+dephasing). Returns false when some p_i depends on the state.
+*/
+static bool fixed_weights (stage_step *step, double *weights)
+{
+  int d = 1 << step->num_targets;
+
+  for (int i = 0; i < step->num_kraus; i++)
+  {
+    const dcomplex *K = FLA_Obj_buffer_at_view (step->owned[i].mat_repr);
+    dim_t cs = FLA_Obj_col_stride (step->owned[i].mat_repr);
+    double p = 0.0;
+
+    // (K^H K)[a, b] = sum_r conj(K[r, a]) K[r, b]
+    for (int a = 0; a < d; a++)
+      for (int b = 0; b < d; b++)
+      {
+        double re = 0.0, im = 0.0;
+
+        for (int r = 0; r < d; r++)
+        {
+          dcomplex u = K[r + a * cs], v = K[r + b * cs];
+          re += u.real * v.real + u.imag * v.imag;
+          im += u.real * v.imag - u.imag * v.real;
+        }
+
+        if (a == 0 && b == 0)
+          p = re;
+        if (fabs (re - (a == b ? p : 0.0)) > JUMP_FIXED_TOL || fabs (im) > JUMP_FIXED_TOL)
+          return false;
+      }
+
+    weights[i] = p;
+  }
+
+  return true;
+}
+
+/* Reduced density matrix of 'targets': rho[a + d a2] = sum psi[b | a] conj(psi[b | a2])
+ * over basis states b clear on the targets, in one pass over 'psi' */
+static void reduced_density (FLA_Obj state, const int *targets, int k, dcomplex *rho)
+{
+  const void *psi = FLA_Obj_buffer_at_view (state);
+  bool single = kernel_is_single (state);
+  uint64_t N = FLA_Obj_length (state);
+  int d = 1 << k;
+  uint64_t offset[1 << CHANNEL_MAX_TARGETS], mask = 0;
+
+  for (int a = 0; a < d; a++)
+  {
+    offset[a] = 0;
+    for (int j = 0; j < k; j++)
+      offset[a] |= (uint64_t)((a >> j) & 1) << targets[j];
+  }
+  mask = offset[d - 1];
+
+  memset (rho, 0, d * d * sizeof (dcomplex));
+
+  for (uint64_t b = 0; b < N; b++)
+  {
+    if (b & mask)
+      continue;
+
+    for (int a = 0; a < d; a++)
+      for (int a2 = 0; a2 < d; a2++)
+      {
+        dcomplex u = kernel_amp_get (psi, b | offset[a], single);
+        dcomplex v = kernel_amp_get (psi, b | offset[a2], single);
+
+        rho[a + d * a2].real += u.real * v.real + u.imag * v.imag;
+        rho[a + d * a2].imag += u.imag * v.real - u.real * v.imag;
+      }
+  }
+}
+
+/* Returns |K psi|^2 = Tr (K rho K^H) from the reduced density matrix 'rho' */
+static double kraus_weight (FLA_Obj K, const dcomplex *rho, int d)
+{
+  const dcomplex *k = FLA_Obj_buffer_at_view (K);
+  dim_t cs = FLA_Obj_col_stride (K);
+  double p = 0.0;
+
+  // sum_r sum_{a, a2} K[r, a] rho[a, a2] conj(K[r, a2])
+  for (int r = 0; r < d; r++)
+    for (int a = 0; a < d; a++)
+      for (int a2 = 0; a2 < d; a2++)
+      {
+        dcomplex u = k[r + a * cs], v = k[r + a2 * cs], m = rho[a + d * a2];
+        double re = u.real * m.real - u.imag * m.imag;
+        double im = u.real * m.imag + u.imag * m.real;
+
+        p += re * v.real + im * v.imag;
+      }
+
+  return p;
+}
+
+/* Replaces channel 'step' on 'state' by a quantum jump drawn from 'rng'. 'fixed'
+ * holds the jump probabilities of mixed unitary channels, NULL otherwise */
+static void channel_jump (stage_step *step, const double *fixed, FLA_Obj state,
+                          FQAM_Rng *rng)
+{
+  int k = step->num_targets, d = 1 << k, chosen = -1;
+  double u = FQAM_Rng_uniform (rng), cumulative = 0.0, p = 0.0;
+  dcomplex rho[1 << (2 * CHANNEL_MAX_TARGETS)];
+
+  if (!fixed)
+    reduced_density (state, step->targets, k, rho);
+
+  for (int i = 0; i < step->num_kraus && cumulative <= u; i++)
+  {
+    double w = fixed ? fixed[i] : kraus_weight (step->owned[i].mat_repr, rho, d);
+
+    // Rounding may leave u past the last cumulative weight: keep the last
+    // operator of nonzero weight
+    if (w > 0.0)
+    {
+      chosen = i;
+      p = w;
+    }
+    cumulative += w;
+  }
+
+  assertf (chosen >= 0, "Error: Channel has no Kraus operator of nonzero weight");
+
+  kernel_apply_local (state, step->owned[chosen].mat_repr, step->targets, k);
+
+  void *psi = FLA_Obj_buffer_at_view (state);
+  bool single = kernel_is_single (state);
+  double scale = 1.0 / sqrt (p);
+
+  for (dim_t i = 0; i < FLA_Obj_length (state); i++)
+  {
+    dcomplex a = kernel_amp_get (psi, i, single);
+    kernel_amp_set (psi, i, (dcomplex){scale * a.real, scale * a.imag}, single);
+  }
+}
+
+/* Draws a basis state of normalized 'state' */
+static unsigned long state_sample (FLA_Obj state, FQAM_Rng *rng)
+{
+  const void *psi = FLA_Obj_buffer_at_view (state);
+  bool single = kernel_is_single (state);
+  uint64_t N = FLA_Obj_length (state), last = 0;
+  double u = FQAM_Rng_uniform (rng), cumulative = 0.0;
+
+  for (uint64_t b = 0; b < N; b++)
+  {
+    dcomplex a = kernel_amp_get (psi, b, single);
+    double w = a.real * a.real + a.imag * a.imag;
+
+    if (w > 0.0)
+      last = b;
+    cumulative += w;
+    if (u < cumulative)
+      return b;
+  }
+
+  return last;
+}
+
+/*
+Runs 'trajectories' noisy statevector evolutions of the stage, each replacing
+its channels by quantum jumps, in parallel over trajectories.
+
+Arguments:
+    trajectories: Number of trajectories
+    seed: Trajectory t draws from PRNG stream t under 'seed', so results do not
+          depend on the number of threads
+    H: Observable averaged over trajectories into 'stats', or NULL
+    outcomes: If not NULL, outcomes[t] receives a basis state sampled from the
+              final state of trajectory t
+    stats: Mean, variance and standard error of <psi_t|H|psi_t>, if H is given
+
+Notes:
+ - Needs the statevector backend. Memory is one statevector per thread: the
+   observable and samples are aggregated as each trajectory finishes.
+ - Steps before the first channel are computed once on the stage's statevector
+   (using its checkpoints) and copied into every trajectory.
+ - Mixed unitary channels jump with state independent probabilities. Other
+   channels take one pass over the state for the reduced density matrix of
+   their targets.
+*/
+void FQAM_trajectories (size_t trajectories, uint64_t seed, FQAM_Pauli_sum *H,
+                        unsigned long *outcomes, FQAM_Trajectory_stats *stats)
+{
+  assertf (FQAM_initialized (), "Error: Expected stage initialized");
+  assertf (main_stage.config.backend == FQAM_BACKEND_STATEVECTOR,
+           "Error: Trajectories need the statevector backend");
+  assertf (!H || stats, "Error: Expected stats for observable");
+
+  size_t depth = main_stage.stage->size, first = main_stage.base_step;
+  uint64_t N = main_stage.state_space;
+  running_stats total = {0, 0.0, 0.0};
+
+  // Noise free prefix, shared by all trajectories
+  while (first < depth && stage_get (first)->kind != STEP_CHANNEL)
+    first++;
+  stage_seek (first);
+
+  const void *prefix = FLA_Obj_buffer_at_view (main_stage.statevector);
+
+  double **fixed = calloc (depth + 1, sizeof (double *));
+  assertf (fixed, "Error: Failed to allocate trajectories");
+
+  for (size_t s = first; s < depth; s++)
+  {
+    stage_step *step = stage_get (s);
+
+    if (step->kind != STEP_CHANNEL)
+      continue;
+
+    fixed[s] = malloc (step->num_kraus * sizeof (double));
+    assertf (fixed[s], "Error: Failed to allocate trajectories");
+
+    if (!fixed_weights (step, fixed[s]))
+    {
+      free (fixed[s]);
+      fixed[s] = NULL;
+    }
+  }
+
+  if (H)
+    pauli_sum_group (H);
+
+#pragma omp parallel
+  {
+    FLA_Obj state;
+    FQAM_Rng rng;
+    running_stats local = {0, 0.0, 0.0};
+
+#pragma omp critical(trajectory_alloc)
+    FLA_Obj_create_conf_to (FLA_NO_TRANSPOSE, main_stage.statevector, &state);
+
+    void *psi = FLA_Obj_buffer_at_view (state);
+
+#pragma omp for schedule(dynamic)
+    for (size_t t = 0; t < trajectories; t++)
+    {
+      FQAM_Rng_init (&rng, seed, t);
+      memcpy (psi, prefix, N * main_stage.amp_size);
+
+      for (size_t s = first; s < depth; s++)
+      {
+        stage_step *step = stage_get (s);
+
+        if (step->kind == STEP_CHANNEL)
+          channel_jump (step, fixed[s], state, &rng);
+        else
+          stage_apply_step (step, state);
+      }
+
+      if (H)
+        stats_add (&local, pauli_sum_expectation (state, H));
+      if (outcomes)
+        outcomes[t] = state_sample (state, &rng);
+    }
+
+#pragma omp critical(trajectory_alloc)
+    {
+      stats_merge (&total, &local);
+      FLA_Obj_free (&state);
+    }
+  }
+
+  for (size_t s = 0; s < depth; s++)
+    free (fixed[s]);
+  free (fixed);
+
+  if (stats)
+  {
+    stats->count = total.count;
+    stats->mean = total.mean;
+    stats->variance = total.count > 1 ? total.m2 / (total.count - 1) : 0.0;
+    stats->std_error = total.count ? sqrt (stats->variance / total.count) : 0.0;
+  }
+}
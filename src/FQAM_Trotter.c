@@ -0,0 +1,288 @@
+/*
+    Copyright (C) 2024, Chuck Garcia
+
+    This file is part of libfqam and is available under the 3-Clause
+    BSD license, which can be found in the LICENSE file at the top-level
+    directory, or at http://opensource.org/licenses/BSD-3-Clause
+*/
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "FQAM.h"
+#include "__FQAM_Stage.h"
+#include "arraylist.h"
+#include "assertf.h"
+
+/* True if Pauli strings a and b commute */
+static bool pauli_commute (const FQAM_Pauli_term *a, const FQAM_Pauli_term *b)
+{
+  return !__builtin_parityll ((a->x_mask & b->z_mask) ^ (a->z_mask & b->x_mask));
+}
+
+static int compare_x_mask (const void *a, const void *b)
+{
+  uint64_t x = ((const FQAM_Pauli_term *)a)->x_mask;
+  uint64_t y = ((const FQAM_Pauli_term *)b)->x_mask;
+  return (x > y) - (x < y);
+}
+
+/* Builds e^{-i theta P} on the support of 'rotation' (qubit 0 for identities)
+ * into 'op', and its targets into 'gate' */
+static void rotation_operator (const FQAM_Pauli_term *rotation, FQAM_Op *op,
+                               stage_gate *gate)
+{
+  static const char letters[] = "IXZY";
+  uint64_t support = rotation->x_mask | rotation->z_mask;
+  uint64_t x = 0, z = 0;
+  char name[32] = "R_";
+  int k = 0;
+
+  for (int q = 0; q < 64; q++)
+  {
+    if (!((support >> q) & 1))
+      continue;
+
+    x |= ((rotation->x_mask >> q) & 1) << k;
+    z |= ((rotation->z_mask >> q) & 1) << k;
+    if (k < 29)
+      name[2 + k] = letters[((rotation->x_mask >> q) & 1) | (((rotation->z_mask >> q) & 1) << 1)];
+    gate->targets[k++] = q;
+  }
+
+  if (k == 0)
+  {
+    name[2] = 'I';
+    gate->targets[k++] = 0;
+  }
+  gate->num_targets = k;
+
+  FQAM_Op_create (op, name, k);
+  gate->op = op;
+
+  dcomplex *buf = FLA_Obj_buffer_at_view (op->mat_repr);
+  dim_t rs = FLA_Obj_row_stride (op->mat_repr);
+  dim_t cs = FLA_Obj_col_stride (op->mat_repr);
+  double c = cos (rotation->coeff), s = sin (rotation->coeff);
+  int n = __builtin_popcountll (x & z);
+
+  // cos(theta) I - i sin(theta) P, with P|b> = i^{|x & z|} (-1)^{|b & z|} |b ^ x>
+  for (uint64_t col = 0; col < (1ULL << k); col++)
+  {
+    double sign = 1.0 - 2.0 * __builtin_parityll (col & z);
+    dcomplex *entry = buf + (col ^ x) * rs + col * cs;
+    dcomplex *diag = buf + col * rs + col * cs;
+
+    switch ((n + 3) & 3)
+    {
+    case 0: entry->real += sign * s; break;
+    case 1: entry->imag += sign * s; break;
+    case 2: entry->real -= sign * s; break;
+    default: entry->imag -= sign * s; break;
+    }
+    diag->real += c;
+  }
+}
+
+/*
+Appends prod_t e^{-i theta_t P_t} to stage as a single step, applied with
+closed form rotation kernels in one sweep per distinct X/Y pattern.
+
+Arguments:
+    rotations: Pauli strings P_t with angle theta_t as coefficient. Must
+               pairwise commute, so their order is irrelevant.
+    num_rotations: Number of rotations, at least one
+*/
+void FQAM_stage_append_rotations (const FQAM_Pauli_term *rotations, int num_rotations)
+{
+  assertf (FQAM_initialized (), "Error: Expected stage initialized");
+  assertf (num_rotations > 0, "Error: Expected at least one rotation");
+
+  stage_step *step = calloc (1, sizeof (stage_step));
+  bool local = true;
+
+  assertf (step, "Error: Failed to allocate stage step");
+
+  for (int t = 0; t < num_rotations; t++)
+  {
+    uint64_t support = rotations[t].x_mask | rotations[t].z_mask;
+
+    assertf (main_stage.dim == 64 || (support >> main_stage.dim) == 0,
+             "Error: Pauli rotation acts outside of register");
+    for (int u = 0; u < t; u++)
+      assertf (pauli_commute (&rotations[t], &rotations[u]),
+               "Error: Rotations %d and %d do not commute", u, t);
+
+    local &= __builtin_popcountll (support) <= FQAM_MAX_TARGETS;
+  }
+
+  step->kind = STEP_PAULI;
+  step->num_rotations = num_rotations;
+  step->rotations = malloc (num_rotations * sizeof (FQAM_Pauli_term));
+  assertf (step->rotations, "Error: Failed to allocate stage step");
+  memcpy (step->rotations, rotations, num_rotations * sizeof (FQAM_Pauli_term));
+  qsort (step->rotations, num_rotations, sizeof (FQAM_Pauli_term), compare_x_mask);
+
+  // Operator form for path sums and rendering
+  if (local)
+  {
+    step->owned = malloc (num_rotations * sizeof (FQAM_Op));
+    step->gates = malloc (num_rotations * sizeof (stage_gate));
+    assertf (step->owned && step->gates, "Error: Failed to allocate stage step");
+
+    for (int t = 0; t < num_rotations; t++)
+      rotation_operator (&step->rotations[t], &step->owned[t], &step->gates[t]);
+
+    step->num_gates = num_rotations;
+    step->num_owned = num_rotations;
+    step->op = step->gates[0].op;
+    step->num_targets = step->gates[0].num_targets;
+    memcpy (step->targets, step->gates[0].targets, step->num_targets * sizeof (int));
+  }
+
+  arraylist_add (main_stage.stage, step);
+}
+
+/* Trotter sequence being staged: the last group and time are held back so
+ * consecutive exponentials of the same group merge into one step */
+typedef struct
+{
+  FQAM_Pauli_sum *H;
+  int *group_of;          // Group of each term of H
+  FQAM_Pauli_term *buffer; // Rotations of staged group
+  int pending;             // Group held back, -1 if none
+  double tau;              // Time of held back group
+  int staged;
+} trotter_sequence;
+
+static void sequence_flush (trotter_sequence *seq)
+{
+  int n = 0;
+
+  if (seq->pending < 0)
+    return;
+
+  for (size_t t = 0; t < seq->H->size; t++)
+    if (seq->group_of[t] == seq->pending)
+    {
+      seq->buffer[n] = seq->H->terms[t];
+      seq->buffer[n++].coeff *= seq->tau;
+    }
+
+  FQAM_stage_append_rotations (seq->buffer, n);
+  seq->pending = -1;
+  seq->staged++;
+}
+
+/* Appends e^{-i tau H_group} */
+static void sequence_emit (trotter_sequence *seq, int group, double tau)
+{
+  if (seq->pending != group)
+  {
+    sequence_flush (seq);
+    seq->pending = group;
+    seq->tau = 0.0;
+  }
+  seq->tau += tau;
+}
+
+/* First order: prod_g e^{-i tau H_g} */
+static void sequence_order1 (trotter_sequence *seq, int groups, double tau)
+{
+  for (int g = 0; g < groups; g++)
+    sequence_emit (seq, g, tau);
+}
+
+/* Second order (symmetric): groups forwards then backwards, each over tau / 2 */
+static void sequence_order2 (trotter_sequence *seq, int groups, double tau)
+{
+  for (int g = 0; g < groups; g++)
+    sequence_emit (seq, g, tau / 2);
+  for (int g = groups; g-- > 0;)
+    sequence_emit (seq, g, tau / 2);
+}
+
+/* Fourth order (Suzuki): S2(p tau)^2 S2((1 - 4p) tau) S2(p tau)^2 */
+static void sequence_order4 (trotter_sequence *seq, int groups, double tau)
+{
+  double p = 1.0 / (4.0 - cbrt (4.0));
+
+  sequence_order2 (seq, groups, p * tau);
+  sequence_order2 (seq, groups, p * tau);
+  sequence_order2 (seq, groups, (1.0 - 4.0 * p) * tau);
+  sequence_order2 (seq, groups, p * tau);
+  sequence_order2 (seq, groups, p * tau);
+}
+
+/*
+Appends Trotterized time evolution e^{-i H time} to stage.
+
+Arguments:
+    H: Hamiltonian as a sum of Pauli strings with real coefficients
+    time: Evolution time
+    steps: Number of Trotter steps of time / steps
+    order: Order of the product formula, 1, 2 or 4
+
+Returns number of staged steps.
+
+Notes:
+  - Terms are greedily grouped into sets of pairwise commuting strings, each
+    exponentiated exactly as one stage step (see FQAM_stage_append_rotations).
+    Trotter error therefore only arises between groups, and a Hamiltonian of
+    commuting terms is evolved exactly.
+  - Adjacent exponentials of the same group, e.g. at the center of second
+    order steps and between steps, are merged into one stage step.
+*/
+int FQAM_stage_append_trotter (FQAM_Pauli_sum *H, double time, int steps, int order)
+{
+  assertf (FQAM_initialized (), "Error: Expected stage initialized");
+  assertf (H->size > 0, "Error: Expected nonempty Hamiltonian");
+  assertf (steps > 0, "Error: Expected positive number of Trotter steps");
+  assertf (order == 1 || order == 2 || order == 4,
+           "Error: Trotter order %d unsupported, expected 1, 2 or 4", order);
+
+  trotter_sequence seq = {.H = H, .pending = -1, .staged = 0};
+  int *leaders = malloc (H->size * sizeof (int));
+  int groups = 0;
+
+  seq.group_of = malloc (H->size * sizeof (int));
+  seq.buffer = malloc (H->size * sizeof (FQAM_Pauli_term));
+  assertf (leaders && seq.group_of && seq.buffer, "Error: Failed to allocate Trotter groups");
+
+  // Greedy grouping: first group whose terms all commute with the term
+  for (size_t t = 0; t < H->size; t++)
+  {
+    int g;
+    for (g = 0; g < groups; g++)
+    {
+      bool commutes = true;
+      for (size_t u = leaders[g]; u < t && commutes; u++)
+        if (seq.group_of[u] == g)
+          commutes = pauli_commute (&H->terms[t], &H->terms[u]);
+      if (commutes)
+        break;
+    }
+
+    if (g == groups)
+      leaders[groups++] = t;
+    seq.group_of[t] = g;
+  }
+
+  double tau = time / steps;
+  for (int s = 0; s < steps; s++)
+  {
+    switch (order)
+    {
+    case 1: sequence_order1 (&seq, groups, tau); break;
+    case 2: sequence_order2 (&seq, groups, tau); break;
+    default: sequence_order4 (&seq, groups, tau); break;
+    }
+  }
+  sequence_flush (&seq);
+
+  free (leaders);
+  free (seq.group_of);
+  free (seq.buffer);
+
+  return seq.staged;
+}
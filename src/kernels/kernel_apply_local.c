@@ -0,0 +1,485 @@
+/***
+ *     Copyright (C) 2024, Chuck Garcia
+ *
+ *     This file is part of libfqam and is available under the 3-Clause
+ *     BSD license, which can be found in the LICENSE file at the top-level
+ *     directory, or at http://opensource.org/licenses/BSD-3-Clause
+ */
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "FQAM.h"
+#include "__kernels.h"
+#include "assertf.h"
+
+/* Qubits per tile of a fused layer sweep (64 KiB of double complex) */
+#define LAYER_TILE_QUBITS 12
+
+/* Local operator prepared for application to groups of amplitudes */
+typedef struct
+{
+  int k;
+  dcomplex *u;                          // Row major 2^k x 2^k operator
+  int sorted[FQAM_MAX_TARGETS];         // Targets in ascending order
+  uint64_t offset[1 << FQAM_MAX_TARGETS]; // Index bits of local index l
+} local_gate;
+
+/* Copies operator U (2^k x 2^k) into row major buffer 'u' */
+static void load_operator (FLA_Obj U, int k, dcomplex *u)
+{
+  const dcomplex *buf = FLA_Obj_buffer_at_view (U);
+  dim_t rs = FLA_Obj_row_stride (U);
+  dim_t cs = FLA_Obj_col_stride (U);
+  int size = 1 << k;
+
+  assertf (FLA_Obj_length (U) == size && FLA_Obj_width (U) == size,
+           "Error: Expected %d x %d operator", size, size);
+
+  for (int r = 0; r < size; r++)
+    for (int c = 0; c < size; c++)
+      u[r * size + c] = buf[r * rs + c * cs];
+}
+
+/* Returns row major copy of operator U on 'k' qubits, to be freed by caller */
+static dcomplex *operator_copy (FLA_Obj U, int k)
+{
+  size_t size = 1 << k;
+  dcomplex *u;
+
+  assertf (k >= 1 && k <= FQAM_MAX_TARGETS, "Error: Unsupported target count %d", k);
+
+  u = malloc (size * size * sizeof (dcomplex));
+  assertf (u, "Error: Failed to allocate local operator");
+  load_operator (U, k, u);
+
+  return u;
+}
+
+/* Prepares row major operator 'u' on 'targets' for local_gate_apply. The gate
+ * refers to 'u' rather than copying it */
+static void local_gate_init (local_gate *g, dcomplex *u, const int *targets, int k)
+{
+  int size = 1 << k;
+
+  g->k = k;
+  g->u = u;
+
+  for (int j = 0; j < k; j++)
+  {
+    int t = targets[j], pos = j;
+
+    while (pos > 0 && g->sorted[pos - 1] > t)
+    {
+      g->sorted[pos] = g->sorted[pos - 1];
+      pos--;
+    }
+    g->sorted[pos] = t;
+  }
+
+  for (int l = 0; l < size; l++)
+  {
+    g->offset[l] = 0;
+    for (int j = 0; j < k; j++)
+      if ((l >> j) & 1)
+        g->offset[l] |= 1ULL << targets[j];
+  }
+}
+
+/* Inserts zero bits at the (ascending) positions 'sorted' into 'g' */
+static inline uint64_t insert_zeros (uint64_t g, const int *sorted, int k)
+{
+  for (int j = 0; j < k; j++)
+  {
+    uint64_t low = g & ((1ULL << sorted[j]) - 1);
+    g = ((g >> sorted[j]) << (sorted[j] + 1)) | low;
+  }
+  return g;
+}
+
+/* Applies gate to the amplitudes of 'psi' in group 'group', i.e. the 2^k
+ * amplitudes sharing the non-target bits of group index 'group' */
+static inline void local_gate_apply (const local_gate *g, void *psi, uint64_t group,
+                                     bool single)
+{
+  uint64_t base = insert_zeros (group, g->sorted, g->k);
+
+  if (g->k == 1)
+  {
+    const dcomplex *u = g->u;
+    uint64_t i0 = base, i1 = base | g->offset[1];
+    dcomplex a = kernel_amp_get (psi, i0, single), b = kernel_amp_get (psi, i1, single);
+    dcomplex c, d;
+
+    c.real = u[0].real * a.real - u[0].imag * a.imag + u[1].real * b.real - u[1].imag * b.imag;
+    c.imag = u[0].real * a.imag + u[0].imag * a.real + u[1].real * b.imag + u[1].imag * b.real;
+    d.real = u[2].real * a.real - u[2].imag * a.imag + u[3].real * b.real - u[3].imag * b.imag;
+    d.imag = u[2].real * a.imag + u[2].imag * a.real + u[3].real * b.imag + u[3].imag * b.real;
+    kernel_amp_set (psi, i0, c, single);
+    kernel_amp_set (psi, i1, d, single);
+    return;
+  }
+
+  int size = 1 << g->k;
+  dcomplex in[1 << FQAM_MAX_TARGETS];
+
+  for (int l = 0; l < size; l++)
+    in[l] = kernel_amp_get (psi, base | g->offset[l], single);
+
+  for (int r = 0; r < size; r++)
+  {
+    double re = 0.0, im = 0.0;
+    const dcomplex *row = g->u + r * size;
+
+    for (int c = 0; c < size; c++)
+    {
+      re += row[c].real * in[c].real - row[c].imag * in[c].imag;
+      im += row[c].real * in[c].imag + row[c].imag * in[c].real;
+    }
+
+    kernel_amp_set (psi, base | g->offset[r], (dcomplex){re, im}, single);
+  }
+}
+
+/* Applies gate in one parallel sweep over the statevector */
+KERNEL_CLONES
+static void apply_sweep (void *psi, uint64_t N, const local_gate *g, bool single)
+{
+#pragma omp parallel for schedule(static)
+  for (uint64_t group = 0; group < N >> g->k; group++)
+    local_gate_apply (g, psi, group, single);
+}
+
+/* Applies gates, in order, to each tile of 'tile' amplitudes in one parallel
+ * sweep. Gates must act on qubits below the tile size */
+KERNEL_CLONES
+static void apply_tiled (void *psi, uint64_t N, uint64_t tile,
+                         const local_gate **gates, int num_gates, bool single)
+{
+  if (num_gates == 0)
+    return;
+
+#pragma omp parallel for schedule(static)
+  for (uint64_t t = 0; t < N / tile; t++)
+    for (int i = 0; i < num_gates; i++)
+      for (uint64_t group = 0; group < tile >> gates[i]->k; group++)
+        local_gate_apply (gates[i], kernel_amp_at (psi, t * tile, single), group,
+                          single);
+}
+
+/* Applies gates, in order, to each tile over qubits 'mask' in one parallel
+ * sweep. Each tile (the amplitudes sharing the bits outside of 'mask') is
+ * gathered into a buffer, updated by every gate and scattered back. Gates must
+ * act on qubits of 'mask' only */
+KERNEL_CLONES
+static void apply_gathered (void *psi, uint64_t N, uint64_t mask,
+                            const local_gate **gates, int num_gates, bool single)
+{
+  int qubits[64], position[64], s = 0;
+
+  for (int q = 0; q < 64; q++)
+    if ((mask >> q) & 1)
+    {
+      position[q] = s;
+      qubits[s++] = q;
+    }
+
+  uint64_t size = 1ULL << s;
+  uint64_t *offset = malloc (size * sizeof (uint64_t));
+  local_gate *local = malloc (num_gates * sizeof (local_gate));
+
+  assertf (offset && local, "Error: Failed to allocate tile");
+
+  // Index bits of tile index l, built from l with its lowest bit cleared
+  offset[0] = 0;
+  for (uint64_t l = 1; l < size; l++)
+    offset[l] = offset[l & (l - 1)] | (1ULL << qubits[__builtin_ctzll (l)]);
+
+  // Same operators on the positions of their targets within the tile
+  for (int i = 0; i < num_gates; i++)
+  {
+    int targets[FQAM_MAX_TARGETS];
+
+    for (int j = 0; j < gates[i]->k; j++)
+      targets[j] = position[__builtin_ctzll (gates[i]->offset[1 << j])];
+    local_gate_init (&local[i], gates[i]->u, targets, gates[i]->k);
+  }
+
+#pragma omp parallel
+  {
+    dcomplex *tile = malloc (size * sizeof (dcomplex));
+    assertf (tile, "Error: Failed to allocate tile");
+
+#pragma omp for schedule(static)
+    for (uint64_t t = 0; t < N / size; t++)
+    {
+      uint64_t base = insert_zeros (t, qubits, s);
+
+      for (uint64_t l = 0; l < size; l++)
+        tile[l] = kernel_amp_get (psi, base | offset[l], single);
+
+      for (int i = 0; i < num_gates; i++)
+        for (uint64_t group = 0; group < size >> local[i].k; group++)
+          local_gate_apply (&local[i], tile, group, false);
+
+      for (uint64_t l = 0; l < size; l++)
+        kernel_amp_set (psi, base | offset[l], tile[l], single);
+    }
+
+    free (tile);
+  }
+
+  free (offset);
+  free (local);
+}
+
+/* Applies gates, in order, to tiles over qubits 'mask' in one sweep. The tile
+ * is padded with the lowest remaining qubits to 'tile_qubits', so tiles over
+ * the low qubits are updated in place and others are gathered */
+static void apply_group (void *psi, uint64_t N, uint64_t mask, int tile_qubits,
+                         const local_gate **gates, int num_gates, bool single)
+{
+  for (int q = 0; __builtin_popcountll (mask) < tile_qubits; q++)
+    mask |= 1ULL << q;
+
+  if (mask == (1ULL << tile_qubits) - 1)
+    apply_tiled (psi, N, 1ULL << tile_qubits, gates, num_gates, single);
+  else
+    apply_gathered (psi, N, mask, gates, num_gates, single);
+}
+
+/* Applies gates in order, grouped into tiles of LAYER_TILE_QUBITS qubits
+ * holding the targets of every gate of the group, one sweep per group.
+ * Consecutive gates share a group while their targets fit. When the gates
+ * commute, each gate joins the first group it fits in regardless of order */
+static void apply_gates (void *psi, uint64_t N, const local_gate *gates,
+                         int num_gates, bool commute, bool single)
+{
+  int tile_qubits = min (__builtin_ctzll (N), LAYER_TILE_QUBITS);
+  const local_gate **run = malloc (num_gates * sizeof (local_gate *));
+  uint64_t *masks = malloc (num_gates * sizeof (uint64_t));
+  int *group_of = malloc (num_gates * sizeof (int));
+  int num_groups = 0;
+
+  assertf (run && masks && group_of, "Error: Failed to allocate layer");
+
+  for (int i = 0; i < num_gates; i++)
+  {
+    uint64_t mask = gates[i].offset[(1 << gates[i].k) - 1];
+    int g = commute ? 0 : max (num_groups - 1, 0);
+
+    while (g < num_groups && __builtin_popcountll (masks[g] | mask) > tile_qubits)
+      g++;
+    if (g == num_groups)
+      masks[num_groups++] = 0;
+
+    masks[g] |= mask;
+    group_of[i] = g;
+  }
+
+  for (int g = 0; g < num_groups; g++)
+  {
+    int num_run = 0;
+
+    for (int i = 0; i < num_gates; i++)
+      if (group_of[i] == g)
+        run[num_run++] = &gates[i];
+
+    apply_group (psi, N, masks[g], tile_qubits, run, num_run, single);
+  }
+
+  free (run);
+  free (masks);
+  free (group_of);
+}
+
+/***
+ * Applies the 2^k x 2^k operator U to qubits 'targets' of 'state' in place, i.e.
+ * computes (I ⊗ U ⊗ I) state without forming the full register operator.
+ *
+ * Arguments:
+ *    FLA_Obj state:  Statevector (double or single complex column vector)
+ *    FLA_Obj U:      Local operator (double complex, 2^k x 2^k)
+ *    int *targets:   Target qubits. Bit j of U's index acts on targets[j]
+ *    int k:          Number of targets
+ *
+ * Notes:
+ *  - Each of the N / 2^k groups of amplitudes sharing non-target bits is
+ *    gathered, multiplied by U and scattered back. Groups are independent and
+ *    processed in parallel.
+ *  - Single qubit operators take a specialized path over amplitude pairs.
+ */
+int kernel_apply_local (FLA_Obj state, FLA_Obj U, const int *targets, int k)
+{
+  void *psi = FLA_Obj_buffer_at_view (state);
+  uint64_t N = FLA_Obj_length (state);
+  local_gate g;
+
+  local_gate_init (&g, operator_copy (U, k), targets, k);
+  apply_sweep (psi, N, &g, kernel_is_single (state));
+
+  free (g.u);
+  return FLA_SUCCESS;
+}
+
+/* Applies 'gates' in order, see apply_gates */
+static int apply_gate_list (FLA_Obj state, const kernel_gate_t *gates, int num_gates,
+                            bool commute)
+{
+  void *psi = FLA_Obj_buffer_at_view (state);
+  uint64_t N = FLA_Obj_length (state);
+  local_gate *g = malloc (num_gates * sizeof (local_gate));
+
+  assertf (g, "Error: Failed to allocate gates");
+
+  for (int i = 0; i < num_gates; i++)
+    local_gate_init (&g[i], operator_copy (gates[i].U, gates[i].num_targets),
+                     gates[i].targets, gates[i].num_targets);
+
+  apply_gates (psi, N, g, num_gates, commute, kernel_is_single (state));
+
+  for (int i = 0; i < num_gates; i++)
+    free (g[i].u);
+  free (g);
+
+  return FLA_SUCCESS;
+}
+
+/***
+ * Applies a layer of local operators acting on pairwise disjoint targets to
+ * 'state' in place.
+ *
+ * Arguments:
+ *    FLA_Obj state:        Statevector (double or single complex column vector)
+ *    kernel_gate_t *gates: Operators and their targets, see kernel_apply_local
+ *    int num_gates:        Number of gates
+ *
+ * Notes:
+ *  - Disjoint gates commute, so they may be applied in any order. Gates are
+ *    packed into groups whose targets span at most LAYER_TILE_QUBITS qubits.
+ *    Each group takes a single parallel sweep over cache sized tiles of
+ *    2^LAYER_TILE_QUBITS amplitudes spanning its targets, applying every gate
+ *    of the group to a tile before moving to the next. Tiles over high qubits
+ *    are gathered from strided amplitudes as in kernel_gather_init.
+ *  - A layer touching at most LAYER_TILE_QUBITS qubits takes one sweep however
+ *    high its targets lie. Wider layers take about one sweep per
+ *    LAYER_TILE_QUBITS qubits they touch.
+ */
+int kernel_apply_layer (FLA_Obj state, const kernel_gate_t *gates, int num_gates)
+{
+  return apply_gate_list (state, gates, num_gates, true);
+}
+
+/***
+ * Applies a sequence of local operators to 'state' in place, in order.
+ *
+ * Arguments:
+ *    FLA_Obj state:        Statevector (double or single complex column vector)
+ *    kernel_gate_t *gates: Operators and their targets, see kernel_apply_local
+ *    int num_gates:        Number of gates
+ *
+ * Notes:
+ *  - Consecutive gates whose targets together span at most LAYER_TILE_QUBITS
+ *    qubits are applied to one tile after another in a single parallel sweep,
+ *    as in kernel_apply_layer but keeping their order. A gate reaching outside
+ *    of the run's tile starts the next run, so a sequence costs one pass over
+ *    the statevector per run rather than per gate.
+ */
+int kernel_apply_sequence (FLA_Obj state, const kernel_gate_t *gates, int num_gates)
+{
+  return apply_gate_list (state, gates, num_gates, false);
+}
+
+/***
+ * Applies the operator U to each of 'num_sites' groups of targets in turn, e.g.
+ * a translation invariant layer of a cellular automaton.
+ *
+ * Arguments:
+ *    FLA_Obj state:  Statevector (double or single complex column vector)
+ *    FLA_Obj U:      Local operator (double complex, 2^k x 2^k)
+ *    int *sites:     Targets of application s at sites[s * k], see
+ *                    kernel_apply_local
+ *    int num_sites:  Number of applications
+ *    int k:          Number of targets per application
+ *
+ * Notes:
+ *  - U is copied once and shared by every application.
+ *  - Applications on disjoint sites commute and are fused as in
+ *    kernel_apply_layer. Overlapping applications keep their order, fusing
+ *    consecutive runs as in kernel_apply_sequence.
+ */
+int kernel_apply_repeated (FLA_Obj state, FLA_Obj U, const int *sites, int num_sites,
+                           int k)
+{
+  void *psi = FLA_Obj_buffer_at_view (state);
+  uint64_t N = FLA_Obj_length (state);
+  local_gate *g = malloc (num_sites * sizeof (local_gate));
+  dcomplex *u = operator_copy (U, k);
+  bool *touched = calloc (__builtin_ctzll (N), sizeof (bool));
+  bool disjoint = true;
+
+  assertf (g && touched, "Error: Failed to allocate layer");
+
+  for (int s = 0; s < num_sites; s++)
+  {
+    local_gate_init (&g[s], u, sites + s * k, k);
+
+    for (int j = 0; j < k; j++)
+    {
+      disjoint &= !touched[sites[s * k + j]];
+      touched[sites[s * k + j]] = true;
+    }
+  }
+  free (touched);
+
+  apply_gates (psi, N, g, num_sites, disjoint, kernel_is_single (state));
+
+  free (u);
+  free (g);
+
+  return FLA_SUCCESS;
+}
+
+/***
+ * Expands the local operator U on qubits 'targets' into the operator C on the
+ * whole register. C must be a preallocated N x N matrix.
+ *
+ * Notes:
+ *  - C[r][c] = U[r_T][c_T] when r and c agree outside of the targets, where x_T
+ *    are the bits of x at the targets. Only used for small registers (e.g.
+ *    rendering adjacency matrices).
+ */
+int kernel_expand_local (FLA_Obj U, const int *targets, int k, FLA_Obj C)
+{
+  dcomplex *buf = FLA_Obj_buffer_at_view (C);
+  dim_t rs = FLA_Obj_row_stride (C);
+  dim_t cs = FLA_Obj_col_stride (C);
+  uint64_t N = FLA_Obj_length (C);
+  uint64_t mask = 0;
+  dcomplex *u = operator_copy (U, k);
+
+  for (int j = 0; j < k; j++)
+    mask |= 1ULL << targets[j];
+
+  for (uint64_t c = 0; c < N; c++)
+    for (uint64_t r = 0; r < N; r++)
+    {
+      dcomplex *entry = buf + r * rs + c * cs;
+      int rl = 0, cl = 0;
+
+      entry->real = 0.0;
+      entry->imag = 0.0;
+      if ((r & ~mask) != (c & ~mask))
+        continue;
+
+      for (int j = 0; j < k; j++)
+      {
+        rl |= ((r >> targets[j]) & 1) << j;
+        cl |= ((c >> targets[j]) & 1) << j;
+      }
+      *entry = u[rl * (1 << k) + cl];
+    }
+
+  free (u);
+  return FLA_SUCCESS;
+}
@@ -0,0 +1,182 @@
+/***
+ *     Copyright (C) 2024, Chuck Garcia
+ *
+ *     This file is part of libfqam and is available under the 3-Clause
+ *     BSD license, which can be found in the LICENSE file at the top-level
+ *     directory, or at http://opensource.org/licenses/BSD-3-Clause
+ */
+
+#include <stdint.h>
+#include <string.h>
+
+#include "FQAM.h"
+#include "__kernels.h"
+#include "assertf.h"
+
+/* Marginal histograms above this many outcomes are reduced into one shared
+ * buffer rather than one private copy per thread */
+#define MARGINAL_PRIVATE_MAX (1 << 16)
+
+/* Fills byte-wise gather tables for the qubit subset 'qubits' of a 'dim' qubit
+ * register, see kernel_gather_t */
+void kernel_gather_init (kernel_gather_t *g, int dim, const int *qubits, int num_qubits)
+{
+  memset (g, 0, sizeof (*g));
+  g->bytes = (dim + 7) / 8;
+
+  for (int j = 0; j < num_qubits; j++)
+  {
+    int q = qubits[j];
+    for (int v = 0; v < 256; v++)
+      if ((v >> (q % 8)) & 1)
+        g->table[q / 8][v] |= 1ULL << j;
+  }
+}
+
+static void check_qubits (FLA_Obj state, const int *qubits, int num_qubits, int *dim)
+{
+  dim_t N = FLA_Obj_length (state);
+
+  *dim = 0;
+  while (((dim_t)1 << *dim) < N)
+    (*dim)++;
+
+  assertf (num_qubits > 0 && num_qubits <= *dim,
+           "Error: Expected between 1 and %d qubits, got %d", *dim, num_qubits);
+  assertf (*dim <= 64, "Error: Statevector too large");
+
+  for (int j = 0; j < num_qubits; j++)
+  {
+    assertf (qubits[j] >= 0 && qubits[j] < *dim, "Error: Qubit %d out of range",
+             qubits[j]);
+    for (int k = 0; k < j; k++)
+      assertf (qubits[j] != qubits[k], "Error: Qubit %d repeated", qubits[j]);
+  }
+}
+
+/***
+ * Computes the marginal distribution of the qubit subset 'qubits' in a single
+ * streaming pass over 'state', storing it in 'probs'. Bit j of an outcome is the
+ * value of qubit qubits[j].
+ *
+ * Arguments:
+ *    FLA_Obj state:   Statevector (double or single complex column vector)
+ *    int *qubits:     Qubits to keep
+ *    int num_qubits:  Number of qubits to keep
+ *    double *probs:   Result buffer of 2^num_qubits elements
+ *
+ * Notes:
+ *  - The statevector is read in 256 element runs which share their outcome bits
+ *    above the lowest byte, so the per-element cost is one table lookup.
+ *  - Threads reduce into private histograms when the outcome space is small.
+ */
+KERNEL_CLONES
+int kernel_marginal_probabilities (FLA_Obj state, const int *qubits, int num_qubits,
+                                   double *probs)
+{
+  int dim;
+  check_qubits (state, qubits, num_qubits, &dim);
+
+  const void *buf = FLA_Obj_buffer_at_view (state);
+  bool single = kernel_is_single (state);
+  uint64_t N = FLA_Obj_length (state);
+  uint64_t outcomes = 1ULL << num_qubits;
+  uint64_t run = min (N, 256);
+  uint64_t runs = N / run;
+
+  kernel_gather_t g;
+  kernel_gather_init (&g, dim, qubits, num_qubits);
+  memset (probs, 0, outcomes * sizeof (double));
+
+  if (outcomes <= MARGINAL_PRIVATE_MAX)
+  {
+#pragma omp parallel
+    {
+      double *local = calloc (outcomes, sizeof (double));
+      assertf (local, "Error: Failed to allocate marginal histogram");
+
+#pragma omp for schedule(static)
+      for (uint64_t r = 0; r < runs; r++)
+      {
+        uint64_t base = r * run;
+        uint64_t high = kernel_gather_high (&g, base);
+
+        for (uint64_t i = 0; i < run; i++)
+        {
+          const dcomplex a = kernel_amp_get (buf, base + i, single);
+          local[g.table[0][i] | high] += a.real * a.real + a.imag * a.imag;
+        }
+      }
+
+#pragma omp critical
+      for (uint64_t k = 0; k < outcomes; k++)
+        probs[k] += local[k];
+
+      free (local);
+    }
+  }
+  else
+  {
+#pragma omp parallel for schedule(static)
+    for (uint64_t r = 0; r < runs; r++)
+    {
+      uint64_t base = r * run;
+      uint64_t high = kernel_gather_high (&g, base);
+
+      for (uint64_t i = 0; i < run; i++)
+      {
+        const dcomplex a = kernel_amp_get (buf, base + i, single);
+#pragma omp atomic
+        probs[g.table[0][i] | high] += a.real * a.real + a.imag * a.imag;
+      }
+    }
+  }
+
+  return FLA_SUCCESS;
+}
+
+/***
+ * Projects 'state' in place onto the subspace where qubits 'qubits' read
+ * 'outcome' and scales the surviving amplitudes by 'scale'. Passing
+ * 1/sqrt(p(outcome)) as 'scale' renormalizes the collapsed state.
+ *
+ * Arguments:
+ *    FLA_Obj state:   Statevector (double or single complex column vector)
+ *    int *qubits:     Measured qubits
+ *    int num_qubits:  Number of measured qubits
+ *    outcome:         Measured value, bit j being the value of qubits[j]
+ *    double scale:    Factor applied to surviving amplitudes
+ */
+KERNEL_CLONES
+int kernel_collapse (FLA_Obj state, const int *qubits, int num_qubits,
+                     uint64_t outcome, double scale)
+{
+  int dim;
+  check_qubits (state, qubits, num_qubits, &dim);
+
+  void *buf = FLA_Obj_buffer_at_view (state);
+  bool single = kernel_is_single (state);
+  uint64_t N = FLA_Obj_length (state);
+  uint64_t run = min (N, 256);
+  uint64_t runs = N / run;
+
+  kernel_gather_t g;
+  kernel_gather_init (&g, dim, qubits, num_qubits);
+
+#pragma omp parallel for schedule(static)
+  for (uint64_t r = 0; r < runs; r++)
+  {
+    uint64_t base = r * run;
+    uint64_t high = kernel_gather_high (&g, base);
+
+    for (uint64_t i = 0; i < run; i++)
+    {
+      dcomplex a = kernel_amp_get (buf, base + i, single);
+      double s = (g.table[0][i] | high) == outcome ? scale : 0.0;
+
+      kernel_amp_set (buf, base + i, (dcomplex){a.real * s, a.imag * s}, single);
+    }
+  }
+
+  return FLA_SUCCESS;
+}
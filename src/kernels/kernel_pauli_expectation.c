@@ -0,0 +1,218 @@
+/***
+ *     Copyright (C) 2024, Chuck Garcia
+ *
+ *     This file is part of libfqam and is available under the 3-Clause
+ *     BSD license, which can be found in the LICENSE file at the top-level
+ *     directory, or at http://opensource.org/licenses/BSD-3-Clause
+ */
+
+#include <stdint.h>
+#include <string.h>
+
+#include "FQAM.h"
+#include "__kernels.h"
+#include "assertf.h"
+
+/* Groups whose Z support spans at most this many qubits are reduced into a
+ * histogram over that support and finished with a Walsh-Hadamard transform */
+#define PAULI_HIST_MAX_QUBITS 12
+
+static int log2_length (FLA_Obj state)
+{
+  int dim = 0;
+  while (((dim_t)1 << dim) < FLA_Obj_length (state))
+    dim++;
+  return dim;
+}
+
+/* Packs the bits of 'z' selected by 'support' into the low bits */
+static uint64_t pack_bits (uint64_t z, uint64_t support)
+{
+  uint64_t packed = 0;
+  int j = 0;
+
+  for (int q = 0; q < 64; q++)
+    if ((support >> q) & 1)
+      packed |= ((z >> q) & 1) << j++;
+
+  return packed;
+}
+
+/* Real part of coeff * i^n * (vr + i vi), folded into weights on vr and vi */
+static void phase_weights (double coeff, int n, double *wr, double *wi)
+{
+  switch (n & 3)
+  {
+  case 0: *wr = coeff;  *wi = 0.0;    break;
+  case 1: *wr = 0.0;    *wi = -coeff; break;
+  case 2: *wr = -coeff; *wi = 0.0;    break;
+  default: *wr = 0.0;   *wi = coeff;  break;
+  }
+}
+
+/* In-place Walsh-Hadamard transform: w[k] := sum_j w[j] (-1)^{|j & k|} */
+void kernel_walsh_hadamard (double *w, uint64_t size)
+{
+  for (uint64_t h = 1; h < size; h <<= 1)
+    for (uint64_t i = 0; i < size; i += h << 1)
+      for (uint64_t j = i; j < i + h; j++)
+      {
+        double u = w[j], v = w[j + h];
+        w[j] = u + v;
+        w[j + h] = u - v;
+      }
+}
+
+/* Histogram path: one sweep accumulating v(b) = conj(psi[b ^ x]) psi[b] by the
+ * Z support bits of b, then every term is read off the transformed histogram */
+KERNEL_CLONES
+static double expectation_hist (const void *psi, bool single, int dim, uint64_t N,
+                                const FQAM_Pauli_term *terms, size_t num_terms,
+                                uint64_t x, uint64_t support)
+{
+  int qubits[64], s = 0;
+  for (int q = 0; q < 64; q++)
+    if ((support >> q) & 1)
+      qubits[s++] = q;
+
+  kernel_gather_t g;
+  uint64_t size = 1ULL << s;
+  uint64_t run = min (N, 256);
+  uint64_t runs = N / run;
+  double *hr = calloc (2 * size, sizeof (double));
+  double *hi = hr + size;
+
+  assertf (hr, "Error: Failed to allocate expectation histogram");
+  kernel_gather_init (&g, dim, qubits, s);
+
+#pragma omp parallel
+  {
+    double *lr = calloc (2 * size, sizeof (double));
+    double *li = lr + size;
+    assertf (lr, "Error: Failed to allocate expectation histogram");
+
+#pragma omp for schedule(static)
+    for (uint64_t r = 0; r < runs; r++)
+    {
+      uint64_t base = r * run;
+      uint64_t high = kernel_gather_high (&g, base);
+
+      for (uint64_t i = 0; i < run; i++)
+      {
+        const dcomplex a = kernel_amp_get (psi, base + i, single);
+        const dcomplex c = kernel_amp_get (psi, (base + i) ^ x, single);
+        uint64_t key = g.table[0][i] | high;
+
+        lr[key] += c.real * a.real + c.imag * a.imag;
+        li[key] += c.real * a.imag - c.imag * a.real;
+      }
+    }
+
+#pragma omp critical
+    for (uint64_t k = 0; k < 2 * size; k++)
+      hr[k] += lr[k];
+
+    free (lr);
+  }
+
+  kernel_walsh_hadamard (hr, size);
+  kernel_walsh_hadamard (hi, size);
+
+  double total = 0.0;
+  for (size_t t = 0; t < num_terms; t++)
+  {
+    double wr, wi;
+    uint64_t k = pack_bits (terms[t].z_mask, support);
+
+    phase_weights (terms[t].coeff, __builtin_popcountll (x & terms[t].z_mask), &wr, &wi);
+    total += wr * hr[k] + wi * hi[k];
+  }
+
+  free (hr);
+  return total;
+}
+
+/* Direct path: one sweep, folding the sign of every term into two weights per
+ * basis state */
+KERNEL_CLONES
+static double expectation_direct (const void *psi, bool single, uint64_t N,
+                                  const FQAM_Pauli_term *terms, size_t num_terms,
+                                  uint64_t x)
+{
+  double *wr = malloc (2 * num_terms * sizeof (double));
+  uint64_t *z = malloc (num_terms * sizeof (uint64_t));
+  double *wi = wr + num_terms;
+  double total = 0.0;
+
+  assertf (wr && z, "Error: Failed to allocate expectation weights");
+
+  for (size_t t = 0; t < num_terms; t++)
+  {
+    z[t] = terms[t].z_mask;
+    phase_weights (terms[t].coeff, __builtin_popcountll (x & z[t]), &wr[t], &wi[t]);
+  }
+
+#pragma omp parallel for reduction(+ : total) schedule(static)
+  for (uint64_t b = 0; b < N; b++)
+  {
+    const dcomplex a = kernel_amp_get (psi, b, single);
+    const dcomplex c = kernel_amp_get (psi, b ^ x, single);
+    double A = 0.0, B = 0.0;
+
+    for (size_t t = 0; t < num_terms; t++)
+    {
+      double sign = 1.0 - 2.0 * __builtin_parityll (b & z[t]);
+      A += sign * wr[t];
+      B += sign * wi[t];
+    }
+
+    total += A * (c.real * a.real + c.imag * a.imag) +
+             B * (c.real * a.imag - c.imag * a.real);
+  }
+
+  free (wr);
+  free (z);
+  return total;
+}
+
+/***
+ * Computes sum_t <psi|P_t|psi> over Pauli strings 'terms' which all share the
+ * same x_mask, in a single sweep over 'state', storing the result in 'result'.
+ *
+ * Arguments:
+ *    FLA_Obj state:          Statevector (double or single complex column vector)
+ *    FQAM_Pauli_term *terms: Terms of one group (equal x_mask)
+ *    size_t num_terms:       Number of terms
+ *    double *result:         Real expectation value of the group
+ *
+ * Notes:
+ *  - P|b> = i^{|x & z|} (-1)^{|b & z|} |b ^ x>, so terms sharing x only differ
+ *    by the sign pattern they apply to conj(psi[b ^ x]) psi[b].
+ *  - Small Z supports reduce into a 2^|support| histogram whose Walsh-Hadamard
+ *    transform yields every term at once. Larger supports fold all term signs
+ *    into two weights per basis state.
+ */
+int kernel_pauli_expectation (FLA_Obj state, const FQAM_Pauli_term *terms,
+                              size_t num_terms, double *result)
+{
+  const void *psi = FLA_Obj_buffer_at_view (state);
+  bool single = kernel_is_single (state);
+  uint64_t N = FLA_Obj_length (state);
+  int dim = log2_length (state);
+  uint64_t x = terms[0].x_mask, support = 0;
+
+  for (size_t t = 0; t < num_terms; t++)
+  {
+    assertf (terms[t].x_mask == x, "Error: Expected terms sharing x_mask");
+    assertf (dim == 64 || ((terms[t].x_mask | terms[t].z_mask) >> dim) == 0,
+             "Error: Pauli term acts outside of register");
+    support |= terms[t].z_mask;
+  }
+
+  if (__builtin_popcountll (support) <= PAULI_HIST_MAX_QUBITS)
+    *result = expectation_hist (psi, single, dim, N, terms, num_terms, x, support);
+  else
+    *result = expectation_direct (psi, single, N, terms, num_terms, x);
+
+  return FLA_SUCCESS;
+}
@@ -0,0 +1,215 @@
+/***
+ *     Copyright (C) 2024, Chuck Garcia
+ *
+ *     This file is part of libfqam and is available under the 3-Clause
+ *     BSD license, which can be found in the LICENSE file at the top-level
+ *     directory, or at http://opensource.org/licenses/BSD-3-Clause
+ */
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "FQAM.h"
+#include "__kernels.h"
+#include "assertf.h"
+
+/* Diagonal groups whose Z support spans at most this many qubits build a phase
+ * table over that support with a Walsh-Hadamard transform */
+#define ROTATION_TABLE_MAX_QUBITS 12
+
+static int log2_length (FLA_Obj state)
+{
+  int dim = 0;
+  while (((dim_t)1 << dim) < FLA_Obj_length (state))
+    dim++;
+  return dim;
+}
+
+/* a *= e^{-i theta} */
+static inline void rotate_phase (dcomplex *a, double theta)
+{
+  double c = cos (theta), s = sin (theta);
+  double re = a->real;
+
+  a->real = c * re + s * a->imag;
+  a->imag = c * a->imag - s * re;
+}
+
+/* Diagonal rotations: psi[b] *= e^{-i f(b)}, f(b) = sum_t theta_t (-1)^{|b & z_t|}.
+ * Small supports tabulate f over the support, larger ones evaluate it directly */
+KERNEL_CLONES
+static void rotations_diagonal (void *psi, bool single, int dim, uint64_t N,
+                                const FQAM_Pauli_term *rotations, size_t num_rotations)
+{
+  uint64_t support = 0;
+  for (size_t t = 0; t < num_rotations; t++)
+    support |= rotations[t].z_mask;
+
+  int s = __builtin_popcountll (support);
+
+  if (s > ROTATION_TABLE_MAX_QUBITS)
+  {
+#pragma omp parallel for schedule(static)
+    for (uint64_t b = 0; b < N; b++)
+    {
+      double f = 0.0;
+      dcomplex a = kernel_amp_get (psi, b, single);
+
+      for (size_t t = 0; t < num_rotations; t++)
+        f += (1.0 - 2.0 * __builtin_parityll (b & rotations[t].z_mask)) *
+             rotations[t].coeff;
+      rotate_phase (&a, f);
+      kernel_amp_set (psi, b, a, single);
+    }
+    return;
+  }
+
+  int qubits[64], j = 0;
+  for (int q = 0; q < 64; q++)
+    if ((support >> q) & 1)
+      qubits[j++] = q;
+
+  kernel_gather_t g;
+  uint64_t size = 1ULL << s;
+  uint64_t run = min (N, 256);
+  double *f = calloc (size, sizeof (double));
+  dcomplex *phase = malloc (size * sizeof (dcomplex));
+
+  assertf (f && phase, "Error: Failed to allocate rotation table");
+  kernel_gather_init (&g, dim, qubits, s);
+
+  // f[k] = sum_t theta_t (-1)^{|k & z_t|} over packed support bits k
+  for (size_t t = 0; t < num_rotations; t++)
+  {
+    uint64_t z = rotations[t].z_mask;
+    f[g.table[0][z & 0xFF] | kernel_gather_high (&g, z)] += rotations[t].coeff;
+  }
+  kernel_walsh_hadamard (f, size);
+
+  for (uint64_t k = 0; k < size; k++)
+  {
+    phase[k].real = 1.0;
+    phase[k].imag = 0.0;
+    rotate_phase (&phase[k], f[k]);
+  }
+
+#pragma omp parallel for schedule(static)
+  for (uint64_t r = 0; r < N / run; r++)
+  {
+    uint64_t base = r * run;
+    uint64_t high = kernel_gather_high (&g, base);
+
+    for (uint64_t i = 0; i < run; i++)
+    {
+      const dcomplex p = phase[g.table[0][i] | high];
+      const dcomplex a = kernel_amp_get (psi, base + i, single);
+      dcomplex r;
+
+      r.real = p.real * a.real - p.imag * a.imag;
+      r.imag = p.real * a.imag + p.imag * a.real;
+      kernel_amp_set (psi, base + i, r, single);
+    }
+  }
+
+  free (f);
+  free (phase);
+}
+
+/* Off-diagonal rotations sharing flip mask x: every pair (b, b ^ x) is rotated
+ * by each term in turn, in a single sweep */
+KERNEL_CLONES
+static void rotations_pairs (void *psi, bool single, uint64_t N,
+                             const FQAM_Pauli_term *rotations, size_t num_rotations,
+                             uint64_t x)
+{
+  int pivot = __builtin_ctzll (x);
+  double *c = malloc (3 * num_rotations * sizeof (double));
+  double *kr = c + num_rotations;
+  double *ki = kr + num_rotations;
+
+  assertf (c, "Error: Failed to allocate rotations");
+
+  // e^{-i theta P} = cos(theta) I - i sin(theta) P, with
+  // P|b> = i^{|x & z|} (-1)^{|b & z|} |b ^ x>. k = -i * i^{|x & z|} * sin(theta)
+  for (size_t t = 0; t < num_rotations; t++)
+  {
+    double sn = sin (rotations[t].coeff);
+
+    c[t] = cos (rotations[t].coeff);
+    switch ((__builtin_popcountll (x & rotations[t].z_mask) + 3) & 3)
+    {
+    case 0: kr[t] = sn;  ki[t] = 0.0; break;
+    case 1: kr[t] = 0.0; ki[t] = sn;  break;
+    case 2: kr[t] = -sn; ki[t] = 0.0; break;
+    default: kr[t] = 0.0; ki[t] = -sn; break;
+    }
+  }
+
+#pragma omp parallel for schedule(static)
+  for (uint64_t g = 0; g < N / 2; g++)
+  {
+    uint64_t b = ((g >> pivot) << (pivot + 1)) | (g & ((1ULL << pivot) - 1));
+    uint64_t d = b ^ x;
+    dcomplex u = kernel_amp_get (psi, b, single), v = kernel_amp_get (psi, d, single);
+
+    for (size_t t = 0; t < num_rotations; t++)
+    {
+      uint64_t z = rotations[t].z_mask;
+      double sb = 1.0 - 2.0 * __builtin_parityll (b & z);
+      double sd = 1.0 - 2.0 * __builtin_parityll (d & z);
+      dcomplex nu, nv;
+
+      // u' = c u + k s_d v, v' = c v + k s_b u
+      nu.real = c[t] * u.real + sd * (kr[t] * v.real - ki[t] * v.imag);
+      nu.imag = c[t] * u.imag + sd * (kr[t] * v.imag + ki[t] * v.real);
+      nv.real = c[t] * v.real + sb * (kr[t] * u.real - ki[t] * u.imag);
+      nv.imag = c[t] * v.imag + sb * (kr[t] * u.imag + ki[t] * u.real);
+      u = nu;
+      v = nv;
+    }
+
+    kernel_amp_set (psi, b, u, single);
+    kernel_amp_set (psi, d, v, single);
+  }
+
+  free (c);
+}
+
+/***
+ * Applies prod_t e^{-i theta_t P_t} to 'state' in place, for Pauli strings P_t
+ * sharing the same x_mask, with angle theta_t stored in the term's coefficient.
+ *
+ * Arguments:
+ *    FLA_Obj state:              Statevector (double or single complex column vector)
+ *    FQAM_Pauli_term *rotations: Strings and angles of one group (equal x_mask)
+ *    size_t num_rotations:       Number of rotations
+ *
+ * Notes:
+ *  - Rotations are applied in closed form, without matrix exponentials.
+ *  - Diagonal groups (x_mask of zero) multiply each amplitude by one phase.
+ *    Other groups rotate each pair of amplitudes (b, b ^ x_mask) by every term
+ *    in turn, so that one sweep applies the group in order.
+ */
+int kernel_pauli_rotations (FLA_Obj state, const FQAM_Pauli_term *rotations,
+                            size_t num_rotations)
+{
+  void *psi = FLA_Obj_buffer_at_view (state);
+  bool single = kernel_is_single (state);
+  uint64_t N = FLA_Obj_length (state);
+  int dim = log2_length (state);
+  uint64_t x = rotations[0].x_mask;
+
+  for (size_t t = 0; t < num_rotations; t++)
+  {
+    assertf (rotations[t].x_mask == x, "Error: Expected rotations sharing x_mask");
+    assertf (dim == 64 || ((rotations[t].x_mask | rotations[t].z_mask) >> dim) == 0,
+             "Error: Pauli rotation acts outside of register");
+  }
+
+  if (x == 0)
+    rotations_diagonal (psi, single, dim, N, rotations, num_rotations);
+  else
+    rotations_pairs (psi, single, N, rotations, num_rotations, x);
+
+  return FLA_SUCCESS;
+}
@@ -22,9 +22,15 @@ int compute_probability_adjacency_matrix (FLA_Obj A, FLA_Obj state, FLA_Obj C)
   FLA_Obj AL, AR, A0, a1, A2;
   FLA_Obj B, BT, B0, BB, beta, B2;
 
-  // Create copy to avoid modifying original state vector
-  FLA_Obj_create_conf_to (FLA_NO_TRANSPOSE, state, &B);
-  FLA_Copy (state, B);
+  // Double complex copy to avoid modifying original state vector
+  const void *psi = FLA_Obj_buffer_at_view (state);
+  bool single = kernel_is_single (state);
+
+  FLA_Obj_create (FLA_DOUBLE_COMPLEX, FLA_Obj_length (state), 1, 0, 0, &B);
+
+  dcomplex *b = FLA_Obj_buffer_at_view (B);
+  for (dim_t i = 0; i < FLA_Obj_length (state); i++)
+    b[i] = kernel_amp_get (psi, i, single);
 
   FLA_Obj CT, C0, CB, c1t, C2;
 
@@ -0,0 +1,66 @@
+/***
+ *     Copyright (C) 2024, Chuck Garcia
+ *
+ *     This file is part of libfqam and is available under the 3-Clause
+ *     BSD license, which can be found in the LICENSE file at the top-level
+ *     directory, or at http://opensource.org/licenses/BSD-3-Clause
+ */
+
+#include <stdint.h>
+
+#include "FQAM.h"
+#include "__kernels.h"
+#include "assertf.h"
+
+/***
+ * Swaps qubit a[j] with qubit b[j] of 'state' in place for every pair j, in a
+ * single parallel sweep.
+ *
+ * Arguments:
+ *    FLA_Obj state:  Statevector (double or single complex column vector)
+ *    int *a, int *b: Qubit pairs, all 2 num_pairs qubits distinct
+ *    int num_pairs:  Number of pairs
+ *
+ * Notes:
+ *  - Swapping disjoint pairs exchanges the bits of each pair in every basis
+ *    index, an involution. Index i trades amplitudes with its image when the
+ *    image is larger, so every exchange happens once and in any order.
+ *  - The sweep visits indices in order, but each exchange also reads and
+ *    writes the image of i. When a pair reaches a qubit above the chunk size
+ *    the image lies in another chunk, so out-of-core statevectors are accessed
+ *    as two strided streams rather than sequentially (see FQAM_Chunks.c).
+ */
+int kernel_swap_qubits (FLA_Obj state, const int *a, const int *b, int num_pairs)
+{
+  void *psi = FLA_Obj_buffer_at_view (state);
+  bool single = kernel_is_single (state);
+  uint64_t N = FLA_Obj_length (state), used = 0;
+
+  for (int j = 0; j < num_pairs; j++)
+  {
+    assertf (a[j] != b[j] && !((used >> a[j]) & 1) && !((used >> b[j]) & 1),
+             "Error: Expected disjoint qubit pairs");
+    assertf ((1ULL << a[j]) < N && (1ULL << b[j]) < N,
+             "Error: Swapped qubit outside of register");
+    used |= (1ULL << a[j]) | (1ULL << b[j]);
+  }
+
+#pragma omp parallel for schedule(static)
+  for (uint64_t i = 0; i < N; i++)
+  {
+    uint64_t image = i;
+
+    for (int j = 0; j < num_pairs; j++)
+      if (((i >> a[j]) ^ (i >> b[j])) & 1)
+        image ^= (1ULL << a[j]) | (1ULL << b[j]);
+
+    if (image > i)
+    {
+      dcomplex u = kernel_amp_get (psi, i, single);
+      kernel_amp_set (psi, i, kernel_amp_get (psi, image, single), single);
+      kernel_amp_set (psi, image, u, single);
+    }
+  }
+
+  return FLA_SUCCESS;
+}
@@ -5,116 +5,77 @@
     BSD license, which can be found in the LICENSE file at the top-level
     directory, or at http://opensource.org/licenses/BSD-3-Clause
 
-Description: This file automatically generates kronecker product kernel C tests 
-for random matrices using numpy as a reference.
+Description: This file generates kronecker product kernel fixtures for random
+matrices using numpy as a reference. Each fixture is read by test_kron.c, so
+large products are tested without generating C sources.
+
+Fixture layout, native endian (see test_kron.c):
+
+    header      "FQAMKRON", uint32 version, uint32 reserved,
+                uint64 m, n, p, q, uint64 reserved[2]          (64 bytes)
+    A           m x n column major doubles
+    B           p x q column major doubles
+    C_ref       mp x nq column major doubles, kron (A, B)
+
+Usage:
+    python3 gen_kernel_ten_test.py --out-dir DIR [--num-tests N] [--min-size K]
+                                   [--max-size K] [--square] [--seed S]
+
+Operands have 2^k rows, k drawn from [min-size, max-size]. With --square they
+also have 2^k columns, so a product of two 2^6 x 2^6 operands is 2^12 x 2^12
+(128 MiB). Fixtures are named kron_{id}.bin, so generate large ones into a
+separate directory and pass it to test_kron.x rather than committing them.
+
+The output directory is required so a rerun does not overwrite the committed
+fixtures in tests/fixtures, which were converted from earlier generated tests
+rather than drawn under a known seed.
 """
 
+import argparse
+import os
+import struct
+
 import numpy as np
 
-def generate_matrix_code(matrix_a, matrix_b, test_id):
-    # Get dimensions
-    m = len(matrix_a)
-    n = len(matrix_a[0])
-    p = len(matrix_b)
-    q = len(matrix_b[0])
-    r = m * p
-    c = n * q
-
-    # Generate matrix initialization strings
-    def matrix_to_string(array):
-        array_str = np.array2string(
-            array, separator=", ", formatter={"float_kind": lambda x: str(x)}, threshold=np.inf
-        )
-        formatted_str = array_str.replace("[", "{").replace("]", "}")
-        return formatted_str
-
-    # Calculate reference matrix dimensions and values
+FIXTURE_MAGIC = b"FQAMKRON"
+FIXTURE_VERSION = 1
+
+
+def write_fixture(matrix_a, matrix_b, path):
+    m, n = matrix_a.shape
+    p, q = matrix_b.shape
     c_ref = np.kron(matrix_a, matrix_b)
-  
-    code = f"""
-#include "FLAME.h"
-#include "FQAM.h"
-#include "__kernels.h"
-#include "assertf.h"
-  int main (void)    
-{{ 
-FLA_Init();
-  
-// Turn on parameter checking
-FLA_Check_error_level_set(FLA_FULL_ERROR_CHECKING);
-FLA_Obj A, B, C_ref, C, ZERO;
-int m, n, p, q, r, c;
-
-// Square matrices dimension
-m = {m};
-n = {n};
-p = {p};
-q = {q};
-r = {m*p};
-c = {n * q};
-
-// Create FLA objects
-FLA_Obj_create_without_buffer(FLA_DOUBLE, m, n, &A);
-FLA_Obj_create_without_buffer(FLA_DOUBLE, p, q, &B);
-FLA_Obj_create_without_buffer(FLA_DOUBLE, r, c, &C_ref);
-FLA_Obj_create(FLA_DOUBLE, r, c, 1, c, &C);
-FLA_Obj_create_constant (0.0, &ZERO);
-FLA_Set(ZERO, C); // Initialize C to all zeros
-
-// Create buffer for operands and reference
-double A_arr[{m}][{n}] = {matrix_to_string(matrix_a)};
-double B_arr[{p}][{q}] = {matrix_to_string(matrix_b)};
-double C_arr_ref[{r}][{c}] = {matrix_to_string(c_ref)};
-
-FLA_Obj_attach_buffer(A_arr, 1, m, &A);
-FLA_Obj_attach_buffer(B_arr, 1, p, &B);
-FLA_Obj_attach_buffer(C_arr_ref, 1, r, &C_ref);
-
-// Execute kernel being tested
-kernel_kron_prod_rec(A, B, C, 2);
-
-// Check success
-bool success = FLA_Obj_equals(C, C_ref);
-if (success)
-  printf ("Passed test {test_id} \\n");
-else
-  printf ("Failed test {test_id} \\n");
-}}
-"""
-    with open(f"test_kron_{test_id}.c", "w") as file:
-      file.write(code)
-    
-    return code
 
+    with open(path, "wb") as file:
+        file.write(struct.pack("=8sII4Q2Q", FIXTURE_MAGIC, FIXTURE_VERSION, 0, m, n, p, q, 0, 0))
+        for matrix in (matrix_a, matrix_b, c_ref):
+            file.write(np.asfortranarray(matrix, dtype=np.float64).tobytes(order="F"))
+
+    print(f"{path}: A {m} x {n}, B {p} x {q}, C {m * p} x {n * q}")
 
-import numpy as np
 
+def gen_kernel_tests(out_dir, min_size=1, max_size=10, num_tests=5, square=False):
+    os.makedirs(out_dir, exist_ok=True)
 
-def gen_kernel_tests(min_size=1, max_size=10, num_tests=5):
     for test_id in range(num_tests):
         size = np.random.randint(min_size, max_size + 1)
-        A = np.random.rand(2**size, 1)
-        
+        A = np.random.rand(2**size, 2**size if square else 1)
+
         size = np.random.randint(min_size, max_size + 1)
-        B = np.random.rand(2**size, 1)
+        B = np.random.rand(2**size, 2**size if square else 1)
 
-        # Generate and print the C code
-        generated_code = generate_matrix_code(A, B, test_id)
-        print(generated_code)
+        write_fixture(A, B, os.path.join(out_dir, f"kron_{test_id}.bin"))
 
 
 if __name__ == "__main__":
-    gen_kernel_tests ()
-    # Define input matrices
-    # matrix_a = np.array([[1, 0], [0, 1]])
-    # matrix_b = np.array ([[0, 1], [1, 0]])
-
-    # A = np.eye (1)
-    # B = np.eye ()
-    # Anp.array (1, 0)
-    # np.array (0, 1)
-
-
-    # print(generated_code)
-    
-
+    parser = argparse.ArgumentParser(description="Generate kronecker product fixtures")
+    parser.add_argument("--num-tests", type=int, default=5)
+    parser.add_argument("--min-size", type=int, default=1)
+    parser.add_argument("--max-size", type=int, default=10)
+    parser.add_argument("--square", action="store_true", help="Square operands")
+    parser.add_argument("--seed", type=int, default=None)
+    parser.add_argument("--out-dir", required=True)
+    args = parser.parse_args()
+
+    np.random.seed(args.seed)
+    gen_kernel_tests(args.out_dir, args.min_size, args.max_size, args.num_tests, args.square)
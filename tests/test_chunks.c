@@ -0,0 +1,88 @@
+/*
+    Copyright (C) 2024, Chuck Garcia
+
+    This file is part of libfqam and is available under the 3-Clause
+    BSD license, which can be found in the LICENSE file at the top-level
+    directory, or at http://opensource.org/licenses/BSD-3-Clause
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "FLAME.h"
+#include "FQAM.h"
+#include "__FQAM_Stage.h"
+#include "assertf.h"
+
+#define TOL 1e-12
+#define QUBITS 9
+
+/* Stages a circuit of local, layer, repeated, rotation and whole register steps,
+ * most of them on high qubits. Staged operators must outlive the stage */
+static void stage_circuit (void)
+{
+  static FQAM_Op H, cx, T, W;
+  FQAM_Op layer[2];
+  FQAM_Pauli_term rotations[3] = {
+      {0.4, 0x101, 0x0C0}, {-0.3, 0x101, 0x103}, {0.9, 0x000, 0x1A1}};
+
+  FQAM_hadamard (&H);
+  FQAM_cnot (&cx);
+  FQAM_Phase_T (&T);
+
+  FQAM_Op_create (&W, "Shift", QUBITS);
+  dcomplex *w = FLA_Obj_buffer_at_view (W.mat_repr);
+  for (int b = 0; b < 1 << QUBITS; b++)
+    w[(b + 3) % (1 << QUBITS) + b * (1 << QUBITS)] = FQAM_CMPXA (0.01 * b);
+
+  layer[0] = H;
+  layer[1] = cx;
+
+  FQAM_stage_append_repeated (H, (int[]){8, 0, 5, 7}, 4);
+  FQAM_stage_append_on (cx, (int[]){8, 1}, 2);
+  FQAM_stage_append_on (T, (int[]){6}, 1);
+  FQAM_stage_append_layer (layer, (int[]){7, 6, 2}, (int[]){1, 2}, 2);
+  FQAM_stage_append_rotations (rotations, 3);
+  FQAM_stage_append_on (cx, (int[]){5, 8}, 2);
+  FQAM_stage_append (W);
+  FQAM_stage_append_on (H, (int[]){4}, 1);
+  FQAM_stage_append_repeated (cx, (int[]){0, 7, 3, 6, 8, 2}, 3);
+  FQAM_stage_append_on (T, (int[]){8}, 1);
+}
+
+/* Final statevector, computed with chunks of 2^chunk_qubits amplitudes */
+static void run (int chunk_qubits, const char *state_dir, dcomplex *psi)
+{
+  FQAM_Config config = FQAM_CONFIG_DEFAULT;
+
+  config.chunk_qubits = chunk_qubits;
+  config.state_dir = state_dir;
+  FQAM_init_config (QUBITS, 6, config);
+  stage_circuit ();
+
+  FQAM_compute_outcomes ();
+  memcpy (psi, FLA_Obj_buffer_at_view (main_stage.statevector),
+          (1 << QUBITS) * sizeof (dcomplex));
+  FQAM_finalize ();
+}
+
+int main (void)
+{
+  dcomplex psi[4][1 << QUBITS];
+  bool success = true;
+
+  run (0, NULL, psi[0]);
+  run (3, NULL, psi[1]);
+  run (4, "/tmp", psi[2]);
+  run (2, NULL, psi[3]);
+
+  for (int r = 1; r < 4; r++)
+    for (int b = 0; b < 1 << QUBITS; b++)
+      success &= fabs (psi[0][b].real - psi[r][b].real) < TOL &&
+                 fabs (psi[0][b].imag - psi[r][b].imag) < TOL;
+
+  if (success)
+    printf ("Passed test chunks \n");
+  else
+    printf ("Failed test chunks \n");
+}
@@ -0,0 +1,107 @@
+/*
+    Copyright (C) 2024, Chuck Garcia
+
+    This file is part of libfqam and is available under the 3-Clause
+    BSD license, which can be found in the LICENSE file at the top-level
+    directory, or at http://opensource.org/licenses/BSD-3-Clause
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "FLAME.h"
+#include "FQAM.h"
+#include "__FQAM_Stage.h"
+#include "assertf.h"
+
+#define TOL 1e-12
+#define QUBITS 6
+#define CIRCUIT_FILE "/tmp/fqam_test_circuit.fqc"
+
+/* Stages a circuit of every step kind, applying equal matrices through distinct
+ * operators. Staged operators must outlive the stage */
+static void stage_circuit (void)
+{
+  static FQAM_Op H, H2, cx, T, W;
+  FQAM_Op layer[2];
+  FQAM_Pauli_term rotations[2] = {{0.3, 0x11, 0x06}, {-0.8, 0x11, 0x22}};
+
+  FQAM_hadamard (&H);
+  FQAM_hadamard (&H2);
+  FQAM_cnot (&cx);
+  FQAM_Phase_T (&T);
+
+  FQAM_Op_create (&W, "Shift", QUBITS);
+  dcomplex *w = FLA_Obj_buffer_at_view (W.mat_repr);
+  for (int b = 0; b < 1 << QUBITS; b++)
+    w[(b + 5) % (1 << QUBITS) + b * (1 << QUBITS)] = FQAM_CMPXA (0.1 * b);
+
+  layer[0] = H2;
+  layer[1] = cx;
+
+  FQAM_stage_append_repeated (H, (int[]){0, 3, 5}, 3);
+  FQAM_stage_append_on (cx, (int[]){0, 4}, 2);
+  FQAM_stage_append_layer (layer, (int[]){1, 2, 4}, (int[]){1, 2}, 2);
+  FQAM_stage_append_depolarizing (2, 0.1);
+  FQAM_stage_append_on (T, (int[]){5}, 1);
+  FQAM_stage_append (W);
+  FQAM_stage_append_rotations (rotations, 2);
+  FQAM_stage_append_amplitude_damping (3, 0.2);
+  FQAM_stage_append_on (H2, (int[]){2}, 1);
+}
+
+/* Density matrix of the final state, of the staged circuit or of its file */
+static void run (bool load, dcomplex *rho)
+{
+  FQAM_Config config = FQAM_CONFIG_DEFAULT;
+  FQAM_Circuit circuit;
+
+  config.backend = FQAM_BACKEND_DENSITY;
+  FQAM_init_config (QUBITS, 9, config);
+
+  if (load)
+    FQAM_circuit_load (CIRCUIT_FILE, &circuit);
+  else
+  {
+    stage_circuit ();
+    FQAM_circuit_save (CIRCUIT_FILE);
+  }
+
+  FQAM_compute_outcomes ();
+  memcpy (rho, FLA_Obj_buffer_at_view (main_stage.statevector),
+          main_stage.state_space * sizeof (dcomplex));
+  FQAM_finalize ();
+
+  if (load)
+  {
+    // Hadamard (stored once for H and H2), CNOT, T, shift, and the four
+    // depolarizing and two damping Kraus operators
+    printf ("Loaded %zu steps, %zu operators\n", circuit.num_steps, circuit.num_ops);
+    assertf (circuit.num_steps == 9 && circuit.num_ops == 4 + 4 + 2,
+             "Error: Unexpected circuit tables");
+    FQAM_circuit_free (&circuit);
+  }
+}
+
+int main (void)
+{
+  size_t size = (size_t)1 << (2 * QUBITS);
+  dcomplex *rho = malloc (2 * size * sizeof (dcomplex));
+  bool success = true;
+
+  run (false, rho);
+  run (true, rho + size);
+
+  for (size_t i = 0; i < size; i++)
+    success &= fabs (rho[i].real - rho[i + size].real) < TOL &&
+               fabs (rho[i].imag - rho[i + size].imag) < TOL;
+
+  unlink (CIRCUIT_FILE);
+  free (rho);
+
+  if (success)
+    printf ("Passed test circuit \n");
+  else
+    printf ("Failed test circuit \n");
+}
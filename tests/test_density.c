@@ -0,0 +1,150 @@
+/*
+    Copyright (C) 2024, Chuck Garcia
+
+    This file is part of libfqam and is available under the 3-Clause
+    BSD license, which can be found in the LICENSE file at the top-level
+    directory, or at http://opensource.org/licenses/BSD-3-Clause
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "FLAME.h"
+#include "FQAM.h"
+#include "__FQAM_Stage.h"
+#include "assertf.h"
+
+#define TOL 1e-10
+#define QUBITS 3
+#define PAULIS (1 << (2 * QUBITS))
+
+/* Stages a unitary circuit covering local, whole register and rotation steps.
+ * Staged operators must outlive the stage */
+static void stage_circuit (void)
+{
+  static FQAM_Op H, cx, T, W;
+  FQAM_Pauli_term rotation = {0.3, 0x3, 0x6}; // X Y Z on qubits 0, 1, 2
+
+  FQAM_hadamard (&H);
+  FQAM_cnot (&cx);
+  FQAM_Phase_T (&T);
+
+  // Whole register: cyclic shift of basis states with phases
+  FQAM_Op_create (&W, "Shift", QUBITS);
+  dcomplex *w = FLA_Obj_buffer_at_view (W.mat_repr);
+  for (int b = 0; b < 1 << QUBITS; b++)
+    w[(b + 1) % (1 << QUBITS) + b * (1 << QUBITS)] = FQAM_CMPXA (0.7 * b);
+
+  FQAM_stage_append_on (H, (int[]){0}, 1);
+  FQAM_stage_append_on (cx, (int[]){0, 2}, 2);
+  FQAM_stage_append_on (T, (int[]){2}, 1);
+  FQAM_stage_append (W);
+  FQAM_stage_append_rotations (&rotation, 1);
+}
+
+/* Populations and every Pauli expectation of the circuit on 'backend' */
+static void run (FQAM_Backend backend, double *probs, double *values)
+{
+  FQAM_Config config = FQAM_CONFIG_DEFAULT;
+  int qubits[QUBITS] = {0, 1, 2};
+
+  config.backend = backend;
+  FQAM_init_config (QUBITS, 1, config);
+  stage_circuit ();
+
+  FQAM_marginal (qubits, QUBITS, probs);
+  for (int s = 0; s < PAULIS; s++)
+  {
+    FQAM_Pauli_sum P;
+    FQAM_Pauli_sum_create (&P);
+    FQAM_Pauli_sum_add_masks (&P, 1.0, s >> QUBITS, s & ((1 << QUBITS) - 1));
+    values[s] = FQAM_expectation (&P);
+    FQAM_Pauli_sum_free (&P);
+  }
+}
+
+static bool results_equal (const double *a, const double *b, size_t n)
+{
+  for (size_t i = 0; i < n; i++)
+    if (fabs (a[i] - b[i]) > TOL)
+      return false;
+  return true;
+}
+
+int main (void)
+{
+  double probs[2][1 << QUBITS], values[2][PAULIS], p[2];
+  bool success = true;
+
+  // Unitary stage: rho stays |psi><psi|
+  run (FQAM_BACKEND_STATEVECTOR, probs[0], values[0]);
+  FQAM_finalize ();
+  run (FQAM_BACKEND_DENSITY, probs[1], values[1]);
+  success &= fabs (FQAM_density_purity () - 1.0) < TOL;
+  FQAM_finalize ();
+
+  success &= results_equal (probs[0], probs[1], 1 << QUBITS);
+  success &= results_equal (values[0], values[1], PAULIS);
+
+  // Channels on a product state, one per qubit
+  FQAM_Config config = FQAM_CONFIG_DEFAULT;
+  FQAM_Op H, X, K[2];
+  FQAM_Basis ket0, ket1;
+  FQAM_Op outer[4];
+  double flip = 0.1;
+
+  config.backend = FQAM_BACKEND_DENSITY;
+  FQAM_init_config (4, 0, config);
+  FQAM_hadamard (&H);
+  FQAM_Pauli_x (&X);
+
+  // Bit flip from outer products: sqrt(1 - p) I and sqrt(p) X
+  ket0 = FQAM_Basis_create (1, 0, 0);
+  ket1 = FQAM_Basis_create (1, 0, 1);
+  FQAM_Basis_outer (ket0, ket0, &outer[0]);
+  FQAM_Basis_outer (ket1, ket1, &outer[1]);
+  FQAM_Basis_outer (ket0, ket1, &outer[2]);
+  FQAM_Basis_outer (ket1, ket0, &outer[3]);
+  FQAM_Op_create (&K[0], "Bit flip", 1);
+  FQAM_Op_create (&K[1], "Bit flip", 1);
+  FQAM_Op_add (FQAM_CMPX (sqrt (1 - flip), 0), outer[0], &K[0]);
+  FQAM_Op_add (FQAM_CMPX (sqrt (1 - flip), 0), outer[1], &K[0]);
+  FQAM_Op_add (FQAM_CMPX (sqrt (flip), 0), outer[2], &K[1]);
+  FQAM_Op_add (FQAM_CMPX (sqrt (flip), 0), outer[3], &K[1]);
+
+  FQAM_stage_append_depolarizing (0, 0.3);
+  FQAM_stage_append_on (H, (int[]){1}, 1);
+  FQAM_stage_append_dephasing (1, 0.25);
+  FQAM_stage_append_on (X, (int[]){2}, 1);
+  FQAM_stage_append_amplitude_damping (2, 0.4);
+  FQAM_stage_append_channel (K, 2, (int[]){3}, 1);
+  FQAM_Operator_free (&K[0]);
+  FQAM_Operator_free (&K[1]);
+
+  FQAM_marginal ((int[]){0}, 1, p);
+  success &= fabs (p[1] - 0.2) < TOL;
+  FQAM_marginal ((int[]){2}, 1, p);
+  success &= fabs (p[1] - 0.6) < TOL;
+  FQAM_marginal ((int[]){3}, 1, p);
+  success &= fabs (p[1] - flip) < TOL;
+
+  FQAM_Pauli_sum X1;
+  FQAM_Pauli_sum_create (&X1);
+  FQAM_Pauli_sum_add (&X1, 1.0, "IX");
+  success &= fabs (FQAM_expectation (&X1) - 0.5) < TOL;
+  FQAM_Pauli_sum_free (&X1);
+
+  // Purity of a product state is the product of purities
+  success &= fabs (FQAM_density_purity () - 0.68 * 0.625 * 0.52 * 0.82) < TOL;
+
+  // Measuring the dephased qubit
+  success &= fabs (FQAM_collapse ((int[]){1}, 1, 1) - 0.5) < TOL;
+  FQAM_marginal ((int[]){1}, 1, p);
+  success &= fabs (p[1] - 1.0) < TOL;
+  FQAM_finalize ();
+
+  if (success)
+    printf ("Passed test density \n");
+  else
+    printf ("Failed test density \n");
+}
@@ -0,0 +1,521 @@
+/*
+    Copyright (C) 2024, Chuck Garcia
+
+    This file is part of libfqam and is available under the 3-Clause
+    BSD license, which can be found in the LICENSE file at the top-level
+    directory, or at http://opensource.org/licenses/BSD-3-Clause
+*/
+
+#include <float.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "FLAME.h"
+#include "FQAM.h"
+#include "__FQAM_Stage.h"
+#include "__kernels.h"
+#include "assertf.h"
+
+/*
+Randomized differential test of the kernels against naive references. Each case
+draws shapes, values, precisions and qubit targets from its own FQAM_Rng stream,
+runs a kernel, and compares every entry with a reference computed entry by entry
+in double precision.
+
+Entries must agree within ulps * eps * bound, where eps is the machine epsilon
+of the state's precision and bound is the reference computed on absolute values
+(e.g. |U| |psi| for a gate), so the tolerance follows the rounding error of any
+summation order. Gates add 2^k + 2 ulps each: a 2^k term dot product and the
+rounding of the stored amplitude. Permutations must match exactly.
+
+Usage: test_differential.x [cases [seed]]
+
+A failing case prints its index and seed, and is replayed alone by running
+with the same seed: case i always uses stream i.
+*/
+
+#define DEFAULT_CASES 4000
+#define DEFAULT_SEED 2024
+
+#define MAX_QUBITS 10
+#define LARGE_QUBITS 13 // Above LAYER_TILE_QUBITS, so gathered tiles are covered
+#define MAX_DENSE_QUBITS 7
+#define MAX_GATES 6
+
+/* Reported failures, later ones are only counted */
+#define MAX_REPORTS 10
+
+typedef enum
+{
+  CASE_KRON,
+  CASE_LOCAL,
+  CASE_LAYER,
+  CASE_SEQUENCE,
+  CASE_REPEATED,
+  CASE_SWAP,
+  CASE_OPERATOR,
+  CASE_ADJACENCY,
+  NUM_CASES
+} case_kind;
+
+static const char *case_names[NUM_CASES] = {
+    "kron", "local", "layer", "sequence", "repeated", "swap", "apply_operator", "adjacency"};
+
+/* Reference statevector: amplitudes and the bound of their rounding error */
+typedef struct
+{
+  int n;
+  bool single;
+  dcomplex *psi;
+  double *bound;
+  double ulps;
+} reference;
+
+static double uniform (FQAM_Rng *rng, double lo, double hi)
+{
+  return lo + (hi - lo) * FQAM_Rng_uniform (rng);
+}
+
+static int uniform_int (FQAM_Rng *rng, int lo, int hi)
+{
+  return lo + FQAM_Rng_u32 (rng) % (hi - lo + 1);
+}
+
+static dcomplex random_amp (FQAM_Rng *rng)
+{
+  return (dcomplex){uniform (rng, -1.0, 1.0), uniform (rng, -1.0, 1.0)};
+}
+
+static double amp_abs (dcomplex a)
+{
+  return hypot (a.real, a.imag);
+}
+
+static dcomplex amp_mul (dcomplex a, dcomplex b)
+{
+  return (dcomplex){a.real * b.real - a.imag * b.imag, a.real * b.imag + a.imag * b.real};
+}
+
+/* Writes 'count' distinct qubits below 'n' to 'qubits' */
+static void random_qubits (FQAM_Rng *rng, int n, int *qubits, int count)
+{
+  int all[64];
+
+  for (int q = 0; q < n; q++)
+    all[q] = q;
+  for (int j = 0; j < count; j++)
+  {
+    int s = uniform_int (rng, j, n - 1), t = all[j];
+    all[j] = all[s];
+    all[s] = t;
+    qubits[j] = all[j];
+  }
+}
+
+/* Entry (r, c) of double or double complex matrix A */
+static dcomplex entry (FLA_Obj A, dim_t r, dim_t c)
+{
+  dim_t i = r * FLA_Obj_row_stride (A) + c * FLA_Obj_col_stride (A);
+
+  if (FLA_Obj_datatype (A) == FLA_DOUBLE)
+    return (dcomplex){((double *)FLA_Obj_buffer_at_view (A))[i], 0.0};
+  return ((dcomplex *)FLA_Obj_buffer_at_view (A))[i];
+}
+
+static void random_matrix (FQAM_Rng *rng, FLA_Datatype type, dim_t m, dim_t n, FLA_Obj *A)
+{
+  FLA_Obj_create (type, m, n, 0, 0, A);
+
+  for (dim_t c = 0; c < n; c++)
+    for (dim_t r = 0; r < m; r++)
+    {
+      dim_t i = r * FLA_Obj_row_stride (*A) + c * FLA_Obj_col_stride (*A);
+      dcomplex a = random_amp (rng);
+
+      if (type == FLA_DOUBLE)
+        ((double *)FLA_Obj_buffer_at_view (*A))[i] = a.real;
+      else
+        ((dcomplex *)FLA_Obj_buffer_at_view (*A))[i] = a;
+    }
+}
+
+/* Creates a random statevector on 'n' qubits and its reference. Single
+ * precision amplitudes are rounded before being copied to the reference */
+static void random_state (FQAM_Rng *rng, int n, bool single, FLA_Obj *state, reference *ref)
+{
+  uint64_t N = 1ULL << n;
+
+  FLA_Obj_create (single ? FLA_COMPLEX : FLA_DOUBLE_COMPLEX, N, 1, 0, 0, state);
+
+  void *psi = FLA_Obj_buffer_at_view (*state);
+
+  ref->n = n;
+  ref->single = single;
+  ref->ulps = 0.0;
+  ref->psi = malloc (N * sizeof (dcomplex));
+  ref->bound = malloc (N * sizeof (double));
+  assertf (ref->psi && ref->bound, "Error: Failed to allocate reference");
+
+  for (uint64_t i = 0; i < N; i++)
+    kernel_amp_set (psi, i, random_amp (rng), single);
+
+  // Reference holds amplitudes as stored, rounded in single precision, read
+  // back in a pass of its own after every store
+  for (uint64_t i = 0; i < N; i++)
+  {
+    ref->psi[i] = kernel_amp_get (psi, i, single);
+    ref->bound[i] = amp_abs (ref->psi[i]);
+  }
+}
+
+static void reference_free (reference *ref)
+{
+  free (ref->psi);
+  free (ref->bound);
+}
+
+/* Applies U to 'targets' of the reference, one output amplitude at a time:
+ * out[i] = sum_l U[i_T][l] psi[i with bits l at the targets] */
+static void reference_apply (reference *ref, FLA_Obj U, const int *targets, int k)
+{
+  uint64_t N = 1ULL << ref->n, mask = 0;
+  dcomplex *out = malloc (N * sizeof (dcomplex));
+  double *bound = malloc (N * sizeof (double));
+
+  assertf (out && bound, "Error: Failed to allocate reference");
+
+  for (int j = 0; j < k; j++)
+    mask |= 1ULL << targets[j];
+
+  for (uint64_t i = 0; i < N; i++)
+  {
+    int r = 0;
+
+    for (int j = 0; j < k; j++)
+      r |= ((i >> targets[j]) & 1) << j;
+
+    out[i] = (dcomplex){0.0, 0.0};
+    bound[i] = 0.0;
+    for (int l = 0; l < 1 << k; l++)
+    {
+      uint64_t src = i & ~mask;
+      dcomplex u = entry (U, r, l), p;
+
+      for (int j = 0; j < k; j++)
+        src |= (uint64_t)((l >> j) & 1) << targets[j];
+
+      p = amp_mul (u, ref->psi[src]);
+      out[i].real += p.real;
+      out[i].imag += p.imag;
+      bound[i] += amp_abs (u) * ref->bound[src];
+    }
+  }
+
+  free (ref->psi);
+  free (ref->bound);
+  ref->psi = out;
+  ref->bound = bound;
+  ref->ulps += (1 << k) + 2;
+}
+
+/* Whether 'value' is within 'ulps' units of 'eps' scaled by 'bound' of 'expected' */
+static bool within (dcomplex value, dcomplex expected, double bound, double ulps, double eps)
+{
+  double tol = ulps * eps * bound;
+
+  return fabs (value.real - expected.real) <= tol && fabs (value.imag - expected.imag) <= tol;
+}
+
+/* Compares 'state' with its reference, returning the first differing index or
+ * -1 */
+static long compare_state (FLA_Obj state, const reference *ref)
+{
+  const void *psi = FLA_Obj_buffer_at_view (state);
+  double eps = ref->single ? FLT_EPSILON : DBL_EPSILON;
+
+  for (uint64_t i = 0; i < 1ULL << ref->n; i++)
+    if (!within (kernel_amp_get (psi, i, ref->single), ref->psi[i], ref->bound[i], ref->ulps,
+                 eps))
+      return i;
+  return -1;
+}
+
+/* Kronecker product of square or column vector operands, real or complex */
+static long check_kron (FQAM_Rng *rng, char *shape)
+{
+  FLA_Datatype type = FQAM_Rng_u32 (rng) % 2 ? FLA_DOUBLE : FLA_DOUBLE_COMPLEX;
+  bool square = FQAM_Rng_u32 (rng) % 2;
+  dim_t m = 1 << uniform_int (rng, 0, square ? 4 : 7);
+  dim_t p = 1 << uniform_int (rng, 0, square ? 4 : 7);
+  dim_t n = square ? m : 1, q = square ? p : 1;
+  FLA_Obj A, B, C;
+  long failed = -1;
+
+  sprintf (shape, "%s %zu x %zu (x) %zu x %zu", type == FLA_DOUBLE ? "real" : "complex",
+           (size_t)m, (size_t)n, (size_t)p, (size_t)q);
+
+  random_matrix (rng, type, m, n, &A);
+  random_matrix (rng, type, p, q, &B);
+  FLA_Obj_create (type, m * p, n * q, 0, 0, &C);
+  FLA_Set (FLA_ZERO, C);
+
+  kernel_kron_prod_rec (A, B, C, 2);
+
+  // C[i p + k][j q + l] = A[i][j] B[k][l], a single product per entry
+  for (dim_t c = 0; c < n * q && failed < 0; c++)
+    for (dim_t r = 0; r < m * p && failed < 0; r++)
+    {
+      dcomplex a = entry (A, r / p, c / q), b = entry (B, r % p, c % q);
+
+      if (!within (entry (C, r, c), amp_mul (a, b), amp_abs (a) * amp_abs (b), 2,
+                   DBL_EPSILON))
+        failed = r + c * m * p;
+    }
+
+  FLA_Obj_free (&A);
+  FLA_Obj_free (&B);
+  FLA_Obj_free (&C);
+  return failed;
+}
+
+/* Local gates, applied one at a time, as a layer on disjoint targets, as an
+ * ordered sequence or repeated on random sites */
+static long check_gates (FQAM_Rng *rng, case_kind kind, char *shape)
+{
+  int n = FQAM_Rng_u32 (rng) % 4 ? uniform_int (rng, 1, MAX_QUBITS) : LARGE_QUBITS;
+  bool single = FQAM_Rng_u32 (rng) % 2;
+  int num_gates = kind == CASE_LOCAL ? 1 : uniform_int (rng, 1, MAX_GATES);
+  int k = uniform_int (rng, 1, min (n, 3));
+  int targets[MAX_GATES][FQAM_MAX_TARGETS], sites[MAX_GATES * FQAM_MAX_TARGETS];
+  int qubits[64];
+  FLA_Obj state, U[MAX_GATES];
+  kernel_gate_t gates[MAX_GATES];
+  reference ref;
+
+  // Disjoint targets for a layer, so at most n / k gates
+  if (kind == CASE_LAYER)
+  {
+    num_gates = min (num_gates, n / k);
+    random_qubits (rng, n, qubits, num_gates * k);
+  }
+
+  random_state (rng, n, single, &state, &ref);
+
+  for (int g = 0; g < num_gates; g++)
+  {
+    // Gates of a sequence have their own sizes, repeated gates share one
+    int kg = kind == CASE_SEQUENCE ? uniform_int (rng, 1, min (n, 3)) : k;
+
+    if (kind == CASE_LAYER)
+      memcpy (targets[g], qubits + g * k, k * sizeof (int));
+    else
+      random_qubits (rng, n, targets[g], kg);
+
+    if (kind != CASE_REPEATED || g == 0)
+      random_matrix (rng, FLA_DOUBLE_COMPLEX, 1 << kg, 1 << kg, &U[g]);
+
+    if (kind == CASE_REPEATED)
+      memcpy (sites + g * k, targets[g], k * sizeof (int));
+    gates[g] = (kernel_gate_t){U[kind == CASE_REPEATED ? 0 : g], targets[g], kg};
+    reference_apply (&ref, gates[g].U, targets[g], kg);
+  }
+
+  sprintf (shape, "%s, %d qubits, %d gates, first on %d qubits",
+           single ? "single" : "double", n, num_gates, gates[0].num_targets);
+
+  if (kind == CASE_LOCAL)
+    kernel_apply_local (state, U[0], targets[0], k);
+  else if (kind == CASE_LAYER)
+    kernel_apply_layer (state, gates, num_gates);
+  else if (kind == CASE_SEQUENCE)
+    kernel_apply_sequence (state, gates, num_gates);
+  else
+    kernel_apply_repeated (state, U[0], sites, num_gates, k);
+
+  long failed = compare_state (state, &ref);
+
+  for (int g = 0; g < (kind == CASE_REPEATED ? 1 : num_gates); g++)
+    FLA_Obj_free (&U[g]);
+  FLA_Obj_free (&state);
+  reference_free (&ref);
+  return failed;
+}
+
+/* Swaps of disjoint qubit pairs, an exact permutation */
+static long check_swap (FQAM_Rng *rng, char *shape)
+{
+  int n = uniform_int (rng, 2, MAX_QUBITS);
+  int num_pairs = uniform_int (rng, 1, n / 2), qubits[64], a[32], b[32];
+  bool single = FQAM_Rng_u32 (rng) % 2;
+  FLA_Obj state;
+  reference ref;
+  dcomplex *psi;
+
+  sprintf (shape, "%s, %d qubits, %d pairs", single ? "single" : "double", n, num_pairs);
+
+  random_qubits (rng, n, qubits, 2 * num_pairs);
+  for (int j = 0; j < num_pairs; j++)
+  {
+    a[j] = qubits[2 * j];
+    b[j] = qubits[2 * j + 1];
+  }
+
+  random_state (rng, n, single, &state, &ref);
+  psi = malloc ((1ULL << n) * sizeof (dcomplex));
+  assertf (psi, "Error: Failed to allocate reference");
+
+  // Amplitude i moves to i with the bits of each pair exchanged
+  for (uint64_t i = 0; i < 1ULL << n; i++)
+  {
+    uint64_t t = i;
+
+    for (int j = 0; j < num_pairs; j++)
+      if (((i >> a[j]) & 1) != ((i >> b[j]) & 1))
+        t ^= 1ULL << a[j] | 1ULL << b[j];
+    psi[t] = ref.psi[i];
+  }
+  free (ref.psi);
+  ref.psi = psi;
+
+  kernel_swap_qubits (state, a, b, num_pairs);
+
+  long failed = compare_state (state, &ref);
+
+  FLA_Obj_free (&state);
+  reference_free (&ref);
+  return failed;
+}
+
+/* Whole register operator through apply_operator, applied to a statevector
+ * standing in for the stage's */
+static long check_operator (FQAM_Rng *rng, char *shape)
+{
+  int n = uniform_int (rng, 1, MAX_DENSE_QUBITS);
+  bool single = FQAM_Rng_u32 (rng) % 2;
+  int all[64];
+  FLA_Obj state, U, saved = main_stage.statevector;
+  reference ref;
+
+  sprintf (shape, "%s, %d qubits", single ? "single" : "double", n);
+
+  random_state (rng, n, single, &state, &ref);
+  random_matrix (rng, FLA_DOUBLE_COMPLEX, 1 << n, 1 << n, &U);
+  for (int q = 0; q < n; q++)
+    all[q] = q;
+  reference_apply (&ref, U, all, n);
+
+  main_stage.statevector = state;
+  apply_operator (U);
+  main_stage.statevector = saved;
+
+  long failed = compare_state (state, &ref);
+
+  FLA_Obj_free (&U);
+  FLA_Obj_free (&state);
+  reference_free (&ref);
+  return failed;
+}
+
+/* Probability adjacency matrix, C[j][i] = A[i][j] psi[j] */
+static long check_adjacency (FQAM_Rng *rng, char *shape)
+{
+  int n = uniform_int (rng, 1, MAX_DENSE_QUBITS);
+  bool single = FQAM_Rng_u32 (rng) % 2;
+  dim_t N = 1 << n;
+  FLA_Obj state, A, C;
+  reference ref;
+  long failed = -1;
+
+  sprintf (shape, "%s, %d qubits", single ? "single" : "double", n);
+
+  random_state (rng, n, single, &state, &ref);
+  random_matrix (rng, FLA_DOUBLE_COMPLEX, N, N, &A);
+  FLA_Obj_create (FLA_DOUBLE_COMPLEX, N, N, 0, 0, &C);
+  FLA_Set (FLA_ZERO, C);
+
+  compute_probability_adjacency_matrix (A, state, C);
+
+  for (dim_t j = 0; j < N && failed < 0; j++)
+    for (dim_t i = 0; i < N && failed < 0; i++)
+    {
+      dcomplex a = entry (A, i, j), b = ref.psi[j];
+
+      if (!within (entry (C, j, i), amp_mul (a, b), amp_abs (a) * amp_abs (b), 2,
+                   DBL_EPSILON))
+        failed = j + i * N;
+    }
+
+  FLA_Obj_free (&A);
+  FLA_Obj_free (&C);
+  FLA_Obj_free (&state);
+  reference_free (&ref);
+  return failed;
+}
+
+static long check_case (case_kind kind, FQAM_Rng *rng, char *shape)
+{
+  switch (kind)
+  {
+  case CASE_KRON:
+    return check_kron (rng, shape);
+  case CASE_SWAP:
+    return check_swap (rng, shape);
+  case CASE_OPERATOR:
+    return check_operator (rng, shape);
+  case CASE_ADJACENCY:
+    return check_adjacency (rng, shape);
+  default:
+    return check_gates (rng, kind, shape);
+  }
+}
+
+int main (int argc, char **argv)
+{
+  long cases = argc > 1 ? atol (argv[1]) : DEFAULT_CASES;
+  unsigned long long seed = argc > 2 ? strtoull (argv[2], NULL, 0) : DEFAULT_SEED;
+  long failures[NUM_CASES] = {0}, failed = 0;
+  struct timespec t0, t1;
+
+  assertf (cases > 0, "Error: Expected a positive case count");
+
+  // Initializes libflame, and provides the stage apply_operator works on
+  FQAM_init (1, 0);
+
+  clock_gettime (CLOCK_MONOTONIC, &t0);
+
+  for (long c = 0; c < cases; c++)
+  {
+    case_kind kind = c % NUM_CASES;
+    FQAM_Rng rng;
+    char shape[128];
+    long index;
+
+    FQAM_Rng_init (&rng, seed, c);
+    index = check_case (kind, &rng, shape);
+    if (index < 0)
+      continue;
+
+    if (failed++ < MAX_REPORTS)
+      printf ("Case %ld (seed %llu) %s: %s differs at entry %ld\n", c, seed,
+              case_names[kind], shape, index);
+    failures[kind]++;
+  }
+
+  clock_gettime (CLOCK_MONOTONIC, &t1);
+  FQAM_finalize ();
+
+  double seconds = (t1.tv_sec - t0.tv_sec) + (t1.tv_nsec - t0.tv_nsec) * 1e-9;
+
+  printf ("%ld cases in %.2f s (%.0f cases/s)", cases, seconds, cases / seconds);
+  for (int k = 0; k < NUM_CASES; k++)
+    if (failures[k])
+      printf (", %ld %s failed", failures[k], case_names[k]);
+  printf ("\n");
+
+  if (failed == 0)
+    printf ("Passed test differential \n");
+  else
+    printf ("Failed test differential \n");
+}
@@ -0,0 +1,171 @@
+/*
+    Copyright (C) 2024, Chuck Garcia
+
+    This file is part of libfqam and is available under the 3-Clause
+    BSD license, which can be found in the LICENSE file at the top-level
+    directory, or at http://opensource.org/licenses/BSD-3-Clause
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "FLAME.h"
+#include "FQAM.h"
+#include "__FQAM_Stage.h"
+#include "assertf.h"
+
+#define TOL 1e-12
+#define QUBITS 14
+
+/* Terms sharing x_mask {0, 3, 5} with Z supports small enough for the
+ * histogram, carrying 0 to 3 factors of i */
+static const char *small_group[] = {"XZZYIXIIIIIIII", "YIZYIYIIIIIIZI",
+                                    "XIIXZXIIIIIIIZ", "YZIYIXIIIIIIII"};
+
+/* Terms whose Z support spans 13 and 14 qubits */
+static const char *wide_group[] = {"XZZZZZZZZZZZZY", "YZZZZZZZZZZZZX",
+                                   "IZZZZZZZZZZZZZ"};
+
+/* <psi|P|psi> by applying the letters of 'pauli' one qubit at a time to a copy */
+static double naive_expectation (const dcomplex *psi, const char *pauli)
+{
+  uint64_t N = 1ULL << QUBITS;
+  dcomplex *phi = malloc (N * sizeof (dcomplex));
+  dcomplex *next = malloc (N * sizeof (dcomplex));
+  double total = 0.0;
+
+  assertf (phi && next, "Error: Failed to allocate reference state");
+  memcpy (phi, psi, N * sizeof (dcomplex));
+
+  for (int q = 0; q < QUBITS; q++)
+  {
+    uint64_t bit = 1ULL << q;
+
+    for (uint64_t b = 0; b < N; b++)
+    {
+      dcomplex a = phi[b];
+      bool one = b & bit;
+
+      // X|b> = |b ^ bit>, Z|b> = (-1)^b|b>, Y|0> = i|1>, Y|1> = -i|0>
+      switch (pauli[q])
+      {
+      case 'X': next[b ^ bit] = a; break;
+      case 'Z': next[b] = one ? (dcomplex){-a.real, -a.imag} : a; break;
+      case 'Y':
+        next[b ^ bit] = one ? (dcomplex){a.imag, -a.real} : (dcomplex){-a.imag, a.real};
+        break;
+      default: next[b] = a; break;
+      }
+    }
+    memcpy (phi, next, N * sizeof (dcomplex));
+  }
+
+  for (uint64_t b = 0; b < N; b++)
+    total += psi[b].real * phi[b].real + psi[b].imag * phi[b].imag;
+
+  free (phi);
+  free (next);
+  return total;
+}
+
+/* Checks each term of 'group' alone and their weighted sum against the naive
+ * reference on the loaded state */
+static bool check_group (const char **group, int num_terms)
+{
+  const dcomplex *psi = FLA_Obj_buffer_at_view (main_stage.statevector);
+  FQAM_Pauli_sum term, sum;
+  double expected = 0.0;
+  bool success = true;
+
+  FQAM_Pauli_sum_create (&sum);
+  for (int t = 0; t < num_terms; t++)
+  {
+    double reference = naive_expectation (psi, group[t]);
+
+    FQAM_Pauli_sum_create (&term);
+    FQAM_Pauli_sum_add (&term, 1.0, group[t]);
+    success &= fabs (FQAM_expectation (&term) - reference) < TOL;
+    FQAM_Pauli_sum_free (&term);
+
+    FQAM_Pauli_sum_add (&sum, t + 0.5, group[t]);
+    expected += (t + 0.5) * reference;
+  }
+
+  success &= fabs (FQAM_expectation (&sum) - expected) < TOL;
+  FQAM_Pauli_sum_free (&sum);
+  return success;
+}
+
+int main (void)
+{
+  FQAM_Op H, P;
+  FQAM_Pauli_sum X, Y, Z, sum;
+  bool success = true;
+
+  FQAM_init (1, 0);
+  FQAM_hadamard (&H);
+  FQAM_PhaseA (M_PI / 2, &P);
+
+  FQAM_Pauli_sum_create (&X);
+  FQAM_Pauli_sum_create (&Y);
+  FQAM_Pauli_sum_create (&Z);
+  FQAM_Pauli_sum_create (&sum);
+  FQAM_Pauli_sum_add (&X, 1.0, "X");
+  FQAM_Pauli_sum_add (&Y, 1.0, "Y");
+  FQAM_Pauli_sum_add (&Z, 1.0, "Z");
+
+  // |0>: <Z> = 1, <X> = <Y> = 0
+  success &= fabs (FQAM_expectation (&Z) - 1.0) < TOL;
+  success &= fabs (FQAM_expectation (&X)) < TOL;
+
+  // |+>: <X> = 1
+  FQAM_stage_append (H);
+  success &= fabs (FQAM_expectation (&X) - 1.0) < TOL;
+  success &= fabs (FQAM_expectation (&Z)) < TOL;
+
+  // |+i> = S|+>: <Y> = 1
+  FQAM_stage_append (P);
+  success &= fabs (FQAM_expectation (&Y) - 1.0) < TOL;
+
+  // Weighted sum mixing groups: 2X - 3Y + 0.5Z + 4I
+  FQAM_Pauli_sum_add (&sum, 2.0, "X");
+  FQAM_Pauli_sum_add (&sum, -3.0, "Y");
+  FQAM_Pauli_sum_add (&sum, 0.5, "Z");
+  FQAM_Pauli_sum_add (&sum, 4.0, "I");
+  success &= fabs (FQAM_expectation (&sum) - 1.0) < TOL;
+  FQAM_finalize ();
+
+  // Random 14 qubit state
+  FQAM_Rng rng;
+  double norm = 0.0;
+
+  FQAM_init (QUBITS, 0);
+  FQAM_Rng_init (&rng, 29, 0);
+  dcomplex *buf = FLA_Obj_buffer_at_view (main_stage.statevector);
+  for (int i = 0; i < 1 << QUBITS; i++)
+  {
+    buf[i].real = FQAM_Rng_uniform (&rng) - 0.5;
+    buf[i].imag = FQAM_Rng_uniform (&rng) - 0.5;
+    norm += buf[i].real * buf[i].real + buf[i].imag * buf[i].imag;
+  }
+  for (int i = 0; i < 1 << QUBITS; i++)
+  {
+    buf[i].real /= sqrt (norm);
+    buf[i].imag /= sqrt (norm);
+  }
+
+  // One x_mask group read off a transformed histogram, one summed directly
+  success &= check_group (small_group, 4);
+  success &= check_group (wide_group, 3);
+
+  if (success)
+    printf ("Passed test expectation \n");
+  else
+    printf ("Failed test expectation \n");
+
+  FQAM_Pauli_sum_free (&X);
+  FQAM_Pauli_sum_free (&Y);
+  FQAM_Pauli_sum_free (&Z);
+  FQAM_Pauli_sum_free (&sum);
+  FQAM_finalize ();
+}
@@ -0,0 +1,82 @@
+/*
+    Copyright (C) 2024, Chuck Garcia
+
+    This file is part of libfqam and is available under the 3-Clause
+    BSD license, which can be found in the LICENSE file at the top-level
+    directory, or at http://opensource.org/licenses/BSD-3-Clause
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "FLAME.h"
+#include "FQAM.h"
+#include "__FQAM_Stage.h"
+#include "assertf.h"
+
+#define TOL 1e-12
+#define QUBITS 14
+
+/* Stages runs of gate steps on low and high qubits sharing targets, split by a
+ * rotation step.
+ * Staged operators must outlive the stage */
+static void stage_circuit (void)
+{
+  static FQAM_Op H, cx, T;
+  FQAM_Op layer[2];
+  FQAM_Pauli_term rotation = {0.7, 0x2001, 0x0410};
+
+  FQAM_hadamard (&H);
+  FQAM_cnot (&cx);
+  FQAM_Phase_T (&T);
+
+  layer[0] = H;
+  layer[1] = cx;
+
+  FQAM_stage_append_repeated (H, (int[]){0, 3, 13, 7, 12}, 5);
+  FQAM_stage_append_on (cx, (int[]){0, 5}, 2);
+  FQAM_stage_append_on (H, (int[]){2}, 1);
+  FQAM_stage_append_on (T, (int[]){2}, 1);
+  FQAM_stage_append_on (cx, (int[]){13, 2}, 2);
+  FQAM_stage_append_on (H, (int[]){2}, 1);
+  FQAM_stage_append_layer (layer, (int[]){1, 12, 4}, (int[]){1, 2}, 2);
+  FQAM_stage_append_on (T, (int[]){12}, 1);
+  FQAM_stage_append_rotations (&rotation, 1);
+  FQAM_stage_append_on (cx, (int[]){4, 11}, 2);
+  FQAM_stage_append_on (H, (int[]){9}, 1);
+  FQAM_stage_append_repeated (cx, (int[]){3, 6, 12, 9}, 2);
+  FQAM_stage_append_on (T, (int[]){6}, 1);
+}
+
+/* Final statevector, computed with a checkpoint after every step (no fusion)
+ * or without checkpoints (fused runs of gate steps) */
+static void run (bool fused, dcomplex *psi)
+{
+  FQAM_init (QUBITS, 9);
+  FQAM_stage_set_checkpoint_budget (fused ? 0 : SIZE_MAX);
+  stage_circuit ();
+
+  FQAM_compute_outcomes ();
+  memcpy (psi, FLA_Obj_buffer_at_view (main_stage.statevector),
+          (1 << QUBITS) * sizeof (dcomplex));
+  FQAM_finalize ();
+}
+
+int main (void)
+{
+  dcomplex *psi = malloc (2 * (1 << QUBITS) * sizeof (dcomplex));
+  bool success = true;
+
+  run (false, psi);
+  run (true, psi + (1 << QUBITS));
+
+  for (int b = 0; b < 1 << QUBITS; b++)
+    success &= fabs (psi[b].real - psi[b + (1 << QUBITS)].real) < TOL &&
+               fabs (psi[b].imag - psi[b + (1 << QUBITS)].imag) < TOL;
+  free (psi);
+
+  if (success)
+    printf ("Passed test fusion \n");
+  else
+    printf ("Failed test fusion \n");
+}
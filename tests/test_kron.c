@@ -0,0 +1,207 @@
+/*
+    Copyright (C) 2024, Chuck Garcia
+
+    This file is part of libfqam and is available under the 3-Clause
+    BSD license, which can be found in the LICENSE file at the top-level
+    directory, or at http://opensource.org/licenses/BSD-3-Clause
+*/
+
+#include <dirent.h>
+#include <fcntl.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+#include "FLAME.h"
+#include "FQAM.h"
+#include "__kernels.h"
+#include "assertf.h"
+
+/*
+Checks kernel_kron_prod_rec against fixtures written by gen_kernel_ten_test.py,
+timing each product. Fixtures are mapped read only and their operands and
+reference attached in place, so only C is allocated:
+
+    header      kron_header                        (64 bytes)
+    A           m x n column major doubles
+    B           p x q column major doubles
+    C_ref       mp x nq column major doubles
+
+Usage: test_kron.x [fixture or directory ...]
+
+With no arguments, every kron_*.bin in FQAM_FIXTURE_DIR is checked. Large
+fixtures (e.g. --square --min-size 6 --max-size 6, 2^12 x 2^12 products) are
+generated into another directory and passed here.
+*/
+
+#ifndef FQAM_FIXTURE_DIR
+#define FQAM_FIXTURE_DIR "tests/fixtures"
+#endif
+
+#define FIXTURE_MAGIC "FQAMKRON"
+#define FIXTURE_VERSION 1
+
+typedef struct
+{
+  char magic[8];
+  uint32_t version;
+  uint32_t reserved;
+  uint64_t m, n, p, q;
+  uint64_t reserved_tail[2];
+} kron_header;
+
+_Static_assert (sizeof (kron_header) == 64, "Fixture header is 64 bytes");
+
+static double now_ms (void)
+{
+  struct timespec t;
+
+  clock_gettime (CLOCK_MONOTONIC, &t);
+  return t.tv_sec * 1e3 + t.tv_nsec * 1e-6;
+}
+
+/* Checks one fixture, returning whether the product matched its reference */
+static bool check_fixture (const char *path)
+{
+  int fd = open (path, O_RDONLY);
+  struct stat st;
+
+  assertf (fd >= 0, "Error: Failed to open fixture %s", path);
+  assertf (fstat (fd, &st) == 0 && (size_t)st.st_size >= sizeof (kron_header),
+           "Error: Fixture %s is truncated", path);
+
+  size_t size = st.st_size;
+  const char *base = mmap (NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+  close (fd);
+  assertf (base != MAP_FAILED, "Error: Failed to map fixture %s", path);
+
+  const kron_header *h = (const kron_header *)base;
+
+  assertf (memcmp (h->magic, FIXTURE_MAGIC, sizeof (h->magic)) == 0,
+           "Error: %s is not a kronecker fixture", path);
+  assertf (h->version == FIXTURE_VERSION, "Error: Fixture %s has unsupported version %u",
+           path, h->version);
+
+  dim_t m = h->m, n = h->n, p = h->p, q = h->q;
+  size_t entries = m * n + p * q + m * p * n * q;
+
+  assertf (size == sizeof (kron_header) + entries * sizeof (double),
+           "Error: Fixture %s does not hold %zu x %zu and %zu x %zu operands", path,
+           (size_t)m, (size_t)n, (size_t)p, (size_t)q);
+
+  double *A_arr = (double *)(base + sizeof (kron_header));
+  double *B_arr = A_arr + m * n;
+  double *C_arr_ref = B_arr + p * q;
+  FLA_Obj A, B, C_ref, C;
+
+  // Operands are only read, so the mapping is attached as is
+  FLA_Obj_create_without_buffer (FLA_DOUBLE, m, n, &A);
+  FLA_Obj_create_without_buffer (FLA_DOUBLE, p, q, &B);
+  FLA_Obj_create_without_buffer (FLA_DOUBLE, m * p, n * q, &C_ref);
+  FLA_Obj_attach_buffer (A_arr, 1, m, &A);
+  FLA_Obj_attach_buffer (B_arr, 1, p, &B);
+  FLA_Obj_attach_buffer (C_arr_ref, 1, m * p, &C_ref);
+
+  FLA_Obj_create (FLA_DOUBLE, m * p, n * q, 0, 0, &C);
+  FLA_Set (FLA_ZERO, C);
+
+  double start = now_ms ();
+  kernel_kron_prod_rec (A, B, C, 2);
+  double ms = now_ms () - start;
+
+  // Every entry is a single product, so it matches numpy exactly
+  bool success = FLA_Obj_equals (C, C_ref);
+
+  printf ("%s: %zu x %zu (x) %zu x %zu in %.3f ms, %.2f GB/s\n", path, (size_t)m,
+          (size_t)n, (size_t)p, (size_t)q, ms,
+          ms > 0 ? 2.0 * m * p * n * q * sizeof (double) / ms * 1e-6 : 0.0);
+
+  FLA_Obj_free (&C);
+  FLA_Obj_free_without_buffer (&A);
+  FLA_Obj_free_without_buffer (&B);
+  FLA_Obj_free_without_buffer (&C_ref);
+  munmap ((void *)base, size);
+  return success;
+}
+
+static int compare_names (const void *a, const void *b)
+{
+  return strcmp (*(char *const *)a, *(char *const *)b);
+}
+
+/* Checks every kron_*.bin in 'dir' in name order, counting them in 'checked' */
+static bool check_directory (const char *dir, int *checked)
+{
+  DIR *d = opendir (dir);
+  char **names = NULL;
+  size_t count = 0;
+  bool success = true;
+
+  assertf (d, "Error: Failed to open fixture directory %s", dir);
+
+  for (struct dirent *e = readdir (d); e; e = readdir (d))
+  {
+    size_t len = strlen (e->d_name);
+
+    if (strncmp (e->d_name, "kron_", 5) || len < 4 || strcmp (e->d_name + len - 4, ".bin"))
+      continue;
+
+    names = realloc (names, (count + 1) * sizeof (char *));
+    assertf (names, "Error: Failed to allocate fixture names");
+    names[count] = malloc (strlen (dir) + len + 2);
+    assertf (names[count], "Error: Failed to allocate fixture names");
+    sprintf (names[count++], "%s/%s", dir, e->d_name);
+  }
+  closedir (d);
+
+  qsort (names, count, sizeof (char *), compare_names);
+
+  for (size_t i = 0; i < count; i++)
+  {
+    success &= check_fixture (names[i]);
+    free (names[i]);
+  }
+  free (names);
+
+  *checked += count;
+  return success;
+}
+
+int main (int argc, char **argv)
+{
+  bool success = true;
+  int checked = 0;
+
+  FLA_Init ();
+  FLA_Check_error_level_set (FLA_FULL_ERROR_CHECKING);
+
+  if (argc == 1)
+    success &= check_directory (FQAM_FIXTURE_DIR, &checked);
+
+  for (int i = 1; i < argc; i++)
+  {
+    struct stat st;
+
+    assertf (stat (argv[i], &st) == 0, "Error: Failed to open fixture %s", argv[i]);
+    if (S_ISDIR (st.st_mode))
+      success &= check_directory (argv[i], &checked);
+    else
+    {
+      success &= check_fixture (argv[i]);
+      checked++;
+    }
+  }
+
+  FLA_Finalize ();
+
+  // An empty fixture directory is a failure, not a pass
+  if (success && checked > 0)
+    printf ("Passed test kron \n");
+  else
+    printf ("Failed test kron \n");
+}
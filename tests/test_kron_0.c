@@ -1,16750 +0,0 @@
-
-#include "FLAME.h"
-#include "FQAM.h"
-#include "__kernels.h"
-#include "assertf.h"
-  int main (void)    
-{ 
-FLA_Init();
-  
-// Turn on parameter checking
-FLA_Check_error_level_set(FLA_FULL_ERROR_CHECKING);
-FLA_Obj A, B, C_ref, C, ZERO;
-int m, n, p, q, r, c;
-
-// Square matrices dimension
-m = 64;
-n = 1;
-p = 256;
-q = 1;
-r = 16384;
-c = 1;
-
-// Create FLA objects
-FLA_Obj_create_without_buffer(FLA_DOUBLE, m, n, &A);
-FLA_Obj_create_without_buffer(FLA_DOUBLE, p, q, &B);
-FLA_Obj_create_without_buffer(FLA_DOUBLE, r, c, &C_ref);
-FLA_Obj_create(FLA_DOUBLE, r, c, 1, c, &C);
-FLA_Obj_create_constant (0.0, &ZERO);
-FLA_Set(ZERO, C); // Initialize C to all zeros
-
-// Create buffer for operands and reference
-double A_arr[64][1] = {{0.5999613600127738},
- {0.6706743969417505},
- {0.5637948827715884},
- {0.5302830851623626},
- {0.49232841639424374},
- {0.45458591578171614},
- {0.8519319647576812},
- {0.8698828836408298},
- {0.7394510041489044},
- {0.6864861147324247},
- {0.8466366845710145},
- {0.4518693320567613},
- {0.3701258137821979},
- {0.3638144827770513},
- {0.4356889245325112},
- {0.0915393938152056},
- {0.9726056255681568},
- {0.9958906322548765},
- {0.9593030607044675},
- {0.6526269950067558},
- {0.6364199314799981},
- {0.15052553449016837},
- {0.5428303307445248},
- {0.3157674021302691},
- {0.24030307133157403},
- {0.20118457343373608},
- {0.3892975578413379},
- {0.8501639140942677},
- {0.7477944275460079},
- {0.8347024387173543},
- {0.6864752551378703},
- {0.5813097966318659},
- {0.4232247575853584},
- {0.03919590143384177},
- {0.303700317009691},
- {0.5721878345506545},
- {0.3142200634340029},
- {0.26778357336632563},
- {0.5986266657455852},
- {0.20134300708395136},
- {0.7458065589389231},
- {0.33638146102658073},
- {0.33750089461864186},
- {0.8034330168530084},
- {0.2982875407784259},
- {0.5453750543310297},
- {0.23353726100974703},
- {0.19239891354629834},
- {0.7059035639974185},
- {0.07910991130966283},
- {0.7761181243927213},
- {0.6735542306662875},
- {0.7371081129633391},
- {0.638568310006064},
- {0.6445382544571806},
- {0.7830744951134987},
- {0.9804148483787343},
- {0.6416693461681144},
- {0.9923723052053626},
- {0.16447067956049044},
- {0.6674051573478018},
- {0.44392673057257226},
- {0.3391951947164681},
- {0.4652016382679478}};
-double B_arr[256][1] = {{0.8652043033913779},
- {0.5090307860806694},
- {0.3669983929448334},
- {0.7436987571961269},
- {0.28499241352163607},
- {0.41197080055993174},
- {0.2063410998991837},
- {0.9663315462642489},
- {0.09664619395538177},
- {0.7823553209054633},
- {0.9346202948820267},
- {0.28499243448274236},
- {0.7530159912731199},
- {0.5540108135657311},
- {0.19201227685253108},
- {0.8431511369486242},
- {0.36146497528934396},
- {0.6776618104635495},
- {0.3758941998906713},
- {0.28637485526374806},
- {0.8591295377644471},
- {0.5040091006028474},
- {0.11766537958388779},
- {0.9449974079361882},
- {0.20598488816216465},
- {0.910906136149885},
- {0.059785824259570686},
- {0.29885015808662685},
- {0.5425494654890278},
- {0.8925617092182405},
- {0.2899966115374074},
- {0.24395016568811612},
- {0.6167529824931844},
- {0.42905216620391273},
- {0.38893085547422845},
- {0.15749902724276432},
- {0.22314922065872866},
- {0.6857595417203673},
- {0.043162673556826237},
- {0.22030532617860865},
- {0.892653688189511},
- {0.32895367095711936},
- {0.0721087669331485},
- {0.585769330531831},
- {0.10777604759903103},
- {0.054293730366514525},
- {0.7376306157369934},
- {0.7857140434112492},
- {0.9804113972325182},
- {0.4198745358529756},
- {0.6539709892192339},
- {0.6694116668589115},
- {0.562130440872218},
- {0.8437631536248181},
- {0.011287900410609675},
- {0.320333187296005},
- {0.43418372993223475},
- {0.3140176954265106},
- {0.19069307942478064},
- {0.8696749931630811},
- {0.17707116501182552},
- {0.7367140278791181},
- {0.8832010493832437},
- {0.45880933812325886},
- {0.7162028207599153},
- {0.10563428431750466},
- {0.38096383676171486},
- {0.8441890573899328},
- {0.35002449653152845},
- {0.02627996894459428},
- {0.4429926227111195},
- {0.6676896818269178},
- {0.9764074171702618},
- {0.9269605662623233},
- {0.9832399124634376},
- {0.8097360707276485},
- {0.7509975723320264},
- {0.5894344528909171},
- {0.6332362852219763},
- {0.4510202074895546},
- {0.28207321184806},
- {0.8796034181933284},
- {0.8929260466797599},
- {0.39670615078630456},
- {0.13831468980611739},
- {0.45536119224757277},
- {0.47697014234361024},
- {0.37236275020885024},
- {0.7194402080112597},
- {0.7372532717921245},
- {0.6301004570521155},
- {0.544071526744861},
- {0.25799511274635667},
- {0.8429363143129279},
- {0.36481111018138823},
- {0.7679313879674718},
- {0.4027403400062287},
- {0.7253665953933542},
- {0.6498399636462091},
- {0.3228802744210436},
- {0.8229002231307785},
- {0.6182510798398195},
- {0.25868729803398316},
- {0.5885081500058104},
- {0.8977934920026085},
- {0.19899938055725364},
- {0.09521505771795924},
- {0.14227016117887026},
- {0.8264196566451631},
- {0.886340565559681},
- {0.419326488709186},
- {0.8297331418415493},
- {0.05053308233100873},
- {0.6102965947897975},
- {0.20450879653545762},
- {0.8586955648798337},
- {0.3106988306721392},
- {0.05635738914122135},
- {0.9327869756919882},
- {0.04214233564102243},
- {0.5306173867777905},
- {0.9463543067855531},
- {0.029444157213066924},
- {0.5592763645150607},
- {0.654136653778167},
- {0.5407096370208675},
- {0.8025182302748972},
- {0.35720333522786596},
- {0.1016934728008233},
- {0.2906727048858475},
- {0.890998182462898},
- {0.13456648241061997},
- {0.4590013138694772},
- {0.558360836022108},
- {0.034117933633292075},
- {0.16778267984998263},
- {0.9342574384159591},
- {0.8298901989027687},
- {0.1754473261661974},
- {0.7993452678821787},
- {0.6210561512921943},
- {0.6011100818653202},
- {0.29506603095965944},
- {0.8948592254399161},
- {0.08694245909218512},
- {0.8854599726896671},
- {0.957779950907792},
- {0.6986238594971671},
- {0.3955224778907668},
- {0.7902430197355358},
- {0.19138522733184027},
- {0.8890760273961638},
- {0.5498698711609439},
- {0.445457130954259},
- {0.6596074444418469},
- {0.5463882027045778},
- {0.9486992979781413},
- {0.8399087090359143},
- {0.5570476726897348},
- {0.4873354031793896},
- {0.2763330131385644},
- {0.30088169452222335},
- {0.08678621097539918},
- {0.05202765261548292},
- {0.36713028732391706},
- {0.33943235265563765},
- {0.08166477227365432},
- {0.1512129330067319},
- {0.29752827147911187},
- {0.6635440377115558},
- {0.3887889733760249},
- {0.16473100669238927},
- {0.9119550708838188},
- {0.4970825208310268},
- {0.944428665349599},
- {0.6079035204847562},
- {0.8087975588059532},
- {0.028865622240880184},
- {0.1487672756728321},
- {0.7595785175690253},
- {0.9558559387514431},
- {0.4816607824730157},
- {0.4920429468822679},
- {0.7038002395660191},
- {0.6407183626830399},
- {0.02373309928493217},
- {0.7165091681114395},
- {0.5353160156608071},
- {0.8154903057150373},
- {0.2580590273136808},
- {0.601070177407936},
- {0.7788991131880633},
- {0.6491093333619269},
- {0.26977723466998016},
- {0.8074496137164396},
- {0.19603880549261987},
- {0.06389717483412127},
- {0.03435398711028792},
- {0.5350015801583539},
- {0.7043090281149715},
- {0.436035791635595},
- {0.299530846039359},
- {0.6666352496778176},
- {0.7740071405702132},
- {0.7124245222343673},
- {0.6798054260735006},
- {0.3224298423988128},
- {0.429174952647868},
- {0.08520952326791809},
- {0.25941108322434914},
- {0.39099701503095563},
- {0.3086231653471594},
- {0.5933843789224726},
- {0.5639745026635757},
- {0.12446397924228791},
- {0.7106057337819225},
- {0.6348075547773527},
- {0.11172552563065341},
- {0.3900625342595446},
- {0.5312547563830483},
- {0.26415066675875676},
- {0.42119870914054736},
- {0.8426776568897332},
- {0.9197613576944494},
- {0.7785857542137098},
- {0.7058439852120444},
- {0.3245592302365219},
- {0.22639799962100993},
- {0.10515152036068098},
- {0.30301265799185617},
- {0.27710537001424485},
- {0.31227524961953723},
- {0.8044983535721624},
- {0.9637313858847735},
- {0.952527144071963},
- {0.9242623680103373},
- {0.121325243518555},
- {0.6439460154759064},
- {0.8307057923951621},
- {0.7672019830548306},
- {0.26233167773995636},
- {0.753493650718492},
- {0.9921759110662397},
- {0.2560211514576437},
- {0.3208364454202618},
- {0.810288693181932},
- {0.39865155089285176},
- {0.28662579376789543},
- {0.49501066899131474},
- {0.27892534552872816},
- {0.8272991769285116},
- {0.27956318467926067},
- {0.9901708274419869},
- {0.8286810686493395},
- {0.33468825798805035},
- {0.2932728316922525}};
-double C_arr_ref[16384][1] = {{0.5190891505515957},
- {0.30539880270532976},
- {0.2201848549536846},
- {0.44619051780719793},
- {0.1709844360097636},
- {0.24716656178948784},
- {0.12379668692204587},
- {0.5797615887199454},
- {0.05798398196552916},
- {0.46938296234367183},
- {0.5607360632129604},
- {0.17098444858561743},
- {0.451780498235588},
- {0.3323850811686793},
- {0.11519994675959379},
- {0.5058581028200131},
- {0.21686501817157847},
- {0.40657090143442964},
- {0.2255219953873206},
- {0.17181384763749954},
- {0.5154445259043033},
- {0.30238598545649925},
- {0.07059468116156858},
- {0.5669619300739415},
- {0.12358297364385142},
- {0.5465084842884659},
- {0.035869184432256715},
- {0.1792985472856851},
- {0.3255087151890006},
- {0.5355025369579015},
- {0.173986761457079},
- {0.14636067318158363},
- {0.3700279581685454},
- {0.25741472115212616},
- {0.23334348500124966},
- {0.09449333058525779},
- {0.13388090991220142},
- {0.4114292272922881},
- {0.025895936328940855},
- {0.13217468311217578},
- {0.5355577207865975},
- {0.1973594918086278},
- {0.0432624738780559},
- {0.3514389641996493},
- {0.0646614640943161},
- {0.03257414031086089},
- {0.4425498674046263},
- {0.47139806606614865},
- {0.5882089552556454},
- {0.2519084975650834},
- {0.3923573241008706},
- {0.4016211340570904},
- {0.33725654381027603},
- {0.5062252891774128},
- {0.006772304082038128},
- {0.19218753470733776},
- {0.26049346110556243},
- {0.18839848361616626},
- {0.11440847927671528},
- {0.5217713916672219},
- {0.10623585697954112},
- {0.44199995010684423},
- {0.5298865027526799},
- {0.27526787448699097},
- {0.4296940183881036},
- {0.06337648888310611},
- {0.22856358161924278},
- {0.5064808149795657},
- {0.21000117297684223},
- {0.015766965909092243},
- {0.26577845639738884},
- {0.4005880095753738},
- {0.58580672193203},
- {0.5561405220129544},
- {0.5899059551004047},
- {0.4858103542451596},
- {0.450569524862614},
- {0.3536378959948199},
- {0.3799173028912136},
- {0.2705946970786766},
- {0.16923302780353333},
- {0.5277280630511539},
- {0.5357211253568183},
- {0.23800836175118378},
- {0.08298346940582313},
- {0.2731991201978919},
- {0.2861636552859587},
- {0.22340326203339855},
- {0.43163632564630827},
- {0.4423234756182702},
- {0.37803592715765755},
- {0.326421893130073},
- {0.15478709871995305},
- {0.5057292175393392},
- {0.21887256981219555},
- {0.4607291599214614},
- {0.2416286421221439},
- {0.43519192908003224},
- {0.3898788683798311},
- {0.19371568856294694},
- {0.49370833702435685},
- {0.3709267586900641},
- {0.15520238314649829},
- {0.35308215005608745},
- {0.5386414044725023},
- {0.11939193900082942},
- {0.05712535552216158},
- {0.08535659939011153},
- {0.4958198611421216},
- {0.5317700911476773},
- {0.25157969045534423},
- {0.49780782422692765},
- {0.030317896800949463},
- {0.3661543750212516},
- {0.1226973757039888},
- {0.515184158942242},
- {0.18640729300443515},
- {0.03381225583593629},
- {0.5596361425383674},
- {0.025283773005302608},
- {0.31834992901762715},
- {0.5677760169530062},
- {0.017665356605981553},
- {0.3355442082774556},
- {0.392456716434954},
- {0.3244048891990529},
- {0.4814799288707717},
- {0.2143081988044092},
- {0.061012154246003966},
- {0.1743923913419047},
- {0.5345644813193499},
- {0.08073468979921056},
- {0.2753830525167816},
- {0.33499492655769325},
- {0.020469441863455468},
- {0.1006631247893834},
- {0.5605183633540891},
- {0.4979020523949765},
- {0.10526161641727651},
- {0.47957627403836695},
- {0.37260969317356385},
- {0.3606428222333073},
- {0.1770282172281285},
- {0.5368809579149094},
- {0.05216211599980233},
- {0.5312417694517663},
- {0.5746309619396066},
- {0.41914732088129336},
- {0.2372982037509667},
- {0.4741152768611333},
- {0.11482374127636477},
- {0.5334112625513565},
- {0.32990067573176857},
- {0.2672570661147055},
- {0.39573897944188063},
- {0.3278118091895736},
- {0.5691829210581294},
- {0.5039127713597602},
- {0.3342070792988837},
- {0.29238241127388004},
- {0.16578913037904078},
- {0.18051739064850106},
- {0.052068373167156005},
- {0.03121458122145728},
- {0.2202639864847377},
- {0.20364629593161182},
- {0.048995707838435106},
- {0.09072191693823932},
- {0.17850546639885773},
- {0.3981007832937923},
- {0.23325836122465002},
- {0.09883223881143921},
- {0.5471378045980014},
- {0.2982303052363608},
- {0.5666207064981942},
- {0.3647186229065874},
- {0.485247283356231},
- {0.017318257977253445},
- {0.08925461703806759},
- {0.45571776043719897},
- {0.5734766289896024},
- {0.2889778581173273},
- {0.2952067555961785},
- {0.4222529489073448},
- {0.3844062602604743},
- {0.014238942524306093},
- {0.4298778149617604},
- {0.32116892479247716},
- {0.4892626728940265},
- {0.15482544499068948},
- {0.3606188811007845},
- {0.4673093712610539},
- {0.3894405184408066},
- {0.16185591661308651},
- {0.484438568387104},
- {0.11761570835863185},
- {0.03833583591445338},
- {0.02061106482854964},
- {0.320980275640789},
- {0.42255820237713326},
- {0.26160462656393807},
- {0.17970693375555058},
- {0.39995539102915845},
- {0.4643743767161033},
- {0.42742718526618156},
- {0.4078569879711206},
- {0.19344544675429604},
- {0.25748838827403264},
- {0.05112242146586023},
- {0.15563662629366734},
- {0.2345831008989071},
- {0.1851619740131289},
- {0.3560076989886618},
- {0.3383629096305666},
- {0.0746735782588047},
- {0.4263359824726773},
- {0.38086000391060393},
- {0.06703099830550883},
- {0.23402244854438556},
- {0.3187323261528285},
- {0.1584801932768647},
- {0.2527029503715875},
- {0.5055740330799419},
- {0.5518212750495571},
- {0.46712136798462855},
- {0.4234791173246543},
- {0.19472299717740266},
- {0.13583005175679255},
- {0.06308684916300504},
- {0.1817958863898795},
- {0.16625251466058924},
- {0.187353083460066},
- {0.48266792633719185},
- {0.578201592962424},
- {0.5714794808064982},
- {0.5545217073201089},
- {0.07279045810527322},
- {0.38634272721973145},
- {0.49839137697589037},
- {0.4602915451580732},
- {0.1573888701512969},
- {0.45206707544605634},
- {0.595267208975214},
- {0.15360279822056425},
- {0.19248947013600434},
- {0.4861419063644051},
- {0.23917552664487685},
- {0.17196440104372737},
- {0.29698727418886217},
- {0.1673444296454486},
- {0.4963475393274782},
- {0.16772710848967148},
- {0.5940642362770681},
- {0.4971766209636965},
- {0.20080002244281678},
- {0.1759523669568811},
- {0.5802703744084197},
- {0.34139391547943815},
- {0.2461364258668677},
- {0.4987797154888417},
- {0.19113711507159725},
- {0.27629826822314235},
- {0.13838769273918253},
- {0.6480938270365644},
- {0.06481812784774112},
- {0.5247056830424413},
- {0.6268259026395242},
- {0.19113712912967457},
- {0.5050285458345941},
- {0.37156086828740525},
- {0.12877771798348372},
- {0.5654798803037698},
- {0.2424253043177455},
- {0.4544904260630958},
- {0.2521026158255778},
- {0.1920642833532953},
- {0.5761961846350154},
- {0.33802599959996876},
- {0.0789151574933461},
- {0.6337855666791204},
- {0.1381487906472737},
- {0.6109214235328642},
- {0.040096821630953045},
- {0.20043114955069524},
- {0.3638740355779228},
- {0.5986182860632415},
- {0.1944933025580018},
- {0.1636111302567174},
- {0.4136404345956425},
- {0.28775430282536085},
- {0.2608459669472173},
- {0.10563056511495329},
- {0.14966046899331445},
- {0.4599213670903585},
- {0.028948100058118077},
- {0.14775314177789398},
- {0.5986799740043296},
- {0.22062080489094105},
- {0.048361503777102605},
- {0.39286049250140864},
- {0.07228263572824553},
- {0.036413414871280136},
- {0.4947099683751801},
- {0.5269582922335039},
- {0.6575368225937381},
- {0.2815991011243918},
- {0.4386015988120097},
- {0.4489572659763724},
- {0.3770064944345751},
- {0.5658903442189944},
- {0.007570505800624181},
- {0.21483926721017696},
- {0.2911959112342214},
- {0.21060362850921327},
- {0.12789296604418007},
- {0.5832687515749704},
- {0.11875709681007926},
- {0.4940952363663555},
- {0.5923403311734281},
- {0.3077116761570603},
- {0.48033889490113674},
- {0.07084620993101584},
- {0.25550269147677857},
- {0.566175986969818},
- {0.23475246812612266},
- {0.0176253023235637},
- {0.29710381008642445},
- {0.4478023747034973},
- {0.6548514556801175},
- {0.6216887187667671},
- {0.6594338353404755},
- {0.5430692509172482},
- {0.5036748439285004},
- {0.3953185962293065},
- {0.42469536371288324},
- {0.3024877056666002},
- {0.18917928124962027},
- {0.5899274920447128},
- {0.5988626378705293},
- {0.2660606584416879},
- {0.09276412117390306},
- {0.30539909300131735},
- {0.31989166257552165},
- {0.24973416293989228},
- {0.48251012764359913},
- {0.49445689345251553},
- {0.42259224404614887},
- {0.36489484309278714},
- {0.17303071665508168},
- {0.5653358042621247},
- {0.24466947131855304},
- {0.5150319205177256},
- {0.27010763465779297},
- {0.48648480392712856},
- {0.43583102572707033},
- {0.21654753333172033},
- {0.5518981108914668},
- {0.414645170130157},
- {0.17349494760543252},
- {0.3946973486004521},
- {0.6021271088270778},
- {0.13346378954701799},
- {0.06385830141476627},
- {0.09541695455144444},
- {0.5542585048413032},
- {0.5944459242917491},
- {0.28123153993673505},
- {0.556480774527165},
- {0.0338912445179571},
- {0.4093103006662513},
- {0.1371588137857012},
- {0.5759051301323382},
- {0.208377750891544},
- {0.03779745797550018},
- {0.6255963423973434},
- {0.028263785541759557},
- {0.3558714958840022},
- {0.6346956039966292},
- {0.01974744238233175},
- {0.3750923384949129},
- {0.43871270579016675},
- {0.3626401097295631},
- {0.5382284301243775},
- {0.23956713143953093},
- {0.06820320854360447},
- {0.19494674105674317},
- {0.5975696686994998},
- {0.09025029443931522},
- {0.3078404293748827},
- {0.3744783169750189},
- {0.022882024564406828},
- {0.11252754762565789},
- {0.626582544097968},
- {0.5565861086769838},
- {0.11766802967155704},
- {0.5361004054851222},
- {0.4165264597348569},
- {0.40314914165062987},
- {0.19789323237186546},
- {0.6001591713696777},
- {0.05831008132028406},
- {0.5938553331997013},
- {0.6423584909779828},
- {0.46854913565738077},
- {0.2652667993362968},
- {0.5299957606985582},
- {0.1283571719243418},
- {0.5962805285092894},
- {0.3687836442373041},
- {0.29875669266615},
- {0.4423818250193249},
- {0.3664485783449796},
- {0.636268329550552},
- {0.563305266918786},
- {0.37359761194899344},
- {0.3268433776357019},
- {0.1853294769418035},
- {0.20179364902450414},
- {0.05820528970878537},
- {0.0348936145421839},
- {0.24622488405001966},
- {0.22764858841983934},
- {0.0547704718960185},
- {0.10141464265408322},
- {0.19954459404737476},
- {0.4450219973364918},
- {0.26075081025656777},
- {0.11048086857102564},
- {0.6116249172029764},
- {0.333380519888634},
- {0.6334041255878445},
- {0.4077053269998809},
- {0.5424398150001426},
- {0.019359433788750696},
- {0.09977440289654381},
- {0.5094298642005148},
- {0.6410681052853149},
- {0.32303755481558144},
- {0.33000060666970676},
- {0.47202080123839935},
- {0.4297134015019536},
- {0.015917182050480573},
- {0.480544354226375},
- {0.35902274597657247},
- {0.5469284689972764},
- {0.1730735825189776},
- {0.40312237875273843},
- {0.5223876930158685},
- {0.435341010701772},
- {0.18093268417090203},
- {0.5415357827401225},
- {0.13147820765094395},
- {0.042854199198155876},
- {0.02304033958773702},
- {0.3588118621355875},
- {0.4723620326916389},
- {0.29243804160022147},
- {0.20088766953289938},
- {0.4470951940577836},
- {0.5191067722305365},
- {0.47780488681604893},
- {0.45592809416957475},
- {0.2162454401068474},
- {0.28783665254961316},
- {0.057147845631405014},
- {0.17398037180149659},
- {0.2622316872619107},
- {0.20698565530146026},
- {0.3979677104884845},
- {0.3782432594644173},
- {0.083474804219292},
- {0.47658507196754096},
- {0.4257491739743683},
- {0.07493144952533856},
- {0.26160495493409097},
- {0.35629896335963746},
- {0.1771590891301905},
- {0.28248719024548036},
- {0.5651623293508091},
- {0.6168603939020505},
- {0.5221775311747178},
- {0.4733914891170497},
- {0.21767356601075807},
- {0.1518393418646395},
- {0.07052243250540792},
- {0.20322283166440502},
- {0.18584747692362427},
- {0.20943501471841772},
- {0.5395564481226411},
- {0.6463499660421078},
- {0.6388355679211116},
- {0.6198791062812873},
- {0.0813697345306179},
- {0.43187810559234663},
- {0.5571331063506443},
- {0.5145427273178136},
- {0.17593913976696285},
- {0.5053488997950626},
- {0.6654269808144821},
- {0.17170683135818776},
- {0.2151767895491689},
- {0.5434398806485113},
- {0.2673653884849569},
- {0.19223258138323382},
- {0.3319909819054825},
- {0.18706808790424914},
- {0.5548483765769361},
- {0.18749587029187836},
- {0.6640822225639686},
- {0.5557751759734411},
- {0.22446684558962066},
- {0.19669057953460092},
- {0.4877977588040157},
- {0.2869889523654805},
- {0.20691181592769367},
- {0.4192935536307663},
- {0.16067726437222285},
- {0.23226702920700415},
- {0.11633405622862089},
- {0.54481278084454},
- {0.05448862959139466},
- {0.4410879264356241},
- {0.5269341395889596},
- {0.1606772761899873},
- {0.4245465625249601},
- {0.3123484616884837},
- {0.10825553911877854},
- {0.4753642964146811},
- {0.20379210336929077},
- {0.3820622609890792},
- {0.21192722636188105},
- {0.16145667795215543},
- {0.4843728370295154},
- {0.2841577517901961},
- {0.06633913888877246},
- {0.5327847028268382},
- {0.11613322587410636},
- {0.513564218246545},
- {0.03370694177982744},
- {0.16849018984472044},
- {0.3058866122931744},
- {0.5032217242151065},
- {0.16349860560589047},
- {0.137537855066241},
- {0.34772217546377243},
- {0.24189741574783105},
- {0.2192772260683462},
- {0.08879714560097351},
- {0.12581038870185923},
- {0.38662772043373267},
- {0.024334894478079187},
- {0.12420701554682521},
- {0.5032735814884314},
- {0.18546239635455278},
- {0.04065455379987824},
- {0.3302537510383855},
- {0.060763584121680835},
- {0.030610527347221285},
- {0.4158723665281728},
- {0.44298155699703595},
- {0.5527509287706368},
- {0.23672311472000349},
- {0.3687054972028777},
- {0.37741087224265363},
- {0.31692626601389345},
- {0.4757093482848901},
- {0.006364060488737046},
- {0.18060221177940042},
- {0.2447905651184753},
- {0.1770415697811939},
- {0.1075117823596474},
- {0.49031831081976124},
- {0.09983181672007076},
- {0.4153555989842921},
- {0.49794423210076977},
- {0.2586743570017128},
- {0.4037914853710174},
- {0.05955606894344818},
- {0.21478546168728557},
- {0.47594947064821486},
- {0.19734201998917733},
- {0.014816512010358515},
- {0.2497569737900941},
- {0.37644002589340625},
- {0.5504935053008172},
- {0.5226156237897518},
- {0.5543456311836706},
- {0.45652505307182123},
- {0.4234085882546823},
- {0.33232012826916996},
- {0.35701537719344023},
- {0.25428288500919094},
- {0.15903143340688242},
- {0.49591590604579605},
- {0.5034271358115131},
- {0.22366089777733264},
- {0.07798111432482857},
- {0.256730310001951},
- {0.26891332548816355},
- {0.20993621310250496},
- {0.40561670773687536},
- {0.41565962194301087},
- {0.35524741331802173},
- {0.3067447426404781},
- {0.1454563243464749},
- {0.475243180511972},
- {0.2056786370984888},
- {0.432955786855744},
- {0.22706294278120137},
- {0.40895797461622235},
- {0.3663764461242077},
- {0.18203824646647057},
- {0.4639469348327312},
- {0.34856679508169897},
- {0.14584657486956848},
- {0.3317978834426502},
- {0.5061713765767056},
- {0.11219483243289552},
- {0.05368176230418685},
- {0.08021118884373614},
- {0.4659311734383961},
- {0.4997142752554237},
- {0.2364141285448173},
- {0.46779929943625803},
- {0.02849029322889809},
- {0.34408209711541343},
- {0.11530101296846695},
- {0.4841281653379087},
- {0.17517041081606832},
- {0.03177400760418768},
- {0.5259005236111289},
- {0.023759633182451174},
- {0.29915936737495097},
- {0.5335497154545488},
- {0.016600465164249286},
- {0.3153171523686888},
- {0.3687988980334608},
- {0.3048493264176481},
- {0.45245567155989824},
- {0.2013894125104151},
- {0.05733425957637589},
- {0.1638797835760169},
- {0.5023402158313679},
- {0.0758678941756805},
- {0.25878259194504694},
- {0.31480098208933044},
- {0.019235516393190738},
- {0.0945950163171239},
- {0.5267295629702101},
- {0.46788784740367667},
- {0.0989163046884599},
- {0.4506667715996569},
- {0.35014828001235654},
- {0.3389027881380781},
- {0.16635671833477908},
- {0.5045170521039719},
- {0.04901771353175213},
- {0.49921780150150474},
- {0.5399914351430363},
- {0.39388055696664},
- {0.22299354905595303},
- {0.4455349706728624},
- {0.10790201180776868},
- {0.5012565146408496},
- {0.31001381955081275},
- {0.25114645092612453},
- {0.3718833018143581},
- {0.3080508726916063},
- {0.5348718094890744},
- {0.47353623214973944},
- {0.31406062732229517},
- {0.27475720650596874},
- {0.15579513874837672},
- {0.16963555969127378},
- {0.04892962164306552},
- {0.02933292430722712},
- {0.20698617730368737},
- {0.1913702234743697},
- {0.0460421807105934},
- {0.08525307783807845},
- {0.1677449169397992},
- {0.37410273295537305},
- {0.21919723366742216},
- {0.09287449860698135},
- {0.5141556022818982},
- {0.28025258155973437},
- {0.5324640486669049},
- {0.342732894068139},
- {0.45599592485294926},
- {0.016274290107426},
- {0.08387422874821295},
- {0.4282464812686455},
- {0.5389066869348965},
- {0.2715578843900454},
- {0.27741129555607513},
- {0.39679897356073957},
- {0.3612337341784886},
- {0.0133805999291548},
- {0.40396420244015735},
- {0.3018084302952385},
- {0.45976926131197626},
- {0.1454923590524668},
- {0.3388802902092051},
- {0.4391393342107583},
- {0.36596452050873146},
- {0.15209902439520476},
- {0.4552359603092244},
- {0.11052567536139384},
- {0.036024900195039095},
- {0.019368602135581437},
- {0.30163115316799366},
- {0.39708582594105174},
- {0.24583474802940705},
- {0.1688739582292351},
- {0.37584554244351376},
- {0.43638126508215574},
- {0.40166129999672995},
- {0.38327082050059896},
- {0.18178429519730038},
- {0.24196664211660673},
- {0.04804069318185881},
- {0.1462546412561227},
- {0.2204421162534186},
- {0.17400016132749827},
- {0.3345470763530873},
- {0.31796593861537553},
- {0.07017215458619112},
- {0.40063587637439757},
- {0.3579012509282163},
- {0.06299027962552833},
- {0.21991526077644866},
- {0.2995187130968295},
- {0.14892679419929017},
- {0.23746967684343925},
- {0.4750973507803839},
- {0.5185567468391791},
- {0.43896266402454726},
- {0.39795122689765533},
- {0.18298483316363684},
- {0.1276420336560494},
- {0.05928388909500443},
- {0.17083698599082595},
- {0.1562305896025588},
- {0.1760591877517155},
- {0.45357205494215314},
- {0.5433468237282063},
- {0.5370299295288083},
- {0.5210943934225788},
- {0.06840255144677813},
- {0.36305346830647006},
- {0.46834767484110984},
- {0.4325445520985283},
- {0.1479012574986728},
- {0.42481586447596836},
- {0.5593837014683846},
- {0.1443434150731093},
- {0.18088594613456963},
- {0.4568366187836509},
- {0.22475770440234727},
- {0.16159815579668407},
- {0.27908448209464387},
- {0.1572566824843941},
- {0.4664270424734418},
- {0.1576162929334957},
- {0.5582532455815017},
- {0.46720614595418897},
- {0.18869552717739999},
- {0.16534572176402526},
- {0.4588032072981326},
- {0.26993041568548},
- {0.19461304006041527},
- {0.3943708713973769},
- {0.15112665629012098},
- {0.21846114711772896},
- {0.10941919505033439},
- {0.5124292736427222},
- {0.05124984189985992},
- {0.4148697932629393},
- {0.49561333342539815},
- {0.1511266674054411},
- {0.3993116430289047},
- {0.2937825634309464},
- {0.10182086255840987},
- {0.4471087861592701},
- {0.19167876227457045},
- {0.3593525955493232},
- {0.19933033601266298},
- {0.15185974176218536},
- {0.4555818618398455},
- {0.2672675008175855},
- {0.062395960502544486},
- {0.5011161409508376},
- {0.10923030199145688},
- {0.4830381161708881},
- {0.03170341133733996},
- {0.15847518383143624},
- {0.2877048044127124},
- {0.47331037686204014},
- {0.1537802978526876},
- {0.12936264648696374},
- {0.32705367433957444},
- {0.2275191063902056},
- {0.2062434539557108},
- {0.08351907007636405},
- {0.11833225718248745},
- {0.36364668546300427},
- {0.02288843569756974},
- {0.1168241880436932},
- {0.47335915175469545},
- {0.17443856751062592},
- {0.03823805939656374},
- {0.31062356778791106},
- {0.05715181502741981},
- {0.02879104684372877},
- {0.391153038623226},
- {0.4166508669955117},
- {0.5198955804528024},
- {0.22265236425323093},
- {0.3467897537698575},
- {0.35497768394562323},
- {0.2980882644493988},
- {0.44743332825049303},
- {0.005985782654743597},
- {0.16986727083921846},
- {0.23024028783576747},
- {0.16651827232634514},
- {0.10112131447648412},
- {0.4611739384630752},
- {0.09389784367576462},
- {0.39066698758612955},
- {0.4683465772855826},
- {0.24329883132130328},
- {0.3797902413945544},
- {0.05601607418680454},
- {0.20201867869329282},
- {0.44765917781304027},
- {0.18561206990314158},
- {0.01393582300991053},
- {0.2349114946754189},
- {0.3540645444102542},
- {0.5177723375524604},
- {0.4915515089014354},
- {0.5213954942358829},
- {0.4293893417527065},
- {0.39824130960567145},
- {0.3125671201799848},
- {0.33579449096426334},
- {0.23916838709812993},
- {0.14957865302044593},
- {0.466438814318918},
- {0.47350357885517486},
- {0.210366561541847},
- {0.0733459404336631},
- {0.2414703378882546},
- {0.25292919861230084},
- {0.19745766798029127},
- {0.3815069730940627},
- {0.3909529395119736},
- {0.3341316143278105},
- {0.2885119277512618},
- {0.1368104443439496},
- {0.44699486934925037},
- {0.19345316100849314},
- {0.40722102560440615},
- {0.21356639001784183},
- {0.38464963607890706},
- {0.3445991407841093},
- {0.17121794805806126},
- {0.43637006910258574},
- {0.32784809002242166},
- {0.13717749849377617},
- {0.31207591742827556},
- {0.4760847027778341},
- {0.10552600546729952},
- {0.050490934560591845},
- {0.0754434599964779},
- {0.43823636516461745},
- {0.4700114096095409},
- {0.22236174412300774},
- {0.43999345031719694},
- {0.02679683880125098},
- {0.32362996114921805},
- {0.10844755556966434},
- {0.45535173335971585},
- {0.16475833448516047},
- {0.029885370185502688},
- {0.4946411552692172},
- {0.022347367759669164},
- {0.28137742490131734},
- {0.501835681458932},
- {0.01561373852695076},
- {0.29657479603343645},
- {0.3468776028832706},
- {0.2867291744964468},
- {0.4255618430492118},
- {0.18941888663491838},
- {0.05392632849769539},
- {0.15413881871935614},
- {0.47248126507048316},
- {0.07135832945215036},
- {0.24340063281228427},
- {0.2960893067596394},
- {0.018092163106426855},
- {0.08897231710765775},
- {0.4954209167791007},
- {0.4400767350201669},
- {0.09303674940289845},
- {0.4238792747624969},
- {0.32933557196628777},
- {0.31875850873374234},
- {0.1564685252239014},
- {0.4745287108522808},
- {0.04610411543900642},
- {0.469544446105658},
- {0.5078945072740401},
- {0.3704684155821947},
- {0.20973887982697814},
- {0.41905250653338166},
- {0.10148834880402838},
- {0.4714619787515349},
- {0.29158669171705615},
- {0.236218381709999},
- {0.34977867063468426},
- {0.28974042182650184},
- {0.5030791906232163},
- {0.4453893814823017},
- {0.2953929584564265},
- {0.25842572110681056},
- {0.1465347227393296},
- {0.15955247324012412},
- {0.04602125970558637},
- {0.027589384142693945},
- {0.19468298141867135},
- {0.1799952351701506},
- {0.043305447390355176},
- {0.08018566063125943},
- {0.1577742097229684},
- {0.35186617945877485},
- {0.20616821627894613},
- {0.08735406645074198},
- {0.4835943485177325},
- {0.26359445272656123},
- {0.5008145463773578},
- {0.322360954323718},
- {0.4288916647554082},
- {0.015306951217025253},
- {0.0788887699149891},
- {0.40279163971955656},
- {0.5068742361718815},
- {0.25541656573150834},
- {0.26092205190510953},
- {0.37321336237507846},
- {0.33976211008373997},
- {0.012585261109278491},
- {0.379952692213252},
- {0.2838690283214364},
- {0.43244071523456823},
- {0.13684433715789704},
- {0.3187373480749689},
- {0.41303702477159443},
- {0.34421169990284706},
- {0.14305830430736777},
- {0.4281768722747115},
- {0.10395606258817078},
- {0.0338835910041967},
- {0.018217338272471514},
- {0.2837022884931109},
- {0.37348316433651224},
- {0.2312224048297364},
- {0.1588361411390439},
- {0.353505396877135},
- {0.4104428944392711},
- {0.3777866735957624},
- {0.36048931864837025},
- {0.17097909157565677},
- {0.2275842179645223},
- {0.04518516888372572},
- {0.13756130953751824},
- {0.2073391034198898},
- {0.1636576442728656},
- {0.3146616991421612},
- {0.29906613922535},
- {0.06600114290418468},
- {0.37682220084394236},
- {0.3366277086317101},
- {0.059246156422809504},
- {0.20684356407340107},
- {0.2817154112219822},
- {0.14007463051652866},
- {0.22335455094945406},
- {0.4468577076928785},
- {0.48773389037133597},
- {0.41287085580791094},
- {0.3742971261215399},
- {0.17210826992774436},
- {0.12005502971361653},
- {0.0557600726263749},
- {0.1606824871231693},
- {0.14694429052621177},
- {0.1655942827880951},
- {0.42661186894028746},
- {0.511050452574777},
- {0.5051090326593748},
- {0.49012070000799257},
- {0.06433672444109428},
- {0.3414736797645741},
- {0.4405092304535516},
- {0.40683423451699813},
- {0.13911005140776272},
- {0.3995649377532535},
- {0.5261341031439835},
- {0.1357636860617798},
- {0.17013414010998237},
- {0.4296823880926939},
- {0.21139817431222202},
- {0.15199281020635066},
- {0.26249578474099944},
- {0.14790939275695195},
- {0.43870275989393437},
- {0.14824762806953368},
- {0.5250708412137062},
- {0.4394355536990153},
- {0.17747952201352007},
- {0.15551762198406996},
- {0.4259646645461619},
- {0.250610320807013},
- {0.1806837376177622},
- {0.36614403140473634},
- {0.14030986363348055},
- {0.20282493184034},
- {0.10158758695041156},
- {0.47575247988407854},
- {0.04758166762058404},
- {0.38517575619899713},
- {0.4601401297091893},
- {0.1403098739532288},
- {0.3707311705030368},
- {0.272755266508103},
- {0.09453310019105973},
- {0.41510726403492226},
- {0.17795947886618715},
- {0.33363216599637546},
- {0.1850633961639555},
- {0.14099047898713185},
- {0.42297388480508885},
- {0.24813800234808694},
- {0.057930009994963054},
- {0.4652490773458887},
- {0.10141221379002392},
- {0.4484649754944723},
- {0.029434260180538994},
- {0.14713242506995838},
- {0.2671125191597565},
- {0.4394334928335558},
- {0.14277357251790845},
- {0.12010359875234358},
- {0.30364501917729625},
- {0.21123457353769223},
- {0.19148171216248538},
- {0.07754124666606402},
- {0.10986270242652155},
- {0.33761890920243076},
- {0.02125021071957396},
- {0.10846257236073173},
- {0.439478776694823},
- {0.1619532398893917},
- {0.0355011950323386},
- {0.2883908868730527},
- {0.05306121083966158},
- {0.02673034629148216},
- {0.3631565129297049},
- {0.38682935073137836},
- {0.48268439061435353},
- {0.20671616532076362},
- {0.3219685014900825},
- {0.329570385860479},
- {0.27675278976161716},
- {0.41540857723591973},
- {0.005557354133571395},
- {0.15770913081996282},
- {0.21376098818168315},
- {0.1545998347091039},
- {0.093883621810544},
- {0.42816571216165444},
- {0.08717716625935587},
- {0.36270525068115095},
- {0.4348249740005867},
- {0.22588487486511516},
- {0.3526070005618195},
- {0.052006759914976365},
- {0.18755932245637025},
- {0.41561826176213496},
- {0.17232700607655987},
- {0.012938375493382006},
- {0.21809785641369817},
- {0.3287226036966229},
- {0.4807131174510287},
- {0.45636902764784104},
- {0.48407694903873905},
- {0.39865607739864056},
- {0.36973744550214804},
- {0.2901953307599927},
- {0.31176021750670924},
- {0.22205006451513565},
- {0.1388726576963934},
- {0.4330537579340851},
- {0.43961286651901876},
- {0.1953097109904774},
- {0.06809625219630681},
- {0.22418725466664227},
- {0.23482595484736665},
- {0.18332476313452858},
- {0.35420085830052883},
- {0.36297073578289163},
- {0.3102163601897572},
- {0.2678618731674959},
- {0.12701832529586815},
- {0.4150015007468843},
- {0.17960687615862883},
- {0.378074444137459},
- {0.19828051381334588},
- {0.3571185872152942},
- {0.3199346802116311},
- {0.15896313419065125},
- {0.40513716370444597},
- {0.3043825750715695},
- {0.1273591077823767},
- {0.28973928552746664},
- {0.4420092481667024},
- {0.09797304989318814},
- {0.04687707858316939},
- {0.070043643153347},
- {0.4068698808331878},
- {0.4363706470279761},
- {0.20644634613835228},
- {0.4085012037526704},
- {0.024878872399545466},
- {0.30046635604366045},
- {0.10068549193699444},
- {0.42276022762204907},
- {0.15296586328035758},
- {0.027746344148011654},
- {0.4592375345756125},
- {0.02074786936929927},
- {0.26123801774356153},
- {0.46591711720760365},
- {0.014496195292772388},
- {0.27534764686842966},
- {0.3220500628600346},
- {0.26620671932359},
- {0.3951025294387512},
- {0.1758613523634774},
- {0.05006658642166044},
- {0.14310643248548066},
- {0.438663724182108},
- {0.06625090318496439},
- {0.22597938998023692},
- {0.2748969061753304},
- {0.016797228236322594},
- {0.08260418106892434},
- {0.45996148515987184},
- {0.4085785274069041},
- {0.08637770425200833},
- {0.39354038988866563},
- {0.30576359145758986},
- {0.2959435746833673},
- {0.14526939175410403},
- {0.44056462535661345},
- {0.04280424320227682},
- {0.43593710613479414},
- {0.47154228648458973},
- {0.3439523784014749},
- {0.1947269551882885},
- {0.3890590944730014},
- {0.09422438589353725},
- {0.43771739262203857},
- {0.2707165628915743},
- {0.21931120385423358},
- {0.3247434885639086},
- {0.2690024385740418},
- {0.4670716230079091},
- {0.4135109246353853},
- {0.2742503985514361},
- {0.23992906730015917},
- {0.13604659475595915},
- {0.14813260818614282},
- {0.04272731781437501},
- {0.02561469182089054},
- {0.18074867296854777},
- {0.16711219265592256},
- {0.04020588800868478},
- {0.07444642384553318},
- {0.1464816227298278},
- {0.32668158529437263},
- {0.19141185957376214},
- {0.08110175565589357},
- {0.4489813958709308},
- {0.2447278502979981},
- {0.46496906920889725},
- {0.2992881775607457},
- {0.39819402131046516},
- {0.014211366086087002},
- {0.07324235724329133},
- {0.37396208868184544},
- {0.47059504062653124},
- {0.23713529027415212},
- {0.24224672483650395},
- {0.34650085740342756},
- {0.31544385685445375},
- {0.011684479187078014},
- {0.35275782406826195},
- {0.26355128626076135},
- {0.40148905079754205},
- {0.12704979225358337},
- {0.2959239285850563},
- {0.38347416692676},
- {0.3195749701608007},
- {0.1328189987242896},
- {0.39753038963915854},
- {0.09651547466000071},
- {0.03145839489814905},
- {0.016913444070836312},
- {0.26339648072778044},
- {0.34675134846401284},
- {0.21467281078716294},
- {0.14746754709178564},
- {0.3282034767864612},
- {0.3810657097947699},
- {0.3507468368320717},
- {0.33468752887498066},
- {0.15874137370645308},
- {0.2112950247931994},
- {0.04195106965220258},
- {0.1277154477989592},
- {0.1924989412250667},
- {0.15194395425794582},
- {0.2921399915879828},
- {0.27766067378308945},
- {0.061277153798481636},
- {0.34985139559352346},
- {0.3125337981586362},
- {0.05500565110455408},
- {0.19203886978672705},
- {0.26155181291197593},
- {0.13004887945482232},
- {0.20736809345846535},
- {0.4148741563473342},
- {0.45282465269432787},
- {0.3833198913991536},
- {0.3475070514608478},
- {0.15978973184848158},
- {0.11146216862823641},
- {0.05176908150062114},
- {0.14918174205654114},
- {0.13642684799345411},
- {0.15374197912430393},
- {0.39607740040595907},
- {0.47447234704208036},
- {0.4689561804134812},
- {0.45504062797532313},
- {0.05973186501013617},
- {0.31703292204263617},
- {0.40898006725943553},
- {0.37771533737190816},
- {0.1291533394717578},
- {0.3709663358213526},
- {0.4884763950797578},
- {0.12604648806057256},
- {0.1579568990953157},
- {0.39892814913642183},
- {0.19626748674418698},
- {0.14111402314349106},
- {0.24370781876274916},
- {0.137322873656376},
- {0.4073028936614754},
- {0.1376368999952719},
- {0.4874892354342914},
- {0.40798323822401894},
- {0.16477654004100492},
- {0.14438654879850224},
- {0.3933096905954513},
- {0.23139822605156796},
- {0.1668323005472452},
- {0.3380749806057255},
- {0.12955353729157448},
- {0.1872761236478633},
- {0.093799757861077},
- {0.43928071090729537},
- {0.04393399858602458},
- {0.3556477100205085},
- {0.4248652226571237},
- {0.12955354682019818},
- {0.342310463991168},
- {0.2518455130377515},
- {0.08728607671434026},
- {0.3832846317321855},
- {0.16431688681492182},
- {0.30805551469986836},
- {0.1708762090943363},
- {0.13018197583692734},
- {0.3905481876997737},
- {0.2291154385598645},
- {0.053489024333944875},
- {0.4295825120980201},
- {0.093637829022392},
- {0.4140851000928801},
- {0.027177793671801682},
- {0.1358530727953199},
- {0.2466353456262103},
- {0.4057459819766677},
- {0.13182837522932694},
- {0.11089630947443366},
- {0.280367219357769},
- {0.19504107189193476},
- {0.17680248911151844},
- {0.07159683953388148},
- {0.10144049282912442},
- {0.3117366292790032},
- {0.01962114348641712},
- {0.1001476984524925},
- {0.4057877943215553},
- {0.14953770576179942},
- {0.03277962985219564},
- {0.2662824875566552},
- {0.04899347329713935},
- {0.024681165139867577},
- {0.3353164889634323},
- {0.35717453796665777},
- {0.4456812128537762},
- {0.19086905039414792},
- {0.29728600102890024},
- {0.30430511561402335},
- {0.25553658125267703},
- {0.3835628458934068},
- {0.0051313205454098084},
- {0.14561895530223043},
- {0.19737380848876626},
- {0.14274802164712433},
- {0.08668638814354944},
- {0.3953420031994969},
- {0.08049405770543608},
- {0.33489982103266563},
- {0.40149075785325455},
- {0.20856826313996468},
- {0.32557571516059436},
- {0.04801985787441903},
- {0.17318079461404037},
- {0.3837564557465063},
- {0.159116206301819},
- {0.01194650374939345},
- {0.20137820707967852},
- {0.3035223254712921},
- {0.4438610599104036},
- {0.4213832179078964},
- {0.4469670160403262},
- {0.3680946132532166},
- {0.3413929191683998},
- {0.2679486005607124},
- {0.2878602966238441},
- {0.20502743405769883},
- {0.12822650932544039},
- {0.39985532538414204},
- {0.4059116046552661},
- {0.18033702885143182},
- {0.06287590993157786},
- {0.20700078458931698},
- {0.21682390895780557},
- {0.1692708618066886},
- {0.32704738580898685},
- {0.3351449537206894},
- {0.2864347933035138},
- {0.24732725323606913},
- {0.11728094459500965},
- {0.38318697638760685},
- {0.1658379926091509},
- {0.34909079325671755},
- {0.1830800862839712},
- {0.3297414380443535},
- {0.2954080949856691},
- {0.14677682523554192},
- {0.3740788515288835},
- {0.2810482333120193},
- {0.11759560227787597},
- {0.2675275163153949},
- {0.4081242767448706},
- {0.09046231565061338},
- {0.04328342420892746},
- {0.0646740115079091},
- {0.37567873643605293},
- {0.4029179376894318},
- {0.19061991588139676},
- {0.3771850001384813},
- {0.02297162750871446},
- {0.277432236440983},
- {0.09296681855848765},
- {0.39035090973859726},
- {0.14123931247340277},
- {0.02561927535382865},
- {0.42403182157419983},
- {0.019157312240554638},
- {0.24121119069808297},
- {0.4301993392040818},
- {0.01338489917112285},
- {0.25423915833814775},
- {0.29736130980413544},
- {0.24579898551713036},
- {0.3648134846410363},
- {0.1623796052648428},
- {0.0462284204621853},
- {0.1321357177432815},
- {0.4050352247347411},
- {0.06117202764015588},
- {0.2086555326103672},
- {0.25382297197975456},
- {0.015509532105269891},
- {0.07627164317191484},
- {0.42470027321819903},
- {0.3772563960664857},
- {0.07975588343671429},
- {0.3633711006260014},
- {0.28232337928703016},
- {0.273256177050369},
- {0.134132861899873},
- {0.40679040049232146},
- {0.03952281738673537},
- {0.4025176325731857},
- {0.43539327610078576},
- {0.3175845669564767},
- {0.17979894782422778},
- {0.3592333468165873},
- {0.08700102883373653},
- {0.40416144011345523},
- {0.24996309894247193},
- {0.20249853781633767},
- {0.29984825418803446},
- {0.24838038149878644},
- {0.4312653391728646},
- {0.38181066967013005},
- {0.25322602642373676},
- {0.22153581054715468},
- {0.1256170958383153},
- {0.13677658064633946},
- {0.03945178919347706},
- {0.023651038110182303},
- {0.16689225787434742},
- {0.15430116687790546},
- {0.03712365529112445},
- {0.0687392696289045},
- {0.13525216176128313},
- {0.3016377740446052},
- {0.17673799150797354},
- {0.07488439553490378},
- {0.4145619310495006},
- {0.2259667129510563},
- {0.4293239697284514},
- {0.27634437856649213},
- {0.36766797895182063},
- {0.013121905320979592},
- {0.0676275082500854},
- {0.3452936960172337},
- {0.4345186472727168},
- {0.2189562078966338},
- {0.22367579361241008},
- {0.31993767643051},
- {0.29126154365843143},
- {0.010788732672779282},
- {0.3257149763519343},
- {0.2433471212117875},
- {0.3707104074345819},
- {0.11730999925712848},
- {0.2732380370460652},
- {0.3540765666701623},
- {0.2950759607487908},
- {0.12263693127951188},
- {0.36705522209888064},
- {0.08911647992361633},
- {0.029046755737833444},
- {0.015616838691283507},
- {0.2432041832609505},
- {0.3201689645389748},
- {0.19821572965427253},
- {0.13616250395167423},
- {0.30304299546716373},
- {0.3518527448176979},
- {0.32385815386526146},
- {0.309029972165002},
- {0.1465720651822187},
- {0.19509688888000573},
- {0.038735049168069996},
- {0.11792462483146773},
- {0.17774173614576438},
- {0.14029574425079044},
- {0.26974418130303707},
- {0.2563748657708595},
- {0.05657957198569196},
- {0.3230313582509936},
- {0.28857457363361483},
- {0.05078885038500418},
- {0.17731693434851212},
- {0.24150092994378053},
- {0.12007917275288037},
- {0.1914710009207324},
- {0.3830693943660101},
- {0.4181105590881659},
- {0.3539341180938374},
- {0.3208667344166333},
- {0.14754005490247815},
- {0.10291734198886542},
- {0.04780040017899993},
- {0.1377452866266799},
- {0.1259681983959568},
- {0.14195593032426135},
- {0.3657136208034843},
- {0.4380987146200122},
- {0.433005424094896},
- {0.42015665498455673},
- {0.05515274693232205},
- {0.29272878915910205},
- {0.3776271533811309},
- {0.3487592160565288},
- {0.1192522859639721},
- {0.3425276012475742},
- {0.4510291951486051},
- {0.11638360959486241},
- {0.1458477293575203},
- {0.36834582763767854},
- {0.18122138034042842},
- {0.13029604894664004},
- {0.22502487828513676},
- {0.12679553363190849},
- {0.37607855396950746},
- {0.12708548632627475},
- {0.45011771237305526},
- {0.3767067424829312},
- {0.15214456825888514},
- {0.1333176987687197},
- {0.7370952021050174},
- {0.4336595977078516},
- {0.3126576619644034},
- {0.6335807434059421},
- {0.24279414679252095},
- {0.35097109354381745},
- {0.17578857864737255},
- {0.8232487328162297},
- {0.08233598190276031},
- {0.6665135056776176},
- {0.7962329041212484},
- {0.24279416464995743},
- {0.6415183929392619},
- {0.4719795208980547},
- {0.16358139627657264},
- {0.7183074046883141},
- {0.30794356658933747},
- {0.577321757629459},
- {0.3202362842538761},
- {0.24397189310204145},
- {0.7319199150890239},
- {0.4293814633323356},
- {0.10024289801285986},
- {0.8050734984339928},
- {0.17548511048238416},
- {0.7760300542799994},
- {0.05093345472611349},
- {0.2546000023468836},
- {0.4622152321122972},
- {0.7604018506017698},
- {0.24705738304013353},
- {0.20782894395763862},
- {0.5254315801455783},
- {0.36552325493763854},
- {0.33134262785904517},
- {0.13417845572635176},
- {0.19010795398993605},
- {0.5842204737291596},
- {0.036771661287461385},
- {0.18768514937792388},
- {0.7604802104274806},
- {0.2802461472127505},
- {0.06143176348961091},
- {0.49903561665477436},
- {0.09181785998485988},
- {0.0462545643851685},
- {0.6284110997302349},
- {0.6693749087410475},
- {0.8352438079151226},
- {0.35770453828094495},
- {0.5571387897400663},
- {0.5702931965788268},
- {0.4788968909423702},
- {0.7188288012577285},
- {0.009616523174799736},
- {0.2729020816301758},
- {0.36989499810698717},
- {0.2675217122333863},
- {0.1624575298200459},
- {0.7409039256260466},
- {0.15085258551045608},
- {0.6276302292356022},
- {0.7524272052771126},
- {0.3908743408765192},
- {0.610156076254988},
- {0.08999322338438324},
- {0.3245552699540323},
- {0.7191916422891403},
- {0.2981970570434232},
- {0.02238874557673905},
- {0.3773995754394422},
- {0.568826182487237},
- {0.831832689313834},
- {0.7897073364687538},
- {0.8376535104531468},
- {0.6898400416701703},
- {0.639798837325072},
- {0.5021580515472279},
- {0.5394742326250136},
- {0.38423853151199333},
- {0.2403071855752274},
- {0.7493622682690145},
- {0.7607122413311969},
- {0.33796665047083335},
- {0.1178347054413748},
- {0.38793675518587484},
- {0.4063461104975427},
- {0.3172277293879994},
- {0.6129141099367074},
- {0.6280896283618934},
- {0.5368027203711216},
- {0.46351192474846076},
- {0.21979428329988313},
- {0.718124390418211},
- {0.310794245862261},
- {0.6542252961502214},
- {0.34310736914868295},
- {0.6179629887830502},
- {0.5536194370071751},
- {0.27507202656901897},
- {0.7010550038913383},
- {0.5267078571614955},
- {0.22038397807194712},
- {0.5013689045103582},
- {0.7648589735884418},
- {0.16953393326370259},
- {0.08111675119617703},
- {0.12120449793950692},
- {0.7040533218000821},
- {0.7551018594616934},
- {0.35723763940095643},
- {0.7068761857536349},
- {0.04305074811551793},
- {0.5199311770841946},
- {0.17422758084268128},
- {0.7315501997167836},
- {0.2646942652624297},
- {0.04801266125969391},
- {0.7946710409016509},
- {0.035902402802133894},
- {0.4520499128521895},
- {0.8062294839367097},
- {0.025084418705162155},
- {0.47646541206384874},
- {0.5572799246732488},
- {0.4606478234306003},
- {0.6836909326719504},
- {0.30431293919867247},
- {0.0866359200862372},
- {0.2476333685748297},
- {0.7590698321811395},
- {0.11464148775060942},
- {0.3910378911511808},
- {0.4756854440760559},
- {0.02906615823368269},
- {0.1429394280969047},
- {0.7959237750991863},
- {0.7070099876843786},
- {0.14946918529225028},
- {0.6809877845866196},
- {0.5290975871952027},
- {0.5121048930791728},
- {0.25137618348871343},
- {0.7623591781105645},
- {0.0740690599952696},
- {0.7543516542477908},
- {0.8159633553823906},
- {0.5951799972480157},
- {0.33695824169530747},
- {0.673233288439338},
- {0.16304719274641014},
- {0.7574322868385678},
- {0.4684517196991959},
- {0.37949916878918155},
- {0.5619406661121357},
- {0.4654855750505291},
- {0.8082272568907508},
- {0.715545076706054},
- {0.4745667182582594},
- {0.4151766075265941},
- {0.2354169268105473},
- {0.2563307331739382},
- {0.07393594723014646},
- {0.044324020314438474},
- {0.3127700270019167},
- {0.2891732711002395},
- {0.06957282989458292},
- {0.1288231311131967},
- {0.2534738448921565},
- {0.5652943757508506},
- {0.3312217539643587},
- {0.14033961018795793},
- {0.7769236753087821},
- {0.42348048861827764},
- {0.8045889684447585},
- {0.5178924405896896},
- {0.6890404933647719},
- {0.024591546269626074},
- {0.12673959745560343},
- {0.6471092188603066},
- {0.8143242279258147},
- {0.4103422167589583},
- {0.41918711448256984},
- {0.5995899208904054},
- {0.5458484535768868},
- {0.02021898590360138},
- {0.6104170633560704},
- {0.456052824988165},
- {0.6947422583886539},
- {0.2198487341628002},
- {0.5120708971963909},
- {0.6635690518463222},
- {0.552996989713575},
- {0.22983184957929023},
- {0.6878921358562772},
- {0.16701172473207654},
- {0.054436045698898},
- {0.029267259736127642},
- {0.4557849473327705},
- {0.6000233741185607},
- {0.37147282867278336},
- {0.2551799021718416},
- {0.5679278780347505},
- {0.6594014240024565},
- {0.6069372229686768},
- {0.57914797228773},
- {0.2746882891313301},
- {0.365627860634083},
- {0.07259271657370281},
- {0.2210005938112381},
- {0.3331028552297106},
- {0.26292593962394023},
- {0.5055231197919385},
- {0.4804679061274162},
- {0.1060348423774416},
- {0.605387738948907},
- {0.5408128473844894},
- {0.09518254656410723},
- {0.3323067411900942},
- {0.4525929083922736},
- {0.22503839652383914},
- {0.3588326438315056},
- {0.7179040318914696},
- {0.7835741005688247},
- {0.6633020913196268},
- {0.6013310531340886},
- {0.2765023826956407},
- {0.19287569263433574},
- {0.08958194133813227},
- {0.2581461690694493},
- {0.23607492232113983},
- {0.26603726695356766},
- {0.6853778630030519},
- {0.8210335730754581},
- {0.8114883213342503},
- {0.7874086551306336},
- {0.10336085308546669},
- {0.5485981941622691},
- {0.7077048178507969},
- {0.6536038927898911},
- {0.22348874163517987},
- {0.6419253262890429},
- {0.845266373299904},
- {0.21811260258083426},
- {0.27333082331275416},
- {0.6903108384034172},
- {0.33962399900584395},
- {0.24418567563491309},
- {0.42171541180978495},
- {0.23762541763700448},
- {0.7048026132431194},
- {0.23816881319771702},
- {0.8435581784683908},
- {0.7059798909719267},
- {0.2851316252090854},
- {0.2498484997136294},
- {0.7526264143725472},
- {0.44279716805781105},
- {0.319245620346402},
- {0.6469308194698682},
- {0.24791002248996058},
- {0.3583663479668946},
- {0.17949259099392245},
- {0.8405952720174468},
- {0.08407086989081843},
- {0.6805575025809912},
- {0.81301019722122},
- {0.24791004072366818},
- {0.6550357219163194},
- {0.4819245240727603},
- {0.16702819308292108},
- {0.7334427423539134},
- {0.3144321950398558},
- {0.5894864098192978},
- {0.3269839305447596},
- {0.2491125848990544},
- {0.7473420797315504},
- {0.438428889813626},
- {0.10235509969712513},
- {0.822037070248641},
- {0.1791827285009376},
- {0.7923816564401883},
- {0.05200666520775923},
- {0.2599646372929128},
- {0.4719544935573864},
- {0.7764241534421509},
- {0.2522630886902295},
- {0.21220807359343666},
- {0.5365028629052535},
- {0.3732251355698042},
- {0.33832429409681664},
- {0.13700570798856143},
- {0.19411368754881872},
- {0.5965304876359271},
- {0.0375464709392598},
- {0.19163983241768168},
- {0.7765041643749139},
- {0.28615116787641565},
- {0.06272618211559172},
- {0.5095507143913875},
- {0.09375253907285644},
- {0.04722918673484134},
- {0.6416522470790567},
- {0.6834791977996736},
- {0.852843093378958},
- {0.3652416720151414},
- {0.5688781699194732},
- {0.5823097511100445},
- {0.48898764888821594},
- {0.7339751251850373},
- {0.009819151359431651},
- {0.2786523566909069},
- {0.3776889950233836},
- {0.27315861841186084},
- {0.16588064582037798},
- {0.7565153908830199},
- {0.15403117563012797},
- {0.6408549229901379},
- {0.7682814756721029},
- {0.3991103900880009},
- {0.6230125749943314},
- {0.09188945585344624},
- {0.33139392088515485},
- {0.7343456115803887},
- {0.30448031838777556},
- {0.022860495167515125},
- {0.38535170007556274},
- {0.5808118258048274},
- {0.8493600996563619},
- {0.8063471304016062},
- {0.8553035703644521},
- {0.7043755481925618},
- {0.6532799338274458},
- {0.5127389415980058},
- {0.5508414058148997},
- {0.39233475867129913},
- {0.2453706589202211},
- {0.7651519578783432},
- {0.7767410843637957},
- {0.3450878904040444},
- {0.12031758121843228},
- {0.3961109070104449},
- {0.4149081628324367},
- {0.32391198291210466},
- {0.625828722751993},
- {0.6413240020401697},
- {0.5481136025638991},
- {0.4732785085916886},
- {0.22442553264104173},
- {0.7332558718201025},
- {0.31734294050879847},
- {0.6680103702034492},
- {0.3503369283231065},
- {0.630983985697502},
- {0.5652846614816164},
- {0.2808680241841199},
- {0.7158268190456838},
- {0.5378060321451191},
- {0.22502765277505601},
- {0.5119331665731843},
- {0.7809751917371993},
- {0.17310615500188267},
- {0.08282594897372643},
- {0.12375837806232129},
- {0.7188883140199589},
- {0.7710124870568993},
- {0.36476493518533054},
- {0.7217706580774925},
- {0.04395786337735733},
- {0.530886561751928},
- {0.1778987016601796},
- {0.7469645741472609},
- {0.2702715947689143},
- {0.049024328180634014},
- {0.8114154242375553},
- {0.03665889645077231},
- {0.4615749825202259},
- {0.8232174133325354},
- {0.025612968382876595},
- {0.48650493671652084},
- {0.569022278683715},
- {0.4703540582640986},
- {0.698096872325863},
- {0.310725067294138},
- {0.08846141136743046},
- {0.25285121072178096},
- {0.7750640682795639},
- {0.1170570797607531},
- {0.3992773865037104},
- {0.4857085341510158},
- {0.029678606492794562},
- {0.14595128137288904},
- {0.8126945545921694},
- {0.7219072793268022},
- {0.15261862601252502},
- {0.6953367666500012},
- {0.5402461157889294},
- {0.52289537139858},
- {0.2566728898756429},
- {0.7784227234782737},
- {0.07562975702593487},
- {0.770246474391818},
- {0.8331563855890425},
- {0.6077209374796816},
- {0.3440582336123865},
- {0.687418876784585},
- {0.16648273343767697},
- {0.7733920184873083},
- {0.47832238915269343},
- {0.38749553361286154},
- {0.5737812258420322},
- {0.47529374535598834},
- {0.8252572810332565},
- {0.7306222098112078},
- {0.48456623584475955},
- {0.4239247258179538},
- {0.2403773583141337},
- {0.2617318360657309},
- {0.07549383946354167},
- {0.045257964486219646},
- {0.31936035300921534},
- {0.29526639372907715},
- {0.0710387875972781},
- {0.13153754220768354},
- {0.25881475075892146},
- {0.5772056009472076},
- {0.33820087328809434},
- {0.1432966831266324},
- {0.7932941068112936},
- {0.43240357662794643},
- {0.8215423308073694},
- {0.5288048673746919},
- {0.7035591527357862},
- {0.025109710712983725},
- {0.12941010675367345},
- {0.6607443512145704},
- {0.8314827203463178},
- {0.41898847039432535},
- {0.42801973750907885},
- {0.6122237819007955},
- {0.5573499369323538},
- {0.02064501684371091},
- {0.623279061311871},
- {0.46566223936214246},
- {0.7093810587165386},
- {0.22448113082917232},
- {0.5228606591941205},
- {0.6775510066453175},
- {0.5646490987030496},
- {0.23467459883537117},
- {0.7023865983743306},
- {0.1705308014274239},
- {0.05558305870120767},
- {0.029883945372057154},
- {0.46538871730054937},
- {0.6126663683509217},
- {0.3793000717985834},
- {0.260556756092095},
- {0.5798945933263645},
- {0.6732955633978102},
- {0.6197258977776718},
- {0.5913511043474996},
- {0.2804762010777375},
- {0.373331945395744},
- {0.07412230581395697},
- {0.2256572611235881},
- {0.34012161093008453},
- {0.2684660090305476},
- {0.5161749146445033},
- {0.4905917666768941},
- {0.10826908517269379},
- {0.6181437648339265},
- {0.5522082263067076},
- {0.09718812241188023},
- {0.33930872210194263},
- {0.4621294194303926},
- {0.2297801437157552},
- {0.36639354769297444},
- {0.7330308701549388},
- {0.8000846620926524},
- {0.6772784210370922},
- {0.6140016012567884},
- {0.28232851911039364},
- {0.1969397447608396},
- {0.0914695077505666},
- {0.2635855247136284},
- {0.24104921834035042},
- {0.271642894628703},
- {0.6998193476896525},
- {0.8383334370086201},
- {0.8285870588314833},
- {0.8040000139255341},
- {0.10553875269034652},
- {0.5601576168512038},
- {0.722616750145844},
- {0.6673758733546991},
- {0.2281978363027701},
- {0.6554512296920579},
- {0.863076842597268},
- {0.22270841750302073},
- {0.279090132319251},
- {0.7048562650066585},
- {0.3467801606585629},
- {0.24933087200865867},
- {0.43060130817514114},
- {0.24263238388904487},
- {0.7196533936602587},
- {0.2431872292486091},
- {0.861332654672262},
- {0.7208554776152519},
- {0.2911395869793712},
- {0.25511301652596835},
- {0.6397761909367077},
- {0.37640332591005715},
- {0.27137733018409127},
- {0.5499287927929682},
- {0.21073792635339358},
- {0.30463222215406954},
- {0.1525791335176408},
- {0.7145548322258624},
- {0.07146512516747683},
- {0.5785134276447832},
- {0.6911059155484598},
- {0.21073794185310468},
- {0.5568184308870912},
- {0.4096638524005313},
- {0.14198367092752154},
- {0.6234689548659506},
- {0.2672856389423643},
- {0.5010977062206362},
- {0.2779553435629059},
- {0.21176017428777566},
- {0.6352841993939045},
- {0.3726900355409617},
- {0.08700778308686782},
- {0.6987792822165263},
- {0.15231573239101243},
- {0.6735704570614311},
- {0.044208687782609474},
- {0.22098504948721506},
- {0.40118874705631297},
- {0.6600056521462904},
- {0.21443828560111566},
- {0.18038919498036907},
- {0.4560586122164169},
- {0.3172630551317459},
- {0.28759531162491064},
- {0.11646281384713773},
- {0.16500791529114237},
- {0.5070855817298181},
- {0.03191668230334652},
- {0.16290499466212408},
- {0.6600736660889569},
- {0.2432451223077102},
- {0.05332090011665597},
- {0.4331477196613939},
- {0.07969510662030362},
- {0.04014755343850903},
- {0.5454416994976944},
- {0.580997038374344},
- {0.724966192162616},
- {0.310476647153038},
- {0.48357950466241484},
- {0.49499712924781397},
- {0.41566791896562794},
- {0.623921511211718},
- {0.008346849293358154},
- {0.23687069700824998},
- {0.32105759508350773},
- {0.23220070020365807},
- {0.14100818906490084},
- {0.6430820469776318},
- {0.13093545077381072},
- {0.5447639276857978},
- {0.6530839028318057},
- {0.339267025788138},
- {0.5295968949851971},
- {0.07811137761112968},
- {0.28170409163786936},
- {0.6242364461785029},
- {0.2588259654369534},
- {0.019432749425082264},
- {0.3275713396942941},
- {0.4937238056867769},
- {0.7220054450849883},
- {0.685441921529112},
- {0.7270577405903698},
- {0.598760150595148},
- {0.5553259089743063},
- {0.43585789807014874},
- {0.4682472069709124},
- {0.33350734531959836},
- {0.2085793197445546},
- {0.6504236308358654},
- {0.66027506184806},
- {0.2933447615509796},
- {0.10227693626567773},
- {0.33671729085790997},
- {0.35269605070502846},
- {0.275344009549582},
- {0.5319907842390227},
- {0.5451626721387516},
- {0.46592841568187043},
- {0.40231423678031497},
- {0.19077474518580326},
- {0.623310104052271},
- {0.26975994174830414},
- {0.567847635950009},
- {0.297806748828877},
- {0.5363730573396879},
- {0.48052481365427685},
- {0.23875414314051452},
- {0.6084943963084116},
- {0.457166381803699},
- {0.19128658229179576},
- {0.43517294247161054},
- {0.6638742991796802},
- {0.14715029177807118},
- {0.07040687003964086},
- {0.10520181354414208},
- {0.6110968449546587},
- {0.655405421221014},
- {0.3100713931422418},
- {0.613547004910359},
- {0.03736673847240366},
- {0.4512844298459728},
- {0.1512242349554281},
- {0.6349632977086037},
- {0.22974656232840376},
- {0.041673527991686686},
- {0.6897502658324604},
- {0.0311621924069342},
- {0.39236555947170476},
- {0.6997826424332176},
- {0.021772511617520543},
- {0.41355746933741033},
- {0.4837020054868698},
- {0.3998282840480701},
- {0.5934229112245745},
- {0.2641343649195832},
- {0.07519734057795809},
- {0.2149382235065181},
- {0.6588495007170386},
- {0.09950532054331881},
- {0.33940898244645135},
- {0.4128804808739695},
- {0.025228540284623503},
- {0.1240670710938638},
- {0.6908376009702641},
- {0.6136631409119864},
- {0.129734701508835},
- {0.5910766609971521},
- {0.459240594705867},
- {0.44449145363934117},
- {0.2181868728833519},
- {0.6617045528234569},
- {0.06428968867889133},
- {0.6547542659390359},
- {0.7082313464524551},
- {0.5165981144275633},
- {0.29246949343979034},
- {0.5843459944651044},
- {0.14151999852979563},
- {0.6574281612228121},
- {0.40660182838118863},
- {0.3293937227894168},
- {0.4877473871366164},
- {0.40402730514501517},
- {0.7015166485252973},
- {0.6210713382900168},
- {0.4119094609292346},
- {0.36036065323831085},
- {0.20433472404480385},
- {0.22248727114448197},
- {0.06417415085203759},
- {0.03847189997002922},
- {0.2714748596151463},
- {0.2509935940118363},
- {0.060387097861345294},
- {0.1118145551521289},
- {0.2200075791079171},
- {0.4906583049828284},
- {0.2874903967649233},
- {0.12181050831314714},
- {0.674346092903725},
- {0.36756816917337143},
- {0.6983587249397706},
- {0.449514868648107},
- {0.5980661670122447},
- {0.0213447133514018},
- {0.11000611138077257},
- {0.561671097546352},
- {0.7068086337314483},
- {0.35616454925881846},
- {0.36384165115647904},
- {0.5204257938673323},
- {0.4737798366626158},
- {0.017549464097808738},
- {0.5298234238419001},
- {0.3958399653173745},
- {0.6030151254346814},
- {0.19082200687679082},
- {0.4444619462482584},
- {0.5759577313776045},
- {0.4799845483569028},
- {0.19948704707323145},
- {0.5970694276622662},
- {0.14496109157366951},
- {0.04724883009336908},
- {0.02540309026522092},
- {0.39560745566934535},
- {0.5208020180707547},
- {0.3224271039698032},
- {0.22148838487737488},
- {0.49294410477531786},
- {0.5723403573130664},
- {0.5268030283465064},
- {0.5026828049359238},
- {0.2384210707293751},
- {0.3173538496910245},
- {0.06300826754351146},
- {0.19182178597759997},
- {0.2891231353838644},
- {0.22821170951957037},
- {0.4387786748404964},
- {0.4170315123089601},
- {0.0920350144310782},
- {0.5254581233990117},
- {0.4694090838214241},
- {0.08261555211665082},
- {0.2884321326390867},
- {0.39283686306632665},
- {0.1953264757813653},
- {0.31145580842020004},
- {0.6231188395609591},
- {0.6801184595245203},
- {0.5757260177693598},
- {0.5219370436375107},
- {0.23999564870419157},
- {0.16741022815705908},
- {0.07775439731848952},
- {0.22406301422190658},
- {0.20490584411208707},
- {0.2309122469020166},
- {0.5948871153850758},
- {0.712632141022311},
- {0.7043471531631013},
- {0.6834467361222881},
- {0.08971407314840585},
- {0.4761665277613449},
- {0.6142662323389139},
- {0.5673082767549252},
- {0.19398142252487752},
- {0.5571716366436127},
- {0.733665473730285},
- {0.18931509752871337},
- {0.23724283173357774},
- {0.5991687878238832},
- {0.2947832896132373},
- {0.21194573101664707},
- {0.3660361362500486},
- {0.20625162683379816},
- {0.61174720711135},
- {0.20672327763414491},
- {0.7321828126309288},
- {0.6127690483319413},
- {0.24748556844611141},
- {0.21686088988442875},
- {0.593950740684921},
- {0.34944256661571077},
- {0.2519393008857424},
- {0.510538870358902},
- {0.1956433346866845},
- {0.2828122342595942},
- {0.14165029997940573},
- {0.6633731887383205},
- {0.06634627019210637},
- {0.5370760645886309},
- {0.6416038549836356},
- {0.1956433490761929},
- {0.5169350221804695},
- {0.3803207309244884},
- {0.13181376191742075},
- {0.5788115481360876},
- {0.24814068649823365},
- {0.46520542336766285},
- {0.2580461488334004},
- {0.19659236174707087},
- {0.5897804984317793},
- {0.34599524926263253},
- {0.0807756492690591},
- {0.648727599006326},
- {0.14140576556803744},
- {0.6253244142914597},
- {0.04104213821202822},
- {0.20515648391205937},
- {0.37245267461371645},
- {0.6127312199201622},
- {0.19907864713988307},
- {0.1674684014315661},
- {0.42339235870138137},
- {0.2945383545948546},
- {0.2669956318740613},
- {0.10812089528602159},
- {0.15318884149557915},
- {0.4707644034363031},
- {0.02963057607148961},
- {0.15123654742321258},
- {0.6127943622067867},
- {0.22582212750232133},
- {0.04950166725008305},
- {0.4021225118462102},
- {0.07398676017747569},
- {0.037271892013638425},
- {0.5063731755049747},
- {0.5393817809520921},
- {0.6730388109255393},
- {0.2882380387927894},
- {0.4489420035368323},
- {0.4595418143385304},
- {0.3858947423271939},
- {0.5792316890862794},
- {0.007748986896365977},
- {0.21990428516668858},
- {0.2980611018412122},
- {0.21556878769057514},
- {0.13090815120067933},
- {0.5970198071364715},
- {0.12155689610011217},
- {0.505743950667611},
- {0.6063052569187034},
- {0.3149662399311913},
- {0.4916632917838774},
- {0.07251646942366408},
- {0.2615263841521073},
- {0.5795240661072428},
- {0.24028695668510203},
- {0.018040833776063307},
- {0.3041082844200833},
- {0.4583596955242896},
- {0.6702901342091349},
- {0.6363455576435906},
- {0.6749805473568746},
- {0.5558725691525233},
- {0.5155494056036959},
- {0.4046385674545181},
- {0.43470791714962803},
- {0.3096191099053164},
- {0.19363934327167087},
- {0.6038355330608982},
- {0.6129813325285721},
- {0.27233326414374565},
- {0.09495111401542203},
- {0.3125991356659609},
- {0.32743337986083654},
- {0.25562185766195394},
- {0.4938857131799372},
- {0.5061141341263439},
- {0.4325552146528318},
- {0.37349754853161815},
- {0.17711006256920026},
- {0.5786640753795519},
- {0.2504377616396437},
- {0.527174234906868},
- {0.27647565125689166},
- {0.4979540958282705},
- {0.4461061118413462},
- {0.2216528251110413},
- {0.5649095769894935},
- {0.42442078172836384},
- {0.17758523815797791},
- {0.40400267338585577},
- {0.6163227661569269},
- {0.13661031159290826},
- {0.06536381503682541},
- {0.09766649019003848},
- {0.5673256192288425},
- {0.6084604911808054},
- {0.28786181203835903},
- {0.5696002808075331},
- {0.03469025935486792},
- {0.41896013819167705},
- {0.14039244916223026},
- {0.5894825820723217},
- {0.21329043312002435},
- {0.038688565108020385},
- {0.6403453068158017},
- {0.028930128259955275},
- {0.36426146825855765},
- {0.6496590912255115},
- {0.02021300508676901},
- {0.38393545853761935},
- {0.4490557299562431},
- {0.37118965791683495},
- {0.5509176219033555},
- {0.24521512977004156},
- {0.0698111570366847},
- {0.19954277583585014},
- {0.6116578805126068},
- {0.09237802168327568},
- {0.3150980286153356},
- {0.3833069609395654},
- {0.023421487702617396},
- {0.11518048000960886},
- {0.6413547590580393},
- {0.5697080982992808},
- {0.12044215328002533},
- {0.5487394272781861},
- {0.4263464243312514},
- {0.4126537246262134},
- {0.20255873318301396},
- {0.6143084329047149},
- {0.05968479094747694},
- {0.6078559764028085},
- {0.6575026372673026},
- {0.47959557896558164},
- {0.27152068913657385},
- {0.5424908603126668},
- {0.1313833011282169},
- {0.6103383477489313},
- {0.37747803146169534},
- {0.3058001351086422},
- {0.4528113517834672},
- {0.3750879144102981},
- {0.6512688951183931},
- {0.5765856663959914},
- {0.3824054925455154},
- {0.3345489875001789},
- {0.18969877656179715},
- {0.20655110546666938},
- {0.0595775287848503},
- {0.035716261102651144},
- {0.2520298445455946},
- {0.2330155969890549},
- {0.05606173222864919},
- {0.1038055788770858},
- {0.2042490271107496},
- {0.45551376840247143},
- {0.26689823178371547},
- {0.11308554876021937},
- {0.6260444934215658},
- {0.34124024842669115},
- {0.6483371651177756},
- {0.4173173259097432},
- {0.5552282937497686},
- {0.019815848861475704},
- {0.10212666907597007},
- {0.5214401053601749},
- {0.6561818296373927},
- {0.3306534391788801},
- {0.33778065088670095},
- {0.4831490920074262},
- {0.43984425943600064},
- {0.016292443118671972},
- {0.49187359498698385},
- {0.3674870117450293},
- {0.5598227715722732},
- {0.1771539390321974},
- {0.41262633077030325},
- {0.5347034259810046},
- {0.44560454429618346},
- {0.18519832567185227},
- {0.5543029481623958},
- {0.13457791791941415},
- {0.04386452329425438},
- {0.023583535136909355},
- {0.3672711561386162},
- {0.4834983682816169},
- {0.29933251648419673},
- {0.20562376674007563},
- {0.4576358424950049},
- {0.5313451547051994},
- {0.4890695423087747},
- {0.466676985719218},
- {0.221343609782149},
- {0.2946226457837072},
- {0.05849515456639523},
- {0.17808210664121313},
- {0.2684140217205762},
- {0.21186551769559414},
- {0.40735013682940113},
- {0.38716066514166964},
- {0.08544279353417539},
- {0.4878209692905357},
- {0.43578657188189573},
- {0.07669802200662519},
- {0.2677725136465181},
- {0.36469901364251966},
- {0.18133576492719838},
- {0.289147065368207},
- {0.5784865106500562},
- {0.6314034009246825},
- {0.5344883093961842},
- {0.4845520950154674},
- {0.2228054049656164},
- {0.15541908314302005},
- {0.07218505867061134},
- {0.20801398229957435},
- {0.1902289888325699},
- {0.2143726228384142},
- {0.5522769490523862},
- {0.6615882147417332},
- {0.6538966583111344},
- {0.634493282008807},
- {0.08328809504201812},
- {0.4420599982614808},
- {0.570267991907075},
- {0.5266735085623222},
- {0.18008705422294113},
- {0.5172629287572882},
- {0.6811149863189666},
- {0.17575496555347947},
- {0.22024976488111717},
- {0.5562519367940782},
- {0.2736687543044893},
- {0.19676462754581978},
- {0.339817950906946},
- {0.1914783767524157},
- {0.5679293976909867},
- {0.19191624447268898},
- {0.6797385242520397},
- {0.5688780471693988},
- {0.2297588418727801},
- {0.20132772678499072},
- {0.7325137028998503},
- {0.4309641370719153},
- {0.31071430264570415},
- {0.6296426501121127},
- {0.2412850321118495},
- {0.34878959272612725},
- {0.17469594470938138},
- {0.8181317365255456},
- {0.08182421322679163},
- {0.6623707150478936},
- {0.791283827791703},
- {0.24128504985829105},
- {0.6375309622804303},
- {0.46904587841378104},
- {0.16256463747135866},
- {0.7138426831784646},
- {0.30602950826751385},
- {0.5737333484712507},
- {0.3182458191449121},
- {0.2424554580050038},
- {0.7273705834699197},
- {0.42671259392801364},
- {0.09961982685969269},
- {0.800069472383297},
- {0.17439436278534629},
- {0.7712065510653318},
- {0.050616872035468254},
- {0.2530175070259853},
- {0.45934228067740657},
- {0.7556754862675691},
- {0.24552176972885903},
- {0.2065371594787363},
- {0.5221657002973146},
- {0.36325130350289253},
- {0.3292831300060692},
- {0.13334445424797386},
- {0.18892631634311177},
- {0.58058918481507},
- {0.03654310283737236},
- {0.18651857094919316},
- {0.7557533590388558},
- {0.27850424535659996},
- {0.06104992736478484},
- {0.49593380392485215},
- {0.09124715561541148},
- {0.04596706387049847},
- {0.6245051389456441},
- {0.6652143327345862},
- {0.8300522548685751},
- {0.35548118497035686},
- {0.5536758301181989},
- {0.5667484742425853},
- {0.4759202527564973},
- {0.7143608389480995},
- {0.009556750579406368},
- {0.2712058276503555},
- {0.36759587360450396},
- {0.26585890055253153},
- {0.16144775653483343},
- {0.7362987528659106},
- {0.14991494407873898},
- {0.6237291220405344},
- {0.7477504082594703},
- {0.3884448168788974},
- {0.6063635816485832},
- {0.08943386025160405},
- {0.3225379596973914},
- {0.7147214246997425},
- {0.2963435792620918},
- {0.022249585777880523},
- {0.3750538053815605},
- {0.5652905785442173},
- {0.826662338463578},
- {0.7847988205484036},
- {0.8324469796259393},
- {0.6855522622984168},
- {0.6358220947600675},
- {0.4990368309674959},
- {0.5361210690703992},
- {0.3818502531434876},
- {0.2388135288853389},
- {0.7447045217165311},
- {0.7559839477280549},
- {0.33586598025064585},
- {0.11710229040491951},
- {0.3855254900867893},
- {0.40382041995315904},
- {0.3152559642945658},
- {0.6091044724577339},
- {0.6241856657192173},
- {0.533466161905284},
- {0.4606309135727592},
- {0.2184281268911005},
- {0.7136608064544079},
- {0.3088624688186416},
- {0.6501588842867978},
- {0.3409747462058766},
- {0.6141219694223939},
- {0.550178352323175},
- {0.2733622850492117},
- {0.6966975166441903},
- {0.5234340444680344},
- {0.2190141563481254},
- {0.49825258896394053},
- {0.760104905498522},
- {0.16848017578667882},
- {0.0806125607875708},
- {0.12045113757386257},
- {0.6996771981663771},
- {0.7504084378262462},
- {0.35501718815355016},
- {0.7024825162874206},
- {0.04278316128587934},
- {0.516699485617814},
- {0.173144649464388},
- {0.7270031661056968},
- {0.26304902790035095},
- {0.047714233093602135},
- {0.7897316725108884},
- {0.03567924732719413},
- {0.44924014511728416},
- {0.8012182727264214},
- {0.0249285036428587},
- {0.47350388701196117},
- {0.5538160878111249},
- {0.45778461440294393},
- {0.679441373787737},
- {0.3024214474550291},
- {0.08609742465460168},
- {0.24609417515984286},
- {0.7543517471591877},
- {0.11392892052251102},
- {0.3886073505881938},
- {0.47272876700405736},
- {0.02888549421570431},
- {0.14205097179662926},
- {0.7909766201962963},
- {0.7026154865570199},
- {0.14854014254219877},
- {0.6767550274272972},
- {0.5258089208624578},
- {0.5089218467726658},
- {0.2498137261812144},
- {0.7576206477842367},
- {0.07360867531425866},
- {0.7496628955983208},
- {0.8108916421851621},
- {0.5914805881668878},
- {0.33486383935475117},
- {0.6690487302342808},
- {0.16203375434409914},
- {0.7527243801662565},
- {0.4655400046651924},
- {0.37714034846963007},
- {0.558447859880605},
- {0.4625922964265191},
- {0.8032036282950625},
- {0.7110975247604874},
- {0.4716169947540367},
- {0.41259603002187706},
- {0.23395366608115276},
- {0.25473748029840393},
- {0.07347638992669255},
- {0.04404851931638493},
- {0.3108259692655251},
- {0.2873758816885084},
- {0.06914039204401361},
- {0.1280224162650784},
- {0.25189834933122},
- {0.5617807241549758},
- {0.3291630074168462},
- {0.13946731335209006},
- {0.7720946176908008},
- {0.42084829739458274},
- {0.7995879540454126},
- {0.5146734211222618},
- {0.6847576836766023},
- {0.024438694712098138},
- {0.1259518330483087},
- {0.6430870377860056},
- {0.8092627029120365},
- {0.4077916879608346},
- {0.4165816092149551},
- {0.5958631014264602},
- {0.5424556703257377},
- {0.020093312493189686},
- {0.6066229465546048},
- {0.453218176696831},
- {0.6904240087303822},
- {0.21848223930847557},
- {0.5088880621951665},
- {0.6594445628048452},
- {0.5495597739216432},
- {0.22840330353372854},
- {0.6836164639150328},
- {0.16597364432953368},
- {0.054097692255014894},
- {0.029085345748849533},
- {0.45295196406552257},
- {0.596293860476693},
- {0.36916389698465785},
- {0.2535938024175139},
- {0.564397857605398},
- {0.6553028393266564},
- {0.6031647355115937},
- {0.5755482120842544},
- {0.27298093277528557},
- {0.3633552590107131},
- {0.07214150827342689},
- {0.21962693944203845},
- {0.3310324164829714},
- {0.261291693491331},
- {0.5023809832471529},
- {0.47748150311767656},
- {0.1053757707342062},
- {0.6016248824862798},
- {0.5374513635173306},
- {0.0945909286018903},
- {0.33024125078086863},
- {0.449779765606726},
- {0.2236396447318567},
- {0.35660227865234406},
- {0.7134418175911946},
- {0.7787037064749637},
- {0.659179261601718},
- {0.5975934114643174},
- {0.27478375063436944},
- {0.19167685179264163},
- {0.08902513457576847},
- {0.2565416321452758},
- {0.23460757174568447},
- {0.26438368201147094},
- {0.6811178188111753},
- {0.8159303453625136},
- {0.8064444232209839},
- {0.7825144269260269},
- {0.10271840192732037},
- {0.5451883195852365},
- {0.7033059979273775},
- {0.6495413433298494},
- {0.22209962189970844},
- {0.637935366289614},
- {0.840012523856347},
- {0.216756898850153},
- {0.27163190444015967},
- {0.6860201327409309},
- {0.33751302734701705},
- {0.24266791174818633},
- {0.4190941916220866},
- {0.23614842978126704},
- {0.7004218323030842},
- {0.23668844780496348},
- {0.8383149465044218},
- {0.701591792528042},
- {0.2833593571078513},
- {0.24829553789868178},
- {0.39095929066609736},
- {0.23001540130260023},
- {0.16583531868588666},
- {0.3360546606656573},
- {0.128779331539266},
- {0.18615697047590557},
- {0.09323921498730159},
- {0.4366555903558034},
- {0.04367145110844656},
- {0.35352237628860483},
- {0.4223262483750347},
- {0.1287793410109471},
- {0.34026483300464466},
- {0.25034049627816984},
- {0.08676445928805114},
- {0.38099414107587365},
- {0.1633349369459096},
- {0.3062145896545396},
- {0.16985506102860834},
- {0.12940401456588152},
- {0.3882142903798548},
- {0.22774625563993767},
- {0.05316937647877665},
- {0.42701534751949616},
- {0.09307825382762401},
- {0.4116105473084538},
- {0.02701538047463512},
- {0.1350412213196616},
- {0.24516146457827986},
- {0.4033212633638875},
- {0.13104057515413237},
- {0.11023359842462527},
- {0.27869175824321063},
- {0.19387551576006856},
- {0.17574592587940435},
- {0.07116898023977757},
- {0.10083428928804655},
- {0.3098737060687331},
- {0.019503888469907103},
- {0.09954922058887482},
- {0.4033628258401988},
- {0.14864407557301315},
- {0.032583740349518484},
- {0.2646911961267547},
- {0.048700690640291866},
- {0.024533671675586816},
- {0.33331265363769275},
- {0.3550400799838583},
- {0.44301784320829407},
- {0.18972842606352677},
- {0.2955094340829947},
- {0.30248660277453954},
- {0.2540095068457019},
- {0.38127069264255303},
- {0.005100656018865435},
- {0.14474874337905919},
- {0.19619431203439214},
- {0.14189496628638085},
- {0.08616835442752256},
- {0.39297945826706987},
- {0.08001302906040615},
- {0.3328984756945833},
- {0.399091468256637},
- {0.2073218691591617},
- {0.32363009023395123},
- {0.04773289349684484},
- {0.17214587445529714},
- {0.38146314549241583},
- {0.15816533545120592},
- {0.011875112013466246},
- {0.20017478053054644},
- {0.3017084905483208},
- {0.44120856741199366},
- {0.4188650519199132},
- {0.44429596249640196},
- {0.36589489742196896},
- {0.339352771385922},
- {0.2663473525190612},
- {0.2861400572373592},
- {0.20380219990240692},
- {0.1274602338288882},
- {0.39746580905386336},
- {0.40348589628926756},
- {0.17925934337861626},
- {0.06250016649632839},
- {0.20576375778548117},
- {0.2155281796318255},
- {0.1682593072196918},
- {0.32509296624882533},
- {0.33314214348136917},
- {0.2847230726567994},
- {0.24584923738130268},
- {0.116580079270605},
- {0.3808970693149709},
- {0.16484695268454944},
- {0.3470046433462831},
- {0.1819860084309275},
- {0.327770918956682},
- {0.29364275031660253},
- {0.14589969393694077},
- {0.3718433741754647},
- {0.27936870249059065},
- {0.1168928565741843},
- {0.2659287846530858},
- {0.40568534555612595},
- {0.08992171717211545},
- {0.04302476453276021},
- {0.06428752270350387},
- {0.37343369824682787},
- {0.40051011933426506},
- {0.18948078036672691},
- {0.37493096058929887},
- {0.02283435015968224},
- {0.2757743146441817},
- {0.09241125329020933},
- {0.38801819134235377},
- {0.14039527308663632},
- {0.02546617578770666},
- {0.42149782765718513},
- {0.019042829057420652},
- {0.23976972414098432},
- {0.4276284884962272},
- {0.01330491165284282},
- {0.25271983726855424},
- {0.2955842928165852},
- {0.24433010251727325},
- {0.36263337667769197},
- {0.16140923249786318},
- {0.04595216162904044},
- {0.1313460810039},
- {0.402614753573298},
- {0.06080646652411476},
- {0.20740861711137648},
- {0.2523061380199647},
- {0.0154168478820326},
- {0.07581584747450507},
- {0.42216228466608025},
- {0.37500192985864683},
- {0.07927926608586436},
- {0.361199612280653},
- {0.2806362282541467},
- {0.2716232111850673},
- {0.13333129032238095},
- {0.4043594404843657},
- {0.039286630917357984},
- {0.40011220642227796},
- {0.4327913866740616},
- {0.3156866967499015},
- {0.1787244778979359},
- {0.35708658549041455},
- {0.08648111483997008},
- {0.4017461906471833},
- {0.2484693313996331},
- {0.20128841622422225},
- {0.29805637533960466},
- {0.24689607219981186},
- {0.42868811810010105},
- {0.3795289873407153},
- {0.25171275978208385},
- {0.22021192312228324},
- {0.12486641407215533},
- {0.13595921033186356},
- {0.039216027185190794},
- {0.023509700635839476},
- {0.16589491771086526},
- {0.153379070472958},
- {0.036901806099863696},
- {0.06832848703609573},
- {0.13444390130126901},
- {0.2998352011109671},
- {0.17568181371045832},
- {0.0744368899631278},
- {0.41208452874604756},
- {0.22461634666500718},
- {0.4267583501867818},
- {0.27469295775640046},
- {0.36547081266678516},
- {0.013043489441389321},
- {0.06722336949018672},
- {0.3432302373785804},
- {0.43192198458610315},
- {0.21764773605401858},
- {0.22233911775093088},
- {0.31802574415408563},
- {0.289520978582087},
- {0.010724259721519098},
- {0.32376851920706184},
- {0.24189289043593568},
- {0.36849505974221797},
- {0.11660896030345046},
- {0.27160517958456304},
- {0.35196062201589384},
- {0.2933126008980635},
- {0.12190405883444408},
- {0.3648617176195375},
- {0.08858392409515549},
- {0.028873173712608474},
- {0.015523513209012388},
- {0.2417508066754672},
- {0.3182556500958589},
- {0.19703120191921747},
- {0.13534880333020174},
- {0.30123202499740775},
- {0.349750089616626},
- {0.3219227930029008},
- {0.3071832238083947},
- {0.14569615751991835},
- {0.19393099918848425},
- {0.038503570363949205},
- {0.11721991290470755},
- {0.17667956001822538},
- {0.13945734358266432},
- {0.26813220295661383},
- {0.2548427818156341},
- {0.05624145516533924},
- {0.321100938279742},
- {0.28685006576182825},
- {0.05048533864041392},
- {0.17625729681622798},
- {0.24005773191878546},
- {0.11936158535062755},
- {0.1903267793625092},
- {0.3807801899579204},
- {0.41561195035301074},
- {0.3518190247054587},
- {0.31894925013404896},
- {0.14665836257983375},
- {0.10230231286773264},
- {0.04751474727013385},
- {0.1369221273715239},
- {0.1252154184576785},
- {0.14110760846343867},
- {0.36352813366941716},
- {0.4354806576218894},
- {0.43041780435773236},
- {0.4176458188780316},
- {0.054823156750353354},
- {0.29097945589371066},
- {0.37537047154528447},
- {0.34667504763560897},
- {0.11853963999768363},
- {0.34048067265917553},
- {0.44833386621631033},
- {0.11568810670156837},
- {0.14497615029151925},
- {0.36614461056126557},
- {0.1801384100253449},
- {0.12951740598013792},
- {0.22368014035807593},
- {0.12603780957776775},
- {0.37383112648979494},
- {0.12632602952867852},
- {0.44742783041830125},
- {0.3744555609786602},
- {0.15123535958430132},
- {0.13252099856717311},
- {0.3202344468805934},
- {0.18840543393829967},
- {0.1358355788454653},
- {0.27526210771602566},
- {0.10548304897644821},
- {0.15248102781174827},
- {0.07637216751689915},
- {0.3576642499444647},
- {0.03577125118668781},
- {0.2895698998169672},
- {0.3459270972205679},
- {0.10548305673469473},
- {0.27871065656097194},
- {0.20505370321515376},
- {0.07106870022621574},
- {0.3120720007044949},
- {0.1337875181327305},
- {0.2508201290669388},
- {0.13912814663054288},
- {0.10599472635125388},
- {0.3179860193093895},
- {0.18654677851426255},
- {0.04355099437247768},
- {0.34976793463444933},
- {0.07624032435785622},
- {0.33714987492167375},
- {0.022128276856713067},
- {0.11061215796075125},
- {0.20081156243122292},
- {0.33036012897523076},
- {0.10733523183936283},
- {0.09029225359761599},
- {0.22827619954788753},
- {0.158803282171238},
- {0.1439533493874052},
- {0.0582944556281327},
- {0.08259328689117519},
- {0.25381730843815803},
- {0.015975619675235666},
- {0.08154068813241007},
- {0.3303941727668231},
- {0.12175424515964516},
- {0.026689316041962428},
- {0.2168083501517472},
- {0.03989069732382026},
- {0.020095511135177418},
- {0.2730161319203184},
- {0.2908130497176898},
- {0.3628755662420275},
- {0.15540640426900523},
- {0.24205154457471792},
- {0.24776653795145218},
- {0.20805898687957536},
- {0.3122985238748195},
- {0.004177943325369311},
- {0.11856358162937908},
- {0.1607026063721584},
- {0.11622605506174759},
- {0.07058043120473023},
- {0.32188916457051275},
- {0.06553860904736376},
- {0.2726768790935194},
- {0.32689550713626425},
- {0.16981717964374277},
- {0.26508515186686926},
- {0.03909797544631648},
- {0.1410045501030181},
- {0.31245616185247543},
- {0.12955310162243608},
- {0.009726894891788846},
- {0.16396300498046326},
- {0.24712918684016474},
- {0.36139358986311715},
- {0.34309203393184934},
- {0.36392247274366685},
- {0.29970422212687026},
- {0.2779635876078463},
- {0.21816490654751527},
- {0.23437709538419993},
- {0.16693422132928715},
- {0.1044025770814215},
- {0.3255639309644086},
- {0.33049497967466696},
- {0.14683118689218427},
- {0.05119383712252147},
- {0.16854093184546473},
- {0.17653896208473951},
- {0.13782106594322796},
- {0.26628339245780125},
- {0.272876467185648},
- {0.23321644443094908},
- {0.20137491659216453},
- {0.09549065105707516},
- {0.311992489301639},
- {0.13502600903267337},
- {0.28423122990035327},
- {0.14906459608772446},
- {0.2684769014103875},
- {0.24052254537274703},
- {0.11950632432430813},
- {0.3045766147478316},
- {0.2288306840474358},
- {0.09574684669994597},
- {0.21782205793835635},
- {0.33229654683582666},
- {0.07365480767090679},
- {0.035241550722178605},
- {0.05265785918325381},
- {0.3058792479413956},
- {0.32805752311595043},
- {0.15520355787391907},
- {0.30710565434616327},
- {0.01870359822068741},
- {0.22588652379507806},
- {0.07569398474330419},
- {0.31782539474231253},
- {0.11499765754370284},
- {0.020859324518534554},
- {0.3452485384634324},
- {0.01559796627381595},
- {0.19639519208811296},
- {0.3502701579252906},
- {0.010898042649617367},
- {0.20700261954528598},
- {0.2421128613044079},
- {0.20013059442222542},
- {0.2970327130555456},
- {0.13221017513692912},
- {0.037639379376742534},
- {0.10758547144014696},
- {0.32978142736253935},
- {0.04980652881003853},
- {0.16988823482303828},
- {0.20666375881679105},
- {0.012627927950589249},
- {0.0621007009180328},
- {0.3457927946757785},
- {0.3071637852187573},
- {0.06493758437317451},
- {0.2958583177678404},
- {0.2298689134014632},
- {0.22248635822308524},
- {0.10921155482842715},
- {0.3312104990364562},
- {0.03217964842372047},
- {0.32773159296332577},
- {0.35449908375402006},
- {0.25857872452404884},
- {0.14639307899847143},
- {0.29248934076531663},
- {0.07083661301208832},
- {0.32906998815424876},
- {0.20352103353775666},
- {0.1648751830995282},
- {0.24413774215083447},
- {0.20223237816702436},
- {0.3511380996987594},
- {0.31087189443467306},
- {0.20617772316976749},
- {0.18037541268664709},
- {0.10227798136279793},
- {0.11136408203720459},
- {0.03212181696234313},
- {0.019256777263483113},
- {0.13588439635985694},
- {0.12563267575067386},
- {0.030226240295124177},
- {0.05596780988350961},
- {0.11012289360441697},
- {0.245594776938315},
- {0.1439008351603465},
- {0.060971197907181265},
- {0.3375381127436754},
- {0.18398307253949012},
- {0.34955742832175535},
- {0.22500078522048336},
- {0.29935685463810846},
- {0.010683911922235289},
- {0.05506260897256755},
- {0.28113961694671097},
- {0.3537869571889246},
- {0.17827508907979514},
- {0.18211779613059018},
- {0.2604946364094787},
- {0.23714640539325757},
- {0.008784232686409217},
- {0.26519853892965217},
- {0.19813427592710003},
- {0.30183401303427154},
- {0.09551430748831855},
- {0.22247158855332236},
- {0.28829066812296417},
- {0.24025212024420317},
- {0.09985151852213738},
- {0.29885794536491855},
- {0.07255902241584594},
- {0.02364999383386251},
- {0.012715297435858454},
- {0.1980178952308725},
- {0.2606829521852027},
- {0.1613881022172895},
- {0.11086409814318797},
- {0.24673891428290093},
- {0.2864800227767822},
- {0.2636867060503887},
- {0.25161353653900814},
- {0.1193396078055264},
- {0.15884872860372837},
- {0.03153824414153131},
- {0.0960147382825337},
- {0.1447180883747427},
- {0.11422940022615519},
- {0.21962687613432427},
- {0.2087415217507663},
- {0.0460673316036224},
- {0.26301352549432994},
- {0.23495866280705485},
- {0.0413525010942894},
- {0.1443722129187604},
- {0.19663109903193904},
- {0.09776898049519502},
- {0.15589651498465637},
- {0.3118967535123882},
- {0.3404274210020773},
- {0.28817468587757566},
- {0.2612510794298776},
- {0.12012774921181639},
- {0.08379574384838803},
- {0.0389192920439324},
- {0.11215280662554257},
- {0.10256385057993943},
- {0.1155811308894702},
- {0.29776560780233496},
- {0.35670186346804716},
- {0.3525548843492682},
- {0.34209336110808736},
- {0.0449056044896285},
- {0.23834104300982364},
- {0.3074656574238449},
- {0.2839612583134852},
- {0.09709572570435064},
- {0.278887450651901},
- {0.3672299164984856},
- {0.09476003702871572},
- {0.11874985045216212},
- {0.29990876196247623},
- {0.14755122968975204},
- {0.10608760516931072},
- {0.18321622669128057},
- {0.10323747049830125},
- {0.3062047811020079},
- {0.10347355123295424},
- {0.36648778329035764},
- {0.3067162548997382},
- {0.12387676385117333},
- {0.10854784549030451},
- {0.3147738561348131},
- {0.1851927721555346},
- {0.1335193305092336},
- {0.2705683786912448},
- {0.10368436752075755},
- {0.14988094372495933},
- {0.0750698805354694},
- {0.35156541169527594},
- {0.0351612850662478},
- {0.2846321964230951},
- {0.3400283991754397},
- {0.1036843751467116},
- {0.2739581233878787},
- {0.20155715759030987},
- {0.06985684718994757},
- {0.30675059479184646},
- {0.1315061930269123},
- {0.24654318107155643},
- {0.1367557539121181},
- {0.10418731984813343},
- {0.3125637684202595},
- {0.18336581025075174},
- {0.042808369214077546},
- {0.3438037431939585},
- {0.07494028554660669},
- {0.3314008447818127},
- {0.021750948730395396},
- {0.10872601569212616},
- {0.1973873531678563},
- {0.32472687658583504},
- {0.10550496723357934},
- {0.08875260335319793},
- {0.2243836673269617},
- {0.15609539193184996},
- {0.1414986780203925},
- {0.057300427134215015},
- {0.08118491829605747},
- {0.24948925298042318},
- {0.015703205755351446},
- {0.08015026829670009},
- {0.32476033986769415},
- {0.11967810965687671},
- {0.02623421374547436},
- {0.2131113660140977},
- {0.039210487012996335},
- {0.019752845431330168},
- {0.26836070094487213},
- {0.28585414831432926},
- {0.35668786539287484},
- {0.1527564370926048},
- {0.23792411719399217},
- {0.24354165934319866},
- {0.2045111955991618},
- {0.30697325532234687},
- {0.004106701649524824},
- {0.11654185285242037},
- {0.15796232913550692},
- {0.11424418544443758},
- {0.06937690406008973},
- {0.31640035782176196},
- {0.0644210543135072},
- {0.2680272330074395},
- {0.32132133296951376},
- {0.16692148204259466},
- {0.26056495879823377},
- {0.03843128251249694},
- {0.1386001612282243},
- {0.3071282052803649},
- {0.12734398116491583},
- {0.009561033308974539},
- {0.16116713190569537},
- {0.24291517624943404},
- {0.35523115945747535},
- {0.33724167896944973},
- {0.35771692019863877},
- {0.29459370975770127},
- {0.27322379334479735},
- {0.21444479060948324},
- {0.23038053158369465},
- {0.16408768350981068},
- {0.10262231967376358},
- {0.3200124626389321},
- {0.32485942783095406},
- {0.14432744306279433},
- {0.050320887332280885},
- {0.1656669966342921},
- {0.1735286456368371},
- {0.1354709613726732},
- {0.26174276716663064},
- {0.2682234177527406},
- {0.22923967187999902},
- {0.19794110109640226},
- {0.09386235850282279},
- {0.3066724392057518},
- {0.13272356536196364},
- {0.2793845607216489},
- {0.1465227684928199},
- {0.2638988727267838},
- {0.2364211902618034},
- {0.11746852003740436},
- {0.2993830190554443},
- {0.2249286968382774},
- {0.0941141855352265},
- {0.21410778820444323},
- {0.32663027493353175},
- {0.07239885671039083},
- {0.03464061697624643},
- {0.051759945103898405},
- {0.30066343993914835},
- {0.32246353442341447},
- {0.15255704960444955},
- {0.30186893384206104},
- {0.01838466721138609},
- {0.22203473997404582},
- {0.07440326203490473},
- {0.3124058827997046},
- {0.11303673438041897},
- {0.020503634381078453},
- {0.33936141110255064},
- {0.015331992044255472},
- {0.19304629012307242},
- {0.3442974026470209},
- {0.010712210827278128},
- {0.2034728412854764},
- {0.23798438835981492},
- {0.19671799692531405},
- {0.2919677548666163},
- {0.12995574665216372},
- {0.036997558208833665},
- {0.10575093978545108},
- {0.324158042908032},
- {0.04895723519734688},
- {0.16699132559941082},
- {0.20313975876034515},
- {0.01241259837821792},
- {0.06104176888856902},
- {0.339896386737915},
- {0.30192607347555506},
- {0.06383027822377173},
- {0.2908133851948384},
- {0.22594922245787577},
- {0.21869255352590244},
- {0.1073492954386659},
- {0.32556274626169585},
- {0.03163092578598827},
- {0.3221431619838732},
- {0.34845421745374794},
- {0.2541694780986692},
- {0.14389680572052702},
- {0.28750185549325913},
- {0.06962871749290185},
- {0.3234587350566108},
- {0.20005062277110264},
- {0.16206375569747294},
- {0.23997474123550314},
- {0.19878394136244862},
- {0.34515054440486914},
- {0.30557095255784206},
- {0.20266201092177602},
- {0.17729967764665538},
- {0.10053395224923092},
- {0.10946511806968544},
- {0.0315740804581949},
- {0.01892841352640602},
- {0.13356731559454113},
- {0.12349040581920849},
- {0.029710826885845226},
- {0.05501345501104507},
- {0.1082450941997232},
- {0.2414069308798259},
- {0.14144705925821927},
- {0.05993152599713458},
- {0.3317824624295057},
- {0.18084582021365284},
- {0.34359682640398526},
- {0.22116410488351018},
- {0.2942522655283296},
- {0.010501731425603573},
- {0.05412368945306242},
- {0.2763456654979343},
- {0.3477542339662291},
- {0.17523516844941003},
- {0.17901235022406842},
- {0.25605272013607605},
- {0.23310261972528934},
- {0.008634445241044003},
- {0.26067641240147865},
- {0.19475571935990843},
- {0.29668718378341574},
- {0.09388561154807573},
- {0.2186780357063787},
- {0.2833747780000192},
- {0.236155376382826},
- {0.09814886509648202},
- {0.29376186358277634},
- {0.07132175662452846},
- {0.02324671761319065},
- {0.012498478051858887},
- {0.19464132317021668},
- {0.25623782477885604},
- {0.15863613600618612},
- {0.10897365982758198},
- {0.24253155856248568},
- {0.2815950075122966},
- {0.2591903590743842},
- {0.2473230594759636},
- {0.11730464634421024},
- {0.15614006341844958},
- {0.031000458635396737},
- {0.0943775090699012},
- {0.14225037679085809},
- {0.11228157727379318},
- {0.2158818309056612},
- {0.20518209198599355},
- {0.04528179823240663},
- {0.25852865749427717},
- {0.23095218220428726},
- {0.04064736432031036},
- {0.14191039915234208},
- {0.19327817441634712},
- {0.09610183820205033},
- {0.1532381905123299},
- {0.30657833588911576},
- {0.3346225026279246},
- {0.2832607734668412},
- {0.25679626440121256},
- {0.11807934847901812},
- {0.08236687113387678},
- {0.03825564599324173},
- {0.1102403934422067},
- {0.10081494686647591},
- {0.11361025842440653},
- {0.2926881523998456},
- {0.3506194356916797},
- {0.34654317025164305},
- {0.33626003536797355},
- {0.04413988071850289},
- {0.23427688655670995},
- {0.30222279820014647},
- {0.27911919265062124},
- {0.09544006365299833},
- {0.2741319028119403},
- {0.3609679659084137},
- {0.09314420279754776},
- {0.1167249454466002},
- {0.2947947618100774},
- {0.1450352077963522},
- {0.10427861491022865},
- {0.18009205050819732},
- {0.10147708031694455},
- {0.3009834221561267},
- {0.1017091354375905},
- {0.36023848744673137},
- {0.3014861743777936},
- {0.12176443547147485},
- {0.10669690357467806},
- {0.3769599324454899},
- {0.22177907574142564},
- {0.1598971351272944},
- {0.32402131169894566},
- {0.12416803814716632},
- {0.17949111503475432},
- {0.0899005319019308},
- {0.4210199521337092},
- {0.04210767630458077},
- {0.340863548367589},
- {0.4072037111234087},
- {0.12416804727968818},
- {0.3280807273935684},
- {0.24137637554183494},
- {0.08365762239891805},
- {0.36735161207551015},
- {0.157486286339985},
- {0.2952497453976183},
- {0.16377293968837536},
- {0.12477035270301594},
- {0.3743132243427054},
- {0.21959118299625283},
- {0.051265502685613765},
- {0.4117249043497286},
- {0.0897453343933231},
- {0.39687171480920863},
- {0.026048021473942067},
- {0.1302057039731334},
- {0.23638279312460334},
- {0.38887925116819516},
- {0.12634831179880546},
- {0.10628638532818321},
- {0.2687124436446742},
- {0.18693327686172698},
- {0.16945286613907615},
- {0.06862058179431667},
- {0.09722364395906952},
- {0.2987778372200546},
- {0.018805498821921483},
- {0.09598459063154209},
- {0.3889193253872676},
- {0.1433214711203289},
- {0.031416991114468974},
- {0.2552132096435425},
- {0.04695683026878657},
- {0.02365517699224486},
- {0.3213774896727047},
- {0.34232690656393794},
- {0.4271543872596525},
- {0.18293468496437026},
- {0.2849279169683905},
- {0.2916552492032748},
- {0.24491400723060303},
- {0.367618260962957},
- {0.004918013190128621},
- {0.1395656218650679},
- {0.18916904234368964},
- {0.13681403200455405},
- {0.08308286269037542},
- {0.3789077624640418},
- {0.07714794544972108},
- {0.32097814249466744},
- {0.38480091535177074},
- {0.19989814709239592},
- {0.31204163672403834},
- {0.04602368772805512},
- {0.16598172432449068},
- {0.36780382251633414},
- {0.1525017964538553},
- {0.011449891406218073},
- {0.19300697936484415},
- {0.2909049993966244},
- {0.4254098974924784},
- {0.4038664521988792},
- {0.4283867400186355},
- {0.3527930378105106},
- {0.3272013246158673},
- {0.2568100628624528},
- {0.27589403608332536},
- {0.1965045091435541},
- {0.12289617430951245},
- {0.38323346728777197},
- {0.3890379889649715},
- {0.17284047619151724},
- {0.06026217844867517},
- {0.19839582812418705},
- {0.20781060835180631},
- {0.16223432617446207},
- {0.3134521304938719},
- {0.32121308509518587},
- {0.2745277904804799},
- {0.2370459383562299},
- {0.1124056132071041},
- {0.3672580162323984},
- {0.1589441602524405},
- {0.3345792005383064},
- {0.17546950560317168},
- {0.3160341918387397},
- {0.283128074879263},
- {0.14067535951526658},
- {0.35852851321341234},
- {0.26936514806647466},
- {0.11270719067064731},
- {0.2564064829546493},
- {0.3911586809829042},
- {0.08670182609762575},
- {0.04148414609643864},
- {0.061985533517089006},
- {0.3600618914162583},
- {0.3861687677782351},
- {0.18269590689369944},
- {0.3615055402179262},
- {0.022016704294110036},
- {0.26589946702982065},
- {0.08910221761997168},
- {0.3741241471633319},
- {0.13536803938905312},
- {0.024554290264398954},
- {0.406404954257176},
- {0.01836094889272518},
- {0.23118411858346705},
- {0.4123160901501078},
- {0.01282849318992731},
- {0.24367051777201948},
- {0.28500009518190517},
- {0.23558120023798626},
- {0.3496483046662041},
- {0.155629536964855},
- {0.04430671979656688},
- {0.12664287818267092},
- {0.3881980398776822},
- {0.058629125999606096},
- {0.19998178879880213},
- {0.24327163214754605},
- {0.014864805811960615},
- {0.07310105533902157},
- {0.40704561857994803},
- {0.3615739682400191},
- {0.07644045684945526},
- {0.3482658800937385},
- {0.2705872866307967},
- {0.2618970050935511},
- {0.12855700169489068},
- {0.389880253539913},
- {0.03787986649808598},
- {0.3857851032177478},
- {0.41729411674981726},
- {0.3043826779970729},
- {0.1723247630206621},
- {0.3443001313878996},
- {0.08338442386761966},
- {0.38736057820387204},
- {0.2395722127989421},
- {0.19408073831079908},
- {0.28738365808250643},
- {0.2380552884136092},
- {0.4133377768408448},
- {0.36593892214534735},
- {0.24269950142752883},
- {0.212326637697846},
- {0.1203952333071694},
- {0.13109082189790705},
- {0.03781179092412329},
- {0.022667872013990845},
- {0.15995460004746925},
- {0.14788691668007484},
- {0.03558043680410089},
- {0.06588180015710968},
- {0.12962977261875128},
- {0.28909878817050777},
- {0.16939104968029942},
- {0.07177147514296499},
- {0.397328724055341},
- {0.21657334890477964},
- {0.4114771095038417},
- {0.2648568310595308},
- {0.3523841385606862},
- {0.012576431910090823},
- {0.06481625434352783},
- {0.33093994741764776},
- {0.41645584596263013},
- {0.20985426830515602},
- {0.21437766235094283},
- {0.3066379694622426},
- {0.2791538943656051},
- {0.010340248503275407},
- {0.3121751088721573},
- {0.23323125914828596},
- {0.35530009426367337},
- {0.11243346007620351},
- {0.26187961916342933},
- {0.339357716944234},
- {0.2828097473564732},
- {0.11753895323671855},
- {0.3517968538143072},
- {0.0854119363317177},
- {0.027839291384144135},
- {0.014967651697485096},
- {0.23309426308238726},
- {0.30685964299795015},
- {0.18997596511539452},
- {0.1305022721752015},
- {0.2904455949875904},
- {0.33722633865552043},
- {0.3103954739028796},
- {0.296183694977329},
- {0.1404791112719258},
- {0.18698677355544102},
- {0.037124845552527215},
- {0.11302253586183043},
- {0.17035306897425917},
- {0.13446369499592326},
- {0.2585310018871242},
- {0.24571744452925118},
- {0.05422757725910922},
- {0.30960304791808174},
- {0.276578620826058},
- {0.048677574104848895},
- {0.1699459260519668},
- {0.23146181346131153},
- {0.11508751991466848},
- {0.18351161259992707},
- {0.3671453220578643},
- {0.400729836760457},
- {0.3392211899097053},
- {0.30752840680477733},
- {0.1414068619688499},
- {0.09863910097118969},
- {0.04581335281890355},
- {0.13201925908020945},
- {0.12073174064368991},
- {0.13605486766485764},
- {0.35051102245603133},
- {0.4198870910543635},
- {0.4150055269887379},
- {0.40269087710429596},
- {0.052860064867244254},
- {0.28056014693969344},
- {0.3619293132915757},
- {0.334261406896369},
- {0.11429500654533088},
- {0.3282888383236154},
- {0.43228005563951444},
- {0.11154558013615594},
- {0.13978488585598758},
- {0.35303380929328987},
- {0.17368806547172422},
- {0.1248796838300117},
- {0.2156706660049448},
- {0.12152468381827065},
- {0.36044508866261493},
- {0.12180258327179089},
- {0.431406462911666},
- {0.3610471635802828},
- {0.1458199671764733},
- {0.12777572463460166},
- {0.07920027745875396},
- {0.046596369591102076},
- {0.03359481042132467},
- {0.06807773341485522},
- {0.026088032775702968},
- {0.03771155735282111},
- {0.018888339203934058},
- {0.08845740396953965},
- {0.008846934009222434},
- {0.07161633182378675},
- {0.08555457524088943},
- {0.026088034694469932},
- {0.06893062737429755},
- {0.05071381404087591},
- {0.017576687428158128},
- {0.07718154397087845},
- {0.03308828472341482},
- {0.062032751341548065},
- {0.03440912719664377},
- {0.026214580654760736},
- {0.07864419709569527},
- {0.04613668754653163},
- {0.010771017520145157},
- {0.08650448987941922},
- {0.018855731797457472},
- {0.08338379552571161},
- {0.005472758111463513},
- {0.027356562312828184},
- {0.04966464918562941},
- {0.08170455780450155},
- {0.026546114028597932},
- {0.022331050288209118},
- {0.05645719415114621},
- {0.039275175209407015},
- {0.03560249474614021},
- {0.014417365480287199},
- {0.020426944389435576},
- {0.06277401275207561},
- {0.003951084972835478},
- {0.02016661601265098},
- {0.08171297750377539},
- {0.030112219632701307},
- {0.006600792813822355},
- {0.05362096943242261},
- {0.009865754065014045},
- {0.00497001516571696},
- {0.06752225942410123},
- {0.07192378724595988},
- {0.08974626499218345},
- {0.038435060490422196},
- {0.05986410792585903},
- {0.061277538197091114},
- {0.051457079802517104},
- {0.07723756760642204},
- {0.0010332875610336199},
- {0.029323105783969017},
- {0.03974491544242171},
- {0.028744989486590638},
- {0.017455928895299275},
- {0.07960952169039151},
- {0.01620898710733475},
- {0.06743835552721295},
- {0.08084768867749559},
- {0.04199912868855881},
- {0.06556077206110299},
- {0.009669698352527454},
- {0.034873198682682315},
- {0.07727655457890426},
- {0.03204103023296865},
- {0.0024056524266705885},
- {0.040551276147583956},
- {0.061119908731103546},
- {0.08937974308443633},
- {0.0848534083262528},
- {0.09000518556181888},
- {0.07412274906471539},
- {0.0687458625279647},
- {0.05395647251143191},
- {0.05796606569101234},
- {0.04128611639200208},
- {0.02582081082407948},
- {0.08051836369920007},
- {0.0817379090348732},
- {0.03631424056574187},
- {0.012661242860590182},
- {0.04168348750531211},
- {0.043661557698086405},
- {0.03408586043348097},
- {0.06585712052763613},
- {0.06748771758812809},
- {0.057679013881234635},
- {0.049803977750338},
- {0.02361671622808711},
- {0.07716187923702904},
- {0.03339458788305646},
- {0.07029597374621184},
- {0.03686660658909997},
- {0.06639961843610714},
- {0.059485956349069224},
- {0.029556264595389566},
- {0.07532778759578888},
- {0.05659432907413336},
- {0.023680078449724244},
- {0.05387167930683996},
- {0.08218347202915541},
- {0.01821628266581241},
- {0.008715928665581801},
- {0.013023324312305379},
- {0.07564995440626858},
- {0.08113507808515968},
- {0.03838489258709754},
- {0.07595326883256143},
- {0.004625767724194416},
- {0.05586618033454222},
- {0.018720611264733008},
- {0.07860447148090552},
- {0.02844118261882083},
- {0.005158921238995052},
- {0.08538675431356352},
- {0.003857683858536127},
- {0.04857239393344743},
- {0.08662869957755864},
- {0.0026953003026837594},
- {0.05119581938288061},
- {0.05987927275916042},
- {0.04949623240293006},
- {0.07346203232501566},
- {0.032698176775528526},
- {0.009308958855150463},
- {0.02660800320387663},
- {0.08156143351310363},
- {0.012318134227712678},
- {0.04201670203199486},
- {0.05111201245961517},
- {0.0031231349630189715},
- {0.01535872480615812},
- {0.08552135957994367},
- {0.07596764574073984},
- {0.01606034188375237},
- {0.07317158127098777},
- {0.056851103614492075},
- {0.05502525251016002},
- {0.02701016560950591},
- {0.08191487104671433},
- {0.007958660002101936},
- {0.08105446914764063},
- {0.08767459611445665},
- {0.06395160460321005},
- {0.03620588786640885},
- {0.0723383669932885},
- {0.017519287695141977},
- {0.08138548060347595},
- {0.050334754683318},
- {0.04077687573821352},
- {0.06038006562020357},
- {0.05001604486335673},
- {0.08684335864983016},
- {0.07688473408525949},
- {0.050991806284189374},
- {0.04461038739173014},
- {0.02529535651383343},
- {0.02754252792665619},
- {0.007944357144206583},
- {0.004762579782049403},
- {0.03360688395283363},
- {0.031071431803366162},
- {0.007475543749987126},
- {0.013841940224455531},
- {0.027235557614083826},
- {0.060740418981809735},
- {0.035589506944877426},
- {0.01507937649518989},
- {0.08347981437540762},
- {0.045502632633006496},
- {0.08645242752780596},
- {0.05564711976330399},
- {0.07403683825231505},
- {0.0026423415620288886},
- {0.013618066234630632},
- {0.06953135705332107},
- {0.0874984732079714},
- {0.04409093605213746},
- {0.04504131308865021},
- {0.06442544729686986},
- {0.05865097052627652},
- {0.00217251352189878},
- {0.0655888149119584},
- {0.04900250357316139},
- {0.07464948824733121},
- {0.023622566928835922},
- {0.05502159968032055},
- {0.07129995266443652},
- {0.059419074895742996},
- {0.02469524452683245},
- {0.0739134481759248},
- {0.01794527341905142},
- {0.005849108650819671},
- {0.0031447431552111427},
- {0.04897372033787284},
- {0.06447202149222109},
- {0.03991445204805566},
- {0.027418872075398597},
- {0.061023386651355656},
- {0.07085214445643795},
- {0.06521490890442144},
- {0.0622289766150558},
- {0.029515032321119596},
- {0.0392864150060554},
- {0.007800028107227878},
- {0.023746333307302768},
- {0.03579162973948851},
- {0.028251177473208936},
- {0.0543180463459754},
- {0.05162588410105578},
- {0.011393357211667367},
- {0.06504841811200655},
- {0.05810989875363179},
- {0.010227286889915229},
- {0.03570608793614158},
- {0.048630738360748965},
- {0.024180191910978973},
- {0.0385562745104728},
- {0.07713820189330398},
- {0.08419439713800038},
- {0.07127126797387764},
- {0.06461253053441948},
- {0.02970995519298096},
- {0.020724335646282396},
- {0.009625506432563985},
- {0.027737595030908727},
- {0.025366057594042223},
- {0.02858548705366445},
- {0.07364329161132668},
- {0.08821938686458015},
- {0.0871937573608765},
- {0.08460641689387276},
- {0.011106039246170726},
- {0.058946427906381466},
- {0.07604230467463316},
- {0.07022920446266283},
- {0.024013682758841467},
- {0.06897435203037701},
- {0.09082318145705291},
- {0.023436021008303644},
- {0.029369173727596058},
- {0.07417333578918917},
- {0.036492321312223235},
- {0.026237551413315283},
- {0.04531297657152434},
- {0.025532657049396543},
- {0.07573046515985447},
- {0.025591044458587894},
- {0.09063963731754002},
- {0.07585696269029732},
- {0.030637160253293272},
- {0.02684601723557761},
- {0.8415025727442323},
- {0.4950862061294401},
- {0.35694470155261787},
- {0.7233255949769997},
- {0.2771852246353897},
- {0.4006851181944068},
- {0.2006885145478671},
- {0.939859498060584},
- {0.0939986319307555},
- {0.7609231863058342},
- {0.9090169565724288},
- {0.2771852450222796},
- {0.7323875892550185},
- {0.5388340338996214},
- {0.1867522206449221},
- {0.8200535390004192},
- {0.3515628684122707},
- {0.6590976890895502},
- {0.36559681343210815},
- {0.278529795250788},
- {0.8355942215214714},
- {0.4902020865838765},
- {0.1144420101179018},
- {0.919109795106063},
- {0.20034206100854896},
- {0.8859524323839315},
- {0.05814802900408763},
- {0.29066334495698626},
- {0.527686662283625},
- {0.86811053955239},
- {0.2820523357769859},
- {0.23726730350654568},
- {0.5998574203588101},
- {0.41729855051212933},
- {0.37827633799127036},
- {0.15318443991782496},
- {0.21703618735382946},
- {0.6669735880642704},
- {0.04198025911593112},
- {0.2142701995839425},
- {0.8681999988172817},
- {0.3199421909241907},
- {0.07013339237196331},
- {0.5697225461605518},
- {0.10482359019631902},
- {0.05280638758755269},
- {0.7174236864571031},
- {0.7641898987096839},
- {0.9535536403194841},
- {0.40837233560342284},
- {0.6360558630729993},
- {0.6510735530079342},
- {0.5467312290954274},
- {0.820648789862627},
- {0.010978675440212077},
- {0.31155786002027247},
- {0.4222895382622568},
- {0.30541537709977223},
- {0.18546916180545697},
- {0.8458507907663609},
- {0.17222041121640888},
- {0.7165322079502061},
- {0.8590063091378423},
- {0.4462405433218841},
- {0.6965828925188758},
- {0.10274049918007115},
- {0.37052757077247284},
- {0.8210630262605282},
- {0.34043579441322636},
- {0.02556004563526885},
- {0.43085711693402684},
- {0.649398740678673},
- {0.9496593467862707},
- {0.9015670614265797},
- {0.9563046701450814},
- {0.7875538576151658},
- {0.7304244636381576},
- {0.5732872647853947},
- {0.615889173320776},
- {0.43866479104925815},
- {0.2743459926655016},
- {0.8555072328038112},
- {0.8684648962170691},
- {0.38583863395224927},
- {0.13452564540414436},
- {0.4428868572454122},
- {0.46390384367143983},
- {0.3621621056051581},
- {0.6997315935716761},
- {0.7170566796135496},
- {0.6128392492019543},
- {0.5291670276235078},
- {0.25092749802619735},
- {0.8198446012964417},
- {0.35481733803218285},
- {0.7468943879875258},
- {0.39170752033329026},
- {0.7054956312787973},
- {0.6320380043613094},
- {0.31403517128689723},
- {0.8003573862982866},
- {0.6013144782657961},
- {0.2516007213308784},
- {0.5723863373883599},
- {0.873199000920217},
- {0.19354791701456336},
- {0.0926067007752839},
- {0.1383727591130576},
- {0.8037804071331902},
- {0.8620598202326074},
- {0.4078393018682965},
- {0.8070031214754323},
- {0.049148760152437916},
- {0.5935779013576469},
- {0.19890640598855966},
- {0.8351721370525523},
- {0.3021874305691708},
- {0.05481351372108564},
- {0.9072338600147353},
- {0.04098787271903985},
- {0.5160814554043535},
- {0.9204295225602822},
- {0.02863755294554211},
- {0.543955338374655},
- {0.6362169893549748},
- {0.5258972347654118},
- {0.7805337453863666},
- {0.3474179733143306},
- {0.09890764372964309},
- {0.2827099079710879},
- {0.8665898446344176},
- {0.1308801178054874},
- {0.4464272600126287},
- {0.5430648902120413},
- {0.033183294184500896},
- {0.16318637829499413},
- {0.9086640403322576},
- {0.8071558760567095},
- {0.17064105642013486},
- {0.7774477043134923},
- {0.6040427065404964},
- {0.5846430472079457},
- {0.2869828816254327},
- {0.8703451167544258},
- {0.08456072481378858},
- {0.8612033506533967},
- {0.9315421683093115},
- {0.6794854959030823},
- {0.38468738703521665},
- {0.7685948065607501},
- {0.1861423487535884},
- {0.8647203458032976},
- {0.5348065300215716},
- {0.43325411151556337},
- {0.6415379111307757},
- {0.5314202396945468},
- {0.9227102741861013},
- {0.8168999353720184},
- {0.5417877001676853},
- {0.47398515467080016},
- {0.2687630431087671},
- {0.2926392287227941},
- {0.08440875701641816},
- {0.050602387618924514},
- {0.3570729827676955},
- {0.33013381569270767},
- {0.07942761692409862},
- {0.14707054930100824},
- {0.289377670606154},
- {0.6453666638904684},
- {0.37813834266439017},
- {0.16021830381452348},
- {0.8869726322070093},
- {0.4834652561318571},
- {0.9185566328668462},
- {0.591250383826161},
- {0.7866410556404622},
- {0.02807486657700537},
- {0.1446918892198453},
- {0.738770339248355},
- {0.9296708632623851},
- {0.46846598664881534},
- {0.4785637381588275},
- {0.6845200722781266},
- {0.6231662839503432},
- {0.023082945876692625},
- {0.6968808476763462},
- {0.5206513682884325},
- {0.7931504589347413},
- {0.25098966169393255},
- {0.5846042359082085},
- {0.7575616592367588},
- {0.6313273892366061},
- {0.2623868560902435},
- {0.7853300366634444},
- {0.19066844505178376},
- {0.06214675170157841},
- {0.03341288112416198},
- {0.5203455465498681},
- {0.6850149228830624},
- {0.42409086389384437},
- {0.29132538588907},
- {0.6483731940386782},
- {0.7528036991485125},
- {0.6929080981178519},
- {0.6611825816908444},
- {0.3135970785681395},
- {0.4174179732982637},
- {0.08287526168235788},
- {0.25230467887873126},
- {0.3802858963994646},
- {0.30016862679729867},
- {0.5771289850642637},
- {0.5485247739675971},
- {0.12105436639164752},
- {0.6911391342372858},
- {0.6174173989296191},
- {0.1086648747479328},
- {0.37937701514420497},
- {0.5167013646679934},
- {0.25691442448714635},
- {0.4096602339921422},
- {0.8195930296315475},
- {0.8945650706738272},
- {0.7572568845354803},
- {0.6865078307906812},
- {0.3156681331581118},
- {0.22019596804877167},
- {0.1022709602398429},
- {0.29471181578123923},
- {0.26951424175100014},
- {0.3037206645056623},
- {0.7824596244446052},
- {0.9373305674481268},
- {0.9264332588307614},
- {0.8989427786278},
- {0.11800161436957314},
- {0.6263055172140659},
- {0.807949126875588},
- {0.7461849646661739},
- {0.25514526553461436},
- {0.7328521635186931},
- {0.964995872656236},
- {0.24900761217214137},
- {0.3120473317030375},
- {0.7880913413230172},
- {0.387730741039858},
- {0.27877385945159344},
- {0.4814501613772095},
- {0.2712843601747829},
- {0.8046358335085763},
- {0.27190472612079847},
- {0.9630457170435531},
- {0.8059798691701796},
- {0.32551968253078434},
- {0.28523880593018797},
- {0.8616488607340793},
- {0.5069389913870747},
- {0.3654902615863537},
- {0.7406426255112167},
- {0.2838212748899054},
- {0.41027786104017805},
- {0.2054931684387647},
- {0.9623605345769353},
- {0.09624903920325258},
- {0.7791403351845086},
- {0.9307795963883007},
- {0.28382129576487475},
- {0.74992157164702},
- {0.5517341793980145},
- {0.19122322779536557},
- {0.8396863188621834},
- {0.3599795827788981},
- {0.6748770488775285},
- {0.3743495123900616},
- {0.28519803567051283},
- {0.855599058553075},
- {0.5019379418615814},
- {0.11718184926830805},
- {0.94111406606879},
- {0.20513842050676817},
- {0.9071628878551556},
- {0.05954014232174278},
- {0.2976220728863606},
- {0.5403199302154132},
- {0.8888938449198468},
- {0.2888049088157605},
- {0.24294768474581985},
- {0.6142185176802183},
- {0.427289033071139},
- {0.3873325955616594},
- {0.15685180582032457},
- {0.22223221844900423},
- {0.682941503578711},
- {0.04298530225831852},
- {0.21940001057713138},
- {0.8889854459156995},
- {0.3276018793520482},
- {0.07181244549217279},
- {0.5833621889388609},
- {0.10733315618533068},
- {0.05407061746218394},
- {0.7345994202768682},
- {0.7824852554643644},
- {0.9763825262597795},
- {0.4181491169783427},
- {0.6512835819298899},
- {0.6666608081469122},
- {0.5598204401699456},
- {0.8402958205367886},
- {0.011241514276752148},
- {0.3190168204284382},
- {0.43239950931699384},
- {0.31272728123752686},
- {0.18990945143497417},
- {0.8661011787974362},
- {0.17634351447773447},
- {0.7336865990155716},
- {0.879571651478449},
- {0.45692392182801367},
- {0.713259679989318},
- {0.1052001941967511},
- {0.3793983162588678},
- {0.8407199741067084},
- {0.3485861171554787},
- {0.026171974887870517},
- {0.4411722031160228},
- {0.6649458993846665},
- {0.972395000024043},
- {0.9231513444103234},
- {0.9791994180814423},
- {0.8064085674365373},
- {0.7479114471316191},
- {0.5870122499623427},
- {0.6306340844564433},
- {0.44916679959649813},
- {0.2809140692895282},
- {0.8759888042781044},
- {0.8892566851847535},
- {0.39507593932597124},
- {0.13774630388115136},
- {0.4534899456517696},
- {0.47501009662527643},
- {0.3708325747336565},
- {0.7164837636259134},
- {0.7342236269770352},
- {0.6275111425577179},
- {0.5418357367618156},
- {0.2569349159516373},
- {0.8394723790116971},
- {0.36331196717214614},
- {0.7647756754912904},
- {0.40108533184334705},
- {0.7223857973028548},
- {0.6471695322601092},
- {0.32155344063580116},
- {0.8195186234963899},
- {0.615710458793938},
- {0.25762425679536916},
- {0.5860897535964342},
- {0.8941041283847911},
- {0.1981816189214921},
- {0.09482378403092298},
- {0.1416855207674283},
- {0.8230235943642095},
- {0.8826982662283755},
- {0.41760332196180855},
- {0.8263234632314057},
- {0.05032542331241601},
- {0.6077886616482095},
- {0.20366839468338077},
- {0.8551668690226358},
- {0.30942205491892755},
- {0.05612579590408504},
- {0.9289538109810083},
- {0.04196915728623505},
- {0.5284368848035641},
- {0.9424653889217899},
- {0.0293231603431332},
- {0.5569780922621126},
- {0.651448565712228},
- {0.5384876622790166},
- {0.799220387744532},
- {0.35573545536363005},
- {0.10127557692380601},
- {0.2894782238480018},
- {0.8873367432709213},
- {0.13401349924822703},
- {0.45711510867529265},
- {0.5560663260124186},
- {0.03397773049728916},
- {0.16709319911721673},
- {0.9304182310328909},
- {0.8264798748874036},
- {0.17472634858308186},
- {0.7960604642211266},
- {0.6185040031761636},
- {0.5986398994836344},
- {0.2938534961293522},
- {0.8911819198024672},
- {0.08658518055510997},
- {0.8818212920382983},
- {0.9538440808706056},
- {0.6957529571429758},
- {0.39389713057765113},
- {0.7869956205594256},
- {0.19059875505174967},
- {0.8854224870462194},
- {0.5476102536483799},
- {0.4436265837884803},
- {0.6568968748852143},
- {0.5441428926480676},
- {0.9448007436832087},
- {0.8364572152781538},
- {0.5547585589510875},
- {0.4853327627925075},
- {0.27519745916745997},
- {0.2996452609916556},
- {0.0864295745192954},
- {0.05181385185797037},
- {0.36562161396293025},
- {0.33803750029398316},
- {0.0813291816925601},
- {0.1505915434571885},
- {0.2963056183970333},
- {0.6608172912455149},
- {0.3871912965091738},
- {0.16405406640686584},
- {0.908207512130527},
- {0.49503982595325907},
- {0.9405476606546413},
- {0.6054054213655291},
- {0.8054739122054614},
- {0.02874700278390059},
- {0.14815593622865228},
- {0.7564571301090384},
- {0.9519279751877532},
- {0.4796814611894301},
- {0.4900209614671344},
- {0.7009080655625364},
- {0.638085415309722},
- {0.023635571252238856},
- {0.7135647684469171},
- {0.5331162052926026},
- {0.8121391561562711},
- {0.2569985678705},
- {0.5986001590083402},
- {0.775698330295623},
- {0.6464419044043508},
- {0.2686686208034587},
- {0.8041315063180209},
- {0.19523320994853596},
- {0.06363459784485342},
- {0.03421281394374052},
- {0.532803061921261},
- {0.7014147633122366},
- {0.4342439602177283},
- {0.2982999636419753},
- {0.6638958002850293},
- {0.7708264605922588},
- {0.7094969078818624},
- {0.6770118555826342},
- {0.32110485960439383},
- {0.42741131494044193},
- {0.08485936600142355},
- {0.25834506768621945},
- {0.38939026450894787},
- {0.3073549192660839},
- {0.5909459442952685},
- {0.561656924033258},
- {0.12395251098055994},
- {0.7076855935000192},
- {0.63219889708739},
- {0.11126640435931984},
- {0.38845962386267735},
- {0.5290716352227244},
- {0.26306517452892547},
- {0.4194678487509175},
- {0.8392147845069743},
- {0.9159817200379289},
- {0.7753862590285313},
- {0.7029434127061246},
- {0.32322549700440584},
- {0.22546764698380686},
- {0.1047194140945601},
- {0.3017674675487403},
- {0.2759666421447078},
- {0.31099199578115033},
- {0.801192373986988},
- {0.9597710592126554},
- {0.9486128597497591},
- {0.9204642340472042},
- {0.1208266734761706},
- {0.6412998044903089},
- {0.8272921168062062},
- {0.7640492679716703},
- {0.26125366040492765},
- {0.750397268214074},
- {0.9880986953798155},
- {0.25496906639577427},
- {0.3195180104799917},
- {0.8069589189619318},
- {0.39701334506806923},
- {0.28544794297606524},
- {0.4929764881146698},
- {0.27777913871051496},
- {0.8238995003752744},
- {0.2784143567454157},
- {0.9861018513815346},
- {0.8252757133948375},
- {0.3333129008560027},
- {0.2920676657771753},
- {0.8299931363780255},
- {0.4883147910799872},
- {0.3520626816255995},
- {0.7134324940203531},
- {0.2733940945688587},
- {0.39520484989801224},
- {0.1979436486824132},
- {0.9270048099865746},
- {0.09271298966683533},
- {0.7505158539030368},
- {0.8965841094768401},
- {0.27339411467691216},
- {0.7223705451877125},
- {0.531464269116978},
- {0.18419796487746665},
- {0.8088374663112669},
- {0.34675445713253233},
- {0.6500830489002137},
- {0.3605964564561779},
- {0.2747202751633124},
- {0.8241655951190485},
- {0.4834974728312174},
- {0.11287675877377651},
- {0.9065389057909736},
- {0.19760193367283196},
- {0.873835044423065},
- {0.05735272419894556},
- {0.2866878713445151},
- {0.5204693628271972},
- {0.856237179520669},
- {0.2781946370417594},
- {0.23402214060397175},
- {0.5916530238043207},
- {0.4115910562412954},
- {0.37310256005883424},
- {0.15108929889196013},
- {0.214067730371735},
- {0.6578512272796414},
- {0.04140608485125119},
- {0.2113395736926353},
- {0.8563254152293293},
- {0.3155662633791349},
- {0.06917416082259445},
- {0.5619303116459924},
- {0.10338989233238084},
- {0.05208414171766047},
- {0.7076113073458187},
- {0.7537378866828942},
- {0.9405116541146982},
- {0.40278692735562716},
- {0.6273563715699394},
- {0.6421686608890331},
- {0.5392534524438704},
- {0.8094245757819418},
- {0.010828517412825076},
- {0.30729660701827505},
- {0.4165137810320747},
- {0.3012381363380149},
- {0.18293245474735217},
- {0.8342818827594805},
- {0.16986491055835004},
- {0.7067320218083544},
- {0.8472574698907432},
- {0.4401372023414331},
- {0.6870555580401598},
- {0.10133529226110814},
- {0.3654597746232302},
- {0.8098331465673818},
- {0.3357795708442355},
- {0.025210454643767644},
- {0.4249641788362763},
- {0.6405167553773543},
- {0.936670623785976},
- {0.889236108367793},
- {0.9432250574329684},
- {0.7767822910118424},
- {0.7204342697197376},
- {0.5654462747429201},
- {0.607465506562569},
- {0.43266506548429373},
- {0.27059369546858364},
- {0.8438062512789717},
- {0.856586689562634},
- {0.3805614246495899},
- {0.13268570527139742},
- {0.43682938544913197},
- {0.4575589174148708},
- {0.3572087259676831},
- {0.6901611935390602},
- {0.7072493201445677},
- {0.6044572970013782},
- {0.5219294808484978},
- {0.24749550130437412},
- {0.8086313862993347},
- {0.34996441457600047},
- {0.7366789308882256},
- {0.3863500408371331},
- {0.6958463950936238},
- {0.6233934660938882},
- {0.3097400354932055},
- {0.789410702703745},
- {0.593090153174181},
- {0.24815951676936882},
- {0.5645576695500978},
- {0.8612560447586541},
- {0.19090071484686652},
- {0.09134009629399083},
- {0.13648020106580816},
- {0.7927869060460401},
- {0.8502692173679307},
- {0.40226118405317945},
- {0.7959655425365323},
- {0.04847654054696752},
- {0.5854593913193669},
- {0.19618591445745168},
- {0.823749283602576},
- {0.2980543392210822},
- {0.05406381589648636},
- {0.894825400766588},
- {0.040427271565667784},
- {0.5090228831989406},
- {0.9078405830102356},
- {0.028245870134358624},
- {0.5365155282589651},
- {0.6275152940883741},
- {0.5187044097465198},
- {0.7698581945738415},
- {0.3426662527779357},
- {0.09755485971149631},
- {0.27884321546023993},
- {0.8547372835187756},
- {0.12909003844474162},
- {0.4403213652623614},
- {0.5356372589735134},
- {0.03272943815932898},
- {0.16095443831328612},
- {0.8962360201583451},
- {0.7961162078560653},
- {0.16830715698364818},
- {0.7668143620390065},
- {0.5957810668039387},
- {0.5766467413537147},
- {0.28305774660952043},
- {0.8584411938641406},
- {0.08340416711230614},
- {0.8494244619324919},
- {0.9188012383872195},
- {0.6701920066968002},
- {0.3794259236180276},
- {0.7580825475326404},
- {0.18359643435305467},
- {0.8528933542801088},
- {0.5274918503938647},
- {0.4273283891370514},
- {0.6327634403165158},
- {0.5241518751873144},
- {0.9100901402386106},
- {0.8057269952904906},
- {0.534377537369563},
- {0.46750234385963413},
- {0.26508710527751267},
- {0.28863673046511545},
- {0.08325427781564408},
- {0.04991028639530156},
- {0.3521892083071442},
- {0.32561849480467137},
- {0.07834126599384993},
- {0.1450590294514575},
- {0.28541978147602176},
- {0.636539826288896},
- {0.3729664521277684},
- {0.15802695891293714},
- {0.8748412907238069},
- {0.4768527836558962},
- {0.9059933092869056},
- {0.5831637078140475},
- {0.7758819736528524},
- {0.02769087976481531},
- {0.14271290288561309},
- {0.7286659967493281},
- {0.9169555276368014},
- {0.46205866284767266},
- {0.4720183049422053},
- {0.6751577239402196},
- {0.6146430863713953},
- {0.02276723478403844},
- {0.6873494379921158},
- {0.5135302922675329},
- {0.7823023462472571},
- {0.24755681474443175},
- {0.5766084608856102},
- {0.7472003032613045},
- {0.6226925702259329},
- {0.25879812692729937},
- {0.7745888858028205},
- {0.188060626125918},
- {0.06129675538874101},
- {0.03295588498230102},
- {0.5132286533276353},
- {0.6756458063524811},
- {0.41829046949272175},
- {0.28734085738095566},
- {0.6395052353894173},
- {0.7425074189561186},
- {0.6834310247003464},
- {0.6521394259158138},
- {0.30930793467564016},
- {0.41170884565279464},
- {0.08174175647208236},
- {0.24885384611777947},
- {0.3750846332455064},
- {0.29606314712183096},
- {0.5692354508745475},
- {0.5410224665644481},
- {0.1193986762345841},
- {0.6816862553711422},
- {0.6089728302562334},
- {0.10717863869630125},
- {0.37418818298132234},
- {0.5096343138120645},
- {0.25340054310880117},
- {0.4040572108432978},
- {0.8083832554415901},
- {0.8823298855539818},
- {0.746899697038108},
- {0.677118295393753},
- {0.3113506629457814},
- {0.21718429397380368},
- {0.10087217531972939},
- {0.29068097024378364},
- {0.26582802959230906},
- {0.29956660274227365},
- {0.7717577329134803},
- {0.9245104681762214},
- {0.9137622047123194},
- {0.8866477185262754},
- {0.11638767744806466},
- {0.6177393835744833},
- {0.7968986091896089},
- {0.7359792105230359},
- {0.2516555813756782},
- {0.7228287653556323},
- {0.9517973882430872},
- {0.24560187419839963},
- {0.30777938407719896},
- {0.7773124234236505},
- {0.3824276529260955},
- {0.27496100123838957},
- {0.47486524984473427},
- {0.2675739376737601},
- {0.793630632545808},
- {0.26818581872310304},
- {0.9498739053853732},
- {0.7949562855031603},
- {0.32106747026978316},
- {0.28133752506384396},
- {0.5646556845892284},
- {0.33220723228575405},
- {0.23951305835989517},
- {0.4853578850991672},
- {0.18599374243634806},
- {0.26886326559995577},
- {0.13466377197359305},
- {0.6306540532186685},
- {0.06307391513994089},
- {0.5105862021100787},
- {0.609958434521185},
- {0.1859937561161319},
- {0.4914385635766097},
- {0.3615624124586511},
- {0.12531239524667262},
- {0.5502631928433103},
- {0.2359018006232758},
- {0.442260390993664},
- {0.2453187021151176},
- {0.18689596123627453},
- {0.5606911285527543},
- {0.328929944782494},
- {0.07679160309416196},
- {0.6167308186305679},
- {0.13443129857807617},
- {0.5944819343687142},
- {0.03901784283052562},
- {0.19503768062936921},
- {0.3540824273046258},
- {0.5825098661451941},
- {0.1892596171497997},
- {0.1592084635644354},
- {0.40250964562598124},
- {0.28001102593079874},
- {0.25382677547355254},
- {0.10278811686593245},
- {0.14563320531660556},
- {0.4475451890101733},
- {0.028169125939849066},
- {0.14377720300792854},
- {0.5825698941048181},
- {0.21468404577318592},
- {0.04706012787722322},
- {0.382288877952108},
- {0.0703375580782607},
- {0.035433554096805424},
- {0.481397652173417},
- {0.5127781950860912},
- {0.6398429440462332},
- {0.27402145661358385},
- {0.4267991215157441},
- {0.4368761245645949},
- {0.36686150042825844},
- {0.5506626114475888},
- {0.007366788524911717},
- {0.20905808542592805},
- {0.2833600229464992},
- {0.2049364249451503},
- {0.1244514513935792},
- {0.5675733774205425},
- {0.11556142232401308},
- {0.48079946219407216},
- {0.5764008468457997},
- {0.299431359620421},
- {0.46741329472790566},
- {0.06893978554382234},
- {0.2486272839920422},
- {0.5509405677419775},
- {0.22843543535012403},
- {0.017151017161181427},
- {0.28910894417011945},
- {0.43575231064771824},
- {0.6372298385701358},
- {0.6049594888495408},
- {0.6416889094417189},
- {0.5284556185875632},
- {0.4901212888884191},
- {0.3846808357436504},
- {0.4132670939536593},
- {0.29434796270123154},
- {0.18408859262030342},
- {0.5740529356131827},
- {0.5827476426078739},
- {0.2589011430883629},
- {0.09026790037345794},
- {0.297181006539227},
- {0.3112835907056549},
- {0.24301398272125316},
- {0.4695261010414238},
- {0.48115138732859325},
- {0.4112205678383055},
- {0.35507576556823645},
- {0.1683745751580839},
- {0.5501229937921164},
- {0.2380855785827579},
- {0.5011727541005783},
- {0.2628392178662642},
- {0.47339382142984604},
- {0.4241031027097249},
- {0.21072038324236236},
- {0.5370468998122289},
- {0.4034873443955433},
- {0.16882631396233547},
- {0.3840763054752771},
- {0.5859242688222842},
- {0.12987236774128627},
- {0.06213991699786655},
- {0.0928493477692929},
- {0.5393437771308477},
- {0.5784497798538031},
- {0.27366378625301035},
- {0.5415062470175647},
- {0.03297925367011521},
- {0.3982960327205212},
- {0.13346796133538374},
- {0.5604079061331546},
- {0.20277044421367107},
- {0.03678035352166166},
- {0.6087619609273021},
- {0.027503225871966575},
- {0.3462952306311269},
- {0.617616367449157},
- {0.01921605184247036},
- {0.36499885315176706},
- {0.42690723867901975},
- {0.35288170558012244},
- {0.5237450610624459},
- {0.233120539276153},
- {0.06636790556580256},
- {0.18970085392013622},
- {0.5814894663772422},
- {0.08782171904427237},
- {0.29955664817478966},
- {0.3644013545425682},
- {0.022266284502935333},
- {0.10949950616467473},
- {0.6097216245961166},
- {0.5416087466954729},
- {0.11450166125781557},
- {0.5216743001508165},
- {0.40531800974828586},
- {0.3923006663960289},
- {0.19256805711377292},
- {0.5840092872529256},
- {0.05674099581583057},
- {0.5778750811752216},
- {0.6250730512386704},
- {0.4559407900636581},
- {0.25812864620347714},
- {0.5157339272950672},
- {0.12490316580226374},
- {0.5802350160921025},
- {0.3588599216605188},
- {0.29071734877900895},
- {0.4304776243501682},
- {0.3565876908382308},
- {0.6191467720044932},
- {0.5481470968581124},
- {0.36354434870300845},
- {0.31804823973737084},
- {0.18034238398578364},
- {0.19636351614857928},
- {0.056639024076897096},
- {0.033954650583697996},
- {0.23959913619217485},
- {0.2215227163217222},
- {0.053296634926866045},
- {0.09868564207434131},
- {0.19417498174496703},
- {0.43304675138634213},
- {0.2537341793861567},
- {0.10750790188209179},
- {0.5951664974920796},
- {0.3244094718403361},
- {0.6163596418653499},
- {0.3967342478279942},
- {0.527843120372329},
- {0.018838484302065812},
- {0.09708954007770206},
- {0.49572144539275925},
- {0.623817388966716},
- {0.3143448290779669},
- {0.32112050983804324},
- {0.4593190354330059},
- {0.41815009968348105},
- {0.015488861268522267},
- {0.46761322527935917},
- {0.34936168267970197},
- {0.5322109876759454},
- {0.16841628753009383},
- {0.3922746236699189},
- {0.5083305876533527},
- {0.42362627366283284},
- {0.17606390598390154},
- {0.5269634150191258},
- {0.1279402165333624},
- {0.04170102120141387},
- {0.02242033937428803},
- {0.3491564735826125},
- {0.4596510845748026},
- {0.28456872841053027},
- {0.1954819159624981},
- {0.4350641597628125},
- {0.5051379542641099},
- {0.4649474751149388},
- {0.443659372407636},
- {0.21042641914523905},
- {0.2800911596787448},
- {0.05561003511629962},
- {0.16929867571615442},
- {0.2551752069762639},
- {0.20141580898998976},
- {0.38725866410012344},
- {0.36806498493375905},
- {0.08122855275947759},
- {0.4637604846726668},
- {0.41429254688193023},
- {0.07291509405788361},
- {0.25456533959852634},
- {0.34671119524131494},
- {0.17239185587579836},
- {0.27488564784712},
- {0.5499541869752805},
- {0.6002610909954624},
- {0.508126081127562},
- {0.4606528390125295},
- {0.21181611513096707},
- {0.14775344616820035},
- {0.06862472075338293},
- {0.19775424043423492},
- {0.1808464449326318},
- {0.20379925777418315},
- {0.5250373429796829},
- {0.628957118363676},
- {0.6216449276980524},
- {0.6031985718324148},
- {0.07918012909597742},
- {0.42025655302661463},
- {0.5421410250255606},
- {0.500696724764298},
- {0.17120473453850837},
- {0.49175029702507944},
- {0.6475207833572502},
- {0.1670863147339715},
- {0.20938652526327448},
- {0.5288162749192754},
- {0.2601707637139846},
- {0.1870597304781677},
- {0.32305732540008564},
- {0.1820342100836349},
- {0.539917775810417},
- {0.1824504811317446},
- {0.6462122116568169},
- {0.5408196356516056},
- {0.21842659207478712},
- {0.1913977668644368},
- {0.5506332634805402},
- {0.3239573379986692},
- {0.23356509209122028},
- {0.4733047120965188},
- {0.18137485228575892},
- {0.26218642866411174},
- {0.13131958865934593},
- {0.6149926564604539},
- {0.06150756413488667},
- {0.4979065197236669},
- {0.5948109840286351},
- {0.18137486562582475},
- {0.4792343855693818},
- {0.3525835240086806},
- {0.12220044007780625},
- {0.5365981888041259},
- {0.2300435148060635},
- {0.4312774829818236},
- {0.23922656093814973},
- {0.1822546657645489},
- {0.5467671615564919},
- {0.3207614372709596},
- {0.07488459281234583},
- {0.6014151856075247},
- {0.1310928884100799},
- {0.5797188207532197},
- {0.03804889017875118},
- {0.19019419713227767},
- {0.34528929365103667},
- {0.5680440618223426},
- {0.18455962364406844},
- {0.15525474773176504},
- {0.3925138908583969},
- {0.2730573502168389},
- {0.2475233483913655},
- {0.10023552012600642},
- {0.14201661172144306},
- {0.43643104055343107},
- {0.02746958574752888},
- {0.14020670059126875},
- {0.5681025990729361},
- {0.20935267273062375},
- {0.04589145651070152},
- {0.37279527720015226},
- {0.06859082482816034},
- {0.034553612159650665},
- {0.4694428259248861},
- {0.5000440776706594},
- {0.6239533542489285},
- {0.26721652333774676},
- {0.41620017214881144},
- {0.42602692715425977},
- {0.3577510166627181},
- {0.5369876884152539},
- {0.007183844805873252},
- {0.2038664251096929},
- {0.27632317965320286},
- {0.19984712020684678},
- {0.12136087654122873},
- {0.5534784995587159},
- {0.11269161870390942},
- {0.46885949114318176},
- {0.5620867513315464},
- {0.2919954075307877},
- {0.45580575011380664},
- {0.06722776398728494},
- {0.24245297888824774},
- {0.5372587420602651},
- {0.22276256609891618},
- {0.01672509603501517},
- {0.2819293345919553},
- {0.42493102155818874},
- {0.62140514153206},
- {0.589936180065328},
- {0.6257534777183803},
- {0.515332174649373},
- {0.4779498235251931},
- {0.37512783412078765},
- {0.4030041932516187},
- {0.2870382495465969},
- {0.17951701415668533},
- {0.5597971471361702},
- {0.5682759334446384},
- {0.25247170130111374},
- {0.08802622540908642},
- {0.2898009387688505},
- {0.30355330530832536},
- {0.2369790759736201},
- {0.4578660878864815},
- {0.4692026767173483},
- {0.4010084897026228},
- {0.3462579637711824},
- {0.1641932319762107},
- {0.5364614713970357},
- {0.23217306174478114},
- {0.48872684131159827},
- {0.2563119795909952},
- {0.461637758938118},
- {0.4135711051366848},
- {0.20548744212328354},
- {0.5237101036197652},
- {0.3934673098690928},
- {0.1646337524895334},
- {0.3745383165021183},
- {0.5713736726634883},
- {0.1266471721388094},
- {0.060596760508727684},
- {0.0905435662291049},
- {0.5259499412558383},
- {0.564084802001435},
- {0.2668677352120483},
- {0.5280587092774823},
- {0.032160260794573674},
- {0.3884049170385991},
- {0.1301534742781528},
- {0.546490972563002},
- {0.19773492852727836},
- {0.035866965735647675},
- {0.5936442231553298},
- {0.026820222361066577},
- {0.33769548093521706},
- {0.6022787430802627},
- {0.018738848516026342},
- {0.3559346255830574},
- {0.4163056043760563},
- {0.3441183901433951},
- {0.5107385971229994},
- {0.22733132213014523},
- {0.06471975299186301},
- {0.1849899029265568},
- {0.5670490022318404},
- {0.08564079151527113},
- {0.29211758472204175},
- {0.35535196500230437},
- {0.021713332985138865},
- {0.1067802416136564},
- {0.5945800549413632},
- {0.5281586635216221},
- {0.11165817529704022},
- {0.508719260614437},
- {0.3952525132506096},
- {0.38255843711266313},
- {0.18778590320542146},
- {0.5695062469387155},
- {0.05533191385815099},
- {0.5635243751474389},
- {0.609550250729653},
- {0.4446181487914789},
- {0.2517183882780408},
- {0.5029264084726365},
- {0.12180137326481365},
- {0.5658257044359755},
- {0.34994814572716326},
- {0.283497796759186},
- {0.4197873245953769},
- {0.3477323425267267},
- {0.603771142214371},
- {0.5345346430540903},
- {0.3545162416842934},
- {0.3101499638992044},
- {0.17586383728730656},
- {0.1914871074114191},
- {0.055232474442372205},
- {0.03311143511261078},
- {0.2336490323029193},
- {0.21602151461919547},
- {0.051973088774728726},
- {0.09623492446303385},
- {0.18935292214809865},
- {0.4222926510143496},
- {0.24743305179614858},
- {0.10483809599180148},
- {0.5803863837247167},
- {0.3163532238471868},
- {0.6010532264895379},
- {0.38688191685335815},
- {0.5147348869564744},
- {0.018370657328668476},
- {0.09467845939016979},
- {0.48341090810495757},
- {0.6083257710449427},
- {0.3065385221780789},
- {0.31314593854002926},
- {0.4479125002402121},
- {0.40776593647671683},
- {0.015104217420724523},
- {0.45600071567427275},
- {0.34068578200699645},
- {0.5189942844857668},
- {0.1642339084807677},
- {0.3825330411206289},
- {0.4957069202449785},
- {0.4131061174612248},
- {0.17169160920353213},
- {0.5138770278349675},
- {0.12476300315903381},
- {0.04066543562969692},
- {0.021863562122794177},
- {0.34048566898607024},
- {0.4482363034136742},
- {0.2775018686355521},
- {0.1906274005125147},
- {0.42425995992210813},
- {0.4925935713667244},
- {0.4534011656250664},
- {0.43264172268142814},
- {0.20520077820655902},
- {0.2731354939570876},
- {0.05422903895961173},
- {0.16509438381079236},
- {0.24883829351488457},
- {0.1964139337433793},
- {0.37764164577514125},
- {0.3589246143416189},
- {0.07921135714110478},
- {0.45224365240278486},
- {0.40400418051438797},
- {0.07110435136642722},
- {0.24824357132637379},
- {0.3381011156557227},
- {0.1681107492390038},
- {0.2680592536106908},
- {0.5362968566574893},
- {0.5853544602418516},
- {0.4955074923479918},
- {0.44921318070421806},
- {0.20655596306832819},
- {0.14408419940601178},
- {0.06692052338296221},
- {0.1928432950367492},
- {0.17635538059720524},
- {0.1987381929657652},
- {0.5119987870561669},
- {0.6133378625699112},
- {0.606207259763117},
- {0.5882189929186796},
- {0.07721380316687286},
- {0.4098200790459941},
- {0.5286777234761666},
- {0.48826263348707394},
- {0.16695310837229596},
- {0.47953837756087625},
- {0.631440525336881},
- {0.1629369636681038},
- {0.20418670861064916},
- {0.5156838745938623},
- {0.2537097927036237},
- {0.1824143680301641},
- {0.3150346560413205},
- {0.17751364928942798},
- {0.5265096854943022},
- {0.17791958283790513},
- {0.6301644501541224},
- {0.5273891489285842},
- {0.21300227821591494},
- {0.18664467545052835},
- {0.13023534021118094},
- {0.07662213114674332},
- {0.05524262925505388},
- {0.11194565292662095},
- {0.042898635370987356},
- {0.06201212494862628},
- {0.031059604349613853},
- {0.14545757249613692},
- {0.014547720001574319},
- {0.11776445284052206},
- {0.14068421943247583},
- {0.04289863852616908},
- {0.11334813456603034},
- {0.0833927738253147},
- {0.028902750601901426},
- {0.1269157755451848},
- {0.054409708604904},
- {0.10200540622360095},
- {0.05658167535029748},
- {0.043106728153120284},
- {0.1293209328682847},
- {0.07586623925615264},
- {0.017711644152853253},
- {0.1422462399214184},
- {0.031005985387507387},
- {0.13711463301433552},
- {0.008999293151607152},
- {0.04498457977846082},
- {0.08166754828009107},
- {0.1343533283455339},
- {0.04365189495200598},
- {0.03672072907916881},
- {0.09283707233819204},
- {0.06458330664200852},
- {0.05854402489997666},
- {0.02370762525739869},
- {0.03358965571071965},
- {0.10322432154919121},
- {0.006497084507165926},
- {0.03316157697406595},
- {0.13436717352934624},
- {0.04951592714332337},
- {0.010854210684039156},
- {0.08817324156625196},
- {0.016223047170081974},
- {0.008172592782884684},
- {0.11103224269012293},
- {0.11827002634090963},
- {0.1475769495886776},
- {0.06320183892808051},
- {0.09843933269328932},
- {0.10076354894789218},
- {0.0846149850654846},
- {0.1270078996824858},
- {0.0016991172425788123},
- {0.04821832423267037},
- {0.06535573801498455},
- {0.047267681443446403},
- {0.028704177703991234},
- {0.1309082931786063},
- {0.026653731756201837},
- {0.11089427281290905},
- {0.13294431002069035},
- {0.06906252085008392},
- {0.1078068123982525},
- {0.0159006571073788},
- {0.05734478514998238},
- {0.12707200907437105},
- {0.052687624425060406},
- {0.00395580637177008},
- {0.06668170130879277},
- {0.10050434623056725},
- {0.14697424834971845},
- {0.13953123468794534},
- {0.1480027133556253},
- {0.12188595484224807},
- {0.11304431097609714},
- {0.08872493606832527},
- {0.09531823029160669},
- {0.06789005779823185},
- {0.04245922097878772},
- {0.13240277466292985},
- {0.1344081704366639},
- {0.059714405382645816},
- {0.02081989261090766},
- {0.0685434868491462},
- {0.07179618561212361},
- {0.056050101999416235},
- {0.10829412184461278},
- {0.11097544279113492},
- {0.09484620808026906},
- {0.08189665736415214},
- {0.038834852241996586},
- {0.12688343925312603},
- {0.05491338734800517},
- {0.11559328262558055},
- {0.06062270494018972},
- {0.10918619447289835},
- {0.09781750786091721},
- {0.04860172588355983},
- {0.12386749591883923},
- {0.09306257424201259},
- {0.0389390438023828},
- {0.08858550383144478},
- {0.13514084524548733},
- {0.02995448812159302},
- {0.014332297454508045},
- {0.021415292053451846},
- {0.1243972605296946},
- {0.1334168873711891},
- {0.06311934383883577},
- {0.1248960246599059},
- {0.007606519227310772},
- {0.09186522112826397},
- {0.03078379590644085},
- {0.12925560886787402},
- {0.04676810755239407},
- {0.008483226122952754},
- {0.1404082580815042},
- {0.006343497597028974},
- {0.07987146575450331},
- {0.14245048784596814},
- {0.004432097502109445},
- {0.08418537369634774},
- {0.0984642694395688},
- {0.08139060711655101},
- {0.12079948555023293},
- {0.05376822295684531},
- {0.015307464347505326},
- {0.04375366426464517},
- {0.13411797764499628},
- {0.020255691689320413},
- {0.06909141810189258},
- {0.08404756328060506},
- {0.005135620195851382},
- {0.025255577562611438},
- {0.1406296002689778},
- {0.1249196657579914},
- {0.026409302546037766},
- {0.12032187369015176},
- {0.09348480912166442},
- {0.0904824163602062},
- {0.044414972020095304},
- {0.13469916320280145},
- {0.013087060124740764},
- {0.13328433565876202},
- {0.1441703390343626},
- {0.10516072985839536},
- {0.05953623238738347},
- {0.11895175292281619},
- {0.028808363637647636},
- {0.13382864422620314},
- {0.0827694562565411},
- {0.06705267272934676},
- {0.09928776312830305},
- {0.08224537625122903},
- {0.14280346889860723},
- {0.12642770735057832},
- {0.08384989866812669},
- {0.07335642203955932},
- {0.04159517449996113},
- {0.045290377886265235},
- {0.013063540793448477},
- {0.007831490218214374},
- {0.0552624827269617},
- {0.05109323630674518},
- {0.012292633495509698},
- {0.02276140756266434},
- {0.04478560209032923},
- {0.09988032093429637},
- {0.05852266802130999},
- {0.024796222829475398},
- {0.1372725244758062},
- {0.07482361213381056},
- {0.14216062963958476},
- {0.09150500233942294},
- {0.12174468483360948},
- {0.004345013216199781},
- {0.022393273685299274},
- {0.11433596234432727},
- {0.14388072607616262},
- {0.0725022467247034},
- {0.0740650275715709},
- {0.10593990723498357},
- {0.09644447400053013},
- {0.003572437454972647},
- {0.10785292549708034},
- {0.08057872937849032},
- {0.1227521141393068},
- {0.03884447301640476},
- {0.09047640972042989},
- {0.11724420532655137},
- {0.09770752934686092},
- {0.040608362441978345},
- {0.12154178467854707},
- {0.02950884597759076},
- {0.00961815639431784},
- {0.005171152271644444},
- {0.08053139880642086},
- {0.10601649290325711},
- {0.06563452059279162},
- {0.04508704069636684},
- {0.10034562726774034},
- {0.11650783853353823},
- {0.10723808199323097},
- {0.10232807510903032},
- {0.048533924362662045},
- {0.06460178913711302},
- {0.012826209033555807},
- {0.0390479919550187},
- {0.05885503467159499},
- {0.04645566691992878},
- {0.0893195007954218},
- {0.08489256345226162},
- {0.018735007000218608},
- {0.10696430788930217},
- {0.09555474648125785},
- {0.01681754446174911},
- {0.05871437145400756},
- {0.07996740615500253},
- {0.039761420299796214},
- {0.06340116081994986},
- {0.1268445047062498},
- {0.13844756997035992},
- {0.11719703679944952},
- {0.10624754314071348},
- {0.04885445160507007},
- {0.03407867990045745},
- {0.015827988804745327},
- {0.04561114230151074},
- {0.04171143393149008},
- {0.04700539885703159},
- {0.12109754466791019},
- {0.14506618196525622},
- {0.14337965747782586},
- {0.13912508695390471},
- {0.01826254712778033},
- {0.09693031816232503},
- {0.1250424334043606},
- {0.11548348856124546},
- {0.039487616005509533},
- {0.11342003450934923},
- {0.14934780932151548},
- {0.03853772066395016},
- {0.048294077430810635},
- {0.12196913863255035},
- {0.06000723777348107},
- {0.04314450080558123},
- {0.07451174552825346},
- {0.0419853867185667},
- {0.12452965079044058},
- {0.04208139779761936},
- {0.14904599303727736},
- {0.12473766078032573},
- {0.05037912892123464},
- {0.044145049741921495},
- {0.4696591381715278},
- {0.2763173499673152},
- {0.19921785902495298},
- {0.4037022423430656},
- {0.1547025260916301},
- {0.22363024592503442},
- {0.11200820750446291},
- {0.5245540728674903},
- {0.05246248542999938},
- {0.4246861976068515},
- {0.5073402437913559},
- {0.15470253746995435},
- {0.4087599195987039},
- {0.3007338731639291},
- {0.10423008775086871},
- {0.4576880105374438},
- {0.19621415208887608},
- {0.367855384706862},
- {0.2040467728516016},
- {0.15545295739973577},
- {0.46636157113706556},
- {0.27359142677849413},
- {0.06387233691670187},
- {0.5129732555027197},
- {0.11181484496944179},
- {0.49446747916345923},
- {0.03245355875665679},
- {0.16222493015721717},
- {0.29451230579667415},
- {0.4845095678248359},
- {0.15741895655564234},
- {0.1324235491256617},
- {0.3347922254744474},
- {0.23290252928712477},
- {0.21112346491382641},
- {0.08549524905013067},
- {0.12113216525556063},
- {0.37225107884328074},
- {0.02343000836266994},
- {0.11958841307431456},
- {0.48455949680023214},
- {0.17856603000527868},
- {0.03914282580390085},
- {0.3179733594325927},
- {0.05850410756451967},
- {0.02947228361220913},
- {0.4004082711077996},
- {0.4265094140555463},
- {0.5321970430254296},
- {0.2279206331682746},
- {0.35499528837520083},
- {0.3633769565252666},
- {0.3051414531402316},
- {0.4580202317522033},
- {0.006127414713302507},
- {0.1738865700083382},
- {0.23568809772300642},
- {0.1704583294680062},
- {0.10351398737484561},
- {0.47208596417895765},
- {0.09611959906868757},
- {0.39991071941775275},
- {0.47942831775061756},
- {0.24905562476212512},
- {0.3887766140732664},
- {0.057341493494032225},
- {0.20679872551106485},
- {0.45825142523388585},
- {0.19000391322089535},
- {0.014265564234149953},
- {0.24046983190366147},
- {0.3624422108208123},
- {0.5300235612039405},
- {0.5031823107713089},
- {0.5337324468837454},
- {0.43954929908886137},
- {0.4076642605773291},
- {0.3199628990149946},
- {0.3437398621464796},
- {0.24482744840401913},
- {0.1531178948816528},
- {0.47747541442189906},
- {0.4847073412495751},
- {0.21534413103971703},
- {0.07508140881428105},
- {0.24718386659597108},
- {0.25891386012364503},
- {0.20212979485281105},
- {0.3905339660656619},
- {0.400203437369402},
- {0.3420376395038761},
- {0.2953385268115915},
- {0.14004757238257576},
- {0.4575713982950574},
- {0.19803053559904024},
- {0.41685644931948473},
- {0.2186196719697435},
- {0.3937509888884044},
- {0.35275284239708166},
- {0.17526920615485803},
- {0.44669520029182375},
- {0.33560543815260885},
- {0.14042331155119453},
- {0.31946007371350243},
- {0.48734953820405785},
- {0.10802289956584955},
- {0.05168562127289883},
- {0.077228558647803},
- {0.44860565555047055},
- {0.4811325423550508},
- {0.22762313655594768},
- {0.4504043158155419},
- {0.02743088979528177},
- {0.331287502402003},
- {0.11101357766350718},
- {0.46612599749257666},
- {0.16865674901569444},
- {0.030592500187427075},
- {0.506345062529067},
- {0.022876137994362982},
- {0.28803521156338346},
- {0.5137098213539073},
- {0.015983181598462903},
- {0.3035921739273058},
- {0.3550852161225191},
- {0.29351359110078945},
- {0.43563123636863316},
- {0.19390080460478984},
- {0.055202301475030253},
- {0.15778596053159025},
- {0.48366083807910537},
- {0.07304676815408412},
- {0.24915983501993974},
- {0.30309519729267026},
- {0.018520249198479683},
- {0.09107752759616879},
- {0.5071432742958676},
- {0.4504895711520294},
- {0.09523813009103946},
- {0.43390885614355384},
- {0.33712811601686343},
- {0.32630078455282013},
- {0.16017079117730612},
- {0.485756729315339},
- {0.04719500382475317},
- {0.4806545298361699},
- {0.5199120075317515},
- {0.37923422071686363},
- {0.21470159749033893},
- {0.42896787977159295},
- {0.10388970625215892},
- {0.4826174340084878},
- {0.2984860440287444},
- {0.2418076417284075},
- {0.35805492722791854},
- {0.29659608878903243},
- {0.5149827536985729},
- {0.4559279223211722},
- {0.3023823724066365},
- {0.2645404380913844},
- {0.15000194091763802},
- {0.16332770975247157},
- {0.04711018760784005},
- {0.028242187877123837},
- {0.1992894552943743},
- {0.18425417625745197},
- {0.04433011534348407},
- {0.08208296643689394},
- {0.16150737001285306},
- {0.3601918294545213},
- {0.21104644700753186},
- {0.0894209868467082},
- {0.4950368727520099},
- {0.26983146919002843},
- {0.512664524776333},
- {0.32998846908550117},
- {0.43903984635199983},
- {0.015669135268163503},
- {0.08075538945744534},
- {0.41232225791842986},
- {0.5188675953765641},
- {0.2614600818564937},
- {0.26709583559661215},
- {0.3820441168216979},
- {0.347801360729325},
- {0.012883046134432374},
- {0.38894290870741705},
- {0.29058576983399714},
- {0.4426728723702474},
- {0.14008226714829572},
- {0.3262791232030201},
- {0.42281006322849346},
- {0.35235623411821276},
- {0.1464432655232486},
- {0.4383081408732337},
- {0.10641580962432041},
- {0.03468532454884678},
- {0.018648386185470732},
- {0.29041508470620264},
- {0.3823203026780048},
- {0.23669345299000075},
- {0.16259442822373257},
- {0.3618698330685686},
- {0.42015455211435276},
- {0.38672563903499163},
- {0.3690190042774009},
- {0.17502469799125256},
- {0.23296918149310794},
- {0.04625431369810726},
- {0.14081620410546888},
- {0.21224503898937558},
- {0.1675300149208207},
- {0.32210703866912027},
- {0.3061424658123477},
- {0.06756282301787082},
- {0.38573834549779673},
- {0.3445927949189134},
- {0.060648004030693474},
- {0.21173777448315614},
- {0.28838119511701205},
- {0.14338899380304268},
- {0.22863943459193023},
- {0.45743099120047503},
- {0.49927436200331116},
- {0.4226399624728034},
- {0.3831535239466875},
- {0.17618059429547955},
- {0.12289570101417162},
- {0.057079434575678094},
- {0.16448446135749686},
- {0.15042119965591647},
- {0.16951247703430244},
- {0.4367061073530026},
- {0.5231426269487108},
- {0.5170606246597214},
- {0.5017176469217691},
- {0.06585902206683723},
- {0.3495534285624051},
- {0.45093230003725837},
- {0.416460506209509},
- {0.1424015913923466},
- {0.4090192076334184},
- {0.5385831779608371},
- {0.1389760463233468},
- {0.17415975378237838},
- {0.43984927931849693},
- {0.21640015322298448},
- {0.15558917443093864},
- {0.26870680517062384},
- {0.15140913756639038},
- {0.4490830858367771},
- {0.15175537600343575},
- {0.5374947577539135},
- {0.44983321857664726},
- {0.18167893777996222},
- {0.15919738822588878},
- {0.27320331519382457},
- {0.16073532892502174},
- {0.11588612912617371},
- {0.23483582452733076},
- {0.0899913140445624},
- {0.13008694944633686},
- {0.06515579306786756},
- {0.3051360019603878},
- {0.030517717591069016},
- {0.24704230722511117},
- {0.2951226224931236},
- {0.08999132066339648},
- {0.23777790332686247},
- {0.17493855535172775},
- {0.06063121783884175},
- {0.2662396441174498},
- {0.11413885620819805},
- {0.2139835094129698},
- {0.11869513497531337},
- {0.09042784408206554},
- {0.2712851022332584},
- {0.15914964434737458},
- {0.03715489123187625},
- {0.2983993765238483},
- {0.06504331301306075},
- {0.2876344641965704},
- {0.018878414410661456},
- {0.09436713804523439},
- {0.17131943524463641},
- {0.28184189216079647},
- {0.09157147665174796},
- {0.07703151006858514},
- {0.19475048703796818},
- {0.13548068790057397},
- {0.12281168584140027},
- {0.04973305867049217},
- {0.07046324969480093},
- {0.21654050897508428},
- {0.013629365298035883},
- {0.06956524052288082},
- {0.28187093612160513},
- {0.10387284609934494},
- {0.02276959800529735},
- {0.1849668597496232},
- {0.03403216256221426},
- {0.017144190189795596},
- {0.2329197032630212},
- {0.24810288230523964},
- {0.30958195992301957},
- {0.13258269140694665},
- {0.2065027203343197},
- {0.21137838299973163},
- {0.1775024689725631},
- {0.266432899033352},
- {0.003564350988163415},
- {0.10115077836856842},
- {0.13710106844793213},
- {0.09915655190776333},
- {0.060214658294184056},
- {0.27461501328876564},
- {0.055913301767964343},
- {0.23263027469631578},
- {0.2788861009224744},
- {0.1448770327722897},
- {0.2261535041097292},
- {0.033355863534828674},
- {0.12029596103982661},
- {0.2665673855588197},
- {0.11052632595171613},
- {0.008298357521698685},
- {0.13988262963636466},
- {0.21083463625967178},
- {0.3083176335405795},
- {0.292703929885857},
- {0.3104751128293729},
- {0.2556882554648414},
- {0.23714055242142282},
- {0.1861241859154414},
- {0.19995537671916558},
- {0.1424174792272316},
- {0.08906952531580295},
- {0.277750086267812},
- {0.2819569380545192},
- {0.1252668706428902},
- {0.0436752702765317},
- {0.1437882207069581},
- {0.15061162274154646},
- {0.11758001828353096},
- {0.2271757654717759},
- {0.23280055034584038},
- {0.19896518440444172},
- {0.171800052573274},
- {0.08146644651422293},
- {0.2661718101318572},
- {0.11519545653023633},
- {0.2424876993927804},
- {0.12717227089682812},
- {0.2290471254194375},
- {0.20519827712099198},
- {0.10195506545304132},
- {0.2598450656704247},
- {0.1952235373452534},
- {0.08168501606428953},
- {0.18583168965982544},
- {0.2834939186191262},
- {0.06283751742409677},
- {0.03006581141928362},
- {0.044924279196106524},
- {0.2609563880482321},
- {0.27987745778945394},
- {0.13240963598410727},
- {0.2620026786606921},
- {0.01595670012929763},
- {0.19271177026572386},
- {0.06457721139478922},
- {0.271148067742889},
- {0.09810856260625377},
- {0.0177958263599681},
- {0.29454372005520957},
- {0.013307175845067503},
- {0.1675516737479751},
- {0.2988278409484658},
- {0.009297505031085366},
- {0.17660124469578214},
- {0.20655503180171908},
- {0.17073847738888012},
- {0.25340909673608536},
- {0.11279316919717088},
- {0.032111483719921154},
- {0.09178496489198244},
- {0.2813481813791008},
- {0.04249170856461002},
- {0.14493765245494505},
- {0.17631215064198622},
- {0.010773331269437572},
- {0.052980300938683667},
- {0.2950080442494873},
- {0.2620522721608996},
- {0.05540054639420214},
- {0.25240717864427964},
- {0.19610928747055956},
- {0.18981096894492555},
- {0.09317223405302122},
- {0.28256737288946715},
- {0.02745359444235649},
- {0.2795993952665552},
- {0.3024356869106102},
- {0.2206026411796426},
- {0.12489310532769422},
- {0.2495329853934691},
- {0.060433216040686175},
- {0.2807412274671866},
- {0.17363098072619704},
- {0.14066084100182943},
- {0.2082825291571878},
- {0.1725315833226514},
- {0.29956831272536777},
- {0.26521579107885873},
- {0.17589749646795},
- {0.15388463422806314},
- {0.087256957681594},
- {0.09500863102783569},
- {0.027404256380431247},
- {0.016428636705327144},
- {0.11592777707161256},
- {0.10718167219703605},
- {0.025787072986411853},
- {0.04774811502403415},
- {0.0939497293452686},
- {0.20952557698720728},
- {0.12276688409984175},
- {0.05201668203355973},
- {0.28796568359250885},
- {0.1569624562471787},
- {0.29821978615480016},
- {0.19195611540931629},
- {0.2553919039934594},
- {0.009114822545876453},
- {0.04697585616120777},
- {0.23985013520673207},
- {0.3018281465903328},
- {0.15209277398953683},
- {0.15537112307353573},
- {0.2222371732664229},
- {0.20231797288158307},
- {0.0074941391057027785},
- {0.2262502386170695},
- {0.1690353475839395},
- {0.2575052552980563},
- {0.08148662865110515},
- {0.18979836841808392},
- {0.24595094949296517},
- {0.20496756789420648},
- {0.0851868565456276},
- {0.25496626687432944},
- {0.061902664327125705},
- {0.02017664490083408},
- {0.010847869262632367},
- {0.16893605910219234},
- {0.22239783210475922},
- {0.13768588916058716},
- {0.09458207711172999},
- {0.21050168095922778},
- {0.24440622400813425},
- {0.2249604405998443},
- {0.21466039334529},
- {0.10181283370354521},
- {0.13551945985699854},
- {0.026906389799069213},
- {0.08191356383355176},
- {0.12346411167701464},
- {0.097453135158893},
- {0.1873714437970324},
- {0.17808476357378786},
- {0.039301667384132995},
- {0.22438612649519127},
- {0.20045153242471317},
- {0.03527927898003022},
- {0.1231690331114855},
- {0.16775293429242416},
- {0.08341016981339106},
- {0.13300082216593348},
- {0.2660901345492933},
- {0.2904306544989855},
- {0.24585200094369936},
- {0.22288252151968335},
- {0.1024852249691864},
- {0.07148910818781595},
- {0.03320342241434033},
- {0.09568151982667615},
- {0.08750084280574506},
- {0.09860634432194258},
- {0.2540343551255604},
- {0.3043149560722388},
- {0.3007770217421683},
- {0.29185192683339495},
- {0.038310556958676384},
- {0.20333716041896502},
- {0.26230980999918696},
- {0.24225737709841458},
- {0.08283579237642097},
- {0.23792873260903058},
- {0.3132968098936194},
- {0.08084313388618031},
- {0.10130969087906594},
- {0.25586275562158933},
- {0.12588116458063855},
- {0.09050708228161462},
- {0.156308232974154},
- {0.08807553174589416},
- {0.261234111883226},
- {0.08827694055743479},
- {0.3126636698465352},
- {0.2616704682419371},
- {0.10568364174839194},
- {0.09260600017885022},
- {0.2079112514342431},
- {0.1223216612975103},
- {0.08819084099839533},
- {0.17871309549970382},
- {0.06848455227544716},
- {0.09899784867347894},
- {0.04958440004770898},
- {0.23221243849188802},
- {0.023224377239985244},
- {0.18800238648618203},
- {0.2245921273889724},
- {0.06848455731246537},
- {0.18095205546472046},
- {0.13313050005074925},
- {0.046141139861031716},
- {0.20261180780546298},
- {0.08686114374082086},
- {0.1628442143785059},
- {0.09032853072945293},
- {0.06881675727201364},
- {0.20645146659647215},
- {0.12111493485392852},
- {0.02827535210340372},
- {0.2270857795274424},
- {0.04949880127325895},
- {0.2188935422115943},
- {0.014366717191664564},
- {0.07181461085614287},
- {0.13037630290631722},
- {0.21448532007810248},
- {0.06968707642818837},
- {0.058621974066700666},
- {0.14820763594602074},
- {0.1031025533002652},
- {0.09346127910607363},
- {0.037847499978171516},
- {0.053623443089539626},
- {0.16479012407033694},
- {0.010372123022587458},
- {0.05294004651142388},
- {0.2145074229073967},
- {0.07904857745679178},
- {0.01732795816396823},
- {0.14076216921863896},
- {0.025898915254025073},
- {0.013046950161121786},
- {0.1772549024697996},
- {0.18880949782007286},
- {0.235595869923454},
- {0.10089714053938914},
- {0.1571512372711296},
- {0.1608616795313849},
- {0.13508167143056576},
- {0.20275887729245853},
- {0.0027125171375544403},
- {0.07697704875666235},
- {0.10433568382491468},
- {0.07545941666345327},
- {0.04582413266745057},
- {0.208985571917354},
- {0.04255074479660162},
- {0.17703464359240692},
- {0.21223592477006265},
- {0.11025329310662574},
- {0.17210573752494443},
- {0.02538424295940909},
- {0.09154678004010049},
- {0.20286122327530726},
- {0.08411196155781417},
- {0.006315157251884389},
- {0.10645248781471121},
- {0.16044788123940978},
- {0.23463370121694338},
- {0.2227514710760913},
- {0.23627557082075204},
- {0.1945820647638146},
- {0.18046702319394184},
- {0.14164290937833338},
- {0.15216862421743751},
- {0.10838154109234377},
- {0.06778305914745056},
- {0.21137140294560774},
- {0.21457287148910675},
- {0.0953297064500755},
- {0.03323744477068396},
- {0.10942469306229907},
- {0.11461739013862758},
- {0.08947991252465842},
- {0.1728836916245322},
- {0.17716422556089922},
- {0.1514150750770519},
- {0.13074205890084872},
- {0.06199701798148523},
- {0.2025601852663136},
- {0.08766523023246885},
- {0.18453627110050203},
- {0.09677974065261916},
- {0.1743078207143502},
- {0.15615853913818245},
- {0.07758912161575823},
- {0.19774545101776364},
- {0.14856763333957082},
- {0.062163352232032405},
- {0.1414203159500589},
- {0.21574253354972575},
- {0.047820162340988764},
- {0.022880470806638697},
- {0.03418795669012059},
- {0.19859118170061754},
- {0.2129903601497557},
- {0.10076544312750199},
- {0.19938742237012086},
- {0.012143254887992692},
- {0.14665614615118944},
- {0.04914409192179443},
- {0.20634718157942492},
- {0.07466188326964371},
- {0.01354285370286419},
- {0.22415157515687506},
- {0.010126932687623748},
- {0.1275089877446368},
- {0.22741184648843105},
- {0.007075521411069701},
- {0.13439582811612602},
- {0.15719104697345201},
- {0.129934186474695},
- {0.19284759553463718},
- {0.08583705854513803},
- {0.024437253848411725},
- {0.06984954373632538},
- {0.2141095997966846},
- {0.03233673902155821},
- {0.11029942546806318},
- {0.13417582380737791},
- {0.008198644239566894},
- {0.040318693284193026},
- {0.22450493186572384},
- {0.19942516366430618},
- {0.04216053133464967},
- {0.19208512292644736},
- {0.14924170062488099},
- {0.14444859888061035},
- {0.07090527348522348},
- {0.21503742028260525},
- {0.020892539948971816},
- {0.21277875097849866},
- {0.2301574638629466},
- {0.1678814591426873},
- {0.09504526621782584},
- {0.18989782474078692},
- {0.04599045793533272},
- {0.2136477000305728},
- {0.13213541887267172},
- {0.10704471671485961},
- {0.1585056947725464},
- {0.1312987632492487},
- {0.2279753550742555},
- {0.20183264241946758},
- {0.13386026662544864},
- {0.11710819415261825},
- {0.06640367176750522},
- {0.0723027953011387},
- {0.02085499304661838},
- {0.012502404717672746},
- {0.08822253562278051},
- {0.08156663685245169},
- {0.019624295596952702},
- {0.036336932226573214},
- {0.07149695744440494},
- {0.15945167022584064},
- {0.09342718440210834},
- {0.03958536685172322},
- {0.21914560444978495},
- {0.11945045646093685},
- {0.22694910893708795},
- {0.14608108304576334},
- {0.1943565374665499},
- {0.006936497680380501},
- {0.03574923325781251},
- {0.18252905068932074},
- {0.2296951178324967},
- {0.11574456536823485},
- {0.11823943136284751},
- {0.16912535917161198},
- {0.15396659041127186},
- {0.005703136650386384},
- {0.17217935373441},
- {0.12863808269627292},
- {0.19596482510444774},
- {0.06201237684831605},
- {0.1444390097169411},
- {0.18717184915653093},
- {0.15598296643686158},
- {0.06482829806653503},
- {0.19403262212155348},
- {0.0471087270600496},
- {0.015354687362049901},
- {0.008255368615087492},
- {0.12856252287929773},
- {0.16924762262258358},
- {0.10478073994052774},
- {0.0719781822618028},
- {0.16019449795547028},
- {0.1859962931115916},
- {0.1711978007848477},
- {0.16335933179333148},
- {0.07748088141739008},
- {0.10313205925986553},
- {0.020476110147979936},
- {0.062337280036261655},
- {0.09395778359341625},
- {0.07416309451699461},
- {0.1425920887352487},
- {0.13552480514275422},
- {0.02990907648207106},
- {0.17076074033362282},
- {0.1525462051174843},
- {0.02684798695518051},
- {0.09373322499394589},
- {0.12766214961835365},
- {0.06347621651641236},
- {0.10121534344736785},
- {0.20249802909309722},
- {0.22102147914607465},
- {0.18709654803256445},
- {0.16961647752737238},
- {0.07799257985484767},
- {0.05440413465225322},
- {0.025268233297856182},
- {0.07281487236778686},
- {0.0665892714968953},
- {0.07504070158440874},
- {0.1933234252445852},
- {0.2315876119667454},
- {0.22889519824718543},
- {0.2221030857490776},
- {0.029154828647559913},
- {0.1547422052905896},
- {0.19962115328548635},
- {0.18436099285975},
- {0.06303910786847622},
- {0.18106683849649388},
- {0.23842291873042004},
- {0.06152266902111787},
- {0.07709798322959382},
- {0.1947148616368657},
- {0.09579719207064757},
- {0.0688770585652756},
- {0.11895258410051009},
- {0.06702661720277389},
- {0.1988025331260046},
- {0.06717989190966238},
- {0.23794109097723545},
- {0.19913460595076724},
- {0.08042661633314271},
- {0.07047436219375605},
- {0.17406575871082713},
- {0.10240914156227884},
- {0.07383441513547297},
- {0.14962071722970244},
- {0.05733607714620127},
- {0.08288216977780463},
- {0.0415126461650652},
- {0.19441099993073552},
- {0.019443723304907602},
- {0.15739782150997936},
- {0.18803118534835317},
- {0.0573360813632525},
- {0.15149520099306457},
- {0.1114584292048987},
- {0.038629908012616905},
- {0.16962900182717855},
- {0.07272117686482261},
- {0.13633510227044252},
- {0.07562411426122023},
- {0.05761420309838507},
- {0.17284360957946315},
- {0.10139885591150484},
- {0.0236724591995031},
- {0.19011890041162832},
- {0.041440981858700925},
- {0.18326026243948734},
- {0.012027985551046038},
- {0.06012404157526262},
- {0.10915258278111158},
- {0.1795696467323581},
- {0.05834284458938218},
- {0.04907901002305288},
- {0.1240811856968758},
- {0.08631867703855461},
- {0.0782468882538007},
- {0.03168637461206392},
- {0.04489418077029697},
- {0.13796424087912645},
- {0.008683664067789686},
- {0.044322033072423474},
- {0.17958815148245802},
- {0.06618040397096964},
- {0.014507171516278174},
- {0.11784775289361157},
- {0.021682878162585094},
- {0.010923060983913508},
- {0.1483999007787111},
- {0.15807354466458814},
- {0.19724364874179737},
- {0.08447227939126883},
- {0.13156887450410998},
- {0.13467530064857636},
- {0.11309197296099517},
- {0.16975213014111296},
- {0.0022709514290710016},
- {0.06444609564281585},
- {0.08735106849828511},
- {0.06317551610502739},
- {0.03836450584084005},
- {0.1749651925255018},
- {0.03562398680031881},
- {0.1482154974415099},
- {0.17768642637639595},
- {0.09230536097774261},
- {0.14408895898662208},
- {0.02125198843039517},
- {0.07664404699258506},
- {0.16983781540842138},
- {0.07041952902605378},
- {0.005287124341970031},
- {0.08912328183442857},
- {0.1343288638244554},
- {0.19643810972093512},
- {0.18649016611337996},
- {0.19781270237198068},
- {0.1629064059832515},
- {0.15108912623939008},
- {0.11858511897200677},
- {0.12739737192514694},
- {0.09073830805378119},
- {0.05674877880273582},
- {0.17696263848008095},
- {0.1796429458091398},
- {0.07981115772448207},
- {0.02782678186826325},
- {0.09161164722060541},
- {0.0959590346280276},
- {0.07491364106338036},
- {0.14474027135982365},
- {0.14832398499812485},
- {0.126766491672432},
- {0.1094587980256064},
- {0.05190463670586441},
- {0.16958578282685208},
- {0.07339436758573029},
- {0.15449594871461272},
- {0.08102514350871096},
- {0.1459325690772934},
- {0.13073777588635713},
- {0.0649585302795653},
- {0.1655548303690919},
- {0.1243825797725208},
- {0.052043893707692655},
- {0.11839876112119613},
- {0.18062220072012913},
- {0.040035605490988786},
- {0.01915580077145619},
- {0.02862256168911989},
- {0.16626288609941178},
- {0.1783180485991408},
- {0.08436202076042393},
- {0.16692950820522573},
- {0.010166476613055857},
- {0.12278226009084708},
- {0.041144014994432765},
- {0.17275630092979039},
- {0.06250781171513492},
- {0.011338237294215686},
- {0.1876623498091374},
- {0.00847838781944043},
- {0.10675203261541352},
- {0.1903918875278305},
- {0.005923710209026732},
- {0.11251777682653318},
- {0.13160220365773204},
- {0.1087824376755535},
- {0.161454287830652},
- {0.07186380062692604},
- {0.02045915794642888},
- {0.058478864141289486},
- {0.17925508926903228},
- {0.02707270036225893},
- {0.09234398353635517},
- {0.11233358661721204},
- {0.0068640019244543835},
- {0.03375528687518786},
- {0.18795818422500968},
- {0.1669611056630919},
- {0.03529729547483599},
- {0.16081593674515163},
- {0.12494691687611796},
- {0.12093407540679263},
- {0.05936273357340465},
- {0.180031871553373},
- {0.017491481545741313},
- {0.17814088689821828},
- {0.1926905508667688},
- {0.14055234316356793},
- {0.07957302099790822},
- {0.15898470483448124},
- {0.038503755322274895},
- {0.17886838132185787},
- {0.1106253354735779},
- {0.0896191028740485},
- {0.13270284234374974},
- {0.1099248774903462},
- {0.19086366358061724},
- {0.16897667535067037},
- {0.11206939841233972},
- {0.09804436520780328},
- {0.05559393937394107},
- {0.06053275536647319},
- {0.017460046835015907},
- {0.010467161098204536},
- {0.07386095024986722},
- {0.06828855307863393},
- {0.01642969237443834},
- {0.030421709424623467},
- {0.05985809838200195},
- {0.13349482418149825},
- {0.07821834376439575},
- {0.03314133731271826},
- {0.18347129192649364},
- {0.10000533491475636},
- {0.19000447817695176},
- {0.12230081045759211},
- {0.16271759186262277},
- {0.005807317897430845},
- {0.02992968089713775},
- {0.15281548004655396},
- {0.19230346930181244},
- {0.0969027190615932},
- {0.09899145037958752},
- {0.14159375097965082},
- {0.1289026504875492},
- {0.004774733455899585},
- {0.14415059134786104},
- {0.10769732426296666},
- {0.1640640692946268},
- {0.05191749533082772},
- {0.12092604724555567},
- {0.15670248583465582},
- {0.13059078434427604},
- {0.05427501787921288},
- {0.16244640610477687},
- {0.03943998345949189},
- {0.012855125862623544},
- {0.006911492242531343},
- {0.10763406469053319},
- {0.14169611138683977},
- {0.08772367474204862},
- {0.06026098549067451},
- {0.13411672834232388},
- {0.15571829641028415},
- {0.1433288236094544},
- {0.13676636466253642},
- {0.0648679103053119},
- {0.0863433797769052},
- {0.01714284159114811},
- {0.05218950812247409},
- {0.0786625676828669},
- {0.06209021987213766},
- {0.11937978315576007},
- {0.11346296974587494},
- {0.025040232571725076},
- {0.1429629114304831},
- {0.12771348712039476},
- {0.022477452215662955},
- {0.07847456456748855},
- {0.10688026154756695},
- {0.053143039214097444},
- {0.08473868262928129},
- {0.16953374494350118},
- {0.18504179640859175},
- {0.15663944284306888},
- {0.14200492107565346},
- {0.0652963102891164},
- {0.04554778498000402},
- {0.02115486376967242},
- {0.060961472343114144},
- {0.05574932566251345},
- {0.06282496288862005},
- {0.16185265809155847},
- {0.19388788777393146},
- {0.19163376716417274},
- {0.18594733024901453},
- {0.02440876736402464},
- {0.12955200443787424},
- {0.1671251904919544},
- {0.1543492036984025},
- {0.05277708668426944},
- {0.15159129870482832},
- {0.1996104874390899},
- {0.05150750614601999},
- {0.06454734341387151},
- {0.16301758509598643},
- {0.08020254221507571},
- {0.05766468805430005},
- {0.09958851028616598},
- {0.05611547666005462},
- {0.16643983201244356},
- {0.05624380005747384},
- {0.19920709554544563},
- {0.16671784730882994},
- {0.06733411441660613},
- {0.05900196954370969},
- {0.3368219223440794},
- {0.1981644418872611},
- {0.14287157810511933},
- {0.28952010994609034},
- {0.11094685058728161},
- {0.16037922655992232},
- {0.08032808627304774},
- {0.37619051102571593},
- {0.037624127281490394},
- {0.3045690157926731},
- {0.36384539830652407},
- {0.1109468587473891},
- {0.2931472864180998},
- {0.2156750567388319},
- {0.0747499104542452},
- {0.32823667850524685},
- {0.14071743212532115},
- {0.2638120878557994},
- {0.14633469402416205},
- {0.11148503178134374},
- {0.3344570309210568},
- {0.19620951199449768},
- {0.04580684491448154},
- {0.36788518307595264},
- {0.08018941391375181},
- {0.35461353422583947},
- {0.02327447537778228},
- {0.11634163670362159},
- {0.21121318192300179},
- {0.3474720936213514},
- {0.11289497265377586},
- {0.09496920373737334},
- {0.24010042987595814},
- {0.16702896048971905},
- {0.1514098322052595},
- {0.0613139866679945},
- {0.0868714466366409},
- {0.2669645148581341},
- {0.016803123405575347},
- {0.08576432546077171},
- {0.34750790081023974},
- {0.1280608607465496},
- {0.02807176686602493},
- {0.22803856983439727},
- {0.041956952124094574},
- {0.02113641663778019},
- {0.2871577972954139},
- {0.3058765582616423},
- {0.3816717626224332},
- {0.16345613140732868},
- {0.25458930900213167},
- {0.26060032709867353},
- {0.21883600781982906},
- {0.3284749351026473},
- {0.0043943520630065815},
- {0.12470492750986664},
- {0.16902666571706199},
- {0.12224632194850564},
- {0.07423635011731139},
- {0.33856235095406967},
- {0.06893337210322423},
- {0.286800971880796},
- {0.3438280116078037},
- {0.17861335484618532},
- {0.27881600904091247},
- {0.041123168909122106},
- {0.14830829127720171},
- {0.3286407383982819},
- {0.13626368168436787},
- {0.010230727730276754},
- {0.17245594616316803},
- {0.25992996253107903},
- {0.38011302296255134},
- {0.36086348466114615},
- {0.3827728966941471},
- {0.31522827483031446},
- {0.2923615208536314},
- {0.22946539301797916},
- {0.24651733937343626},
- {0.17558106531277712},
- {0.1098104125049121},
- {0.3424274625715558},
- {0.347613929305351},
- {0.1544367356817459},
- {0.05384557095510369},
- {0.17727100007770005},
- {0.1856833115776028},
- {0.14495990928738953},
- {0.28007631599164756},
- {0.2870108982192102},
- {0.24529656912509937},
- {0.21180571665278256},
- {0.10043686732715729},
- {0.32815304857780125},
- {0.14202007426700167},
- {0.2989538139254458},
- {0.1567858308086149},
- {0.28238344412631866},
- {0.252981110835173},
- {0.1256965023072533},
- {0.3203530472119041},
- {0.24068363551441177},
- {0.10070633336920398},
- {0.2291047855669857},
- {0.34950881388246224},
- {0.07746997286287786},
- {0.037066989439323565},
- {0.05538542630062771},
- {0.321723154084039},
- {0.34505021758809407},
- {0.16324277799266945},
- {0.32301308577893556},
- {0.01967240554165696},
- {0.23758697391055275},
- {0.07961477504832472},
- {0.3342880863369074},
- {0.12095429600482317},
- {0.021939793958991406},
- {0.36313169162309844},
- {0.016405908346780008},
- {0.20656805282074645},
- {0.3684134204842481},
- {0.011462538495743368},
- {0.21772492286409503},
- {0.2546538018103452},
- {0.2104969411935},
- {0.3124183871691699},
- {0.13905838605698898},
- {0.03958902060976503},
- {0.11315817414319636},
- {0.346863416473877},
- {0.052386402969753706},
- {0.1786880905353529},
- {0.21736850985765435},
- {0.01328202824203345},
- {0.06531738751367329},
- {0.36370413917043704},
- {0.32307422770931005},
- {0.0683012156062933},
- {0.3111831606585622},
- {0.2417756429803917},
- {0.23401068686397586},
- {0.11486848525453203},
- {0.3483665110755506},
- {0.03384648699730809},
- {0.34470740493434515},
- {0.3728613958377999},
- {0.2719725623519371},
- {0.15397593471423007},
- {0.3076396776842083},
- {0.0745058016071947},
- {0.346115126200605},
- {0.21406299797348657},
- {0.17341537320350206},
- {0.256783567255177},
- {0.21270759294621003},
- {0.36932631982868214},
- {0.32697440923735227},
- {0.21685729857931468},
- {0.18971848230736016},
- {0.10757576716578146},
- {0.11713250887666501},
- {0.03378565998702602},
- {0.020254238103425},
- {0.1429229242647896},
- {0.13214018594117952},
- {0.03179189640780263},
- {0.05886682553354656},
- {0.11582702947557284},
- {0.2583160734012893},
- {0.15135459785092745},
- {0.06412937860609223},
- {0.35502188195609485},
- {0.1935130114051347},
- {0.3676637729759531},
- {0.2366553559278673},
- {0.31486291443119346},
- {0.011237316243945264},
- {0.057914737106142616},
- {0.29570206187836534},
- {0.37211238260407625},
- {0.1875093663246929},
- {0.19155111757432206},
- {0.2739877144711998},
- {0.24943009385660805},
- {0.009239237591630096},
- {0.27893526931671203},
- {0.2083972175701076},
- {0.31746838445815007},
- {0.10046174911212705},
- {0.2339951521561692},
- {0.30322352256889684},
- {0.252696678249817},
- {0.10502361861821279},
- {0.31433816269974163},
- {0.07631742822040997},
- {0.024875014115884407},
- {0.013373923284147889},
- {0.20827480859690395},
- {0.2741857846107646},
- {0.16974766881515163},
- {0.11660662686127223},
- {0.25951947467052494},
- {0.30131908957574116},
- {0.27734512665212113},
- {0.264646592177704},
- {0.12552115022102528},
- {0.16707676095248683},
- {0.033171859313025166},
- {0.10098810117621518},
- {0.15221418307480392},
- {0.12014624456291258},
- {0.23100308957571766},
- {0.21955389657171315},
- {0.04845352315823766},
- {0.27663707674935434},
- {0.24712903077405476},
- {0.043494474276553174},
- {0.1518503919926439},
- {0.20681617925151563},
- {0.10283320947134508},
- {0.1639716288343391},
- {0.328052353874634},
- {0.3580608503472824},
- {0.30310153268545337},
- {0.2747833396600463},
- {0.12635011570594248},
- {0.08813618835262331},
- {0.040935230079716826},
- {0.11796208775124217},
- {0.10787644381126582},
- {0.12156799205118003},
- {0.31318924433302},
- {0.37517827493999034},
- {0.37081649096479946},
- {0.35981308267107626},
- {0.047231621006279076},
- {0.2506866112064307},
- {0.32339173626409007},
- {0.29866985837427706},
- {0.10212508148858587},
- {0.29333323807366296},
- {0.3862516591270916},
- {0.09966840901818798},
- {0.12490084466860361},
- {0.31544340940217525},
- {0.155194075192249},
- {0.11158272152817666},
- {0.1927064445437257},
- {0.10858495583438521},
- {0.3220655491824185},
- {0.10883326505798312},
- {0.3854710849689023},
- {0.322603516254538},
- {0.13029332147291967},
- {0.11417039715900762},
- {0.7355654770624181},
- {0.4327596054888238},
- {0.3120087902122856},
- {0.6322658463249017},
- {0.24229026576672624},
- {0.3502427082965805},
- {0.1754237571288063},
- {0.8215402096847798},
- {0.08216510653542113},
- {0.6651302618334656},
- {0.7945804480888425},
- {0.2422902835871024},
- {0.6401870225163305},
- {0.4710000017115916},
- {0.1632419088431},
- {0.7168166707612743},
- {0.3073044781999764},
- {0.576123617215899},
- {0.3195716842643862},
- {0.24346556784920745},
- {0.7304009305398214},
- {0.4284903497076483},
- {0.10003485966042577},
- {0.8034026951399672},
- {0.1751209187642159},
- {0.7744195260816722},
- {0.05082775035986864},
- {0.2540716201266174},
- {0.46125597716990474},
- {0.758823756279649},
- {0.24654465433871717},
- {0.20739762770535392},
- {0.5243411296257191},
- {0.3647646689705427},
- {0.33065497840200203},
- {0.13389998946674822},
- {0.1897134148623102},
- {0.5830080161164788},
- {0.036695347493844545},
- {0.18729563839982027},
- {0.7589019534818786},
- {0.27966454045658246},
- {0.06130427153639683},
- {0.4979999468013203},
- {0.09162730647240233},
- {0.04615857031917479},
- {0.627106931430727},
- {0.6679857265053409},
- {0.8335103908938276},
- {0.3569621788292797},
- {0.555982535898724},
- {0.5691096428371402},
- {0.4779030158434612},
- {0.7173369852541983},
- {0.009596565594990213},
- {0.2723357163258638},
- {0.36912733927523717},
- {0.26696651303866387},
- {0.1621203747944606},
- {0.7393662961774305},
- {0.15053951471968552},
- {0.6263276815098645},
- {0.7508656610758231},
- {0.3900631427218701},
- {0.6088897933826048},
- {0.08980645661791647},
- {0.32388170658970916},
- {0.7176990732661757},
- {0.29757819600011964},
- {0.022342281260212073},
- {0.37661634203897054},
- {0.5676456733023287},
- {0.8301063515321443},
- {0.7880684232246156},
- {0.8359150924736213},
- {0.6884083872731305},
- {0.6384710355690885},
- {0.5011159015717553},
- {0.5383546387908295},
- {0.3834411049349285},
- {0.23980846584588827},
- {0.7478070848619371},
- {0.7591335028419856},
- {0.33726525389775547},
- {0.11759015806230327},
- {0.3871316535278288},
- {0.4055028031209437},
- {0.31656937318046224},
- {0.6116421031996467},
- {0.6267861272255976},
- {0.5356886708400135},
- {0.46254997872465514},
- {0.2193381348696345},
- {0.7166340363084747},
- {0.3101492413368842},
- {0.6528675545502696},
- {0.3423953038233516},
- {0.6166805038928471},
- {0.5524704870283378},
- {0.27450115788562574},
- {0.6996000746059089},
- {0.5256147579296286},
- {0.2199266058230415},
- {0.5003283922853162},
- {0.7632716292092983},
- {0.16918209227688946},
- {0.08094840615021184},
- {0.12095295708665067},
- {0.7025921699778928},
- {0.7535347644367453},
- {0.35649624892440734},
- {0.7054091755217458},
- {0.04296140306577826},
- {0.5188521417848975},
- {0.17386599892929286},
- {0.7300319824536277},
- {0.264144933988738},
- {0.047913018540434525},
- {0.7930218262704553},
- {0.035827893017645995},
- {0.45111175442947826},
- {0.8045562815767733},
- {0.025032359943467943},
- {0.4754765831165364},
- {0.5561233779285734},
- {0.45969182139815146},
- {0.6822720397825115},
- {0.30368138560484936},
- {0.0864561208741869},
- {0.24711944450612008},
- {0.7574945022535359},
- {0.1144035673921101},
- {0.39022635357368624},
- {0.4746982338295029},
- {0.02900583599848805},
- {0.14264277981848666},
- {0.7942719606153961},
- {0.7055426997676483},
- {0.14915898553082801},
- {0.6795745016554441},
- {0.5279995284548936},
- {0.5110421000001464},
- {0.25085449179692443},
- {0.7607770216633638},
- {0.07391534132279286},
- {0.7527861161556508},
- {0.814269951904784},
- {0.5939447948697554},
- {0.33625893791587774},
- {0.6718360987440367},
- {0.16270881396825854},
- {0.7558603553785049},
- {0.46747952190869874},
- {0.3787115780132756},
- {0.5607744467323978},
- {0.464519533026256},
- {0.8065499084675807},
- {0.7140600755558364},
- {0.47358182975100743},
- {0.4143149738436979},
- {0.2349283560433446},
- {0.2557987590943292},
- {0.07378250481225626},
- {0.044232032788715826},
- {0.31212092205385444},
- {0.2885731375039427},
- {0.06942844243978699},
- {0.12855577898667747},
- {0.25294779983438365},
- {0.5641211962747706},
- {0.3305343553620534},
- {0.1400483574222907},
- {0.7753112925407027},
- {0.4226016215375511},
- {0.8029191707164404},
- {0.5168176363670052},
- {0.6876104983043578},
- {0.024540510387073246},
- {0.12647656937515586},
- {0.645766245558404},
- {0.8126342261991776},
- {0.40949061609296666},
- {0.41831715762390675},
- {0.5983455664099301},
- {0.5447156310506839},
- {0.0201770245816658},
- {0.6091502388460491},
- {0.4551063591515401},
- {0.6933004302126271},
- {0.2193924727283584},
- {0.5110081746704668},
- {0.6621919187525179},
- {0.5518493315260966},
- {0.2293548697605581},
- {0.6864645240310728},
- {0.16666511819197055},
- {0.05432307225654228},
- {0.0292065201464264},
- {0.45483903743404425},
- {0.5987781200741539},
- {0.37070189530211},
- {0.2546503164607889},
- {0.5667492331393028},
- {0.6580329401640845},
- {0.6056776203195083},
- {0.5779460418531687},
- {0.27411821683457255},
- {0.36486905757433347},
- {0.07244206181955982},
- {0.2205419418734465},
- {0.33241155269789247},
- {0.2623802782317034},
- {0.5044739861471255},
- {0.4794707706338336},
- {0.10581478375637118},
- {0.6041313520098684},
- {0.5396904754661255},
- {0.09498501017439573},
- {0.33161709086762386},
- {0.451653623067809},
- {0.22457136476223521},
- {0.35808794317438075},
- {0.7164141351011619},
- {0.781947915890171},
- {0.661925512260365},
- {0.6000830852077681},
- {0.27592854553330404},
- {0.19247540950091033},
- {0.08939602812279963},
- {0.2576104273384641},
- {0.23558498598785071},
- {0.2654851484913103},
- {0.6839554691553037},
- {0.8193296471592921},
- {0.8098042050852545},
- {0.7857745124377049},
- {0.10314634390817491},
- {0.5474596649824044},
- {0.7062360879234512},
- {0.6522474408147788},
- {0.22302492593831738},
- {0.6405931113400122},
- {0.8435121560221204},
- {0.21765994421415172},
- {0.2727635682225817},
- {0.6888782069418805},
- {0.338919162866817},
- {0.24367890671009035},
- {0.4208402078680781},
- {0.2371322634947996},
- {0.7033399063845096},
- {0.23767453132357888},
- {0.8418075062800393},
- {0.7045147408587431},
- {0.28453987941251296},
- {0.24932997848899477},
- {0.6469949567648979},
- {0.3806503852804886},
- {0.2744393531624865},
- {0.5561337864041552},
- {0.213115738724367},
- {0.30806946897038473},
- {0.1543007246783237},
- {0.7226173454583227},
- {0.07227148528336516},
- {0.5850409493340742},
- {0.6989038483841863},
- {0.2131157543989655},
- {0.5631011621270724},
- {0.414286199184684},
- {0.14358571065074408},
- {0.6305037217892622},
- {0.27030149427442685},
- {0.5067517256253813},
- {0.2810915880251092},
- {0.21414952095552534},
- {0.642452280880431},
- {0.3768951968632846},
- {0.08798951516791709},
- {0.7066637957001032},
- {0.15403435152635436},
- {0.6811705326303492},
- {0.044707506227551895},
- {0.2234784828884231},
- {0.4057154669607601},
- {0.6674526723943405},
- {0.2168578501148976},
- {0.18242457450049857},
- {0.4612044434807839},
- {0.32084281901382955},
- {0.2908403264243298},
- {0.11777689491605604},
- {0.1668697437198318},
- {0.5128071639349948},
- {0.032276806763782084},
- {0.1647430952750692},
- {0.667521453756508},
- {0.24598972206253691},
- {0.05392253408982228},
- {0.43803504119905884},
- {0.08059432781748871},
- {0.04060054901876504},
- {0.5515960640354542},
- {0.5875525833075743},
- {0.7331461795530727},
- {0.3139798381793217},
- {0.48903586151489353},
- {0.5005823142113787},
- {0.42035801123822525},
- {0.6309613844492852},
- {0.008441029025748208},
- {0.2395433724180042},
- {0.32468017377446595},
- {0.23482068279078414},
- {0.14259922216543924},
- {0.6503381136634645},
- {0.13241283047492275},
- {0.5509106447429788},
- {0.6604528231315762},
- {0.34309506635464515},
- {0.535572478356997},
- {0.07899272917044063},
- {0.28488263422695737},
- {0.6312798729115088},
- {0.2617463680108739},
- {0.019652014332849743},
- {0.33126741470736626},
- {0.49929462340013614},
- {0.7301520255745121},
- {0.6931759460058573},
- {0.7352613274809832},
- {0.6055161214731357},
- {0.5615917996904694},
- {0.44077579927545774},
- {0.47353056540892835},
- {0.3372703978713332},
- {0.21093277597998383},
- {0.6577625345753918},
- {0.667725121917811},
- {0.2966546489312249},
- {0.1034309542847692},
- {0.34051656208344133},
- {0.35667561455037794},
- {0.2784507896318843},
- {0.5379933785033608},
- {0.5513138883362131},
- {0.47118561057776465},
- {0.4068536558862559},
- {0.19292730764582955},
- {0.6303430786193777},
- {0.27280371530051484},
- {0.5742548126597469},
- {0.30116698200464237},
- {0.5424250979631701},
- {0.4859467036113355},
- {0.24144806997658225},
- {0.6153602012835626},
- {0.46232471232851907},
- {0.19344491994674598},
- {0.4400831151397551},
- {0.671364970406622},
- {0.14881062786582167},
- {0.07120128957996143},
- {0.10638883373563156},
- {0.6179920140537382},
- {0.6628005358335065},
- {0.31357001157916325},
- {0.620469819819352},
- {0.03778835737385196},
- {0.45637639273411457},
- {0.15293053843335552},
- {0.6421277583756111},
- {0.23233885422168638},
- {0.04214374155084722},
- {0.6975329025099622},
- {0.031513803756130096},
- {0.39679272499145646},
- {0.7076784770984018},
- {0.02201817668772004},
- {0.41822374884255226},
- {0.48915974454890554},
- {0.4043396534846293},
- {0.6001186606036522},
- {0.2671146635842468},
- {0.07604581227825719},
- {0.21736342895336203},
- {0.6662834757993763},
- {0.1006280656811295},
- {0.3432386247478912},
- {0.4175391217372626},
- {0.025513200650360335},
- {0.12546695303055289},
- {0.6986325063408618},
- {0.6205872662145385},
- {0.13119853283492933},
- {0.5977459370075642},
- {0.4644223291294733},
- {0.4495067695606111},
- {0.22064873370975116},
- {0.6691707422221062},
- {0.06501508642628279},
- {0.6621420333923734},
- {0.7162225101041358},
- {0.5224270290826667},
- {0.2957695049359045},
- {0.5909393265653636},
- {0.14311680651337608},
- {0.6648460989515931},
- {0.41118962552959515},
- {0.33311036023822715},
- {0.49325077132147616},
- {0.40858605325936187},
- {0.7094320484448637},
- {0.6280790522644181},
- {0.4165571455148562},
- {0.3644266988434346},
- {0.20664028737201623},
- {0.22499765451431883},
- {0.0648982449552357},
- {0.03890598870415761},
- {0.27453798304418997},
- {0.25382562184471724},
- {0.06106846163305243},
- {0.11307618867532192},
- {0.22248998344947568},
- {0.4961945338320795},
- {0.29073422778192465},
- {0.12318492884861283},
- {0.6819549201792443},
- {0.37171553910796423},
- {0.7062384931631437},
- {0.4545868651041011},
- {0.6048143074879064},
- {0.02158555145937831},
- {0.11124733974934463},
- {0.5680085827217746},
- {0.7147837445350874},
- {0.360183249100771},
- {0.3679469737918763},
- {0.5262978972530145},
- {0.47912562124077934},
- {0.01774747939366842},
- {0.5358015631993602},
- {0.40030633348728306},
- {0.6098191063314953},
- {0.19297510260311354},
- {0.4494769292297449},
- {0.582456416462561},
- {0.4854003423561529},
- {0.20173791276498285},
- {0.6038063216613302},
- {0.14659672633015686},
- {0.0477819512768889},
- {0.02568972012506069},
- {0.40007120037072585},
- {0.5266783664947203},
- {0.3260651351957102},
- {0.22398749754637387},
- {0.49850612491481366},
- {0.5787982265992251},
- {0.5327470877739868},
- {0.5083547094333034},
- {0.24111123942036974},
- {0.32093463803239747},
- {0.06371920667360105},
- {0.19398616247884198},
- {0.2923853890272713},
- {0.230786683258216},
- {0.44372953195107384},
- {0.4217369903698531},
- {0.0930734701075849},
- {0.5313870079043637},
- {0.4747055520266115},
- {0.0835477254812513},
- {0.29168658951376125},
- {0.3972693464305555},
- {0.1975303966347608},
- {0.31497004758487307},
- {0.6301496560396692},
- {0.6877924179560598},
- {0.5822220883677179},
- {0.5278261988584336},
- {0.24270358377949286},
- {0.16929916252415442},
- {0.07863172097370782},
- {0.22659117712221435},
- {0.2072178515397269},
- {0.23351769152602855},
- {0.601599385771201},
- {0.720672960015825},
- {0.7122944904233274},
- {0.6911582483886078},
- {0.09072634102383784},
- {0.48153924201333814},
- {0.621197162483293},
- {0.5737093677306491},
- {0.1961701667827345},
- {0.5634583531985863},
- {0.7419436174407176},
- {0.19145119039393846},
- {0.23991970603894067},
- {0.6059293694649857},
- {0.2981094082902483},
- {0.21433717137058347},
- {0.3701662198475266},
- {0.20857881908772774},
- {0.6186497144205398},
- {0.2090557916501666},
- {0.7404442270797376},
- {0.619683085348847},
- {0.25027801428854474},
- {0.21930778929010467},
- {0.7221881420295327},
- {0.42488923852374666},
- {0.30633445359640227},
- {0.6207671663026726},
- {0.2378838625824543},
- {0.3438730319077158},
- {0.17223341929346986},
- {0.8065992982762804},
- {0.08067081378730759},
- {0.6530338943032885},
- {0.7801298394127605},
- {0.23788388007874087},
- {0.6285442843088391},
- {0.4624341771591013},
- {0.1602731157524795},
- {0.7037803102183265},
- {0.3017156963849236},
- {0.5656459658195422},
- {0.313759805348452},
- {0.23903779007597986},
- {0.7171175203460973},
- {0.4206976254089371},
- {0.09821557929127432},
- {0.7887916409859148},
- {0.1719360884878803},
- {0.7603355732869114},
- {0.04990337331019081},
- {0.24945095576597429},
- {0.4528673619684886},
- {0.7450234353901954},
- {0.2420608788700432},
- {0.20362579822537316},
- {0.5148052185732628},
- {0.3581308894673696},
- {0.32464153355676534},
- {0.1314648221351464},
- {0.18626319868171784},
- {0.5724051618476859},
- {0.03602798887944392},
- {0.18388939302370683},
- {0.7451002104618255},
- {0.27457843137293364},
- {0.06018936361200036},
- {0.4889430887207513},
- {0.08996092976622885},
- {0.04531910914399215},
- {0.615702073828252},
- {0.6558374281698428},
- {0.8183517842162717},
- {0.35047029903179594},
- {0.5458711795516952},
- {0.5587595508329826},
- {0.4692116498733019},
- {0.7042911620304814},
- {0.00942203800073452},
- {0.2673828926380784},
- {0.3624142182258335},
- {0.26211133617291177},
- {0.15917197844238654},
- {0.7259198376847221},
- {0.1478017332618938},
- {0.6149369957079848},
- {0.73721006979792},
- {0.38296927343777937},
- {0.5978162411045495},
- {0.08817319473198351},
- {0.3179914436081235},
- {0.7046466649418814},
- {0.2921663008656809},
- {0.021935954167469178},
- {0.36976702251076826},
- {0.5573222057273426},
- {0.8150096522937307},
- {0.7737362452539809},
- {0.8207127527774692},
- {0.6758886729537763},
- {0.626859505096355},
- {0.49200237529207796},
- {0.5285638715591018},
- {0.37646766710233837},
- {0.2354471978264126},
- {0.7342071182700921},
- {0.7453275487578418},
- {0.33113159151550287},
- {0.11545160889160057},
- {0.380091097666291},
- {0.39812814100957505},
- {0.3108120956868283},
- {0.6005184961383192},
- {0.6153871039172347},
- {0.5259463881383204},
- {0.45413783021060977},
- {0.21534914978654268},
- {0.7036009972404192},
- {0.30450872333959017},
- {0.6409942023040515},
- {0.33616834397305556},
- {0.6054652661389371},
- {0.5424230024314876},
- {0.2695089524729737},
- {0.6868768230683158},
- {0.516055684081935},
- {0.2159269185341688},
- {0.49122918801488846},
- {0.7493904172391468},
- {0.16610526825438246},
- {0.07947624087979423},
- {0.11875325049271407},
- {0.6898145028056762},
- {0.7398306316067847},
- {0.3500128427443427},
- {0.6925802769797537},
- {0.04218008705759783},
- {0.509416056011941},
- {0.17070399120729768},
- {0.7167552821209733},
- {0.25934107166866494},
- {0.0470416501559204},
- {0.778599563413888},
- {0.0351763103328067},
- {0.44290762676925133},
- {0.7899242477645724},
- {0.024577109831724137},
- {0.46682934537769716},
- {0.5460094601630456},
- {0.45133165265929354},
- {0.669863923925592},
- {0.29815849503267233},
- {0.08488378974848415},
- {0.24262521563678674},
- {0.7437183557945112},
- {0.11232297103776044},
- {0.3831295160613224},
- {0.46606515151191424},
- {0.028478322407705738},
- {0.1400486120453136},
- {0.7798269622356295},
- {0.6927113728917712},
- {0.14644631101736405},
- {0.6672154444784314},
- {0.5183970840640086},
- {0.5017480512705713},
- {0.2462923356246781},
- {0.7469411777834207},
- {0.07257108263233074},
- {0.7390955985906671},
- {0.7994612607773218},
- {0.5831430392684156},
- {0.33014357686295387},
- {0.659617775752618},
- {0.15974971598836232},
- {0.7421139282727152},
- {0.45897772243523727},
- {0.3718241535515558},
- {0.5505759424717314},
- {0.4560715652839032},
- {0.7918816176317965},
- {0.7010738477322224},
- {0.46496905087594814},
- {0.4067800495071416},
- {0.2306558399648744},
- {0.25114668418310987},
- {0.07244066194820452},
- {0.04342760851888293},
- {0.30644454615627653},
- {0.28332501254122977},
- {0.06816578457411664},
- {0.126217803946323},
- {0.24834757379097372},
- {0.5538618264741957},
- {0.32452310422338454},
- {0.13750137301850213},
- {0.7612111216673813},
- {0.4149159923814281},
- {0.7883169101618863},
- {0.5074185510534911},
- {0.6751052947639719},
- {0.02409420527955659},
- {0.12417640780544989},
- {0.6340220410121782},
- {0.7978552831382956},
- {0.4020434297647353},
- {0.41070944771630263},
- {0.5874637763356143},
- {0.5348091798625237},
- {0.019810075851453977},
- {0.5980719499859614},
- {0.4468295837565331},
- {0.6806917469307024},
- {0.2154024994317577},
- {0.5017147429226769},
- {0.650148989292861},
- {0.5418131435513964},
- {0.22518371568945642},
- {0.6739801617104978},
- {0.16363406902792688},
- {0.05333512766119018},
- {0.028675356820621882},
- {0.4465671236758161},
- {0.5878884633782164},
- {0.3639601386462833},
- {0.2500191276601253},
- {0.5564420686410267},
- {0.6460656478186031},
- {0.5946624861110723},
- {0.567435246996841},
- {0.26913297576554124},
- {0.35823337961158047},
- {0.07112459687367437},
- {0.21653106379767478},
- {0.3263661619775447},
- {0.25760850875994323},
- {0.49529938818337055},
- {0.47075089274769366},
- {0.10389038700600388},
- {0.5931443389543057},
- {0.5298754140888567},
- {0.09325756871088467},
- {0.32558614859871343},
- {0.44343964073312436},
- {0.22048720573234942},
- {0.3515755897042165},
- {0.7033850952584862},
- {0.7677270483055417},
- {0.6498874277927742},
- {0.5891696958104696},
- {0.2709103809866521},
- {0.18897496240438763},
- {0.08777023047989795},
- {0.25292540458803},
- {0.231300528132565},
- {0.2606569124084983},
- {0.6715167376707802},
- {0.8044289380664761},
- {0.7950767301013442},
- {0.7714840525929053},
- {0.10127047664291475},
- {0.5375033095200622},
- {0.693392150768874},
- {0.6403853662446574},
- {0.21896889116235665},
- {0.6289429878127676},
- {0.8281716526036031},
- {0.21370147948492033},
- {0.26780296342169985},
- {0.6763499482640567},
- {0.33275542172871886},
- {0.23924724905735975},
- {0.4131866125981594},
- {0.23281966613291008},
- {0.6905486405310887},
- {0.23335207202736896},
- {0.826498004412607},
- {0.691702108920507},
- {0.27936510515268864},
- {0.24479554782306734},
- {0.5939413449169795},
- {0.3494370387477582},
- {0.2519353154319929},
- {0.5105307940919283},
- {0.19564023978462255},
- {0.28280776042373185},
- {0.14164805919872092},
- {0.663362694769523},
- {0.0663452206536248},
- {0.5370675685270484},
- {0.6415937053861709},
- {0.19564025417390335},
- {0.5169268447321114},
- {0.3803147145916744},
- {0.13181167674194466},
- {0.5788023918565922},
- {0.2481367611351564},
- {0.46519806423515625},
- {0.2580420667747942},
- {0.19658925183225215},
- {0.5897711686333295},
- {0.3459897759281482},
- {0.08077437147074373},
- {0.648717336717621},
- {0.14140352865566766},
- {0.6253145222201439},
- {0.04104148896221666},
- {0.20515323852051004},
- {0.37244678274649556},
- {0.6127215270618853},
- {0.19907549789425963},
- {0.16746575223167526},
- {0.4233856610140513},
- {0.29453369526228695},
- {0.26699140824266115},
- {0.10811918491044303},
- {0.15318641818551768},
- {0.47075695636571824},
- {0.0296301073423549},
- {0.15123415499669213},
- {0.6127846683496555},
- {0.22581855519882757},
- {0.04950088417811034},
- {0.4021161506287782},
- {0.07398558977329608},
- {0.037271302405739795},
- {0.506365165135557},
- {0.539373248416145},
- {0.6730281640552689},
- {0.28823347912556635},
- {0.44893490167703903},
- {0.45953454479923833},
- {0.38588863781851934},
- {0.5792225261605312},
- {0.007748864314344147},
- {0.21990080647815224},
- {0.298056386781943},
- {0.21556537758571992},
- {0.13090608035115248},
- {0.5970103628186517},
- {0.12155497317905285},
- {0.5057359502519657},
- {0.6062956657133971},
- {0.31496125744780157},
- {0.4916555141116252},
- {0.07251532227816535},
- {0.2615222470393002},
- {0.5795148985563524},
- {0.2402831555609856},
- {0.018040548386255666},
- {0.3041034736998101},
- {0.45835244468505687},
- {0.6702795308204644},
- {0.6363354912276731},
- {0.6749698697700756},
- {0.5558637757470991},
- {0.515541250074549},
- {0.40463216643534333},
- {0.4347010404603134},
- {0.30961421200872724},
- {0.19363628007095554},
- {0.603825980924408},
- {0.6129716357137381},
- {0.2723289560757909},
- {0.09494961197396982},
- {0.31259419062803734},
- {0.3274282001584762},
- {0.25561781395345956},
- {0.493877900350972},
- {0.5061061278547283},
- {0.4325483720173397},
- {0.3734916401354291},
- {0.1771072608468788},
- {0.5786549214329433},
- {0.2504337999388982},
- {0.5271658954833491},
- {0.2764712776600885},
- {0.4979462186411412},
- {0.44609905484281576},
- {0.2216493187621715},
- {0.5649006406267116},
- {0.42441406777230395},
- {0.17758242891880488},
- {0.40399628242595476},
- {0.6163130164836103},
- {0.13660815054031883},
- {0.06536278103990312},
- {0.09766494519377089},
- {0.5673166446464396},
- {0.6084508658816263},
- {0.28785725832270576},
- {0.5695912702420244},
- {0.03468971058608222},
- {0.4189535106180997},
- {0.14039022827961709},
- {0.5894732569866415},
- {0.21328705905669473},
- {0.038687953089624166},
- {0.64033517712744},
- {0.02892967061127664},
- {0.36425570596887374},
- {0.6496488142014349},
- {0.020212685335159682},
- {0.38392938502305685},
- {0.44904862629739994},
- {0.37118378602940527},
- {0.5509089068807522},
- {0.2452112506866475},
- {0.06981005268680125},
- {0.19953961924812705},
- {0.6116482046335966},
- {0.09237656034583608},
- {0.31509304404716704},
- {0.38330089736727113},
- {0.023421117195691104},
- {0.11517865795773244},
- {0.6413446134010486},
- {0.5696990860281961},
- {0.12044024799319751},
- {0.548730746712668},
- {0.42633967991325283},
- {0.41264719681444184},
- {0.20255552888555095},
- {0.6142987150963435},
- {0.05968384678762163},
- {0.607846360666511},
- {0.6574922361653635},
- {0.47958799219372145},
- {0.2715163939228268},
- {0.542482278593873},
- {0.13138122276224437},
- {0.6103286927437457},
- {0.37747206009783685},
- {0.30579529762480867},
- {0.4528041887140555},
- {0.37508198085594746},
- {0.651258592628663},
- {0.5765765453279486},
- {0.38239944323364256},
- {0.3345436952352884},
- {0.18969577569731247},
- {0.20654783801345805},
- {0.059576586321786196},
- {0.035715696103438124},
- {0.2520258576595256},
- {0.23301191089132645},
- {0.05606084538233293},
- {0.10380393676594196},
- {0.20424579607435286},
- {0.4555065625832529},
- {0.2668940096930974},
- {0.11308375984827615},
- {0.6260345899592441},
- {0.34123485031205486},
- {0.6483269090053844},
- {0.4173107243239826},
- {0.5552195105362033},
- {0.019815535392521608},
- {0.1021250535236733},
- {0.521431856645442},
- {0.6561714494294455},
- {0.3306482085380697},
- {0.33777530749979445},
- {0.48314144902217726},
- {0.4398373014943584},
- {0.01629218538683622},
- {0.4918658139879237},
- {0.36748119843014077},
- {0.5598139156781902},
- {0.17715113661578968},
- {0.41261980339187787},
- {0.5346949674524367},
- {0.4455974952320017},
- {0.18519539600046375},
- {0.5542941795869677},
- {0.13457578901746955},
- {0.04386382939684251},
- {0.02358316206653801},
- {0.36726534623836976},
- {0.48349071977113056},
- {0.2993277813122884},
- {0.2056205139565311},
- {0.45762860310647774},
- {0.5313367493014706},
- {0.4890618056673126},
- {0.46666960330791496},
- {0.22134010832478831},
- {0.2946179851177286},
- {0.05849422922552037},
- {0.1780792895420264},
- {0.26840977565152097},
- {0.21186216617314838},
- {0.40734369291563116},
- {0.3871545406072317},
- {0.08544144190582419},
- {0.4878132524003788},
- {0.4357796781292308},
- {0.07669680871271548},
- {0.2677682777255452},
- {0.3646932444312602},
- {0.1813328963580561},
- {0.2891424913209989},
- {0.5784773595123623},
- {0.6313934126892512},
- {0.5344798542705677},
- {0.48454442983596935},
- {0.22280188038396717},
- {0.15541662455253627},
- {0.07218391676773345},
- {0.2080106917049637},
- {0.1902259795806027},
- {0.21436923165581398},
- {0.5522682125264468},
- {0.6615777490096232},
- {0.6538863142525478},
- {0.6344832448942286},
- {0.0832867774990643},
- {0.4420530052688378},
- {0.5702589707789756},
- {0.5266651770598448},
- {0.18008420540728212},
- {0.5172547461217422},
- {0.6811042116908459},
- {0.1757521852675773},
- {0.22024628072740163},
- {0.5562431373873983},
- {0.2736644251102781},
- {0.19676151490591062},
- {0.33981257529178066},
- {0.1914753477362523},
- {0.5679204135573501},
- {0.19191320852985103},
- {0.6797277713983142},
- {0.5688690480289784},
- {0.22975520729399623},
- {0.20132454196094474},
- {0.5029517376494571},
- {0.29590458273591275},
- {0.2133397611669827},
- {0.4323193733010519},
- {0.1656688819458869},
- {0.2394826622917609},
- {0.11994810281919},
- {0.561737994637827},
- {0.05618137935344684},
- {0.45479081248941305},
- {0.5433039335458855},
- {0.1656688941307833},
- {0.43773557274752023},
- {0.32205191336574973},
- {0.11161861760796637},
- {0.4901320159495312},
- {0.21012313127499097},
- {0.39393144922574796},
- {0.21851098089354407},
- {0.1664725088738494},
- {0.4994204168782797},
- {0.2929854277720509},
- {0.06840003787652112},
- {0.549336251025026},
- {0.11974103344678556},
- {0.5295186607560084},
- {0.03475408534179951},
- {0.17372452462073804},
- {0.3153893194461543},
- {0.518854865667046},
- {0.1685778712767405},
- {0.14181062120446877},
- {0.3585245508252098},
- {0.24941222748045802},
- {0.22608931649958136},
- {0.09155572749620804},
- {0.12971882807968493},
- {0.3986387397358283},
- {0.025090884987406276},
- {0.12806564435780388},
- {0.5189083339441296},
- {0.19122399156538877},
- {0.041917532641283166},
- {0.3405134504046429},
- {0.06265127231157902},
- {0.03156147735774392},
- {0.42879190322350963},
- {0.4567432707861943},
- {0.5699227499407986},
- {0.24407718104759235},
- {0.38015974274617303},
- {0.3891355599247522},
- {0.32677193226401013},
- {0.49048778723910486},
- {0.006561767092092266},
- {0.1862128199614781},
- {0.2523952557477724},
- {0.18254156266719207},
- {0.11085175521952348},
- {0.50555059341145},
- {0.10293320292239186},
- {0.4282590817222529},
- {0.5134134224020239},
- {0.2667103630372326},
- {0.41633571608311504},
- {0.06140624433396133},
- {0.22145801047204783},
- {0.4907353692701884},
- {0.20347266889491405},
- {0.015276803402673851},
- {0.2575159514176178},
- {0.3881345531560008},
- {0.5675951971050903},
- {0.5388512582597104},
- {0.5715669935544545},
- {0.4707075106001755},
- {0.43656224604335525},
- {0.34264402193783416},
- {0.36810645618230525},
- {0.26218246509261495},
- {0.163971921414693},
- {0.5113220841466578},
- {0.5190666586027073},
- {0.23060917183619703},
- {0.08040368420239372},
- {0.2647059220594805},
- {0.27726741644523617},
- {0.216458114597189},
- {0.41821764100781267},
- {0.42857254949165763},
- {0.366283568546611},
- {0.31627410856524396},
- {0.14997508652259992},
- {0.4900071374468627},
- {0.21206827226858802},
- {0.4464060389665976},
- {0.23411690514446934},
- {0.4216627080516597},
- {0.37775833711043694},
- {0.18769346666013792},
- {0.4783599613564699},
- {0.35939540948911697},
- {0.15037746061138163},
- {0.34210555299607326},
- {0.5218961522534491},
- {0.1156802894416044},
- {0.05534944583831826},
- {0.08270303846167185},
- {0.4804058425369762},
- {0.5152384539120711},
- {0.24375859587389131},
- {0.48233200394263015},
- {0.029375375813020018},
- {0.35477138940237746},
- {0.1188829669234545},
- {0.4991681441889813},
- {0.1806122740717798},
- {0.03276110242038631},
- {0.5422382071403629},
- {0.024497752561074584},
- {0.3084530851971295},
- {0.5501250296192003},
- {0.01711617704152462},
- {0.32511282971725924},
- {0.3802560451772355},
- {0.3143198091334905},
- {0.4665117092344654},
- {0.20764579815753498},
- {0.05911541199263478},
- {0.16897089096362639},
- {0.5179459722468693},
- {0.07822481452358306},
- {0.266821960419225},
- {0.3245806240352102},
- {0.019833089061868512},
- {0.09753371550194287},
- {0.5430930015273892},
- {0.4824233027509472},
- {0.10198924949327685},
- {0.4646672351112337},
- {0.36102602500463477},
- {0.3494311794424936},
- {0.17152477445013148},
- {0.5201904343546266},
- {0.050540503213552454},
- {0.514726556649888},
- {0.556766868480287},
- {0.4061168936864675},
- {0.2299210911860133},
- {0.4593760090922159},
- {0.11125410757861548},
- {0.5168286046759312},
- {0.3196447429785586},
- {0.25894859420323474},
- {0.3834362693853548},
- {0.31762081499624883},
- {0.5514881959724672},
- {0.4882471608390004},
- {0.3238172693255239},
- {0.28329284411371936},
- {0.1606350876702496},
- {0.17490547665296485},
- {0.050449674652559506},
- {0.030244184161139744},
- {0.2134164326616647},
- {0.1973153518925245},
- {0.04747253216238563},
- {0.08790155933425127},
- {0.1729560989857531},
- {0.38572464961839165},
- {0.22600683904592897},
- {0.09575974799931534},
- {0.5301284167928715},
- {0.2889589390935394},
- {0.5490056353876799},
- {0.35338027186478893},
- {0.4701619444258382},
- {0.016779868994498324},
- {0.08647987476685076},
- {0.44155043357398427},
- {0.5556484213649626},
- {0.27999413150493413},
- {0.28602938538627515},
- {0.4091259741315811},
- {0.37245586110958},
- {0.0137962831187678},
- {0.4165137987997283},
- {0.3111844441975645},
- {0.4740525037704665},
- {0.1500122406867329},
- {0.34940798259048683},
- {0.4527816850840937},
- {0.37733361456846776},
- {0.15682414942191333},
- {0.4693783707399822},
- {0.11395927815286877},
- {0.037144053708173815},
- {0.019970309260575213},
- {0.31100165975957955},
- {0.4094217378995012},
- {0.2534718773599024},
- {0.1741202151961105},
- {0.3875216014178453},
- {0.4499379334764827},
- {0.41413935413561426},
- {0.3951775539800256},
- {0.18743162611289843},
- {0.24948360444322282},
- {0.04953313064197171},
- {0.15079820403319844},
- {0.22729039529131143},
- {0.17940566948383993},
- {0.3449401526359486},
- {0.3278439034489209},
- {0.07235213046132716},
- {0.4130820745902072},
- {0.36901985056799497},
- {0.06494714258294346},
- {0.2267471724641261},
- {0.30882359439274126},
- {0.15355337037370467},
- {0.244846935952096},
- {0.48985677735278804},
- {0.5346662877912093},
- {0.45259952644243956},
- {0.4103140234974393},
- {0.18866946012378746},
- {0.13160737511755052},
- {0.06112560891639897},
- {0.17614422659412704},
- {0.1610840662885786},
- {0.18152866184949834},
- {0.46766277430570463},
- {0.5602264959364239},
- {0.5537133604068049},
- {0.537282769182576},
- {0.07052755263608282},
- {0.3743321272981995},
- {0.48289741523814467},
- {0.4459820287451678},
- {0.1524959742371102},
- {0.43801324086256876},
- {0.576761577084952},
- {0.14882760348729898},
- {0.18650536883934313},
- {0.47102875544668926},
- {0.23174005197650158},
- {0.16661838188466244},
- {0.28775455132194505},
- {0.16214203588477788},
- {0.4809171162940231},
- {0.1625128180316578},
- {0.5755960023311077},
- {0.48172042348922484},
- {0.194557563186107},
- {0.17048237014867473},
- {0.36617588156462477},
- {0.21543443104247573},
- {0.1553228058882932},
- {0.3147517262308631},
- {0.12061584512636063},
- {0.17435624219922313},
- {0.08732866198472823},
- {0.40897543441477124},
- {0.04090306200831398},
- {0.33111214103583},
- {0.3955544477358019},
- {0.12061585399761977},
- {0.3186950103644645},
- {0.23447109227102372},
- {0.08126434932432519},
- {0.3568424355429008},
- {0.15298092654243015},
- {0.2868032554582908},
- {0.1590877316264716},
- {0.12120092869754187},
- {0.3636048903547791},
- {0.21330912942345462},
- {0.049798901750580084},
- {0.3999462988925853},
- {0.0871779043586793},
- {0.3855180286550505},
- {0.025302840979297643},
- {0.12648078571055868},
- {0.22962036600965957},
- {0.37775421301386297},
- {0.1227337456184946},
- {0.10324574973626095},
- {0.26102513150572476},
- {0.18158549903312385},
- {0.1646051670255464},
- {0.06665748762474868},
- {0.09444227481865208},
- {0.2902304158064489},
- {0.01826751205282374},
- {0.09323866826670496},
- {0.37779314079168186},
- {0.13922133764764058},
- {0.03051821540506088},
- {0.24791208291527184},
- {0.045613491618607956},
- {0.02297845087277292},
- {0.31218353853282765},
- {0.3325336355541377},
- {0.41493437592765503},
- {0.17770129865264048},
- {0.2767767133801673},
- {0.2833115904311735},
- {0.23790751956949507},
- {0.35710145615232114},
- {0.004777318914927947},
- {0.13557293553989694},
- {0.18375730384807676},
- {0.13290006302439786},
- {0.08070603231275827},
- {0.3680679881594932},
- {0.07494090088748685},
- {0.3117956158588727},
- {0.37379255002435746},
- {0.19417947090511495},
- {0.303114765198065},
- {0.04470704437297873},
- {0.16123332746226482},
- {0.35728170917006646},
- {0.14813903269349324},
- {0.01112233348592666},
- {0.18748544535901568},
- {0.28258280373344236},
- {0.41323979243642994},
- {0.3923126609475583},
- {0.41613147360058733},
- {0.34270035224182965},
- {0.3178407654974145},
- {0.24946325343721673},
- {0.26800127330732376},
- {0.1908829179808648},
- {0.11938036670571864},
- {0.372269943436124},
- {0.3779084096476938},
- {0.16789586449915436},
- {0.058538201063688074},
- {0.19272013020275874},
- {0.20186557286882834},
- {0.157593134690958},
- {0.30448490763272523},
- {0.31202383723323424},
- {0.2666741131903051},
- {0.23026454001568963},
- {0.10918991905028401},
- {0.3567515172849844},
- {0.1543970936709635},
- {0.3250075755147211},
- {0.17044968276898095},
- {0.30699310149586906},
- {0.27502836108344497},
- {0.13665092587094016},
- {0.34827174745146106},
- {0.26165916339209366},
- {0.10948286900084388},
- {0.2490712191232168},
- {0.3799684330145164},
- {0.08422146459598015},
- {0.04029736972115921},
- {0.06021225447655723},
- {0.34976125884742426},
- {0.37512127099706544},
- {0.17746935153306476},
- {0.3511636078164275},
- {0.021386851519582126},
- {0.2582926283850817},
- {0.08655318583779242},
- {0.36342122228588997},
- {0.13149543729327043},
- {0.023851842357437113},
- {0.3947785416660213},
- {0.01783567978575253},
- {0.22457041488960672},
- {0.4005205720791756},
- {0.01246149629880543},
- {0.2366996037951071},
- {0.27684682672296224},
- {0.22884170505222376},
- {0.33964558346592416},
- {0.15117729496049506},
- {0.04303919537414168},
- {0.12301988506199323},
- {0.3770924897818549},
- {0.05695186689734903},
- {0.19426071979377046},
- {0.23631212947061467},
- {0.014439554191263384},
- {0.0710097840065307},
- {0.39540087789591216},
- {0.35123007825308916},
- {0.0742536520856882},
- {0.33830270722643846},
- {0.2628463390775346},
- {0.25440466867956507},
- {0.12487924942457572},
- {0.37872657875983007},
- {0.03679620117316498},
- {0.3747485822931224},
- {0.40535618754306674},
- {0.295674913579036},
- {0.16739490482488004},
- {0.3344504104610937},
- {0.0809989664429368},
- {0.37627898616969485},
- {0.23271854292558272},
- {0.1885284862627855},
- {0.27916220077539844},
- {0.23124501463714459},
- {0.4015130304081985},
- {0.3554701597755561},
- {0.23575636623760104},
- {0.20625240787336005},
- {0.11695097249840057},
- {0.12734058222603983},
- {0.036730073101815086},
- {0.022019390665922997},
- {0.15537862685490778},
- {0.14365617516931012},
- {0.03456255344878084},
- {0.06399705691554514},
- {0.12592133057153782},
- {0.2808282645076831},
- {0.1645451190089285},
- {0.0697182403741785},
- {0.38596196380354253},
- {0.21037762937863017},
- {0.3997055929492476},
- {0.2572798200924469},
- {0.34230315076127915},
- {0.012216645975447046},
- {0.06296199418326855},
- {0.3214724339651966},
- {0.4045418979646047},
- {0.2038507679005161},
- {0.20824475691583322},
- {0.2978656857788456},
- {0.2711678737270173},
- {0.010044435191614659},
- {0.3032444189816508},
- {0.226558990959605},
- {0.34513568694945645},
- {0.10921696927754593},
- {0.2543877801252621},
- {0.3296493883624687},
- {0.2747191402584951},
- {0.11417640474525069},
- {0.3417326670275314},
- {0.08296847593193726},
- {0.02704286632956024},
- {0.014539457866842131},
- {0.226425914070303},
- {0.2980810176891382},
- {0.18454114221351453},
- {0.126768869704345},
- {0.28213654194274923},
- {0.32757898443716493},
- {0.30151569572050485},
- {0.2877104866551686},
- {0.13646029188752284},
- {0.18163746529610159},
- {0.036062779829028585},
- {0.10978919281258039},
- {0.16547961690307492},
- {0.1306169643392775},
- {0.25113495992440193},
- {0.2386879721741149},
- {0.05267623744292638},
- {0.3007459394186199},
- {0.26866627348399924},
- {0.04728500850113004},
- {0.16508412150512633},
- {0.22484016548628424},
- {0.11179510190498561},
- {0.17826172157127404},
- {0.3566420470597551},
- {0.38926577764661346},
- {0.32951676708651073},
- {0.2987306495344508},
- {0.1373615015389425},
- {0.09581723850741199},
- {0.04450272671438109},
- {0.12824245872389844},
- {0.11727785304987981},
- {0.13216261682013591},
- {0.3404836206683984},
- {0.4078749821684847},
- {0.4031330696433303},
- {0.3911707166464443},
- {0.05134784677712501},
- {0.2725338962978479},
- {0.3515752576111955},
- {0.3246988732973869},
- {0.11102526071845338},
- {0.3188971676674405},
- {0.4199134094430414},
- {0.10835448976238558},
- {0.13578592683753837},
- {0.34293423574608},
- {0.16871920598765436},
- {0.12130713208512847},
- {0.20950077038601525},
- {0.1180481117458083},
- {0.3501334936061358},
- {0.11831806106567087},
- {0.41906480841222865},
- {0.35071834439469246},
- {0.1416483568536585},
- {0.12412032309932516},
- {0.03391246259586418},
- {0.019951920518008915},
- {0.014384832836244022},
- {0.029149943183530015},
- {0.011170534549786722},
- {0.016147566892367973},
- {0.008087725413398902},
- {0.03787623603978541},
- {0.0037881346922310983},
- {0.03066512204445219},
- {0.03663328495626405},
- {0.011170535371376179},
- {0.029515140572047866},
- {0.021714953241804887},
- {0.007526094277599347},
- {0.0330480688576699},
- {0.014167945543227178},
- {0.02656156552840805},
- {0.01473351200846757},
- {0.011224720600048572},
- {0.03367435668111731},
- {0.01975509102898845},
- {0.0046120006203456436},
- {0.0370400252567028},
- {0.008073763373265127},
- {0.035703787128012546},
- {0.002343359274819119},
- {0.011713701339851458},
- {0.021265715372291473},
- {0.034984760778139494},
- {0.011366678601968322},
- {0.009561846649080769},
- {0.024174189110830798},
- {0.01681708641650486},
- {0.015244495475747619},
- {0.006173316347733351},
- {0.008746534857978137},
- {0.026878963404588025},
- {0.00169179989835445},
- {0.008635065850247106},
- {0.0349883659768314},
- {0.01289363566313567},
- {0.002826368121227557},
- {0.02295975694249313},
- {0.00422437933862066},
- {0.0021280917039214853},
- {0.02891209690901121},
- {0.0307967702007326},
- {0.03842810849054088},
- {0.016457360921873297},
- {0.025632982434029093},
- {0.02623819371286562},
- {0.022033209353389475},
- {0.03307205740298586},
- {0.0004424394318892789},
- {0.012555748035242589},
- {0.01701822268260165},
- {0.012308206638419656},
- {0.0074743871452494625},
- {0.03408769531149714},
- {0.006940463930579045},
- {0.028876170421678473},
- {0.034617861277891245},
- {0.017983445594005436},
- {0.028072215169145084},
- {0.004140430996143331},
- {0.014932220995570364},
- {0.0330887510849836},
- {0.013719525665479881},
- {0.0010300670724367402},
- {0.017363495175704097},
- {0.026170698957281045},
- {0.038271168882677606},
- {0.03633305498827618},
- {0.03853897469473611},
- {0.03173833521566724},
- {0.029436026822180564},
- {0.02310341471722284},
- {0.0248202670198927},
- {0.01767814359743145},
- {0.01105611380872373},
- {0.034476848880376006},
- {0.034999041313369866},
- {0.015549255184418765},
- {0.005421368948492976},
- {0.017848292408132536},
- {0.018695274686185627},
- {0.014595093654820339},
- {0.02819910748075196},
- {0.028897306572941473},
- {0.024697355408033368},
- {0.02132537393525138},
- {0.01011235100961909},
- {0.03303964869081539},
- {0.014299100316640084},
- {0.030099762990726333},
- {0.015785770670316064},
- {0.0284313975764393},
- {0.025471063162848133},
- {0.012655583411139008},
- {0.0322543160357204},
- {0.024232908386767806},
- {0.010139481835926854},
- {0.023067107440640312},
- {0.03518982522047886},
- {0.007799960105717683},
- {0.0037320400173306858},
- {0.0055764072145437805},
- {0.032392263404853176},
- {0.03474091744449283},
- {0.01643587972004422},
- {0.03252213844401322},
- {0.001980689714194429},
- {0.023921125174790173},
- {0.008015906631357398},
- {0.033657346722707045},
- {0.012178120742635063},
- {0.0022089786698479765},
- {0.03656142635799453},
- {0.0016518068339773924},
- {0.02079802679122497},
- {0.0370932101302582},
- {0.0011540902839259125},
- {0.02192134125780968},
- {0.025639475805752116},
- {0.021193601636998283},
- {0.031455425452716006},
- {0.014000906719430975},
- {0.00398596733636614},
- {0.011393178690213857},
- {0.034923476937547916},
- {0.005274454580865463},
- {0.0179909702564319},
- {0.021885456293240034},
- {0.0013372831638168712},
- {0.006576393381705749},
- {0.03661906246998543},
- {0.03252829443710427},
- {0.0068768161032413625},
- {0.031331058331517725},
- {0.02434285569092997},
- {0.02356105151968165},
- {0.011565379065969716},
- {0.03507481399750695},
- {0.0034077880569931083},
- {0.03470640181315642},
- {0.037541048551091624},
- {0.027383191936181085},
- {0.015502860058275357},
- {0.03097428751033554},
- {0.007501516506392212},
- {0.03484813633701164},
- {0.02155264527146363},
- {0.017460093797885084},
- {0.025853908377370897},
- {0.02141617813782259},
- {0.03718512417390611},
- {0.032920978972796985},
- {0.021833985672697797},
- {0.019101550428240896},
- {0.010831121545895673},
- {0.011793329241740357},
- {0.0034016637712083434},
- {0.002039270743750629},
- {0.014390002555326263},
- {0.013304357038147394},
- {0.003200924364655289},
- {0.005926927217653983},
- {0.011661888802676585},
- {0.026008206699155528},
- {0.015238934279011206},
- {0.006456780301412419},
- {0.035744901070454346},
- {0.019483597490978527},
- {0.03701773287833762},
- {0.023827326470205915},
- {0.031701549394889984},
- {0.0011314140841800506},
- {0.005831067473853494},
- {0.029772364705899168},
- {0.03746563516025386},
- {0.018879128554359425},
- {0.019286066847214418},
- {0.027586084819143913},
- {0.02511353379057692},
- {0.0009302402202917819},
- {0.028084222729739948},
- {0.020982193785797895},
- {0.0319638776430601},
- {0.010114856198700114},
- {0.023559487428503247},
- {0.030529652867426094},
- {0.02544242545024083},
- {0.010574161899218944},
- {0.031648715472023185},
- {0.007683917697296808},
- {0.0025045073666991723},
- {0.001346535492634316},
- {0.020969869202836437},
- {0.02760602724495932},
- {0.01709081591057595},
- {0.01174038151775395},
- {0.02612936953869624},
- {0.030337907590879794},
- {0.027924121352550076},
- {0.026645586474567738},
- {0.012637928321993003},
- {0.016821899141859543},
- {0.0033398640752339646},
- {0.010167851248907714},
- {0.015325480462079688},
- {0.012096763169147512},
- {0.023258235628626656},
- {0.02210548901760145},
- {0.004878477862444446},
- {0.02785283229963904},
- {0.02488185434651123},
- {0.004379182690263254},
- {0.015288852645871641},
- {0.020823009067449584},
- {0.010353623497959815},
- {0.016509263087534285},
- {0.03302951037995072},
- {0.03605087551884813},
- {0.030517370479953926},
- {0.02766619127204136},
- {0.012721391597794271},
- {0.008873873677964052},
- {0.004121508627675858},
- {0.011876854275855202},
- {0.010861394769866594},
- {0.012239909904315716},
- {0.031533038170302466},
- {0.03777432040983931},
- {0.03733516005210347},
- {0.03622729667554237},
- {0.004755452286390132},
- {0.025240044551308776},
- {0.0325602623592422},
- {0.030071173307665084},
- {0.010282326583669673},
- {0.02953386286458761},
- {0.03888922921518449},
- {0.010034979817512479},
- {0.012575473691076738},
- {0.03175999575091546},
- {0.015625506895244376},
- {0.01123455636092309},
- {0.019402389390483648},
- {0.010932730350744288},
- {0.03242673699518837},
- {0.010957731031219206},
- {0.03881063815508167},
- {0.03248090148687018},
- {0.013118407971163829},
- {0.011495093004233197},
- {0.26276282121811034},
- {0.15459281110039153},
- {0.11145752827939305},
- {0.22586154832017696},
- {0.08655228633187782},
- {0.12511566272878746},
- {0.06266585745151042},
- {0.2934751969369173},
- {0.029351479742029528},
- {0.23760155897320775},
- {0.2838444798393624},
- {0.08655229269777245},
- {0.22869119526301324},
- {0.16825325970670937},
- {0.05831418934986625},
- {0.25606526757837855},
- {0.10977702758327389},
- {0.20580610666314111},
- {0.11415918766890104},
- {0.08697213432720467},
- {0.2609179129714519},
- {0.153067723628854},
- {0.035735013080692345},
- {0.28699601236355665},
- {0.06255767583405515},
- {0.2766424823147929},
- {0.018156973780317293},
- {0.09076088774930485},
- {0.16477244466245616},
- {0.2710712740402913},
- {0.08807206285564685},
- {0.07408774265404751},
- {0.18730807629985252},
- {0.13030327888982293},
- {0.1181184241023735},
- {0.04783250450234549},
- {0.06777048905452139},
- {0.208265390212896},
- {0.013108517642193935},
- {0.06690679739936684},
- {0.27109920808302435},
- {0.09990333415117875},
- {0.021899455376775123},
- {0.17789833137707156},
- {0.03273161982187727},
- {0.016489023123949148},
- {0.22401865183537847},
- {0.2386216040629625},
- {0.2977512521394299},
- {0.12751602964284559},
- {0.19861119674102257},
- {0.2033005354350371},
- {0.17071919309368996},
- {0.2562511372369539},
- {0.0034281389330759796},
- {0.09728529053052146},
- {0.13186173642086976},
- {0.09536727364768387},
- {0.05791354867286007},
- {0.2641205711190286},
- {0.05377656894736672},
- {0.2237402838123745},
- {0.2682284386809829},
- {0.13934054143504024},
- {0.2175110237080212},
- {0.032081165634317996},
- {0.11569883799376099},
- {0.2563804843454348},
- {0.10630255055778269},
- {0.007981234899478117},
- {0.13453699995032145},
- {0.20277756803493466},
- {0.29653524212522214},
- {0.28151821782935027},
- {0.29861027311172683},
- {0.24591710137416845},
- {0.22807820079074476},
- {0.17901143019940532},
- {0.1923140605639533},
- {0.13697497999235436},
- {0.08566572385819755},
- {0.26713583694812165},
- {0.27118192344285325},
- {0.12047978375349498},
- {0.04200621514121493},
- {0.1382933384394987},
- {0.14485598343391187},
- {0.11308668528102821},
- {0.21849421924253765},
- {0.22390405235970012},
- {0.19136170855467868},
- {0.1652346951483609},
- {0.0783531975280195},
- {0.2560000258758168},
- {0.11079324981074493},
- {0.23322100596741321},
- {0.12231236893248242},
- {0.22029406496920198},
- {0.1973566029649198},
- {0.09805884169784698},
- {0.2499150586321629},
- {0.18776304893893697},
- {0.0785634144193011},
- {0.17873011171955142},
- {0.2726601681304297},
- {0.06043617495997007},
- {0.02891684321304025},
- {0.04320749305104273},
- {0.25098391170617607},
- {0.2691819107390239},
- {0.1273495875515404},
- {0.2519902182107255},
- {0.015346913123404167},
- {0.18534726930759643},
- {0.06210938633908888},
- {0.2607861152688212},
- {0.094359333369669},
- {0.01711575694802744},
- {0.28328770022016775},
- {0.012798640693707314},
- {0.1611486685752688},
- {0.2874081029742589},
- {0.008942199879691606},
- {0.16985240919925143},
- {0.19866150912008781},
- {0.16421368817343243},
- {0.2437250409405425},
- {0.10848276614562183},
- {0.030884339927426428},
- {0.08827739261989626},
- {0.27059643046904064},
- {0.0408678833669843},
- {0.1393988445300249},
- {0.1695743629057103},
- {0.010361627260146403},
- {0.050955653059175224},
- {0.28373428021558866},
- {0.2520379164900064},
- {0.05328340857517681},
- {0.24276141125601408},
- {0.18861495002825804},
- {0.18255732242021908},
- {0.08961164714123988},
- {0.2717690304451491},
- {0.026404452387898715},
- {0.26891447440524424},
- {0.29087807471622273},
- {0.21217228759982348},
- {0.12012030191988438},
- {0.23999705560837775},
- {0.058123754211651675},
- {0.27001267136593166},
- {0.16699565418565662},
- {0.1352854718850359},
- {0.20032298997894107},
- {0.16593827037173559},
- {0.28812027754283287},
- {0.2550805411934075},
- {0.16917555478538304},
- {0.14800391643562621},
- {0.08392242369042512},
- {0.09137786600881224},
- {0.02635699978529866},
- {0.015800814592592242},
- {0.11149758464413256},
- {0.10308571310486239},
- {0.024801617228033042},
- {0.045923415690109645},
- {0.09035943036755169},
- {0.20151853460288988},
- {0.1180753344641711},
- {0.050028858953804156},
- {0.276961044126011},
- {0.15096411915635918},
- {0.2868232850597126},
- {0.18462049188252763},
- {0.24563207500603218},
- {0.0087664986252373},
- {0.045180668782507205},
- {0.23068423657946413},
- {0.29029375161440907},
- {0.1462805323281907},
- {0.14943359895052732},
- {0.2137443558676965},
- {0.1945863698607694},
- {0.007207749776456371},
- {0.21760406149579417},
- {0.16257564365655183},
- {0.24766466436398668},
- {0.07837260840237738},
- {0.18254520342386138},
- {0.23655190759378203},
- {0.1971347103159664},
- {0.08193143169127078},
- {0.2452227036550353},
- {0.059537047374309815},
- {0.01940559225314628},
- {0.01043331677594128},
- {0.16248014949477768},
- {0.21389887511130423},
- {0.1324242081473018},
- {0.09096761289633427},
- {0.20245733665698773},
- {0.23506621395893826},
- {0.216363553248055},
- {0.2064571234034302},
- {0.09792204534990416},
- {0.13034056917177664},
- {0.025878159228711367},
- {0.07878322821106218},
- {0.11874591741474415},
- {0.0937289531524666},
- {0.18021102398735356},
- {0.1712792352443108},
- {0.03779974995217044},
- {0.21581118661847395},
- {0.19279125562602883},
- {0.0339310775521038},
- {0.11846211530822717},
- {0.16134223792643795},
- {0.08022264123295568},
- {0.12791818149005688},
- {0.2559214715343956},
- {0.2793318159050681},
- {0.23645674037393305},
- {0.21436504206828155},
- {0.098568741111253},
- {0.06875714425526062},
- {0.031934550067589794},
- {0.0920250402900758},
- {0.08415698871841389},
- {0.09483809230373386},
- {0.2443264050136402},
- {0.29268552740539455},
- {0.2892827956149908},
- {0.28069877416486716},
- {0.036846514917863116},
- {0.19556660903716017},
- {0.2522856124921973},
- {0.23299948546421564},
- {0.07967021369130885},
- {0.22883626058799542},
- {0.301324138720196},
- {0.07775370485887251},
- {0.09743813018239594},
- {0.246084932988721},
- {0.12107060238256405},
- {0.08704834443046416},
- {0.15033489709584152},
- {0.08470971585911234},
- {0.2512510222950454},
- {0.08490342781133026},
- {0.3007151941878795},
- {0.251670703248734},
- {0.10164493005039214},
- {0.08906705195526685},
- {0.49505937680142},
- {0.29126122320711567},
- {0.2099920157426744},
- {0.4255353814380648},
- {0.1630691919563096},
- {0.2357246802704869},
- {0.11806586713011419},
- {0.5529231549149262},
- {0.05529977643689244},
- {0.44765419691807945},
- {0.5347783626556409},
- {0.16306920394999963},
- {0.430866589428581},
- {0.31699824773182206},
- {0.10986708889939052},
- {0.4824408232495556},
- {0.20682586147671556},
- {0.3877498438868144},
- {0.21508208825559408},
- {0.1638602083031211},
- {0.49158346981194373},
- {0.2883878758677662},
- {0.06732669874568555},
- {0.5407160205029891},
- {0.11786204710766773},
- {0.5212094095225064},
- {0.034208721319909735},
- {0.1709984248107078},
- {0.3104402037947819},
- {0.510712951600416},
- {0.1659325331826165},
- {0.13958531704335653},
- {0.3528985535054329},
- {0.2454984298894843},
- {0.22254150398373235},
- {0.09011902734187185},
- {0.12768326935038413},
- {0.3923832671994262},
- {0.0246971567158972},
- {0.1260560275261137},
- {0.5107655808488114},
- {0.18822328865244264},
- {0.04125975920359608},
- {0.33517008478319493},
- {0.06166814329211783},
- {0.031066212008093057},
- {0.42206326471681616},
- {0.4495760170755216},
- {0.5609794743512562},
- {0.24024710145267525},
- {0.37419424418030284},
- {0.3830292120829447},
- {0.3216441996976791},
- {0.4827910117462159},
- {0.006458799292570193},
- {0.18329075277361034},
- {0.24843464822705158},
- {0.17967710515668206},
- {0.1091122601798612},
- {0.4976174511008386},
- {0.10131796646947805},
- {0.4215388042952431},
- {0.5053568959194639},
- {0.2625251216523665},
- {0.40980254110968645},
- {0.06044265239794115},
- {0.21798287279879464},
- {0.4830347086993038},
- {0.20027975871005832},
- {0.015037078522465849},
- {0.25347498951099057},
- {0.38204391319635955},
- {0.5586884456698497},
- {0.5303955591234872},
- {0.5625979163562294},
- {0.46332112886720883},
- {0.4297116746654607},
- {0.3372672232092036},
- {0.3623300988000632},
- {0.2580682758620351},
- {0.16139886027208947},
- {0.5032983751193943},
- {0.5109214210635684},
- {0.226990433371341},
- {0.07914198284670779},
- {0.26055213453054293},
- {0.27291651289290775},
- {0.21306143570932828},
- {0.41165493471063513},
- {0.42184735310212085},
- {0.3605358160700276},
- {0.3113111087288105},
- {0.14762166488698977},
- {0.48231790435082406},
- {0.20874047915470875},
- {0.4394009979645862},
- {0.23044312303435832},
- {0.4150459414735041},
- {0.3718305216032004},
- {0.18474816504009803},
- {0.47085349672445054},
- {0.35375574658215014},
- {0.1480177248878246},
- {0.3367372039672364},
- {0.5137065140626429},
- {0.11386502463797657},
- {0.05448089769225468},
- {0.08140525544611037},
- {0.47286727376589127},
- {0.5071532888819963},
- {0.23993351554423858},
- {0.47476320968522717},
- {0.028914414952149824},
- {0.34920428700641243},
- {0.11701744543618388},
- {0.49133515580684306},
- {0.1777780911197118},
- {0.03224701245364401},
- {0.5337293597182527},
- {0.02411333177334349},
- {0.303612813515311},
- {0.5414924215173114},
- {0.016847588555913798},
- {0.32001113192723507},
- {0.37428903542554054},
- {0.3093874763276406},
- {0.4591911683684169},
- {0.20438740287830415},
- {0.05818776798983896},
- {0.16631938557161452},
- {0.5098183206120145},
- {0.07699730417363138},
- {0.2626349678388814},
- {0.319487277661383},
- {0.019521866564976335},
- {0.0960032082584673},
- {0.534570740600069},
- {0.47485307582498715},
- {0.10038882563673887},
- {0.45737563788781666},
- {0.3553607743422443},
- {0.3439478760690842},
- {0.1688331933042639},
- {0.5120275624321415},
- {0.04974741739846626},
- {0.5066494243545823},
- {0.5480300360859617},
- {0.39974407333110473},
- {0.22631315014042694},
- {0.45216744223124633},
- {0.10950829879199041},
- {0.5087184868667093},
- {0.31462885086422787},
- {0.25488515114586474},
- {0.37741935528867154},
- {0.3126366825295564},
- {0.5428341969498388},
- {0.4805855454434955},
- {0.31873590157782106},
- {0.2788473890450851},
- {0.15811438840261272},
- {0.17216084524460248},
- {0.0496580141268699},
- {0.029769589886806867},
- {0.21006748410183168},
- {0.1942190628424634},
- {0.04672758920633459},
- {0.08652220069317511},
- {0.17024205737523226},
- {0.3796718260671729},
- {0.22246032077319974},
- {0.09425707800266758},
- {0.5218095972165009},
- {0.2844245711872858},
- {0.5403905929139518},
- {0.347834999001892},
- {0.46278412376303396},
- {0.016516557882966444},
- {0.08512282531923805},
- {0.43462158713901683},
- {0.5469291397365713},
- {0.27560044011120866},
- {0.2815409882824876},
- {0.4027059350335123},
- {0.3666112525004495},
- {0.013579790687021023},
- {0.4099778293373754},
- {0.3063013118012415},
- {0.4666136321241384},
- {0.14765823602486322},
- {0.3439250432240246},
- {0.44567659690850303},
- {0.3714124638429798},
- {0.1543632517168797},
- {0.46201284598117204},
- {0.11217101960271911},
- {0.03656118610224043},
- {0.01965693349281674},
- {0.30612139563198687},
- {0.40299705765158156},
- {0.24949437540255148},
- {0.1713879061763863},
- {0.38144057994828534},
- {0.44287746968961433},
- {0.4076406446580672},
- {0.3889763946607813},
- {0.1844904333166855},
- {0.24556868679896326},
- {0.048755852601763655},
- {0.14843186596857993},
- {0.2237237353463322},
- {0.17659042067215971},
- {0.3395273228318346},
- {0.3226993494208537},
- {0.07121677476220233},
- {0.4065999560319571},
- {0.36322916012444945},
- {0.06392798657463722},
- {0.2231890368173093},
- {0.3039775086495519},
- {0.1511437980078046},
- {0.24100477729866074},
- {0.48216990371995583},
- {0.526276259562557},
- {0.44549729671553073},
- {0.4038753414290839},
- {0.18570884313246275},
- {0.12954218114974556},
- {0.06016642073488711},
- {0.17338015661779824},
- {0.15855632161080863},
- {0.1786800988635681},
- {0.46032417083002236},
- {0.5514353747779097},
- {0.5450244439172558},
- {0.528851682908495},
- {0.06942082836521281},
- {0.3684580761626811},
- {0.47531974849927333},
- {0.43898364134711143},
- {0.15010299462006577},
- {0.4311399003522811},
- {0.5677109860463144},
- {0.14649218825171428},
- {0.18357871094994885},
- {0.46363733271264934},
- {0.22810356764564088},
- {0.16400379226241457},
- {0.2832390827696112},
- {0.15959768945937605},
- {0.4733705245722638},
- {0.15996265326171086},
- {0.5665637015892603},
- {0.47416122620358786},
- {0.19150454958771332},
- {0.16780714649852851},
- {0.271864551095011},
- {0.1599476858921283},
- {0.11531825831130266},
- {0.2336850706619561},
- {0.08955033425497806},
- {0.1294494910848987},
- {0.06483651349936342},
- {0.30364075976543037},
- {0.030368173195315006},
- {0.24583173856284438},
- {0.29367644834453693},
- {0.08955034084137821},
- {0.2366127325446583},
- {0.1740813129817476},
- {0.06033410981270964},
- {0.26493500373644835},
- {0.11357954746458794},
- {0.21293493707065775},
- {0.11811349933412049},
- {0.0899847251868783},
- {0.26995573785437016},
- {0.15836977156274146},
- {0.036972823036835245},
- {0.2969371454666774},
- {0.06472458462476137},
- {0.28622498388343937},
- {0.01878590549129645},
- {0.09390471563124168},
- {0.17047992746204668},
- {0.2804607968893176},
- {0.09112275367293005},
- {0.07665403653725536},
- {0.19379616128211888},
- {0.1348167988810898},
- {0.12220987807855307},
- {0.04948935433101515},
- {0.07011796227063402},
- {0.21547940669984658},
- {0.013562578023007098},
- {0.06922435356669111},
- {0.28048969852750477},
- {0.10336384335499416},
- {0.02265802131988165},
- {0.18406047619740534},
- {0.03386539651323364},
- {0.017060179399834844},
- {0.23177833886774069},
- {0.24688711656166962},
- {0.3080649314298213},
- {0.1319330032900445},
- {0.2054908057164653},
- {0.21034257642386878},
- {0.17663266278905235},
- {0.26512731165526465},
- {0.0035468847830584793},
- {0.10065511443216703},
- {0.13642923916131877},
- {0.09867066017631755},
- {0.05991959151327993},
- {0.27326933151866933},
- {0.055639312702348606},
- {0.23149032857289625},
- {0.27751948976218077},
- {0.14416709932920327},
- {0.22504529577079238},
- {0.03319241151905181},
- {0.11970648095332716},
- {0.26526113916335575},
- {0.10998471950359179},
- {0.00825769350881404},
- {0.13919717000908327},
- {0.20980149417788332},
- {0.30680680056067056},
- {0.2912696079317664},
- {0.30895370766510477},
- {0.25443531950884196},
- {0.23597850481695148},
- {0.18521213117757077},
- {0.19897554571116172},
- {0.141719598207385},
- {0.08863306251993035},
- {0.27638904186147345},
- {0.28057527902958757},
- {0.12465303186473173},
- {0.04346125060473264},
- {0.1430836227134155},
- {0.1498735883833346},
- {0.1170038469910847},
- {0.22606254779827026},
- {0.23165976982944753},
- {0.19799020558470995},
- {0.17095818964640502},
- {0.08106724069282292},
- {0.2648675021542328},
- {0.11463097018262483},
- {0.24129944944010087},
- {0.12654909518418908},
- {0.22792473761740648},
- {0.20419275459886196},
- {0.10145546031016858},
- {0.25857176031200835},
- {0.19426689352540888},
- {0.081284739197809},
- {0.18492106822625343},
- {0.2821047280076946},
- {0.06252959798202752},
- {0.0299184814760094},
- {0.044704139070390427},
- {0.25967763693415},
- {0.27850598873429294},
- {0.13176079588175812},
- {0.26071880046274615},
- {0.015878508335565252},
- {0.19176743472840613},
- {0.06426076702018309},
- {0.2698193748670383},
- {0.09762780628267011},
- {0.01770862239092936},
- {0.2931003826723482},
- {0.01324196737837911},
- {0.16673062893250215},
- {0.29736351030919833},
- {0.009251944947250642},
- {0.1757358547350609},
- {0.205542860844682},
- {0.16990181644407365},
- {0.25216732922392193},
- {0.11224045465413744},
- {0.031954129474298744},
- {0.09133519576776421},
- {0.2799695054130731},
- {0.04228348863915564},
- {0.1442274219603578},
- {0.17544817731392964},
- {0.010720539270490137},
- {0.05272068430558854},
- {0.2935624315627517},
- {0.26076815094248523},
- {0.05512906995726874},
- {0.2511703207796082},
- {0.19514830325511098},
- {0.18888084805453959},
- {0.09271566696536365},
- {0.28118272258223315},
- {0.02731906501105461},
- {0.2782292887868177},
- {0.3009536769300626},
- {0.21952163344770775},
- {0.12428109809241074},
- {0.24831021178957804},
- {0.06013707827254191},
- {0.27936552572607387},
- {0.17278014579663878},
- {0.1399715679455762},
- {0.20726189303405768},
- {0.17168613571342325},
- {0.2981003535904856},
- {0.2639161678320365},
- {0.17503555504833213},
- {0.1531305613006632},
- {0.08682937691730885},
- {0.0945430651389033},
- {0.027269968717886686},
- {0.01634813230515931},
- {0.11535970217146492},
- {0.1066564553830073},
- {0.025660709924151058},
- {0.04751413740141692},
- {0.09348935233757576},
- {0.20849884962097945},
- {0.12216529587665541},
- {0.05176178737242971},
- {0.28655458022207414},
- {0.15619330122745928},
- {0.2967584351350417},
- {0.19101548276847374},
- {0.25414042023327327},
- {0.009070157651591335},
- {0.04674566279882109},
- {0.23867480997364499},
- {0.30034911370824685},
- {0.15134748162234246},
- {0.15460976598159992},
- {0.22114815592130097},
- {0.20132656456559528},
- {0.007457415962796875},
- {0.22514155625502116},
- {0.1682070323981765},
- {0.2562434155915934},
- {0.08108732393222186},
- {0.18886830927340903},
- {0.24474572875464182},
- {0.20396317590458798},
- {0.08476941979105104},
- {0.2537168688417408},
- {0.06159932589741717},
- {0.02007777432963116},
- {0.010794712009005588},
- {0.16810823045464973},
- {0.22130802749142728},
- {0.13701119410723234},
- {0.09411860144292793},
- {0.2094701704411062},
- {0.2432085728083436},
- {0.22385807856842208},
- {0.21360850410359472},
- {0.10131392553157051},
- {0.13485538084529827},
- {0.026774541806426366},
- {0.08151216702623838},
- {0.12285910686553266},
- {0.09697559059258719},
- {0.18645327718576576},
- {0.177212104002109},
- {0.039109079452760126},
- {0.22328657874552185},
- {0.19946927013052404},
- {0.03510640175086123},
- {0.12256547425826203},
- {0.1669309032502972},
- {0.08300143926507071},
- {0.13234908510446292},
- {0.2647862268023089},
- {0.2890074721588945},
- {0.24464726507784287},
- {0.221790341807838},
- {0.10198302191301105},
- {0.0711387938022451},
- {0.033040717397915025},
- {0.09521265661550686},
- {0.08707206694377885},
- {0.09812314874432007},
- {0.25278952369199575},
- {0.30282373720605305},
- {0.29930313963290184},
- {0.2904217799058699},
- {0.0381228257145462},
- {0.2023407578309127},
- {0.2610244267814015},
- {0.24107025578218166},
- {0.08242987642019749},
- {0.23676282272588295},
- {0.31176157771292345},
- {0.08044698245146727},
- {0.10081324823189466},
- {0.25460896457148197},
- {0.1252643156096155},
- {0.09006357509956953},
- {0.1555422838109591},
- {0.08764393976538813},
- {0.2599539998533753},
- {0.08784436162372915},
- {0.31113154020932027},
- {0.2603882179575528},
- {0.10516576565562111},
- {0.09215220777780923},
- {0.23168750005406571},
- {0.13631008285015134},
- {0.09827614108246639},
- {0.19915031071007425},
- {0.07631628687511724},
- {0.11031901309652438},
- {0.05525475706334138},
- {0.2587677145152474},
- {0.02588026316962711},
- {0.20950190347422337},
- {0.2502759623041981},
- {0.07631629248815719},
- {0.20164531294510193},
- {0.1483549953402167},
- {0.05141773362577499},
- {0.2257820243399828},
- {0.09679438272975112},
- {0.18146670113982294},
- {0.10065829205439986},
- {0.07668648206479077},
- {0.23006077760712326},
- {0.1349653579685784},
- {0.03150885580647857},
- {0.25305478271906784},
- {0.055159369411527395},
- {0.24392570013952894},
- {0.016009661656878997},
- {0.08002716323352825},
- {0.14528583459664185},
- {0.23901336394441572},
- {0.07765632890161317},
- {0.06532584709127094},
- {0.1651563175363638},
- {0.11489312222664641},
- {0.10414929427131085},
- {0.0421756523167877},
- {0.05975569570190505},
- {0.18363514055193383},
- {0.011558254961091141},
- {0.05899414747574175},
- {0.23903799440201706},
- {0.08808838948086792},
- {0.019309543280398047},
- {0.156859404498214},
- {0.02886065514936773},
- {0.014538969128933044},
- {0.19752536210645513},
- {0.21040131418876862},
- {0.26253806731999585},
- {0.11243550357623722},
- {0.17512268837103728},
- {0.17925744820458767},
- {0.15052929815475055},
- {0.22594591235249378},
- {0.0030227143077562733},
- {0.0857799655619487},
- {0.1162672706987735},
- {0.0840887805815695},
- {0.051064474224596305},
- {0.23288467733654467},
- {0.04741674930700493},
- {0.1972799149345691},
- {0.23650673300473363},
- {0.122861604056485},
- {0.19178735059813212},
- {0.028287126124535808},
- {0.10201585753139757},
- {0.22605996238462633},
- {0.09373081044696174},
- {0.0070373439919395216},
- {0.11862614748450408},
- {0.17879632889943706},
- {0.2614658672312373},
- {0.2482248128033976},
- {0.26329549723585255},
- {0.2168340185030575},
- {0.20110481350850562},
- {0.1578408640603549},
- {0.16957027524195858},
- {0.12077580282197456},
- {0.07553457261959008},
- {0.23554334646904398},
- {0.2391109275317726},
- {0.10623139063395702},
- {0.03703840188533701},
- {0.12193824723240541},
- {0.12772476910581693},
- {0.09971262783943843},
- {0.19265426972466776},
- {0.19742431559651},
- {0.16873055196917047},
- {0.1456934175986113},
- {0.06908685320226746},
- {0.22572449836695607},
- {0.09769042268810849},
- {0.20563941117009177},
- {0.10784724738563688},
- {0.1942412589149981},
- {0.17401646758142503},
- {0.08646203365396689},
- {0.22035916227390656},
- {0.16555748339709636},
- {0.06927220905201967},
- {0.1575928153637615},
- {0.2404143494334902},
- {0.05328876522330668},
- {0.025497028393996066},
- {0.03809761214388098},
- {0.22130160875661367},
- {0.2373474438651014},
- {0.11228874555370003},
- {0.2221889056627984},
- {0.01353192935981225},
- {0.16342740296611244},
- {0.05476409632111168},
- {0.22994456679733738},
- {0.08320004311812437},
- {0.01509158304983281},
- {0.24978502954036852},
- {0.01128502522795605},
- {0.14209061992165845},
- {0.2534181379416474},
- {0.007884661633274932},
- {0.14976502338917064},
- {0.17516705061860852},
- {0.14479315875505677},
- {0.21490119939463176},
- {0.09565318552568745},
- {0.027231841534635707},
- {0.07783737559438766},
- {0.23859467716281624},
- {0.03603469351525262},
- {0.12291301200780701},
- {0.14951985989780905},
- {0.009136222184198097},
- {0.04492944555920655},
- {0.25017879530309545},
- {0.22223096296387415},
- {0.046981911938351585},
- {0.21405153218695264},
- {0.16630863545416114},
- {0.16096740570842},
- {0.07901383614939647},
- {0.2396286010481231},
- {0.02328176237296092},
- {0.23711163555968817},
- {0.2564777377527125},
- {0.18707999353512522},
- {0.10591442247629305},
- {0.21161409965257758},
- {0.051249820064446755},
- {0.23807995561048195},
- {0.14724611898595863},
- {0.11928610230844273},
- {0.17663203849166786},
- {0.1463137853654361},
- {0.25404608806271123},
- {0.2249137554071346},
- {0.14916821632825253},
- {0.13050041569129597},
- {0.07399744169732858},
- {0.08057117531967617},
- {0.02323992169391622},
- {0.013932150731235875},
- {0.09831146023060436},
- {0.09089440831026546},
- {0.021868484537586386},
- {0.04049233953974547},
- {0.0796731837141828},
- {0.17768619350432036},
- {0.10411130057605719},
- {0.0441122576163201},
- {0.24420658763080977},
- {0.13311053368607334},
- {0.25290248279690536},
- {0.16278657697737733},
- {0.21658270042701902},
- {0.00772973947110538},
- {0.03983743267964422},
- {0.20340264968692995},
- {0.25596251890228516},
- {0.1289808454810446},
- {0.13176101856583086},
- {0.18846614308706464},
- {0.17157385268068587},
- {0.006355334133576924},
- {0.1918693853866146},
- {0.14334883555387487},
- {0.21837490810997},
- {0.06910396847349567},
- {0.1609567199502284},
- {0.2085763878213617},
- {0.17382081679309028},
- {0.07224191191281308},
- {0.2162217428742475},
- {0.05249597185327982},
- {0.01711061380509385},
- {0.00919943342777359},
- {0.1432646348914347},
- {0.188602388302791},
- {0.11676322239979424},
- {0.08020944028585827},
- {0.17851396929067867},
- {0.20726639791294363},
- {0.19077558431771616},
- {0.1820407261877795},
- {0.08634141535749529},
- {0.11492600241936969},
- {0.022817710625524176},
- {0.0694660268366455},
- {0.10470257786055623},
- {0.0826442140402887},
- {0.15889858936761753},
- {0.15102310761074864},
- {0.033329409116892035},
- {0.1902885426467231},
- {0.16999103541821903},
- {0.029918260489607374},
- {0.10445233926034568},
- {0.14226129703210946},
- {0.07073520945175737},
- {0.11279009543093942},
- {0.22565523415789523},
- {0.24629698300768288},
- {0.20849247543546293},
- {0.18901342459920917},
- {0.08691163044175983},
- {0.06062566534150207},
- {0.0281578498670851},
- {0.08114181233228755},
- {0.07420426618141235},
- {0.083622182216981},
- {0.21543144388687932},
- {0.2580714342775059},
- {0.25507112236801116},
- {0.24750227963383004},
- {0.0324889072489383},
- {0.17243816507914542},
- {0.22244936550368155},
- {0.20544408851615373},
- {0.0702481140723889},
- {0.20177322229823583},
- {0.26568841087330736},
- {0.0685582587946891},
- {0.08591472982078781},
- {0.216982001718588},
- {0.10675233682611547},
- {0.07675367927412655},
- {0.13255572579694966},
- {0.07469162572811991},
- {0.2215371298409369},
- {0.07486242857508243},
- {0.2651514824155067},
- {0.22190717774394556},
- {0.0896240176877908},
- {0.07853364684181237},
- {0.5179343673279123},
- {0.3047194022333254},
- {0.21969502430255372},
- {0.44519790733945297},
- {0.17060405826924402},
- {0.2466167067237314},
- {0.12352128463892505},
- {0.578471831544943},
- {0.05785498884451132},
- {0.46833875718195483},
- {0.5594886308633833},
- {0.1706040708171212},
- {0.45077545210893444},
- {0.33164564611185265},
- {0.11494366907444889},
- {0.5047327538311542},
- {0.21638257294127033},
- {0.40566643010091136},
- {0.22502029155365708},
- {0.17143162475991205},
- {0.5142978506354768},
- {0.3017132873993138},
- {0.0704376338539914},
- {0.565700647451061},
- {0.12330804679449389},
- {0.5452927030905997},
- {0.03578938863535832},
- {0.17889967369293847},
- {0.3247845775277462},
- {0.5343112399614959},
- {0.1735997046421559},
- {0.14603507429396},
- {0.3692047814985403},
- {0.25684206768556894},
- {0.23282438121811547},
- {0.0942831175365091},
- {0.1335830739266606},
- {0.41051394796328405},
- {0.02583832735598803},
- {0.13188064285629408},
- {0.5343663010263863},
- {0.1969204392298307},
- {0.04316623072021619},
- {0.35065714123229363},
- {0.06451761602144543},
- {0.03250167478019642},
- {0.44156535605049935},
- {0.4703493780367581},
- {0.5869004057842728},
- {0.251348093429142},
- {0.39148447277065207},
- {0.40072767414294463},
- {0.33650627153343166},
- {0.5050991233334049},
- {0.006757238186071492},
- {0.19175998783866355},
- {0.25991395857031535},
- {0.18797936599828474},
- {0.11415396231681449},
- {0.5206106414395298},
- {0.10599952111071544},
- {0.4410166621172766},
- {0.5287076993752932},
- {0.27465550429366525},
- {0.42873810658909106},
- {0.06323549940940898},
- {0.22805511137031076},
- {0.5053540806842439},
- {0.20953399728794603},
- {0.0157318901852},
- {0.2651871966834495},
- {0.39969684798477845},
- {0.5845035165498925},
- {0.5549033130592542},
- {0.5885936304259687},
- {0.4847296041536236},
- {0.4495671727081499},
- {0.3528511812096629},
- {0.37907212605155205},
- {0.2699927229933541},
- {0.16885654630475225},
- {0.5265540614114919},
- {0.5345293420812914},
- {0.23747888032597086},
- {0.08279886158227093},
- {0.2725913522250989},
- {0.2855270459713526},
- {0.22290627160538024},
- {0.4306760929250907},
- {0.4413394679029432},
- {0.3771949356898772},
- {0.32569572398238616},
- {0.15444275412200784},
- {0.5046041552730206},
- {0.21838565851482974},
- {0.4597042063003471},
- {0.24109110689917201},
- {0.43422378644355064},
- {0.38901153070576244},
- {0.1932847421116889},
- {0.492610016814076},
- {0.37010158251811875},
- {0.15485711469281782},
- {0.35229667160208095},
- {0.5374431246456073},
- {0.11912633566842558},
- {0.05699827253047539},
- {0.0851667122215941},
- {0.4947168435641054},
- {0.5305870974760482},
- {0.2510200177947838},
- {0.4967003841592154},
- {0.030250450585658898},
- {0.365339815654901},
- {0.12242441898566328},
- {0.5140380628945367},
- {0.18599260505631485},
- {0.033737035951735786},
- {0.5583911571094031},
- {0.0252275258715166},
- {0.31764171703342425},
- {0.5665129232850102},
- {0.017626057658147076},
- {0.3347977453199633},
- {0.3915836439931984},
- {0.32368320714630755},
- {0.4804088123895095},
- {0.21383144156065995},
- {0.060876424550846214},
- {0.17400443214906536},
- {0.5333752711531412},
- {0.08055508468658137},
- {0.27477042609452795},
- {0.33424968555083195},
- {0.020423904853026795},
- {0.10043918620845409},
- {0.559271415306957},
- {0.49679440270410496},
- {0.10502744787684892},
- {0.4785093924918203},
- {0.37178077308883195},
- {0.3598405240530924},
- {0.17663439428816455},
- {0.5356865944367739},
- {0.052046074398076715},
- {0.5300599511023923},
- {0.5733526185299018},
- {0.4182148716211013},
- {0.23677030216718165},
- {0.47306054403300646},
- {0.11456830051062038},
- {0.532224617874496},
- {0.32916676756703034},
- {0.26666251703574256},
- {0.3948586051671892},
- {0.3270825479877643},
- {0.5679166975438321},
- {0.5027917500208483},
- {0.333463590963594},
- {0.2917319675050585},
- {0.1654203102905698},
- {0.18011580557572027},
- {0.05195254010889613},
- {0.031145140211776116},
- {0.21977397979493515},
- {0.203193257516424},
- {0.048886710335050196},
- {0.09052009390343045},
- {0.17810835712058803},
- {0.39721515487063147},
- {0.23273944681073888},
- {0.09861237328117867},
- {0.5459206233929592},
- {0.29756685204548794},
- {0.5653601829727836},
- {0.36390725756279263},
- {0.4841677858911766},
- {0.017279731196729712},
- {0.0890560582080818},
- {0.45470395534432},
- {0.5722008535478927},
- {0.28833498823223097},
- {0.29455002869576413},
- {0.42131359076235014},
- {0.3835510971349188},
- {0.014207266092747877},
- {0.428921494282694},
- {0.32045444157524045},
- {0.48817424265804077},
- {0.15448101508633763},
- {0.3598166361808201},
- {0.4662697790799635},
- {0.38857415593478983},
- {0.1614958464845545},
- {0.483360870016633},
- {0.11735405648879435},
- {0.03825055272151273},
- {0.020565212758898468},
- {0.3202662120988148},
- {0.421618165154979},
- {0.261022652092553},
- {0.1793071516524957},
- {0.3990656367831077},
- {0.46334131382282123},
- {0.4264763163405508},
- {0.40694965556613655},
- {0.19301510149207582},
- {0.25691557092511264},
- {0.051008692803644666},
- {0.15529039180804263},
- {0.23406123942445742},
- {0.18475005644361847},
- {0.3552157122598747},
- {0.33761017609502103},
- {0.07450745689923854},
- {0.42538754107356724},
- {0.3800127299064746},
- {0.06688187888695098},
- {0.2335018343160643},
- {0.3180232634750674},
- {0.15812763289626774},
- {0.25214077886915043},
- {0.5044493160422032},
- {0.5505936748382608},
- {0.4660821940419648},
- {0.4225370314040623},
- {0.19428980983344282},
- {0.13552787964459542},
- {0.06294650403159348},
- {0.1813914571323722},
- {0.16588266371182406},
- {0.1869362914746139},
- {0.4815941669967165},
- {0.5769153062065738},
- {0.570208148287964},
- {0.5532880996361472},
- {0.07262852599828376},
- {0.38548325616449686},
- {0.4972826387170602},
- {0.45926756506951416},
- {0.15703873756491543},
- {0.4510613917900794},
- {0.5939429574746713},
- {0.15326108825743473},
- {0.19206125157159676},
- {0.48506041869084743},
- {0.23864344870529433},
- {0.17158184323995698},
- {0.2963265862867623},
- {0.1669721495857978},
- {0.4952433478587819},
- {0.16735397710976307},
- {0.5927426609501438},
- {0.49607058509204255},
- {0.2003533159435848},
- {0.1755609373896993},
- {0.1742028361867954},
- {0.10248978916778956},
- {0.07389256003049036},
- {0.1497385441384656},
- {0.05738122953455917},
- {0.08294743981551946},
- {0.04154533753871166},
- {0.19456409936492833},
- {0.019459035314195367},
- {0.15752177291923575},
- {0.18817926065323662},
- {0.05738123375493134},
- {0.15161450406523244},
- {0.11154620316035066},
- {0.038660329218524796},
- {0.1697625853394885},
- {0.07277844508028268},
- {0.13644246670468574},
- {0.07568366855140367},
- {0.05765957451203437},
- {0.17297972460813893},
- {0.10147870791305506},
- {0.023691101355094543},
- {0.19026861980041163},
- {0.04147361679642165},
- {0.18340458062364107},
- {0.012037457637414612},
- {0.06017138949667569},
- {0.10923854087335136},
- {0.17971105854199193},
- {0.058388789811098116},
- {0.049117659938273474},
- {0.12417890012317337},
- {0.08638665333937907},
- {0.07830850798891484},
- {0.031711327757855345},
- {0.044929535115868634},
- {0.13807288826649117},
- {0.008690502487714346},
- {0.04435693684941182},
- {0.17972957786465601},
- {0.06623252130181109},
- {0.014518595971435915},
- {0.1179405584668319},
- {0.021699953515211985},
- {0.01093166293779928},
- {0.14851676628967286},
- {0.1581980282085112},
- {0.19739897889817357},
- {0.08453880164661647},
- {0.13167248551506688},
- {0.1347813579824535},
- {0.11318103333863969},
- {0.1698858106174589},
- {0.0022727398123363212},
- {0.06449684719896426},
- {0.08741985781148237},
- {0.063225267074746},
- {0.03839471804148411},
- {0.17510297830916957},
- {0.03565204083133951},
- {0.14833221773411162},
- {0.17782635514252373},
- {0.09237805181593435},
- {0.14420242961380958},
- {0.021268724455647474},
- {0.07670440448384325},
- {0.16997156336225547},
- {0.07047498468470405},
- {0.005291287973377468},
- {0.08919346677266313},
- {0.13443464833795835},
- {0.19659280551213468},
- {0.1866370278594985},
- {0.19796848066034964},
- {0.16303469542464788},
- {0.15120810952607747},
- {0.11867850522394092},
- {0.12749769786126341},
- {0.09080976483157462},
- {0.05679346869131686},
- {0.17710199726036716},
- {0.17978441534208758},
- {0.079874009328014},
- {0.027848695569447628},
- {0.09168379175645958},
- {0.0960346027487228},
- {0.07497263585310014},
- {0.1448542548980905},
- {0.14844079072510805},
- {0.12686632078784507},
- {0.10954499726356678},
- {0.05194551181331452},
- {0.1697193323040277},
- {0.07345216594155542},
- {0.1546176148875233},
- {0.08108895113086709},
- {0.1460474915547458},
- {0.13084073240385338},
- {0.06500968538002434},
- {0.1656852054552055},
- {0.12448053154784937},
- {0.05208487848058451},
- {0.11849200061558299},
- {0.18076444142020665},
- {0.04006713368924105},
- {0.019170886040605906},
- {0.028645102070072176},
- {0.16639381878222373},
- {0.17845847477027632},
- {0.08442845618666209},
- {0.1670609658555923},
- {0.010174482753746187},
- {0.12287895160807359},
- {0.04117641606956901},
- {0.17289234720255797},
- {0.06255703686499593},
- {0.011347166201093934},
- {0.18781013465456955},
- {0.008485064583504636},
- {0.10683610026486842},
- {0.1905418218950515},
- {0.005928375154331512},
- {0.11260638502244243},
- {0.13170584091552973},
- {0.10886810427705329},
- {0.16158143372323874},
- {0.07192039365519527},
- {0.02047526961452778},
- {0.0585249164789425},
- {0.17939625336341505},
- {0.02709402022126387},
- {0.09241670478996512},
- {0.11242204976260028},
- {0.006869407353217709},
- {0.033781869297599396},
- {0.1881062020412187},
- {0.16709258819658196},
- {0.035325092235141006},
- {0.16094257993372452},
- {0.12504531306915584},
- {0.12102931147124375},
- {0.05940948196174412},
- {0.18017364736688826},
- {0.01750525615689398},
- {0.17828117355381104},
- {0.19284229544049417},
- {0.14066302869175557},
- {0.07963568506782265},
- {0.1591099059206551},
- {0.038534077182438356},
- {0.17900924088219713},
- {0.11071245336440935},
- {0.08968967827332001},
- {0.13280734635888183},
- {0.11001144376773525},
- {0.19101396947335259},
- {0.16910974515329052},
- {0.11215765350846789},
- {0.09812157553460814},
- {0.055637719821887595},
- {0.06058042515161931},
- {0.017473796691209093},
- {0.010475404029120538},
- {0.07391911604139254},
- {0.06834233058526633},
- {0.016442630822403655},
- {0.030445666641559482},
- {0.059905236872094626},
- {0.13359995188547147},
- {0.07827994102061116},
- {0.033167436247412176},
- {0.1836157762972061},
- {0.10008408951298983},
- {0.19015410745777106},
- {0.12239712283132123},
- {0.1628457326121496},
- {0.005811891183328203},
- {0.02995325063965518},
- {0.15293582284371754},
- {0.1924549090472688},
- {0.09697903033752596},
- {0.09906940653972478},
- {0.14170525662062766},
- {0.12900416183650903},
- {0.004778493577450219},
- {0.14426411051077767},
- {0.1077821363333465},
- {0.16419327040047643},
- {0.05195838056449603},
- {0.12102127698779797},
- {0.15682588966430766},
- {0.1306936251053494},
- {0.05431775967124663},
- {0.1625743332944429},
- {0.03947104260302993},
- {0.012865249325270958},
- {0.006916935070108675},
- {0.10771882694374861},
- {0.14180769763704362},
- {0.08779275748414195},
- {0.0603084412559646},
- {0.1342223457982925},
- {0.15584092518685738},
- {0.14344169562701486},
- {0.1368740687176254},
- {0.06491899404218149},
- {0.08641137553123418},
- {0.01715634164695255},
- {0.052230607567295625},
- {0.07872451476718154},
- {0.0621391161667646},
- {0.1194737952088935},
- {0.11355232228496027},
- {0.02505995185427675},
- {0.1430754952907501},
- {0.1278140619984824},
- {0.022495153298510838},
- {0.07853636359860351},
- {0.10696443017781496},
- {0.05318488956843884},
- {0.0848054146782364},
- {0.16966725344063707},
- {0.18518751755781826},
- {0.1567627970261146},
- {0.14211675051471312},
- {0.06534773139267383},
- {0.04558365404148542},
- {0.02117152330886885},
- {0.06100947974458123},
- {0.05579322847777907},
- {0.06287443779628916},
- {0.1619801177023071},
- {0.19404057525522422},
- {0.19178467951653722},
- {0.18609376450973503},
- {0.024427989365218544},
- {0.12965402715564767},
- {0.16725680224289854},
- {0.1544707543090303},
- {0.05281864884954088},
- {0.1517106774543257},
- {0.1997676814903358},
- {0.05154806851157774},
- {0.06459817470304155},
- {0.1631459620913754},
- {0.08026570203544765},
- {0.057710099225052554},
- {0.09966693663334979},
- {0.056159667820684295},
- {0.16657090404086444},
- {0.05628809227328838},
- {0.19936397192397395},
- {0.16684913827540035},
- {0.06738714029900336},
- {0.05904843382894367},
- {0.6452750442914715},
- {0.37963849896079915},
- {0.27370980857830096},
- {0.5546554109915971},
- {0.21254921125227003},
- {0.30725052514891604},
- {0.15389054568348276},
- {0.7206964053134682},
- {0.07207936534840703},
- {0.5834857297520606},
- {0.6970459460404459},
- {0.2125492268852006},
- {0.5616042652773877},
- {0.4131848984804112},
- {0.14320401547341405},
- {0.6288276481130941},
- {0.2695829493974885},
- {0.5054046229861405},
- {0.28034435974556127},
- {0.2135802453708881},
- {0.6407444442428899},
- {0.3758932929945112},
- {0.08775561185370157},
- {0.7047852650190903},
- {0.15362488063364294},
- {0.6793597709182959},
- {0.0445886598643576},
- {0.22288440804094037},
- {0.40463694991052385},
- {0.6656783769926996},
- {0.21628137495466143},
- {0.18193963362443402},
- {0.4599784195885598},
- {0.3199899196818311},
- {0.29006718298640594},
- {0.11746380754415377},
- {0.16642615238938888},
- {0.51144396407},
- {0.03219100504002063},
- {0.16430515723318517},
- {0.6657469755127576},
- {0.24533580538685595},
- {0.05377919133574028},
- {0.43687060873590156},
- {0.08038008319587092},
- {0.04049262021660791},
- {0.5501297512908061},
- {0.5859906870265315},
- {0.731197250514486},
- {0.31314518277058523},
- {0.48773585311548046},
- {0.49925161177361355},
- {0.4192405697817287},
- {0.6292840941643796},
- {0.008418590162882059},
- {0.23890659213117107},
- {0.3238170735680267},
- {0.23419645687197668},
- {0.14222014937926242},
- {0.6486093140461889},
- {0.13206083626477583},
- {0.549446154054559},
- {0.6586971354917629},
- {0.34218301367475257},
- {0.5341487612533027},
- {0.078782742092814},
- {0.2841253281754242},
- {0.6296017359858789},
- {0.26105056530250825},
- {0.019599773207589623},
- {0.33038680357950867},
- {0.497967344042358},
- {0.7282110559221946},
- {0.691333270196179},
- {0.7333067757257643},
- {0.603906472558112},
- {0.5600989151924336},
- {0.43960408103062165},
- {0.4722717748766686},
- {0.33637382895970386},
- {0.2103720514972515},
- {0.6560139985536808},
- {0.665950102261168},
- {0.2958660492278394},
- {0.10315600285500495},
- {0.3396113638644877},
- {0.3557274605778963},
- {0.27771058141029636},
- {0.5365632258991807},
- {0.549848325701747},
- {0.469933053659881},
- {0.4057721131782311},
- {0.19241444726041976},
- {0.6286674319823833},
- {0.2720785187470695},
- {0.5727282659612113},
- {0.30036638712593733},
- {0.5409831644795596},
- {0.4846549071479741},
- {0.24080622641521374},
- {0.6137243837632379},
- {0.4610957104156092},
- {0.19293068358793264},
- {0.438913238263345},
- {0.669580274908225},
- {0.14841504324438257},
- {0.07101201455580214},
- {0.1061060193484992},
- {0.6163492003620155},
- {0.6610386072480446},
- {0.31273644561613917},
- {0.6188204193544273},
- {0.03768790424586691},
- {0.4551632032923212},
- {0.15252400181685},
- {0.6404207844191435},
- {0.23172122576993529},
- {0.04203171046619612},
- {0.6956786445638866},
- {0.03143003033008008},
- {0.39573792734590757},
- {0.7057972490807634},
- {0.021959645571934115},
- {0.41711198091484825},
- {0.4878594068301164},
- {0.4032647937716473},
- {0.5985233598070754},
- {0.26640459028780133},
- {0.075843659016131},
- {0.21678560980838305},
- {0.6645122884834886},
- {0.10036056519517961},
- {0.3423261904454394},
- {0.4164291737599086},
- {0.02544537868115211},
- {0.12513342310846653},
- {0.6967753253080994},
- {0.6189375535408124},
- {0.13084976660304656},
- {0.5961569436433194},
- {0.46318775110308263},
- {0.44831184169946886},
- {0.22006218120978938},
- {0.667391879660094},
- {0.06484225624123068},
- {0.6603818553098335},
- {0.714318569407231},
- {0.5210382566442119},
- {0.2949832582187091},
- {0.5893684272744635},
- {0.14273635782810332},
- {0.6630787326274207},
- {0.41009655647473253},
- {0.33222484999180113},
- {0.4919395583896708},
- {0.40749990530392394},
- {0.7075461588928497},
- {0.6264094241089084},
- {0.41544980793366665},
- {0.3634579400943333},
- {0.20609097365009693},
- {0.22439954123933162},
- {0.06472572537090987},
- {0.03880256456682298},
- {0.2738081762713087},
- {0.2531508749266442},
- {0.0609061227959449},
- {0.11277559723281262},
- {0.22189853633888215},
- {0.49487549547009446},
- {0.28996136638696973},
- {0.12285746525179556},
- {0.6801420733227626},
- {0.37072740436967366},
- {0.7043610930676643},
- {0.45337843277959317},
- {0.6032065242112692},
- {0.021528170395101697},
- {0.11095160995227307},
- {0.5664986404320831},
- {0.7128836285215479},
- {0.359225770752029},
- {0.36696885706443155},
- {0.5248988348511224},
- {0.47785195732161895},
- {0.017700301110651077},
- {0.534377237117383},
- {0.3992421955848812},
- {0.6081980187533824},
- {0.19246211516394185},
- {0.4482820806934208},
- {0.5809080673673682},
- {0.484109998289797},
- {0.20120163106927624},
- {0.6022012179224205},
- {0.14620702694294768},
- {0.04765493208895474},
- {0.025621428912555953},
- {0.3990076875247883},
- {0.5252782926880442},
- {0.3251983533339524},
- {0.2233920695806787},
- {0.497180941629603},
- {0.5772596021028261},
- {0.5313308814313198},
- {0.507003345567886},
- {0.24047029125867786},
- {0.3200814946170817},
- {0.06354982133727209},
- {0.19347048733017044},
- {0.29160813833562743},
- {0.23017318095640324},
- {0.4425499617722794},
- {0.42061588316081194},
- {0.0928260520705363},
- {0.529974417074164},
- {0.4734436380169294},
- {0.08332562981624007},
- {0.2909111964471068},
- {0.39621328177797716},
- {0.19700529981677056},
- {0.314132759893628},
- {0.6284745235796464},
- {0.6859640532270893},
- {0.580674362188993},
- {0.526423073758731},
- {0.24205840267456608},
- {0.16884911304800104},
- {0.07842269356739559},
- {0.22598882777184304},
- {0.206667002473821},
- {0.23289692936054032},
- {0.6000001487496835},
- {0.7187571886481624},
- {0.7104009916162306},
- {0.6893209362425303},
- {0.09048516238100039},
- {0.48025916194451623},
- {0.6195458285168672},
- {0.5721842709932412},
- {0.19564868587591136},
- {0.5619605068246853},
- {0.7399713020944032},
- {0.1909422539842061},
- {0.23928192534108106},
- {0.6043186220091336},
- {0.29731694138706277},
- {0.2137673969531715},
- {0.3691822036784667},
- {0.2080243521496309},
- {0.6170051523580566},
- {0.20850005677164607},
- {0.7384758975762145},
- {0.6180357762671934},
- {0.24961269800733038},
- {0.2187248014346728},
- {0.2910386876612767},
- {0.17122851952932447},
- {0.12345145561319024},
- {0.2501664745092855},
- {0.0958661644418994},
- {0.13857933979263995},
- {0.06940932065391907},
- {0.3250560173684429},
- {0.03250998792536961},
- {0.2631698258880992},
- {0.31438894029750986},
- {0.09586617149282696},
- {0.25330061932083103},
- {0.18635896689176526},
- {0.06458937022269472},
- {0.28362041131300086},
- {0.12159011649776642},
- {0.2279528698856466},
- {0.12644384015064158},
- {0.09633119221489517},
- {0.2889952491242957},
- {0.16953931763147873},
- {0.039580452296675374},
- {0.3178796087479067},
- {0.06928949762938577},
- {0.3064119369361758},
- {0.02011084291311278},
- {0.10052765280520416},
- {0.18250358188038962},
- {0.30024121180321384},
- {0.09754948388171088},
- {0.08206031315184495},
- {0.20746426934355855},
- {0.14432519452429152},
- {0.1308291294027389},
- {0.052979752894186306},
- {0.075063260872126},
- {0.2306767965568156},
- {0.014519123192858571},
- {0.07410662749189781},
- {0.3002721518239535},
- {0.1106539164466129},
- {0.024256052373797684},
- {0.1970419432288594},
- {0.03625386435503237},
- {0.01826340434527139},
- {0.2481252642195462},
- {0.2642996378717783},
- {0.3297922182081859},
- {0.1412380098180814},
- {0.21998371682256418},
- {0.22517767452623938},
- {0.18909025898811263},
- {0.2838262823767116},
- {0.003797040432043423},
- {0.1077541455579315},
- {0.14605135742857547},
- {0.10562973117576947},
- {0.06414561666456552},
- {0.2925425448184788},
- {0.05956345719235663},
- {0.24781694105675486},
- {0.2970924593717448},
- {0.1543349554905403},
- {0.24091735123857863},
- {0.03553341489321944},
- {0.12814917200819745},
- {0.2839695485074776},
- {0.11774175153836888},
- {0.008840094349315793},
- {0.14901450565156324},
- {0.22459843068531143},
- {0.32844535354492277},
- {0.3118123495933469},
- {0.33074367829409845},
- {0.2723802025172891},
- {0.25262166060846225},
- {0.19827482244284997},
- {0.21300894679801297},
- {0.15171483634784796},
- {0.09488419911791064},
- {0.2958822829358463},
- {0.3003637681708265},
- {0.13344459459972816},
- {0.04652649743842008},
- {0.15317506314304424},
- {0.1604439133475998},
- {0.12525592594712878},
- {0.2420063482920947},
- {0.24799833271206168},
- {0.21195411233670688},
- {0.18301557506939875},
- {0.08678477296333688},
- {0.28354814896094377},
- {0.1227156942415443},
- {0.25831788225266816},
- {0.1354743839856371},
- {0.24399987513829313},
- {0.21859411640477192},
- {0.10861093844641398},
- {0.2768083793358305},
- {0.2079682015177797},
- {0.08701761126168978},
- {0.19796323132500462},
- {0.30200108653999325},
- {0.06693970237523351},
- {0.03202858022689734},
- {0.047857044677835504},
- {0.2779922515233852},
- {0.29814853441009137},
- {0.14105365691914198},
- {0.2791068465148355},
- {0.016998392064681206},
- {0.2052924602149392},
- {0.06879296777138497},
- {0.2888492686913235},
- {0.1045133266007444},
- {0.018957580898967593},
- {0.31377224570983664},
- {0.014175900433999671},
- {0.17848985181041943},
- {0.31833604436532137},
- {0.009904468622027787},
- {0.18813020061321065},
- {0.2200394433089384},
- {0.18188469769223156},
- {0.26995225480033586},
- {0.12015657978751705},
- {0.03420779895760779},
- {0.09777690915004951},
- {0.29971527038889756},
- {0.04526566995849202},
- {0.1543995325725349},
- {0.18782223380113974},
- {0.011476640362774706},
- {0.056438982982892204},
- {0.3142668821093111},
- {0.27915967759855304},
- {0.05901722790899253},
- {0.26888492907489087},
- {0.20891177555121349},
- {0.20220228757566397},
- {0.09925474259352454},
- {0.3010140536665934},
- {0.02924583141467296},
- {0.2978523192939065},
- {0.3221794192283298},
- {0.23500411456568573},
- {0.1330464289817496},
- {0.26582310154469657},
- {0.06437844238878872},
- {0.2990686930592299},
- {0.184966030635616},
- {0.14984352053510253},
- {0.22187971586535765},
- {0.18379486191345343},
- {0.31912485592877865},
- {0.28252971867445015},
- {0.1873805100008295},
- {0.16393059493146087},
- {0.09295330268942763},
- {0.10121102399953884},
- {0.029193272444865852},
- {0.01750113780057955},
- {0.12349582243712759},
- {0.11417875070599298},
- {0.02747051541181484},
- {0.050865227330918944},
- {0.1000829946568568},
- {0.22320391286088972},
- {0.13078140289525167},
- {0.05541245670756535},
- {0.30676477913449796},
- {0.16720934460791653},
- {0.3176882942856818},
- {0.20448747438386422},
- {0.2720645045058784},
- {0.00970986018282864},
- {0.050042553543771365},
- {0.25550813150427304},
- {0.3215322172081443},
- {0.1620217577274791},
- {0.16551412536008153},
- {0.23674535285607504},
- {0.21552577894587963},
- {0.00798337461215438},
- {0.24102040080826598},
- {0.18007038345891027},
- {0.27431582048943726},
- {0.08680627263887425},
- {0.20218886445598758},
- {0.2620072216865088},
- {0.2183483459222748},
- {0.09074806034999866},
- {0.2716110807672842},
- {0.06594381980951315},
- {0.02149382502617258},
- {0.011556044376246973},
- {0.1799646131851964},
- {0.23691649989152525},
- {0.14667435665026318},
- {0.10075662361324739},
- {0.22424373925844374},
- {0.2603616527900144},
- {0.2396464016603602},
- {0.22867394243640135},
- {0.1084594214646828},
- {0.14436649760770343},
- {0.02866290393024071},
- {0.08726107918149449},
- {0.1315241471731448},
- {0.10381511126612547},
- {0.19960350433229154},
- {0.18971056718771284},
- {0.04186737518270282},
- {0.23903459494342857},
- {0.2135374927467171},
- {0.03758239554560189},
- {0.13120980516595632},
- {0.17870425112945001},
- {0.08885538721545605},
- {0.14168343716320714},
- {0.2834611413990242},
- {0.30939066929705045},
- {0.26190181353688996},
- {0.23743283100245174},
- {0.10917570805662363},
- {0.0761560898860106},
- {0.03537102204809212},
- {0.1019278406048482},
- {0.09321310922370293},
- {0.10504360470946013},
- {0.2706183315680827},
- {0.32418137162109156},
- {0.32041247239040327},
- {0.3109047257232045},
- {0.040811562674177224},
- {0.21661150150803055},
- {0.2794340281291281},
- {0.25807252396247393},
- {0.08824351303172066},
- {0.2534612951029384},
- {0.33374958255984055},
- {0.0861207689810297},
- {0.10792343226104249},
- {0.27256609446585706},
- {0.13409899112984977},
- {0.09641560327554809},
- {0.1665124120590436},
- {0.09382531524629743},
- {0.2782881058413004},
- {0.09403987251165351},
- {0.3330751096008339},
- {0.2787529485973331},
- {0.11258292521046155},
- {0.09865154360404241},
- {0.2920072264224889},
- {0.17179834569065644},
- {0.12386228594248512},
- {0.2509989958804649},
- {0.0961851945230781},
- {0.13904051374573503},
- {0.06964030581256905},
- {0.3261377613623995},
- {0.03261817692142812},
- {0.2640456207152485},
- {0.31543518565142287},
- {0.09618520159747022},
- {0.25414357071682137},
- {0.18697914520683587},
- {0.06480431521549158},
- {0.2845642630188857},
- {0.12199475253345886},
- {0.22871146728033645},
- {0.12686462874506016},
- {0.09665176984779905},
- {0.2899569875888012},
- {0.17010352234939807},
- {0.039712170875204206},
- {0.31893747059076116},
- {0.06952008403265146},
- {0.3074316358641966},
- {0.020177769173118008},
- {0.1008621957111591},
- {0.18311092997741285},
- {0.30124037536350023},
- {0.09787411583024976},
- {0.0823333991621051},
- {0.20815468335016532},
- {0.14480548993188677},
- {0.1312645116673458},
- {0.0531560625959988},
- {0.07531306160577364},
- {0.23144445882389383},
- {0.014567440939561251},
- {0.07435324467453212},
- {0.3012714183485901},
- {0.11102215823611412},
- {0.024336773349784756},
- {0.19769767309465588},
- {0.0363745124831343},
- {0.018324182570881975},
- {0.2489509927093349},
- {0.265179192565727},
- {0.33088972366028757},
- {0.1417080314779663},
- {0.22071579391612964},
- {0.22592703643303888},
- {0.18971952668674513},
- {0.28477081919462266},
- {0.0038096764869469},
- {0.10811273728844266},
- {0.14653739728098802},
- {0.10598125313253152},
- {0.06435908490344719},
- {0.2935160882200011},
- {0.059761676602656265},
- {0.2486416434873054},
- {0.29808114429496807},
- {0.1548485620759868},
- {0.2417190927348662},
- {0.035651665459557794},
- {0.128575635724429},
- {0.2849145620963703},
- {0.11813358071783056},
- {0.008869513029350694},
- {0.14951040647446132},
- {0.2253458649442211},
- {0.3295383768072408},
- {0.31285002038973697},
- {0.3318443500811653},
- {0.27328664827556526},
- {0.2534623525184871},
- {0.19893465516973424},
- {0.21371781276740245},
- {0.15221972351881016},
- {0.09519996134667394},
- {0.2968669405498637},
- {0.3013633395827061},
- {0.13388868079109562},
- {0.04668133154846456},
- {0.15368480975816717},
- {0.1609778497473494},
- {0.1256727613181448},
- {0.24281171382842195},
- {0.24882363879036273},
- {0.21265946795470408},
- {0.18362462701292093},
- {0.08707358135913275},
- {0.28449176018715383},
- {0.12312407605303845},
- {0.2591775304447571},
- {0.13592522505111818},
- {0.24481187487173547},
- {0.21932156908954129},
- {0.1089723814718148},
- {0.27772956148851774},
- {0.20866029254488047},
- {0.08730719451294855},
- {0.19862202711732288},
- {0.30300610673367484},
- {0.06716246896662867},
- {0.03213516716097686},
- {0.04801630667540708},
- {0.2789173734481734},
- {0.29914073381318534},
- {0.14152306507664408},
- {0.28003567766625936},
- {0.01705496049455293},
- {0.2059756467242674},
- {0.06902190178809875},
- {0.28981052135200386},
- {0.1048611333088129},
- {0.019020669253533136},
- {0.31481643878466337},
- {0.014223075980164146},
- {0.1790838427377102},
- {0.3193954251663288},
- {0.009937429400702023},
- {0.18875627336289463},
- {0.22077170585297615},
- {0.18248998622346388},
- {0.27085062066554705},
- {0.1205564452001674},
- {0.034321638047154386},
- {0.09810229794019401},
- {0.30071268368481197},
- {0.04541630819926797},
- {0.15491335406208057},
- {0.1884472816774742},
- {0.011514833123775525},
- {0.056626804550882315},
- {0.3153127212695069},
- {0.2800886845649271},
- {0.05921362953954028},
- {0.26977974301941327},
- {0.20960700666952614},
- {0.20287519039383062},
- {0.09958504942045694},
- {0.30201578914371663},
- {0.02934315772395715},
- {0.29884353293176086},
- {0.32325159027917866},
- {0.23578617758222226},
- {0.13348919012991578},
- {0.2667077261268804},
- {0.06459268544128824},
- {0.3000639546301934},
- {0.1855815734406559},
- {0.1503421802113159},
- {0.22261810259623946},
- {0.18440650722186683},
- {0.3201868617917002},
- {0.2834699406976096},
- {0.18800408787801787},
- {0.16447613455238053},
- {0.09326263914693039},
- {0.1015478410756233},
- {0.029290423844759418},
- {0.017559379302633408},
- {0.12390680041342103},
- {0.11455872268378804},
- {0.02756193370118599},
- {0.05103450016768077},
- {0.1004160577985384},
- {0.2239467063465159},
- {0.13121662633227174},
- {0.055596862130110856},
- {0.3077856522752958},
- {0.16776579547976123},
- {0.3187455194589796},
- {0.20516798200542707},
- {0.2729698996623828},
- {0.009742173330020828},
- {0.050209088629558946},
- {0.2563584292126478},
- {0.3226022344551538},
- {0.16256094498735785},
- {0.1660649347635583},
- {0.2375332104863459},
- {0.2162430206041174},
- {0.008009942240737656},
- {0.2418224852400697},
- {0.18066963418920928},
- {0.27522870773165486},
- {0.0870951525827838},
- {0.20286172260376417},
- {0.2628791475186381},
- {0.21907498071496057},
- {0.09105005804886158},
- {0.27251496698877514},
- {0.06616327223372913},
- {0.021565353670119698},
- {0.011594501383439464},
- {0.18056351192583145},
- {0.23770492707678909},
- {0.14716246976276104},
- {0.10109192850416233},
- {0.22498999315058513},
- {0.26122810238366384},
- {0.24044391360235745},
- {0.22943493946641344},
- {0.10882036026134702},
- {0.1448469304665687},
- {0.028758290332950333},
- {0.08755147266220879},
- {0.1319618423661661},
- {0.10416059440470332},
- {0.2002677587390617},
- {0.19034189919106043},
- {0.04200670434206824},
- {0.2398300708725353},
- {0.21424811764802904},
- {0.037707464852083525},
- {0.13164645426981095},
- {0.17929895554968744},
- {0.08915108634519114},
- {0.14215494114715185},
- {0.2844044630754259},
- {0.31042028105753333},
- {0.26277338858445703},
- {0.2382229764702524},
- {0.10953903056156389},
- {0.07640952741196179},
- {0.03548873219224016},
- {0.10226704315302401},
- {0.09352331028343741},
- {0.10539317611385352},
- {0.27151891404982925},
- {0.3252602049081746},
- {0.3214787632728275},
- {0.3119393760658332},
- {0.04094737822733689},
- {0.21733235630922818},
- {0.280363948098255},
- {0.25893135563420144},
- {0.08853717592404453},
- {0.2543047812069575},
- {0.33486025760392196},
- {0.08640736765824955},
- {0.10828258735560342},
- {0.2734731588482722},
- {0.1345452550674465},
- {0.09673646181744305},
- {0.16706654363034112},
- {0.09413755364775955},
- {0.27921421233063876},
- {0.09435282493168706},
- {0.33418354008695145},
- {0.27968060202268424},
- {0.1129575864893218},
- {0.0989798430634776},
- {0.6951337036679403},
- {0.40897214013185057},
- {0.2948586260238733},
- {0.5975121361239172},
- {0.22897231457590816},
- {0.330990943149215},
- {0.16578125239276914},
- {0.776382669495318},
- {0.07764874317693335},
- {0.6285700957260799},
- {0.750904803129115},
- {0.22897233141675302},
- {0.6049979096071214},
- {0.4451105793123049},
- {0.15426900286444412},
- {0.6774154616216772},
- {0.29041289558341576},
- {0.5444558727868011},
- {0.30200581103570984},
- {0.23008301391539673},
- {0.6902530363936203},
- {0.40493755221871713},
- {0.09453625089823735},
- {0.7592421183764447},
- {0.16549506012225748},
- {0.7318520650368193},
- {0.048033905149910655},
- {0.2401060840985371},
- {0.43590215384983677},
- {0.7171135467646886},
- {0.23299285248464918},
- {0.1959976175805944},
- {0.4955197093775898},
- {0.344714676280528},
- {0.31247989056088077},
- {0.1265399186090683},
- {0.17928545156224004},
- {0.5509618574401312},
- {0.03467831703120247},
- {0.17700057284046558},
- {0.7171874457070635},
- {0.26429224026195025},
- {0.05793456415864995},
- {0.47062642040915603},
- {0.08659083506698294},
- {0.04362137558457256},
- {0.5926367909247148},
- {0.6312686042816755},
- {0.7876948866355953},
- {0.33734106504011285},
- {0.5254218848027553},
- {0.5378274350210563},
- {0.4516341559748777},
- {0.677907176026196},
- {0.009069071880832443},
- {0.2573662590673691},
- {0.3488375440079472},
- {0.25229218438175055},
- {0.15320911609524185},
- {0.6987256034386337},
- {0.14226482030312784},
- {0.5919003739768511},
- {0.7095928835937223},
- {0.36862257068870186},
- {0.5754209929617732},
- {0.0848700717323212},
- {0.3060789246813616},
- {0.6782493611730911},
- {0.2812212372207813},
- {0.021114194731958753},
- {0.35591489930842124},
- {0.5364439353918259},
- {0.7844779568547573},
- {0.7447507242559114},
- {0.7899674091607876},
- {0.6505686941594157},
- {0.6033762451880054},
- {0.473571100723252},
- {0.5087629390166845},
- {0.3623645259650027},
- {0.2266269315685046},
- {0.7067024279132842},
- {0.7174062675105497},
- {0.3187268195303851},
- {0.11112658850601694},
- {0.3658522164452501},
- {0.3832135604119356},
- {0.29916852776397973},
- {0.5780220167678423},
- {0.5923336203406976},
- {0.5062435111298406},
- {0.43712502811644594},
- {0.20728179176713737},
- {0.6772428660233913},
- {0.293101290834528},
- {0.6169814317708239},
- {0.3235748863796107},
- {0.5827834720612781},
- {0.5221028824639231},
- {0.2594126729604263},
- {0.6611452088389751},
- {0.49672333024833637},
- {0.2078379162809964},
- {0.472826878401751},
- {0.721316933790653},
- {0.1598826726729942},
- {0.0764989210721733},
- {0.11430454480410349},
- {0.6639728379250508},
- {0.7121152745468161},
- {0.33690074587000024},
- {0.666635001332681},
- {0.0405999467880838},
- {0.490332434327085},
- {0.1643091193734608},
- {0.6899043682497029},
- {0.24962569885961883},
- {0.04527938717969044},
- {0.7494318539614079},
- {0.03385854386129871},
- {0.4263155278535398},
- {0.7603322957125543},
- {0.023656408058388628},
- {0.449341096796918},
- {0.5255549851791246},
- {0.4344239749131707},
- {0.6447696428292979},
- {0.28698895325208085},
- {0.08170389364662482},
- {0.23353604820326065},
- {0.7158573577467133},
- {0.10811515493046168},
- {0.36877681034164866},
- {0.4486055309778101},
- {0.027411474347786572},
- {0.134802144647554},
- {0.7506132722638977},
- {0.6667611861611946},
- {0.14096017456050175},
- {0.642220380081755},
- {0.498977017267806},
- {0.4829516865338131},
- {0.23706579142476236},
- {0.7189594471539382},
- {0.06985244220105356},
- {0.7114077771606416},
- {0.7695120354391736},
- {0.5612974750813012},
- {0.31777581764495605},
- {0.634907333393153},
- {0.15376521057631926},
- {0.7143130349025878},
- {0.44178360946341216},
- {0.3578949666012659},
- {0.5299503990266162},
- {0.438986322071832},
- {0.7622163390609092},
- {0.6748103879818402},
- {0.44755049220006077},
- {0.39154135319569416},
- {0.2220150664019988},
- {0.2417382875458352},
- {0.06972690730520663},
- {0.04180073390063776},
- {0.29496459432276645},
- {0.2727111591116332},
- {0.065612174358436},
- {0.12148946295279045},
- {0.23904403675352373},
- {0.5331131880334217},
- {0.3123658977986837},
- {0.13235032967609942},
- {0.7326948138345857},
- {0.39937250933617024},
- {0.7587851718042886},
- {0.48840975941863224},
- {0.6498146626948154},
- {0.023191593960329663},
- {0.11952454110282666},
- {0.6102704599072178},
- {0.7679662205479364},
- {0.38698217556207565},
- {0.39532354923486507},
- {0.5654563497363968},
- {0.5147742870835548},
- {0.01906795555776503},
- {0.5756671225386132},
- {0.43009056143209456},
- {0.6551918365350146},
- {0.20733314284078347},
- {0.48291962597523097},
- {0.6257932643328186},
- {0.521515869970418},
- {0.21674793752916416},
- {0.6487316791049954},
- {0.1575040489171957},
- {0.05133709994536218},
- {0.027601127504947986},
- {0.42983793356775285},
- {0.5658651272552219},
- {0.35032555152967587},
- {0.24065297127393617},
- {0.5355967697892074},
- {0.621862892014097},
- {0.5723853831788208},
- {0.5461781243432774},
- {0.2590507810019182},
- {0.3448133269636236},
- {0.06846014434375004},
- {0.20841942920004566},
- {0.3141399113668418},
- {0.2479580408055931},
- {0.47674460171113087},
- {0.4531157361031717},
- {0.0999984703321616},
- {0.5709241084854557},
- {0.5100253488558499},
- {0.08976397611692398},
- {0.3133891186614759},
- {0.42682761163834254},
- {0.2122273670977216},
- {0.3384049495793828},
- {0.6770350521095426},
- {0.7389666423972705},
- {0.6255415013866957},
- {0.5670983624664631},
- {0.2607616014964189},
- {0.18189562784499425},
- {0.08448220323006246},
- {0.24345037395504585},
- {0.2226356034167139},
- {0.2508922458903511},
- {0.6463605392637606},
- {0.7742936147973344},
- {0.7652917569961174},
- {0.7425829026942508},
- {0.09747670642053854},
- {0.5173674899042815},
- {0.6674164609013139},
- {0.6163954037813532},
- {0.21076593126272433},
- {0.6053816769763449},
- {0.7971468854768311},
- {0.20569584609379565},
- {0.2577705932603965},
- {0.6510126892850413},
- {0.3202898182069745},
- {0.23028462619482842},
- {0.39770791516211795},
- {0.22409783183491383},
- {0.6646794735596848},
- {0.22461029286789314},
- {0.7955359350915552},
- {0.6657897309939138},
- {0.26889959682061726},
- {0.23562507592753099},
- {0.2580796639295252},
- {0.15183754136051186},
- {0.10947104810114876},
- {0.22183607336400435},
- {0.08500968616987703},
- {0.1228857569715414},
- {0.06154897925044301},
- {0.2882446605117765},
- {0.028828355520545596},
- {0.23336684468780688},
- {0.27878558932196695},
- {0.08500969242231389},
- {0.22461528820368756},
- {0.16525452314317693},
- {0.05727486986160777},
- {0.2515014791449389},
- {0.1078204985565929},
- {0.20213807492262792},
- {0.11212455647826239},
- {0.08542205131740106},
- {0.2562676370298627},
- {0.1503396351487696},
- {0.03509811671083789},
- {0.28188095285527254},
- {0.061442725727411183},
- {0.2717119512321272},
- {0.017833366491798494},
- {0.08914327871690374},
- {0.16183574581137156},
- {0.26624003723569745},
- {0.08650237608956975},
- {0.07276729499559768},
- {0.18396973041565154},
- {0.12798091552262159},
- {0.11601322841225699},
- {0.04697999751123847},
- {0.06656263225691449},
- {0.20455352726510873},
- {0.012874887748687691},
- {0.06571433396620614},
- {0.26626747341684104},
- {0.09812278153983464},
- {0.02150914675705354},
- {0.17472769306776478},
- {0.03214825219313354},
- {0.01619514331071456},
- {0.22002602237106383},
- {0.2343687097642149},
- {0.2924445046316283},
- {0.12524334273506713},
- {0.19507139811463975},
- {0.19967715987573162},
- {0.16767650680446625},
- {0.25168403609419615},
- {0.0033670400540325436},
- {0.09555139866824024},
- {0.12951159704749052},
- {0.0936675661296826},
- {0.05688136970508286},
- {0.2594132149871098},
- {0.05281812235414828},
- {0.21975261563303083},
- {0.26344786903345285},
- {0.13685710915496418},
- {0.2136343781030469},
- {0.03150939089095751},
- {0.1136367659931656},
- {0.2518110778809005},
- {0.10440794628259628},
- {0.007838987308216432},
- {0.1321391800114849},
- {0.19916351319528094},
- {0.291250167265532},
- {0.2765007877089655},
- {0.29328821548391354},
- {0.24153418121693582},
- {0.22401321898148815},
- {0.1758209534029086},
- {0.18888649425052917},
- {0.13453370853343463},
- {0.08413892468162977},
- {0.26237474047318526},
- {0.26634871456110754},
- {0.1183325021297222},
- {0.04125754867579757},
- {0.1358285702014605},
- {0.14227425078441125},
- {0.11107116903728922},
- {0.21460005038479785},
- {0.21991346537372125},
- {0.1879511157774377},
- {0.16228975772028817},
- {0.07695672771396345},
- {0.2514374002292335},
- {0.10881860890465367},
- {0.22906436520338044},
- {0.12013242559272506},
- {0.21636781790270312},
- {0.1938391646555694},
- {0.0963111630229164},
- {0.24546088386369785},
- {0.184416594189026},
- {0.07716319796117256},
- {0.17554464879329415},
- {0.26780061285633344},
- {0.059359035842853285},
- {0.02840146541176594},
- {0.04243741650419549},
- {0.24651068703163684},
- {0.2643843475929564},
- {0.12507986710031546},
- {0.2474990583822726},
- {0.015073388856470318},
- {0.18204387040529618},
- {0.06100242598611712},
- {0.25613818832534685},
- {0.09267759012392497},
- {0.01681070701162768},
- {0.2782387330493085},
- {0.01257053366101959},
- {0.15827655539622196},
- {0.28228569887613464},
- {0.008782825245379083},
- {0.16682517138669595},
- {0.19512081378851806},
- {0.16128694790214987},
- {0.2393811893385536},
- {0.10654930442297181},
- {0.030333895914975324},
- {0.0867040463118126},
- {0.26577365668490505},
- {0.040139505109467136},
- {0.13691437312819274},
- {0.1665520806440205},
- {0.010176954519916239},
- {0.05004748295766527},
- {0.2786773537590481},
- {0.2475459065468256},
- {0.052333751458265396},
- {0.23843473418944716},
- {0.18525331205426265},
- {0.17930364805672463},
- {0.0880145207422077},
- {0.2669253576993596},
- {0.025933852311836793},
- {0.264121677711333},
- {0.28569382616316674},
- {0.20839079297854252},
- {0.11797942725262615},
- {0.23571964697423006},
- {0.057087828802134616},
- {0.2652003017770541},
- {0.16401933161674784},
- {0.13287431211455913},
- {0.19675268248170072},
- {0.16298079329509257},
- {0.28298518053211885},
- {0.25053430329670534},
- {0.1661603803829665},
- {0.1453660789486428},
- {0.08242669492499483},
- {0.08974926072427958},
- {0.025887245445329457},
- {0.015519200551146639},
- {0.10951039055112813},
- {0.10124844173428556},
- {0.024359584089738526},
- {0.04510493392047092},
- {0.08874897641156015},
- {0.19792691920716707},
- {0.11597090675010337},
- {0.04913720687622721},
- {0.27202483539434935},
- {0.14827352270262764},
- {0.2817113040277829},
- {0.18133004615594536},
- {0.24125423480382208},
- {0.008610255471271186},
- {0.04437542480875523},
- {0.22657280803378693},
- {0.2851199173086217},
- {0.1436734102932882},
- {0.14677028058288133},
- {0.20993484265941484},
- {0.19111830473630356},
- {0.007079287820752634},
- {0.21372575770115704},
- {0.15967809785076748},
- {0.2432505978203852},
- {0.07697579263307049},
- {0.1792917450542654},
- {0.2323359009873642},
- {0.1936212267448526},
- {0.08047118788771268},
- {0.24085215957796674},
- {0.05847593318753375},
- {0.019059731143959157},
- {0.010247366331061526},
- {0.15958430565800727},
- {0.21008660794445808},
- {0.13006404397835578},
- {0.0893463194523617},
- {0.19884898922260816},
- {0.2308766865056303},
- {0.2125073587275344},
- {0.2027774887512945},
- {0.0961768047627173},
- {0.12801754118902992},
- {0.025416939146489348},
- {0.07737909406565868},
- {0.11662953806528899},
- {0.09205844501865769},
- {0.17699916712511798},
- {0.1682265674612538},
- {0.037126054283679114},
- {0.21196483679285846},
- {0.18935518438210244},
- {0.0333263322825446},
- {0.11635079409408007},
- {0.15846667480834123},
- {0.07879285278245104},
- {0.12563832712858136},
- {0.2513602459425647},
- {0.27435335348970347},
- {0.23224242990952343},
- {0.21054446652214434},
- {0.09681197462419104},
- {0.06753170254410605},
- {0.03136538841750011},
- {0.09038490057712502},
- {0.08265707935804485},
- {0.09314781625498084},
- {0.2399718354473329},
- {0.2874690650665533},
- {0.28412697932992326},
- {0.275695948787848},
- {0.036189808523493426},
- {0.19208107335037428},
- {0.2477891879239465},
- {0.22884679280575698},
- {0.07825027102133011},
- {0.22475776806497716},
- {0.29595371253154285},
- {0.07636791965556144},
- {0.09570151429650156},
- {0.24169902160980297},
- {0.11891279074333425},
- {0.0854969031466898},
- {0.1476555151125027},
- {0.08319995537853704},
- {0.2467730369740216},
- {0.08339021485016157},
- {0.2953556210682094},
- {0.24718523805704942},
- {0.09983333740267089},
- {0.0874796317426072},
- {0.47186084396951344},
- {0.27761269261491184},
- {0.2001517684916891},
- {0.405594750111757},
- {0.15542775300829356},
- {0.2246785977381706},
- {0.11253328856824174},
- {0.5270131195456527},
- {0.052708423279303564},
- {0.42667707564498725},
- {0.5097185941001683},
- {0.15542776443995804},
- {0.410676137152712},
- {0.3021436775483886},
- {0.10471870592067387},
- {0.4598335971226254},
- {0.19713398053719028},
- {0.36957984669962224},
- {0.20500331968809382},
- {0.1561817022485074},
- {0.4685478183356778},
- {0.2748739906246113},
- {0.06417176278344404},
- {0.5153780126958809},
- {0.11233901957281163},
- {0.4967854834932119},
- {0.032605697153788755},
- {0.16298542120333095},
- {0.29589294421834966},
- {0.4867808906586947},
- {0.1581569177730281},
- {0.13304433486622003},
- {0.3363616913360451},
- {0.23399434845430492},
- {0.21211318643527122},
- {0.08589604053960692},
- {0.12170001834068109},
- {0.3739961473237674},
- {0.023539845436126607},
- {0.12014902923407392},
- {0.4868310536951486},
- {0.17940312617063064},
- {0.03932632268390942},
- {0.31946398046424823},
- {0.0587783678149052},
- {0.02961044614847214},
- {0.40228533713379366},
- {0.42850883911406307},
- {0.5346919190324454},
- {0.22898909780303248},
- {0.35665946377635693},
- {0.365080424183004},
- {0.3065719197318116},
- {0.4601673757506562},
- {0.006156139299719504},
- {0.17470172942559065},
- {0.23679297530144167},
- {0.17125741770413797},
- {0.10399924855184112},
- {0.47429904664665323},
- {0.09657019623878307},
- {0.40178545298100576},
- {0.481675820292609},
- {0.2502231677065561},
- {0.3905991522839755},
- {0.05761030354887854},
- {0.20776817317207777},
- {0.4603996530396954},
- {0.19089462881307365},
- {0.014332439490975879},
- {0.24159712567932215},
- {0.3641412965026232},
- {0.532508248188452},
- {0.5055411691880366},
- {0.5362345206801842},
- {0.44160985356688587},
- {0.4095753418130503},
- {0.3214628467699647},
- {0.34535127345731476},
- {0.24597517016400816},
- {0.15383569323696378},
- {0.479713761986946},
- {0.48697959122156564},
- {0.2163536385385345},
- {0.0754333814677908},
- {0.24834263496226247},
- {0.2601276172949254},
- {0.20307735512600336},
- {0.3923647425320681},
- {0.40207954315935934},
- {0.34364107099880414},
- {0.2967230384584449},
- {0.1407040986311844},
- {0.45971643821601105},
- {0.1989588790357379},
- {0.418810622435263},
- {0.21964453481219437},
- {0.39559684637256465},
- {0.35440650548002567},
- {0.17609084720479445},
- {0.4487892538989648},
- {0.3371787162578594},
- {0.14108159922003086},
- {0.3209576642836726},
- {0.4896341744789675},
- {0.10852929798325346},
- {0.051927917276064155},
- {0.07759059688261072},
- {0.4507086651430868},
- {0.48338803409790665},
- {0.22869020656221223},
- {0.452515757312091},
- {0.027559482521788282},
- {0.33284053854152823},
- {0.1115339960216987},
- {0.46831114035015353},
- {0.16944739165840533},
- {0.03073591416484858},
- {0.508718747547295},
- {0.0229833785898591},
- {0.2893854861429265},
- {0.516118031479575},
- {0.016058108839807756},
- {0.305015377683462},
- {0.3567498130941858},
- {0.294889547667567},
- {0.4376734234378139},
- {0.19480978835712243},
- {0.0554610832538601},
- {0.15852564221966645},
- {0.48592818216955175},
- {0.07338920265582742},
- {0.25032786648958016},
- {0.3045160712818763},
- {0.01860706990891913},
- {0.09150448813899005},
- {0.5095207012352724},
- {0.45260141231538653},
- {0.0956845950401238},
- {0.4359429689004947},
- {0.33870853225360065},
- {0.32783044355622876},
- {0.16092165266586556},
- {0.48803389869291747},
- {0.04741624835107379},
- {0.4829077807135793},
- {0.522349292763508},
- {0.38101202533022116},
- {0.21570809286882042},
- {0.43097882982298485},
- {0.10437672875425887},
- {0.4848798867455989},
- {0.29988531085939607},
- {0.24294120699632363},
- {0.35973344584962397},
- {0.2979864957358428},
- {0.5173969311786386},
- {0.45806525782356683},
- {0.3037999047581378},
- {0.2657805719863939},
- {0.1507051320539017},
- {0.16409337049726985},
- {0.04733103452589254},
- {0.02837458387188494},
- {0.20022370039584783},
- {0.18511793777127764},
- {0.044537929615675396},
- {0.08246776155410077},
- {0.162264497222938},
- {0.3618803656179706},
- {0.21203580747825487},
- {0.08984018172486702},
- {0.4973575463307207},
- {0.27109640680522645},
- {0.5150678346768195},
- {0.3315354155123981},
- {0.4410980125766009},
- {0.01574259029791901},
- {0.08113396105275009},
- {0.4142551752878902},
- {0.5212999845292058},
- {0.2626857754103472},
- {0.26834794888911684},
- {0.38383509389150944},
- {0.34943181185915134},
- {0.012943440311963605},
- {0.39076622648745724},
- {0.291948001125283},
- {0.44474806978576653},
- {0.14073895604181136},
- {0.32780868066061475},
- {0.4247921461733309},
- {0.35400803794903934},
- {0.14712977401541538},
- {0.44036287695017223},
- {0.10691467419652773},
- {0.034847925196758195},
- {0.01873580758676077},
- {0.29177651584604897},
- {0.38411257447403735},
- {0.2378030435535362},
- {0.1633566514325347},
- {0.36356623551201933},
- {0.422124186341085},
- {0.3885385625203259},
- {0.3707489211793642},
- {0.17584519281619787},
- {0.2340613131178481},
- {0.046471148381761966},
- {0.14147633360755069},
- {0.21324001831577788},
- {0.16831537556902143},
- {0.32361703789402785},
- {0.3075776250314631},
- {0.06787954944151893},
- {0.3875466406692572},
- {0.34620820467644686},
- {0.060932314610980455},
- {0.2127303758142983},
- {0.28973309162602295},
- {0.1440611842351347},
- {0.2297112688816856},
- {0.45957537290978306},
- {0.501614900424192},
- {0.42462124800566775},
- {0.38494970178424925},
- {0.1770065078238803},
- {0.12347182134374474},
- {0.05734701612969677},
- {0.16525554481529828},
- {0.15112635622693887},
- {0.170307131227491},
- {0.438753333288642},
- {0.5255950569374269},
- {0.5194845429500274},
- {0.5040696391697639},
- {0.06616776127565735},
- {0.3511920931764225},
- {0.4530462166606126},
- {0.418412823191402},
- {0.1430691530001789},
- {0.41093664069868346},
- {0.5411079914036894},
- {0.13962754938610522},
- {0.17497619385244972},
- {0.4419112400679152},
- {0.2174146112273383},
- {0.1563185578488405},
- {0.26996647049557765},
- {0.15211892547203137},
- {0.4511883335654032},
- {0.1524667870334075},
- {0.5400144688131743},
- {0.45194198283772935},
- {0.18253062688419067},
- {0.15994368651797713},
- {0.2020574432278686},
- {0.118877655550918},
- {0.08570779948331526},
- {0.17368137077193638},
- {0.06655634766240008},
- {0.09621053237875922},
- {0.048188335304193954},
- {0.22567442254186634},
- {0.022570487423356628},
- {0.1827091187806636},
- {0.21826866375087062},
- {0.06655635255759944},
- {0.17585729209846399},
- {0.12938216796992244},
- {0.04484202121638536},
- {0.19690720714023582},
- {0.08441554028002927},
- {0.15825928310656368},
- {0.08778530187191773},
- {0.06687919932035846},
- {0.200638759102079},
- {0.11770490487877502},
- {0.02747925046369336},
- {0.220692106310728},
- {0.048105146590790994},
- {0.21273052407341586},
- {0.013962217644790225},
- {0.06979264737188073},
- {0.12670551613260983},
- {0.20844641685300616},
- {0.06772501436055373},
- {0.05697145351767661},
- {0.14403480225105075},
- {0.10019966772556053},
- {0.0908298467096291},
- {0.03678189143397471},
- {0.05211365778909915},
- {0.16015040508467393},
- {0.010080092560319035},
- {0.05144950246161118},
- {0.20846789737002716},
- {0.07682293931442723},
- {0.016840083924357714},
- {0.136798965035917},
- {0.02516972295873383},
- {0.012679609079797531},
- {0.17226423363615065},
- {0.18349350563515662},
- {0.2289625923724214},
- {0.09805634907084276},
- {0.1527265936020947},
- {0.15633256716619945},
- {0.13127840349149933},
- {0.19705013583848643},
- {0.002636145344444582},
- {0.07480973517163131},
- {0.10139807906336983},
- {0.07333483249850026},
- {0.044533939462377416},
- {0.20310151587197642},
- {0.041352714880666684},
- {0.17205017621834764},
- {0.20626035399389708},
- {0.10714907615100078},
- {0.1672600450877254},
- {0.024669541428234913},
- {0.08896925098109526},
- {0.19714960023724504},
- {0.08174376220628886},
- {0.0061373519667417605},
- {0.1034552837554791},
- {0.15593041949832784},
- {0.2280275138355444},
- {0.2164798317089471},
- {0.22962315607217465},
- {0.18910354409852984},
- {0.17538591606739082},
- {0.13765490767292354},
- {0.1478842676227273},
- {0.10533002391715839},
- {0.06587460529921806},
- {0.20542017305968102},
- {0.20853150322585265},
- {0.09264566788035326},
- {0.03230163381473343},
- {0.106343805607631},
- {0.1113903006263559},
- {0.0869605767858315},
- {0.16801609563923225},
- {0.17217610976480735},
- {0.1471519349009408},
- {0.12706097414938616},
- {0.06025147198468501},
- {0.19685703805029242},
- {0.08519698745768645},
- {0.17934059298933677},
- {0.0940548759031889},
- {0.16940012791612935},
- {0.15176184520460925},
- {0.075404574922366},
- {0.19217786419427169},
- {0.14438466380210987},
- {0.060413123040868544},
- {0.1374385814342703},
- {0.20966823307466542},
- {0.04647377027797732},
- {0.022236263786337175},
- {0.033225383765128604},
- {0.192999783057527},
- {0.20699354800263803},
- {0.09792835964197791},
- {0.19377360531468737},
- {0.01180135763796382},
- {0.14252699515078476},
- {0.04776042419529041},
- {0.2005374102632539},
- {0.07255975391410258},
- {0.013161550297701293},
- {0.2178405154086724},
- {0.00984180563815782},
- {0.12391893115223475},
- {0.22100899275147592},
- {0.006876307828280036},
- {0.13061187031633614},
- {0.1527652824494343},
- {0.1262758476314279},
- {0.18741790940878894},
- {0.0834202885326623},
- {0.02374921510047348},
- {0.06788290734933534},
- {0.20808127509704802},
- {0.03142628772589249},
- {0.1071939096409529},
- {0.1303980602997156},
- {0.007967808772031359},
- {0.03918350749704022},
- {0.2181839232456455},
- {0.19381028399058678},
- {0.04097348800433746},
- {0.18667690446230653},
- {0.14503975250603413},
- {0.1403816020841717},
- {0.06890891268733608},
- {0.20898297249854175},
- {0.02030430376184089},
- {0.20678789675571027},
- {0.22367730638505573},
- {0.16315470262302675},
- {0.0923692361543979},
- {0.1845511903611085},
- {0.044695581788805755},
- {0.2076323802675269},
- {0.12841510362270933},
- {0.10403083826031785},
- {0.15404291591658784},
- {0.12760200430766555},
- {0.22155663557168498},
- {0.19614997940648},
- {0.13009138773181472},
- {0.11381097525159542},
- {0.06453405501495077},
- {0.07026708682669144},
- {0.02026781400460877},
- {0.012150395488586483},
- {0.08573860173534904},
- {0.07927010193729216},
- {0.01907176723777396},
- {0.03531385420364254},
- {0.06948393759419623},
- {0.15496225712650502},
- {0.09079671195302833},
- {0.0384708281063189},
- {0.21297548941815675},
- {0.11608729041069851},
- {0.22055928372483635},
- {0.1419681231321926},
- {0.18888436659491212},
- {0.006741198355477195},
- {0.03474270208851518},
- {0.1773898865149142},
- {0.22322797785591256},
- {0.11248573987455965},
- {0.1149103621140493},
- {0.1643635802462519},
- {0.14963161149964685},
- {0.005542563002275445},
- {0.16733158860911795},
- {0.12501623607207574},
- {0.19044737237669107},
- {0.06026639841767651},
- {0.1403722829064921},
- {0.18190196549686122},
- {0.15159121580920723},
- {0.06300303646761093},
- {0.18856957119071557},
- {0.045782365686368995},
- {0.01492237119702162},
- {0.008022936054500796},
- {0.12494280366606858},
- {0.16448240133040737},
- {0.10183060448079363},
- {0.06995161337196414},
- {0.15568417030230638},
- {0.18075950761075385},
- {0.16637767159879174},
- {0.1587598972247694},
- {0.07529938226162314},
- {0.10022834293537097},
- {0.0198995986759359},
- {0.06058215385178604},
- {0.09131237195331626},
- {0.07207500871933388},
- {0.13857736257952413},
- {0.13170906063138577},
- {0.02906697680661793},
- {0.16595291672525164},
- {0.1482512176109979},
- {0.02609207324065709},
- {0.09109413587349467},
- {0.12406778070409753},
- {0.06168902320873849},
- {0.09836559287352453},
- {0.19679663190413968},
- {0.21479854825856795},
- {0.1818287845002779},
- {0.16484087100662523},
- {0.0757966736648692},
- {0.0528723687295764},
- {0.024556798056044084},
- {0.07076474619870132},
- {0.06471442912421922},
- {0.07292790647728177},
- {0.18788034198009385},
- {0.2250671882086576},
- {0.22245058026400294},
- {0.21584970187951702},
- {0.0283339650626639},
- {0.15038538869238335},
- {0.1940007554608977},
- {0.1791702497638715},
- {0.06126422149548103},
- {0.17596884337703161},
- {0.23171004471026},
- {0.05979047847197971},
- {0.07492726469555114},
- {0.18923260203287567},
- {0.09309999129280437},
- {0.06693780281129892},
- {0.11560343580683416},
- {0.06513946122097647},
- {0.19320518381550272},
- {0.06528842042915661},
- {0.2312417829725565},
- {0.1935279070229969},
- {0.07816217906265287},
- {0.06849013384198119},
- {0.166464367968083},
- {0.097936970203539},
- {0.07061009207582343},
- {0.14308683289026713},
- {0.05483223073050016},
- {0.07926273444052963},
- {0.03969980344055116},
- {0.18592113962675602},
- {0.01859462271540028},
- {0.15052431374937675},
- {0.17981992931362292},
- {0.054832234763394244},
- {0.14487945860393714},
- {0.1065910786229475},
- {0.03694295345397803},
- {0.1622213627042415},
- {0.06954546853070935},
- {0.13038139608500446},
- {0.07232163566732025},
- {0.055098211019723564},
- {0.1652955896614131},
- {0.09697080337343483},
- {0.022638691193952804},
- {0.1818164745909907},
- {0.03963126868935625},
- {0.1752573509378944},
- {0.011502727633011326},
- {0.05749844572900651},
- {0.10438592770521385},
- {0.17172790312661654},
- {0.055795032991905115},
- {0.04693574683783301},
- {0.11866260375812784},
- {0.08254917063231863},
- {0.07482987403787393},
- {0.0303026417261067},
- {0.04293366761344259},
- {0.13193939078100614},
- {0.00830445149808691},
- {0.04238650540522718},
- {0.17174559978075807},
- {0.06329032889921628},
- {0.013873648415101013},
- {0.11270138278306681},
- {0.020735994464367708},
- {0.010446054734893061},
- {0.1419193290662846},
- {0.15117052831039343},
- {0.18863008765594483},
- {0.0807834045238688},
- {0.1258233078165786},
- {0.1287940774188712},
- {0.10815328609511644},
- {0.16233911404781343},
- {0.0021717797752201164},
- {0.061631757208574264},
- {0.08353647791844138},
- {0.060416663434373054},
- {0.03668914130212578},
- {0.16732452382296123},
- {0.03406829976865255},
- {0.14174297855825968},
- {0.1699269223442867},
- {0.08827441817981124},
- {0.13779664459300195},
- {0.020323921535928678},
- {0.07329702829338329},
- {0.16242105746949675},
- {0.06734433284725615},
- {0.0050562374729704},
- {0.08523129931864463},
- {0.1284627693695726},
- {0.18785972624210567},
- {0.1783462058491325},
- {0.18917429091332288},
- {0.15579234026724817},
- {0.14449111699258949},
- {0.11340654834296923},
- {0.12183397329480214},
- {0.08677579790841636},
- {0.054270579500081594},
- {0.1692347420120067},
- {0.1717980012583771},
- {0.076325832408419},
- {0.02661159604619025},
- {0.0876109986595801},
- {0.09176853718093388},
- {0.07164218858529446},
- {0.13841951438288927},
- {0.14184672850125857},
- {0.12123064336185303},
- {0.10467877063718707},
- {0.04963797939265377},
- {0.1621800310625284},
- {0.07018926124851803},
- {0.1477491647230425},
- {0.0774868038584652},
- {0.13955974487645872},
- {0.12502850298449664},
- {0.06212181400413946},
- {0.15832510888736825},
- {0.11895083606000703},
- {0.04977115508996584},
- {0.11322832867425989},
- {0.17273449245023917},
- {0.03828726461560197},
- {0.018319273658183446},
- {0.02737262444087139},
- {0.1590022440718343},
- {0.17053096184569425},
- {0.08067796084883153},
- {0.15963975502367075},
- {0.009722510138631724},
- {0.11742040177856251},
- {0.03934727026408303},
- {0.16521209374990495},
- {0.059778117461424904},
- {0.010843100441076938},
- {0.17946720069327593},
- {0.008108139591636162},
- {0.10209020872482286},
- {0.18207754045540073},
- {0.00566502385808048},
- {0.1076041649048212},
- {0.12585518149773045},
- {0.10403194670682825},
- {0.1544036356059883},
- {0.06872553361295561},
- {0.019565713681628447},
- {0.055925112617600865},
- {0.17142708227758807},
- {0.025890445015550347},
- {0.08831135410481089},
- {0.10742801821745641},
- {0.006564253363490107},
- {0.032281205315023064},
- {0.17975011612377825},
- {0.15966997263161414},
- {0.03375587493897942},
- {0.153793161088906},
- {0.11949052875986367},
- {0.11565292667261406},
- {0.05677038378105691},
- {0.17216994275152192},
- {0.016727634670379906},
- {0.17036153673422696},
- {0.18427582197108613},
- {0.13441447154477673},
- {0.07609809502932334},
- {0.1520418984346631},
- {0.03682230980745739},
- {0.17105726173108088},
- {0.10579436580320865},
- {0.08570546802705058},
- {0.1269077556776617},
- {0.1051244965748754},
- {0.18252871421313036},
- {0.16159752309658393},
- {0.10717536701899898},
- {0.09376280210436183},
- {0.053166171504834776},
- {0.057889311132045},
- {0.016697572702466634},
- {0.010010063837583141},
- {0.07063546841106198},
- {0.06530641587340869},
- {0.01571221346045696},
- {0.029093204024644412},
- {0.05724411618188923},
- {0.12766515194582734},
- {0.07480257607632791},
- {0.031694066715003695},
- {0.17545916484108423},
- {0.09563813695074477},
- {0.18170704913524344},
- {0.116959976882237},
- {0.15561177159316372},
- {0.005553714357983213},
- {0.028622662210695555},
- {0.14614208153338834},
- {0.18390564412255475},
- {0.09267101124566816},
- {0.09466852839826734},
- {0.13541040144612657},
- {0.12327351686938003},
- {0.00456622251750738},
- {0.137855585490603},
- {0.10299421981707252},
- {0.15689944882711188},
- {0.04965027648596672},
- {0.11564524909836768},
- {0.14985934313955862},
- {0.12488793051159672},
- {0.051904846850028954},
- {0.15535242842242125},
- {0.03771765318969417},
- {0.012293747016762809},
- {0.006609669796002933},
- {0.10293372276802012},
- {0.13550829181016982},
- {0.08389281257798861},
- {0.057629409351576226},
- {0.12825989776967744},
- {0.14891813292278605},
- {0.13706970406163294},
- {0.13079382539941994},
- {0.06203515137243578},
- {0.08257279461073384},
- {0.01639421970054547},
- {0.049910410574233156},
- {0.07522740089180155},
- {0.05937876170801306},
- {0.11416650982002875},
- {0.10850808158028591},
- {0.023946734381865224},
- {0.136719771139412},
- {0.12213628385014494},
- {0.021495869746726827},
- {0.07504760780665216},
- {0.1022128379444019},
- {0.050822301296915104},
- {0.08103817402574463},
- {0.16213026565532504},
- {0.17696108594228036},
- {0.14979905321334305},
- {0.1358036158879868},
- {0.06244484327892971},
- {0.04355872915613757},
- {0.02023103827513649},
- {0.05829930618840921},
- {0.05331477212858571},
- {0.06008141875419808},
- {0.15478460917706982},
- {0.18542087159469883},
- {0.18326518764280408},
- {0.1778270754369179},
- {0.023342845038710057},
- {0.1238945137600322},
- {0.15982689193344604},
- {0.147608828010315},
- {0.050472329785945264},
- {0.14497135976227185},
- {0.19089356733595325},
- {0.04925819138532295},
- {0.061728583524914615},
- {0.1558986642270536},
- {0.07670012527533154},
- {0.055146491315288454},
- {0.09523951490775527},
- {0.053664933440253165},
- {0.1591714628187925},
- {0.05378765299983291},
- {0.19050779142507754},
- {0.1594373372845184},
- {0.0643936572136041},
- {0.05642537419023579},
- {0.6107508013498774},
- {0.3593266460787521},
- {0.25906547356108295},
- {0.5249796032451968},
- {0.20117716041714898},
- {0.2908116563781255},
- {0.14565691781798115},
- {0.6821368825110696},
- {0.06822289275988976},
- {0.5522674093395106},
- {0.6597517971415409},
- {0.20117717521366862},
- {0.5315566719867443},
- {0.39107820778915897},
- {0.1355421505614607},
- {0.5951833925605093},
- {0.2551594143169867},
- {0.4783638871911627},
- {0.2653450553887829},
- {0.20215303096992465},
- {0.6064626026433779},
- {0.35578182040268347},
- {0.08306041080737547},
- {0.6670770382304777},
- {0.1454054666832817},
- {0.6430118879753216},
- {0.04220302642135427},
- {0.21095939169454184},
- {0.38298760133359916},
- {0.6300624916247834},
- {0.2047096416314308},
- {0.17220529139700191},
- {0.43536812844797634},
- {0.30286945326415476},
- {0.27454767702782273},
- {0.11117912465679385},
- {0.15752183016624294},
- {0.4840801045456437},
- {0.03046868509542077},
- {0.15551431491709364},
- {0.6301274199084161},
- {0.23220956871866466},
- {0.05090183557356872},
- {0.41349665810280134},
- {0.07607949611371143},
- {0.03832613776843747},
- {0.520696080562354},
- {0.5546383435268232},
- {0.6920758994901234},
- {0.29639093129037736},
- {0.4616404520407746},
- {0.47254008141715825},
- {0.3968098816431388},
- {0.5956154173134605},
- {0.007968169129897293},
- {0.22612433857890252},
- {0.3064918423888571},
- {0.2216662103598297},
- {0.13461092439559544},
- {0.6139066771932494},
- {0.12499516646302263},
- {0.520049057926763},
- {0.6234547684858918},
- {0.3238751469765051},
- {0.5055701237194284},
- {0.07456761778004314},
- {0.26892373012422527},
- {0.5959160642991748},
- {0.247083539588008},
- {0.018551123739730578},
- {0.31271007119634303},
- {0.4713245260459237},
- {0.689249475694002},
- {0.6543447674096392},
- {0.6940725584724503},
- {0.5715955782239128},
- {0.5301318628625865},
- {0.41608388103856686},
- {0.44700375059067887},
- {0.3183767719017318},
- {0.1991164855517444},
- {0.6209151878069823},
- {0.6303196787373678},
- {0.2800362856997497},
- {0.09763683248733566},
- {0.32144108851367525},
- {0.3366949234007105},
- {0.26285219247230784},
- {0.5078554069181923},
- {0.5204297121268181},
- {0.44479015830949065},
- {0.3840620297987142},
- {0.18211966958156897},
- {0.595031748496344},
- {0.2575214628628969},
- {0.5420855036717227},
- {0.28429584137592895},
- {0.5120388648928422},
- {0.4587243463658119},
- {0.2279223364582792},
- {0.5808882003222875},
- {0.43642564070418116},
- {0.1826082856430511},
- {0.4154300005306289},
- {0.6337556257383292},
- {0.14047437196864393},
- {0.06721264858932734},
- {0.10042901382665169},
- {0.5833725809833435},
- {0.6256709641440664},
- {0.29600406285833764},
- {0.5857115819927252},
- {0.035671482917234036},
- {0.4308105413576064},
- {0.14436348834320245},
- {0.6061562596374511},
- {0.2193234119012935},
- {0.039782881852377563},
- {0.6584576505913479},
- {0.029748424924173168},
- {0.374564704445439},
- {0.6680348779642283},
- {0.02078473551560424},
- {0.3947951789707007},
- {0.46175739524335346},
- {0.3816888598607809},
- {0.566500478923951},
- {0.2521511074091152},
- {0.07178578488537571},
- {0.2051868983356896},
- {0.6289587925157819},
- {0.09499095952825257},
- {0.32401066333996165},
- {0.3941489041445842},
- {0.02408397094796827},
- {0.11843839168314059},
- {0.6594956554689243},
- {0.585822449131991},
- {0.12384889283453629},
- {0.5642606734625012},
- {0.4384057506396799},
- {0.42432574914350957},
- {0.20828816286899623},
- {0.6316843165140061},
- {0.06137299173587324},
- {0.6250493504986929},
- {0.6761002808710829},
- {0.493161072312682},
- {0.27920072678418245},
- {0.557835364055397},
- {0.1350995140700022},
- {0.6276019364036185},
- {0.3881551017873116},
- {0.3144497763486762},
- {0.46561924587072895},
- {0.38569737961530537},
- {0.6696902156046189},
- {0.5928945511409227},
- {0.3932219374681512},
- {0.34401179796645},
- {0.1950644588246581},
- {0.21239346050482003},
- {0.06126269563336616},
- {0.03672650540768901},
- {0.2591585782733493},
- {0.23960650747564324},
- {0.05764745380101015},
- {0.10674174833195492},
- {0.21002626722709655},
- {0.4683981010898247},
- {0.27444752194903344},
- {0.11628420472504018},
- {0.6437523347424061},
- {0.3508923230554428},
- {0.6666755608116072},
- {0.42912126167676706},
- {0.570933079313534},
- {0.02037634561684047},
- {0.10501535010363863},
- {0.5361891826878507},
- {0.6747421138327419},
- {0.3400060629854871},
- {0.34733486984398537},
- {0.49681509745188984},
- {0.4522853757365485},
- {0.0167532793699382},
- {0.5057863754066906},
- {0.37788148331986166},
- {0.5756575132095892},
- {0.18216478710243444},
- {0.42429758044482263},
- {0.5498276599938825},
- {0.4582085918441726},
- {0.19043671143890692},
- {0.5699815600707736},
- {0.13838449147903706},
- {0.04510524344477236},
- {0.024250601938673618},
- {0.37765952217803256},
- {0.49717425310191643},
- {0.3077992193460023},
- {0.21143989174634553},
- {0.4705801986338804},
- {0.5463743990879644},
- {0.5029030093243979},
- {0.47987707309006766},
- {0.2276043748884479},
- {0.30295612865255334},
- {0.06014970616134434},
- {0.183119208188499},
- {0.2760061864227038},
- {0.2178581923507244},
- {0.4188721479017681},
- {0.3981116114338897},
- {0.08785956653643176},
- {0.5016191200736598},
- {0.4481129153698198},
- {0.07886744673216317},
- {0.2753465331156777},
- {0.37501462592137413},
- {0.18646489709730082},
- {0.2973256699334244},
- {0.5948491612994564},
- {0.6492628204236163},
- {0.5496064587770758},
- {0.4982577847873233},
- {0.22910751735221951},
- {0.1598151548143571},
- {0.07422683298235182},
- {0.2138977152127821},
- {0.1956096682958788},
- {0.22043621165461483},
- {0.5678982550166447},
- {0.680301420032233},
- {0.6723923058046812},
- {0.6524400996471907},
- {0.08564392180260268},
- {0.4545637873463791},
- {0.5863981794850446},
- {0.541570614144292},
- {0.18518086626605745},
- {0.5318938534916094},
- {0.7003805117340444},
- {0.18072624327267356},
- {0.22647959028242604},
- {0.5719856763839365},
- {0.2814095505683623},
- {0.20233016935434645},
- {0.34942979545771546},
- {0.19689439549794063},
- {0.5839934374859672},
- {0.1973446484275586},
- {0.6989651160575714},
- {0.5849689197767582},
- {0.23625763414185222},
- {0.2070223371151761},
- {0.06844623570603052},
- {0.04026938034072971},
- {0.029033210316654557},
- {0.058833942722892066},
- {0.02254572455762338},
- {0.03259097349446699},
- {0.0163236261125627},
- {0.07644640292069407},
- {0.007645671832226723},
- {0.06189206004947401},
- {0.07393772863632805},
- {0.022545726215854642},
- {0.059571028284374355},
- {0.043827746325779134},
- {0.01519007419217016},
- {0.06670161166464704},
- {0.028595462136689467},
- {0.05360976572371694},
- {0.02973695681516768},
- {0.022655089401232637},
- {0.06796566153605703},
- {0.03987211524795419},
- {0.009308497743099175},
- {0.07475866112969312},
- {0.01629544623363966},
- {0.07206170364224505},
- {0.004729651254749725},
- {0.023642009501111765},
- {0.04292104009594196},
- {0.07061047765465607},
- {0.022941606218827043},
- {0.01929887597156442},
- {0.04879127374500585},
- {0.03394227881561025},
- {0.030768285482157504},
- {0.012459734076533256},
- {0.017653315055132405},
- {0.05425037652525329},
- {0.0034145952769684524},
- {0.01742833481503607},
- {0.07061775410291563},
- {0.02602349573440572},
- {0.005704518156730525},
- {0.04634015978629372},
- {0.008526153566865344},
- {0.004295172193965711},
- {0.05835389259024553},
- {0.06215776828902049},
- {0.07756025868204713},
- {0.033216237292514744},
- {0.051735586956226064},
- {0.05295709759486205},
- {0.044470089321862825},
- {0.06675002824962077},
- {0.000892984800355638},
- {0.02534153003652857},
- {0.03434823636703769},
- {0.024841912034855966},
- {0.015085712600660887},
- {0.06879991157736297},
- {0.014008084159584188},
- {0.0582813814061015},
- {0.06986995668530956},
- {0.036296366046976114},
- {0.05665874163004724},
- {0.0083567188636175},
- {0.03013801533840813},
- {0.06678372145870544},
- {0.0276904068768186},
- {0.002079006012427547},
- {0.03504510709351159},
- {0.05282087151170446},
- {0.07724350417443636},
- {0.07333176818456723},
- {0.07778402227110319},
- {0.06405814873949914},
- {0.0594113513409587},
- {0.04663010729106008},
- {0.0500952663619709},
- {0.03568016861336439},
- {0.02231478677213176},
- {0.06958534840095047},
- {0.07063930035892366},
- {0.031383388404702284},
- {0.010942062843385471},
- {0.03602358353256781},
- {0.03773306565816026},
- {0.029457584144044275},
- {0.05691485104837613},
- {0.05832404094423371},
- {0.049847191273570866},
- {0.04304145022689881},
- {0.020409970487690738},
- {0.06668461706498979},
- {0.028860174571229257},
- {0.06075098399401297},
- {0.031860752578716206},
- {0.05738368702856034},
- {0.05140878188952612},
- {0.025543029873088357},
- {0.06509956366857764},
- {0.0489097880932314},
- {0.020464729204404723},
- {0.046556827551973406},
- {0.07102436352671884},
- {0.015742823346562178},
- {0.0075324547714121825},
- {0.011254979832871862},
- {0.06537798574176086},
- {0.07011832353158276},
- {0.03317288133157603},
- {0.06564011526177285},
- {0.00399766766140999},
- {0.04828050948641011},
- {0.016178672755965934},
- {0.06793132997964446},
- {0.02457935693848888},
- {0.004458428056606176},
- {0.0737926949178018},
- {0.0033338764349433274},
- {0.04197709440735606},
- {0.07486600527732255},
- {0.0023293246657134932},
- {0.04424430359437711},
- {0.05174869266479041},
- {0.042775491429000806},
- {0.0634871460214347},
- {0.028258324169392234},
- {0.00804496161404474},
- {0.022995091903659195},
- {0.07048678719171064},
- {0.010645542488757449},
- {0.03631155323123305},
- {0.04417187621649815},
- {0.0026990667037986985},
- {0.013273272922229679},
- {0.07390902309347931},
- {0.06565254003195647},
- {0.013879622412525362},
- {0.06323613324795783},
- {0.04913169704704603},
- {0.04755376526370964},
- {0.023342647539712883},
- {0.07079223395918534},
- {0.0068780102278267535},
- {0.07004865990773604},
- {0.07576988697048864},
- {0.05526807156363523},
- {0.03128974814691664},
- {0.06251605520435836},
- {0.015140468360201541},
- {0.07033472567485788},
- {0.043500156739398},
- {0.03524007412204829},
- {0.052181486428987865},
- {0.04322472225660522},
- {0.07505151732259015},
- {0.06644510348004458},
- {0.044067991981739},
- {0.03855306052358029},
- {0.021860680161323722},
- {0.023802724168354154},
- {0.006865649453165516},
- {0.004115902984060801},
- {0.02904364446928611},
- {0.02685246331421769},
- {0.006460492891692605},
- {0.011962441719036546},
- {0.023537435168829824},
- {0.05249290997341675},
- {0.030757061201952193},
- {0.013031855329386388},
- {0.07214468477601618},
- {0.03932415413652615},
- {0.07471366795411001},
- {0.04809119359038086},
- {0.06398390314461076},
- {0.002283556815374262},
- {0.011768965984257907},
- {0.06009018915761076},
- {0.07561767853944117},
- {0.03810414178278307},
- {0.038925473888401355},
- {0.055677574531787226},
- {0.05068717284632767},
- {0.0018775233795344062},
- {0.056682976741856274},
- {0.04234880252156853},
- {0.06451336575900643},
- {0.020415026763443145},
- {0.04755060842562512},
- {0.06161863976348271},
- {0.0513509817925364},
- {0.021342053108108227},
- {0.06387726732812905},
- {0.0155086125157734},
- {0.005054899834065354},
- {0.002717740873428177},
- {0.04232392755685684},
- {0.05571782474877022},
- {0.03449475280413054},
- {0.02369585866468196},
- {0.052737455477907084},
- {0.0612316362435553},
- {0.05635984076878971},
- {0.05377934696450218},
- {0.025507396235758643},
- {0.03395199244030158},
- {0.006740917828463651},
- {0.02052198778662182},
- {0.030931739181441802},
- {0.024415151238721185},
- {0.04694258558909617},
- {0.04461597288662668},
- {0.009846334359105112},
- {0.05621595657562576},
- {0.0502195693571403},
- {0.008838596423666453},
- {0.030857812490494893},
- {0.04202751666029948},
- {0.02089693581967355},
- {0.03332099252385317},
- {0.06666415469918127},
- {0.07276223943326296},
- {0.06159384996281352},
- {0.055839255068583796},
- {0.025675851918743685},
- {0.017910325670703175},
- {0.008318527449809678},
- {0.023971304499440935},
- {0.02192178124525821},
- {0.02470406730160441},
- {0.06364379339986354},
- {0.07624070446368288},
- {0.07535433788757942},
- {0.07311831396015674},
- {0.00959802925437613},
- {0.05094251217250972},
- {0.06571706156080445},
- {0.06069328083606509},
- {0.020753035759723},
- {0.05960881588073396},
- {0.07849094832803413},
- {0.02025381058521195},
- {0.02538134274210439},
- {0.06410186665284523},
- {0.03153728883459304},
- {0.022674941124039918},
- {0.039160250121239776},
- {0.022065759346794743},
- {0.06544756451337161},
- {0.022116218745423202},
- {0.07833232634035105},
- {0.06555688584484587},
- {0.026477158405820215},
- {0.02320078770470777},
- {0.6715007411646272},
- {0.39506801895108173},
- {0.284834104387487},
- {0.5771980845482558},
- {0.22118777744856702},
- {0.3197380050351421},
- {0.1601450674388856},
- {0.7499874272281271},
- {0.07500886278234606},
- {0.6072001442698138},
- {0.7253757502832107},
- {0.2211877937168615},
- {0.5844293587846197},
- {0.42997783351792085},
- {0.14902420817116235},
- {0.6543848789881568},
- {0.28053951865522697},
- {0.5259456133095458},
- {0.2917383013892505},
- {0.2222607155405372},
- {0.6667860054601283},
- {0.39117059783674435},
- {0.0913222337086046},
- {0.7334296158034178},
- {0.15986860505366368},
- {0.7069707618864696},
- {0.04640086178961086},
- {0.23194302416866108},
- {0.4210824735456178},
- {0.6927333196632224},
- {0.22507162622665725},
- {0.18933414503915427},
- {0.4786731679862272},
- {0.3329951625008149},
- {0.30185628606911474},
- {0.12223784961733236},
- {0.17319015459735},
- {0.5322304093044237},
- {0.03349933324469929},
- {0.17098295654746842},
- {0.6928047062098883},
- {0.2553069061153399},
- {0.05596492094442709},
- {0.4546261941391447},
- {0.08364694391702063},
- {0.042138348178343395},
- {0.5724884899804434},
- {0.60980690968136},
- {0.7609150547533493},
- {0.32587223724647585},
- {0.5075587375600844},
- {0.5195425273291436},
- {0.43627962343379934},
- {0.6548598762229815},
- {0.00876074409501421},
- {0.2486163925049177},
- {0.3369778621168419},
- {0.24371482480054824},
- {0.148000355137833},
- {0.6749705245249832},
- {0.13742814047301208},
- {0.5717771095313482},
- {0.6854683419090064},
- {0.35609024295808955},
- {0.5558579899329618},
- {0.08198468261606917},
- {0.295672938448957},
- {0.655190427854334},
- {0.27166035573955644},
- {0.020396360206377476},
- {0.3438146034583665},
- {0.5182060635358803},
- {0.757807493257325},
- {0.7194308960735292},
- {0.7631103166891866},
- {0.6284508404662745},
- {0.5828628272618194},
- {0.45747076203014847},
- {0.49146615798389454},
- {0.35004495750000914},
- {0.21892213212094708},
- {0.6826761551376326},
- {0.6930160885705028},
- {0.30789083368332276},
- {0.10734853762828488},
- {0.35341407444841955},
- {0.3701851722670521},
- {0.28899747928580827},
- {0.5583705848544082},
- {0.5721956265057009},
- {0.4890323849062843},
- {0.42226377287270583},
- {0.200234683007191},
- {0.6542181512470631},
- {0.28313651459160544},
- {0.5960054684916134},
- {0.3125740773029211},
- {0.5629701615138241},
- {0.50435257374053},
- {0.25059323298706754},
- {0.6386677777386117},
- {0.47983586848905535},
- {0.20077190055435593},
- {0.45675184157233983},
- {0.6967938011050562},
- {0.15444702599340907},
- {0.07389813201000722},
- {0.11041845065119493},
- {0.6413992738767208},
- {0.6879049773153635},
- {0.3254468879251591},
- {0.6439709297925431},
- {0.039219641078525457},
- {0.4736622484715223},
- {0.15872298358891204},
- {0.6664491912388848},
- {0.2411389937122724},
- {0.043739991155955435},
- {0.7239528780320248},
- {0.03270743049523886},
- {0.4118217709961459},
- {0.7344827295933775},
- {0.022852144070529917},
- {0.4340645230446088},
- {0.5076873128268419},
- {0.41965454932570484},
- {0.6228489436719192},
- {0.2772319825638758},
- {0.0789261473731572},
- {0.22559635452816298},
- {0.6915198382104281},
- {0.10443948593465649},
- {0.3562392388141734},
- {0.4333539647878302},
- {0.02647954665962599},
- {0.13021917879075295},
- {0.7250941308033425},
- {0.6440928246243193},
- {0.13616784971382714},
- {0.6203863500509139},
- {0.48201293528346},
- {0.4665324292908675},
- {0.22900609452041554},
- {0.694516463643951},
- {0.06747761828071762},
- {0.6872215332287347},
- {0.7433503790795082},
- {0.5422146394889454},
- {0.3069721636957435},
- {0.6133219302915843},
- {0.14853754367326247},
- {0.6900280188252423},
- {0.42676397306549907},
- {0.3457273529735823},
- {0.5119332926156823},
- {0.42406178707338693},
- {0.7363027197594865},
- {0.6518683719180657},
- {0.4323347949252875},
- {0.3782298390657585},
- {0.2144670598648918},
- {0.23351973641669171},
- {0.06735635128537781},
- {0.04037960416448467},
- {0.2849364700055994},
- {0.26343960090130225},
- {0.0633815098859873},
- {0.11735909794910697},
- {0.2309170840141767},
- {0.5149885540006658},
- {0.3017461688011721},
- {0.12785071994342198},
- {0.7077848591447806},
- {0.3857947537357823},
- {0.7329882043738518},
- {0.4718049401303612},
- {0.6277224443538881},
- {0.02240313259302075},
- {0.11546097896621337},
- {0.5895226543846757},
- {0.741857118373414},
- {0.37382566308648746},
- {0.38188344905493316},
- {0.5462321218791267},
- {0.4972731339095363},
- {0.01841968850304779},
- {0.5560957516648395},
- {0.41546846203205023},
- {0.6329168065320017},
- {0.20028428826130398},
- {0.46650145871824755},
- {0.6045177188186736},
- {0.5037855183346683},
- {0.20937900137592003},
- {0.6266762797392305},
- {0.15214927002712164},
- {0.049591755486252},
- {0.026662752041448384},
- {0.41522442293964373},
- {0.5466270018934521},
- {0.3384152807723135},
- {0.23247131842583227},
- {0.5173876996340213},
- {0.6007209702059273},
- {0.5529255839679177},
- {0.52760931223616},
- {0.25024364453080733},
- {0.33309045928539827},
- {0.06613265537909453},
- {0.201333643358766},
- {0.30345986994897794},
- {0.23952803223338204},
- {0.4605363712132493},
- {0.4377108332125722},
- {0.0965987501239791},
- {0.5515139892855391},
- {0.4926856487641287},
- {0.08671220539925364},
- {0.30273460248538936},
- {0.41231644509872356},
- {0.20501212004189306},
- {0.326899952134797},
- {0.6540174025329129},
- {0.713843459822719},
- {0.6042745152392368},
- {0.5478183099166556},
- {0.2518963010255148},
- {0.17571159083212226},
- {0.08161000075937477},
- {0.23517361578789256},
- {0.21506650003460676},
- {0.2423624810289841},
- {0.6243857532514591},
- {0.7479693956312883},
- {0.7392735804902874},
- {0.7173367755069582},
- {0.09416272044111108},
- {0.4997781737413267},
- {0.6447258215159025},
- {0.5954393641188914},
- {0.20360036969633072},
- {0.5848000789374602},
- {0.7700457071643695},
- {0.19870265587417127},
- {0.24900698025640128},
- {0.6288797407689902},
- {0.3094006939652096},
- {0.22245547346171396},
- {0.3841867519719254},
- {0.21647901601734823},
- {0.6420818855093986},
- {0.21697405454252375},
- {0.7684895254226638},
- {0.6431543967198814},
- {0.25975762304595285},
- {0.22761436006833324},
- {0.5827620189399407},
- {0.3428598395040209},
- {0.24719332021572113},
- {0.5009214442507114},
- {0.19195784583529404},
- {0.2774846756281194},
- {0.13898192079743024},
- {0.6508767012125801},
- {0.06509645281644197},
- {0.5269587362801559},
- {0.6295174536843623},
- {0.19195785995373588},
- {0.5071971066813782},
- {0.37315632731207005},
- {0.1293306814138888},
- {0.5679080153828362},
- {0.24346626334382268},
- {0.45644197939869957},
- {0.2531851286192808},
- {0.19288899531934325},
- {0.5786703348516153},
- {0.3394774620053584},
- {0.07925401422168223},
- {0.6365070020840952},
- {0.1387419928749481},
- {0.6135446817436363},
- {0.040268994863905},
- {0.20129178831453634},
- {0.36543648782586763},
- {0.6011887153746786},
- {0.1953284445799087},
- {0.16431366617097243},
- {0.4154165806343351},
- {0.28898990172318056},
- {0.261966023141325},
- {0.10608413612518879},
- {0.1503031016445716},
- {0.4618962405455279},
- {0.029072401381068206},
- {0.14838758448591827},
- {0.6012506681999101},
- {0.2215681367663736},
- {0.04856916503595147},
- {0.3945474107742737},
- {0.07259301282481853},
- {0.03656977178702054},
- {0.4968342218986305},
- {0.5292210180335619},
- {0.6603602443994088},
- {0.28280826997281555},
- {0.44048492652163207},
- {0.45088506027019126},
- {0.3786253366357878},
- {0.5683202418043249},
- {0.00760301307690587},
- {0.21576177352604045},
- {0.29244628818232554},
- {0.21150794725860392},
- {0.12844213040534339},
- {0.5857732709496679},
- {0.11926703232272338},
- {0.4962168502691813},
- {0.5948838033409886},
- {0.3090329707621202},
- {0.48240143993796974},
- {0.07115041910546073},
- {0.256599803981714},
- {0.5686071110871745},
- {0.23576048047564827},
- {0.017700984264410125},
- {0.29837955518102904},
- {0.4497252099667479},
- {0.6576633466889725},
- {0.6243582110668053},
- {0.6622654027996986},
- {0.5454011561617038},
- {0.5058375920643476},
- {0.3970160694451458},
- {0.42651897892266605},
- {0.3037865688705763},
- {0.1899916051978888},
- {0.5924606036326441},
- {0.6014341164132753},
- {0.2672031061934536},
- {0.09316244448220559},
- {0.3067104575195973},
- {0.32126525727704003},
- {0.2508065057457051},
- {0.4845819958174179},
- {0.4965800602881478},
- {0.4244068285922138},
- {0.3664616786240673},
- {0.17377369968153436},
- {0.5677633206877201},
- {0.2457200666567392},
- {0.5172434352269248},
- {0.27126745987117445},
- {0.48857373911119495},
- {0.43770245676993064},
- {0.2174773748349858},
- {0.5542679267059678},
- {0.4164256304401111},
- {0.17423992401042016},
- {0.3963921542180037},
- {0.6047126048030167},
- {0.13403687467430875},
- {0.0641325049490662},
- {0.09582666895960268},
- {0.5566384560391303},
- {0.5969984377438731},
- {0.28243913050051145},
- {0.5588702680114064},
- {0.034036771392658746},
- {0.41106785338189705},
- {0.13774776511492848},
- {0.5783780305791896},
- {0.20927251186228785},
- {0.03795975788537593},
- {0.6282826137877502},
- {0.02838514846116933},
- {0.35739958572927055},
- {0.637420947044671},
- {0.01983223665926451},
- {0.37670296143077986},
- {0.44059651058617294},
- {0.364197263577438},
- {0.5405395491884789},
- {0.24059581765083723},
- {0.06849606883614158},
- {0.19578383011507586},
- {0.6001355953138577},
- {0.09063782353355364},
- {0.3091622768381709},
- {0.376086303341056},
- {0.0229802785402955},
- {0.11301073384548307},
- {0.6292730501765178},
- {0.5589760544594466},
- {0.1181732887983303},
- {0.5384023869451184},
- {0.4183149981841794},
- {0.4048802387365449},
- {0.1987429734787884},
- {0.6027362171458126},
- {0.05856046114607192},
- {0.5964053106907807},
- {0.6451167379812924},
- {0.4705610562087269},
- {0.26640583830693915},
- {0.5322715291973726},
- {0.1289083295563902},
- {0.5988409196366622},
- {0.3703671780363802},
- {0.3000395351347076},
- {0.44428138478278417},
- {0.36802208551781745},
- {0.6390004257833141},
- {0.5657240643446},
- {0.37520181662298024},
- {0.3282468225649388},
- {0.18612527007224286},
- {0.20266013827548507},
- {0.058455219565977115},
- {0.03504344553079446},
- {0.24728215823275404},
- {0.228626097156216},
- {0.0550056528613188},
- {0.10185011075814217},
- {0.20040142599758354},
- {0.446932893834009},
- {0.2618704578538242},
- {0.1109552664795753},
- {0.6142511961713703},
- {0.3348120348960011},
- {0.6361239231087379},
- {0.40945598805943767},
- {0.5447690174863152},
- {0.01944256198115973},
- {0.10020282791413393},
- {0.511617324031844},
- {0.6438208114535303},
- {0.32442465778073415},
- {0.33141760854205893},
- {0.47404762890363883},
- {0.4315585638507383},
- {0.015985529430189105},
- {0.4826077814926423},
- {0.36056436709175727},
- {0.5492769454817076},
- {0.17381674960875673},
- {0.40485336092045127},
- {0.5246307929500396},
- {0.4372103376508994},
- {0.181709597749417},
- {0.5438611033685675},
- {0.13204276681431956},
- {0.04303821243714582},
- {0.02313927335838954},
- {0.3603525777288082},
- {0.4743903255833003},
- {0.29369375217807886},
- {0.20175026856486264},
- {0.4490149927317709},
- {0.521335784096983},
- {0.47985655098136665},
- {0.4578858207617045},
- {0.21717398444078467},
- {0.2890726050519751},
- {0.05739323489016369},
- {0.17472743258748477},
- {0.2633576936519902},
- {0.20787443870120037},
- {0.3996765588345189},
- {0.37986741225696685},
- {0.08383323978420401},
- {0.4786314983245355},
- {0.42757731417920697},
- {0.07525320046194134},
- {0.26272827017493},
- {0.3578288887233901},
- {0.1779197991286813},
- {0.2837001724927948},
- {0.567589100886034},
- {0.6195091536784649},
- {0.5244197286871465},
- {0.47542420242992495},
- {0.21860824262760298},
- {0.15249133045911578},
- {0.07082525139992894},
- {0.20409545773585158},
- {0.18664549431344163},
- {0.2103343155136103},
- {0.5418732696125927},
- {0.6491253521885736},
- {0.6415786877141471},
- {0.6225408282190039},
- {0.0817191310585403},
- {0.43373256304449537},
- {0.5595254009067522},
- {0.5167521414621465},
- {0.17669461137953277},
- {0.5075188362216262},
- {0.668284282463844},
- {0.17244412970435027},
- {0.21610074516475078},
- {0.5457733773537476},
- {0.2685134386655571},
- {0.19305801601044878},
- {0.3334165303240493},
- {0.1878713465209309},
- {0.5572308606469365},
- {0.18830096577925667},
- {0.6669337499058888},
- {0.5581616396618229},
- {0.2254306921221812},
- {0.19753515652579876},
- {0.6377491114005789},
- {0.37521072216816737},
- {0.2705174928841442},
- {0.5481863875300176},
- {0.21007022013980078},
- {0.3036670193967274},
- {0.15209569877346715},
- {0.7122908225637862},
- {0.07123869365154033},
- {0.5766804542594537},
- {0.6889162018977303},
- {0.21007023559040228},
- {0.5550541963585477},
- {0.4083658653487203},
- {0.14153380705656343},
- {0.6214935434990942},
- {0.26643876583786835},
- {0.49951001833810693},
- {0.2770746643552769},
- {0.2110892291636107},
- {0.6332713523726174},
- {0.3715091970617146},
- {0.08673210590619454},
- {0.6965652561190905},
- {0.15183313221217765},
- {0.6714363031041682},
- {0.04406861610192997},
- {0.2202848760860291},
- {0.3999176126958856},
- {0.6579144771851899},
- {0.21375885509610087},
- {0.1798176462874612},
- {0.45461362709006253},
- {0.31625783259339907},
- {0.28668408895182573},
- {0.11609381076447554},
- {0.16448510094899527},
- {0.5054789217441042},
- {0.031815556855924805},
- {0.16238884325528713},
- {0.6579822756311353},
- {0.2424744196515654},
- {0.053151957122206314},
- {0.4317753258601164},
- {0.07944259906836879},
- {0.040020349136201866},
- {0.5437135112298811},
- {0.579156195867661},
- {0.7226691949418121},
- {0.30949292680394475},
- {0.48204732179615767},
- {0.4934287705540157},
- {0.41435090851057044},
- {0.6219446659563856},
- {0.008320402970982597},
- {0.23612019120729014},
- {0.3200403498497336},
- {0.2314649909129318},
- {0.1405614159299682},
- {0.6410444931018435},
- {0.13052059230208674},
- {0.5430378868835976},
- {0.6510146588781237},
- {0.3381920854339939},
- {0.5279189097093617},
- {0.0778638879775087},
- {0.2808115348227012},
- {0.6222586030769933},
- {0.25800589612929775},
- {0.019371178317485045},
- {0.32653345618327373},
- {0.49215948141653165},
- {0.7197178287537795},
- {0.6832701537890493},
- {0.7247541164661632},
- {0.5968630270924059},
- {0.5535664033817087},
- {0.43447691728600213},
- {0.4667636032598857},
- {0.33245065405095925},
- {0.2079184529028317},
- {0.6483628157405872},
- {0.6581830332839324},
- {0.2924153222070428},
- {0.10195287999809678},
- {0.3356504291343446},
- {0.3515785615627538},
- {0.2744716041442848},
- {0.5303052141171318},
- {0.5434353679467406},
- {0.46445215887502234},
- {0.4010395363959874},
- {0.1901702907102309},
- {0.6213351959914744},
- {0.2689052290138639},
- {0.566048456270021},
- {0.2968631720362048},
- {0.5346736023370372},
- {0.47900230933142207},
- {0.23799766979158055},
- {0.6065664306290388},
- {0.4557178867982761},
- {0.19068050610141424},
- {0.4337941319143286},
- {0.6617708667208094},
- {0.1466840578834306},
- {0.07018379152018035},
- {0.10486849003754715},
- {0.6091606336255269},
- {0.6533288217225552},
- {0.309088956807971},
- {0.611603030445967},
- {0.0372483449592309},
- {0.44985457133345924},
- {0.15074509309865464},
- {0.6329514674385627},
- {0.22901862877665657},
- {0.04154148876142624},
- {0.6875648474491015},
- {0.031063457500221714},
- {0.3911223806733154},
- {0.697565437269428},
- {0.02170352716111965},
- {0.412247145672693},
- {0.4821694344865778},
- {0.39856146020554367},
- {0.5915426983366079},
- {0.2632974763740233},
- {0.07495908383690351},
- {0.21425720898835662},
- {0.6567619889289916},
- {0.09919004591780645},
- {0.33833359231402366},
- {0.41157230219288843},
- {0.02514860567864436},
- {0.12367397453215276},
- {0.6886487374527506},
- {0.61171879847999},
- {0.12932364751482925},
- {0.5892038820148076},
- {0.45778552772326336},
- {0.4430831181269845},
- {0.21749556528025676},
- {0.6596079950318519},
- {0.06408599195783288},
- {0.6526797295738503},
- {0.7059873722477621},
- {0.5149613147451217},
- {0.29154282731264713},
- {0.5824945410597115},
- {0.14107160376763245},
- {0.6553451528349282},
- {0.40531354310683776},
- {0.32835006520375687},
- {0.48620199866910035},
- {0.40274717704100177},
- {0.6992939493023124},
- {0.619103523578937},
- {0.4106043588469502},
- {0.3592188794177879},
- {0.2036873058640408},
- {0.2217823380744879},
- {0.06397082020331472},
- {0.03835000484131075},
- {0.270614713301021},
- {0.2501983409447037},
- {0.06019576618621415},
- {0.11146027970424395},
- {0.21931050274321223},
- {0.4891036935056396},
- {0.2865795065061556},
- {0.12142456148957824},
- {0.6722094814065198},
- {0.36640355891681786},
- {0.6961460313443278},
- {0.44809061684828916},
- {0.5961712423408114},
- {0.021277084339487783},
- {0.10965756584189813},
- {0.5598914877327947},
- {0.7045691672778773},
- {0.35503607045713},
- {0.362688848073309},
- {0.5187768664896544},
- {0.4722787032582559},
- {0.017493860028687924},
- {0.528144720827555},
- {0.39458577814279083},
- {0.6011045203855077},
- {0.19021740265634204},
- {0.4430537042277032},
- {0.5741328555108716},
- {0.47846375582130096},
- {0.19885498836805698},
- {0.5951776610795019},
- {0.1445017939842521},
- {0.04709912596566769},
- {0.025322602611631204},
- {0.39435400518292885},
- {0.5191518986568701},
- {0.32140551955698915},
- {0.22078661669838434},
- {0.49138225092486054},
- {0.5705269428058598},
- {0.5251338952129829},
- {0.5010900947952768},
- {0.23766565269365572},
- {0.3163483394774004},
- {0.06280863090252084},
- {0.1912140140372757},
- {0.28820707192376604},
- {0.22748863902581726},
- {0.4373884398094668},
- {0.415710181417786},
- {0.09174340887119105},
- {0.5237932514889218},
- {0.467921798796806},
- {0.08235379136744811},
- {0.28751825856575075},
- {0.3915921909803072},
- {0.19470759951255504},
- {0.3104689856771832},
- {0.6211445375063593},
- {0.6779635587467544},
- {0.5739018760686058},
- {0.520283327986173},
- {0.23923524174447655},
- {0.1668798022793174},
- {0.0775080387482877},
- {0.22335308853638275},
- {0.20425661638320788},
- {0.23018061997221276},
- {0.5930022632836898},
- {0.710374223253069},
- {0.7021154857132433},
- {0.681281289967127},
- {0.08942982130477967},
- {0.4746578323177065},
- {0.6123199790601133},
- {0.5655108059912778},
- {0.19336680794940603},
- {0.555406283010965},
- {0.7313409135337177},
- {0.18871526782964498},
- {0.2364911468535945},
- {0.597270369586864},
- {0.2938492924085385},
- {0.2112741979708726},
- {0.3648763801169081},
- {0.20559813510032815},
- {0.6098089351618988},
- {0.2060682915129513},
- {0.7298629501271111},
- {0.610827538760558},
- {0.246701430276559},
- {0.2161737835520912},
- {0.552492049826606},
- {0.3250509288085913},
- {0.23435354355772364},
- {0.47490245853634083},
- {0.18198712386706048},
- {0.26307149788540085},
- {0.13176288744741416},
- {0.617068702403508},
- {0.06171519674260641},
- {0.49958731509485355},
- {0.596818902200185},
- {0.1819871372521587},
- {0.4808521489548172},
- {0.3537737489437535},
- {0.12261295513013724},
- {0.5384095966009743},
- {0.23082007839690005},
- {0.4327333570633584},
- {0.24003412396526755},
- {0.18286990735400277},
- {0.5486128970065339},
- {0.32184423959963654},
- {0.07513738258710524},
- {0.6034453977459228},
- {0.13153542192050158},
- {0.5816757919353857},
- {0.038177332759753595},
- {0.19083624039442235},
- {0.34645489527202183},
- {0.5699616222316157},
- {0.18518264613692728},
- {0.1557788450291596},
- {0.39383890972187235},
- {0.2739791166772734},
- {0.24835891908939078},
- {0.10057388765401104},
- {0.1424960207152146},
- {0.4379043116269079},
- {0.027562315508525954},
- {0.1406799998232088},
- {0.570020357087856},
- {0.21005938973337857},
- {0.04604637343712178},
- {0.37405373145109483},
- {0.06882236857444636},
- {0.03467025564407009},
- {0.47102753569990424},
- {0.5017320888491525},
- {0.6260596490414531},
- {0.26811857277421514},
- {0.41760514937872006},
- {0.4274650768044374},
- {0.3589586856307359},
- {0.5388004110555871},
- {0.007208095488719775},
- {0.20455462205046587},
- {0.27725597065495644},
- {0.2005217490805058},
- {0.1217705574581343},
- {0.5553468906386839},
- {0.1130720345924063},
- {0.47044223174052874},
- {0.5639842015002402},
- {0.29298110366037017},
- {0.45734442487423504},
- {0.06745470641532901},
- {0.24327143341435428},
- {0.5390723797031015},
- {0.22351455121086153},
- {0.016781555355961413},
- {0.2828810504297935},
- {0.42636547173270145},
- {0.6235028342597999},
- {0.5919276422403958},
- {0.6278658492322876},
- {0.5170717942355052},
- {0.47956325058271887},
- {0.3763941624419019},
- {0.4043646244887153},
- {0.2880072116751892},
- {0.18012301418779814},
- {0.5616868682312709},
- {0.57019427658869},
- {0.2533239762766213},
- {0.08832337771850535},
- {0.29077922697587893},
- {0.30457801771971094},
- {0.23777905211007563},
- {0.45941171778016127},
- {0.4707865758147383},
- {0.40236218399381785},
- {0.3474268353558849},
- {0.1647475031362649},
- {0.5382724176735467},
- {0.23295681409996508},
- {0.4903766486149995},
- {0.25717721828904505},
- {0.4631961209551866},
- {0.4149672073599618},
- {0.20618111117133997},
- {0.5254780047882341},
- {0.3947955472127377},
- {0.16518951072559562},
- {0.3758026547740055},
- {0.5733024729225484},
- {0.12707469813469904},
- {0.06080131849408707},
- {0.09084921638828151},
- {0.5277254034996934},
- {0.5659889970392644},
- {0.26776860723580176},
- {0.5298412901417799},
- {0.03226882498350953},
- {0.3897160651373766},
- {0.13059283658502116},
- {0.5483357756750178},
- {0.19840242722316817},
- {0.03598804274026381},
- {0.5956482026633003},
- {0.02691076004999601},
- {0.33883544793452763},
- {0.6043118703510109},
- {0.018802105711101004},
- {0.3571361629147177},
- {0.41771093751614585},
- {0.34528003911640764},
- {0.5124627100556984},
- {0.2280987301049879},
- {0.06493822906506937},
- {0.18561437792384702},
- {0.5689632035938074},
- {0.08592989125641033},
- {0.29310369328819497},
- {0.35655153543221046},
- {0.02178663122111037},
- {0.10714070232009189},
- {0.5965871935598733},
- {0.5299415818039372},
- {0.11203510256503137},
- {0.5104365568228674},
- {0.3965867769495269},
- {0.3838498491043443},
- {0.1884198167301067},
- {0.5714287432825026},
- {0.055518699170268},
- {0.5654266783384563},
- {0.6116079246088796},
- {0.44611905728901985},
- {0.25256812027611775},
- {0.5046241496066097},
- {0.1222125411774196},
- {0.5677357762812734},
- {0.3511294743504961},
- {0.28445480729361106},
- {0.4212044110646489},
- {0.34890619120831295},
- {0.605809307413841},
- {0.5363390848884387},
- {0.35571299094229497},
- {0.31119694481438664},
- {0.17645750519877654},
- {0.19213351518281696},
- {0.05541892407439038},
- {0.0332232102042515},
- {0.2344377671284744},
- {0.21675074379669285},
- {0.05214853561781751},
- {0.09655978708116895},
- {0.18999212549744188},
- {0.42371819477606815},
- {0.2482683176777208},
- {0.10519200054915663},
- {0.5823456084157405},
- {0.3174211452606229},
- {0.603082216753576},
- {0.3881879237226874},
- {0.5164724902637476},
- {0.018432671611632312},
- {0.09499806781060663},
- {0.4850427702809638},
- {0.6103793114177688},
- {0.30757331185999204},
- {0.3142030330410133},
- {0.4494245295615358},
- {0.40914244204836114},
- {0.015155205101585259},
- {0.4575400485847727},
- {0.34183584343970125},
- {0.5207462663467798},
- {0.16478831695350585},
- {0.38382436738243075},
- {0.4973802903737235},
- {0.4145006500140884},
- {0.17227119282131856},
- {0.515611735245956},
- {0.12518416871902976},
- {0.04080271094798682},
- {0.02193736749098666},
- {0.3416350548922938},
- {0.44974942580539073},
- {0.27843863856689816},
- {0.19127090615004},
- {0.4256921447772345},
- {0.49425643168654704},
- {0.4549317231700774},
- {0.4341022020607075},
- {0.20589347955613144},
- {0.2740575242092816},
- {0.05441210126961683},
- {0.16565169701141505},
- {0.2496783031057329},
- {0.1970769731244576},
- {0.3789164600325212},
- {0.36013624505238995},
- {0.07947875288137762},
- {0.4537703025017412},
- {0.405367987433256},
- {0.07134438008650554},
- {0.24908157329879985},
- {0.3392424519662064},
- {0.16867824485911428},
- {0.268964147872615},
- {0.5381072472399467},
- {0.5873304557918275},
- {0.49718018926304536},
- {0.4507296007648004},
- {0.2072532391490048},
- {0.14457058800674183},
- {0.06714642865128828},
- {0.19349428092430504},
- {0.17695070782360137},
- {0.19940907840626965},
- {0.5137271540432367},
- {0.6154083223842417},
- {0.608253648624936},
- {0.5902046583425639},
- {0.07747445571471784},
- {0.4112035188375882},
- {0.5304623939620269},
- {0.48991087375262404},
- {0.16751669611545933},
- {0.4811571671396068},
- {0.6335720947582955},
- {0.16348699401211408},
- {0.20487598674036936},
- {0.5174246814222084},
- {0.25456624713494475},
- {0.1830301487305116},
- {0.31609812633275497},
- {0.17811288651213739},
- {0.5282870372806474},
- {0.17852019038054864},
- {0.6322917118969356},
- {0.5291694695414279},
- {0.21372131528230284},
- {0.1872747365044145},
- {0.5576572714567196},
- {0.3280898143254012},
- {0.23654450357725337},
- {0.4793422988051662},
- {0.1836885127447743},
- {0.2655309406802257},
- {0.1329947323517946},
- {0.6228376480560672},
- {0.062292169151931885},
- {0.5042579329016947},
- {0.6023985334435169},
- {0.18368852625500917},
- {0.4853476125935203},
- {0.35708116272605883},
- {0.12375925775687929},
- {0.5434431620524535},
- {0.23297800422040169},
- {0.4367789604284689},
- {0.2422781914581118},
- {0.18457954933212392},
- {0.5537418526233012},
- {0.32485314593309284},
- {0.07583983836704061},
- {0.6090869797777511},
- {0.13276514026059916},
- {0.5871138509683818},
- {0.03853425080954745},
- {0.19262035923740695},
- {0.34969388544297436},
- {0.5752901660548424},
- {0.18691390979881767},
- {0.15723521396715837},
- {0.39752089076741715},
- {0.27654053427614206},
- {0.2506808146918972},
- {0.10151414809775525},
- {0.1438282091668572},
- {0.4419982579978017},
- {0.02781999427202189},
- {0.14199521038278023},
- {0.5753494500204318},
- {0.21202322487598346},
- {0.046476858770151196},
- {0.3775507418155376},
- {0.06946578559177347},
- {0.034994386198402096},
- {0.47543114950129706},
- {0.5064227580427799},
- {0.6319126506221728},
- {0.2706252004296958},
- {0.4215093198570007},
- {0.4314614272705145},
- {0.36231457313702475},
- {0.5438376302126262},
- {0.007275483627140852},
- {0.20646699338447216},
- {0.2798480234042305},
- {0.20239641727886973},
- {0.12290898454951261},
- {0.5605388020383928},
- {0.1141291396114214},
- {0.4748403735633255},
- {0.569256862704226},
- {0.2957201699226196},
- {0.46162011592990476},
- {0.06808533722483798},
- {0.24554576635770597},
- {0.54411214148196},
- {0.2256041780116848},
- {0.01693844531073771},
- {0.28552569177963333},
- {0.4303515420437919},
- {0.6293319323019647},
- {0.5974615453293576},
- {0.6337357368918151},
- {0.5219058735978147},
- {0.4840466643724645},
- {0.37991305338323494},
- {0.40814500993592195},
- {0.29069977726023294},
- {0.18180697559367912},
- {0.5669380517768974},
- {0.5755249954863234},
- {0.2556922899602318},
- {0.08914910873342129},
- {0.2934977079987912},
- {0.3074255029743435},
- {0.2400020370444875},
- {0.4637067358578883},
- {0.4751879368937413},
- {0.4061238487210422},
- {0.35067491214798596},
- {0.16628771962802025},
- {0.5433047006458239},
- {0.23513471616289816},
- {0.49496115634343424},
- {0.25958155574710606},
- {0.4675265192363805},
- {0.4188467158450453},
- {0.2081086884739949},
- {0.5303906734091364},
- {0.39848647181622426},
- {0.16673385952506795},
- {0.3793160157385696},
- {0.578662250198378},
- {0.12826271338243247},
- {0.06136974709957315},
- {0.09169856134757078},
- {0.532659082943176},
- {0.571280400980427},
- {0.2702719630802774},
- {0.5347947509078245},
- {0.03257050467796936},
- {0.3933595019069773},
- {0.13181374274010255},
- {0.5534621404977706},
- {0.20025728198330772},
- {0.03632449322284687},
- {0.6012168890929066},
- {0.027162347452813228},
- {0.3420032042583877},
- {0.6099615529935956},
- {0.01897788569407296},
- {0.36047501174369506},
- {0.42161609700264085},
- {0.34850804561360565},
- {0.5172536993114479},
- {0.23023121417405185},
- {0.06554533344873142},
- {0.18734967782547135},
- {0.5742824132491567},
- {0.0867332456813839},
- {0.2958439056349853},
- {0.3598849186069415},
- {0.02199031338968801},
- {0.10814235559865577},
- {0.6021646585702591},
- {0.534895980191913},
- {0.11308251335634051},
- {0.5152086036693869},
- {0.40029444767376554},
- {0.38743844290208646},
- {0.19018134454434732},
- {0.5767710031499482},
- {0.05603774082149183},
- {0.5707128251891008},
- {0.6173258177121924},
- {0.4502898029224427},
- {0.25492936749829365},
- {0.5093418565373136},
- {0.12335510035335502},
- {0.5730435107776479},
- {0.35441216693666955},
- {0.2871141616207618},
- {0.42514223086750974},
- {0.3521680984272047},
- {0.6114729895235839},
- {0.5413532932253922},
- {0.3590385346048765},
- {0.3141063101004301},
- {0.17810719793722346},
- {0.19392976218547248},
- {0.055937032933036396},
- {0.03353381240028793},
- {0.23662951455012068},
- {0.21877713608695884},
- {0.05263606977190431},
- {0.09746251989150956},
- {0.19176835275080892},
- {0.4276795158220758},
- {0.25058936625198236},
- {0.10617543550848671},
- {0.587789929530831},
- {0.32038870029760513},
- {0.6087204034237553},
- {0.3918170739716197},
- {0.521300966762018},
- {0.018604997772957283},
- {0.0958862001825174},
- {0.48957741183711245},
- {0.6160857182753849},
- {0.3104487999756373},
- {0.3171405021014642},
- {0.4536261778964275},
- {0.41296749508238934},
- {0.01529689038596914},
- {0.4618175685171138},
- {0.34503165031698935},
- {0.5256146981723228},
- {0.1663289150116777},
- {0.38741272295277895},
- {0.5020302748124802},
- {0.4183757966769605},
- {0.1738817479264742},
- {0.5204321645869188},
- {0.12635450949808397},
- {0.04118417353232982},
- {0.022142458885709457},
- {0.34482898460709877},
- {0.4539541115796571},
- {0.2810417480216613},
- {0.19305908866229093},
- {0.4296719201869673},
- {0.4988772113205189},
- {0.4591848579934299},
- {0.438160602691934},
- {0.20781836780463464},
- {0.2766196748364},
- {0.05492079739023244},
- {0.1672003667682684},
- {0.25201253356602016},
- {0.19891943627790795},
- {0.38245893181284873},
- {0.3635031415051377},
- {0.08022179592361901},
- {0.4580125792590643},
- {0.409157753272426},
- {0.07201137526829234},
- {0.2514102249607911},
- {0.3424140133512047},
- {0.1702552096663895},
- {0.2714786807690661},
- {0.5431379860417755},
- {0.592821380005547},
- {0.501828302966132},
- {0.45494345014767107},
- {0.209190839724614},
- {0.14592217148832318},
- {0.067774177386792},
- {0.19530324966050164},
- {0.17860501148969252},
- {0.20127334429995689},
- {0.5185299645250773},
- {0.6211617452237714},
- {0.6139401827632265},
- {0.5957224533378431},
- {0.0781987606790418},
- {0.4150478407794973},
- {0.5354216613978469},
- {0.49449102697424796},
- {0.1690828016593351},
- {0.48565548237866535},
- {0.639495329833097},
- {0.16501542606462713},
- {0.20679136249742203},
- {0.5222620599098724},
- {0.25694617474912657},
- {0.18474128879756316},
- {0.3190533125293432},
- {0.17977805533095242},
- {0.5332259674113651},
- {0.1801891670636611},
- {0.6382029767338805},
- {0.5341166494889563},
- {0.2157193855909325},
- {0.18902555901863893},
- {0.6775194230482295},
- {0.3986090258073476},
- {0.2873870812627408},
- {0.5823715288078936},
- {0.2231702903296326},
- {0.3226038266499724},
- {0.16158045262471726},
- {0.7567095877031232},
- {0.07568116953625184},
- {0.612642497917405},
- {0.7318773155375723},
- {0.22317030674374033},
- {0.5896676171785891},
- {0.43383173812040354},
- {0.15035991675188912},
- {0.6602501508704163},
- {0.2830540030259163},
- {0.5306596800864435},
- {0.29435316079547996},
- {0.22425284519886077},
- {0.6727624290219879},
- {0.3946766719871833},
- {0.09214075770999111},
- {0.7400033681031956},
- {0.16130151229859757},
- {0.7133073626613591},
- {0.04681675414700768},
- {0.2340219366582746},
- {0.42485664876191903},
- {0.6989423098037151},
- {0.2270889501642807},
- {0.19103115282907587},
- {0.4829635303755949},
- {0.3359798084274819},
- {0.30456183328454256},
- {0.12333347123899485},
- {0.17474246330230467},
- {0.5370008069019409},
- {0.033799588803260464},
- {0.1725154820681286},
- {0.6990143361902038},
- {0.2575952298004782},
- {0.05646653625943221},
- {0.4587010227591857},
- {0.08439667405893964},
- {0.042516035494586796},
- {0.5776197219985053},
- {0.6152726278478495},
- {0.7677351598913741},
- {0.3287930401740835},
- {0.5121080022017269},
- {0.5241992030486278},
- {0.4401900111739405},
- {0.6607294055201279},
- {0.008839266914929625},
- {0.2508447489099169},
- {0.3399982051031804},
- {0.2458992483028192},
- {0.14932688689219842},
- {0.6810203061840151},
- {0.1386599131407943},
- {0.5769019654244724},
- {0.6916122158294958},
- {0.35928189080422945},
- {0.5608401622654342},
- {0.08271951385860574},
- {0.2983230641286812},
- {0.661062919895962},
- {0.2740952558987832},
- {0.02057917341288659},
- {0.3468962243685145},
- {0.5228507604891063},
- {0.7645997452256781},
- {0.7258791774159916},
- {0.769950098027747},
- {0.6340836647602416},
- {0.5880870447853648},
- {0.46157108660005625},
- {0.4958711843377465},
- {0.3531824212658684},
- {0.22088433795296256},
- {0.6887950026018483},
- {0.6992276131774454},
- {0.3106504687354049},
- {0.10831070588670555},
- {0.35658173571354884},
- {0.37350315339993617},
- {0.2915877726188692},
- {0.5633752776527677},
- {0.5773242335793929},
- {0.4934155972768701},
- {0.42604853611136245},
- {0.2020293926556034},
- {0.6600819287434295},
- {0.28567427591708555},
- {0.6013474839144363},
- {0.31537568841221636},
- {0.5680160804598483},
- {0.5088731014368295},
- {0.25283930787436665},
- {0.6443921767569197},
- {0.48413665219894203},
- {0.20257142530023653},
- {0.4608457224359791},
- {0.7030391854661275},
- {0.1558313394577704},
- {0.07456048324969357},
- {0.1114081346348599},
- {0.647148155379282},
- {0.6940706908742601},
- {0.32836387843366205},
- {0.6497428611265083},
- {0.03957116793288352},
- {0.47790769783450815},
- {0.1601456225932727},
- {0.6724225959244763},
- {0.24330032996093984},
- {0.044132034047676884},
- {0.730441690038451},
- {0.033000588204997246},
- {0.41551294224946234},
- {0.741065920984582},
- {0.023056968543664864},
- {0.4379550567715442},
- {0.5122377298925717},
- {0.42341592601311895},
- {0.6284315579918937},
- {0.27971682138641896},
- {0.07963356486984302},
- {0.22761838162176004},
- {0.6977179518791788},
- {0.10537558027289573},
- {0.3594322221147734},
- {0.4372381297591632},
- {0.026716883654206047},
- {0.13138633731231494},
- {0.7315931718936077},
- {0.6498658485054266},
- {0.13738832635660836},
- {0.6259468920682015},
- {0.4863332321102677},
- {0.4707139738643195},
- {0.2310586832188793},
- {0.7007414361590188},
- {0.06808242225753888},
- {0.6933811210571734},
- {0.7500130514869507},
- {0.547074526049988},
- {0.30972356468035217},
- {0.6188191536963713},
- {0.14986889026506298},
- {0.696212761270766},
- {0.4305890717374807},
- {0.34882611791671403},
- {0.5165217665294044},
- {0.42786266596885925},
- {0.7429022237787637},
- {0.657711088269729},
- {0.4362098250456635},
- {0.38161992479563384},
- {0.21638933474667313},
- {0.235612781026884},
- {0.0679600683423743},
- {0.04074152780380979},
- {0.28749036438705006},
- {0.2658008181810005},
- {0.0639496003167507},
- {0.11841099116887788},
- {0.2329868009704975},
- {0.5196044123165489},
- {0.3044507290321262},
- {0.12899664989518111},
- {0.7141287566985413},
- {0.3892526440295015},
- {0.7395580002893527},
- {0.47603374238131885},
- {0.633348740011002},
- {0.02260393256241423},
- {0.11649585928691367},
- {0.5948065641444242},
- {0.7485064066390257},
- {0.3771762740510295},
- {0.38530628220399},
- {0.5511280172589198},
- {0.501730208367969},
- {0.018584784740026793},
- {0.5610800550630585},
- {0.41919231868975626},
- {0.6385896594177556},
- {0.20207944252314117},
- {0.47068272570150055},
- {0.6099360298040946},
- {0.5083009634958506},
- {0.21125567183231056},
- {0.6322931985905905},
- {0.15351298863378668},
- {0.05003624792240847},
- {0.026901731111524354},
- {0.41894609226742696},
- {0.5515264365950103},
- {0.34144850738645827},
- {0.23455496603319015},
- {0.5220250615663182},
- {0.6061052508162625},
- {0.5578814730551527},
- {0.5323382907979233},
- {0.2524865860459753},
- {0.33607595936008894},
- {0.06672540441188687},
- {0.20313820302275298},
- {0.30617979013625063},
- {0.24167492938455667},
- {0.46466417293295226},
- {0.4416340489301661},
- {0.09746456770497158},
- {0.5564572262060362},
- {0.49710160545151016},
- {0.08748940957451418},
- {0.3054480220779847},
- {0.4160120501313003},
- {0.2068496500060075},
- {0.32982996650269153},
- {0.6598793807123539},
- {0.7202416608014871},
- {0.6096906463834634},
- {0.5527284223488215},
- {0.2541540553518902},
- {0.17728649924792841},
- {0.08234147371685704},
- {0.23728148416997202},
- {0.216994147717144},
- {0.2445347834322609},
- {0.629982142043162},
- {0.7546734684267513},
- {0.7458997124260552},
- {0.7237662871821017},
- {0.09500670381281474},
- {0.5042577009491446},
- {0.6505045189677005},
- {0.6007763055307365},
- {0.20542524609849336},
- {0.59004166010761},
- {0.7769476506219712},
- {0.20048363391607094},
- {0.2512388375114811},
- {0.6345164093096181},
- {0.3121738619416331},
- {0.22444934874130051},
- {0.387630229696169},
- {0.21841932412426698},
- {0.6478368852811073},
- {0.21891879969503383},
- {0.7753775207752491},
- {0.6489190094426961},
- {0.26208583864440893},
- {0.2296544746079167},
- {0.8482591459260862},
- {0.49906134095538746},
- {0.35981067377424797},
- {0.7291333042758938},
- {0.2794107938919044},
- {0.40390228996743127},
- {0.20229987817195944},
- {0.9474057964142514},
- {0.09475336359314736},
- {0.7670327733238258},
- {0.9163156146984501},
- {0.2794108144424842},
- {0.7382680589107982},
- {0.5431604277822255},
- {0.1882516872972298},
- {0.8266378940918429},
- {0.35438562894252507},
- {0.6643897011576794},
- {0.3685322549922581},
- {0.28076616030288953},
- {0.8423033555050224},
- {0.4941380059490429},
- {0.11536088528416356},
- {0.9264894904200549},
- {0.20195064289581918},
- {0.8930659013606482},
- {0.05861490982664465},
- {0.29299713242846104},
- {0.5319235519453885},
- {0.8750807528118651},
- {0.28431698393079397},
- {0.23917236470508146},
- {0.6046737818181875},
- {0.4206491144753766},
- {0.38131358569957713},
- {0.1544143849140129},
- {0.21877880933796018},
- {0.6723288371200442},
- {0.0423173260508366},
- {0.2159906129624282},
- {0.8751709303610373},
- {0.3225110634350522},
- {0.07069650579954027},
- {0.5742969493782778},
- {0.10566523736566326},
- {0.05323037942520222},
- {0.7231840082872968},
- {0.770325714740082},
- {0.9612098913665024},
- {0.41165122940638654},
- {0.6411628682394661},
- {0.6563011378664355},
- {0.5511210309568066},
- {0.8272379243286387},
- {0.011066825169582137},
- {0.31405941325348946},
- {0.42568017575002526},
- {0.3078676112498219},
- {0.18695832655112024},
- {0.8526422765607589},
- {0.17360319939731475},
- {0.7222853719415921},
- {0.8659034229190119},
- {0.4498234876708623},
- {0.7021758799237541},
- {0.10356542084274244},
- {0.37350260225651755},
- {0.8276554867039375},
- {0.3431692136958013},
- {0.025765271768212247},
- {0.43431654502822004},
- {0.6546128781723829},
- {0.9572843298608538},
- {0.9088059030251413},
- {0.9639830096977611},
- {0.7938772670092396},
- {0.7362891710107011},
- {0.5778902897602507},
- {0.6208342565638169},
- {0.44218690834161695},
- {0.27654876522571836},
- {0.8623762518814285},
- {0.8754379546689595},
- {0.3889366006740661},
- {0.13560577563481624},
- {0.4464428742549637},
- {0.46762860978699394},
- {0.3650699692878984},
- {0.7053498624549243},
- {0.7228140546808015},
- {0.617759844064121},
- {0.5334158034007493},
- {0.2529422393456737},
- {0.8264272787900383},
- {0.35766622927536346},
- {0.7528913352993999},
- {0.3948526093832066},
- {0.711160180641574},
- {0.6371127494286403},
- {0.3165566152909916},
- {0.8067835974915888},
- {0.6061425387011454},
- {0.253620868079492},
- {0.576982128657596},
- {0.8802100703371518},
- {0.19510194751650187},
- {0.09335025637592544},
- {0.13948377850100016},
- {0.8102341023669732},
- {0.8689814511951163},
- {0.4111139158490036},
- {0.8134826924533934},
- {0.04954338425166602},
- {0.5983438434468972},
- {0.20050346074742809},
- {0.8418778820451537},
- {0.3046137469648754},
- {0.055253621129911855},
- {0.9145182013427187},
- {0.04131697160781874},
- {0.5202251648048677},
- {0.9278198141997203},
- {0.028867488929688625},
- {0.5483228521178429},
- {0.6413252882328941},
- {0.5301197567967343},
- {0.7868007890561335},
- {0.3502074537478064},
- {0.09970179071712612},
- {0.28497983588849474},
- {0.8735478479650899},
- {0.13193097744946758},
- {0.4500117035429833},
- {0.5474252543892383},
- {0.033449728730079765},
- {0.16449663062569844},
- {0.9159598648312872},
- {0.8136366735282556},
- {0.17201116368168676},
- {0.783689969612965},
- {0.608892672403817},
- {0.5893372497709165},
- {0.28928711800502943},
- {0.877333271829987},
- {0.08523967784853898},
- {0.8681181048699782},
- {0.9390216853494544},
- {0.6849412052826812},
- {0.38777611019165736},
- {0.7747659903763684},
- {0.18763691863647577},
- {0.8716633385967772},
- {0.539100586362291},
- {0.4367327855037458},
- {0.6466889326319377},
- {0.5356871069105378},
- {0.9301188783842511},
- {0.8234589696214244},
- {0.5461378095598332},
- {0.4777908654177106},
- {0.2709209891782844},
- {0.29498888091494224},
- {0.08508648987481084},
- {0.051008683150510145},
- {0.3599399849819193},
- {0.33278451856371405},
- {0.08006535532655866},
- {0.14825140478669874},
- {0.29170113517058033},
- {0.6505484271255881},
- {0.3811744823837792},
- {0.16150472494959509},
- {0.894094292548777},
- {0.48734708429227014},
- {0.9259318867432574},
- {0.595997637864961},
- {0.792957135985829},
- {0.028300284652650366},
- {0.14585364602249704},
- {0.7447020571341797},
- {0.9371353552629088},
- {0.47222738301826417},
- {0.48240621116340426},
- {0.6900162051630355},
- {0.6281697964033635},
- {0.02326828293699422},
- {0.70247622741595},
- {0.5248317703287984},
- {0.799518804431936},
- {0.253004902136506},
- {0.5892981268483805},
- {0.7636442559586056},
- {0.6363964286492548},
- {0.2644936066250028},
- {0.7916355906052708},
- {0.19219935576339509},
- {0.06264573897682449},
- {0.03368115906393792},
- {0.5245234930933358},
- {0.6905150290111135},
- {0.42749596454411326},
- {0.29366448900443215},
- {0.6535790972367972},
- {0.7588480933662033},
- {0.6984715799476994},
- {0.666491333730892},
- {0.3161150050482112},
- {0.42076949612820996},
- {0.08354068183514014},
- {0.2543304778271635},
- {0.38333927920811206},
- {0.30257873386000034},
- {0.5817628558915854},
- {0.5529289765183817},
- {0.12202633333744163},
- {0.6966884127428628},
- {0.6223747525667134},
- {0.10953736427121145},
- {0.3824231003842963},
- {0.5208500514297677},
- {0.25897723589942806},
- {0.41294946855934833},
- {0.8261736872116948},
- {0.9017476920486225},
- {0.7633370341672767},
- {0.6920199237407081},
- {0.3182026885022583},
- {0.22196396047168118},
- {0.10309211189121044},
- {0.29707810914192295},
- {0.2716782193274489},
- {0.30615929150817},
- {0.7887421313383929},
- {0.9448565605700476},
- {0.9338717555319425},
- {0.9061605493950248},
- {0.11894907022875711},
- {0.6313342351269008},
- {0.8144362934984392},
- {0.752176215892566},
- {0.2571938720563583},
- {0.7387363633235092},
- {0.9727439954130399},
- {0.25100693838809474},
- {0.314552814991078},
- {0.7944190662689665},
- {0.3908438998245625},
- {0.2810121841383856},
- {0.48531580998497564},
- {0.2734625503455341},
- {0.8110963971122184},
- {0.27408789731959343},
- {0.9707781816555815},
- {0.8124512242741697},
- {0.3281333377094971},
- {0.2875290388171618},
- {0.5551750796589844},
- {0.32662945168382446},
- {0.23549161884565997},
- {0.477208695276078},
- {0.1828708956473011},
- {0.2643490342356461},
- {0.1324027586599188},
- {0.6200653314730036},
- {0.06201490008498659},
- {0.5020134272365541},
- {0.5997171935324004},
- {0.18287090909740047},
- {0.4831872787743574},
- {0.35549175651078785},
- {0.1232083921442146},
- {0.541024238766726},
- {0.231940994356587},
- {0.4348348108432465},
- {0.24119978547223356},
- {0.18375796613607762},
- {0.5512770887710272},
- {0.3234071900466085},
- {0.07550226718421628},
- {0.6063758688809768},
- {0.13217418850752838},
- {0.5845005448038202},
- {0.03836273076276052},
- {0.1917629855416835},
- {0.34813736078420443},
- {0.572729488368763},
- {0.18608193611617688},
- {0.15653534331469665},
- {0.3957514830236362},
- {0.2753096229600778},
- {0.24956500773675358},
- {0.10106229783297863},
- {0.14318801451801072},
- {0.4400308767642539},
- {0.027696164520076453},
- {0.141363174606381},
- {0.5727885084551194},
- {0.21107948696265583},
- {0.046269985330982345},
- {0.3758702233276941},
- {0.06915658599545382},
- {0.03483862246530928},
- {0.4733149549135402},
- {0.5041686165108017},
- {0.6290999402379575},
- {0.2694206188934194},
- {0.4196331370652208},
- {0.4295409465906654},
- {0.36070187245567004},
- {0.5414169511071834},
- {0.007243099676086701},
- {0.20554798684817568},
- {0.27860239010245025},
- {0.20149552930954714},
- {0.1223619035932833},
- {0.5580437842417136},
- {0.11362113867836438},
- {0.4727268085820717},
- {0.5667230398927385},
- {0.29440388800937684},
- {0.4595653957207741},
- {0.06778228215094992},
- {0.24445281604858585},
- {0.541690240497675},
- {0.2245999898322093},
- {0.016863050489996163},
- {0.28425478657234227},
- {0.4284360015810747},
- {0.6265307089693393},
- {0.59480218047717},
- {0.630914911756808},
- {0.5195828150725483},
- {0.4818921212121326},
- {0.37822201999547506},
- {0.40632831310831113},
- {0.2894058416484298},
- {0.1809977334180847},
- {0.5644145502393516},
- {0.5729632725494808},
- {0.2545541763959175},
- {0.0887522965733369},
- {0.2921913184998331},
- {0.3060571193793369},
- {0.23893376246387385},
- {0.4616427278816373},
- {0.4730728248711557},
- {0.404316148296861},
- {0.34911402083506277},
- {0.16554755531052365},
- {0.5408863936665367},
- {0.23408810654495535},
- {0.4927580316190603},
- {0.2584261306473209},
- {0.46544550899824483},
- {0.4169823845867743},
- {0.2071823745783324},
- {0.5280298481379221},
- {0.3967127661685477},
- {0.16599170939146213},
- {0.37762763982883496},
- {0.5760865630073021},
- {0.12769180241003272},
- {0.06109658383124218},
- {0.09129040130287794},
- {0.5302881607399794},
- {0.5687375711849573},
- {0.2690689538409946},
- {0.5324143226194823},
- {0.032425529899197864},
- {0.391608616947396},
- {0.13122702575853504},
- {0.5509986216739026},
- {0.19936591553258928},
- {0.03616280904198949},
- {0.5985408088064109},
- {0.02704144495677209},
- {0.3404809116391383},
- {0.607246549278465},
- {0.018893413107379825},
- {0.35887049914565905},
- {0.41973943893443466},
- {0.34695679925397854},
- {0.5149513481084856},
- {0.22920643056473455},
- {0.06525358420166921},
- {0.18651576449301904},
- {0.571726221177946},
- {0.08634718678456559},
- {0.2945270729609329},
- {0.35828303257618777},
- {0.021892432167081647},
- {0.10766100247767242},
- {0.599484359661066},
- {0.532515101321266},
- {0.1125791710680078},
- {0.5129153554045339},
- {0.39851269453334787},
- {0.3857139132055818},
- {0.1893348271623053},
- {0.5742037341005363},
- {0.05578831087993046},
- {0.5681725217338152},
- {0.6145780348719316},
- {0.44828551514099185},
- {0.2537946497829608},
- {0.5070747217876176},
- {0.12280603368825789},
- {0.570492833193041},
- {0.35283464070538817},
- {0.2858361859653435},
- {0.4232498776026208},
- {0.3506005607834176},
- {0.6087512582437832},
- {0.5389436721679802},
- {0.35744041591929193},
- {0.31270818952269336},
- {0.1773144238652876},
- {0.1930665601980294},
- {0.05568805125299243},
- {0.033384549836438716},
- {0.23557625142564986},
- {0.21780333579684785},
- {0.05240178102980372},
- {0.09702870385459254},
- {0.19091477142653096},
- {0.42577586883212465},
- {0.24947396634356636},
- {0.1057028373579207},
- {0.5851736140687165},
- {0.31896261613324306},
- {0.6060109241973022},
- {0.39007305452274843},
- {0.5189806007413831},
- {0.01852218495004137},
- {0.09545940051219781},
- {0.4873982507318621},
- {0.6133434552495478},
- {0.30906695936428236},
- {0.3157288760125771},
- {0.4516070395552898},
- {0.41112933286073106},
- {0.015228802300705368},
- {0.459761969425527},
- {0.3434958777623902},
- {0.5232751312746038},
- {0.16558856732914914},
- {0.3856883077385028},
- {0.4997956846903087},
- {0.41651356152996827},
- {0.17310778178172814},
- {0.5181156656971244},
- {0.12579209214402756},
- {0.041000858397800294},
- {0.022043900447326282},
- {0.343294114139119},
- {0.4519335135708339},
- {0.27979080132470846},
- {0.19219976213525763},
- {0.427759404793383},
- {0.4966566558191406},
- {0.45714097737625775},
- {0.43621030327011956},
- {0.2068933461571344},
- {0.2753884112572889},
- {0.05467633908262173},
- {0.16645614016133042},
- {0.25089079898859773},
- {0.19803402472064563},
- {0.3807565664495557},
- {0.36188515037962415},
- {0.07986472018188065},
- {0.4559739165791594},
- {0.40733654861656343},
- {0.07169084498171029},
- {0.2502911713229997},
- {0.34088989217701154},
- {0.16949738562896294},
- {0.27027030030106886},
- {0.5407204211269138},
- {0.5901826690224946},
- {0.4995946118421194},
- {0.45291844848770874},
- {0.2082597090586955},
- {0.14527265639058246},
- {0.06747250731842135},
- {0.19443393413429683},
- {0.1778100215967139},
- {0.2003774552478532},
- {0.516221932529974},
- {0.6183968882623734},
- {0.6112074697440378},
- {0.5930708293689864},
- {0.07785068968223845},
- {0.41320041871798735},
- {0.533038442664269},
- {0.49228999484567393},
- {0.1683301961345823},
- {0.4834937781983603},
- {0.6366488681376273},
- {0.16428092486103404},
- {0.2058709121597213},
- {0.5199374159614661},
- {0.25580248001032097},
- {0.18391898568196227},
- {0.31763317231789784},
- {0.1789778440951344},
- {0.5308525219451373},
- {0.17938712592581701},
- {0.6353622674394406},
- {0.5317392395021161},
- {0.21475919567333748},
- {0.18818418616083912},
- {0.8586047890301015},
- {0.5051480546033718},
- {0.3641990412133278},
- {0.7380260500570837},
- {0.2828185783725059},
- {0.4088284130289581},
- {0.20476719296556292},
- {0.9589606641589151},
- {0.09590900628482678},
- {0.7763877532966358},
- {0.9274912965237926},
- {0.2828185991737273},
- {0.7472722151162072},
- {0.5497849881669229},
- {0.19054766580787655},
- {0.8367198374102286},
- {0.3587078307788857},
- {0.672492812999352},
- {0.3730269936588308},
- {0.2841904752709377},
- {0.852576359861322},
- {0.5001646730097292},
- {0.11676786398052673},
- {0.9377892561267275},
- {0.20441369830295614},
- {0.9039580221567712},
- {0.05932979623907285},
- {0.2965706202914129},
- {0.5384110637552838},
- {0.8857535209149439},
- {0.28778460589312105},
- {0.24208938827914595},
- {0.6120485789790441},
- {0.4257794872291312},
- {0.3859642096124538},
- {0.15629767273250422},
- {0.22144710650988267},
- {0.6805287772336139},
- {0.042833441856414196},
- {0.21862490438888518},
- {0.8858447982986939},
- {0.32644451275348285},
- {0.07155874326696479},
- {0.5813012608584751},
- {0.10695396480177331},
- {0.05387959436201641},
- {0.7320041945289711},
- {0.7797208564922476},
- {0.9729331183212445},
- {0.4166718610414491},
- {0.6489826981089225},
- {0.6643055989721423},
- {0.5578426814344697},
- {0.8373271858100072},
- {0.011201799751405282},
- {0.31788978351071767},
- {0.43087190895551436},
- {0.31162246428568174},
- {0.18923853081547887},
- {0.8630413777447047},
- {0.17572052020818443},
- {0.7310945981235282},
- {0.8764642613362449},
- {0.45530968052312504},
- {0.7107398442321002},
- {0.10482853823688078},
- {0.3780579608871024},
- {0.8377498409111898},
- {0.3473546165013393},
- {0.026079513362272363},
- {0.43961361018880313},
- {0.6625967487164135},
- {0.9689596793968668},
- {0.91988999397621},
- {0.9757400585012604},
- {0.8035596511159291},
- {0.745269192058764},
- {0.5849384267828212},
- {0.6284061521054131},
- {0.44757996300061026},
- {0.2799216434783399},
- {0.8728940717790299},
- {0.8861150793215046},
- {0.3936801973449512},
- {0.1372596675666614},
- {0.45188783605178606},
- {0.4733319596716584},
- {0.3695224807973653},
- {0.7139525376815594},
- {0.7316297288485463},
- {0.6252942430757604},
- {0.5399215151923988},
- {0.25602720476781937},
- {0.8365066533760324},
- {0.36202844237523174},
- {0.7620738417168337},
- {0.3996683596111727},
- {0.7198337203894685},
- {0.6448831827381576},
- {0.3204174422325511},
- {0.8166233913822979},
- {0.6135352492963464},
- {0.25671411027733054},
- {0.5840191894534094},
- {0.8909453972570008},
- {0.197481474018041},
- {0.09448878631783286},
- {0.14118496781101397},
- {0.8201159797319848},
- {0.8795798302414854},
- {0.4161279942340053},
- {0.8234041906745864},
- {0.05014763140195551},
- {0.6056414386305344},
- {0.20294886585266653},
- {0.8521456971894216},
- {0.3083289148187214},
- {0.0559275121774295},
- {0.9256719613329968},
- {0.04182088676681954},
- {0.5265699992987214},
- {0.9391358049658022},
- {0.029219566168360328},
- {0.5550103751006854},
- {0.6491470990291617},
- {0.5365852689371531},
- {0.7963968661472277},
- {0.3544786972071212},
- {0.10091778602769186},
- {0.2884555422078465},
- {0.8842019202644943},
- {0.13354005035320382},
- {0.45550019193694324},
- {0.5541018299796527},
- {0.03385769244851363},
- {0.1665028847762606},
- {0.9271312078161024},
- {0.8235600497524774},
- {0.17410906750966645},
- {0.7932481061432358},
- {0.6163189245198052},
- {0.596524997622872},
- {0.2928153573312341},
- {0.8880335123840948},
- {0.08627928854953468},
- {0.8787059542651223},
- {0.9504742977618446},
- {0.6932949699206711},
- {0.3925055531449973},
- {0.7842152871674005},
- {0.18992539922955068},
- {0.8822944268099571},
- {0.5456756316069616},
- {0.44205931991524505},
- {0.6545761601713738},
- {0.5422205202549568},
- {0.9414629092812773},
- {0.8335021417480304},
- {0.5527986830563943},
- {0.48361815746131565},
- {0.2742252292526609},
- {0.2985866607871145},
- {0.08612423224569582},
- {0.0516308015604506},
- {0.36432992954234267},
- {0.3368432662661547},
- {0.08104185831527731},
- {0.15005952690475458},
- {0.29525881663149317},
- {0.6584827263090907},
- {0.38582340974759216},
- {0.16347448885012636},
- {0.9049989559366951},
- {0.4932909270743787},
- {0.9372248517350055},
- {0.6032666179659129},
- {0.8026282978767335},
- {0.02864544408436945},
- {0.14763252429857004},
- {0.7537846844644456},
- {0.9485649613830055},
- {0.47798682102976525},
- {0.488289793457596},
- {0.6984318661422169},
- {0.6358311585631738},
- {0.02355207044705588},
- {0.7110438548595259},
- {0.5312327884746652},
- {0.8092699945550574},
- {0.25609063181433106},
- {0.5964853975445097},
- {0.772957908476851},
- {0.6441581254786916},
- {0.2677194562613763},
- {0.8012906345009627},
- {0.19454348131641688},
- {0.06340978668624701},
- {0.03409194538163174},
- {0.5309207513902572},
- {0.6989367738074028},
- {0.43270984369746057},
- {0.2972461161641912},
- {0.6615503594539283},
- {0.7681032503330736},
- {0.7069903654145481},
- {0.6746200777636735},
- {0.3199704459683116},
- {0.42590133709556705},
- {0.08455957103083385},
- {0.2574323746551675},
- {0.3880146091346852},
- {0.3062690820353363},
- {0.5888582239841466},
- {0.5596726772853006},
- {0.12351460599570166},
- {0.7051854501253146},
- {0.629965436496181},
- {0.11087331742037235},
- {0.38708725629739},
- {0.527202507243159},
- {0.262135806092921},
- {0.417985933939328},
- {0.8362499689127181},
- {0.9127456987740549},
- {0.772646939709115},
- {0.7004600227202163},
- {0.32208359148549526},
- {0.22467110477778443},
- {0.1043494566561776},
- {0.30070136991778246},
- {0.2749916948258211},
- {0.30989330932352016},
- {0.7983618856683256},
- {0.9563803370092314},
- {0.9452615577333745},
- {0.9172123767569856},
- {0.1203998115901104},
- {0.6390341918056333},
- {0.8243694221466343},
- {0.7613500004822478},
- {0.2603306917671908},
- {0.7477462311211142},
- {0.9846078960340351},
- {0.25406830025335314},
- {0.3183892029355997},
- {0.8041080583347946},
- {0.3956107585332322},
- {0.2844394996927632},
- {0.4912348786881597},
- {0.27679778812254624},
- {0.8209887913030461},
- {0.27743076203071043},
- {0.9826181065757058},
- {0.8223601423755884},
- {0.33213535810476863},
- {0.2910358360405449},
- {0.14230073973744067},
- {0.08372063930389834},
- {0.06036047508524465},
- {0.12231663998433917},
- {0.04687289592148779},
- {0.06775711752717124},
- {0.03393706092167779},
- {0.15893320609482053},
- {0.015895465196776603},
- {0.12867451128708712},
- {0.1537176350302729},
- {0.046872899368975186},
- {0.12384905180460637},
- {0.09111853499101598},
- {0.03158038965789282},
- {0.13867364046614036},
- {0.059450390123154284},
- {0.11145549847913225},
- {0.06182357449886554},
- {0.04710026705426574},
- {0.14130161890660864},
- {0.08289471928082191},
- {0.019352504940905083},
- {0.1554243658661669},
- {0.033878474535222844},
- {0.1498173512283922},
- {0.009833015144055646},
- {0.049152088587267516},
- {0.08923347928416127},
- {0.14680023086479688},
- {0.04769593976979696},
- {0.04012264952961869},
- {0.10143778215161331},
- {0.07056650134245802},
- {0.06396772210188925},
- {0.025903972040733646},
- {0.036701503965134934},
- {0.11278733784183931},
- {0.007098994251538822},
- {0.03623376670739127},
- {0.14681535870870702},
- {0.05410323380623539},
- {0.011859777899763954},
- {0.09634187985826378},
- {0.0177259997889564},
- {0.00892972672925468},
- {0.1213186086348863},
- {0.12922692266006883},
- {0.1612489287516822},
- {0.06905705024188441},
- {0.10755905300973356},
- {0.11009859175400581},
- {0.09245397561189178},
- {0.13877429926477633},
- {0.0018565286513441122},
- {0.05268541700035181},
- {0.07141049311606311},
- {0.05164670376081731},
- {0.03136342036047625},
- {0.14303603712229682},
- {0.029123014840062682},
- {0.12116785680702466},
- {0.14526067678060037},
- {0.07546068362983122},
- {0.1177943646335234},
- {0.01737374252658605},
- {0.062657381120171},
- {0.13884434794645212},
- {0.05756876680735901},
- {0.0043222843511460055},
- {0.07285929769758177},
- {0.1098153757056008},
- {0.16059039142989623},
- {0.15245783425894133},
- {0.16171413657385872},
- {0.1331778418172177},
- {0.12351708106972695},
- {0.09694468502333503},
- {0.10414880215281899},
- {0.07417960002132044},
- {0.04639277283846061},
- {0.14466897193398698},
- {0.14686015369468233},
- {0.0652465302056499},
- {0.022748711025610567},
- {0.07489356473443343},
- {0.07844760344131743},
- {0.06124275456986275},
- {0.11832681991475248},
- {0.12125654661984568},
- {0.10363305036273705},
- {0.08948381373324084},
- {0.04243263151667863},
- {0.13863830844126243},
- {0.060000731202749874},
- {0.12630219723484074},
- {0.0662389774072474},
- {0.11930153687482428},
- {0.10687962042645642},
- {0.053104338150706684},
- {0.13534295890879836},
- {0.10168417524026215},
- {0.04254647570131633},
- {0.09679233535834268},
- {0.14766070573465476},
- {0.03272956335236815},
- {0.015660085247264078},
- {0.0233992700902693},
- {0.13592180253057717},
- {0.14577703513963017},
- {0.06896691255571415},
- {0.13646677369254043},
- {0.008311210391267218},
- {0.10037589567853127},
- {0.03363570074228479},
- {0.14123024309136545},
- {0.05110084781929649},
- {0.00926913809031168},
- {0.15341610777723597},
- {0.006931178581145236},
- {0.08727100218995479},
- {0.15564753594201677},
- {0.004842700545919033},
- {0.09198456373391259},
- {0.10758629997232039},
- {0.0889308814457282},
- {0.1319907186929945},
- {0.05874947528620079},
- {0.01672559457841766},
- {0.04780713730226123},
- {0.14654307655683468},
- {0.02213224080813945},
- {0.07549225801127088},
- {0.09183398614051967},
- {0.00561139972986726},
- {0.027595331373406848},
- {0.15365795578071584},
- {0.13649260497412896},
- {0.0288559409616255},
- {0.1314688594120442},
- {0.10214552724824995},
- {0.09886498365505125},
- {0.0485297106271519},
- {0.14717810491907712},
- {0.014299485329551827},
- {0.14563220343188285},
- {0.15752671939521773},
- {0.11490314092867167},
- {0.06505185072014347},
- {0.12997180647383763},
- {0.03147725839710672},
- {0.14622693840678827},
- {0.09043747137967977},
- {0.07326463704311335},
- {0.108486084630509},
- {0.0898648390026569},
- {0.15603321823702512},
- {0.13814035614391107},
- {0.09161800927487034},
- {0.0801523849347998},
- {0.04544867845589762},
- {0.049486216765381966},
- {0.014273787095603997},
- {0.008557023381605603},
- {0.06038216784340275},
- {0.055826669706088766},
- {0.013431460592000623},
- {0.024870093849952108},
- {0.048934676998627614},
- {0.10913353880073128},
- {0.06394438665678025},
- {0.02709342061538096},
- {0.14998987023689692},
- {0.08175549999872062},
- {0.15533082438645557},
- {0.09998230512134236},
- {0.13302348412368084},
- {0.004747548505893971},
- {0.024467854926273513},
- {0.12492839496412751},
- {0.15721027580838037},
- {0.07921907621097446},
- {0.08092663784667291},
- {0.11575450367625914},
- {0.10537938451736435},
- {0.0039033989674693834},
- {0.11784474979061015},
- {0.08804378887534708},
- {0.13412424475594428},
- {0.04244314358900025},
- {0.09885842054182778},
- {0.12810606645510414},
- {0.10675945316709304},
- {0.04437044511612154},
- {0.13280178667879833},
- {0.032242635559598},
- {0.010509211766963393},
- {0.005650223605641384},
- {0.08799207345458065},
- {0.11583818447465793},
- {0.07171510296300272},
- {0.049264041797422005},
- {0.10964195253348788},
- {0.127301480394255},
- {0.11717294530744411},
- {0.11180806039521739},
- {0.05303025528991457},
- {0.07058669611233616},
- {0.01401446819689991},
- {0.04266551714343164},
- {0.06430754476826457},
- {0.05075946173275691},
- {0.09759433204195864},
- {0.09275726970786793},
- {0.02047067524678187},
- {0.11687380793469375},
- {0.10440722992436446},
- {0.018375573124726558},
- {0.06415385008075439},
- {0.08737583080206275},
- {0.04344503966816938},
- {0.06927483792234718},
- {0.13859576687909622},
- {0.15127377553348542},
- {0.12805452809164583},
- {0.11609063991150971},
- {0.05338047715463043},
- {0.03723583284880316},
- {0.017294342010539948},
- {0.04983669777535106},
- {0.045575708516104},
- {0.051360122514847076},
- {0.13231639091730926},
- {0.15850555595024193},
- {0.15666278668532893},
- {0.1520140597588483},
- {0.01995444524933873},
- {0.10591023876559241},
- {0.136626746190068},
- {0.12618223151318386},
- {0.0431458693081342},
- {0.1239276127781852},
- {0.16318384633661318},
- {0.042107972762097906},
- {0.052768188206042656},
- {0.13326873200781408},
- {0.06556649148319077},
- {0.04714153908057075},
- {0.08141474111869453},
- {0.04587504112575452},
- {0.1360664578292667},
- {0.04597994696429289},
- {0.1628540688703567},
- {0.1362937384996703},
- {0.05504640523221138},
- {0.04823478192505411},
- {0.5774418142429179},
- {0.3397297718790444},
- {0.24493662018973691},
- {0.4963483860658457},
- {0.19020540658933732},
- {0.27495143697040114},
- {0.1377131142455332},
- {0.6449346576846356},
- {0.06450216828385774},
- {0.5221479760508008},
- {0.623770404966188},
- {0.19020542057888776},
- {0.5025667561410475},
- {0.3697496742002205},
- {0.1281499838454732},
- {0.5627234172231745},
- {0.2412435887087039},
- {0.4522749872410215},
- {0.25087372762415955},
- {0.19112805533775576},
- {0.573387484333825},
- {0.33637827309256746},
- {0.07853048117557346},
- {0.6306961437369166},
- {0.13747537669513885},
- {0.6079434531261922},
- {0.0399013674471268},
- {0.19945413678122065},
- {0.3621003113836704},
- {0.5957002879834228},
- {0.19354523415345276},
- {0.16281359871609946},
- {0.41162412132558984},
- {0.2863516284957376},
- {0.2595744587951926},
- {0.10511566305908285},
- {0.14893094072577814},
- {0.45767945484463823},
- {0.02880699093674542},
- {0.1470329108827931},
- {0.5957616752232162},
- {0.21954537652527328},
- {0.04812576294117394},
- {0.3909454722131132},
- {0.07193029000615549},
- {0.03623591565826275},
- {0.492298477160504},
- {0.5243896047732624},
- {0.654331622835547},
- {0.28022643066729047},
- {0.4364636109607604},
- {0.44676879885042614},
- {0.37516875534031185},
- {0.5631318803092492},
- {0.007533602949669266},
- {0.2137920212710131},
- {0.2897764605932786},
- {0.2095770294261244},
- {0.1272695446786326},
- {0.5804255756534545},
- {0.11817820874647599},
- {0.49168674169699567},
- {0.5894529353333675},
- {0.3062117185027944},
- {0.47799745628221074},
- {0.07050086614624664},
- {0.25425722941777457},
- {0.5634161306786206},
- {0.23360815418320985},
- {0.01753938680856229},
- {0.29565556106443014},
- {0.4456195371591978},
- {0.6516593458920793},
- {0.6186582625815134},
- {0.6562193884882994},
- {0.5404220296941771},
- {0.5012196529300732},
- {0.393391593777878},
- {0.4226251625769106},
- {0.3010132125466044},
- {0.18825711633705433},
- {0.5870518577229827},
- {0.5959434486842559},
- {0.2647637309863744},
- {0.09231193731356417},
- {0.30391040816207393},
- {0.3183323329010406},
- {0.24851681989359792},
- {0.48015810523009006},
- {0.49204663586560454},
- {0.420532294683789},
- {0.3631161429156127},
- {0.17218726881744603},
- {0.5625800434881958},
- {0.24347681639283567},
- {0.5125213688187464},
- {0.2687909799921643},
- {0.48411340673334086},
- {0.433706543188188},
- {0.21549196035447804},
- {0.5492078529001384},
- {0.41262395922094314},
- {0.17264923684824823},
- {0.39277337445509164},
- {0.5991920067958334},
- {0.13281321289292897},
- {0.06354702057813462},
- {0.09495183930748102},
- {0.5515567409785814},
- {0.5915482646210986},
- {0.2798606611770555},
- {0.5537681780874452},
- {0.0337260397643963},
- {0.40731509487451245},
- {0.13649022553075668},
- {0.5730978485924849},
- {0.2073620019725171},
- {0.03761321216750813},
- {0.6225468382836916},
- {0.028126012149500453},
- {0.3541367805139107},
- {0.631601745026982},
- {0.019651182377760344},
- {0.37326393006008063},
- {0.4365741763417821},
- {0.36087240037538487},
- {0.5356048057510973},
- {0.23839934815291347},
- {0.06787074821587788},
- {0.19399646234105022},
- {0.5946567821632559},
- {0.08981036436700003},
- {0.3063398441059062},
- {0.3726529016221851},
- {0.022770484864909155},
- {0.11197902584551352},
- {0.6235282326893574},
- {0.5538729987801009},
- {0.11709445032620208},
- {0.5334871542861263},
- {0.41449607837498714},
- {0.4011839687706741},
- {0.19692859082062286},
- {0.5972336621588593},
- {0.05802584559062463},
- {0.5909605523981276},
- {0.6392272788401848},
- {0.4662651668746354},
- {0.2639737415912797},
- {0.5274122669295973},
- {0.12773148776145168},
- {0.5933739259584953},
- {0.36698598788298525},
- {0.2973003865762276},
- {0.4402254102454923},
- {0.36466230439903136},
- {0.6331668042428505},
- {0.5605594041119035},
- {0.3717764896417192},
- {0.32525016144009494},
- {0.18442607811413575},
- {0.20080999467567773},
- {0.05792156479165581},
- {0.03472352368027315},
- {0.24502464717856257},
- {0.2265389027330704},
- {0.054503490189070664},
- {0.1009202913463805},
- {0.19857190284193615},
- {0.44285271289607664},
- {0.2594797659511162},
- {0.10994232344159585},
- {0.6086435175773408},
- {0.3317554380300734},
- {0.6303165620014236},
- {0.4057179447414113},
- {0.5397956619974051},
- {0.019265065153616846},
- {0.09928804702863031},
- {0.5069466200361653},
- {0.6379431832042377},
- {0.3214628903146684},
- {0.3283920003858361},
- {0.4697199096289796},
- {0.42761873966210023},
- {0.015839592862611156},
- {0.47820191408455787},
- {0.35727266966289933},
- {0.5442624358013515},
- {0.17222992572930781},
- {0.40115733633001466},
- {0.5198412851953427},
- {0.43321891676834356},
- {0.18005071775377296},
- {0.5388960364928422},
- {0.13083730982607708},
- {0.04264530402424671},
- {0.022928028172866065},
- {0.35706281378690874},
- {0.47005947773054996},
- {0.2910125361258276},
- {0.19990843143141857},
- {0.44491580370481504},
- {0.5165763574405853},
- {0.4754758003602604},
- {0.4537056473544741},
- {0.21519133969980658},
- {0.28643357680168574},
- {0.05686927528415605},
- {0.17313229481711045},
- {0.2609534243392558},
- {0.20597669222969756},
- {0.3960277947824805},
- {0.37639949169033204},
- {0.0830679016503327},
- {0.47426193156697416},
- {0.4236738359817524},
- {0.0745661920132921},
- {0.26032974705297374},
- {0.3545621642755965},
- {0.17629551731165483},
- {0.281110190748638},
- {0.5624074141899693},
- {0.6138534736544918},
- {0.519632147799758},
- {0.47108391601344396},
- {0.21661250412468733},
- {0.1510991925602877},
- {0.07017866699168088},
- {0.20223221068543043},
- {0.18494155307627794},
- {0.20841411210815133},
- {0.5369263502518765},
- {0.6431992972374424},
- {0.6357215284674008},
- {0.6168574711525912},
- {0.08097309324076157},
- {0.4297728917821873},
- {0.5544173300832236},
- {0.5120345602182548},
- {0.1750815146593484},
- {0.5028855485183448},
- {0.6621833200418623},
- {0.1708698368729541},
- {0.21412789833861925},
- {0.540790852770232},
- {0.266062101050589},
- {0.19129553298960084},
- {0.33037267342698906},
- {0.1861562141208908},
- {0.5521437373516802},
- {0.18658191125951454},
- {0.6608451168901224},
- {0.553066019013057},
- {0.22337266948497644},
- {0.19573180038140317},
- {0.3840873176818543},
- {0.225972372625578},
- {0.16292039670538805},
- {0.33014775781296185},
- {0.12651575037264642},
- {0.18288485058393572},
- {0.09160032986099315},
- {0.42898040398222637},
- {0.04290382890489532},
- {0.3473084397556179},
- {0.4149029318337515},
- {0.12651575967784182},
- {0.33428392707474075},
- {0.24594020916808587},
- {0.08523938229293972},
- {0.37429732760414985},
- {0.16046396469669408},
- {0.30083219195297367},
- {0.16686948319865866},
- {0.12712945321542926},
- {0.38139056683809625},
- {0.2237431122094447},
- {0.052234807260256},
- {0.4195096097046674},
- {0.09144219794918669},
- {0.4043755828795128},
- {0.02654052549813759},
- {0.1326675736104926},
- {0.24085221038844074},
- {0.39623200140752046},
- {0.12873724763692557},
- {0.10829599947656268},
- {0.27379313508908226},
- {0.19046772538798287},
- {0.17265680308946785},
- {0.06991802823224086},
- {0.09906190395684691},
- {0.30442699131486817},
- {0.01916106455485309},
- {0.09779942317819386},
- {0.39627283333151797},
- {0.14603132765783972},
- {0.03201100915025222},
- {0.26003866377268015},
- {0.04784466844467177},
- {0.024102438212195577},
- {0.32745394761435687},
- {0.34879946645651194},
- {0.43523082618951925},
- {0.18639352995188774},
- {0.2903152031334054},
- {0.29716973267581254},
- {0.24954472877172237},
- {0.37456901816626853},
- {0.005011000724310749},
- {0.14220446453020694},
- {0.19274576369662166},
- {0.13940084887262463},
- {0.08465375529185871},
- {0.3860719763756107},
- {0.07860662336237614},
- {0.32704704976332777},
- {0.3920765542909683},
- {0.20367772942922413},
- {0.31794157664680317},
- {0.046893882473443387},
- {0.16912003052001118},
- {0.3747580882322544},
- {0.15538523036555207},
- {0.01166638069312247},
- {0.1966562666679163},
- {0.2964052974904646},
- {0.433453352411204},
- {0.4115025735505334},
- {0.43648647970835597},
- {0.35946348650480614},
- {0.3333878969532953},
- {0.2616657095586977},
- {0.28111051377851276},
- {0.20021992613300116},
- {0.12521983871781384},
- {0.3904794696390233},
- {0.39639374054563786},
- {0.17610846451659404},
- {0.06140158803578918},
- {0.20214700530409352},
- {0.2117397958713333},
- {0.16530177828722628},
- {0.31937873938488986},
- {0.32728643455060985},
- {0.2797184358314291},
- {0.24152789406547395},
- {0.11453092690519227},
- {0.3742019620938322},
- {0.1619494034193741},
- {0.34090527036445734},
- {0.17878720240865123},
- {0.3220096211595296},
- {0.2884813304568608},
- {0.14333518459010883},
- {0.3653074056418867},
- {0.2744581805462534},
- {0.11483820645687874},
- {0.26125449894739233},
- {0.3985545296340508},
- {0.08834114439674871},
- {0.042268509274012406},
- {0.06315752751016876},
- {0.366869776255395},
- {0.3934702694427538},
- {0.18615023717514556},
- {0.36834072090542735},
- {0.02243298602495932},
- {0.27092697200460875},
- {0.09078692141931709},
- {0.38119791467427266},
- {0.137927516093004},
- {0.025018551505068577},
- {0.41408907243962173},
- {0.018708109279811074},
- {0.23555524169722655},
- {0.4201119733745836},
- {0.01307104844606162},
- {0.24827772798568506},
- {0.29038874605942433},
- {0.240035461351756},
- {0.3562592941908218},
- {0.15857210875732505},
- {0.045144450901040294},
- {0.12903738354666044},
- {0.39553791008685846},
- {0.059737658581198075},
- {0.20376295259459207},
- {0.24787130041506253},
- {0.015145862731719351},
- {0.07448321651250739},
- {0.414741850149103},
- {0.3684104427331278},
- {0.07788575789265972},
- {0.35485073136959255},
- {0.2757034267451286},
- {0.26684883335668286},
- {0.130987698426947},
- {0.39725193027224637},
- {0.03859608161273335},
- {0.3930793507290031},
- {0.42518412221445484},
- {0.31013780584656947},
- {0.1755830004780106},
- {0.3508100001089931},
- {0.08496101824931235},
- {0.39468461407242966},
- {0.24410193414483936},
- {0.19775032775476237},
- {0.29281737627239873},
- {0.24255632845006708},
- {0.4211529776479308},
- {0.3728579271817433},
- {0.2472883521102143},
- {0.21634121222569277},
- {0.12267161107187055},
- {0.13356942693838603},
- {0.038526718897090445},
- {0.023096465724956872},
- {0.16297894814587557},
- {0.15068309456497359},
- {0.03625317535839701},
- {0.06712746296996788},
- {0.13208075281063084},
- {0.29456493525221455},
- {0.17259381783348557},
- {0.07312849722488089},
- {0.4048412330465321},
- {0.22066821829729025},
- {0.41925712966766543},
- {0.26986462235235453},
- {0.35904685597580455},
- {0.012814221307336867},
- {0.06604177030562892},
- {0.3371972079175785},
- {0.42433000178830504},
- {0.21382209640827277},
- {0.21843101671073903},
- {0.31243573932673596},
- {0.2844320079636935},
- {0.010535757171914191},
- {0.3180775724249849},
- {0.23764108865543798},
- {0.362017945229704},
- {0.11455930029010045},
- {0.266831118701381},
- {0.3457741367634528},
- {0.2881569841435021},
- {0.11976132576995388},
- {0.35844846711922546},
- {0.08702686598769116},
- {0.0283656639169355},
- {0.015250653180002407},
- {0.23750150233085798},
- {0.3126616041638252},
- {0.19356794339341304},
- {0.13296974918788915},
- {0.29593720687390396},
- {0.34360245935316014},
- {0.31626428893522945},
- {0.30178380022230356},
- {0.1431352257751347},
- {0.19052223357260656},
- {0.0378267850779744},
- {0.11515951405007475},
- {0.17357402654632703},
- {0.13700607277152285},
- {0.26341918730788966},
- {0.25036335709373364},
- {0.05525288737908137},
- {0.3154568801239325},
- {0.2818080423350793},
- {0.049597947314718095},
- {0.1731591855526916},
- {0.235838187102255},
- {0.11726354187277993},
- {0.186981365870151},
- {0.37408713714961506},
- {0.4083066524282871},
- {0.34563502833847254},
- {0.31334301264949793},
- {0.1440805179560499},
- {0.10050412377992539},
- {0.04667957064845237},
- {0.13451541858442972},
- {0.12301448093452662},
- {0.13862733060233506},
- {0.3571383238523073},
- {0.4278261232860015},
- {0.42285226084949606},
- {0.41030477122209263},
- {0.05385951869111329},
- {0.28586484931545414},
- {0.36877250648568227},
- {0.34058146802632494},
- {0.11645604402471646},
- {0.33449597287065186},
- {0.440453408352499},
- {0.11365463272401712},
- {0.14242787426394235},
- {0.3597088103841772},
- {0.1769720796255491},
- {0.1272408515251502},
- {0.21974846788385613},
- {0.12382241671439333},
- {0.3672602188192542},
- {0.12410557056312041},
- {0.4395632981346599},
- {0.36787367749288663},
- {0.1485770641296648},
- {0.1301916493389019},
- {0.29347314215836456},
- {0.17266079660130948},
- {0.12448409135555363},
- {0.2522590447575356},
- {0.09666805719718753},
- {0.1397385159134253},
- {0.06998990955831381},
- {0.3277750169957676},
- {0.03278192457730126},
- {0.2653711654119935},
- {0.3170187129084719},
- {0.09666806430709407},
- {0.2554194057845001},
- {0.18791780578245706},
- {0.06512964163494665},
- {0.28599281407270005},
- {0.12260718267645235},
- {0.22985962975209795},
- {0.12750150632470722},
- {0.09713697479308739},
- {0.29141261084868086},
- {0.17095746501785478},
- {0.03991153133934395},
- {0.320538579791473},
- {0.06986908424881534},
- {0.30897498421978586},
- {0.02027906430100962},
- {0.10136853756324066},
- {0.18403017158986648},
- {0.30275264275474467},
- {0.09836545711754686},
- {0.0827467239516952},
- {0.20919964798873814},
- {0.1455324330590586},
- {0.13192347725382342},
- {0.053422913213263756},
- {0.07569114335216558},
- {0.23260634128251592},
- {0.014640571461591024},
- {0.07472650801022818},
- {0.3027838415798146},
- {0.11157950447299707},
- {0.024458947240653717},
- {0.19869014212867958},
- {0.036557117451124665},
- {0.01841617244355331},
- {0.2502007603337377},
- {0.2665104279463421},
- {0.3325508347865286},
- {0.14241942494513674},
- {0.2218238170271393},
- {0.22706122068568396},
- {0.190671944347706},
- {0.2862004071883514},
- {0.0038288015777168485},
- {0.10865547783901526},
- {0.14727303481708676},
- {0.10651329334461183},
- {0.06468217620657138},
- {0.29498957864599434},
- {0.06006168829485801},
- {0.24988985813681097},
- {0.2995775519193383},
- {0.15562592278245263},
- {0.24293255524414314},
- {0.035830641637810745},
- {0.12922110279032265},
- {0.2863448716988899},
- {0.1187266272565455},
- {0.008914039183304391},
- {0.15026096891845706},
- {0.226477131637458},
- {0.33119270398967066},
- {0.3144205697678363},
- {0.33351025356103875},
- {0.2746585841794125},
- {0.2547347677787565},
- {0.19993333402092947},
- {0.21479070506740117},
- {0.15298388710048133},
- {0.09567787801710226},
- {0.29835725270735697},
- {0.30287622427094724},
- {0.1345608200611811},
- {0.04691567814093387},
- {0.1544563282707385},
- {0.16178598030618238},
- {0.1263036555622505},
- {0.24403066144323554},
- {0.25007276708088283},
- {0.21372704722072786},
- {0.18454644745390922},
- {0.08751070250389759},
- {0.2859199472669555},
- {0.12374217555270688},
- {0.2604786366705142},
- {0.1366075880485893},
- {0.2460408635652703},
- {0.22042259300351844},
- {0.10951943755235254},
- {0.27912380141706944},
- {0.20970779540993423},
- {0.08774548842731393},
- {0.19961913653344926},
- {0.3045272383350026},
- {0.06749963363657419},
- {0.032296490042582934},
- {0.0482573550234102},
- {0.2803175763532728},
- {0.30064246072012046},
- {0.1422335299874852},
- {0.2814414946096512},
- {0.01714057870088982},
- {0.20700967230452277},
- {0.0693684010620751},
- {0.29126540933158274},
- {0.10538755036801521},
- {0.01911615558346834},
- {0.3163968598488293},
- {0.014294477743563357},
- {0.1799828678280361},
- {0.32099883336089385},
- {0.009987316639148534},
- {0.1897038553620044},
- {0.22188000964946422},
- {0.18340611061436393},
- {0.2722103273816091},
- {0.12116165484598782},
- {0.034493937308069114},
- {0.09859478473251751},
- {0.3022223019925218},
- {0.04564430420358042},
- {0.155691040033072},
- {0.18939331249656882},
- {0.01157263914206804},
- {0.05691107876176568},
- {0.3168956337388099},
- {0.28149476761011305},
- {0.05951088996142701},
- {0.27113407378498294},
- {0.2106592621674161},
- {0.20389365126433937},
- {0.10008497982557708},
- {0.30353194921692017},
- {0.029490464340902293},
- {0.30034376785011013},
- {0.32487435694369776},
- {0.23696985605571202},
- {0.1341593239028986},
- {0.2680466349525248},
- {0.06491694945067907},
- {0.30157031623038566},
- {0.1865132180171556},
- {0.1510969182718691},
- {0.22373567555388418},
- {0.18533225280716029},
- {0.3217942431050722},
- {0.2848929981054943},
- {0.18894789380434995},
- {0.16530182697366155},
- {0.09373083019812369},
- {0.10205762496008641},
- {0.029437465730505003},
- {0.01764752975954949},
- {0.12452882929514893},
- {0.11513382295209787},
- {0.0277002983328382},
- {0.051290700254866664},
- {0.10092015997801153},
- {0.2250709490745226},
- {0.1318753515278965},
- {0.055875965890864784},
- {0.30933077784110735},
- {0.16860800244343294},
- {0.3203456650390713},
- {0.20619795299965332},
- {0.2743402454453893},
- {0.009791080356607366},
- {0.05046114503928477},
- {0.2576453831692717},
- {0.32422174126568815},
- {0.16337702289822092},
- {0.16689860317659563},
- {0.23872565930109274},
- {0.21732858978869035},
- {0.008050153233177837},
- {0.24303646679369428},
- {0.18157662016691134},
- {0.27661039303640417},
- {0.08753238201800631},
- {0.20388011586414687},
- {0.26419883636230945},
- {0.22017476672197558},
- {0.09150714164395422},
- {0.2738830289482847},
- {0.06649542080105302},
- {0.02167361465969197},
- {0.011652707347161145},
- {0.18146996515543096},
- {0.23889823793202417},
- {0.14790124524718495},
- {0.10159942364590879},
- {0.22611947331932866},
- {0.26253950275765014},
- {0.24165097454007295},
- {0.2305867338663126},
- {0.10936665317486542},
- {0.14557408163082455},
- {0.028902660836558892},
- {0.08799099288589302},
- {0.1326243086469828},
- {0.10468349466394246},
- {0.2012731299503186},
- {0.19129744124609482},
- {0.04221758367427429},
- {0.2410340502367979},
- {0.21532367215018913},
- {0.03789676142108923},
- {0.13230733725976523},
- {0.1801990605353979},
- {0.08959863684572138},
- {0.14286857816125298},
- {0.28583221191193015},
- {0.3119786328158518},
- {0.26409254650398745},
- {0.2394188880034472},
- {0.11008893129710404},
- {0.07679311356486733},
- {0.035666890423473846},
- {0.10278043752910221},
- {0.09399280993896071},
- {0.1059222640998326},
- {0.2728819756889876},
- {0.3268930550895574},
- {0.32309263010621075},
- {0.31350535388637024},
- {0.04115293959929917},
- {0.2184233941062438},
- {0.2817714130035749},
- {0.2602312260291437},
- {0.08898164451130225},
- {0.2555814255730813},
- {0.3365413013471023},
- {0.08684114432020983},
- {0.10882618057646519},
- {0.2748460310603979},
- {0.13522069042912283},
- {0.09722209192786352},
- {0.16790524025523812},
- {0.0946101368879751},
- {0.2806159054070403},
- {0.09482648886283775},
- {0.3358611866167511},
- {0.28108463643836357},
- {0.11352464883757224},
- {0.09947673525090356},
- {0.4024944593741475},
- {0.2368019556135487},
- {0.17072825363964056},
- {0.345969880225475},
- {0.13257893766420153},
- {0.19164949133903822},
- {0.09599021771511054},
- {0.4495390184321278},
- {0.04495996776040543},
- {0.36395297699286755},
- {0.43478689233759127},
- {0.1325789474153425},
- {0.3503042727822181},
- {0.2577267380889367},
- {0.08932442575935622},
- {0.3922352902159828},
- {0.16815409868108608},
- {0.31524938441926675},
- {0.17486659760455975},
- {0.13322205182744204},
- {0.39966846845240556},
- {0.23446585930239955},
- {0.05473812734984454},
- {0.4396143423308789},
- {0.09582450743147901},
- {0.42375502684525285},
- {0.027812463390751902},
- {0.139025583138534},
- {0.25239490018689514},
- {0.4152211693835651},
- {0.13490689877935558},
- {0.11348601673384892},
- {0.2869144978624723},
- {0.19959577062047204},
- {0.1809312711395655},
- {0.0732688054989421},
- {0.10380938302865636},
- {0.319016462266192},
- {0.020079346450660195},
- {0.10248639865744336},
- {0.4152639581516864},
- {0.15302978664350736},
- {0.0335451165107823},
- {0.2725008522105268},
- {0.050137593909113556},
- {0.025257532314180785},
- {0.3431469708774444},
- {0.36551546020504655},
- {0.45608898816913523},
- {0.19532632194579844},
- {0.30422837556449805},
- {0.3114114040984433},
- {0.26150400201403956},
- {0.39252000137639553},
- {0.0052511497636210614},
- {0.1490195235216949},
- {0.2019829824737638},
- {0.1460815463575382},
- {0.08871073295476785},
- {0.4045742315801316},
- {0.08237379605351534},
- {0.3427205727043443},
- {0.41086657509305563},
- {0.21343885574757282},
- {0.33317872554963796},
- {0.04914124212176535},
- {0.1772250009823928},
- {0.39271813250567134},
- {0.16283196922038065},
- {0.01222548460665605},
- {0.2060808938258277},
- {0.310610333840487},
- {0.45422633008458135},
- {0.4312235740350174},
- {0.45740481808842476},
- {0.37669054666715296},
- {0.3493653009841103},
- {0.27420587313642614},
- {0.2945825572959728},
- {0.20981533941609054},
- {0.1312209202632194},
- {0.4091929511696232},
- {0.41539065976754636},
- {0.18454835125676042},
- {0.06434422029432883},
- {0.21183477263721678},
- {0.22188729162314375},
- {0.17322376142711576},
- {0.33468476340267117},
- {0.3429714298561009},
- {0.2931237648940268},
- {0.2531029655766529},
- {0.12001974911472903},
- {0.39213535437391983},
- {0.16971072611473062},
- {0.35724293975984694},
- {0.18735546596748792},
- {0.337441728521832},
- {0.3023066157002001},
- {0.15020443262507405},
- {0.38281453193149795},
- {0.28761141520241185},
- {0.12034175484451784},
- {0.27377495551674214},
- {0.41765500330591515},
- {0.0925748378495412},
- {0.04429420083817184},
- {0.06618431205705544},
- {0.38445177816816484},
- {0.41232708316170297},
- {0.19507136951665943},
- {0.38599321690990024},
- {0.023508072687114346},
- {0.2839109757255637},
- {0.09513782718850129},
- {0.3994665835555195},
- {0.14453760503661486},
- {0.026217549757000424},
- {0.4339340292469173},
- {0.019604683580641363},
- {0.24684407762248542},
- {0.4402455738985674},
- {0.013697470172937746},
- {0.2601762810169482},
- {0.30430544298871665},
- {0.251539008969375},
- {0.37333279546377635},
- {0.1661715767427782},
- {0.04730797014809999},
- {0.13522141851267197},
- {0.414493814175504},
- {0.0626005480733754},
- {0.2135281631792213},
- {0.2597503756621456},
- {0.01587171862052459},
- {0.07805277753919851},
- {0.43461809091512055},
- {0.38606628011208105},
- {0.08161838356224602},
- {0.3718567281605212},
- {0.28891633903751524},
- {0.27963739486312716},
- {0.13726520099965459},
- {0.4162899776938358},
- {0.04044577440472855},
- {0.41191742991592545},
- {0.44556080226249944},
- {0.32500096397115874},
- {0.18399770468658286},
- {0.3676223474107815},
- {0.08903272129505571},
- {0.4135996244894542},
- {0.25580036489825647},
- {0.20722738709806104},
- {0.30685046376808156},
- {0.25418068702844915},
- {0.4413364676430833},
- {0.39072690743902444},
- {0.2591394899286122},
- {0.2267092279450229},
- {0.1285505704195785},
- {0.1399706572165745},
- {0.04037308752482345},
- {0.024203349231958333},
- {0.1707896111208686},
- {0.15790448653654643},
- {0.03799058585048287},
- {0.07034450416203311},
- {0.13841063932311357},
- {0.3086817734063447},
- {0.18086526735504033},
- {0.07663313418682777},
- {0.424242993001915},
- {0.23124360304495495},
- {0.4393497623478449},
- {0.28279771363836154},
- {0.37625394938364626},
- {0.013428334756081172},
- {0.06920678036366092},
- {0.35335717076624973},
- {0.44466574865531855},
- {0.22406938509586855},
- {0.22889918498781986},
- {0.3274090244594862},
- {0.2980632319885073},
- {0.011040676668526305},
- {0.3333212388394461},
- {0.24902988747647786},
- {0.379367426210265},
- {0.1200494822761574},
- {0.27961883124417786},
- {0.36234514350053876},
- {0.30196672529498386},
- {0.12550081153587136},
- {0.3756268831197093},
- {0.09119757347925833},
- {0.029725070413526702},
- {0.0159815310847419},
- {0.248883611565607},
- {0.3276457137259909},
- {0.20284456461234035},
- {0.13934224028929423},
- {0.3101198102772832},
- {0.360069389824353},
- {0.3314210548856876},
- {0.31624659791283277},
- {0.1499948909104039},
- {0.1996528910753571},
- {0.03963960982026631},
- {0.12067846090083018},
- {0.18189245195027798},
- {0.1435720021269383},
- {0.276043385197343},
- {0.2623618625804465},
- {0.057900847048860185},
- {0.3305749515179475},
- {0.2953135144672945},
- {0.05197489755972756},
- {0.18145772996448767},
- {0.24714058300703357},
- {0.12288332292574439},
- {0.19594232952852747},
- {0.3920150265168995},
- {0.4278744904150098},
- {0.36219936839230354},
- {0.3283597782822202},
- {0.15098548562101405},
- {0.10532072032428004},
- {0.048916659538154265},
- {0.14096198491373685},
- {0.12890987210347257},
- {0.14527095771354107},
- {0.37425395206563666},
- {0.44832941956383643},
- {0.44311718791696675},
- {0.4299683677878218},
- {0.05644070204808951},
- {0.2995647413555089},
- {0.38644569554090313},
- {0.35690361939952553},
- {0.12203712625420704},
- {0.3505264807387393},
- {0.4615618592780084},
- {0.11910145908934225},
- {0.14925364002557082},
- {0.37694762753822925},
- {0.1854533545734128},
- {0.1333387888306759},
- {0.23027977417487244},
- {0.12975652769441776},
- {0.3848609324448684},
- {0.1300532515121969},
- {0.46062909109114175},
- {0.38550379073730645},
- {0.1556975259250866},
- {0.13643100176271597}};
-
-FLA_Obj_attach_buffer(A_arr, 1, m, &A);
-FLA_Obj_attach_buffer(B_arr, 1, p, &B);
-FLA_Obj_attach_buffer(C_arr_ref, 1, r, &C_ref);
-
-// Execute kernel being tested
-kernel_kron_prod_rec(A, B, C, 2);
-
-// Check success
-bool success = FLA_Obj_equals(C, C_ref);
-if (success)
-  printf ("Passed test 0 \n");
-else
-  printf ("Failed test 0 \n");
-}
@@ -1,1584 +0,0 @@
-
-#include "FLAME.h"
-#include "FQAM.h"
-#include "__kernels.h"
-#include "assertf.h"
-  int main (void)    
-{ 
-FLA_Init();
-  
-// Turn on parameter checking
-FLA_Check_error_level_set(FLA_FULL_ERROR_CHECKING);
-FLA_Obj A, B, C_ref, C, ZERO;
-int m, n, p, q, r, c;
-
-// Square matrices dimension
-m = 2;
-n = 1;
-p = 512;
-q = 1;
-r = 1024;
-c = 1;
-
-// Create FLA objects
-FLA_Obj_create_without_buffer(FLA_DOUBLE, m, n, &A);
-FLA_Obj_create_without_buffer(FLA_DOUBLE, p, q, &B);
-FLA_Obj_create_without_buffer(FLA_DOUBLE, r, c, &C_ref);
-FLA_Obj_create(FLA_DOUBLE, r, c, 1, c, &C);
-FLA_Obj_create_constant (0.0, &ZERO);
-FLA_Set(ZERO, C); // Initialize C to all zeros
-
-// Create buffer for operands and reference
-double A_arr[2][1] = {{0.5390744387516667},
- {0.2122141378696445}};
-double B_arr[512][1] = {{0.6500069247532406},
- {0.7885908576323549},
- {0.6552795720904029},
- {0.5526167908404584},
- {0.33744813910408433},
- {0.25646521130416833},
- {0.0022010168954109677},
- {0.4281495276184528},
- {0.8867687470822707},
- {0.44566296416049844},
- {0.5529106995219449},
- {0.1386518442035224},
- {0.7475777558131987},
- {0.939899952398753},
- {0.6097238699832773},
- {0.4971264113495196},
- {0.10120969486280529},
- {0.14575566387039074},
- {0.8143543283686373},
- {0.21637225861059373},
- {0.8430768895781698},
- {0.4116530416337352},
- {0.5871333079659532},
- {0.6202752078335966},
- {0.8655179215510675},
- {0.34052123196913875},
- {0.6008001472879732},
- {0.9572351819636208},
- {0.8902907358546783},
- {0.16343769898305316},
- {0.4023536682668789},
- {0.7256338330153378},
- {0.7430071533631472},
- {0.7454195372915775},
- {0.06523449215524191},
- {0.6369350321978573},
- {0.7708354039423732},
- {0.5691981619280179},
- {0.5960362684443175},
- {0.399725362154307},
- {0.09970779144997455},
- {0.6954279275771114},
- {0.025142700322592804},
- {0.30732649028457404},
- {0.7160803274062799},
- {0.23920811446383228},
- {0.7792962284568384},
- {0.36154851244958064},
- {0.8335069420782799},
- {0.4604330676539974},
- {0.09821953818576323},
- {0.30913012687393915},
- {0.4120770728280623},
- {0.49521172774734323},
- {0.10039113951597789},
- {0.695976872660277},
- {0.9289442570608017},
- {0.6918940687239267},
- {0.41073126671814586},
- {0.7574255808428324},
- {0.32470334471109963},
- {0.560705688250362},
- {0.5870294273384646},
- {0.0041243328436447735},
- {0.27779661064948724},
- {0.012091601829532173},
- {0.9777257115354466},
- {0.6804571922586574},
- {0.497602599041142},
- {0.45108128496626876},
- {0.9568021589289041},
- {0.7978988005679499},
- {0.8738082783634524},
- {0.2646584755455823},
- {0.9447079001954573},
- {0.8077865251194121},
- {0.4227594429495777},
- {0.788072431161674},
- {0.14931519223290002},
- {0.2845796746487107},
- {0.6817099829448289},
- {0.21873262502220192},
- {0.829774775505251},
- {0.7230369068352717},
- {0.847418146002931},
- {0.609898148482804},
- {0.5954725547726152},
- {0.33784428616348827},
- {0.7547248463508668},
- {0.6553724142476876},
- {0.49537574036471055},
- {0.0015634703670746042},
- {0.05982990834021251},
- {0.037244925197773227},
- {0.746114727433203},
- {0.7187086924622227},
- {0.48175161967381575},
- {0.3581132889313078},
- {0.7246183911930273},
- {0.6233264398834496},
- {0.3983417720572452},
- {0.5541142361372887},
- {0.030650467164724637},
- {0.7242276022519607},
- {0.45086216289438985},
- {0.5157529961245302},
- {0.6296999854357004},
- {0.8362451148067955},
- {0.8264449189579332},
- {0.1507806330203435},
- {0.2092991142902202},
- {0.4041149826328545},
- {0.11499152034009807},
- {0.06601705367141475},
- {0.04290729678718208},
- {0.0678149931583294},
- {0.4048492993225651},
- {0.3459117575599817},
- {0.6154431736206081},
- {0.17720981655059653},
- {0.19496140757716673},
- {0.8329652685156428},
- {0.364097922478989},
- {0.6649371450693433},
- {0.020552721622536407},
- {0.3809513143256884},
- {0.9338774872310865},
- {0.9730911230951854},
- {0.49103100733576066},
- {0.7831601859934765},
- {0.5231848265236068},
- {0.6916164963398478},
- {0.8922577364435906},
- {0.16461921130689516},
- {0.1649543830376755},
- {0.6604614810716574},
- {0.21212239252039122},
- {0.36382673578147295},
- {0.6678353293889819},
- {0.7898971785036993},
- {0.4552914401270297},
- {0.7306467876202992},
- {0.4108550180939684},
- {0.9595305156737809},
- {0.17557316000461543},
- {0.6907492032112983},
- {0.023539069094490772},
- {0.5377626434949574},
- {0.8260446880581183},
- {0.7042251092567879},
- {0.9719149478207797},
- {0.7935078967757395},
- {0.9705291256740685},
- {0.04944018878787915},
- {0.4210661167466262},
- {0.42467115891024576},
- {0.31800356469955615},
- {0.6144181761949733},
- {0.10453559778389077},
- {0.49437357229817247},
- {0.3403771448489691},
- {0.0834058190221667},
- {0.05075777651654312},
- {0.40490453444635355},
- {0.13427270408924086},
- {0.15616902282133882},
- {0.15117324084064},
- {0.43123222287267626},
- {0.4610582210368206},
- {0.7243849629906419},
- {0.8627089853971686},
- {0.5942563498919976},
- {0.5800552997369002},
- {0.28770881243404833},
- {0.783105387364559},
- {0.320777439425052},
- {0.4527250969980545},
- {0.6263168335256696},
- {0.43633656349057626},
- {0.7981555768442941},
- {0.30810223601955056},
- {0.5993779544703661},
- {0.012591944377318809},
- {0.9981326937921402},
- {0.22911097740322783},
- {0.04398492886125571},
- {0.35846815350111016},
- {0.6005595977527118},
- {0.17851924182636947},
- {0.09424656758822658},
- {0.7977186600253361},
- {0.3766999193061076},
- {0.5068265140694229},
- {0.9290848331957169},
- {0.4065740741691105},
- {0.3673003776948607},
- {0.6158450807023781},
- {0.08838260423965238},
- {0.5452861719061557},
- {0.7998360647310533},
- {0.28812515185334364},
- {0.23793283476000082},
- {0.9797184336288872},
- {0.7644215547707941},
- {0.9164440473360138},
- {0.36688968297819413},
- {0.1197800426480341},
- {0.9313793845342767},
- {0.577934300345632},
- {0.3260477039878189},
- {0.7108430467111445},
- {0.23725871286754618},
- {0.47976193158663016},
- {0.42244958831283963},
- {0.3780783073034736},
- {0.7764844962399258},
- {0.7776187753209379},
- {0.8175412435988542},
- {0.5018228280220587},
- {0.2855422936457326},
- {0.7894911674297912},
- {0.949378424123026},
- {0.20736614489561123},
- {0.8552051079597205},
- {0.4401094319244159},
- {0.031265420764926444},
- {0.12941366591732806},
- {0.8541028985887423},
- {0.02720516187346178},
- {0.9259794101148562},
- {0.7964032900908021},
- {0.4820608190593022},
- {0.961573080540577},
- {0.2933889952427995},
- {0.6369191554785849},
- {0.3795204391501811},
- {0.48694105909022234},
- {0.3809300712946101},
- {0.5922711078705548},
- {0.10633682084355067},
- {0.6948627758333842},
- {0.7897385229242705},
- {0.17394074160190742},
- {0.9567569863549106},
- {0.17344399007994726},
- {0.8975755779641283},
- {0.8939549187551482},
- {0.8854944143793125},
- {0.8126924735595555},
- {0.1269411541648976},
- {0.510406298814117},
- {0.507060441284374},
- {0.5783384803116779},
- {0.24009829930244142},
- {0.9372731261595042},
- {0.9946365783519088},
- {0.4290184330285516},
- {0.687962137037406},
- {0.8668172413104946},
- {0.5699060741624292},
- {0.2436984571814389},
- {0.9118463925960351},
- {0.631356857098694},
- {0.15906763862956386},
- {0.8666353736368},
- {0.30593245548495807},
- {0.06022425439326784},
- {0.8555461677317531},
- {0.0009236577604675444},
- {0.5500598778584751},
- {0.6642336566006193},
- {0.3456737398783678},
- {0.05005303403161088},
- {0.726526555211355},
- {0.6333930968713674},
- {0.2754439319838663},
- {0.8516158268805252},
- {0.23800348881505717},
- {0.7739006034397856},
- {0.8681660653632177},
- {0.2684892074628531},
- {0.06980639946350664},
- {0.7115065916442732},
- {0.29633012550809223},
- {0.595590838009066},
- {0.44455211535888073},
- {0.4168070119921491},
- {0.12102108930282429},
- {0.017678010642635522},
- {0.6714893260776952},
- {0.5402347723192577},
- {0.6357941406999377},
- {0.4092330735872649},
- {0.9437979784825972},
- {0.2830315480229819},
- {0.13050297773716735},
- {0.8285804772574},
- {0.27890124198563726},
- {0.6050100965136846},
- {0.7447369801234022},
- {0.3796859957059553},
- {0.29113967687509157},
- {0.35135454540108035},
- {0.6181709826755697},
- {0.7433942930671898},
- {0.917522911426048},
- {0.8477654902459901},
- {0.5661632993858979},
- {0.6987626257495972},
- {0.05397957908777273},
- {0.6938464155627554},
- {0.21240251474374028},
- {0.9249915603114718},
- {0.37139286476294653},
- {0.3362164966094914},
- {0.9770265372805967},
- {0.6470399564872104},
- {0.014952644500138335},
- {0.9502919694415615},
- {0.3164313544884185},
- {0.27526453207339896},
- {0.6954734508114057},
- {0.32926588888791897},
- {0.2145412729430899},
- {0.2612294596477097},
- {0.8421328315656686},
- {0.9128400397783767},
- {0.31551799594298524},
- {0.7668416121008215},
- {0.44737669661300006},
- {0.964783980162788},
- {0.4190759234939373},
- {0.5130187581454386},
- {0.63746821164554},
- {0.3745967979659178},
- {0.5442376128920045},
- {0.7842951500220984},
- {0.2233032309712064},
- {0.8523045157733778},
- {0.7507522697003591},
- {0.906623612266307},
- {0.23247763293000168},
- {0.8034137367372907},
- {0.9983375140379883},
- {0.4083786163449745},
- {0.9621083537045164},
- {0.16052794131572712},
- {0.3349777763212438},
- {0.9893403865044335},
- {0.436408997042526},
- {0.21632080342385884},
- {0.6422480432894797},
- {0.6990031025125102},
- {0.49291588226937166},
- {0.8858308073911644},
- {0.33691422915121105},
- {0.47138680541152334},
- {0.9079812362125671},
- {0.398809957422538},
- {0.9052678741238446},
- {0.3348636393778447},
- {0.5755278748021917},
- {0.3885073872129581},
- {0.255656827616338},
- {0.8757951749142777},
- {0.7043260493344229},
- {0.07334878886923724},
- {0.2596648842546776},
- {0.6389713546553069},
- {0.4001195041819844},
- {0.07745761515162519},
- {0.3792286365052495},
- {0.6812597268369797},
- {0.485628499303983},
- {0.3160731973552974},
- {0.5120874829622669},
- {0.4218576906455138},
- {0.9602285273300096},
- {0.7377725199735848},
- {0.3005465737374998},
- {0.5513539506020986},
- {0.5886019958240626},
- {0.773901769952701},
- {0.9678834279128002},
- {0.4505209285586341},
- {0.16223504538077116},
- {0.8372593080047283},
- {0.9185235118156252},
- {0.952807874893141},
- {0.7448659565416972},
- {0.3006075663208576},
- {0.9612356377033603},
- {0.22371714974608525},
- {0.23675894189090174},
- {0.4215768621712339},
- {0.7132068670724525},
- {0.6369231968468556},
- {0.002248411074748158},
- {0.2629110183728418},
- {0.7948945148290856},
- {0.9440213844233605},
- {0.9002247827040794},
- {0.8609652037843418},
- {0.39479769610913995},
- {0.05699702323853306},
- {0.1033711316798428},
- {0.8815554754809607},
- {0.3671743322290649},
- {0.9779138117457779},
- {0.4408440895895376},
- {0.7274715501793434},
- {0.2776257142118038},
- {0.11908768166509853},
- {0.939160514271348},
- {0.14008883202748945},
- {0.3172244028517006},
- {0.7989468910473425},
- {0.5960031319452773},
- {0.23971577313927828},
- {0.5367231451151614},
- {0.4957280984374346},
- {0.13623633214158504},
- {0.6466872532401919},
- {0.40871628775007307},
- {0.35958877599614203},
- {0.7610023742385874},
- {0.5349555981842172},
- {0.581097867854978},
- {0.8395045889527152},
- {0.06332198433966396},
- {0.2120580599962545},
- {0.5693840468436075},
- {0.4594173574037811},
- {0.36478264392738513},
- {0.026874149712382334},
- {0.492017567943836},
- {0.09751340741635994},
- {0.16691100444812135},
- {0.2993169522493766},
- {0.8907305123763353},
- {0.328882462762506},
- {0.06753367225914231},
- {0.6962411286045979},
- {0.926617222689518},
- {0.9974940776561892},
- {0.37397281417125494},
- {0.660871498927801},
- {0.936140190556977},
- {0.6222583630317069},
- {0.45898486450897147},
- {0.44246185027026685},
- {0.5811681504680892},
- {0.6072841223092735},
- {0.9235158072260663},
- {0.8059598346096379},
- {0.15560412478795216},
- {0.023886255474101614},
- {0.4761855317865791},
- {0.3618480050626065},
- {0.5526793937935561},
- {0.016511997887349472},
- {0.3181257608853615},
- {0.6429837616625811},
- {0.6657297795101507},
- {0.6677545798021612},
- {0.7829383943641145},
- {0.6994522541448042},
- {0.5283977767788489},
- {0.8445391609367553},
- {0.2509929663232846},
- {0.5965624707998365},
- {0.9725119300256202},
- {0.27054961766538344},
- {0.3630574960480093},
- {0.6232628362886687},
- {0.2380586079326481},
- {0.36770419477407323},
- {0.9189409786941791},
- {0.6381308833605905},
- {0.3995861908794297},
- {0.09612515213323214},
- {0.9846897382309269},
- {0.9116060496064585},
- {0.3937358409556503},
- {0.6847747117987755},
- {0.17846868139840855},
- {0.5196144419313679},
- {0.958904764737539},
- {0.044684655820875996},
- {0.05468427809848775},
- {0.15863534888625386},
- {0.733206455312862},
- {0.8804756929351252},
- {0.7553031976475899},
- {0.09941024404572196},
- {0.4128643758358572},
- {0.6646904838933705},
- {0.12025067121547495},
- {0.5035896490159985},
- {0.022910533057936666},
- {0.907862994696718},
- {0.4518253010092088},
- {0.21875373067842185},
- {0.7787934349797128},
- {0.528766817041675},
- {0.3962891892458116},
- {0.13468992892028375},
- {0.7201398071437914},
- {0.8086473123902209},
- {0.46321234578306714},
- {0.8147811138405652},
- {0.05297260552369376}};
-double C_arr_ref[1024][1] = {{0.35040211814605005},
- {0.42510917398285725},
- {0.3532444675500663},
- {0.2979015863670673},
- {0.1819096661953286},
- {0.13825383984312214},
- {0.0011865119475766032},
- {0.23080446630270868},
- {0.47803436463589377},
- {0.24024551227722485},
- {0.2980600250245839},
- {0.07474366509589736},
- {0.40300005913823067},
- {0.506676039322076},
- {0.32868655300472943},
- {0.2679881411868725},
- {0.05455955945439421},
- {0.07857315269580747},
- {0.43899760251031367},
- {0.1166407538719363},
- {0.4544812010738528},
- {0.2219116323791223},
- {0.3165085584641557},
- {0.3343745095344695},
- {0.46657858778965083},
- {0.1835662920067896},
- {0.32387600220118284},
- {0.5160210184703884},
- {0.47993297875666907},
- {0.08810508585015323},
- {0.21689857790064204},
- {0.3911706512719639},
- {0.4005361641877121},
- {0.4018366186999842},
- {0.035166247245837036},
- {0.3433553950033347},
- {0.4155376627501491},
- {0.3068401796798265},
- {0.3213079168872582},
- {0.21548172525813974},
- {0.053749921715063265},
- {0.37488741975086604},
- {0.013553787065103065},
- {0.1656718552636763},
- {0.3860206005976501},
- {0.12895098004943484},
- {0.4200986769766608},
- {0.19490156143025766},
- {0.4493222869964667},
- {0.24820769752828684},
- {0.05294764242193821},
- {0.16664414964580027},
- {0.22214021675721737},
- {0.26695598419864225},
- {0.054118297190216054},
- {0.375183342013479},
- {0.5007701040066357},
- {0.3729824067729579},
- {0.2214147270838456},
- {0.40830876988900505},
- {0.175039273310925},
- {0.3022621041984309},
- {0.31645255907319514},
- {0.0022233224129128717},
- {0.1497530519729876},
- {0.0065182734698636825},
- {0.5270669391990449},
- {0.36681707901137073},
- {0.2682448417994743},
- {0.24316639052457198},
- {0.515787586820982},
- {0.4301268480967957},
- {0.4710477072353383},
- {0.1426706191656065},
- {0.5092678810821317},
- {0.4354570676599062},
- {0.22789880943501084},
- {0.42482970352414096},
- {0.0804920034500478},
- {0.15340962839138564},
- {0.36749242644739194},
- {0.11791316707052227},
- {0.44731037139578345},
- {0.3897707147489652},
- {0.45682146144450797},
- {0.32878050208904824},
- {0.32100403325606863},
- {0.18212321894903993},
- {0.4068528729585314},
- {0.353294516383897},
- {0.2670443992082977},
- {0.0008428269106356045},
- {0.03225277425906373},
- {0.020077787147337413},
- {0.4022113779354067},
- {0.38743748501501696},
- {0.25969998399336863},
- {0.1930497202401582},
- {0.39062325254151686},
- {0.3360193507392451},
- {0.2147358672031038},
- {0.29870882085001743},
- {0.016522883384300323},
- {0.390412588212441},
- {0.24304826741665575},
- {0.27802925692032165},
- {0.3394551662306829},
- {0.4507983659232964},
- {0.4455153308464145},
- {0.0812819851200627},
- {0.1128278025672214},
- {0.2178480574539456},
- {0.061988989288539235},
- {0.03558810615595656},
- {0.023130226933901373},
- {0.036557329375774536},
- {0.2182439088113173},
- {0.18647218656424974},
- {0.3317696834030739},
- {0.09552928239829865},
- {0.1050987113678961},
- {0.4490302846247015},
- {0.19627588321100883},
- {0.35845061828339186},
- {0.01107944687348806},
- {0.20536111596183024},
- {0.5034294822919148},
- {0.5245685510367661},
- {0.2647022646891907},
- {0.4221816377170842},
- {0.2820355667216014},
- {0.3728327745957976},
- {0.4809933384951612},
- {0.08874200894300653},
- {0.08892269145566238},
- {0.35603790222579823},
- {0.11434975969459064},
- {0.19612969339424846},
- {0.36001295536889993},
- {0.4258133781734068},
- {0.2454359775549166},
- {0.393873006962121},
- {0.2214814382873119},
- {0.5172583742019408},
- {0.09464700268934464},
- {0.3723652390392916},
- {0.012689310460849316},
- {0.2898940952236568},
- {0.4452995765987257},
- {0.3796297555274341},
- {0.5239345050108423},
- {0.4277598240993973},
- {0.5231874437148942},
- {0.026651942022602397},
- {0.2269859805625313},
- {0.2289293666435606},
- {0.17142759316144257},
- {0.3312171334911279},
- {0.05635246870492089},
- {0.26650415602029387},
- {0.18348861832335278},
- {0.044961945077997605},
- {0.02736221988793801},
- {0.21827368465467295},
- {0.07238298259657613},
- {0.08418672832780946},
- {0.08149362996043855},
- {0.2324662685167216},
- {0.24854470173726595},
- {0.39049741736432714},
- {0.4650643621089985},
- {0.3203484082926427},
- {0.3126929851505993},
- {0.15509646658679316},
- {0.42215209717695623},
- {0.17292291812225666},
- {0.24405252757302012},
- {0.3376313955135714},
- {0.2352178880705134},
- {0.4302652696238506},
- {0.16609003996037278},
- {0.3231093344062347},
- {0.006787995347995342},
- {0.5380678217056872},
- {0.12350787155549084},
- {0.02371115083941341},
- {0.19324101865895726},
- {0.3237463280954699},
- {0.09623516009392319},
- {0.05080591552689427},
- {0.43002973893488966},
- {0.2030692975777381},
- {0.2732172186164379},
- {0.500845885007667},
- {0.21917369084369176},
- {0.19800224495913224},
- {0.33198634123760934},
- {0.04764480277590129},
- {0.29394983707935574},
- {0.4311711776882343},
- {0.15532090452557998},
- {0.1282635093588405},
- {0.5281411647431544},
- {0.4120801206077423},
- {0.49403156046496755},
- {0.19778084993524694},
- {0.06457035926413969},
- {0.502082818982688},
- {0.31154960859415876},
- {0.17576398303350305},
- {0.38319731644633503},
- {0.1279001074780153},
- {0.2586273940044782},
- {0.22773177472061668},
- {0.2038123513138002},
- {0.41858294400990864},
- {0.41919440486889303},
- {0.44071558704939195},
- {0.27051985936876544},
- {0.1539285516869369},
- {0.4255945079816128},
- {0.511785641147062},
- {0.11178578817569843},
- {0.4610192135909449},
- {0.23725174500396937},
- {0.016854389151187428},
- {0.06976359932117933},
- {0.46042504069289797},
- {0.014665607368084652},
- {0.4991718308032655},
- {0.42932065662568},
- {0.2598666654785621},
- {0.5183594687111228},
- {0.15815850794642755},
- {0.3433468362698037},
- {0.20458976772966994},
- {0.26249747813420377},
- {0.20534966438677432},
- {0.3192782150641472},
- {0.057323462014873615},
- {0.3745827608918068},
- {0.4257278510059714},
- {0.09376700765509693},
- {0.5157632354410094},
- {0.09349922160719722},
- {0.4838600509282154},
- {0.4819082460972233},
- {0.4773474044492637},
- {0.43810173906182115},
- {0.06843073143593097},
- {0.27514698906853563},
- {0.2733433227985464},
- {0.3117674916825096},
- {0.1294308559416933},
- {0.5052599844414548},
- {0.5361831552369334},
- {0.23127287099898597},
- {0.3708628029058369},
- {0.467279017859723},
- {0.3072217970702773},
- {0.13137160902973125},
- {0.49155308231643957},
- {0.34034834339249476},
- {0.08574929801778508},
- {0.46718097764559896},
- {0.16492036673647303},
- {0.03246535613628846},
- {0.4612030701961341},
- {0.000497920288822663},
- {0.2965232199363678},
- {0.3580713856319462},
- {0.18634387731612076},
- {0.026982311228408707},
- {0.391651894988743},
- {0.34144602820511244},
- {0.148484783041755},
- {0.4590843239076557},
- {0.12830159715391554},
- {0.4171900334488786},
- {0.4680061344289194},
- {0.14473566882391734},
- {0.03763084561206449},
- {0.3835550165587479},
- {0.15974399609348577},
- {0.3210677967253721},
- {0.23964668208295484},
- {0.22469000605742698},
- {0.06523937579303535},
- {0.009529763665424735},
- {0.36198273158306843},
- {0.29122675668213827},
- {0.3427403695594171},
- {0.22060708946267435},
- {0.5087773655454637},
- {0.1525750728995044},
- {0.07035081947908474},
- {0.4466665557381211},
- {0.1503485304905502},
- {0.32614547821720624},
- {0.4014686695776342},
- {0.2046790150370556},
- {0.15694595790978158},
- {0.18940625436493438},
- {0.333240175538399},
- {0.4007448613063874},
- {0.49461314851879207},
- {0.45700870584738873},
- {0.3052041628582448},
- {0.3766850702966051},
- {0.02909901130079229},
- {0.3740348670493481},
- {0.1145007664249244},
- {0.49863930622493513},
- {0.20020840012845906},
- {0.18124571920881322},
- {0.5266900322300221},
- {0.34880270139324576},
- {0.008060588441765269},
- {0.5122781100769258},
- {0.1705800548242739},
- {0.1483880731357077},
- {0.3749119601628434},
- {0.17749882425232358},
- {0.11565371630086432},
- {0.14082212434499028},
- {0.4539722835306147},
- {0.4920887321135775},
- {0.17008768657901543},
- {0.41338471165467366},
- {0.2411693416372277},
- {0.5200903826228541},
- {0.22591311825183066},
- {0.27655529911632937},
- {0.3436428184148482},
- {0.20193555862164864},
- {0.29338458571730414},
- {0.42279346781381694},
- {0.1203770639072369},
- {0.45945557848604474},
- {0.404711358430261},
- {0.48873761494146817},
- {0.12532274949405664},
- {0.4330998092170343},
- {0.5381782350647627},
- {0.22014647340434937},
- {0.5186480207915523},
- {0.0865365098687361},
- {0.18057795676465585},
- {0.5333281135892345},
- {0.23525693514687748},
- {0.11661301569602633},
- {0.3462195034756324},
- {0.3768147051726052},
- {0.2657183525861442},
- {0.47752874532332773},
- {0.18162184898713954},
- {0.25411257756215805},
- {0.4894694753083341},
- {0.21498825396613078},
- {0.488006771163226},
- {0.18051642845595214},
- {0.310252366094931},
- {0.20943440171270183},
- {0.137818060860309},
- {0.47211879237833204},
- {0.37968416974313274},
- {0.03954045719279856},
- {0.13997870174310684},
- {0.3444531243892017},
- {0.2156941971504984},
- {0.041755420414904945},
- {0.20443246438262722},
- {0.3672497048887586},
- {0.2617899107041088},
- {0.17038698146875172},
- {0.27605327246963773},
- {0.2274126978178046},
- {0.5176346544437644},
- {0.39771430713116307},
- {0.16201697555627914},
- {0.2972208214743405},
- {0.3173002905469674},
- {0.4171906622861738},
- {0.521761215679132},
- {0.24286431670862543},
- {0.08745676603449039},
- {0.4513450915522577},
- {0.4951525466122181},
- {0.5136343703961883},
- {0.4015381974679388},
- {0.16204985509892075},
- {0.5181775619030394},
- {0.12060019693849348},
- {0.12763069371927632},
- {0.22726131036564667},
- {0.3844715915809169},
- {0.343349014868136},
- {0.001212060938202895},
- {0.14172860967096884},
- {0.42850731444826773},
- {0.5088977979775945},
- {0.4852881694865427},
- {0.46412433401475844},
- {0.2128253464504857},
- {0.030725638312827916},
- {0.05572473479343589},
- {0.4752240231733576},
- {0.1979342970704012},
- {0.5271683392143582},
- {0.23764778017246946},
- {0.3921613176207345},
- {0.14966092607175877},
- {0.06419712515585015},
- {0.5062774271285536},
- {0.07551830850059539},
- {0.17100756692561314},
- {0.4306918468837352},
- {0.3212900538476359},
- {0.1292246458649783},
- {0.289333728217985},
- {0.26723434643859106},
- {0.07344152428681061},
- {0.3486125680883134},
- {0.22032850342753535},
- {0.19384511760151907},
- {0.41023692778135235},
- {0.28838088884821905},
- {0.31325500697371245},
- {0.4525554651191336},
- {0.034135263168546176},
- {0.11431507967524816},
- {0.3069403854863704},
- {0.24766015409521716},
- {0.19664499904150423},
- {0.014487167173130772},
- {0.26523409429528344},
- {0.05256698537373685},
- {0.08997745604434797},
- {0.16135411804269212},
- {0.48017005103825744},
- {0.17729212902896385},
- {0.036405676469936143},
- {0.3753257956383506},
- {0.49951565925898006},
- {0.5377235600706217},
- {0.2015991849077506},
- {0.356258932371477},
- {0.5046492478173806},
- {0.3354435778098483},
- {0.2474270082306836},
- {0.2385198736034681},
- {0.3132928945339294},
- {0.3273713473966702},
- {0.49784376545868414},
- {0.4344723454985767},
- {0.08388220623750962},
- {0.012876469763580254},
- {0.2566994482895141},
- {0.19506301024253486},
- {0.2979353340188727},
- {0.008901195993791623},
- {0.17149346600172316},
- {0.3466161104446913},
- {0.3588779072497053},
- {0.35996942533070514},
- {0.42206207551896613},
- {0.37705683133669843},
- {0.28484573495468646},
- {0.4552694741857849},
- {0.13530389245134064},
- {0.3215915791267294},
- {0.5242563228578614},
- {0.1458463832974446},
- {0.19571501591666607},
- {0.335985063667086},
- {0.12833131046129534},
- {0.19821993242446706},
- {0.49537759233547196},
- {0.34400004779771565},
- {0.21540670158124495},
- {0.05181861243614069},
- {0.5308210679813625},
- {0.4914235195542257},
- {0.2122529274795827},
- {0.36914454343425923},
- {0.0962079042595971},
- {0.28011086365141263},
- {0.5169210478671878},
- {0.024088355757450126},
- {0.029478896524482344},
- {0.08551626166703213},
- {0.39525285838688007},
- {0.4746419400034875},
- {0.4071646473592137},
- {0.053589521515113786},
- {0.22256463168427193},
- {0.35831764954839246},
- {0.06482406309499336},
- {0.2714723074044482},
- {0.012350482749708715},
- {0.48940573432954065},
- {0.2435674705553421},
- {0.11792454459030352},
- {0.4198276338651713},
- {0.28504467512724624},
- {0.21362937227603893},
- {0.07260789783820384},
- {0.3882089623587729},
- {0.43592109607480206},
- {0.2497059353258499},
- {0.4392276716490605},
- {0.028556177591898654},
- {0.13794065914580783},
- {0.16735012898433377},
- {0.1390595894547544},
- {0.11727309584049754},
- {0.07161126591568913},
- {0.05442554371047029},
- {0.00046708690289616},
- {0.09085938288284551},
- {0.1881848651518089},
- {0.09457598171975044},
- {0.1173354674179516},
- {0.02942388158168677},
- {0.1586465689404216},
- {0.19946005808202127},
- {0.12939202540704442},
- {0.10549725279676855},
- {0.021478128139360012},
- {0.030931412547872662},
- {0.17281750171516375},
- {0.04591725231995491},
- {0.1789128352796528},
- {0.08735859533171998},
- {0.12459798876454724},
- {0.13163116847232126},
- {0.18367513953268638},
- {0.07226341966864},
- {0.12749828528867266},
- {0.20313883887890205},
- {0.18893228096273196},
- {0.0346837903850871},
- {0.08538513682994464},
- {0.15398975828239547},
- {0.157676622481939},
- {0.15818856445752144},
- {0.013843681512088748},
- {0.13516661873684255},
- {0.16358217068702988},
- {0.12079189721054061},
- {0.12648732284695083},
- {0.08482737311420768},
- {0.02115940300144266},
- {0.14757963810125024},
- {0.005335636472673864},
- {0.06521902618024455},
- {0.15196236932593646},
- {0.050763343782365404},
- {0.16537767726703348},
- {0.07672570586754018},
- {0.17688195712150587},
- {0.09771040649886875},
- {0.02084357461804637},
- {0.06560178336408681},
- {0.08744858074605394},
- {0.10509092986683954},
- {0.021304419122134446},
- {0.14769613200881201},
- {0.19713510464111544},
- {0.14682970329136866},
- {0.08716298166269833},
- {0.1607364166389764},
- {0.068906640361256},
- {0.11898967423065623},
- {0.12457594382674339},
- {0.0008752417387015349},
- {0.058952368232090234},
- {0.002566008857717186},
- {0.20748721894647953},
- {0.14440263641236992},
- {0.10559830655721034},
- {0.09572582599824815},
- {0.20304694526891195},
- {0.1693254060697509},
- {0.18543447045625838},
- {0.05616427021780014},
- {0.2004803725786211},
- {0.17142372101093195},
- {0.08971553071179578},
- {0.1672401115578094},
- {0.03168679479054511},
- {0.06039183031080007},
- {0.1446684963077669},
- {0.04641815544305081},
- {0.17608993860982464},
- {0.15343865383198163},
- {0.1798341112691045},
- {0.12942900976857066},
- {0.1263676948361052},
- {0.07169533392237012},
- {0.1601632825971491},
- {0.13907929187312054},
- {0.1051257356630339},
- {0.00033179051603347376},
- {0.01269675241723805},
- {0.007903899690864843},
- {0.15833609363408196},
- {0.15252014555029006},
- {0.10223450463638367},
- {0.07599670287022038},
- {0.15377426717151707},
- {0.13227868305122104},
- {0.08453375573459473},
- {0.11759087490317133},
- {0.006504462464663885},
- {0.15369133623329964},
- {0.09567932519667616},
- {0.10945007742625328},
- {0.13363123952576486},
- {0.177463036086426},
- {0.175383295973406},
- {0.031997782043851446},
- {0.04441623109597927},
- {0.08575891263963757},
- {0.0244028263512936},
- {0.01400975212957333},
- {0.009105534996008812},
- {0.014391300307730712},
- {0.08591474502286779},
- {0.073407365409565},
- {0.13060574249765527},
- {0.0376064284413227},
- {0.041373567026840814},
- {0.17676700633340406},
- {0.0772667267190073},
- {0.14110906297839343},
- {0.0043615781000013645},
- {0.08084325473993391},
- {0.19818200582861498},
- {0.20650369375624889},
- {0.10420372188902152},
- {0.16619766368443603},
- {0.11102721690718673},
- {0.14677079850718494},
- {0.18934970629689707},
- {0.03493452400427359},
- {0.035005652184159415},
- {0.1401592638017303},
- {0.04501537065156115},
- {0.07720917706779222},
- {0.14172409866517285},
- {0.16762734874182725},
- {0.09661928044598647},
- {0.15505357812206705},
- {0.0871892434542287},
- {0.20362594114332683},
- {0.03725910678342861},
- {0.14658674664362953},
- {0.004995323254141352},
- {0.11412083576778337},
- {0.175298361318053},
- {0.14944652442708545},
- {0.20625409273440728},
- {0.1683935942070184},
- {0.2059600016823023},
- {0.010491907039732237},
- {0.08935618295150435},
- {0.0901212238662406},
- {0.06748485232219002},
- {0.13038822355265559},
- {0.0221839317603963},
- {0.10491306143079303},
- {0.07223284234465507},
- {0.017699893977100704},
- {0.010771517783638284},
- {0.0859264666970427},
- {0.028494566137724137},
- {0.03314127453997525},
- {0.03208109897395654},
- {0.09151357439853539},
- {0.09784307288504086},
- {0.1537247304067934},
- {0.18307904356845583},
- {0.12610959896589208},
- {0.12309593535038449},
- {0.061055877588190824},
- {0.16618603464064388},
- {0.06807350775561952},
- {0.09607466615139332},
- {0.13291328685989562},
- {0.09259678764215604},
- {0.16937989762586064},
- {0.06538365039259865},
- {0.12719647586599978},
- {0.0026721886201352286},
- {0.2118178690926049},
- {0.0486205885460976},
- {0.009334223757549024},
- {0.07607201014896148},
- {0.12744723727643223},
- {0.037884306997325576},
- {0.020000454087908685},
- {0.16928717769980473},
- {0.07994104861111027},
- {0.10755575173271983},
- {0.19716493688439152},
- {0.08628076662994669},
- {0.07794633299170967},
- {0.1306910328625168},
- {0.018756038161391816},
- {0.11571743486330359},
- {0.16973652091394964},
- {0.06114423069911772},
- {0.05049271139947416},
- {0.2079101027475528},
- {0.1622210612146573},
- {0.19448238341117985},
- {0.07785917776648466},
- {0.025419018484541808},
- {0.19765187311850163},
- {0.12264582929314448},
- {0.06919193240615204},
- {0.15085094431843696},
- {0.05034965320324784},
- {0.10181226469433208},
- {0.08964977517719551},
- {0.08023356203162116},
- {0.16478098793870105},
- {0.16502169799598163},
- {0.17349381018320784},
- {0.10649389881200806},
- {0.060596111671350004},
- {0.1675411874518123},
- {0.20147152378730965},
- {0.044006027662373916},
- {0.18148661468738833},
- {0.09339744366413891},
- {0.006634964312760546},
- {0.027463409541195968},
- {0.18125271027597437},
- {0.005773319972580814},
- {0.19650592220256616},
- {0.16900803760316796},
- {0.10230012111740451},
- {0.20405940228557679},
- {0.06226129268589192},
- {0.13516324947254996},
- {0.08053960279816455},
- {0.10333577704816314},
- {0.08083874666840789},
- {0.125688302541849},
- {0.02256617675911295},
- {0.14745970491118968},
- {0.16759367978482054},
- {0.03691268451945539},
- {0.20303735901006656},
- {0.03680726682348718},
- {0.19047822745050538},
- {0.18970987237795187},
- {0.18791443373589153},
- {0.17246483262958992},
- {0.026938707591281374},
- {0.10831543266607399},
- {0.10760539439496491},
- {0.12273160199618309},
- {0.050952253590435474},
- {0.19890260841632573},
- {0.2110759439685634},
- {0.09104377689533989},
- {0.14599529179835136},
- {0.18395087355525022},
- {0.1209421261950536},
- {0.05171625799092153},
- {0.19350669607431295},
- {0.1339828511172877},
- {0.033756401794733056},
- {0.18391227866367074},
- {0.06492319228708376},
- {0.012780438224909485},
- {0.18155899239287224},
- {0.00019601323532422656},
- {0.11673048275641824},
- {0.14095977277950192},
- {0.07335685469246357},
- {0.010621961464778278},
- {0.15417920655358036},
- {0.13441496998514144},
- {0.058453096557381186},
- {0.18072491849759506},
- {0.05050770518885493},
- {0.16423264935577173},
- {0.18423711308873666},
- {0.05697720568903349},
- {0.014813904879932076},
- {0.15099175793435865},
- {0.06288544210950334},
- {0.12639279621115304},
- {0.09434024389901162},
- {0.08845234070793649},
- {0.025682386130444112},
- {0.0037515237877772975},
- {0.14249952842224667},
- {0.11464545645493494},
- {0.1349245054312087},
- {0.08684504389906621},
- {0.20028727432679763},
- {0.06006329595360799},
- {0.02769457690991438},
- {0.1758364916367977},
- {0.05918678661875511},
- {0.128391696034082},
- {0.15804371617653035},
- {0.08057473623991684},
- {0.06178395552769443},
- {0.07456240193887113},
- {0.13118462214452697},
- {0.15775877900046753},
- {0.19471133362392498},
- {0.1799078226281893},
- {0.12014785647261175},
- {0.14828730819897984},
- {0.011455229838677982},
- {0.14724401889259323},
- {0.045074816547687295},
- {0.19629628650819625},
- {0.07881481660660616},
- {0.07134989396553547},
- {0.2073388442847659},
- {0.13731102653314564},
- {0.003173162561468138},
- {0.20166539101948752},
- {0.0671512070876836},
- {0.058415025360047466},
- {0.14758929877516905},
- {0.06987487674023188},
- {0.045528691275073904},
- {0.055436584565291804},
- {0.1787124928224309},
- {0.1937175620544602},
- {0.0669573794913986},
- {0.16273463159454418},
- {0.0949396599746973},
- {0.20474080058069025},
- {0.08893383580619099},
- {0.10886983347078992},
- {0.13527976695366234},
- {0.07949473652906665},
- {0.11549491581611004},
- {0.1664385190972831},
- {0.04738810264406067},
- {0.1808710680172522},
- {0.15932024566814054},
- {0.1923983482493572},
- {0.04933504044621598},
- {0.17049575349433366},
- {0.2118613348444958},
- {0.08666371599204707},
- {0.20417299481858694},
- {0.03406629867030592},
- {0.07108702000750337},
- {0.2099520171816592},
- {0.0926121590659359},
- {0.04590633280186304},
- {0.13629411480514306},
- {0.1483383407678991},
- {0.10460371899804989},
- {0.18798582108888706},
- {0.0714979626753401},
- {0.10003494451353229},
- {0.19268645524466396},
- {0.08463311128825353},
- {0.19211064144827752},
- {0.07106279853446085},
- {0.12213515177109581},
- {0.08244676023338604},
- {0.05425399326308949},
- {0.18585611799482796},
- {0.14946794533863725},
- {0.015565649993667757},
- {0.05510455954712743},
- {0.1355987551515748},
- {0.08491101562480943},
- {0.016437601020840853},
- {0.08047767815144231},
- {0.14457294559601916},
- {0.10305723330472401},
- {0.06707520108045643},
- {0.10867220371067374},
- {0.08952416612401691},
- {0.20377406908517637},
- {0.15656575927010938},
- {0.06378023203537907},
- {0.1170051032880469},
- {0.12490966509215552},
- {0.16423289690630438},
- {0.2053985472128311},
- {0.09560691044630223},
- {0.034428570287723004},
- {0.17767826222155855},
- {0.19492367517295112},
- {0.202199301725856},
- {0.15807108679594434},
- {0.06379317552387277},
- {0.20398779214479654},
- {0.047475942060019635},
- {0.05024359473630697},
- {0.08946457035145834},
- {0.15135258041849065},
- {0.13516410710803334},
- {0.0004771446178042411},
- {0.05579343510042289},
- {0.16868785416176374},
- {0.2003346842259117},
- {0.19104042615043426},
- {0.18270898845685687},
- {0.08378165271272303},
- {0.012095574147701387},
- {0.021936815590047336},
- {0.1870785352134566},
- {0.07791958436185344},
- {0.20752713647044807},
- {0.09355334840717204},
- {0.15437974784600317},
- {0.058916101591902255},
- {0.025272089695453553},
- {0.19930313885730605},
- {0.029728830713879117},
- {0.06731950316238644},
- {0.16954782568724458},
- {0.126480290813375},
- {0.050871076130507224},
- {0.11390023951529807},
- {0.10520051102765844},
- {0.028911275771949005},
- {0.1372361779176558},
- {0.08673537463816329},
- {0.076309822085622},
- {0.16149546276579438},
- {0.11352514106720361},
- {0.12331718304473276},
- {0.17815474258221073},
- {0.013437820314836917},
- {0.045001718380414495},
- {0.12083134461764546},
- {0.09749485842379374},
- {0.07741203429085955},
- {0.005703074512192971},
- {0.10441308399792039},
- {0.02069372368559422},
- {0.03542087490991447},
- {0.063519288971371},
- {0.18902560775813068},
- {0.06979350829559067},
- {0.014331600035645011},
- {0.147752210856213},
- {0.19664127504822043},
- {0.21168234571988442},
- {0.07936231834603763},
- {0.14024627538758297},
- {0.19866218346417358},
- {0.13205202204294994},
- {0.09740307731698697},
- {0.0938966600953124},
- {0.12333209800888138},
- {0.12887427645778624},
- {0.19598311083946846},
- {0.17103607145924557},
- {0.03302139519083584},
- {0.00506900111237055},
- {0.10105330209408707},
- {0.07678926243421179},
- {0.11728638107221726},
- {0.0035040793961692595},
- {0.06751078408041165},
- {0.13645024464540562},
- {0.14127727121289516},
- {0.14170696246122236},
- {0.16615059636502427},
- {0.14843365709431908},
- {0.11213347865136028},
- {0.17922314993534647},
- {0.05326425595964056},
- {0.12659899042617226},
- {0.20638078079833103},
- {0.05741445386382128},
- {0.07704593352094015},
- {0.13226518546918922},
- {0.050519402244874625},
- {0.07803202868503178},
- {0.19501226754667256},
- {0.1354203952603624},
- {0.08479783900209338},
- {0.020399116287542277},
- {0.20896508386776205},
- {0.19345569189398695},
- {0.08355631203678279},
- {0.1453188750993114},
- {0.03787357735969553},
- {0.11026953081908168},
- {0.20349314794787113},
- {0.00948271571102899},
- {0.01160477693169446},
- {0.03366466379954663},
- {0.15559677579467704},
- {0.18684939009140542},
- {0.160286016918969},
- {0.021096259235573848},
- {0.08761565757509532},
- {0.14105671798958844},
- {0.02551889252023809},
- {0.10686884320600698},
- {0.004861939021024019},
- {0.19266136272331766},
- {0.09588371672136187},
- {0.046422634361689696},
- {0.16527097738275878},
- {0.11221179421257511},
- {0.0840981686428603},
- {0.028583107145541714},
- {0.15282384831863174},
- {0.1716063922394958},
- {0.09830020861092925},
- {0.1729080716261442},
- {0.011241535811919438}};
-
-FLA_Obj_attach_buffer(A_arr, 1, m, &A);
-FLA_Obj_attach_buffer(B_arr, 1, p, &B);
-FLA_Obj_attach_buffer(C_arr_ref, 1, r, &C_ref);
-
-// Execute kernel being tested
-kernel_kron_prod_rec(A, B, C, 2);
-
-// Check success
-bool success = FLA_Obj_equals(C, C_ref);
-if (success)
-  printf ("Passed test 1 \n");
-else
-  printf ("Failed test 1 \n");
-}
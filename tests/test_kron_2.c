@@ -1,8766 +0,0 @@
-
-#include "FLAME.h"
-#include "FQAM.h"
-#include "__kernels.h"
-#include "assertf.h"
-  int main (void)    
-{ 
-FLA_Init();
-  
-// Turn on parameter checking
-FLA_Check_error_level_set(FLA_FULL_ERROR_CHECKING);
-FLA_Obj A, B, C_ref, C, ZERO;
-int m, n, p, q, r, c;
-
-// Square matrices dimension
-m = 512;
-n = 1;
-p = 16;
-q = 1;
-r = 8192;
-c = 1;
-
-// Create FLA objects
-FLA_Obj_create_without_buffer(FLA_DOUBLE, m, n, &A);
-FLA_Obj_create_without_buffer(FLA_DOUBLE, p, q, &B);
-FLA_Obj_create_without_buffer(FLA_DOUBLE, r, c, &C_ref);
-FLA_Obj_create(FLA_DOUBLE, r, c, 1, c, &C);
-FLA_Obj_create_constant (0.0, &ZERO);
-FLA_Set(ZERO, C); // Initialize C to all zeros
-
-// Create buffer for operands and reference
-double A_arr[512][1] = {{0.7234470631302997},
- {0.3357632786647412},
- {0.5836501294236428},
- {0.24210447466933105},
- {0.5145490796045236},
- {0.8835659575356989},
- {0.7493709759565801},
- {0.2457925723573542},
- {0.45689089946118033},
- {0.32537136470316774},
- {0.2531906136304217},
- {0.23497054721389266},
- {0.3694677065241706},
- {0.14324728200597214},
- {0.9565350853365392},
- {0.7147482919808731},
- {0.2113738606250425},
- {0.810957831333334},
- {0.545758002984457},
- {0.7269497888147589},
- {0.1256193329432238},
- {0.2622304249062176},
- {0.8211212922675502},
- {0.2383966299005792},
- {0.9913946184335813},
- {0.6907642386304819},
- {0.041257342056532864},
- {0.926755982568504},
- {0.940903650438002},
- {0.2153980047909302},
- {0.2626354308176261},
- {0.8174998325593889},
- {0.48824888855856274},
- {0.0152467042930029},
- {0.7664138501773798},
- {0.01737680628044025},
- {0.05957986798613468},
- {0.9164473107480612},
- {0.8441106537751618},
- {0.6077793490696085},
- {0.9496862932566268},
- {0.6619707428749443},
- {0.9817271537677789},
- {0.6785987063481893},
- {0.49996619867991},
- {0.13095925844246104},
- {0.7213584910478613},
- {0.9270469344377887},
- {0.9993556253180667},
- {0.46364353932671054},
- {0.7518407842551008},
- {0.96979933996507},
- {0.4354281579704834},
- {0.7061984371810544},
- {0.7676285417476534},
- {0.07743903134850272},
- {0.28141532979658124},
- {0.07137974386817236},
- {0.3771558602596923},
- {0.18700358036143883},
- {0.7581827264560964},
- {0.12610681964721016},
- {0.5323764280147488},
- {0.4559669044909552},
- {0.21284250670189775},
- {0.4944406904854277},
- {0.6666284020389884},
- {0.2320872809088983},
- {0.8858284608196212},
- {0.08274235642460692},
- {0.3477306104185801},
- {0.8377683820627562},
- {0.8691514832097609},
- {0.5725945297710724},
- {0.8530080785643344},
- {0.11142699250488164},
- {0.7628394172031608},
- {0.3930779870802844},
- {0.8410579919097457},
- {0.9899851391529141},
- {0.5197210287003898},
- {0.07252561229649035},
- {0.9118559415379256},
- {0.06183853299544584},
- {0.5814488895351397},
- {0.4522846562611784},
- {0.6701051129348917},
- {0.6244057073506208},
- {0.7210544902772281},
- {0.7386223048498459},
- {0.7188112154342224},
- {0.399682457652058},
- {0.8778658166861217},
- {0.3436748778282518},
- {0.42747651152175614},
- {0.5272976500028059},
- {0.9246093798252089},
- {0.15854556680195098},
- {0.8815732561157286},
- {0.5140920630744312},
- {0.8503585156684963},
- {0.5801565054581883},
- {0.80442335982828},
- {0.09737984768619168},
- {0.6861311702244711},
- {0.05723807377574108},
- {0.047702902281371085},
- {0.2524321320216978},
- {0.3490913501787839},
- {0.8193172344686771},
- {0.08556142345847928},
- {0.9683580537692631},
- {0.5646987773927509},
- {0.4440754197716492},
- {0.5330341034797176},
- {0.6045750339527471},
- {0.4389757869815578},
- {0.10303415412402328},
- {0.36557936521113377},
- {0.9836883552901784},
- {0.09760547280352705},
- {0.4681519670388721},
- {0.8954902165104025},
- {0.051139209034824606},
- {0.7224169733688346},
- {0.7497361857100876},
- {0.028857109316091534},
- {0.7456185622960982},
- {0.5608967688993166},
- {0.14599844694543807},
- {0.9916827594763764},
- {0.7633248824450091},
- {0.7103085049679627},
- {0.8142120206342703},
- {0.7649779214249681},
- {0.7908105465045115},
- {0.39456171533882545},
- {0.370129980656674},
- {0.6256467006909532},
- {0.33692083355530245},
- {0.09180908721248637},
- {0.3792413286894736},
- {0.46445322357397867},
- {0.593491736015237},
- {0.28055167232224476},
- {0.1314894670893486},
- {0.730894814266603},
- {0.7326965087288679},
- {0.3767523219678398},
- {0.7917411121054594},
- {0.4958573115618625},
- {0.601309777764586},
- {0.1103859274284047},
- {0.6779588787626317},
- {0.01776746631177495},
- {0.7279584863257527},
- {0.27079774112007093},
- {0.08167881842287783},
- {0.864634323117014},
- {0.3260138746128548},
- {0.29805106402465575},
- {0.956742673839204},
- {0.7937816857598381},
- {0.9091138650437163},
- {0.7311299044972196},
- {0.10299314011645844},
- {0.8266135796219949},
- {0.016550282585236498},
- {0.35166635305035165},
- {0.4271299361347364},
- {0.664022559675466},
- {0.7722676557432755},
- {0.6703712875380736},
- {0.16084285179063196},
- {0.3852097802983321},
- {0.6979883363899366},
- {0.0261631176228595},
- {0.25965422806947913},
- {0.8863353677601714},
- {0.2968258144128697},
- {0.36954031561193723},
- {0.9306318425962667},
- {0.16491419292616893},
- {0.9337024145323483},
- {0.3906572331932683},
- {0.6663266606180842},
- {0.013923560070613461},
- {0.8703931530155108},
- {0.0031740951797308847},
- {0.06948731194426616},
- {0.904341125383125},
- {0.4742164672532372},
- {0.9920711612501205},
- {0.7666858453017531},
- {0.19661229380263046},
- {0.7668901717114015},
- {0.3272999379614461},
- {0.3710313700087198},
- {0.4185692411318235},
- {0.042176508734346974},
- {0.4011865273666325},
- {0.6441388403343977},
- {0.7958882429452449},
- {0.5890727047813166},
- {0.9854911903149618},
- {0.9702169642996205},
- {0.8921479344106475},
- {0.5893746600618035},
- {0.08117532905539604},
- {0.00844036414312177},
- {0.31990386699228535},
- {0.6570010628225678},
- {0.16096441971668707},
- {0.6671725155923762},
- {0.6541875580132955},
- {0.7715603126338534},
- {0.6826161993791038},
- {0.37774788313957564},
- {0.38884408740596543},
- {0.5151137813136121},
- {0.5909547303819471},
- {0.17290529451351155},
- {0.2890886782110288},
- {0.37534847262785886},
- {0.4137014179395039},
- {0.6216797990029593},
- {0.6943232805038271},
- {0.9603319164535071},
- {0.6205010783595906},
- {0.5815227916118931},
- {0.5327859177752388},
- {0.15589679840237558},
- {0.891005331706935},
- {0.885672672126593},
- {0.9855079091423156},
- {0.12369252879287918},
- {0.2542781589824993},
- {0.6797122057236165},
- {0.4168665908427466},
- {0.43923636970209634},
- {0.7038447604900833},
- {0.049732934335031787},
- {0.8837704258476533},
- {0.681488920573193},
- {0.33987685508903265},
- {0.7922716324679874},
- {0.8313637383566442},
- {0.6073357304006001},
- {0.9930860368502523},
- {0.5233248432330084},
- {0.40063169525535347},
- {0.40250638694393637},
- {0.9884568176893167},
- {0.38657114347898835},
- {0.678200668077147},
- {0.0492597396196649},
- {0.5702065248870006},
- {0.5637698054804181},
- {0.16771800665347636},
- {0.5215827702268641},
- {0.1946104181470265},
- {0.11106283705558961},
- {0.06876418109477345},
- {0.903835804676144},
- {0.39670356873417023},
- {0.40438111031066415},
- {0.46498622346779384},
- {0.8029891689455487},
- {0.15171133444879836},
- {0.6227065905122231},
- {0.7280351480441397},
- {0.18338164630897047},
- {0.169857141795277},
- {0.901990823152711},
- {0.490827614114691},
- {0.8209963015670191},
- {0.899430954536369},
- {0.324412431120073},
- {0.8719670979584607},
- {0.8121251745489768},
- {0.4865353736282467},
- {0.7267546121611782},
- {0.07970315597090405},
- {0.5786479011387012},
- {0.27488892892442995},
- {0.39793378157597414},
- {0.6969910617495827},
- {0.7840019307578862},
- {0.824167208650891},
- {0.3864377638021411},
- {0.9708038552961499},
- {0.8609082967049272},
- {0.6470571759962072},
- {0.5206371086193211},
- {0.9071973662831645},
- {0.020641062659128462},
- {0.7673740301147626},
- {0.7043806215677886},
- {0.2366583580610564},
- {0.429907179485964},
- {0.23959449016677847},
- {0.031428203542257505},
- {0.8977952984403113},
- {0.5352275590880939},
- {0.4977308625966277},
- {0.5161116400287595},
- {0.1047631819240632},
- {0.2536475302765653},
- {0.34831191295859254},
- {0.08926532685818178},
- {0.7466930839822157},
- {0.3347486691552547},
- {0.8658712393960788},
- {0.8359859666247096},
- {0.5029588106896031},
- {0.586469000918835},
- {0.8836018667313082},
- {0.03611595760776787},
- {0.7489194165003593},
- {0.27660432205351193},
- {0.4613038341026181},
- {0.2879934876332324},
- {0.9034342379178172},
- {0.6183927125427433},
- {0.8024652998716015},
- {0.3342347370257235},
- {0.8002542547297413},
- {0.6289491641326612},
- {0.5713681532037934},
- {0.9967097143753298},
- {0.49165221340658194},
- {0.9299292722501796},
- {0.19028068190067127},
- {0.4159176066675454},
- {0.0003452885665123917},
- {0.7607441976821636},
- {0.8088824776987213},
- {0.5612350554860059},
- {0.8341492471763853},
- {0.09735441443422399},
- {0.14565400873968526},
- {0.4929064963766093},
- {0.29142906929645584},
- {0.6006025447397024},
- {0.13166846549281797},
- {0.24436830510335772},
- {0.5875253550249676},
- {0.7643053182898858},
- {0.5486465213201296},
- {0.5191721464760432},
- {0.9490617903615614},
- {0.42459048662934795},
- {0.8182891712185167},
- {0.2934759462598103},
- {0.6260579967301941},
- {0.9745811840820767},
- {0.8829675387527115},
- {0.516392450654755},
- {0.35365261487182875},
- {0.13085521565991498},
- {0.46314908736996296},
- {0.46469635576670876},
- {0.8905838417968772},
- {0.432548899116994},
- {0.36851627691148237},
- {0.13286042288077982},
- {0.9392823777883861},
- {0.374985481671792},
- {0.6210795413344338},
- {0.4514212784391455},
- {0.47127526152367194},
- {0.5612973763305874},
- {0.9448668671424694},
- {0.9572877738782825},
- {0.6915398264387039},
- {0.6877516681868646},
- {0.7034505525918218},
- {0.31698027847920773},
- {0.0029162969531572047},
- {0.46966462339071224},
- {0.4352416294552244},
- {0.070434556214923},
- {0.288242337061394},
- {0.7753068015268461},
- {0.5905465835497528},
- {0.11685472804613362},
- {0.6833672932846571},
- {0.9040159318841724},
- {0.5684715501506865},
- {0.8860180441724838},
- {0.8146501870917155},
- {0.6295108411464072},
- {0.6184832262138933},
- {0.39173691143955813},
- {0.11459896650834167},
- {0.8591203336336176},
- {0.930210274289417},
- {0.7822686061087866},
- {0.9925067715030631},
- {0.11392685208187758},
- {0.3229810904964129},
- {0.7258586373542163},
- {0.8415147109527377},
- {0.9987709234623717},
- {0.3412635630173818},
- {0.6691997355935668},
- {0.36427741599623475},
- {0.4527976257291708},
- {0.42702875901194803},
- {0.3184780684162064},
- {0.32682498104056057},
- {0.3068745536908135},
- {0.22865532999421723},
- {0.03669468178440838},
- {0.9415632216753879},
- {0.5037744842439269},
- {0.03205231554112031},
- {0.977191865175009},
- {0.33614232546931233},
- {0.5148698665676559},
- {0.5881911443152044},
- {0.8804951985309755},
- {0.3945765747949521},
- {0.5301251777781055},
- {0.9875911220902995},
- {0.03528179289173439},
- {0.980518820228219},
- {0.4887173553573626},
- {0.5761164859712611},
- {0.9719551941862138},
- {0.22774979702018372},
- {0.9460596131156757},
- {0.926612672768141},
- {0.24003501740969602},
- {0.8143885324465616},
- {0.6614610830368844},
- {0.36207463471051304},
- {0.36882821233509533},
- {0.11304606110284121},
- {0.5285829818405353},
- {0.9951592931813724},
- {0.04702392198469707},
- {0.6752761080050783},
- {0.7811064634969785},
- {0.45793058572040946},
- {0.8062392392068549},
- {0.33698793753926626},
- {0.8321567614080458},
- {0.05087702004767314},
- {0.10291745916428674},
- {0.2585043764932884},
- {0.7183506681075396},
- {0.09103781390565135},
- {0.630902561500969},
- {0.8942577040851655},
- {0.7540786455665965},
- {0.7482364627810737},
- {0.23068987918315043},
- {0.708240282807827},
- {0.5292996877295942},
- {0.7000850758059979},
- {0.734893167668541},
- {0.6723510622711093},
- {0.5991398863036317},
- {0.9370815681723875},
- {0.4483605772785474},
- {0.051364141699011046},
- {0.8475593829777642},
- {0.2584803644330419},
- {0.3002117904508177},
- {0.27637887706430464},
- {0.9267300995336799},
- {0.8622770631497577},
- {0.7553139388359565},
- {0.38930147728069964},
- {0.006862172580883175},
- {0.24872013890449296},
- {0.0354045746829198},
- {0.28997749073008716},
- {0.8145830040735593},
- {0.7480534879876966},
- {0.13189575245528928},
- {0.09838584028536845},
- {0.12342005138445722},
- {0.2132775344313984},
- {0.9963464170837352},
- {0.5239905083934829},
- {0.2694670690359332},
- {0.4849079549524722},
- {0.473958249401494},
- {0.34846150910712437},
- {0.2816149767893349},
- {0.15344162856297827},
- {0.6707877581865607},
- {0.9703369528339701},
- {0.9309752023438668},
- {0.9974241490295203},
- {0.43711456669929727},
- {0.8040410958226284},
- {0.29514092720684115},
- {0.5424418645658119},
- {0.09176681184950664},
- {0.6850066636900563},
- {0.5674920884238852},
- {0.27258343977794264},
- {0.5491882624968786},
- {0.0056286444115785095},
- {0.3136917325685076},
- {0.5874389773823245},
- {0.2578370088137858},
- {0.17167334645875043},
- {0.36804278313277605}};
-double B_arr[16][1] = {{0.6828786981640391},
- {0.06803425439561561},
- {0.968869791548673},
- {0.45960376642769574},
- {0.12200839289314247},
- {0.6501365935618971},
- {0.8737606892268249},
- {0.773912768809572},
- {0.9188477169759134},
- {0.3541309433133406},
- {0.4315450932480537},
- {0.7898970519924328},
- {0.9157992102328986},
- {0.846811107742941},
- {0.5850511688228307},
- {0.6748760840994396}};
-double C_arr_ref[8192][1] = {{0.4940265886610165},
- {0.0492191815347678},
- {0.7009260052515531},
- {0.3324989950257407},
- {0.08826661351579165},
- {0.4703394092458918},
- {0.632119604499853},
- {0.5598849197143235},
- {0.6647376823102054},
- {0.25619499090359893},
- {0.3122000303185958},
- {0.5714487024392071},
- {0.6625322490600384},
- {0.6126230089227465},
- {0.42325354986582603},
- {0.4882371210186167},
- {0.22928559062586795},
- {0.02284340431738298},
- {0.3253108978096068},
- {0.15431806750242702},
- {0.04096593802241742},
- {0.21829199423426884},
- {0.29337675378316275},
- {0.25985148865600977},
- {0.30851532204544485},
- {0.11890416660352485},
- {0.144896995400648},
- {0.2652184239845928},
- {0.30749174542637864},
- {0.2843280739454913},
- {0.19643869863059266},
- {0.22659860668964946},
- {0.3985622405640901},
- {0.03970820138324209},
- {0.5654809792320409},
- {0.26824779775911833},
- {0.07121021430285326},
- {0.3794523069754475},
- {0.5099705393525277},
- {0.4516942876783165},
- {0.5362855889336106},
- {0.20668857089774795},
- {0.25187134952636453},
- {0.4610235166267373},
- {0.5345063275785011},
- {0.49424141263154586},
- {0.34146519040289863},
- {0.39389151382955917},
- {0.16532798848188138},
- {0.016471397419970144},
- {0.23456771190587578},
- {0.1112721284270232},
- {0.029538777866643603},
- {0.1574009784476115},
- {0.21154137265197306},
- {0.1873677443325289},
- {0.2224571438195677},
- {0.08573668599503098},
- {0.10447899809694752},
- {0.1912376108154812},
- {0.22171908669602416},
- {0.20501675838425903},
- {0.14164350588252955},
- {0.1633905198077901},
- {0.3513746056218416},
- {0.03500696298084403},
- {0.4985310594979963},
- {0.23648869499814326},
- {0.06277930626719355},
- {0.33452718583449437},
- {0.44959275843627694},
- {0.39821610288515374},
- {0.472792247066674},
- {0.1822177509413611},
- {0.22205113053863432},
- {0.4064408010850328},
- {0.4712236407278875},
- {0.4357258760880173},
- {0.3010375404393383},
- {0.34725686792047167},
- {0.6033683708240407},
- {0.06011275113028944},
- {0.8560603650971162},
- {0.4060902419707007},
- {0.10780246249402119},
- {0.5744385618195151},
- {0.7720252000337517},
- {0.6838029766223335},
- {0.8118625628793138},
- {0.3128980460216721},
- {0.38129855353554903},
- {0.6979261450983196},
- {0.8091690060998679},
- {0.7482134672647576},
- {0.5169312961883242},
- {0.5962975334652642},
- {0.5117294765031448},
- {0.05098289561492072},
- {0.7260429012676775},
- {0.34441372300124246},
- {0.09142954845722805},
- {0.4871934936225653},
- {0.6547709004383999},
- {0.5799477668680881},
- {0.6885578104257157},
- {0.2653754506071424},
- {0.32338736769656734},
- {0.5919259247567948},
- {0.6862733479524925},
- {0.6345756662602003},
- {0.43842036536530254},
- {0.5057325497913521},
- {0.16784651182978041},
- {0.01672231439631299},
- {0.2381409983440819},
- {0.11296719201539192},
- {0.02998875673839222},
- {0.15979874571522637},
- {0.21476388742979602},
- {0.19022201022590707},
- {0.2258459439601919},
- {0.08704275550832237},
- {0.1060705785576334},
- {0.1941508283067108},
- {0.22509664364597753},
- {0.20813988047291807},
- {0.14380123174564025},
- {0.16587952873325934},
- {0.3120010626270477},
- {0.031084231684983577},
- {0.4426677905214395},
- {0.20998877823889614},
- {0.055744524370760946},
- {0.297041493005123},
- {0.3992133072146649},
- {0.3535937010458979},
- {0.41981315987697715},
- {0.16179920521746846},
- {0.1971690258121622},
- {0.36089677456655733},
- {0.4184203248891476},
- {0.3869002886903908},
- {0.267304554754278},
- {0.30834474108903215},
- {0.22218917394835597},
- {0.02213639819926394},
- {0.3152424862958654},
- {0.14954190470529533},
- {0.03969803730088204},
- {0.21153583069070317},
- {0.28429670787771244},
- {0.2518090537487776},
- {0.29896673562684295},
- {0.11522406830948177},
- {0.140412415921075},
- {0.2570098817817869},
- {0.29797483882756143},
- {0.2755280857721219},
- {0.1903588972210678},
- {0.21958535248896446},
- {0.1728984766232966},
- {0.017225634618314133},
- {0.2453087370501873},
- {0.1163673596486813},
- {0.030891379864676327},
- {0.16460848306752882},
- {0.22122800507148002},
- {0.19594744883131424},
- {0.23264361729404356},
- {0.0896626308430248},
- {0.10926316696867228},
- {0.1999945192988252},
- {0.23187176400112317},
- {0.2144046239984924},
- {0.14812946443944797},
- {0.1708722898576332},
- {0.16045638138831492},
- {0.01598604598462698},
- {0.2276558650992018},
- {0.10799334849908178},
- {0.028668378842789298},
- {0.15276295115301508},
- {0.20530802728161504},
- {0.18184670678300394},
- {0.21590215086406633},
- {0.08321034153570764},
- {0.1014003867079655},
- {0.18560254254930256},
- {0.2151858415664749},
- {0.19897566937316147},
- {0.13746979328642803},
- {0.15857600278241435},
- {0.25230162644487886},
- {0.025136459936630072},
- {0.3579660998040395},
- {0.16980874949191135},
- {0.045078161098929266},
- {0.240204476150751},
- {0.3228263578996136},
- {0.28593577574184326},
- {0.3394845586360609},
- {0.130839947435221},
- {0.15944197586411774},
- {0.2918414521898477},
- {0.3383582338413958},
- {0.3128693578369767},
- {0.2161575135442566},
- {0.2493449189802332},
- {0.09782051745177524},
- {0.0097457220254748},
- {0.1387879642570402},
- {0.06583699034047508},
- {0.017477370663859428},
- {0.09313029996036316},
- {0.12516384385540757},
- {0.1108609006416875},
- {0.13162243803419235},
- {0.050728295103847035},
- {0.06181766167079749},
- {0.11315060576244605},
- {0.1311857477290786},
- {0.12130338955664273},
- {0.08380698976828764},
- {0.09667416473807859},
- {0.6531974338228439},
- {0.065077151334118},
- {0.9267579487390049},
- {0.43962712794091074},
- {0.11670530850781603},
- {0.6218784620031361},
- {0.8357827554332943},
- {0.7402747163563014},
- {0.8789100793688395},
- {0.3387386720825354},
- {0.4127880225965918},
- {0.7555642440346624},
- {0.8759940757112609},
- {0.8100045352088233},
- {0.5596219696961884},
- {0.6455426526956468},
- {0.4880863831428691},
- {0.04862736712545847},
- {0.6924980286612786},
- {0.32850100704217167},
- {0.08720529042770488},
- {0.4646840198026291},
- {0.6245189602249036},
- {0.55315282964883},
- {0.6567448362990588},
- {0.2531144868707856},
- {0.308446118311773},
- {0.5645775687523182},
- {0.6545659213113968},
- {0.6052567928896981},
- {0.4181643236375317},
- {0.4823665284088145},
- {0.14434270676953606},
- {0.014380663006347539},
- {0.20479374828262317},
- {0.09714822246763234},
- {0.02578938503448052},
- {0.13742188171479233},
- {0.18469017014427194},
- {0.1635849297302952},
- {0.1942203892637052},
- {0.07485402465492888},
- {0.09121735239363506},
- {0.1669635893759804},
- {0.1935760146242927},
- {0.17899373306379424},
- {0.12366452421727522},
- {0.1426511633396094},
- {0.5537858281268395},
- {0.05517291140104878},
- {0.7857125449986913},
- {0.3727192736948363},
- {0.09894366170508817},
- {0.5272333619853973},
- {0.7085830736397052},
- {0.6276106206349864},
- {0.7451467518843717},
- {0.28718526179741455},
- {0.349964872942983},
- {0.640573200260377},
- {0.7426745414672514},
- {0.6867280994841937},
- {0.47445182708759503},
- {0.5472960455800142},
- {0.37268651459063173},
- {0.03713023881348769},
- {0.5287684425875709},
- {0.25083243372971403},
- {0.06658705685270445},
- {0.35481724896945854},
- {0.4768618888387547},
- {0.4223690871896838},
- {0.501468495063602},
- {0.1932697964176907},
- {0.23551918828879906},
- {0.4310926376586999},
- {0.4998047481114496},
- {0.4621539390668433},
- {0.3192963575404705},
- {0.3683190239200806},
- {0.4964185254164457},
- {0.04945748686506235},
- {0.7043196903553074},
- {0.3341088609430812},
- {0.08869397544729805},
- {0.47261665939056785},
- {0.6351801485080786},
- {0.5625957238471637},
- {0.6679561538085637},
- {0.2574354144544043},
- {0.31371161440071804},
- {0.5742154951312997},
- {0.6657400424755286},
- {0.615589155939723},
- {0.42530282362158467},
- {0.49060102681221907},
- {0.08578276654450366},
- {0.008546417654466825},
- {0.1217087769231846},
- {0.05773511855684038},
- {0.015326612928711325},
- {0.08166972520522534},
- {0.10976123493268522},
- {0.09721840577410182},
- {0.11542503728291834},
- {0.04448569287357645},
- {0.05421040674874182},
- {0.09922634076510838},
- {0.1150420858993879},
- {0.10637584648358067},
- {0.07349373756517741},
- {0.08477748350390661},
- {0.17907157117896072},
- {0.017840651438339985},
- {0.254067137116607},
- {0.12052209095883265},
- {0.031994312710493494},
- {0.1704855951768172},
- {0.22912663680229986},
- {0.20294347420528144},
- {0.24094982724670175},
- {0.09286390773749698},
- {0.11316425316863042},
- {0.20713503957614432},
- {0.24015041602815151},
- {0.22205963659873623},
- {0.15341821659229016},
- {0.1769730422924403},
- {0.5607262390984381},
- {0.055864374887787144},
- {0.7955596152754384},
- {0.3773904386201428},
- {0.10018368923990413},
- {0.533840999855968},
- {0.7174635062705158},
- {0.6354762528272736},
- {0.7544854247603502},
- {0.29078445780537676},
- {0.3543508646395623},
- {0.6486012880903547},
- {0.7519822309640395},
- {0.6953346310963994},
- {0.4803979717864434},
- {0.5541551222961957},
- {0.16279598027320177},
- {0.016219136965713428},
- {0.2309752931176803},
- {0.10956798900597563},
- {0.02908638968531094},
- {0.15499037288019887},
- {0.20830160365128236},
- {0.18449819592122807},
- {0.21905019911889897},
- {0.08442362342941345},
- {0.10287889588046718},
- {0.18830879516339855},
- {0.21832344538513504},
- {0.2018769142482934},
- {0.13947422696675765},
- {0.16088818404980626},
- {0.6770022664027583},
- {0.06744879367695454},
- {0.9605322973042202},
- {0.45564870064822227},
- {0.12095846411799145},
- {0.6445419201040054},
- {0.8662416450982912},
- {0.7672529541348422},
- {0.910940681769903},
- {0.35108351142165356},
- {0.42783148305753843},
- {0.7830996864618487},
- {0.9079184085906196},
- {0.8395239750461313},
- {0.580016580279231},
- {0.6690685178857134},
- {0.4717081840142571},
- {0.04699562993837993},
- {0.6692606038911928},
- {0.31747784578812904},
- {0.08427903462336025},
- {0.4490911090575989},
- {0.6035626372390128},
- {0.5345912645131522},
- {0.6347071436342233},
- {0.24462099143333405},
- {0.2980959177722121},
- {0.545632635716015},
- {0.6326013441949248},
- {0.5849468301038876},
- {0.40413242519177617},
- {0.4661802644028704},
- {0.028173760033273623},
- {0.002806912505161088},
- {0.0399729923981653},
- {0.018962029801978277},
- {0.005033741999360232},
- {0.02682290782405227},
- {0.036049043630983026},
- {0.031929583824694956},
- {0.03790921455713956},
- {0.014610501461081143},
- {0.01780440352495332},
- {0.032589052863498724},
- {0.037783441271681345},
- {0.03493717552942202},
- {0.024137656192697882},
- {0.027843593447464017},
- {0.632861918892115},
- {0.0630511522807243},
- {0.8979058756476321},
- {0.42594054014788435},
- {0.11307200803728833},
- {0.6025179775701961},
- {0.8097629460741395},
- {0.7172282884804264},
- {0.8515476187768393},
- {0.32819297032826616},
- {0.39993699691571666},
- {0.7320418185472117},
- {0.8487223969148499},
- {0.7847872602062326},
- {0.5421996708152542},
- {0.6254454484315605},
- {0.6425230599088949},
- {0.0640136783156624},
- {0.9116131236672524},
- {0.43244286158687373},
- {0.11479814225723173},
- {0.6117158941657166},
- {0.8221246221027442},
- {0.7281773492935077},
- {0.8645471710992609},
- {0.3332030972965753},
- {0.4060423535657017},
- {0.7432170196898962},
- {0.8616788199763734},
- {0.7967676625067813},
- {0.5504767804384212},
- {0.6349933711224667},
- {0.14709070909876187},
- {0.014654442654254175},
- {0.2086926200017886},
- {0.09899773428292237},
- {0.026280364396930794},
- {0.14003812509480454},
- {0.1882063091242061},
- {0.16669926628380624},
- {0.19791796494331307},
- {0.07627909862442357},
- {0.09295395206294668},
- {0.17014224898940766},
- {0.19726132267327598},
- {0.1824014230426269},
- {0.12601885446503938},
- {0.14536696199613527},
- {0.17934814108849206},
- {0.01786820571354848},
- {0.2544595351095693},
- {0.12070823320114146},
- {0.03204372683085666},
- {0.17074890434043272},
- {0.22948051504659306},
- {0.2032569134515638},
- {0.24132196600376116},
- {0.09300733286295153},
- {0.1133390314824352},
- {0.20745495255160537},
- {0.24052132012195904},
- {0.2224026001032185},
- {0.15365516577413982},
- {0.17724637109596875},
- {0.5582532214074755},
- {0.05561799157671863},
- {0.7920508923628902},
- {0.3757260020983057},
- {0.0997418407609841},
- {0.5314865563775824},
- {0.7142992171399056},
- {0.6326735589173982},
- {0.7511578547753859},
- {0.28950198686275436},
- {0.35278804147210974},
- {0.6457407077429687},
- {0.7486657010234151},
- {0.6922679387892848},
- {0.47827923255133886},
- {0.5517110857496279},
- {0.33341476539891035},
- {0.033217649092569836},
- {0.47304959888160597},
- {0.22440102813565171},
- {0.059570462224893254},
- {0.3174284692178463},
- {0.42661268538116104},
- {0.37786204921255345},
- {0.44862637656806253},
- {0.17290403947693395},
- {0.21070141214126353},
- {0.38566635771099056},
- {0.4471379465390223},
- {0.4134545821745363},
- {0.2856505829276351},
- {0.32950749797630646},
- {0.010411649578897886},
- {0.001037298158564884},
- {0.014772071210165978},
- {0.007007442718673451},
- {0.0018602258877062597},
- {0.009912440392098458},
- {0.013321970851491803},
- {0.011799619134618662},
- {0.014009399431032571},
- {0.005399329773700677},
- {0.006579640425849437},
- {0.01204332677364336},
- {0.0139629197501866},
- {0.01291107855178684},
- {0.008920102167317418},
- {0.01028963608868391},
- {0.523367692264018},
- {0.05214239485529109},
- {0.7425552272613739},
- {0.3522466921838755},
- {0.09350892215118779},
- {0.4982736898129799},
- {0.6696622939639719},
- {0.5931374648447806},
- {0.7042176164942052},
- {0.2714108597317248},
- {0.3307421364413972},
- {0.6053880408612824},
- {0.7018811987039995},
- {0.6490077614582395},
- {0.44839131884828193},
- {0.5172343780072847},
- {0.011866250851035737},
- {0.001182218059066803},
- {0.016835862678711816},
- {0.007986445614974776},
- {0.0021201162078919797},
- {0.011297297642150404},
- {0.015183170232158491},
- {0.013448132261563075},
- {0.015966638779115236},
- {0.006153664799865487},
- {0.007498875486645952},
- {0.013725888053963343},
- {0.015913665467997253},
- {0.014714872575374101},
- {0.010166320824779473},
- {0.011727190976698063},
- {0.04068582268715697},
- {0.004053471895425881},
- {0.05772513427622377},
- {0.02738313172969239},
- {0.007269243941773881},
- {0.03873505241737313},
- {0.05205854651560828},
- {0.04610962059845827},
- {0.054744825676786166},
- {0.021099074852414176},
- {0.02571139968578322},
- {0.04706196208034611},
- {0.0545631960474825},
- {0.0504528940085169},
- {0.034857271403598046},
- {0.040209027997644135},
- {0.6258223464995707},
- {0.06234980947961139},
- {0.887918114929816},
- {0.4212026357523418},
- {0.11181426355561327},
- {0.5958159327887059},
- {0.8007556338792962},
- {0.7092502757291184},
- {0.8420755192095715},
- {0.3245423506521851},
- {0.3954883401737001},
- {0.7238990290662864},
- {0.8392817234031382},
- {0.7760577624026049},
- {0.5361685703176932},
- {0.6184883723611138},
- {0.5764251843563785},
- {0.05742843895698877},
- {0.8178333131671551},
- {0.387956435756809},
- {0.1029885842910873},
- {0.5487872250346897},
- {0.7375507066262912},
- {0.6532680132447936},
- {0.7756091470963531},
- {0.29892570208223873},
- {0.36427181079507776},
- {0.6667605169724053},
- {0.7730358700764689},
- {0.714802277780963},
- {0.4938479246069622},
- {0.569670092566399},
- {0.4150395706636414},
- {0.041349814851003405},
- {0.5888590512406597},
- {0.2793376779893653},
- {0.07415418161362318},
- {0.39513959564138246},
- {0.5310537029408922},
- {0.4703681988637401},
- {0.5584566673177165},
- {0.2152334742123886},
- {0.26228419586848556},
- {0.48008311609196347},
- {0.5566038478738127},
- {0.5146743038489188},
- {0.3555820185595537},
- {0.41017574709660376},
- {0.6485205396033172},
- {0.06461119887145056},
- {0.92012236098418},
- {0.43647939730550284},
- {0.11586969839288663},
- {0.6174258116502882},
- {0.8297985501451788},
- {0.7349743487147352},
- {0.8726170824021693},
- {0.33631330288271905},
- {0.4098324599798295},
- {0.7501544033610305},
- {0.8697219573334277},
- {0.8042049020009316},
- {0.5556150758848111},
- {0.6409205667159443},
- {0.4520457191171238},
- {0.045036685923208614},
- {0.6413634556605675},
- {0.3042442466902641},
- {0.0807659864804516},
- {0.43037140381035477},
- {0.5784040125424046},
- {0.5123076104892774},
- {0.6082503057954919},
- {0.23442432362013688},
- {0.2856702259614512},
- {0.5228887383021592},
- {0.6062322835221592},
- {0.5605641780673492},
- {0.3872867568455037},
- {0.4467482227398394},
- {0.6704005607172283},
- {0.06679107492652071},
- {0.9511657828286599},
- {0.4512054974760128},
- {0.11977895229076566},
- {0.6382567475578005},
- {0.8577945945088236},
- {0.7597711797879623},
- {0.9020577539327851},
- {0.3476599630401045},
- {0.42365953611686247},
- {0.7754633846220903},
- {0.8990649520847233},
- {0.8313374585834173},
- {0.5743606187769499},
- {0.6625441771888869},
- {0.4634006011668526},
- {0.04616795702022836},
- {0.6574737871647693},
- {0.3118865213305897},
- {0.08279473758090809},
- {0.4411818513407219},
- {0.5929328733672257},
- {0.5251762037405209},
- {0.623528872070842},
- {0.2403128000102969},
- {0.29284594200903796},
- {0.5360231176303133},
- {0.6214601593387384},
- {0.5746449222356369},
- {0.397014966310669},
- {0.4579700376152115},
- {0.34141626688056026},
- {0.03401482755019789},
- {0.4844021466963868},
- {0.22978634799982428},
- {0.061000072401829385},
- {0.3250463213058474},
- {0.43685081034867385},
- {0.3869302251315657},
- {0.4593928002221612},
- {0.1770535015633016},
- {0.2157579598301967},
- {0.39492182643312385},
- {0.457868649894206},
- {0.4233769305381619},
- {0.29250580890958894},
- {0.33741523034718},
- {0.08942928791771575},
- {0.008909715504335565},
- {0.12688246942851603},
- {0.060189368428733105},
- {0.01597812865704237},
- {0.08514140617917373},
- {0.11442705191731864},
- {0.10135104230245334},
- {0.12033161563671393},
- {0.04637672572784429},
- {0.05651482539624781},
- {0.10344433217481508},
- {0.11993238545429187},
- {0.11089775471085453},
- {0.076617867219933},
- {0.08838127151421457},
- {0.4926003472763392},
- {0.049077087090387606},
- {0.6989024508534067},
- {0.3315390794301963},
- {0.08801179019257185},
- {0.4689815521068068},
- {0.6302946923176017},
- {0.5582685471111453},
- {0.6628186026205172},
- {0.2554553629018671},
- {0.31129871728452463},
- {0.5697989455084154},
- {0.6606195363964268},
- {0.6108543828840158},
- {0.4220316283278247},
- {0.4868275936702613},
- {0.6330606037258405},
- {0.06307094697421611},
- {0.8981877701245767},
- {0.4260742627228568},
- {0.11310750660726902},
- {0.6027071360273834},
- {0.8100171683799775},
- {0.7174534598471749},
- {0.8518149592376815},
- {0.32829600538819476},
- {0.40006255576727784},
- {0.7322716405710314},
- {0.8489888504069566},
- {0.7850336414809614},
- {0.5423698925464504},
- {0.6256418048897647},
- {0.6824386684201106},
- {0.06799041484457886},
- {0.968245476384909},
- {0.4593076093968885},
- {0.12192977377377875},
- {0.6497176620012074},
- {0.8731976599606185},
- {0.7734140790153262},
- {0.9182556347705418},
- {0.35390275029938034},
- {0.4312670165158521},
- {0.7893880623307951},
- {0.9152090924080899},
- {0.8462654441047315},
- {0.5846741766620057},
- {0.6744412110374035},
- {0.31661229654759154},
- {0.03154364250343704},
- {0.44921021930035904},
- {0.21309231695442363},
- {0.05656840310854045},
- {0.30143163128484907},
- {0.4051134984776711},
- {0.3588196552610043},
- {0.42601780760098007},
- {0.16419052394290393},
- {0.20008309441260294},
- {0.36623066488950623},
- {0.4246043871449874},
- {0.3926184991351096},
- {0.27125519460024605},
- {0.3129019362388149},
- {0.5134160559787534},
- {0.051150927181010684},
- {0.7284358239190304},
- {0.34554885619759695},
- {0.09173088579848471},
- {0.48879920637651647},
- {0.6569289218395735},
- {0.5818591830468252},
- {0.6908271881421796},
- {0.26625008614970064},
- {0.3244532013490573},
- {0.5938768190507828},
- {0.6885351964417044},
- {0.6366671273613834},
- {0.43986532959712044},
- {0.507399364344334},
- {0.6622553107556913},
- {0.06597957500788368},
- {0.939609284355998},
- {0.4457234293270395},
- {0.1183236588979685},
- {0.6305020393234668},
- {0.8473725396995995},
- {0.7505400923820628},
- {0.8910979094516522},
- {0.34343595508648533},
- {0.41851214659712704},
- {0.7660416396626158},
- {0.8881414696243973},
- {0.8212368533641939},
- {0.5673822373701739},
- {0.6544943809178475},
- {0.2973446136588493},
- {0.029624030070378168},
- {0.4218731886472849},
- {0.20012442141190787},
- {0.05312588977440005},
- {0.2830877793638617},
- {0.3804600074170564},
- {0.3369834113525885},
- {0.40009216885820603},
- {0.15419858432727757},
- {0.1879068850342005},
- {0.34394341833538017},
- {0.3987647631825345},
- {0.36872540079345334},
- {0.25474775275900347},
- {0.293860050157752},
- {0.48224786942767733},
- {0.04804568412896202},
- {0.6842143326236068},
- {0.32457146157376504},
- {0.08616213638410927},
- {0.4591254463276261},
- {0.6170484332022247},
- {0.5465359878477825},
- {0.6488888217357698},
- {0.25008671872533367},
- {0.30475647042492787},
- {0.557824063650978},
- {0.6467359710381168},
- {0.5980166808756223},
- {0.4131622210936322},
- {0.47659643588189404},
- {0.5241971792621973},
- {0.05222503549059529},
- {0.7437321052298608},
- {0.35280496900462116},
- {0.0936571247175377},
- {0.4990634052527059},
- {0.6707236437076122},
- {0.5940775301611806},
- {0.7053337330703809},
- {0.27184101960334056},
- {0.33126633062835853},
- {0.6063475221517215},
- {0.7029936122847326},
- {0.6500363757724288},
- {0.4491019755712297},
- {0.5180541442976194},
- {0.05288146491434975},
- {0.005268506758914086},
- {0.07502833816035498},
- {0.03559127047628425},
- {0.009448211762032496},
- {0.05034594804964852},
- {0.06766318140412543},
- {0.059931055164850984},
- {0.07115467715939791},
- {0.027423557220716623},
- {0.033418434004328555},
- {0.06116886257133188},
- {0.07091860375015946},
- {0.06557623191876592},
- {0.04530579580294934},
- {0.05226175023293125},
- {0.19217253405489312},
- {0.019145882138206675},
- {0.27265481191861474},
- {0.12933954550500087},
- {0.03433503212397455},
- {0.18295840389004717},
- {0.24588965252205505},
- {0.21779091706833104},
- {0.2585778333056124},
- {0.09965787620369816},
- {0.12144340473849743},
- {0.22228913939179773},
- {0.25771993677513977},
- {0.23830562716088802},
- {0.16464236762215223},
- {0.18992047577866908},
- {0.0487437065679801},
- {0.0048562676530211225},
- {0.06915767756235383},
- {0.03280639912845624},
- {0.008708927834479852},
- {0.04640658352777429},
- {0.06236881419908851},
- {0.05524169521393535},
- {0.06558711469159563},
- {0.02527777602950052},
- {0.03080357822361263},
- {0.05638264925344428},
- {0.06536951306109884},
- {0.060445159975414435},
- {0.041760802580348526},
- {0.04817248202577314},
- {0.2575517028590769},
- {0.025659517743705156},
- {0.3654149197111685},
- {0.17334225390563227},
- {0.04601618038051567},
- {0.24520282623114323},
- {0.3295439644064448},
- {0.2918857360863345},
- {0.34654880114370484},
- {0.1335625605699193},
- {0.1627597608848188},
- {0.29791430216080084},
- {0.34539903896053564},
- {0.3193797718182519},
- {0.22065547687331316},
- {0.25453347006721655},
- {0.12770076150923362},
- {0.012722649159201077},
- {0.18118211992364275},
- {0.08594754986958156},
- {0.02281600630516277},
- {0.12157787072006432},
- {0.16339637726449474},
- {0.14472445865482444},
- {0.17182781288142981},
- {0.06622375431636843},
- {0.08070047752479702},
- {0.1477135768395305},
- {0.17125773120573007},
- {0.1583567090377661},
- {0.10940666326451394},
- {0.1262042440269027},
- {0.5177468332128009},
- {0.051582396490075504},
- {0.7345803401373228},
- {0.34846363671964126},
- {0.09250465597424938},
- {0.49292233507563815},
- {0.662470261628152},
- {0.5867672930952279},
- {0.6966544672547577},
- {0.2684959641237779},
- {0.3271900353875597},
- {0.5988863004992556},
- {0.6943431421007189},
- {0.6420375544618502},
- {0.44357569029441973},
- {0.5116793894625269},
- {0.08611566083029414},
- {0.008579583448900313},
- {0.12218108806445861},
- {0.05795916928207593},
- {0.015386090398021475},
- {0.08198665815036173},
- {0.11018718165114925},
- {0.09759567795894175},
- {0.11587296332793232},
- {0.044658326999911846},
- {0.054420779243870794},
- {0.0996114050754727},
- {0.11548852583789763},
- {0.10678865563939331},
- {0.07377894223113021},
- {0.08510647662174346},
- {0.36354852209593297},
- {0.036219833337784564},
- {0.5158034388360768},
- {0.2446822114729016},
- {0.06495439239627125},
- {0.34611739740215935},
- {0.46516959467028207},
- {0.4120129154538441},
- {0.48917286545314365},
- {0.18853096665064978},
- {0.22974443527069052},
- {0.42052257103911167},
- {0.48754991232251854},
- {0.45082227274339953},
- {0.3114674514637524},
- {0.35928811900544083},
- {0.31137008614467027},
- {0.031021368376119015},
- {0.4417725597072455},
- {0.20956410667042044},
- {0.055631789229402435},
- {0.2964407700627125},
- {0.3984059567326389},
- {0.35287860954012484},
- {0.41896414920808855},
- {0.16147199000704585},
- {0.19677028031657565},
- {0.36016691366352066},
- {0.4175741310251563},
- {0.38611783948610556},
- {0.26676397041696137},
- {0.307721158981799},
- {0.14534561389056272},
- {0.014480581247157433},
- {0.20621667510096472},
- {0.09782321773610428},
- {0.02596857218204645},
- {0.13837670227234705},
- {0.18597341535261527},
- {0.16472153368203557},
- {0.1955698513584693},
- {0.07537411767551908},
- {0.09185113940181995},
- {0.16812366858250866},
- {0.19492099954158837},
- {0.18023739887501838},
- {0.12452375732112646},
- {0.14364231745288547},
- {0.33764301503801747},
- {0.03363890372002943},
- {0.4790486487237983},
- {0.2272468036222131},
- {0.06032591402710272},
- {0.3214539862305883},
- {0.4320228385003345},
- {0.382653963785694},
- {0.4543156996325295},
- {0.175096748134104},
- {0.21337345388116596},
- {0.39055724379954226},
- {0.45280839385356375},
- {0.4186978688231497},
- {0.28927310388206695},
- {0.33368619701422847},
- {0.4552263353435581},
- {0.04535356629166326},
- {0.6458761209239398},
- {0.3063849243847953},
- {0.08133425998970063},
- {0.43339951847323877},
- {0.5824736920237634},
- {0.5159122323890941},
- {0.6125299852848258},
- {0.23607374485353186},
- {0.28768021591971626},
- {0.5265678095450232},
- {0.6104977641061248},
- {0.5645083355835424},
- {0.3900117257834061},
- {0.44989156551753934},
- {0.15848746024750013},
- {0.01578988511134269},
- {0.22486235547530262},
- {0.1066681884456923},
- {0.028316596154633986},
- {0.15088843421915427},
- {0.2027887425277387},
- {0.17961531017369042},
- {0.2132528682022887},
- {0.08218928771929641},
- {0.10015612728151774},
- {0.1833250589948784},
- {0.21254534856146995},
- {0.19653408743951128},
- {0.1357829349646636},
- {0.1566301553090839},
- {0.6049133861211574},
- {0.06026667885427873},
- {0.8582524361821883},
- {0.4071300970015464},
- {0.108078506883608},
- {0.575909497997447},
- {0.7740020864624897},
- {0.6855539568032345},
- {0.8139414588563962},
- {0.31369926844385704},
- {0.38227492572618327},
- {0.699713289772413},
- {0.8112410048204333},
- {0.7501293801768878},
- {0.5182549763790485},
- {0.5978244428217797},
- {0.056502992638260495},
- {0.005629314526284407},
- {0.08016656962135492},
- {0.03802869865585219},
- {0.010095261931557872},
- {0.053793833749178295},
- {0.07229701837781614},
- {0.06403536615839603},
- {0.07602762529795737},
- {0.029301628732614698},
- {0.03570705791882069},
- {0.06535794341470413},
- {0.07577538466646402},
- {0.07006714650118263},
- {0.048408512337371534},
- {0.05584083749299883},
- {0.23745782655442665},
- {0.023657592810360385},
- {0.3369056840313425},
- {0.15981829825058116},
- {0.042426052936922386},
- {0.2260723945347348},
- {0.3038333378246031},
- {0.269113159508886},
- {0.3195114775057531},
- {0.12314216908645552},
- {0.15006143869828878},
- {0.27467138405716557},
- {0.3184514183951394},
- {0.2944621434046869},
- {0.2034402000608667},
- {0.23467507268079912},
- {0.5720941821060083},
- {0.056996947229860845},
- {0.8116884776952117},
- {0.38504150379007956},
- {0.10221477391216505},
- {0.5446638821081422},
- {0.7320090789235958},
- {0.648359648183303},
- {0.7697815652129683},
- {0.296679707417975},
- {0.36153483455754315},
- {0.6617507752438412},
- {0.7672276226511653},
- {0.709431571646574},
- {0.49013737112862726},
- {0.565389845068836},
- {0.5935250333616252},
- {0.059132073117019505},
- {0.842094616361661},
- {0.39946529527942426},
- {0.10604377564711402},
- {0.5650671845832643},
- {0.7594303990118778},
- {0.6726474308858124},
- {0.7986178560535176},
- {0.30779343463126174},
- {0.3750780578684404},
- {0.6865401943222406},
- {0.7959682418962514},
- {0.7360071302932778},
- {0.5084980911359676},
- {0.5865695494778232},
- {0.39101260706592006},
- {0.03895604190398304},
- {0.5547695427012094},
- {0.26316660251868024},
- {0.06986133835677316},
- {0.3722646570775413},
- {0.500310590980282},
- {0.4431382179403456},
- {0.5261271764330465},
- {0.20277344096388855},
- {0.24710035974338287},
- {0.45229073105316336},
- {0.524381618148026},
- {0.48487940804299023},
- {0.33499709890412505},
- {0.38643035402866127},
- {0.582501046213421},
- {0.058033768618561195},
- {0.8264537592679607},
- {0.3920457257014199},
- {0.10407414479050185},
- {0.5545717664785954},
- {0.7453249266424224},
- {0.660153843898657},
- {0.7837845255508492},
- {0.30207655551588786},
- {0.36811145080538876},
- {0.6737885665836972},
- {0.7811841246714997},
- {0.7223367159227416},
- {0.4990533733793808},
- {0.575674751766685},
- {0.07609111958206771},
- {0.0075808523546154714},
- {0.10795824700110022},
- {0.05121226543695422},
- {0.01359502828043684},
- {0.0724427653379708},
- {0.09736052576953763},
- {0.08623477228957638},
- {0.1023844376726027},
- {0.03945974596632227},
- {0.04808577187086933},
- {0.0880158528919889},
- {0.10204475173459772},
- {0.09435761495552321},
- {0.0651904922033938},
- {0.07519941236467212},
- {0.5209267881279088},
- {0.051899210973003},
- {0.7390920671307377},
- {0.35060386932608106},
- {0.09307281132849907},
- {0.49594982013520583},
- {0.6665390949448232},
- {0.5903711655247785},
- {0.7009332569163607},
- {0.2701450424107543},
- {0.32919960743022897},
- {0.6025646067924022},
- {0.6986077358091793},
- {0.6459808919117882},
- {0.44630009265883624},
- {0.5148220786787678},
- {0.2684245840943256},
- {0.026742767770336576},
- {0.38084138740484713},
- {0.18066012336191584},
- {0.04795881348533692},
- {0.2555543835245435},
- {0.3434560929111623},
- {0.3042080733393961},
- {0.3611788110222069},
- {0.13920107836045023},
- {0.16963087658831857},
- {0.3104911431978362},
- {0.359980510128062},
- {0.3328628056688211},
- {0.22997073577984595},
- {0.26527893266643243},
- {0.5743405865957881},
- {0.057220753383053255},
- {0.8148756813019409},
- {0.3865534208658336},
- {0.1026161339228417},
- {0.5468025778482117},
- {0.7348834106907888},
- {0.65090551924829},
- {0.7728042157106161},
- {0.29784466005622223},
- {0.362954449545712},
- {0.6643492283641835},
- {0.7702402447510127},
- {0.7122172498051453},
- {0.4920619612145796},
- {0.5676099240805873},
- {0.676039763026487},
- {0.06735290080500828},
- {0.959166695407368},
- {0.4550008986621258},
- {0.12078649581614107},
- {0.6436255660457763},
- {0.8650100975105643},
- {0.7661621401221612},
- {0.909645584950737},
- {0.3505843711944102},
- {0.4272232291899317},
- {0.7819863429332051},
- {0.9066276085785449},
- {0.8383304123351287},
- {0.579191962778645},
- {0.6681172940281574},
- {0.35490641948739743},
- {0.03535883268135336},
- {0.5035420047404086},
- {0.23886574228237573},
- {0.06341032746450534},
- {0.3378896592017564},
- {0.4541118042429271},
- {0.40221874033007776},
- {0.47754448068572636},
- {0.1840492981534488},
- {0.22428305979348412},
- {0.41052610842891246},
- {0.4759601076252466},
- {0.44010554003107794},
- {0.304063395302967},
- {0.3507472926734515},
- {0.04952619570857716},
- {0.004934225957177212},
- {0.07026787486764048},
- {0.03333304457394177},
- {0.008848733399885919},
- {0.04715155452443107},
- {0.0633700289867789},
- {0.05612849742198639},
- {0.06663999328091039},
- {0.025683563496933744},
- {0.03129807212136112},
- {0.05728776734694386},
- {0.06641889846278326},
- {0.061415494088526056},
- {0.042431194243653145},
- {0.04894580122356957},
- {0.6226869982705628},
- {0.062037439098744825},
- {0.8834696760002689},
- {0.4190924251703033},
- {0.11125407797710558},
- {0.5928309156506434},
- {0.7967438759537533},
- {0.7056969564710752},
- {0.8378567500930448},
- {0.32291640474269995},
- {0.39350695731977586},
- {0.7202723200625916},
- {0.8350769511066084},
- {0.7721697399557133},
- {0.5334823843948061},
- {0.6153897670879227},
- {0.042228216908304035},
- {0.004207138485263832},
- {0.05991348657297335},
- {0.028421222675070246},
- {0.00754482002964391},
- {0.040203493192524135},
- {0.05403207921087651},
- {0.04785763028962757},
- {0.0568201948640051},
- {0.021898938022790373},
- {0.02668611548784252},
- {0.04884607491263945},
- {0.05663167967919034},
- {0.052365556627071895},
- {0.03617870600727477},
- {0.041733346994420474},
- {0.3970590607346824},
- {0.039558441668681894},
- {0.5633482644001182},
- {0.26723609961555145},
- {0.07094164456168472},
- {0.3780212003727236},
- {0.5080471824703957},
- {0.449990720021391},
- {0.5342629846875432},
- {0.20590904373957342},
- {0.25092141525341916},
- {0.4592847637280806},
- {0.5324904338270768},
- {0.4923773782431546},
- {0.34017735243327046},
- {0.3924059496734427},
- {0.30885555726720343},
- {0.030770849363306575},
- {0.43820494063243115},
- {0.2078717315150933},
- {0.05518252404065375},
- {0.29404680574195613},
- {0.39518855298148486},
- {0.35002887061717414},
- {0.41558072382881955},
- {0.16016799196792111},
- {0.19518122416089415},
- {0.3572583166421156},
- {0.4142019310044452},
- {0.3829996707836638},
- {0.26460966678623465},
- {0.3052360977158052},
- {0.45760050715404527},
- {0.04559010172521515},
- {0.6492446010849285},
- {0.30798283380733266},
- {0.08175844789866388},
- {0.4356598554519009},
- {0.5855115053324104},
- {0.518602903344893},
- {0.6157245531541119},
- {0.23730495576272584},
- {0.2891805734474854},
- {0.5293140532323272},
- {0.6136817331988011},
- {0.5674524529886043},
- {0.3920457795567134},
- {0.45223791455251244},
- {0.42639335656178795},
- {0.04248097673996645},
- {0.6049678275225977},
- {0.2869792148772949},
- {0.07618273686715508},
- {0.40594899957753944},
- {0.5455811612118416},
- {0.4832355498362183},
- {0.5737337586658483},
- {0.22112138215430904},
- {0.26945921920324056},
- {0.49321622748350513},
- {0.571830253656613},
- {0.5287536887225939},
- {0.3653092889051271},
- {0.4213964786661276},
- {0.49239275162584834},
- {0.04905640462462188},
- {0.6986079136901326},
- {0.33139935953101635},
- {0.08797469954710863},
- {0.4687839100813472},
- {0.6300290683947278},
- {0.5580332770330243},
- {0.662539272206462},
- {0.25534770682219476},
- {0.31116752724361424},
- {0.5695588161958888},
- {0.6603411327307708},
- {0.6105969516546812},
- {0.42185377232164273},
- {0.4866224308206131},
- {0.5043894379707848},
- {0.050251617790430365},
- {0.7156288385330707},
- {0.33947359327649484},
- {0.09011812036975846},
- {0.480205389203916},
- {0.6453791341639074},
- {0.571629233050852},
- {0.6786814185187681},
- {0.2615690135687498},
- {0.3187488314215191},
- {0.5834355811367493},
- {0.6764297234418921},
- {0.6254735721735423},
- {0.4321318427710155},
- {0.49847852872556647},
- {0.4908608670214325},
- {0.04890378509327355},
- {0.6964344724606034},
- {0.33036834196403847},
- {0.08770100118869588},
- {0.46732547501649235},
- {0.6280689830217779},
- {0.5562971779880729},
- {0.6604780442384167},
- {0.2545532937859301},
- {0.31019945299230833},
- {0.5677868600105898},
- {0.6582867434012108},
- {0.6086973215999038},
- {0.42054134175275143},
- {0.48510849827900665},
- {0.2729346363604411},
- {0.02719209800136498},
- {0.38724025943101076},
- {0.18369556291196387},
- {0.04876461432570907},
- {0.2598481915243562},
- {0.34922681966993346},
- {0.3093193574461187},
- {0.36724731372891567},
- {0.1415399257541176},
- {0.17248100345706863},
- {0.31570799503245095},
- {0.3660288790616987},
- {0.33845554470976036},
- {0.23383468900731808},
- {0.26973613190346096},
- {0.5994758660613299},
- {0.05972494629763846},
- {0.8505376708203883},
- {0.40347043576706665},
- {0.10710699746969972},
- {0.570732691664748},
- {0.7670446410363353},
- {0.6793915648348327},
- {0.8066250014732387},
- {0.31087944976559245},
- {0.3788386857210912},
- {0.693423620645297},
- {0.8039488216116087},
- {0.7433865246776363},
- {0.5135964221218243},
- {0.5924506447298863},
- {0.2346882531630418},
- {0.023381664067549397},
- {0.33297620724197396},
- {0.1579542682764427},
- {0.04193121952157208},
- {0.2234356143640608},
- {0.30028959812115813},
- {0.26597437627035375},
- {0.3157848768744651},
- {0.1217059086784159},
- {0.14831120719940638},
- {0.2714677728403956},
- {0.3147371816920009},
- {0.2910277039971618},
- {0.20106738896846227},
- {0.23193795575208387},
- {0.2919146036836817},
- {0.029083045733021465},
- {0.4141690786100378},
- {0.1964698147547714},
- {0.052155722170336365},
- {0.2779181230284776},
- {0.3735121713355284},
- {0.33082953063285925},
- {0.3927858166725934},
- {0.15138266026949562},
- {0.18447539102600893},
- {0.3376624362470444},
- {0.39148265164473883},
- {0.3619918582558264},
- {0.2500956327101097},
- {0.28849367414029176},
- {0.36008033277887325},
- {0.03587430246250118},
- {0.5108827642423237},
- {0.24234798596976248},
- {0.06433473885317308},
- {0.34281549796601773},
- {0.4607319580941368},
- {0.4080823843004522},
- {0.48450624187184244},
- {0.1867324142024014},
- {0.22755271353994044},
- {0.416510859259754},
- {0.482898771430233},
- {0.4465215071091257},
- {0.3084961064516735},
- {0.3558605731887305},
- {0.6313960496052982},
- {0.06290510976360064},
- {0.895826097095198},
- {0.4249539534420419},
- {0.11281010448639887},
- {0.6011223925749396},
- {0.8078873289816616},
- {0.7155670052078287},
- {0.8495752177469083},
- {0.32743279187386404},
- {0.39901064103469486},
- {0.730346223368484},
- {0.8467565398178564},
- {0.7829694931592988},
- {0.540943798371291},
- {0.6239967575780483},
- {0.10826739025739598},
- {0.010786529425101003},
- {0.15361001025837245},
- {0.07286813965259051},
- {0.0193438898058384},
- {0.10307627472496061},
- {0.13853088372273029},
- {0.12270043858618085},
- {0.14567923209262482},
- {0.05614589112972316},
- {0.06841956140961346},
- {0.1252346758233304},
- {0.14519590486315398},
- {0.13425814705129255},
- {0.0927572691691596},
- {0.10699861127462677},
- {0.6020075974725417},
- {0.05997717917494867},
- {0.8541296968877309},
- {0.4051743888927165},
- {0.10755933619625473},
- {0.5731430337063497},
- {0.7702840558676153},
- {0.6822607995489934},
- {0.8100315737289594},
- {0.31219236878807616},
- {0.3804386130154524},
- {0.6963521161211839},
- {0.8073440917132291},
- {0.7465260255679116},
- {0.5157654638934557},
- {0.5949527069341752},
- {0.3510625187687327},
- {0.03497587020197272},
- {0.49808826998775146},
- {0.23627864847959312},
- {0.06272354641483138},
- {0.3342300626644187},
- {0.44919343535795536},
- {0.3978624119569582},
- {0.4723723184713784},
- {0.18205590724644974},
- {0.2218539072975397},
- {0.40607980507520103},
- {0.4708051053505656},
- {0.435338869413913},
- {0.3007701623842364},
- {0.34694843839427425},
- {0.5806917161524074},
- {0.05785350758246856},
- {0.823886677817375},
- {0.3908279766151056},
- {0.10375087587971134},
- {0.5528491886830673},
- {0.7430098427404052},
- {0.6581033133418038},
- {0.7813499807330243},
- {0.30113826330821675},
- {0.36696804493843777},
- {0.6716956846632062},
- {0.7787576570640288},
- {0.7200930366318824},
- {0.4975032435103012},
- {0.5738866251349667},
- {0.3961765191786859},
- {0.039470515281613744},
- {0.5620961125088815},
- {0.26664211502611335},
- {0.0707839628574552},
- {0.3771809741913607},
- {0.5069179480685728},
- {0.4489905274820321},
- {0.5330754805289803},
- {0.20545137054727947},
- {0.25036369324641883},
- {0.4582639133556547},
- {0.5313068695100872},
- {0.491282973051322},
- {0.33942124161848203},
- {0.39153375056843726},
- {0.5493235767322782},
- {0.05472834350433303},
- {0.7793814929537088},
- {0.369716005979499},
- {0.0981464013383505},
- {0.5229850629403742},
- {0.7028735093137161},
- {0.6225535096998028},
- {0.7391425676603087},
- {0.2848712032392756},
- {0.3471449538280077},
- {0.6354116404822063},
- {0.7366902776236336},
- {0.6811946364304842},
- {0.4706288268959237},
- {0.542886087039024},
- {0.06649862361535899},
- {0.006625165330488665},
- {0.09434839272876207},
- {0.04475614477072903},
- {0.011881158716371245},
- {0.06331020245627705},
- {0.08508668283109007},
- {0.075363507549075},
- {0.0894772507259194},
- {0.03448521732082049},
- {0.04202379545021885},
- {0.07692005461079493},
- {0.0891803876036143},
- {0.08246233669098285},
- {0.056972193708595666},
- {0.06571933027665691},
- {0.46854436029265556},
- {0.04668042258381311},
- {0.6647717638704305},
- {0.3153484700986094},
- {0.08371376139297888},
- {0.44607898174637584},
- {0.5995144441953418},
- {0.5310056737149722},
- {0.6304500593067671},
- {0.24298027854827825},
- {0.2960965398349156},
- {0.5419729886404278},
- {0.6283583838077451},
- {0.5810234963147448},
- {0.40142184310560347},
- {0.46305351733965705},
- {0.0390866613053953},
- {0.0038941496723737833},
- {0.055456240607749833},
- {0.026306834290396923},
- {0.006983525393677293},
- {0.03721256630660486},
- {0.05001237879230738},
- {0.044297276157110335},
- {0.05259307341293859},
- {0.020269773059641772},
- {0.02470080988489116},
- {0.045212185737183254},
- {0.052418582759076064},
- {0.048469836659107486},
- {0.03348720196366473},
- {0.038628607091166965},
- {0.03257529580854906},
- {0.0032454313892199926},
- {0.04621790098961872},
- {0.02192443355805047},
- {0.005820154443688706},
- {0.03101340239222665},
- {0.041680920775490675},
- {0.036917885184828345},
- {0.043831702854362914},
- {0.01689307378368605},
- {0.020585953413217076},
- {0.03768038188353812},
- {0.043686280235096776},
- {0.040395347523441115},
- {0.02790863873595743},
- {0.03219354789182994},
- {0.17238052568974985},
- {0.017174031887591812},
- {0.24457386713204946},
- {0.11601875864454564},
- {0.030798838742556914},
- {0.1641153664181537},
- {0.22056527365827552},
- {0.19536045022941556},
- {0.23194668819949937},
- {0.08939402903544157},
- {0.10893584795210857},
- {0.19939539691210367},
- {0.23117714714287763},
- {0.21376233334720623},
- {0.1476857138877334},
- {0.17036040875967615},
- {0.23838704675041467},
- {0.023750169725372316},
- {0.3382240636791632},
- {0.16044369936949873},
- {0.04259207460821065},
- {0.22695706124715792},
- {0.3050222987353371},
- {0.27016625338433453},
- {0.3207617901278147},
- {0.12362404914134045},
- {0.15064865926499227},
- {0.2757462283822794},
- {0.31969758279286653},
- {0.2956144329483749},
- {0.20423630244803762},
- {0.23559340340164386},
- {0.559494286457331},
- {0.05574163716055422},
- {0.7938117181719024},
- {0.3765612868609275},
- {0.09996357904717729},
- {0.5326681158640199},
- {0.7158871914847674},
- {0.6340800694610552},
- {0.752827770370563},
- {0.2901455851152701},
- {0.3535723323485227},
- {0.6471762681534009},
- {0.7503300762566171},
- {0.6938069349133034},
- {0.4793425056625888},
- {0.5529376068334032},
- {0.05842807346438841},
- {0.005821107650025172},
- {0.08289787851082456},
- {0.03932435248243208},
- {0.010439211769818676},
- {0.05562661238760271},
- {0.07476020833230908},
- {0.06621707813203997},
- {0.07861791860603305},
- {0.03029994760058346},
- {0.03692361246482565},
- {0.06758471615412896},
- {0.07835708402967792},
- {0.0724543637789377},
- {0.05005781080052847},
- {0.05774335841363242},
- {0.661271087114617},
- {0.06588151817618126},
- {0.9382128656999047},
- {0.4450610087629464},
- {0.11814780988551904},
- {0.6295650064257772},
- {0.8461132004797781},
- {0.7494246625916189},
- {0.8897735869211262},
- {0.34292555104637973},
- {0.4178901666113604},
- {0.7649031719454706},
- {0.8868215408645579},
- {0.8200163562041481},
- {0.5665390111967089},
- {0.6535216913339548},
- {0.38562076596078626},
- {0.03841886027803152},
- {0.547119586740305},
- {0.2595376849868232},
- {0.06889799029841195},
- {0.3671313395226911},
- {0.4934115929402354},
- {0.437027594355404},
- {0.5188721823864186},
- {0.199977310725985},
- {0.24369298654701657},
- {0.44605389952626495},
- {0.5171506943557647},
- {0.47819319722503983},
- {0.3303776797464524},
- {0.38110169958256085},
- {0.303249644540313},
- {0.030212340079584173},
- {0.43025125938604725},
- {0.20409873550501},
- {0.05418092828968654},
- {0.28870968069490954},
- {0.3880156448483678},
- {0.34367563767575005},
- {0.40803768562230025},
- {0.15726084730600184},
- {0.19163856843452495},
- {0.3507738649399278},
- {0.40668391871071924},
- {0.3760479981382418},
- {0.25980684338289256},
- {0.2996958803403055},
- {0.3639976346612653},
- {0.036264577797678006},
- {0.5164406407267278},
- {0.24498448159368832},
- {0.06503463432279734},
- {0.34654497628862335},
- {0.4657442456378407},
- {0.41252189889391616},
- {0.4897771690526413},
- {0.1887638698834532},
- {0.23002825189054743},
- {0.42104206695005825},
- {0.48815221099392647},
- {0.45137919963242507},
- {0.31185222526323847},
- {0.3597319684478473},
- {0.4128514121281317},
- {0.04113181166117914},
- {0.58575448712133},
- {0.2778649626928346},
- {0.07376322827589173},
- {0.3930563531266073},
- {0.5282538983558834},
- {0.46788833847951156},
- {0.555512389688117},
- {0.21409872707738128},
- {0.2609013894025835},
- {0.47755203702749993},
- {0.5536693386204536},
- {0.511960854215252},
- {0.35370733025515727},
- {0.4080132314583157},
- {0.29976721393950073},
- {0.02986539036501887},
- {0.4253103792277366},
- {0.20175492506728582},
- {0.05355873028862232},
- {0.28539422280434296},
- {0.38355978618689385},
- {0.3397289667432583},
- {0.4033518996757093},
- {0.15545490953549512},
- {0.18943784692659413},
- {0.34674568003279066},
- {0.40201367902907575},
- {0.37172957244618227},
- {0.25682329725848235},
- {0.2962542601325835},
- {0.07035982903464598},
- {0.007009851853110868},
- {0.09982667942853629},
- {0.047354885306092796},
- {0.012571031557776427},
- {0.06698627398272398},
- {0.09002719352130949},
- {0.07973944750007504},
- {0.09467269728740318},
- {0.03648758219343249},
- {0.044463883649185965},
- {0.08138637459709995},
- {0.09435859697379527},
- {0.08725046618912106},
- {0.060280252298931504},
- {0.06953528646371895},
- {0.24964636099101484},
- {0.024871919534561943},
- {0.35419880336660736},
- {0.1680216531792832},
- {0.04460375082430563},
- {0.23767652317488722},
- {0.3194288781139854},
- {0.2829265387501943},
- {0.3359117650977539},
- {0.12946296545811106},
- {0.157763981249603},
- {0.2887700628495395},
- {0.3347972939378007},
- {0.30957666722240135},
- {0.2138826349142823},
- {0.24672077042124885},
- {0.6717398234596819},
- {0.06692450380981671},
- {0.9530659317388521},
- {0.4521068730824313},
- {0.1200182353366532},
- {0.6395317964348618},
- {0.8595082153027481},
- {0.761288978688356},
- {0.9038597994741716},
- {0.3483544851852594},
- {0.4245058830107246},
- {0.7770125319229967},
- {0.9008610188900443},
- {0.8329982258171077},
- {0.5755080220199268},
- {0.6638677451924538},
- {0.06665269820175808},
- {0.0066405155671195},
- {0.09456699408916293},
- {0.044859842924457057},
- {0.011908686874333661},
- {0.06345688960148346},
- {0.08528382518911991},
- {0.07553812170834501},
- {0.08968456584987543},
- {0.034565118156457644},
- {0.04212116286251845},
- {0.07709827522583358},
- {0.08938701490787873},
- {0.08265339854652824},
- {0.057104195947208516},
- {0.06587159927231868},
- {0.3196910057944391},
- {0.031850370021330475},
- {0.4535782987180532},
- {0.21516440731160008},
- {0.05711846912817619},
- {0.3043627251199538},
- {0.40905278538277867},
- {0.362308785034701},
- {0.43016036611145064},
- {0.1657870977014717},
- {0.2020286842700498},
- {0.3697918586484636},
- {0.428733201683177},
- {0.39643628580022405},
- {0.2738928555027994},
- {0.31594456627864387},
- {0.6115111932692572},
- {0.06092400919885363},
- {0.8676134194043098},
- {0.41157067630733374},
- {0.10925732216796641},
- {0.5821909589300788},
- {0.7824441487740079},
- {0.6930313129014487},
- {0.8228191410148498},
- {0.31712079510069646},
- {0.3864444089867014},
- {0.7073450821096323},
- {0.8200892330515139},
- {0.75831106221614},
- {0.5239075978388207},
- {0.6043449306678997},
- {0.03492187649083969},
- {0.0034792179570658217},
- {0.049547234797534534},
- {0.023503773084538635},
- {0.006239412708165422},
- {0.033247471159350665},
- {0.04468343053278302},
- {0.039577286858872594},
- {0.046989145469602596},
- {0.018109976335800547},
- {0.022068874731565095},
- {0.04039471045783274},
- {0.046833247246027485},
- {0.04330525025187764},
- {0.0299190540184992},
- {0.03451262913736511},
- {0.4933231623057151},
- {0.049149100145885964},
- {0.699927982399086},
- {0.33202556189161275},
- {0.08814093391945961},
- {0.46966971019730985},
- {0.6312195525599097},
- {0.5590877200949057},
- {0.6637911866846029},
- {0.25583020424467384},
- {0.31175550013643044},
- {0.5706350375733382},
- {0.6615888936700196},
- {0.6117507174707655},
- {0.42265089464688843},
- {0.4875419380741282},
- {0.5119788704641769},
- {0.05100774238819861},
- {0.7263967419654298},
- {0.34458157477949064},
- {0.0914741071123224},
- {0.48743092984764624},
- {0.6550900063643369},
- {0.5802304073596214},
- {0.6888933825739434},
- {0.2655047826816592},
- {0.3235449721736998},
- {0.5922144028644493},
- {0.686607806756324},
- {0.6348849299361267},
- {0.4386340317584576},
- {0.5059790211196741},
- {0.01970590524254995},
- {0.0019632719163330606},
- {0.027958781487778875},
- {0.013262836129891415},
- {0.0035208095311980575},
- {0.018761062750807037},
- {0.02521420772512197},
- {0.022332885370656894},
- {0.02651528901361507},
- {0.010219195343403684},
- {0.012453143930682},
- {0.02279414557780407},
- {0.026427317921281047},
- {0.024436520706218615},
- {0.016882885534227548},
- {0.01947497293367331},
- {0.5091670331477021},
- {0.05072760294934592},
- {0.722407301026642},
- {0.34268909954969023},
- {0.09097172249704238},
- {0.48475391218770447},
- {0.6514921888921531},
- {0.5770437260223857},
- {0.6851099137006327},
- {0.2640466048178541},
- {0.3217680319935494},
- {0.5889619042685241},
- {0.682836890485756},
- {0.631398080691658},
- {0.4362250113673309},
- {0.5032001355542448},
- {0.3830244553503812},
- {0.03816019346497493},
- {0.5434359355638051},
- {0.25779026756325074},
- {0.06843411335236195},
- {0.36465951467207636},
- {0.490089547378566},
- {0.4340851714352128},
- {0.5153787155623035},
- {0.1986309018717198},
- {0.2420522484371876},
- {0.443050704225651},
- {0.5136688179801788},
- {0.47497361420106665},
- {0.32815331023349437},
- {0.3785358149787991},
- {0.09969922938407227},
- {0.009932895480850723},
- {0.14145348485845657},
- {0.06710143610871744},
- {0.017813035876707625},
- {0.09491893296243446},
- {0.127567703629092},
- {0.11299006231744138},
- {0.13415033965784479},
- {0.05170256773907069},
- {0.06300491340114009},
- {0.11532374283767513},
- {0.13370526240786193},
- {0.1236331065866154},
- {0.08541656203174658},
- {0.09853086015913702},
- {0.6771990317829498},
- {0.06746839713796188},
- {0.9608114684562896},
- {0.4557811313567533},
- {0.12099361974354944},
- {0.6447292511400335},
- {0.8664934114144383},
- {0.7674759501670794},
- {0.9112054395092423},
- {0.35118555108094585},
- {0.42795582891072004},
- {0.7833272882221105},
- {0.9081822879300471},
- {0.8397679760817668},
- {0.5801851575331041},
- {0.6692629773843433},
- {0.521258302000266},
- {0.05193223923876713},
- {0.7395624197384113},
- {0.35082699097970427},
- {0.09313204216246246},
- {0.4962654388538338},
- {0.6669632753891362},
- {0.590746873274258},
- {0.7013793255455041},
- {0.2703169606747959},
- {0.32940910757329106},
- {0.6029480743557829},
- {0.6990523244942595},
- {0.6463919892710084},
- {0.4465841146660024},
- {0.5151497075601528},
- {0.4850545471673673},
- {0.04832530952635977},
- {0.6881964531435596},
- {0.3264604642089013},
- {0.08666359914947183},
- {0.46179755179791515},
- {0.6206396488644828},
- {0.5497168217887437},
- {0.6526653481383867},
- {0.2515422209077933},
- {0.3065301500112851},
- {0.561070594079346},
- {0.6504999678713712},
- {0.6014971319311528},
- {0.41556682105630405},
- {0.47937022233530596},
- {0.5560080446802423},
- {0.05539430774380018},
- {0.7888654307083494},
- {0.37421491135421536},
- {0.09934070011186548},
- {0.5293490295323137},
- {0.7114264563261659},
- {0.6301290792871046},
- {0.7481368562941446},
- {0.2883376709242753},
- {0.3513692023683024},
- {0.643143674795812},
- {0.7456547254589972},
- {0.6894837831309248},
- {0.4763556943416786},
- {0.5494922201123484},
- {0.5223871271069148},
- {0.052044702513255534},
- {0.741163999270346},
- {0.35158673392094525},
- {0.09333372679179698},
- {0.49734013998528936},
- {0.6684076358675841},
- {0.5920261812481883},
- {0.7028982166383116},
- {0.2709023529281025},
- {0.33012246843404014},
- {0.6042538049728812},
- {0.7005661762865901},
- {0.6477918010407697},
- {0.44755122705333716},
- {0.5162653040338112},
- {0.5400276764913932},
- {0.05380220589962375},
- {0.7661924493463182},
- {0.3634595057042179},
- {0.09648552386196316},
- {0.5141348748572654},
- {0.6909791681616241},
- {0.6120183796491173},
- {0.7266344652161448},
- {0.2800504848157811},
- {0.34127041103283373},
- {0.6246589193684383},
- {0.7242236739326786},
- {0.6696671549002859},
- {0.462664634549886},
- {0.5336991248895024},
- {0.2694377905159473},
- {0.02684371211613212},
- {0.3822789268934147},
- {0.1813420504578965},
- {0.04813984078565165},
- {0.2565190095603229},
- {0.3447525163369704},
- {0.3053563495841246},
- {0.36254213134518},
- {0.13972651244826803},
- {0.17027117223800545},
- {0.31166313577521565},
- {0.36133930729543406},
- {0.33411924323902575},
- {0.23083879273172084},
- {0.2662802653834243},
- {0.25275387934231053},
- {0.025181517263440447},
- {0.35860775720474614},
- {0.17011313317761756},
- {0.04515896410149071},
- {0.24063504479926093},
- {0.32340502700208684},
- {0.28644831814943994},
- {0.3400930877107239},
- {0.1310744791984965},
- {0.1597277770163847},
- {0.292364580574723},
- {0.3389647439689001},
- {0.31343017892875147},
- {0.21654497779955886},
- {0.24979187195337746},
- {0.42724080447846435},
- {0.04256540679658589},
- {0.6061701884815588},
- {0.2875495800906233},
- {0.07633414847020013},
- {0.40675581476045614},
- {0.5466654924082163},
- {0.4841959704283092},
- {0.5748740425633949},
- {0.22156085629656652},
- {0.2699947637900145},
- {0.49419648446457587},
- {0.5729667543775936},
- {0.5298045756678224},
- {0.3660353335093899},
- {0.4222339953920446},
- {0.23007606020258783},
- {0.02292215770128431},
- {0.32643241777513105},
- {0.15485008408997578},
- {0.0411071694343004},
- {0.21904456302767925},
- {0.2943881797421574},
- {0.2607473351664131},
- {0.30957893871391134},
- {0.11931409260885628},
- {0.14539653253383497},
- {0.26613277318016654},
- {0.30855183328095587},
- {0.2853083042846407},
- {0.1971159274722921},
- {0.22737981280132158},
- {0.06269446995529143},
- {0.006246162795243558},
- {0.08895105118983561},
- {0.042195802275147534},
- {0.01120147918378182},
- {0.05968844721835302},
- {0.08021917132006777},
- {0.0710522248864948},
- {0.08435857018283563},
- {0.032512438659294554},
- {0.039619761102131126},
- {0.07251972733525915},
- {0.08407868956139833},
- {0.07774495484327386},
- {0.05371301378222235},
- {0.061959757262706736},
- {0.25897582482546816},
- {0.025801401033390924},
- {0.36743546707401203},
- {0.1743007430507258},
- {0.046270625032062675},
- {0.24655866557206213},
- {0.33136616473901126},
- {0.2934997067330915},
- {0.34846502904923476},
- {0.13430108947220795},
- {0.16365973455281466},
- {0.29956160752550837},
- {0.347308909301495},
- {0.3211457696494379},
- {0.22187558261569984},
- {0.25594090283462034},
- {0.31716521267229},
- {0.031598728767495796},
- {0.44999469790822993},
- {0.21346445088408525},
- {0.05666719138230053},
- {0.30195803664322873},
- {0.4058209687436202},
- {0.35944628023866904},
- {0.42676178412305377},
- {0.16447725818917494},
- {0.20043250967659174},
- {0.366870232089468},
- {0.42534589533917355},
- {0.39330414874946074},
- {0.2717289013154877},
- {0.3134483727729682},
- {0.4052828640612006},
- {0.040377767749756176},
- {0.5750162145589427},
- {0.2727710372163146},
- {0.07241097290658023},
- {0.38585069556008283},
- {0.5185697483110983},
- {0.45931083268515166},
- {0.545328526681672},
- {0.210173788323748},
- {0.2561184465606447},
- {0.4687973726603068},
- {0.543519263122506},
- {0.5025753944113439},
- {0.34722303384240527},
- {0.40053337874734146},
- {0.19158276076315858},
- {0.01908712384588699},
- {0.27181804028148493},
- {0.1289426052768924},
- {0.0342296586635206},
- {0.18239690856167778},
- {0.24513502257202294},
- {0.21712252152106423},
- {0.25778426360706913},
- {0.09935202836761177},
- {0.12107069759320052},
- {0.22160693889888813},
- {0.2569289999422307},
- {0.23757427241833468},
- {0.1641370838073291},
- {0.18933761400438567},
- {0.08979135610825764},
- {0.00894578785430067},
- {0.1273961725697033},
- {0.060433054319835165},
- {0.016042818561947173},
- {0.08548611422273829},
- {0.11489032739005715},
- {0.10176137754441289},
- {0.12081879664142747},
- {0.04656448901611948},
- {0.05674363433620983},
- {0.10386314242193248},
- {0.12041795011437016},
- {0.11134674128246028},
- {0.07692806640851453},
- {0.08873909664958173},
- {0.49911249926122503},
- {0.04972588373025029},
- {0.7081419063424897},
- {0.3359220094994019},
- {0.08917530166260008},
- {0.47518146479934475},
- {0.6386271566658992},
- {0.5656488294176246},
- {0.6715810314384024},
- {0.258832470039061},
- {0.3154140707772001},
- {0.5773316591057464},
- {0.6693528936686761},
- {0.6189298473126732},
- {0.42761086537322185},
- {0.4932634301408322},
- {0.5003428380301058},
- {0.049848460669639195},
- {0.7098875136805788},
- {0.33675007506021076},
- {0.08939512350842552},
- {0.476352812299681},
- {0.640201406461024},
- {0.567043183767465},
- {0.6732365142817427},
- {0.2594705057985453},
- {0.3161915831819227},
- {0.5787548122500805},
- {0.6710028840342993},
- {0.6204555421960781},
- {0.42866494882423156},
- {0.49447935064426923},
- {0.2572761351556774},
- {0.025632063316898893},
- {0.3650239436504595},
- {0.17315678618679906},
- {0.04596694532205591},
- {0.24494047122070647},
- {0.32919136851042635},
- {0.29157343264956626},
- {0.34617801090552386},
- {0.13341965517396254},
- {0.16258561591503218},
- {0.2975955484537005},
- {0.34502947891155844},
- {0.3190380511103116},
- {0.22041938632400013},
- {0.254261131725027},
- {0.5406631399175247},
- {0.053865516236450445},
- {0.767094046246131},
- {0.3638871971593216},
- {0.09659906067541645},
- {0.5147398696071515},
- {0.691792259802479},
- {0.6127385562499058},
- {0.7274895132940721},
- {0.2803800268898597},
- {0.3416719920518682},
- {0.6253939703933126},
- {0.7250758851750965},
- {0.670455168187652},
- {0.46320906304238685},
- {0.5343271413582679},
- {0.338610395394485},
- {0.03373528247872579},
- {0.4804211700908272},
- {0.22789788800454341},
- {0.06049875368797708},
- {0.3223749834315896},
- {0.43326062630845347},
- {0.38375030492531165},
- {0.45561735867443154},
- {0.1755984174922194},
- {0.21398478975569316},
- {0.39167622861160845},
- {0.45410573431656204},
- {0.4198974792861374},
- {0.2901018996986142},
- {0.33464224069894555},
- {0.4106216382331882},
- {0.040909662391006935},
- {0.5825908790389533},
- {0.27636423865040444},
- {0.0733648396159898},
- {0.39093349059132937},
- {0.5254008458584136},
- {0.46536131502205924},
- {0.5525121164942838},
- {0.21294239882330807},
- {0.2594922841163847},
- {0.47497282079047143},
- {0.5506790195821276},
- {0.5091957990054908},
- {0.35179698830576767},
- {0.40580958814846807},
- {0.0753801984179391},
- {0.007510024268360048},
- {0.1069495904974654},
- {0.05073378800670909},
- {0.013468009603558711},
- {0.07176593083547382},
- {0.09645088403078517},
- {0.08542907873372917},
- {0.10142785740385851},
- {0.03909107260873891},
- {0.04763650534536379},
- {0.08719351865714749},
- {0.10109134515975908},
- {0.09347602948487928},
- {0.06458141586358034},
- {0.07449682244256668},
- {0.4629636765381776},
- {0.04612442682750321},
- {0.6568538775453231},
- {0.3115924541624031},
- {0.08271667324546551},
- {0.4407658760137806},
- {0.5923738171750825},
- {0.5246810330022212},
- {0.6229409679545942},
- {0.2400862172638655},
- {0.2925698275539658},
- {0.5355177197066979},
- {0.6208742057411996},
- {0.5741031091291464},
- {0.39664063443389347},
- {0.4575382332797716},
- {0.012133024264658298},
- {0.0012087963230208271},
- {0.017214361381837465},
- {0.008165994436768966},
- {0.002167780010482711},
- {0.011551280024163129},
- {0.015524513610390872},
- {0.013750469048076546},
- {0.016325595857020862},
- {0.006292009605276864},
- {0.007667462906296572},
- {0.014034469261045894},
- {0.01627143161616313},
- {0.015045687829259531},
- {0.010394876932724203},
- {0.011990838088859389},
- {0.49710734345959445},
- {0.049526112848133526},
- {0.7052969869025195},
- {0.33457246211832015},
- {0.08881704500952971},
- {0.47327245055429973},
- {0.6360615087405058},
- {0.5633763677307883},
- {0.6688829932136595},
- {0.25779262545549037},
- {0.31414691286215896},
- {0.5750122623215858},
- {0.6666638068594606},
- {0.6164433321963851},
- {0.4258929632793802},
- {0.4912817726384794},
- {0.18492200892183652},
- {0.018423522409120964},
- {0.26236775099085463},
- {0.1244596617588967},
- {0.033039597193153095},
- {0.1760555209560594},
- {0.2366124209221405},
- {0.2095738296176118},
- {0.2488218861904116},
- {0.09589785950997252},
- {0.11686143644302331},
- {0.21390233739695402},
- {0.24799635745061388},
- {0.22931453513217342},
- {0.15843053495687984},
- {0.18275491911008726},
- {0.05577672519219175},
- {0.0055569575113153654},
- {0.07913613977931556},
- {0.037539892584518515},
- {0.009965501369186123},
- {0.05310238877561052},
- {0.07136774068040642},
- {0.06321228051874367},
- {0.07505039583315147},
- {0.028924997016812788},
- {0.03524809331269166},
- {0.06451785788245641},
- {0.07480139740442784},
- {0.06916653070781172},
- {0.047786288186372435},
- {0.055123081131100954},
- {0.5904403609580917},
- {0.05882475149812384},
- {0.8377180764042094},
- {0.39738919148724094},
- {0.10549264420375695},
- {0.5621304135079922},
- {0.7554834820958914},
- {0.6691515430112785},
- {0.7944672738150825},
- {0.3061937684665199},
- {0.3731286995949996},
- {0.6829721028816019},
- {0.7918314302508183},
- {0.7321819489512866},
- {0.5058553213439462},
- {0.5835210261631799},
- {0.22262793027904057},
- {0.022180110881911293},
- {0.31586499473813184},
- {0.14983720467975462},
- {0.039776428902380874},
- {0.21195354989471688},
- {0.2848581077792357},
- {0.2523063003719711},
- {0.2995571043904933},
- {0.11545160094988742},
- {0.1406896879199637},
- {0.2575173984653246},
- {0.29856324889541963},
- {0.27607217030047987},
- {0.19073479839471047},
- {0.22001896706080915},
- {0.2035327225875636},
- {0.020277681912737346},
- {0.2887726722724284},
- {0.13698539161351406},
- {0.03636473132173936},
- {0.1937739034724886},
- {0.2604253031269717},
- {0.23066552420596037},
- {0.27386353972129673},
- {0.10554910445859622},
- {0.1286224742172017},
- {0.23542965681628342},
- {0.27295492904285484},
- {0.252392951690681},
- {0.1743751233765132},
- {0.201147534950631},
- {0.6533391915892975},
- {0.0650912744631179},
- {0.9269590749683096},
- {0.4397225363986026},
- {0.11673063604740926},
- {0.6220134228851213},
- {0.8359641381064582},
- {0.7404353717491716},
- {0.8791008215905836},
- {0.3388121855948051},
- {0.4128776063963315},
- {0.7557282175809449},
- {0.8761841850980546},
- {0.8101803234587196},
- {0.5597434195923066},
- {0.6456827492114293},
- {0.5420566041981346},
- {0.05400434514356543},
- {0.7690710964172887},
- {0.36482505249654723},
- {0.09684802778756728},
- {0.5160665212117214},
- {0.6935752328451471},
- {0.614317782256726},
- {0.7293644897377192},
- {0.28110265716298516},
- {0.3425525915998266},
- {0.6270058135072798},
- {0.7269446409161986},
- {0.6721831486243476},
- {0.4644029030439502},
- {0.5357042757154514},
- {0.620814492643931},
- {0.06185088396896555},
- {0.8808129609189138},
- {0.41783215648573185},
- {0.11091952163085704},
- {0.591048191379412},
- {0.7943479573062602},
- {0.7035748284591541},
- {0.8353371993665674},
- {0.3219453506071683},
- {0.392323627663389},
- {0.7181063619234779},
- {0.8325657596188133},
- {0.7698477191221359},
- {0.5318781293368674},
- {0.6135392052412096},
- {0.4992730373718596},
- {0.049741877918805986},
- {0.7083696781652223},
- {0.33603005785484363},
- {0.0892039846438225},
- {0.4753343055610575},
- {0.6388325692678333},
- {0.5658307687489212},
- {0.6717970435600878},
- {0.258915722764193},
- {0.31551552281269324},
- {0.5775173561858626},
- {0.6695681891162083},
- {0.6191289243312812},
- {0.4277484051874229},
- {0.49342208691508077},
- {0.07033182144255361},
- {0.0070070614956864175},
- {0.09978694219557636},
- {0.047336035113739704},
- {0.012566027504627333},
- {0.06695960927555746},
- {0.08999135709379168},
- {0.07970770623592056},
- {0.09463501166018819},
- {0.03647305786424449},
- {0.04444618425546691},
- {0.08135397775343409},
- {0.0943210363780589},
- {0.08721573507194211},
- {0.060256257005867585},
- {0.06950760709090037},
- {0.5644768051369842},
- {0.05623803856287326},
- {0.8008809265796646},
- {0.3799147145745488},
- {0.10085379439332726},
- {0.5374117368474498},
- {0.7222624510547672},
- {0.6397268041408497},
- {0.7595320004569575},
- {0.29272944670715423},
- {0.3567210342980812},
- {0.6529396296803258},
- {0.7570120633856121},
- {0.6999855610350593},
- {0.48361124092267216},
- {0.5578617356787122},
- {0.011301835426053267},
- {0.0011259861357233068},
- {0.016035068838429718},
- {0.007606572211617395},
- {0.0020192733801520685},
- {0.010759944342452445},
- {0.01446098631857496},
- {0.01280847502012122},
- {0.015207189368750774},
- {0.005860967184012154},
- {0.0071421932415275235},
- {0.013073019423720009},
- {0.01515673572069088},
- {0.014014963129462824},
- {0.009682762170840754},
- {0.011169389901863556},
- {0.24014546135911952},
- {0.023925358125806},
- {0.3407189061745763},
- {0.1616271803878334},
- {0.04290624657026586},
- {0.2286311648424911},
- {0.30727223501915923},
- {0.27215908098636216},
- {0.32312782563756115},
- {0.12453593733728331},
- {0.15175988911931698},
- {0.27778021555940285},
- {0.32205576838899574},
- {0.29779497398248844},
- {0.20574281088777047},
- {0.23733121125615234},
- {0.2916779347345779},
- {0.029059466734973703},
- {0.41383329218706005},
- {0.19631052740154598},
- {0.05211343706434977},
- {0.27769280168694815},
- {0.37320934738649697},
- {0.3305613115154895},
- {0.3924673666694702},
- {0.15125992720076112},
- {0.18432582811830003},
- {0.33738867737054434},
- {0.39116525817902},
- {0.3616983743684278},
- {0.24989286837484856},
- {0.2882597787002546},
- {0.4534468611027352},
- {0.0451762797493885},
- {0.643351398976385},
- {0.3051872694198035},
- {0.0810163253507944},
- {0.431705364995659},
- {0.5801968094041956},
- {0.5138955377104591},
- {0.6101356129783041},
- {0.23515093543921178},
- {0.28655567743396027},
- {0.5245094623441199},
- {0.6081113357276194},
- {0.5623016793250845},
- {0.3884871746628592},
- {0.4481329448274649},
- {0.5273651313881623},
- {0.052540654152343706},
- {0.7482268026397697},
- {0.3549371232698965},
- {0.09422313556059166},
- {0.502079463022965},
- {0.6747771191498287},
- {0.5976677997183557},
- {0.7095963723740493},
- {0.27348387341874836},
- {0.33326831751018765},
- {0.6100119446207203},
- {0.7072421092181037},
- {0.6539648290340073},
- {0.4518160946366708},
- {0.5211849713846758},
- {0.45778227212055045},
- {0.045608210715881684},
- {0.6495024896172289},
- {0.30810516865748244},
- {0.08179092343422707},
- {0.43583290530170626},
- {0.5857440782371413},
- {0.5188088992690283},
- {0.6159691270805625},
- {0.2373992164260367},
- {0.2892954397914358},
- {0.5295243037666958},
- {0.6139254956901792},
- {0.5676778525991777},
- {0.3922015053194159},
- {0.45241754942639456},
- {0.10983615723977824},
- {0.010942823496440152},
- {0.1558357802864837},
- {0.07392398048594609},
- {0.019624177855324908},
- {0.10456982376194254},
- {0.14053816103779063},
- {0.12447833677251562},
- {0.14779008715971736},
- {0.05695943082982433},
- {0.06941094347427114},
- {0.12704929446347596},
- {0.1472997566414679},
- {0.13620351349735874},
- {0.09410129843690655},
- {0.10854899397184822},
- {0.26305155329018054},
- {0.026207460188495922},
- {0.37321811954015516},
- {0.17704386588989862},
- {0.04699882622091999},
- {0.25043897436988444},
- {0.33658116313038444},
- {0.2981187676432091},
- {0.35394912718391563},
- {0.13641470287057303},
- {0.166235390558906},
- {0.30427606985630523},
- {0.3527748125712009},
- {0.32619992076784554},
- {0.22536743220552502},
- {0.2599688680845438},
- {0.4766413664876433},
- {0.04748711604312547},
- {0.676259813981523},
- {0.32079806832741636},
- {0.08516043518109429},
- {0.45378775936648896},
- {0.6098747698763559},
- {0.5401820860123229},
- {0.6413449893677091},
- {0.24717926798747755},
- {0.30121344171344905},
- {0.5513389292395134},
- {0.6392171672176787},
- {0.5910642763300148},
- {0.40835889202963555},
- {0.4710556352099228},
- {0.017866235702210926},
- {0.0017799882001360372},
- {0.025348654317523298},
- {0.012024667400957048},
- {0.0031921199342393415},
- {0.017009600168285115},
- {0.022860303686472207},
- {0.020247970800197704},
- {0.024039920896736736},
- {0.00926516952380112},
- {0.0112905650342167},
- {0.020666169481227983},
- {0.02396016245624516},
- {0.022155218616222515},
- {0.01530676254530315},
- {0.017656862369148457},
- {0.17731234123687442},
- {0.01766538180737614},
- {0.2515711378244079},
- {0.11933806118960852},
- {0.03167999507466663},
- {0.1688107153410351},
- {0.22687565727864728},
- {0.2009497225783627},
- {0.23858269466478402},
- {0.09195159672154193},
- {0.11205250806449477},
- {0.20510010928945235},
- {0.23779113699966192},
- {0.21987808450165386},
- {0.15191100962183862},
- {0.17523442865939284},
- {0.6052595420728107},
- {0.06030116589002702},
- {0.8587435630040138},
- {0.40736307334065164},
- {0.10814035378477091},
- {0.5762390567490292},
- {0.7744450018202387},
- {0.6859462585571245},
- {0.81440722914144},
- {0.31387877987688617},
- {0.3824936789291111},
- {0.7001136940703881},
- {0.8117052297962507},
- {0.7505586346047377},
- {0.5185515428771018},
- {0.5981665421928212},
- {0.20269602572774115},
- {0.020194322968950965},
- {0.2875855649364622},
- {0.13642226227712312},
- {0.0362152405857124},
- {0.192977323863619},
- {0.25935472818170263},
- {0.22971728788642018},
- {0.2727377219127815},
- {0.10511520565778013},
- {0.12809372375923134},
- {0.23446183575997873},
- {0.271832846416043},
- {0.25135539670966284},
- {0.17365828965903804},
- {0.2003206432905845},
- {0.2523512096442078},
- {0.02514139984177862},
- {0.3580364485557685},
- {0.16984212090212578},
- {0.045087020017037106},
- {0.2402516819757332},
- {0.3228898008661847},
- {0.28599196884199746},
- {0.339551275330587},
- {0.13086566055996493},
- {0.15947330995966863},
- {0.2918988058942224},
- {0.3384247291866282},
- {0.3129308440190206},
- {0.21619999357592162},
- {0.2493939211170552},
- {0.6355086611421396},
- {0.06331484352785492},
- {0.9016610793448024},
- {0.4277219000147907},
- {0.11354489549035443},
- {0.6050378160057684},
- {0.8131495202033441},
- {0.7202278660460306},
- {0.8551089439146673},
- {0.32956553229604824},
- {0.4016096052928139},
- {0.7351033489570769},
- {0.8522719064672483},
- {0.788069381529799},
- {0.5444672472546904},
- {0.6280611736696146},
- {0.11261638937419544},
- {0.01121981415498661},
- {0.15978037972379494},
- {0.07579518420625089},
- {0.020120915644191516},
- {0.10721675161902898},
- {0.14409553887445495},
- {0.12762919966348735},
- {0.15153102966713566},
- {0.058401218706702444},
- {0.0711679107642511},
- {0.13026523482409216},
- {0.15102828763798137},
- {0.1396511703943422},
- {0.09648324132692894},
- {0.11129664473443239},
- {0.6376054893084699},
- {0.06352374760009433},
- {0.904636063736449},
- {0.4291331464417009},
- {0.11391953103753852},
- {0.6070341071845793},
- {0.8158324652545352},
- {0.7226042208749125},
- {0.8579303319279461},
- {0.33065291683228426},
- {0.4029346955452951},
- {0.7375287846773183},
- {0.855083933821275},
- {0.7906695759523965},
- {0.5462636889548496},
- {0.6301334292337828},
- {0.2667715028313845},
- {0.026578073584558146},
- {0.3784959920909432},
- {0.17954753575784874},
- {0.04766346119399226},
- {0.2539805628385871},
- {0.3413409333263946},
- {0.30233462099608893},
- {0.35895450683976154},
- {0.13834381450291178},
- {0.1685862121264156},
- {0.30857899683888296},
- {0.35776358563016436},
- {0.33081288438818396},
- {0.22855447088881475},
- {0.26364522376259447},
- {0.45502028255486887},
- {0.045333037539071766},
- {0.6455837727763667},
- {0.30624624289126046},
- {0.08129744500386682},
- {0.4332033453337156},
- {0.5822100422318659},
- {0.5156787108505776},
- {0.6122527308691109},
- {0.2359668888795103},
- {0.28755000089009536},
- {0.5263294648861869},
- {0.6102214295511662},
- {0.5642528175966546},
- {0.3898351916124238},
- {0.44968792744898894},
- {0.009508102574829317},
- {0.0009472790279367519},
- {0.01349011674323069},
- {0.0063993206505362195},
- {0.0016987911875666777},
- {0.009052215914563084},
- {0.012165859443790316},
- {0.010775620925934865},
- {0.012793631383060167},
- {0.004930763462086308},
- {0.006008644029017763},
- {0.010998179053017122},
- {0.012751185316298128},
- {0.011790625327121567},
- {0.0081459950934873},
- {0.009396677697178928},
- {0.5943729432221253},
- {0.059216549196459245},
- {0.8432976327275302},
- {0.4000359713988065},
- {0.10619526978461752},
- {0.5658744395611033},
- {0.760515321277142},
- {0.6736083750031274},
- {0.7997587615197689},
- {0.30823314833085563},
- {0.37561389438054604},
- {0.6875209856413504},
- {0.7971053621237272},
- {0.7370585900769359},
- {0.5092245315071136},
- {0.5874075227340723},
- {0.0021675219841833784},
- {0.00021594719893370826},
- {0.00307528493514151},
- {0.0014588260996043084},
- {0.0003872662517688354},
- {0.002063595427791475},
- {0.0027733995919132005},
- {0.0024564727890106454},
- {0.002916510109359975},
- {0.0011240453201644255},
- {0.0013697652003151622},
- {0.0025072084252128167},
- {0.0029068338588015947},
- {0.00268785905522944},
- {0.001857008094856467},
- {0.0021421209254556864},
- {0.04745140511941896},
- {0.0047275174580837034},
- {0.06732415743871878},
- {0.03193663028852094},
- {0.008478035256784377},
- {0.04517624428321813},
- {0.060715281576941386},
- {0.05377711798392147},
- {0.06384825793878209},
- {0.024607607327131336},
- {0.029986908512544933},
- {0.054887822855654404},
- {0.06363642539976601},
- {0.058842627601603324},
- {0.04065363307134956},
- {0.04689532497954256},
- {0.6175552903978305},
- {0.06152617418473284},
- {0.8761887976388407},
- {0.4156385873615453},
- {0.11033720733517094},
- {0.5879452586745174},
- {0.7901777250109219},
- {0.6998811442936187},
- {0.8309517784257127},
- {0.3202551758089741},
- {0.3902639752815105},
- {0.7143363889356494},
- {0.8281948884069966},
- {0.765806110163182},
- {0.5290858324199514},
- {0.6103181973886437},
- {0.3238323238058403},
- {0.03226296377169686},
- {0.45945400977659206},
- {0.21795167445162383},
- {0.05785838905303099},
- {0.30830547863097657},
- {0.41435170726989856},
- {0.36700217918704653},
- {0.43573271828801996},
- {0.1679347248831088},
- {0.20464578958056084},
- {0.3745821894895981},
- {0.43428706618994983},
- {0.4015717719446579},
- {0.27744089844154},
- {0.3200373524353348},
- {0.6774642630805688},
- {0.0674948217630445},
- {0.9611877792018543},
- {0.45595964227485325},
- {0.1210410080197608},
- {0.6449817653461489},
- {0.8668327816159619},
- {0.7677765392592082},
- {0.9115623215923164},
- {0.35132309616746643},
- {0.42812344179038814},
- {0.7836340856381796},
- {0.908537985967695},
- {0.8400968790180404},
- {0.5804123924448059},
- {0.6695251004524649},
- {0.523553431940457},
- {0.05216089984077707},
- {0.7428187551208277},
- {0.3523717021674874},
- {0.09354210783918734},
- {0.49845052379660537},
- {0.6698999526113106},
- {0.593347965344587},
- {0.7044675385932642},
- {0.27150718162169574},
- {0.3308595146027079},
- {0.6056028890081812},
- {0.7021302916240877},
- {0.6492380899508107},
- {0.4485504499137106},
- {0.5174179410117158},
- {0.13426234723498587},
- {0.013376370813873679},
- {0.19049171211246102},
- {0.09036375075767766},
- {0.0239883499898933},
- {0.12782484694523305},
- {0.17179209334345338},
- {0.1521607646787948},
- {0.18065675728994451},
- {0.06962649707132519},
- {0.08484707066276989},
- {0.15530347126016786},
- {0.18005738338652758},
- {0.16649347431088607},
- {0.11502825229416674},
- {0.13268893492732775},
- {0.5236929620930783},
- {0.05217480103571083},
- {0.7430167208067516},
- {0.3524656113549425},
- {0.09356703737605417},
- {0.4985833638725489},
- {0.6700784849958323},
- {0.5935060961620189},
- {0.7046552834482874},
- {0.27157953992588835},
- {0.33094769066221263},
- {0.6057642858368066},
- {0.7023174135886735},
- {0.6494111158241062},
- {0.4486699913184968},
- {0.5175558360189374},
- {0.22350615554428307},
- {0.02226760724293823},
- {0.31711102266659985},
- {0.15042828423863178},
- {0.039933339424701265},
- {0.21278966673927482},
- {0.28598181937709016},
- {0.2533016012189439},
- {0.3007388007622328},
- {0.11590703577668476},
- {0.14124468224765444},
- {0.2585332561130524},
- {0.29974102469436903},
- {0.277161223029328},
- {0.191487211259984},
- {0.22088690045741022},
- {0.2533694189295745},
- {0.025242842615927026},
- {0.3594810861183669},
- {0.1705274151188356},
- {0.0452689411677048},
- {0.2412210710020729},
- {0.3241926255835921},
- {0.28714591487865715},
- {0.3409213272589575},
- {0.13139368906002905},
- {0.1601167671683661},
- {0.2930765853666013},
- {0.33979023562561594},
- {0.314193485444465},
- {0.21707233669353768},
- {0.25040019806953506},
- {0.2858320184756094},
- {0.028477046233342254},
- {0.40553909340407607},
- {0.19237599973496844},
- {0.05106896042499601},
- {0.272127180599232},
- {0.36572934862049117},
- {0.32393608034285093},
- {0.3846013916103166},
- {0.1482283202039618},
- {0.18063150219499982},
- {0.3306266096247371},
- {0.3833253804563076},
- {0.3544490827499616},
- {0.24488442375745859},
- {0.2824823703795191},
- {0.028801439377615087},
- {0.002869447324751466},
- {0.04086354522569754},
- {0.019384482269076474},
- {0.00514588804852126},
- {0.02742049171688194},
- {0.036852175340904215},
- {0.032640938653319566},
- {0.03875378876056939},
- {0.014936006823757644},
- {0.018201065394641114},
- {0.033315099912593765},
- {0.038625213389295907},
- {0.03571553608206219},
- {0.024675415731896026},
- {0.028463917055621894},
- {0.27396173352907766},
- {0.02729442626295508},
- {0.38869750714184526},
- {0.18438683901775213},
- {0.048948123454383555},
- {0.2608260422850693},
- {0.3505410166603853},
- {0.3104833762034077},
- {0.36862932475232507},
- {0.1420725633809489},
- {0.17313007736229627},
- {0.31689605526598447},
- {0.36740630491844123},
- {0.33972920765088177},
- {0.2347146467518209},
- {0.2707511925826456},
- {0.4398686927244474},
- {0.04382350572940724},
- {0.6240866639631919},
- {0.2960486371200573},
- {0.07859034470925236},
- {0.4187782314359161},
- {0.562823197088351},
- {0.4985072734209806},
- {0.5918655028567738},
- {0.22810949515238155},
- {0.2779749559168008},
- {0.5088033710539651},
- {0.5899018412585766},
- {0.5454639249238248},
- {0.3768541814218221},
- {0.43471389818123246},
- {0.5434951272265133},
- {0.05414766319101631},
- {0.771112076038399},
- {0.36579323411315545},
- {0.09710504544429625},
- {0.517436071124385},
- {0.6954158597033638},
- {0.6159480737607398},
- {0.7313000949982094},
- {0.28184865424619676},
- {0.3434616660168353},
- {0.628669776817886},
- {0.7288738243229045},
- {0.6739670046480457},
- {0.46563534678746454},
- {0.5371259407796702},
- {0.40226520176503483},
- {0.04007712225460546},
- {0.5707347486884872},
- {0.2707400338172432},
- {0.071871814007585},
- {0.3829777216468182},
- {0.5147085725344331},
- {0.45589088798745236},
- {0.5412681099211389},
- {0.20860887262434866},
- {0.25421143531473644},
- {0.4653067929159706},
- {0.5394723178084871},
- {0.4988333096769971},
- {0.34463767445393556},
- {0.39755108025268016},
- {0.6729709410944105},
- {0.06704715834652615},
- {0.9548126441335107},
- {0.4529354628500695},
- {0.1202381963406785},
- {0.6407038854566285},
- {0.8610834616765651},
- {0.762684215734093},
- {0.905516330320778},
- {0.3489929248532243},
- {0.4252838876196056},
- {0.7784365859943019},
- {0.9025120537819211},
- {0.8345248865415222},
- {0.5765627727583711},
- {0.665084435434257},
- {0.6625404975175908},
- {0.0660079877681023},
- {0.9400139079579596},
- {0.4459153710441508},
- {0.11837461257186008},
- {0.63077355218572},
- {0.8477374434259941},
- {0.750863297187137},
- {0.8914816426180076},
- {0.3435838487860303},
- {0.4186923703295233},
- {0.7663715198933175},
- {0.8885239296601527},
- {0.821590502289555},
- {0.5676265689752316},
- {0.6547762255933736},
- {0.6092288200200796},
- {0.060696619528216984},
- {0.8643751832430233},
- {0.41003455086582247},
- {0.10884953570037978},
- {0.5800180190310212},
- {0.7795237940629356},
- {0.6904446781074848},
- {0.8197480927380004},
- {0.31593718958789097},
- {0.3850020635463014},
- {0.7047050233321087},
- {0.8170283737441828},
- {0.7554807806088571},
- {0.5219521917898234},
- {0.6020893044124614},
- {0.4024714005938775},
- {0.040097665556974214},
- {0.5710273040381496},
- {0.2708788136014477},
- {0.07190865508608281},
- {0.383174033824282},
- {0.5149724091884271},
- {0.45612457503463066},
- {0.5415455608412432},
- {0.20871580433266593},
- {0.25434174263441095},
- {0.46554530650186077},
- {0.5397488482158828},
- {0.49908900876255513},
- {0.34481433374371667},
- {0.3977548626499483},
- {0.05543290302838635},
- {0.005522702987602622},
- {0.0786483241407965},
- {0.037308486974867584},
- {0.009904071440620884},
- {0.052775051913341274},
- {0.07092781146365715},
- {0.06282262366828965},
- {0.07458776577731918},
- {0.028746695852158225},
- {0.035030814946652326},
- {0.064120153115373},
- {0.07434030223932736},
- {0.06874017031879766},
- {0.047491721143437346},
- {0.05478328819838914},
- {0.00576374487808543},
- {0.0005742338813047787},
- {0.008177613847941283},
- {0.0038792231502000362},
- {0.0010297952645351928},
- {0.005487389592431168},
- {0.007374858391019458},
- {0.0065321055837644},
- {0.0077554093233528},
- {0.0029889941159118084},
- {0.003642397731191013},
- {0.006667018754394522},
- {0.007729678816348993},
- {0.0071473941097907456},
- {0.0049380449072237015},
- {0.005696199901283342},
- {0.21845553622933375},
- {0.021764421069094323},
- {0.3099451929284299},
- {0.14702902216443897},
- {0.03903095669203034},
- {0.20798121035364261},
- {0.2795194233095058},
- {0.24757768745688863},
- {0.29394293783762765},
- {0.11328785818756346},
- {0.13805294411159874},
- {0.2526911214581855},
- {0.29296770874198513},
- {0.2708981479789876},
- {0.1871601312947799},
- {0.2158954690440215},
- {0.44865203047266516},
- {0.04469857744626041},
- {0.6365484827841579},
- {0.3019601630202513},
- {0.08015964380406802},
- {0.4271404329500102},
- {0.5740617014746033},
- {0.508461511639845},
- {0.603683926625265},
- {0.23266440613522327},
- {0.28352558491983537},
- {0.5189632026794414},
- {0.6016810544550826},
- {0.5563557977970681},
- {0.3843792397221853},
- {0.4433943045268644},
- {0.10991917338686126},
- {0.010951094279647734},
- {0.1559535637776597},
- {0.07397985356263782},
- {0.019639010162610243},
- {0.1046488595192744},
- {0.14064438231264842},
- {0.12457241974276737},
- {0.14790178957103062},
- {0.057002481794154874},
- {0.06946340551625657},
- {0.12714532060988373},
- {0.14741108845213882},
- {0.13630645856748747},
- {0.09417242189413647},
- {0.10863103725773639},
- {0.45559789889854896},
- {0.04539058465157455},
- {0.6464032961089894},
- {0.30663500102329666},
- {0.08140064640990086},
- {0.4337532666053492},
- {0.5829491170571892},
- {0.5163333288157432},
- {0.6130299427811319},
- {0.23626643229946265},
- {0.28791502545385056},
- {0.5269976032367933},
- {0.6109960628685943},
- {0.5649690969844247},
- {0.39033006005378795},
- {0.45025877474175513},
- {0.4467307479712311},
- {0.04450716274432309},
- {0.6338225629660771},
- {0.30066706561304735},
- {0.0798163726038916},
- {0.4253112705173399},
- {0.5716033715733106},
- {0.5062841043428421},
- {0.6010987441545645},
- {0.2316680570230991},
- {0.28231143072456416},
- {0.5167408235248308},
- {0.5991044489727646},
- {0.5539732906728883},
- {0.3827331954450319},
- {0.4414955374185878},
- {0.5268821018464448},
- {0.052492530591292295},
- {0.7475414792687906},
- {0.35461202571264944},
- {0.09413683376458702},
- {0.5016195933833258},
- {0.6741590705470203},
- {0.5971203778540445},
- {0.7089464317728381},
- {0.2732333813361625},
- {0.3329630670620737},
- {0.6094532163838405},
- {0.7065943249571313},
- {0.6533658430319632},
- {0.4514022627237446},
- {0.5207076024368743},
- {0.46614406157768656},
- {0.04644128416312621},
- {0.6613662148001798},
- {0.313732976259195},
- {0.08328490544906937},
- {0.4437937705744993},
- {0.5964432008468815},
- {0.528285392895749},
- {0.6272203363702644},
- {0.24173551860708942},
- {0.29457967141368735},
- {0.5391965235318328},
- {0.6251393762835661},
- {0.5780469799594952},
- {0.3993654053041431},
- {0.46068134757981183},
- {0.25795598267257497},
- {0.025699795578923167},
- {0.36598851279539313},
- {0.17361434985103802},
- {0.04608841214064621},
- {0.24558772196958129},
- {0.3300612507260097},
- {0.29234391015250366},
- {0.3470927800152832},
- {0.13377221419083546},
- {0.16301524545372306},
- {0.2983819392883328},
- {0.34594121304637265},
- {0.3198811033689751},
- {0.2210018405511588},
- {0.2549330121500895},
- {0.2655333441965695},
- {0.026454717562808445},
- {0.3767392899099517},
- {0.17871420712492184},
- {0.04744224219040246},
- {0.25280177041279894},
- {0.33975667781361213},
- {0.30093140431958193},
- {0.35728850197255385},
- {0.1377017234748896},
- {0.1678037579585617},
- {0.3071467983266599},
- {0.3561031081501153},
- {0.32927749239553855},
- {0.227493687826707},
- {0.2624215750337581},
- {0.351760228389795},
- {0.03504538204057779},
- {0.49907818192516806},
- {0.2367482340305485},
- {0.06284820461518345},
- {0.33489431908001976},
- {0.4500861725908177},
- {0.39865313274838593},
- {0.47331112194284236},
- {0.1824177292902913},
- {0.22229482479034024},
- {0.4068868573002969},
- {0.47174079410708797},
- {0.4362040717678349},
- {0.30136791983427674},
- {0.34763797159858556},
- {0.40355039695710476},
- {0.040205164463097826},
- {0.5725581864398593},
- {0.27160501987180635},
- {0.07210143692650169},
- {0.38420129535980846},
- {0.5163530125203826},
- {0.45734741163100684},
- {0.5429974048475685},
- {0.2092753561256398},
- {0.2550236142280558},
- {0.46679339938968295},
- {0.5411958753671827},
- {0.5004270298606677},
- {0.34573875573133894},
- {0.39882121432020856},
- {0.11807334242305655},
- {0.011763482793281085},
- {0.16752271665296786},
- {0.0794679245936999},
- {0.02109589710630903},
- {0.11241205918383099},
- {0.151077849305093},
- {0.13381361521878624},
- {0.158873635116788},
- {0.061231115049940825},
- {0.07461643144391553},
- {0.13657738241010614},
- {0.1583465321605606},
- {0.14641812398160617},
- {0.10115844465078572},
- {0.11668964808133898},
- {0.19741250023071016},
- {0.019667932676301392},
- {0.2800892873974009},
- {0.13286624533739297},
- {0.03527124503213044},
- {0.18794712848942968},
- {0.2525943227213403},
- {0.22372941938579669},
- {0.26562847197778827},
- {0.1023752463160784},
- {0.12475480059553501},
- {0.22835029468328066},
- {0.2647471831929327},
- {0.2448035038318239},
- {0.1691316690808096},
- {0.1950990351085421},
- {0.25631747634597274},
- {0.025536553473769513},
- {0.3636637964330664},
- {0.17251157174264678},
- {0.04579566392022073},
- {0.24402777739293716},
- {0.327964740143554},
- {0.29048697571987014},
- {0.34488808714450425},
- {0.13292250868292527},
- {0.1619797916207039},
- {0.2964866519986081},
- {0.3437438347947179},
- {0.31784925589561813},
- {0.2195980626267931},
- {0.2533137073797951},
- {0.2825078857111455},
- {0.028145867511923103},
- {0.4008228065624376},
- {0.1901387298614743},
- {0.05047504514041313},
- {0.2689624306109158},
- {0.36147603607293566},
- {0.3201688098180074},
- {0.3801286033834113},
- {0.14650447338498307},
- {0.17853081698155523},
- {0.32678153043550345},
- {0.37886743182122795},
- {0.35032695600017666},
- {0.24203649810916913},
- {0.279197192925398},
- {0.42453189181802237},
- {0.04229552159798251},
- {0.6023267772700182},
- {0.28572637713377297},
- {0.07585015317048291},
- {0.4041767868100289},
- {0.5431993696552198},
- {0.4811259345593585},
- {0.5712290640039139},
- {0.22015605365976598},
- {0.26828286683116337},
- {0.4910630405156857},
- {0.5693338689446573},
- {0.5264453592551049},
- {0.3637144930402238},
- {0.41955682831484387},
- {0.4741385778954384},
- {0.04723776669859575},
- {0.6727088520491338},
- {0.3191135948379924},
- {0.0847132676025665},
- {0.45140497241747973},
- {0.6066723881192541},
- {0.537345652463662},
- {0.6379773611341683},
- {0.24588135828923346},
- {0.2996318048293186},
- {0.5484439123996879},
- {0.6358607119317201},
- {0.5879606662951585},
- {0.4062146467996662},
- {0.46858217664549956},
- {0.6557902089131478},
- {0.06533546590822699},
- {0.9304365837118471},
- {0.4413721658227591},
- {0.11716855377048396},
- {0.6243469208518515},
- {0.839100277206934},
- {0.7432131324387363},
- {0.8823987889724086},
- {0.34008324746758867},
- {0.4144265264350108},
- {0.7585633497408685},
- {0.8794712106495678},
- {0.8132197339728958},
- {0.5618433101789934},
- {0.648105043211853},
- {0.42372696859957965},
- {0.042215328217870204},
- {0.6011847504459833},
- {0.2851846326865146},
- {0.07570633935911551},
- {0.403410457386188},
- {0.5421694498934639},
- {0.48021370760259596},
- {0.5701459992318021},
- {0.2197386322064269},
- {0.26777419572120736},
- {0.4901319725543661},
- {0.568254397510375},
- {0.5254472055213744},
- {0.36302488115010534},
- {0.41876133794279996},
- {0.39710952688864737},
- {0.039563469541372104},
- {0.5634198658898173},
- {0.2672700652883741},
- {0.07095066123530087},
- {0.37806924681716114},
- {0.508111755199915},
- {0.45004791378223197},
- {0.5343308894420479},
- {0.2059352147517269},
- {0.2509533073320229},
- {0.4593431387606442},
- {0.5325581132906022},
- {0.4924399593426347},
- {0.3402205889296535},
- {0.39245582441760885},
- {0.36382815393048784},
- {0.03624769266832214},
- {0.516200181094964},
- {0.24487041450913635},
- {0.06500435358385483},
- {0.34638362168014275},
- {0.4655273907256391},
- {0.41232982480818403},
- {0.4895491241846949},
- {0.18867597964580923},
- {0.22992114856756526},
- {0.4208460257937438},
- {0.4879249227217737},
- {0.4511690332210894},
- {0.311707023926748},
- {0.3595644738514791},
- {0.1064586027409559},
- {0.010606322441969221},
- {0.15104369857121513},
- {0.07165075571975099},
- {0.019020717830260065},
- {0.10135421346052627},
- {0.13621649402031508},
- {0.12065052290013015},
- {0.14324541729587703},
- {0.05520788027776295},
- {0.06727649840362619},
- {0.12314242147309508},
- {0.14277016485473296},
- {0.13201514054869362},
- {0.09120760412104705},
- {0.105211020829435},
- {0.6084485609732496},
- {0.060618883405199483},
- {0.8632681499996544},
- {0.4095094063596657},
- {0.10871012858078445},
- {0.5792751712014349},
- {0.7785254327370272},
- {0.6895604032854052},
- {0.8186982148522836},
- {0.31553255861459284},
- {0.38450897895598224},
- {0.7038024848248476},
- {0.8159819790905128},
- {0.7545132119476162},
- {0.5212837107425162},
- {0.6013181891740985},
- {0.6048070013412736},
- {0.06025607988670528},
- {0.8581014972236484},
- {0.40705849593146376},
- {0.10805949935554071},
- {0.5758082140672461},
- {0.7738659644266956},
- {0.6854333899444638},
- {0.8137983127714766},
- {0.31364409884703737},
- {0.38220769588012343},
- {0.6995902327430562},
- {0.8110983336583948},
- {0.7499974565811708},
- {0.5181638320221029},
- {0.5977193047586818},
- {0.6729823580254686},
- {0.06704829579947953},
- {0.9548288425002839},
- {0.4529431468860916},
- {0.12024023617793499},
- {0.6407147549780926},
- {0.8610980699306768},
- {0.7626971546480616},
- {0.9055316923771225},
- {0.3489988455073262},
- {0.425291102547515},
- {0.7784497921467414},
- {0.9025273648708078},
- {0.8345390442302338},
- {0.5765725541278558},
- {0.6650957185709921},
- {0.08446699303469926},
- {0.00841532897073175},
- {0.11984195458768508},
- {0.05684955211217347},
- {0.01509152665090794},
- {0.08041703931845935},
- {0.108077669210275},
- {0.09572722743915484},
- {0.11365459768831446},
- {0.04380335190223485},
- {0.05337890387201061},
- {0.09770436384698437},
- {0.11327752018022881},
- {0.10474420732662364},
- {0.0723664585449256},
- {0.08347712946409548},
- {0.17364113817751767},
- {0.01729962495546415},
- {0.24636242688875443},
- {0.11686719958865709},
- {0.031024069525281715},
- {0.1653155360980726},
- {0.22217825944787672},
- {0.19678911406594657},
- {0.2336429058579078},
- {0.09004776430445206},
- {0.10973249182904607},
- {0.2008535681663393},
- {0.23286773717564827},
- {0.21532556948280587},
- {0.14876573411882876},
- {0.17160624820612386},
- {0.46416098617075074},
- {0.04624371312000554},
- {0.658552623072529},
- {0.3123982898374509},
- {0.08293059385019148},
- {0.4419057780315954},
- {0.5939058053489525},
- {0.5260379551252254},
- {0.6245520084298074},
- {0.24070712459449572},
- {0.2933264672008383},
- {0.5369026675043587},
- {0.6224799011873494},
- {0.5755878458752135},
- {0.39766642042174616},
- {0.45872151171334696},
- {0.2846693148627759},
- {0.028361207690428426},
- {0.40388944697341783},
- {0.1915934552491995},
- {0.05086122279956669},
- {0.2710202253402644},
- {0.3642416397303951},
- {0.322618377543317},
- {0.3830369152793899},
- {0.14762535905095825},
- {0.17989673181723131},
- {0.3292816911808212},
- {0.38176609466626815},
- {0.35300725957256956},
- {0.24388828621573763},
- {0.2813332924198361},
- {0.29994516032846613},
- {0.02988311891611909},
- {0.42556284995386595},
- {0.2018746898671113},
- {0.05359052356757095},
- {0.285563637166615},
- {0.38378747312439215},
- {0.3399306350380142},
- {0.40359133551355947},
- {0.1555471899401306},
- {0.18955030012102775},
- {0.3469515135555442},
- {0.40225232047874526},
- {0.37195023678842015},
- {0.25697575148370844},
- {0.2964301211786045},
- {0.48064059375304796},
- {0.047885553490203465},
- {0.6819339263786527},
- {0.3234897029016417},
- {0.08587496807365384},
- {0.4575952349814121},
- {0.6149918830345047},
- {0.5447144474029905},
- {0.6467261512817716},
- {0.24925320897850547},
- {0.303740752797847},
- {0.5559649013714367},
- {0.644580475783382},
- {0.5960235613096724},
- {0.41178519979454853},
- {0.4750079957734553},
- {0.03396156145458415},
- {0.003383543106389999},
- {0.04818473772228609},
- {0.02285744393588188},
- {0.006067835392077414},
- {0.03233320051641508},
- {0.0434546829818498},
- {0.03848895291224908},
- {0.04569699317225697},
- {0.017611970949805232},
- {0.021462003785110623},
- {0.03928389821817485},
- {0.04554538198658671},
- {0.04211440121555521},
- {0.029096311361699434},
- {0.03356356797480082},
- {0.603507997878724},
- {0.06012666197944079},
- {0.8562584682678979},
- {0.40618421637699004},
- {0.10782740934416032},
- {0.5745714941513406},
- {0.7722038564069301},
- {0.683961217259772},
- {0.812050438120947},
- {0.3129704545778622},
- {0.38138679083229765},
- {0.6980876540151583},
- {0.8093562580184733},
- {0.748386613302502},
- {0.5170509206132204},
- {0.5964355242389584},
- {0.4653742668942383},
- {0.046364590590070094},
- {0.6602740284184797},
- {0.3132148746741843},
- {0.08314736797361769},
- {0.44306088537162996},
- {0.5954582289404781},
- {0.5274129774338463},
- {0.6261845388130579},
- {0.24133631430017508},
- {0.294093199776274},
- {0.5383060893262703},
- {0.6241070152434007},
- {0.5770923877451267},
- {0.3987058895211558},
- {0.4599205740735905},
- {0.23209466433928638},
- {0.02312326842230903},
- {0.3292964177423296},
- {0.15620868272051955},
- {0.04146782887098834},
- {0.22096638079811423},
- {0.29697103515483886},
- {0.26303503797624295},
- {0.312295072351511},
- {0.1203609113030507},
- {0.14667218912225183},
- {0.26846772587528617},
- {0.3112589554669774},
- {0.28781149615413076},
- {0.19884535132566641},
- {0.22937476103851903},
- {0.5410254209720373},
- {0.05390160979375673},
- {0.7676080513991859},
- {0.36413102631610605},
- {0.09666378861224557},
- {0.5150847803084606},
- {0.6922558076400904},
- {0.6131491327325798},
- {0.7279769807179901},
- {0.28056790056628866},
- {0.34190093551118533},
- {0.6258130268636954},
- {0.7255617353041122},
- {0.6709044187235246},
- {0.46351944460056815},
- {0.5346851768630657},
- {0.567720587349774},
- {0.056561212070645954},
- {0.8054832118827274},
- {0.38209790542012306},
- {0.10143335362652915},
- {0.540499988866073},
- {0.7264129530246912},
- {0.6434030126394672},
- {0.7638966729655632},
- {0.2944116249007437},
- {0.3587709419921685},
- {0.6566917660613215},
- {0.7613622550032849},
- {0.7040080482151024},
- {0.48639032684247274},
- {0.5610675042044031},
- {0.4147366329244676},
- {0.04131963358562144},
- {0.5884292425132904},
- {0.2791337891782314},
- {0.07410005641276006},
- {0.39485118291107285},
- {0.5306660863869055},
- {0.47002487671131216},
- {0.5580490493164902},
- {0.2150763751146612},
- {0.26209275440860175},
- {0.47973270301310494},
- {0.5561975822470901},
- {0.5142986426324003},
- {0.35532247893873864},
- {0.4098763594664299},
- {0.6781573000091853},
- {0.06756386806780376},
- {0.9621710615130018},
- {0.4564260829231294},
- {0.12116483136071934},
- {0.6456415731117077},
- {0.8677195400198126},
- {0.7685619644449034},
- {0.9124948377205121},
- {0.3516824950210868},
- {0.4285614063758822},
- {0.7844357328828627},
- {0.9094674082407803},
- {0.8409562869492093},
- {0.5810061466008728},
- {0.67021001572333},
- {0.3573673876638567},
- {0.035604015516060156},
- {0.5070336317754068},
- {0.24052206901507409},
- {0.06385002308391509},
- {0.34023263090582195},
- {0.45726067571279355},
- {0.4050077784132928},
- {0.48085583744142757},
- {0.18532552039341138},
- {0.2258382682720117},
- {0.4133727509041554},
- {0.47926047812804456},
- {0.4431572902075448},
- {0.3061718112074962},
- {0.3531794209130458},
- {0.2735828504992278},
- {0.027256678673949465},
- {0.3881599470698458},
- {0.18413183608967326},
- {0.04888042928016089},
- {0.2604653256262436},
- {0.35005622617242893},
- {0.3100539845479433},
- {0.3681195185335714},
- {0.14187608016200112},
- {0.17289064228709733},
- {0.31645779501693444},
- {0.36689819010912},
- {0.33925936965611825},
- {0.23439004157661666},
- {0.270376749660053},
- {0.2748630375189863},
- {0.02738422192520386},
- {0.38997627921538114},
- {0.18499345145063664},
- {0.04910915740025502},
- {0.26168413129463763},
- {0.3516942580743329},
- {0.3115048323833188},
- {0.36984207471165953},
- {0.14253996649810066},
- {0.1736996562866582},
- {0.31793860845514077},
- {0.3686150312769544},
- {0.3408468794016036},
- {0.23548683214020452},
- {0.27164193424573757},
- {0.6749961048550496},
- {0.06724892259375562},
- {0.957685950909513},
- {0.4542984763611441},
- {0.12060002777054345},
- {0.6426319483355656},
- {0.8636747102951714},
- {0.7649793526266374},
- {0.9082412902631053},
- {0.3500431452728205},
- {0.42656368956141055},
- {0.7807791263146129},
- {0.9052279729892004},
- {0.8370362127435526},
- {0.5782978165200304},
- {0.6670858664235597},
- {0.26398119920671553},
- {0.026300079517453518},
- {0.37453710320121963},
- {0.17766955353520422},
- {0.04716492395473576},
- {0.2513240463907569},
- {0.3377706687614027},
- {0.2991723439917062},
- {0.3552000126344367},
- {0.1368968036979309},
- {0.16682288015964677},
- {0.30535140661939664},
- {0.35402154789688606},
- {0.3273527382308975},
- {0.22616389932556033},
- {0.2608876195369423},
- {0.4631287893105037},
- {0.046140876783237084},
- {0.6570881399080761},
- {0.31170358144203625},
- {0.08274617357114825},
- {0.4409230720950792},
- {0.592585083173181},
- {0.5248681568400864},
- {0.6231631355142258},
- {0.24017184234189787},
- {0.29267417054624467},
- {0.5357087083734368},
- {0.6210956362044754},
- {0.5743078590064115},
- {0.39678209355495947},
- {0.4577014111055287},
- {0.03363842686337631},
- {0.0033513496567460672},
- {0.04772627365704664},
- {0.022639961862445577},
- {0.006010101665329971},
- {0.03202555931607496},
- {0.043041224041212335},
- {0.03812274147989344},
- {0.04526219928835704},
- {0.01744439805888147},
- {0.021257798927543134},
- {0.03891012310748815},
- {0.04511203063996734},
- {0.04171369467445727},
- {0.02881946824039325},
- {0.03324422017827746},
- {0.38938188939947577},
- {0.038793575772202125},
- {0.5524558769069615},
- {0.2620690664797131},
- {0.06956998171864659},
- {0.37071212771680173},
- {0.49822404618689836},
- {0.4412901104685828},
- {0.5239329635971899},
- {0.20192777454165536},
- {0.24606982795300933},
- {0.4504044530350915},
- {0.5221946851611609},
- {0.4828572189818139},
- {0.33359999385554423},
- {0.3848187466436886},
- {0.3849863908306615},
- {0.03835565836662149},
- {0.5462195339172486},
- {0.2591107259970095},
- {0.06878464792834536},
- {0.3665273808880924},
- {0.49259989380184316},
- {0.4363086511305842},
- {0.5180185986656369},
- {0.199648333026359},
- {0.24329209327648413},
- {0.44532010735132954},
- {0.5162999426121218},
- {0.47740653349089524},
- {0.3298341836433385},
- {0.38047475865612734},
- {0.11453105404219359},
- {0.011410569531388163},
- {0.1624969101453126},
- {0.07708382755568306},
- {0.020463004451032028},
- {0.10903961352468272},
- {0.1465454010892907},
- {0.12979910690841412},
- {0.1541073075092978},
- {0.05939413590682872},
- {0.07237788282065215},
- {0.1324799590216282},
- {0.15359601803508968},
- {0.14202547100266827},
- {0.09812361582525164},
- {0.11318887156326188},
- {0.3561777631173141},
- {0.03548549487798439},
- {0.5053457898650812},
- {0.23972140570005812},
- {0.06363747555613289},
- {0.3391000454958711},
- {0.4557385208022614},
- {0.4036595658696392},
- {0.47925513763692645},
- {0.18470859843642476},
- {0.22508648521413022},
- {0.41199669257224636},
- {0.4776650890448495},
- {0.44168208343544263},
- {0.30515260935907673},
- {0.35200373750444375},
- {0.13289530899340077},
- {0.01324017469625193},
- {0.18855215526330968},
- {0.08944368116644218},
- {0.023744104358381153},
- {0.12652335432576423},
- {0.1700429330908665},
- {0.15061148754735387},
- {0.17881733841412317},
- {0.06891757095701016},
- {0.08398317104630128},
- {0.1537221955813509},
- {0.17822406724214102},
- {0.16479826376940046},
- {0.11385705260201769},
- {0.13133791692401975},
- {0.07584244558292584},
- {0.007556077310138788},
- {0.10760542778685335},
- {0.05104489822089444},
- {0.01355059825930544},
- {0.07220601455464107},
- {0.09704234105317854},
- {0.0859529477375377},
- {0.10204983426939639},
- {0.03933078725355179},
- {0.047928622373547815},
- {0.08772820757612616},
- {0.10171125846173407},
- {0.0940492440761176},
- {0.0649774426321523},
- {0.07495365256105045},
- {0.046957594466315124},
- {0.004678319789907999},
- {0.06662353780330835},
- {0.031604276626474026},
- {0.008389807223986318},
- {0.044706110456029416},
- {0.06008343826748745},
- {0.05321747778597895},
- {0.06318381080865085},
- {0.024351524317261505},
- {0.029674844942670055},
- {0.05431662392943532},
- {0.06297418273890554},
- {0.0582302723659013},
- {0.040230564522642},
- {0.04640730126354541},
- {0.6172102176512919},
- {0.061491795067202724},
- {0.8756992076708028},
- {0.4154063400613629},
- {0.11027555396781655},
- {0.5876167311914244},
- {0.7897361956417095},
- {0.6994900701461422},
- {0.8304874656477624},
- {0.32007622611033515},
- {0.3900459066098962},
- {0.7139372375988944},
- {0.8277321161026291},
- {0.7653781989755379},
- {0.5287901939497017},
- {0.609977168528702},
- {0.2709004165742186},
- {0.02698943151490912},
- {0.3843541039460902},
- {0.1823264543455329},
- {0.04840116487623039},
- {0.25791150683068137},
- {0.3466239836359097},
- {0.3070139572757001},
- {0.36451016844758966},
- {0.14048500901160035},
- {0.17119547856122316},
- {0.3133549794579985},
- {0.3633008149433255},
- {0.33593298848536063},
- {0.23209188656411445},
- {0.26772575101558965},
- {0.27614324617107505},
- {0.027511767331657225},
- {0.39179264205291414},
- {0.18585508137099474},
- {0.0493378893853487},
- {0.26290295755815296},
- {0.3533323176553546},
- {0.3129557047348151},
- {0.3715646599971387},
- {0.14320386405241153},
- {0.17450868395676705},
- {0.31941944691582036},
- {0.37033190145560885},
- {0.3424344159724939},
- {0.2365836412371281},
- {0.27290714021024454},
- {0.31752918694590004},
- {0.031634991017864454},
- {0.4505111054042461},
- {0.21370941964278825},
- {0.056732221842757134},
- {0.30230455937856254},
- {0.406286683098198},
- {0.35985877566226676},
- {0.42725152985863424},
- {0.16466600994435762},
- {0.20066252316546943},
- {0.3672912471343049},
- {0.42583401622098366},
- {0.3937554989799692},
- {0.2720407335263467},
- {0.31380808165413165},
- {0.54834419832936},
- {0.05463076939696543},
- {0.777991948732116},
- {0.3690568464480195},
- {0.09797141801364646},
- {0.5220526429653578},
- {0.701620369699538},
- {0.6214435710627468},
- {0.7378247646420034},
- {0.2843633118690826},
- {0.34652603578978397},
- {0.6342787773319425},
- {0.7353768467459051},
- {0.6799801476603637},
- {0.4697897518436667},
- {0.5419181859122352},
- {0.10360043856512456},
- {0.01032156752258787},
- {0.1469885289829783},
- {0.06972710072243955},
- {0.01851005609977193},
- {0.09863309018327146},
- {0.13255940015150341},
- {0.11741133890306456},
- {0.1393996132976476},
- {0.05372567797967867},
- {0.06547028197149335},
- {0.11983633583494384},
- {0.13893712027158867},
- {0.12847084318174676},
- {0.08875889354294086},
- {0.10238635130630544},
- {0.4252330658671543},
- {0.04236537859273502},
- {0.6033216045455625},
- {0.28619829437876654},
- {0.0759754303523645},
- {0.4048443415441599},
- {0.5440965397120463},
- {0.481920581619283},
- {0.5721725290380112},
- {0.2205196723055277},
- {0.2687259736687749},
- {0.49187410010186405},
- {0.5702742037979149},
- {0.5273148577104856},
- {0.36431521861285593},
- {0.42024978534780233},
- {0.49715969411404565},
- {0.049531328470984674},
- {0.705371262125633},
- {0.3346076961328317},
- {0.08882639838258655},
- {0.4733222911427485},
- {0.636128492736401},
- {0.5634356972135268},
- {0.6689534336585788},
- {0.25781977374213877},
- {0.3141799958505688},
- {0.5750728171869404},
- {0.6667340136006146},
- {0.616508250191054},
- {0.4259378143073265},
- {0.49133350979878476},
- {0.12522741989864802},
- {0.012476233576471301},
- {0.1776729374332247},
- {0.08428289533731438},
- {0.022374099952256157},
- {0.1192231188530867},
- {0.16023167367047586},
- {0.14192139764383296},
- {0.16849980704628195},
- {0.0649411153937491},
- {0.07913744965638626},
- {0.14485262180897476},
- {0.1679407668609639},
- {0.1552896150506235},
- {0.10728764651371811},
- {0.12375988735670643},
- {0.11599182386302336},
- {0.011556103995812028},
- {0.16456945356424343},
- {0.07806698212375249},
- {0.02072399689186437},
- {0.11043034355894153},
- {0.14841449328513975},
- {0.1314546109088629},
- {0.15607284695064427},
- {0.060151669852469294},
- {0.07330101609489069},
- {0.13416965556394994},
- {0.15555503630853215},
- {0.14383691440170832},
- {0.09937511934023209},
- {0.11463252271111979},
- {0.6159503190704333},
- {0.06136627312488227},
- {0.8739116608067831},
- {0.41455837960420355},
- {0.11005045073722494},
- {0.5864172411885951},
- {0.7881241233141839},
- {0.6980622153869396},
- {0.8287922085870933},
- {0.3194228610630461},
- {0.38924971388632534},
- {0.7124798921325541},
- {0.8260424834805747},
- {0.7638158481279144},
- {0.5277107853529607},
- {0.6087320346229317},
- {0.33517572214960156},
- {0.03339309076307194},
- {0.4755480481736332},
- {0.22558622011383161},
- {0.05988508838570894},
- {0.31910499306663853},
- {0.42886587440041046},
- {0.3798577578476967},
- {0.4509958326580184},
- {0.17381724599067186},
- {0.21181424850184405},
- {0.3877032854256738},
- {0.4494995413667319},
- {0.4156382756192863},
- {0.2871592693283213},
- {0.3312478181815935},
- {0.5606408856115769},
- {0.05585587123867013},
- {0.7954385155614693},
- {0.3773329924234103},
- {0.10016843932540574},
- {0.5337597388276978},
- {0.7173542943098729},
- {0.6353795209281501},
- {0.754370577340524},
- {0.29074019473069235},
- {0.35429692551604647},
- {0.6485025583044787},
- {0.7518677645792067},
- {0.695228787582825},
- {0.4803248458310057},
- {0.5540707690616724},
- {0.6142022393222347},
- {0.061192114372218706},
- {0.8714314814340759},
- {0.41338185434657276},
- {0.10973812528132747},
- {0.5847529769264005},
- {0.7858874107476388},
- {0.6960811003782776},
- {0.8264400791532092},
- {0.31851633237518273},
- {0.3881450151455833},
- {0.7104578594590177},
- {0.8236981578234288},
- {0.7616481229492335},
- {0.526213131226937},
- {0.6070044405153258},
- {0.22153433863150646},
- {0.022071157867923175},
- {0.31431340451510337},
- {0.14910117521875096},
- {0.039581039355517385},
- {0.21091239287753785},
- {0.28345882940922484},
- {0.25106692280438025},
- {0.29808562169328484},
- {0.11488448025512558},
- {0.1399985928385397},
- {0.2562524229714438},
- {0.29709664820949744},
- {0.27471605016236955},
- {0.18979787200745477},
- {0.21893819114749402},
- {0.5954477566957488},
- {0.0593236313671126},
- {0.8448225804363152},
- {0.4007593624227361},
- {0.10638730427760912},
- {0.5668977187647667},
- {0.761890572495299},
- {0.6748264710918797},
- {0.8012049772372443},
- {0.3087905309382258},
- {0.3762931225977187},
- {0.6887642401117849},
- {0.7985467796594309},
- {0.7383914241376016},
- {0.5101453698356492},
- {0.5884697405337583},
- {0.5545829819422483},
- {0.055252330726348824},
- {0.7868435485766969},
- {0.3732557890334596},
- {0.09908608737478347},
- {0.5279922945271329},
- {0.7096030522523695},
- {0.6285140424551556},
- {0.7462193625329925},
- {0.28759865415154057},
- {0.3504686341798301},
- {0.6414952812250767},
- {0.7437435934622079},
- {0.6877166186857484},
- {0.47513478260032427},
- {0.5480838575981873},
- {0.3322446425540115},
- {0.03310107138189003},
- {0.4713894260282552},
- {0.2236134902198484},
- {0.05936139902204699},
- {0.3163144504580332},
- {0.42511548339464766},
- {0.37653593812843605},
- {0.44705191728633753},
- {0.17229723081827963},
- {0.20996195318087837},
- {0.3843128573189889},
- {0.4455687109191166},
- {0.4120035586982613},
- {0.2846480890148584},
- {0.32835108773008886},
- {0.49628524343733654},
- {0.04944420816696056},
- {0.7041305895916374},
- {0.33401915701797674},
- {0.08867016225746441},
- {0.4724897679058661},
- {0.6350096108207249},
- {0.5624446741427841},
- {0.6677768161860139},
- {0.257366296361959},
- {0.31362738687354874},
- {0.5740613256680185},
- {0.6655612998503235},
- {0.6154238781814988},
- {0.42518863529228035},
- {0.4904693067565429},
- {0.054427587388976316},
- {0.005422544789457915},
- {0.07722198011130119},
- {0.036631870680401586},
- {0.009724453968521476},
- {0.05181793831905614},
- {0.06964148449469025},
- {0.061683290120303526},
- {0.07323506289964032},
- {0.028225353809026566},
- {0.03439550587562795},
- {0.06295728793591017},
- {0.07299208729122346},
- {0.06749351779832966},
- {0.04663042455964579},
- {0.05378975379201059},
- {0.39514632542494993},
- {0.039367878511559436},
- {0.5606344713563306},
- {0.265948754798828},
- {0.07059990046892292},
- {0.37620017531805666},
- {0.5055997889186072},
- {0.4478229993360998},
- {0.5316893028941997},
- {0.20491712707653292},
- {0.24971266245469137},
- {0.4570722712510688},
- {0.5299252908657469},
- {0.4900054701563914},
- {0.33853863089807495},
- {0.3905156295928463},
- {0.1877157939236218},
- {0.018701863320982965},
- {0.26633157926605044},
- {0.12633998708294317},
- {0.033538756442186964},
- {0.17871535185880735},
- {0.24018713999783362},
- {0.21274005209900324},
- {0.2525810647641666},
- {0.09734667570640222},
- {0.11862696846555072},
- {0.2171339545827646},
- {0.25174306401076035},
- {0.2327789984087671},
- {0.16082408916369378},
- {0.18551596391480846},
- {0.2717405027180943},
- {0.027073128128349163},
- {0.38554602000568927},
- {0.1828918648011337},
- {0.04855126116797539},
- {0.25871131321700785},
- {0.34769889525645997},
- {0.30796603470232564},
- {0.36564054670867563},
- {0.14092066544574455},
- {0.17172637087675438},
- {0.31432672095506264},
- {0.36442744289226786},
- {0.33697474638468816},
- {0.23281162402511268},
- {0.2685559922408751},
- {0.47596034887952643},
- {0.04741926720654134},
- {0.6752935847086065},
- {0.32033971714654685},
- {0.08503875930495161},
- {0.4531393946289636},
- {0.6090033904992519},
- {0.5394102824341429},
- {0.6404286458412219},
- {0.24682610217834655},
- {0.3007830727357836},
- {0.550551184941071},
- {0.6383038638896573},
- {0.5902197730870927},
- {0.40777543533565913},
- {0.47038259840586905},
- {0.5353782178340385},
- {0.05333898680383584},
- {0.7595957872271504},
- {0.36033024026291},
- {0.09565481559689046},
- {0.5097083446088825},
- {0.685030067374172},
- {0.6067491049848861},
- {0.7203783841815918},
- {0.27763934329877055},
- {0.3383321863155661},
- {0.6192808138620297},
- {0.7179883490091398},
- {0.6639015434576901},
- {0.4586812459492573},
- {0.5291041529562822},
- {0.5628062305130105},
- {0.05607160153787913},
- {0.7985107116468405},
- {0.3787903532621501},
- {0.10055531660272243},
- {0.5358212615577076},
- {0.7201249082689509},
- {0.6378335264090673},
- {0.7572841580752825},
- {0.2918631110474628},
- {0.35566531490923686},
- {0.6510072484621711},
- {0.7547716787823385},
- {0.6979139469230686},
- {0.4821799887266536},
- {0.556210738417479},
- {0.26389011706662857},
- {0.026291005130587686},
- {0.3744078756615158},
- {0.1776082517333603},
- {0.047148650514719025},
- {0.25123733138200105},
- {0.3376541268430318},
- {0.2990691197566945},
- {0.35507745702287463},
- {0.13684956982715013},
- {0.16676532081456433},
- {0.30524605040585934},
- {0.3538993988941682},
- {0.3272397908389961},
- {0.22608586538972364},
- {0.2607976047829331},
- {0.662941272877265},
- {0.06604791645946266},
- {0.9405825289154288},
- {0.4461851083566382},
- {0.11844621819915008},
- {0.6311551114989958},
- {0.8482502457076228},
- {0.7513174996232505},
- {0.8920209060702823},
- {0.34379168504825336},
- {0.418945640259347},
- {0.7668351033613171},
- {0.8890614039712672},
- {0.8220874881044504},
- {0.5679699302387227},
- {0.6551723042909046},
- {0.587895936892481},
- {0.058571254069319144},
- {0.834108041971026},
- {0.39567669571443675},
- {0.10503803770934082},
- {0.5597079873889164},
- {0.7522278266899891},
- {0.6662679235940427},
- {0.7910436229529446},
- {0.30487426721839717},
- {0.37152075117955086},
- {0.6800289256030486},
- {0.7884191382053223},
- {0.7290267083977879},
- {0.50367540523649},
- {0.5810064200489397},
- {0.4418615619819895},
- {0.044022052520234584},
- {0.6269141512275183},
- {0.2973899151819252},
- {0.07894640615327247},
- {0.4206755482419551},
- {0.565373124067609},
- {0.5007658106533273},
- {0.5945470089169967},
- {0.2291429681132031},
- {0.2792343493521055},
- {0.5111085557899527},
- {0.5925744507528562},
- {0.5479352039783673},
- {0.3785615571117811},
- {0.43668341312476217},
- {0.35553199094985144},
- {0.03542115749560465},
- {0.5044295669005054},
- {0.23928677606346532},
- {0.06352209690317583},
- {0.33848523627968086},
- {0.45491223886427934},
- {0.4029277062765887},
- {0.47838621862780384},
- {0.18437371039929035},
- {0.22467838958752198},
- {0.41124971725626575},
- {0.4767990528915141},
- {0.4408812866820092},
- {0.3045993489302729},
- {0.351365533101862},
- {0.6195057564652924},
- {0.06172049640474129},
- {0.8789561231642747},
- {0.41695132643702826},
- {0.11068569269710041},
- {0.5898022054036612},
- {0.7926733960283382},
- {0.7020916255969554},
- {0.8335762288558471},
- {0.3212666590932352},
- {0.39149657202705695},
- {0.7165925252023708},
- {0.8308106315674877},
- {0.7682248066837252},
- {0.530756879496959},
- {0.612245806062507},
- {0.014095341997388003},
- {0.001404299307946988},
- {0.01999850207589289},
- {0.00948671014120551},
- {0.0025183828826469174},
- {0.013419510164703453},
- {0.018035349135414165},
- {0.015974381953697974},
- {0.01896599330029696},
- {0.007309638990466933},
- {0.00890754930997251},
- {0.016304314544436656},
- {0.01890306888159762},
- {0.017479081135368026},
- {0.012076077834468393},
- {0.013930159539043781},
- {0.5240233786896612},
- {0.05220771998141655},
- {0.7434855165971551},
- {0.3526879944995449},
- {0.09362607216223609},
- {0.4988979379266764},
- {0.6705012614478413},
- {0.5938805603586759},
- {0.7050998756375554},
- {0.2717508891587007},
- {0.33115649738201},
- {0.6061464841632033},
- {0.7027605307323361},
- {0.649820852494647},
- {0.44895307324292794},
- {0.5178823804834564},
- {0.48100652186818815},
- {0.04792201039908478},
- {0.6824531059893081},
- {0.32373598667123704},
- {0.08594034762255866},
- {0.4579436178770938},
- {0.6154600973790902},
- {0.5451291571333347},
- {0.6472185260096374},
- {0.24944297396743817},
- {0.30397200101659333},
- {0.5563881764569936},
- {0.645071216935139},
- {0.5964773344224804},
- {0.4120987059443867},
- {0.47536963559919837},
- {0.16160895146237322},
- {0.0161008749371746},
- {0.22929113404286694},
- {0.10876907272145575},
- {0.02887430593175936},
- {0.15386025874776693},
- {0.20678277005071735},
- {0.18315292514895926},
- {0.2174529920076699},
- {0.08380804758314822},
- {0.10212875319738986},
- {0.18693573936179803},
- {0.21673153740732998},
- {0.20040492634630874},
- {0.13845724899531303},
- {0.15971506595764878},
- {0.293574455058749},
- {0.029248414415649657},
- {0.41652407937384395},
- {0.1975869589060565},
- {0.05245228406230622},
- {0.27949838921880776},
- {0.37563599345121623},
- {0.33271065560709606},
- {0.39501923038223224},
- {0.15224343500854207},
- {0.18552433385927808},
- {0.3395824137063446},
- {0.3937086554466988},
- {0.3640501748871525},
- {0.25151769784358974},
- {0.2901340738177223},
- {0.16361397353236637},
- {0.01630063249579443},
- {0.23213586374409725},
- {0.1101185300959749},
- {0.029232538691300467},
- {0.1557691456732288},
- {0.2093482468630741},
- {0.18542523527648933},
- {0.22015085028975234},
- {0.08484782281544018},
- {0.1033958266007423},
- {0.18925498145636824},
- {0.2194204448708897},
- {0.20289127562723486},
- {0.14017503651558397},
- {0.16169659129555713},
- {0.021461650720571247},
- {0.002138194394991135},
- {0.030449837014736296},
- {0.014444520720077798},
- {0.0038345046057094057},
- {0.020432625192733242},
- {0.02746072878824386},
- {0.024322688022099307},
- {0.02887773307345762},
- {0.011129699367063322},
- {0.013562687028262325},
- {0.024825045327447337},
- {0.028781923983038207},
- {0.0266137518559897},
- {0.018387107216399582},
- {0.02121014293687888},
- {0.6130852846167147},
- {0.06108083372927577},
- {0.8698467436532431},
- {0.4126301006442442},
- {0.10953856150972159},
- {0.5836895770438708},
- {0.7844582387498094},
- {0.6948152452401574},
- {0.8249371602835888},
- {0.3179370959389496},
- {0.3874391557830883},
- {0.7091658595306682},
- {0.8222002252624465},
- {0.7602630311986442},
- {0.5252561887161462},
- {0.605900575334285},
- {0.36549549877159393},
- {0.03641380791454377},
- {0.5185658136047867},
- {0.24599260205279005},
- {0.0653022543164578},
- {0.3479710220459824},
- {0.4676608009220041},
- {0.4142194421970556},
- {0.4917926207306859},
- {0.18954064038716345},
- {0.23097482689559967},
- {0.422774671068791},
- {0.4901609759077585},
- {0.45323664220593923},
- {0.31313550903068005},
- {0.36121227917947424},
- {0.33988980348604936},
- {0.03386274812644817},
- {0.48223639709133587},
- {0.228758979116716},
- {0.060727342638732064},
- {0.3235930475191962},
- {0.4348976615518915},
- {0.3852002699941328},
- {0.4573388667653634},
- {0.17626189988750648},
- {0.2147933115116959},
- {0.3931561410507268},
- {0.455821530874531},
- {0.42148402311329985},
- {0.2911980229213528},
- {0.3359066554846483},
- {0.3524416448501465},
- {0.03511327061425502},
- {0.500044977090508},
- {0.23720685365439298},
- {0.06296995175335302},
- {0.33554306354594177},
- {0.4509580623095159},
- {0.39942538834950647},
- {0.4742280021451201},
- {0.1827711019383799},
- {0.22272544582261694},
- {0.4076750629576968},
- {0.472654632330344},
- {0.43704906961177986},
- {0.3019517182418938},
- {0.3483114025807488},
- {0.07154054528782668},
- {0.007127484970315874},
- {0.10150188223274283},
- {0.04814955299524934},
- {0.012781987460926864},
- {0.06811037822681576},
- {0.0915379500435647},
- {0.08107756419215266},
- {0.09626141053405775},
- {0.037099884439275616},
- {0.04521003711238267},
- {0.08275212855916445},
- {0.09594203926754255},
- {0.0887146261357912},
- {0.061291822034272025},
- {0.07070216597470896},
- {0.1732104952677846},
- {0.017256720601655454},
- {0.24575142978589154},
- {0.11657736026019239},
- {0.030947127530358425},
- {0.1649055412993943},
- {0.22162724087513364},
- {0.1963010624580464},
- {0.23306345411120089},
- {0.08982443916593918},
- {0.10946034710533888},
- {0.20035543641062026},
- {0.2322902079048037},
- {0.21479154608975942},
- {0.14839678405732887},
- {0.1711806519745424},
- {0.23785478567618978},
- {0.023697141295248407},
- {0.3374688905021111},
- {0.16008546708740484},
- {0.042496976725614},
- {0.22645032058792736},
- {0.3043412571326137},
- {0.269563036967143},
- {0.3200456060175158},
- {0.12334802630330056},
- {0.15031229695712378},
- {0.2751305532198371},
- {0.31898377480218915},
- {0.2949543968525286},
- {0.20378029179134063},
- {0.23506737986267978},
- {0.060957390196102613},
- {0.006073099956177318},
- {0.08648647862561075},
- {0.041026680435419696},
- {0.010891119071047825},
- {0.05803465552676763},
- {0.07799653351966272},
- {0.06908357626750691},
- {0.08202124178874902},
- {0.03161161440546159},
- {0.038522013802832045},
- {0.07051041853041871},
- {0.08174911583790442},
- {0.07559087031981261},
- {0.052224783813731274},
- {0.06024303423590625},
- {0.509900801117867},
- {0.05080070723109283},
- {0.7234483726286851},
- {0.34318295376373803},
- {0.0911028231610944},
- {0.48545249805642526},
- {0.6524310637012042},
- {0.5778753120756348},
- {0.6860972354987628},
- {0.2644271261961695},
- {0.32223173655478204},
- {0.5898106657806902},
- {0.6838209365972805},
- {0.6323079975909729},
- {0.43685366153571936},
- {0.5039253045420516},
- {0.22859273540488498},
- {0.022774376115902363},
- {0.32432787330564733},
- {0.15385174915041366},
- {0.04084214714675088},
- {0.2176323594639758},
- {0.29249022787885776},
- {0.25906626940126254},
- {0.3075830504140311},
- {0.1185448619808357},
- {0.14445914564526627},
- {0.2644169869241259},
- {0.3065625668388961},
- {0.2834688913428365},
- {0.19584510015116882},
- {0.22591387099699714},
- {0.5912850247364774},
- {0.05890890417491981},
- {0.83891648722167},
- {0.3979576828678548},
- {0.105643558371109},
- {0.5629345780441846},
- {0.7565642509164029},
- {0.6701088083135951},
- {0.7956038115141916},
- {0.30663179879522473},
- {0.3736624847459886},
- {0.6839491394039966},
- {0.79296419720231},
- {0.7332293833957467},
- {0.506578980658749},
- {0.584355791377954},
- {0.5708770085720876},
- {0.05687568192451011},
- {0.8099615492212983},
- {0.38422229894141446},
- {0.10199730426910106},
- {0.5435050686069385},
- {0.7304516743819597},
- {0.6469802141164754},
- {0.7681437968570165},
- {0.2960484989575233},
- {0.3607656419211246},
- {0.6603428505439024},
- {0.7655952880006953},
- {0.7079222024550236},
- {0.4890945668932703},
- {0.5641869355177688},
- {0.3434598578738496},
- {0.03421842767697273},
- {0.4873015980704043},
- {0.231161763750936},
- {0.061365196183684766},
- {0.32699192788368164},
- {0.4394656370808518},
- {0.38924624577796013},
- {0.46214255493506246},
- {0.17811327807726507},
- {0.21704940685897495},
- {0.3972856818373376},
- {0.4606092816092165},
- {0.425911107629135},
- {0.2942566400636932},
- {0.3394348726215107},
- {0.4004871878610187},
- {0.039899981203654546},
- {0.5682120986699902},
- {0.26954336171538434},
- {0.07155414028375395},
- {0.38128495848702054},
- {0.5124335584530088},
- {0.45387584832207906},
- {0.5388757025714164},
- {0.20768682051941947},
- {0.25308781968861155},
- {0.46325013491073513},
- {0.5370878478675462},
- {0.4966284643249746},
- {0.3431143744659222},
- {0.395793902785814},
- {0.6033928924487906},
- {0.06011519418563867},
- {0.856095156431981},
- {0.40610674597225216},
- {0.10780684371726756},
- {0.5744619077016262},
- {0.772056576077257},
- {0.6838307672073333},
- {0.8118955579617179},
- {0.31291076257898687},
- {0.38131404997271673},
- {0.6979545096660709},
- {0.809201891712847},
- {0.7482438755704697},
- {0.516952304905187},
- {0.5963217677225802},
- {0.024662818114140145},
- {0.002457122247628148},
- {0.034991660319018764},
- {0.016599030144673104},
- {0.00440644994552062},
- {0.023480305652340085},
- {0.03155670401145004},
- {0.02795060075043676},
- {0.03318506519429638},
- {0.012789778136303455},
- {0.015585664293586939},
- {0.028527888444259512},
- {0.033074965453998656},
- {0.030583394069031006},
- {0.021129683211580395},
- {0.02437379604383174},
- {0.5114211161695371},
- {0.05095217410400145},
- {0.7256053989514569},
- {0.34420618457439733},
- {0.09137445441367885},
- {0.48689991829590723},
- {0.6543763455367055},
- {0.5795982992390422},
- {0.6881428960502883},
- {0.2652155394309489},
- {0.32319249942892553},
- {0.5915692392735268},
- {0.6858598101591122},
- {0.6341932806968663},
- {0.43815617997764755},
- {0.5054278031137996},
- {0.18888719935044884},
- {0.01881856881351542},
- {0.2679935718494481},
- {0.12712838822597342},
- {0.0337480488010462},
- {0.1798305917043682},
- {0.24168598308059525},
- {0.214067616745128},
- {0.25415724982453974},
- {0.09795414949335725},
- {0.11936723795339747},
- {0.21848893855843454},
- {0.25331401968361256},
- {0.23423161236461965},
- {0.16182768191885386},
- {0.18667364171245437},
- {0.31501456169007575},
- {0.031384462403010384},
- {0.44694334958760723},
- {0.2120169796211002},
- {0.05628293943430524},
- {0.29991050330051866},
- {0.4030691560284805},
- {0.35700892751282864},
- {0.42386797479742616},
- {0.16336196192482094},
- {0.19907340610349902},
- {0.3643825386304643},
- {0.4224616869485857},
- {0.3906372107625039},
- {0.2698863473241899},
- {0.31132292513923243},
- {0.19666461791470305},
- {0.01959342220191991},
- {0.27902819033058524},
- {0.13236289162288162},
- {0.03513762258982179},
- {0.18723510501788007},
- {0.25163738824725024},
- {0.22288183741336012},
- {0.2646221586157265},
- {0.10198740544365548},
- {0.12428217647551547},
- {0.2274852068745094},
- {0.26374420852673225},
- {0.24387608428545052},
- {0.16849092655318607},
- {0.19435991718005627},
- {0.6169359962661398},
- {0.06146447477220989},
- {0.8753101417693698},
- {0.4152217784667637},
- {0.11022655945299378},
- {0.5873556579470782},
- {0.7893853223941832},
- {0.6991792925043435},
- {0.8301184869486605},
- {0.31993401889540557},
- {0.38987261244572874},
- {0.7136200412003139},
- {0.8273643615824976},
- {0.7650381477840865},
- {0.5285552568483822},
- {0.6097061607273379},
- {0.4222872104953174},
- {0.0420718871215278},
- {0.5991420184965062},
- {0.2842156198160842},
- {0.07544910103417114},
- {0.40203973161604056},
- {0.5403272427241932},
- {0.47858201637561626},
- {0.568208732114442},
- {0.21899199463085717},
- {0.266864340798175},
- {0.48846658061111686},
- {0.5663235577604242},
- {0.5236618179284825},
- {0.3617913792646527},
- {0.417338452276477},
- {0.5479864592981345},
- {0.054595128355118504},
- {0.777484387811642},
- {0.36881607424851837},
- {0.09790750158984775},
- {0.5217120565101493},
- {0.7011626334964213},
- {0.6210381420972346},
- {0.7373434087394128},
- {0.284177793619753},
- {0.34629996266141766},
- {0.6338649746948016},
- {0.7348970878617188},
- {0.6795365295095422},
- {0.4694832616296438},
- {0.5415646392030289},
- {0.228241782101326},
- {0.022739411126659757},
- {0.32382993999043824},
- {0.15361554400799293},
- {0.040779443113570624},
- {0.21729823337996035},
- {0.2920411741871427},
- {0.2586685307639168},
- {0.3071108250501308},
- {0.11836286271100578},
- {0.14423736075650453},
- {0.264011033450085},
- {0.3060919082005581},
- {0.28303368790692346},
- {0.19554442355809099},
- {0.22556703049392623},
- {0.5464765836700791},
- {0.054444701547457},
- {0.7753421729659432},
- {0.36779986957357774},
- {0.0976377355254752},
- {0.5202745751534087},
- {0.6992307091693579},
- {0.6193269860295346},
- {0.7353117949586838},
- {0.28339479411795765},
- {0.3453457969794979},
- {0.632118476655424},
- {0.7328722144670139},
- {0.6776641919236939},
- {0.46818968708507847},
- {0.5400724577159233},
- {0.4294959864142723},
- {0.04279008743451127},
- {0.6093698455479236},
- {0.2890674047269221},
- {0.07673707672731128},
- {0.4089028670928109},
- {0.5495510551411895},
- {0.48675178905437383},
- {0.5779085035572048},
- {0.2227303607904364},
- {0.2714199256839147},
- {0.4968050906014938},
- {0.5759911477893328},
- {0.5326011383931757},
- {0.36796744360595585},
- {0.4244627489874661},
- {0.3901751406321977},
- {0.03887260628861996},
- {0.5535813434921096},
- {0.26260295522930016},
- {0.06971171012271765},
- {0.3714673447936664},
- {0.49923903134560466},
- {0.4421891094555595},
- {0.5250003231240495},
- {0.20233914307326067},
- {0.24657112295329925},
- {0.4513220198180371},
- {0.5232585034562638},
- {0.48384089874354275},
- {0.33427960586002153},
- {0.38560270181330475},
- {0.6806318322000765},
- {0.06781040226639257},
- {0.9656819332013633},
- {0.45809153876197445},
- {0.12160695043191705},
- {0.6479974584740283},
- {0.87088576699166},
- {0.7713663747516092},
- {0.9158244455414866},
- {0.35296575136130587},
- {0.4301251866313427},
- {0.7872980650772927},
- {0.912785969256385},
- {0.8440248573283234},
- {0.5831261833723564},
- {0.6726555490214935},
- {0.335738823440555},
- {0.03344919176107089},
- {0.47634697751767874},
- {0.2259652090541783},
- {0.059985696420093375},
- {0.31964109524132206},
- {0.42958637684602907},
- {0.38049592576884245},
- {0.4517535138347924},
- {0.17410926211576472},
- {0.2121701002801554},
- {0.3883546339754135},
- {0.45025470874700424},
- {0.4163365554590965},
- {0.28764170210785256},
- {0.331804320522656},
- {0.635028890818835},
- {0.06326704467819841},
- {0.9009803801600408},
- {0.42739899603754866},
- {0.11345917601153396},
- {0.6045810493142258},
- {0.8125356418535167},
- {0.7196841378842068},
- {0.8544633887561501},
- {0.32931673039664444},
- {0.4013064145072985},
- {0.7345483907118853},
- {0.8516284930991687},
- {0.7874744371567616},
- {0.5440562076525319},
- {0.6275870257456428},
- {0.12993862434209605},
- {0.012945604319001481},
- {0.18435720460884272},
- {0.08745371807997879},
- {0.023215840197312165},
- {0.12370843435153735},
- {0.16625977976408077},
- {0.14726064938072192},
- {0.1748389701490518},
- {0.06738427737579042},
- {0.08211469461412842},
- {0.1503021496844501},
- {0.17425889820721213},
- {0.1611317950223896},
- {0.11132393535039298},
- {0.12841588148089614},
- {0.28402127378463626},
- {0.028296644259635375},
- {0.4029700048734077},
- {0.19115729854799676},
- {0.05074543876546937},
- {0.270403256001255},
- {0.36341245466340594},
- {0.32188394657273056},
- {0.38216494333656004},
- {0.14728929438980481},
- {0.1794872023528532},
- {0.3285320913784423},
- {0.3808970157080954},
- {0.3522036492319369},
- {0.2433330819148418},
- {0.280692845695804},
- {0.00023579020679090928},
- {2.34914501740015e-05},
- {0.00033453966146100106},
- {0.00015869592567351517},
- {4.212810308455384e-05},
- {0.00022448473242823688},
- {0.00030169957585800977},
- {0.00026722323054789314},
- {0.00031726761103779695},
- {0.00012227736577434442},
- {0.00014900758663307685},
- {0.00027274242077483124},
- {0.00031621499651449797},
- {0.00029239419349933056},
- {0.0002020114794192345},
- {0.0002330269956521918},
- {0.5194960073490423},
- {0.051756664275096814},
- {0.7370620722301804},
- {0.34964089854273794},
- {0.09281717696198385},
- {0.4945876412530603},
- {0.6647083744920752},
- {0.5887496483840197},
- {0.699008069242929},
- {0.26940306034533507},
- {0.3282954257266651},
- {0.6009095990694895},
- {0.6966889354265855},
- {0.6442066367482479},
- {0.4450742820291364},
- {0.5134080651331085},
- {0.5523686133386052},
- {0.05503171626391068},
- {0.7837017975553343},
- {0.37176543334769896},
- {0.09869045114344414},
- {0.5258840986429539},
- {0.7067697112175366},
- {0.6260044779573644},
- {0.7432398179352903},
- {0.2864503148570804},
- {0.3490692642652114},
- {0.6389338845425547},
- {0.7407739342477192},
- {0.684970666973909},
- {0.4732376390179442},
- {0.5458954390459653},
- {0.383255464054306},
- {0.03818320854067237},
- {0.5437636912185345},
- {0.25794574535262516},
- {0.06847538715514123},
- {0.36487944716119425},
- {0.49038512889970787},
- {0.43434697574416864},
- {0.5156895494201666},
- {0.19875069961977435},
- {0.242198234353785},
- {0.4433179158032055},
- {0.5139786205691013},
- {0.4752600790402756},
- {0.328351225196434},
- {0.3787641165057274},
- {0.5696227519863233},
- {0.05675072208630944},
- {0.808182007232267},
- {0.3833781357650936},
- {0.10177320908101543},
- {0.542310950081476},
- {0.7288468211308755},
- {0.6455587534826964},
- {0.7664561313851985},
- {0.29539805976668626},
- {0.35997301465552695},
- {0.6588920312663339},
- {0.7639132217805006},
- {0.7063668480243751},
- {0.48801999203322854},
- {0.5629473774888943},
- {0.06648125578936522},
- {0.006623434998154188},
- {0.09432375121922973},
- {0.044744455552332175},
- {0.01187805564617262},
- {0.06329366736847958},
- {0.08506446025532151},
- {0.07534382443062486},
- {0.08945388144041362},
- {0.034476210619309645},
- {0.04201281985512686},
- {0.07689996496004307},
- {0.08915709585154863},
- {0.08244079953071058},
- {0.05695731395480501},
- {0.06570216598316304},
- {0.09946401987052984},
- {0.009909461884336966},
- {0.14111976908584745},
- {0.06694313101205186},
- {0.017771011524772725},
- {0.09469500108065376},
- {0.12726674706503738},
- {0.11272349719194343},
- {0.13383385339884954},
- {0.0515805915123543},
- {0.0628562727835203},
- {0.11505167211435742},
- {0.13338982617105946},
- {0.12334143248805288},
- {0.08521504805688367},
- {0.09829840705162433},
- {0.33659534656225665},
- {0.03353452596773782},
- {0.4775622143973922},
- {0.226541682231369},
- {0.060138729469499656},
- {0.3204565504988184},
- {0.43068231999840567},
- {0.381466631375047},
- {0.4529060088782438},
- {0.17455344252712238},
- {0.2127113799414153},
- {0.38934538839580246},
- {0.4514033801003639},
- {0.41739869621036846},
- {0.28837552182550164},
- {0.3326508061018207},
- {0.1990107034483213},
- {0.01982715943879257},
- {0.282356821620481},
- {0.13394189789516905},
- {0.03555679238720483},
- {0.18946870237731187},
- {0.2546392644492034},
- {0.22554067793081678},
- {0.2677789349834637},
- {0.10320405121888282},
- {0.12576478488473253},
- {0.23019896270216889},
- {0.26689051150060294},
- {0.2467853729994261},
- {0.1705009176208412},
- {0.19667850907953632},
- {0.41013868386585706},
- {0.04086154631947502},
- {0.5819056623255581},
- {0.2760391916884259},
- {0.07327855125122279},
- {0.3904736925216771},
- {0.5247828934431473},
- {0.46481397835357796},
- {0.5518622770439995},
- {0.21269194572506367},
- {0.25918708117471323},
- {0.47441417950904413},
- {0.5500313361364886},
- {0.5085969062242567},
- {0.3513832207979294},
- {0.40533229349408884},
- {0.08991359030499224},
- {0.008957965877218713},
- {0.1275695987155602},
- {0.06051532266025422},
- {0.016064657869484907},
- {0.08560248763502287},
- {0.11504672915844304},
- {0.10189990669445434},
- {0.12098326891579762},
- {0.04662787788959166},
- {0.05682088021892627},
- {0.10400453273314428},
- {0.12058187671090034},
- {0.11149831911878638},
- {0.07703278963368171},
- {0.08885989839117517},
- {0.16687391006153363},
- {0.01662541543562725},
- {0.23676106882659273},
- {0.11231259342105551},
- {0.02981498417968178},
- {0.15887277745439135},
- {0.21351941869230087},
- {0.18911975161184186},
- {0.2245372592454937},
- {0.0865383784021343},
- {0.10545594301269734},
- {0.19302580380152962},
- {0.223792300819607},
- {0.20693379514183932},
- {0.14296796252397354},
- {0.16491832482617114},
- {0.40120854957781477},
- {0.039971849467643025},
- {0.5692355682526005},
- {0.2700288660412442},
- {0.07168302435056927},
- {0.3819717329471767},
- {0.5133565591448507},
- {0.4546933742531995},
- {0.5398463311301545},
- {0.2080609081954971},
- {0.2535436841198455},
- {0.46408454590502934},
- {0.5380552561236687},
- {0.4975229967157575},
- {0.34373239567040587},
- {0.39650681090838313},
- {0.5219278207536487},
- {0.051998942460456055},
- {0.7405123344110638},
- {0.3512776029867503},
- {0.09325166356423069},
- {0.4969028560742279},
- {0.6678199416886984},
- {0.5915056450936068},
- {0.7022801967832104},
- {0.2706641633454003},
- {0.3298322098513921},
- {0.6037225177393188},
- {0.6999502068666815},
- {0.6472222332348793},
- {0.44715771980300334},
- {0.5158113802638539},
- {0.3746590222313188},
- {0.03732675700476324},
- {0.5315670407453386},
- {0.2521600076361846},
- {0.06693948033268224},
- {0.3566951804406538},
- {0.4793857626105763},
- {0.42460454841260137},
- {0.5041226035417778},
- {0.19429271014068034},
- {0.2367657142033156},
- {0.43337426977667376},
- {0.5024500509220018},
- {0.46459996847841},
- {0.3209862885689219},
- {0.3702684158633087},
- {0.3545315995085902},
- {0.03532148988846893},
- {0.5030102093341211},
- {0.23861347394474078},
- {0.06334335922642519},
- {0.33753281078215297},
- {0.4536322125322776},
- {0.40179395336808327},
- {0.47704014150699675},
- {0.183854921973573},
- {0.22404619236279621},
- {0.41009254797801},
- {0.47545744171767906},
- {0.4396407404666585},
- {0.3037422711160669},
- {0.35037686518725264},
- {0.6480940798793352},
- {0.06456871128261688},
- {0.9195172989944164},
- {0.4361923734227858},
- {0.1157935037983026},
- {0.6170197994654208},
- {0.8292528840651623},
- {0.7344910379500855},
- {0.8720432593427936},
- {0.33609214708338764},
- {0.40956295881974475},
- {0.7496611103652575},
- {0.8691500380753386},
- {0.8036760660125726},
- {0.5552497097361198},
- {0.6404991046476137},
- {0.289943798762285},
- {0.028886697181299287},
- {0.411372896274126},
- {0.1951433868442165},
- {0.05180360291136404},
- {0.2760418126359925},
- {0.37099047623641207},
- {0.32859599911752224},
- {0.39013399928906844},
- {0.1503606295519213},
- {0.18322994114469845},
- {0.33538277369255437},
- {0.3888396323275589},
- {0.3595479403197125},
- {0.2484071604735545},
- {0.2865459649622898},
- {0.5587922439634312},
- {0.05567169364385803},
- {0.7928156587450207},
- {0.3760887851190279},
- {0.09983814670223272},
- {0.5319997343245945},
- {0.7149889102307385},
- {0.6332844381846122},
- {0.7518831368002464},
- {0.289781516106705},
- {0.35312867669736736},
- {0.6463642040228375},
- {0.7493885767440508},
- {0.6929363595336052},
- {0.4787410360564587},
- {0.5522437915329284},
- {0.20040847212435878},
- {0.01996641718683395},
- {0.284339978877292},
- {0.13488265025694085},
- {0.035806528555953704},
- {0.19079945199370746},
- {0.2564277450754665},
- {0.22712478214893897},
- {0.26965970320817256},
- {0.10392891368876188},
- {0.12664810459475065},
- {0.2318157847813138},
- {0.2687650398070869},
- {0.24851869114817782},
- {0.1716984453806883},
- {0.19805989738919835},
- {0.4275216697823012},
- {0.04259338901595151},
- {0.606568680789363},
- {0.2877386132993752},
- {0.07638433003895123},
- {0.4070232133663537},
- {0.5470248667189397},
- {0.48451427768483857},
- {0.5752519609900527},
- {0.22170650895092395},
- {0.27017225657762134},
- {0.49452136599346846},
- {0.5733434189655023},
- {0.5301528657224223},
- {0.36627596273788},
- {0.4225115692524132},
- {0.6655207302411363},
- {0.0663049042070203},
- {0.9442422686688606},
- {0.44792118289368593},
- {0.11890708401375003},
- {0.6336108911686416},
- {0.8515507271110505},
- {0.7542408226026712},
- {0.8954916960014986},
- {0.3451293540544183},
- {0.42057572796249837},
- {0.7698188042337268},
- {0.892520678690209},
- {0.8252861720779705},
- {0.5701798608599573},
- {0.657721533150307},
- {0.6029597233845574},
- {0.06007203815457256},
- {0.8554805752155845},
- {0.4058152064441386},
- {0.10772945038003183},
- {0.5740495078704202},
- {0.7715023252254825},
- {0.683339852685084},
- {0.8113127071467703},
- {0.31268612741355634},
- {0.38104030884604334},
- {0.697453455865781},
- {0.8086209746510195},
- {0.7477067195922418},
- {0.5165811905798919},
- {0.5958936749403501},
- {0.3526334044448569},
- {0.035132375355820984},
- {0.500317046023181},
- {0.23733591527575343},
- {0.06300421300653804},
- {0.3357256288097625},
- {0.45120342359562793},
- {0.39964271127858175},
- {0.4744860243477187},
- {0.1828705456702561},
- {0.22284662827039722},
- {0.40789687444333883},
- {0.4729117984798557},
- {0.4372868631690451},
- {0.30211600682685036},
- {0.3485009149563941},
- {0.24150183724598273},
- {0.02406049196786467},
- {0.34264333525151186},
- {0.1625400738020958},
- {0.04314858718296928},
- {0.22992250633702827},
- {0.30900775251727797},
- {0.27369627437220223},
- {0.3249528977775418},
- {0.12523933410979027},
- {0.15261705066228134},
- {0.2793491579166727},
- {0.32387478539642023},
- {0.299476962555801},
- {0.2069048756880138},
- {0.238671691856227},
- {0.08935823931781733},
- {0.0089026370311998},
- {0.12678166551947848},
- {0.060141549974005316},
- {0.015965434564351795},
- {0.08507376415894455},
- {0.11433614342393213},
- {0.10127052226453848},
- {0.12023601616350367},
- {0.046339880959116314},
- {0.05646992624395218},
- {0.10336214908760087},
- {0.11983710315620576},
- {0.11080965012691404},
- {0.07655699686839684},
- {0.08831105552855108},
- {0.3162746458390631},
- {0.03151000283322526},
- {0.4487311597360942},
- {0.2128650649727849},
- {0.05650807581993481},
- {0.3011101699740092},
- {0.4046814657951538},
- {0.35843699257811446},
- {0.4255634815493683},
- {0.16401542320503779},
- {0.19986971609682164},
- {0.3658400987465194},
- {0.4241515684334998},
- {0.3921997917258905},
- {0.2709659149050242},
- {0.3125682424384698},
- {0.31733124246754324},
- {0.031615270084947765},
- {0.4502302613451191},
- {0.21357619535560382},
- {0.056696855550396115},
- {0.3021161057787955},
- {0.40603340809591326},
- {0.3596344433471315},
- {0.42698518558326715},
- {0.1645633588219363},
- {0.20053743218137507},
- {0.36706228149174996},
- {0.42556855560925794},
- {0.3935100357909144},
- {0.2718711460890229},
- {0.3136124568751164},
- {0.6081607344921801},
- {0.06059020765343343},
- {0.8628597811583568},
- {0.40931568800949186},
- {0.10865870327423763},
- {0.5790011451870892},
- {0.778157151422713},
- {0.6892342068620871},
- {0.8183109298106986},
- {0.31538329599514703},
- {0.38432708705344326},
- {0.7034695511874485},
- {0.8155959789637608},
- {0.7541562896099777},
- {0.52103711757799},
- {0.6010337357141112},
- {0.2953784291213012},
- {0.029428141841069042},
- {0.41908356172209},
- {0.19880110319832384},
- {0.05277459602896245},
- {0.28121586782087116},
- {0.37794422421676904},
- {0.3347551161611651},
- {0.39744656843409465},
- {0.15317894967344808},
- {0.18666435500378614},
- {0.3416691002550858},
- {0.3961279401984528},
- {0.36628721241425133},
- {0.253063239001426},
- {0.29191690721760044},
- {0.2516519154295716},
- {0.02507173013232092},
- {0.357044288393521},
- {0.169371468858429},
- {0.04496207870093423},
- {0.23958591694334394},
- {0.3219950361054803},
- {0.28519945221596027},
- {0.33861033970857907},
- {0.1305030167689835},
- {0.15903139108319123},
- {0.29108992074360696},
- {0.3374869153535037},
- {0.3120636766727168},
- {0.2156008785373007},
- {0.24870282188892592},
- {0.09072755261435064},
- {0.009039059809380042},
- {0.1287244502215697},
- {0.06106315076518281},
- {0.01621008667478724},
- {0.08637742275090332},
- {0.11608821466727759},
- {0.10282237773687493},
- {0.12207849624045894},
- {0.0470499868837799},
- {0.057335263581061974},
- {0.10494605635999593},
- {0.12167347034542708},
- {0.11250768187486875},
- {0.07773014569669578},
- {0.08966432192557626},
- {0.6414159273525563},
- {0.0639033762397738},
- {0.9100423215731755},
- {0.43169771857070405},
- {0.11460033338681049},
- {0.6106618454880602},
- {0.8207080177949911},
- {0.7269226256882484},
- {0.8630574684265659},
- {0.3326289544837987},
- {0.4053427013089427},
- {0.7419363812034887},
- {0.860194059764283},
- {0.7953947508184068},
- {0.5495282529797829},
- {0.6338992129854364},
- {0.25606959755444847},
- {0.025511857654721155},
- {0.3633121054611279},
- {0.17234473973205927},
- {0.045751375977036275},
- {0.24379178368926607},
- {0.32764757291559793},
- {0.2902060523840076},
- {0.3445545537332393},
- {0.1327939623532391},
- {0.1618231446547198},
- {0.2961999265125109},
- {0.3434114079638302},
- {0.3175418711220105},
- {0.21938569434367408},
- {0.2530687334648012},
- {0.42412198864277667},
- {0.04225468351505913},
- {0.6017452057478383},
- {0.2854504964484915},
- {0.07577691669702431},
- {0.40378653733415426},
- {0.5426748881010551},
- {0.48066138748511067},
- {0.5706775186155919},
- {0.21994348384537996},
- {0.26802382857962664},
- {0.49058889875288153},
- {0.5687841534458853},
- {0.5259370543938896},
- {0.36336331158965807},
- {0.4191517287700587},
- {0.3082659749440699},
- {0.030712110096922852},
- {0.4373684399419704},
- {0.2074749198162368},
- {0.05507718470012792},
- {0.29348549222578274},
- {0.3944341673806422},
- {0.34936069149639587},
- {0.4147874110881569},
- {0.15986224316536876},
- {0.19480863769817663},
- {0.35657633704573616},
- {0.41341125027689485},
- {0.3822685528537874},
- {0.2641045465823186},
- {0.30465342467217327},
- {0.32182383706620216},
- {0.032062861032861774},
- {0.4566043643944864},
- {0.21659988522047693},
- {0.05749953726879863},
- {0.30639329315699226},
- {0.4117817973244758},
- {0.3647259425172401},
- {0.4330301981182525},
- {0.16689315292361923},
- {0.20337652667973388},
- {0.37225893975451124},
- {0.4315935123056815},
- {0.39908112626270487},
- {0.27572014259170946},
- {0.318052403030035},
- {0.38329802163152227},
- {0.038187448492866774},
- {0.5438240720022333},
- {0.2579743882475217},
- {0.06848299082123235},
- {0.3649199642227983},
- {0.49043958240382257},
- {0.43439520664155323},
- {0.5157468127859304},
- {0.19877276935925406},
- {0.24222512860847123},
- {0.4433671428546181},
- {0.51403569394935},
- {0.4753128530237111},
- {0.32838768607939844},
- {0.37880617535327626},
- {0.6452294561725836},
- {0.0642833128091591},
- {0.915452964609572},
- {0.4342643709114161},
- {0.11528168795803105},
- {0.6142925263735066},
- {0.8255875250619948},
- {0.7312445333066545},
- {0.8681887637200416},
- {0.33460659496668355},
- {0.4077526602879933},
- {0.7463475528811622},
- {0.8653083307043066},
- {0.8001237584345168},
- {0.5527954650036679},
- {0.6376680512924151},
- {0.6537114287943526},
- {0.06512835993784762},
- {0.9274872059295448},
- {0.43997306642964296},
- {0.11679714282714321},
- {0.6223678123676782},
- {0.836440425092301},
- {0.7408572316296931},
- {0.8796016855170142},
- {0.3390052223858441},
- {0.41311284164352513},
- {0.7561587904948539},
- {0.8766833872833406},
- {0.8106419202266424},
- {0.5600623310072949},
- {0.646050624191245},
- {0.4722378164070477},
- {0.04704839647663065},
- {0.6700120474892726},
- {0.31783430886598335},
- {0.08437366284538894},
- {0.44959534707324456},
- {0.6042403153768808},
- {0.5351915018212683},
- {0.6354197907211225},
- {0.24489565107548206},
- {0.29843061888523337},
- {0.5462452702392908},
- {0.6333116268971608},
- {0.58560360647492},
- {0.4045861837455012},
- {0.46670369006575857},
- {0.4696509638315923},
- {0.04679067195443416},
- {0.6663418153934597},
- {0.3160932570656138},
- {0.08391147574505713},
- {0.4471325267715203},
- {0.6009303716118535},
- {0.5322597977798985},
- {0.6319390501598765},
- {0.24355414702033798},
- {0.296795857779205},
- {0.5432530152036822},
- {0.6298424345618892},
- {0.5823957519893744},
- {0.40236991733257677},
- {0.4641471526588083},
- {0.4803713975766772},
- {0.04785873384976838},
- {0.6815519902544372},
- {0.32330852346684513},
- {0.08582687140152118},
- {0.45733894600128117},
- {0.614647439669621},
- {0.5444093648769602},
- {0.6463639342544402},
- {0.24911360776363256},
- {0.3035706343136326},
- {0.5556535177147278},
- {0.6442194605014865},
- {0.5956897416826645},
- {0.41155456800291146},
- {0.47474195429075555},
- {0.21645907991155597},
- {0.0215655169044475},
- {0.3071126163351903},
- {0.14568532987234373},
- {0.03867425435606889},
- {0.20608047847677363},
- {0.27696490659530343},
- {0.24531508497587287},
- {0.2912566052070093},
- {0.11225252502956723},
- {0.13679128383410372},
- {0.2503817875104666},
- {0.2902902886906627},
- {0.2684224207516438},
- {0.18544968241804685},
- {0.21392240907679758},
- {0.0019914770668317456},
- {0.00019840808880425598},
- {0.0028255120210994513},
- {0.0013403410636926647},
- {0.00035581270445387853},
- {0.0018959913669405646},
- {0.0025481456357807288},
- {0.002256959449688811},
- {0.00267963279743231},
- {0.001032750991003382},
- {0.0012585136405892407},
- {0.00230357436603339},
- {0.0026707424465059765},
- {0.0024695526534104163},
- {0.0017061829410790826},
- {0.001968139067817861},
- {0.3207239665947533},
- {0.03195328246838471},
- {0.4550438657623454},
- {0.2158596298682166},
- {0.05730302589866381},
- {0.30534615836776896},
- {0.4103744850393259},
- {0.363479449100211},
- {0.4315502669469081},
- {0.1663227761222578},
- {0.20268146369645693},
- {0.3709867014414598},
- {0.430118491175546},
- {0.3977172200011602},
- {0.27477783686947077},
- {0.31696542187396193},
- {0.2972172373091787},
- {0.029611339741919},
- {0.421692466803588},
- {0.20003869220374865},
- {0.053103131730024546},
- {0.28296651035034903},
- {0.3802970261330032},
- {0.3368390545528825},
- {0.39992077755780936},
- {0.15413252880821407},
- {0.18782638956868963},
- {0.34379608001106454},
- {0.39859394051557434},
- {0.3685674463748212},
- {0.2546386240331324},
- {0.29373416652380113},
- {0.048098258053808456},
- {0.004791962515768361},
- {0.06824191379777575},
- {0.032371987323041876},
- {0.008593607007924456},
- {0.045792082446613994},
- {0.06154294638373667},
- {0.054510202420164515},
- {0.06471863117429363},
- {0.0249430558342472},
- {0.030395687129654226},
- {0.05563604831256296},
- {0.06450391095473118},
- {0.0596447645717414},
- {0.04120781943905808},
- {0.04753459748360908},
- {0.19683455188824492},
- {0.019610352487221663},
- {0.2792692930241752},
- {0.1324772637573381},
- {0.03516798430862416},
- {0.18739689113741487},
- {0.2518548230951144},
- {0.22307442516332537},
- {0.2648508133446636},
- {0.10207553072639335},
- {0.1243895662251962},
- {0.22768177230420428},
- {0.2639721046365096},
- {0.24408681274537325},
- {0.1686365162019929},
- {0.19452785970766434},
- {0.5294404993043776},
- {0.052747420169728505},
- {0.7511713391815837},
- {0.3563339261187484},
- {0.09459393685341307},
- {0.5040553229100335},
- {0.6774326052643421},
- {0.6000198334465348},
- {0.7123888845388401},
- {0.2745601289819509},
- {0.334579845960753},
- {0.6124125569157378},
- {0.7100253565264802},
- {0.656538411441585},
- {0.4535941504295717},
- {0.5232360181900992},
- {0.4032716821796761},
- {0.04017739649768555},
- {0.57216274530363},
- {0.27141743405047425},
- {0.07205163958744122},
- {0.3839359441686525},
- {0.5159963898629787},
- {0.45703154158602244},
- {0.5426223800626158},
- {0.20913081870294445},
- {0.2548474804652976},
- {0.4664710054101526},
- {0.5408220948206001},
- {0.5000814065895753},
- {0.3454999689501123},
- {0.39854576578435963},
- {0.07979760456245655},
- {0.007950124295221133},
- {0.11321701600353436},
- {0.053706873134887104},
- {0.014257257570873984},
- {0.0759715348335152},
- {0.1021030677170029},
- {0.09043536613067282},
- {0.10737170008303111},
- {0.04138187507360118},
- {0.05042808451114469},
- {0.09230320519501839},
- {0.10701546765662931},
- {0.09895388170174652},
- {0.06836599522586449},
- {0.07886246127227961},
- {0.46665696760610975},
- {0.046492384276971624},
- {0.6620939269958867},
- {0.31407818184712816},
- {0.08337654520939776},
- {0.4442820842077008},
- {0.5970994771754717},
- {0.5288666740598318},
- {0.6279104772906166},
- {0.24200150420037989},
- {0.2949038023031974},
- {0.5397898103935989},
- {0.6258272274890825},
- {0.5786830146216757},
- {0.3998048336714828},
- {0.4611882428935826},
- {0.6173332226846143},
- {0.0615040498874973},
- {0.8758737274812975},
- {0.41548912720460884},
- {0.11029753099898443},
- {0.5877338384808599},
- {0.7898935837151448},
- {0.6996294728924454},
- {0.8306529751216246},
- {0.3201400147284306},
- {0.3901236396226813},
- {0.7140795195494997},
- {0.8278970764574829},
- {0.7655307326961032},
- {0.5288955775832955},
- {0.610098732073496},
- {0.3881971121101941},
- {0.03867553805962176},
- {0.5507749122958466},
- {0.26127166555624626},
- {0.0693583002393587},
- {0.36958415715181847},
- {0.49670809346550543},
- {0.4399473913665873},
- {0.5223387860217168},
- {0.20131336630165964},
- {0.24532110811864363},
- {0.44903400160559565},
- {0.5206057966678703},
- {0.4813880231034497},
- {0.33258494485818557},
- {0.3836478536876335},
- {0.6050428485543539},
- {0.06027957701633655},
- {0.8584361177657573},
- {0.407217230224574},
- {0.10810163764381006},
- {0.5760327530726731},
- {0.7741677369435528},
- {0.6857006777807686},
- {0.8141156570873507},
- {0.31376640577544274},
- {0.38235673949187265},
- {0.699863041103946},
- {0.8114146251052581},
- {0.750289921465935},
- {0.5183658923412301},
- {0.5979523880925701},
- {0.5563072592202816},
- {0.05542411807203363},
- {0.7892899569526379},
- {0.37441629430837947},
- {0.09939416009715805},
- {0.5296338975803702},
- {0.7118093089520192},
- {0.6304681819033855},
- {0.7485394645432235},
- {0.28849283922517865},
- {0.35155829095303875},
- {0.6434897811888299},
- {0.7460559979546761},
- {0.6898548273541297},
- {0.4766120441397459},
- {0.5497879281753328},
- {0.42987954368220777},
- {0.042828300711352636},
- {0.6099140374391494},
- {0.2893255535979556},
- {0.07680560603708345},
- {0.4092680338732097},
- {0.5500418264358431},
- {0.4871864780672587},
- {0.5784245991989632},
- {0.2229292680011517},
- {0.271662314643187},
- {0.4972487576188237},
- {0.5765055311549274},
- {0.5330767727273796},
- {0.36829605339934884},
- {0.42484181137103166},
- {0.42234902035323835},
- {0.04207804515165709},
- {0.5992297144582056},
- {0.2842572202402579},
- {0.075460144461723},
- {0.40209857786587283},
- {0.5404063300118817},
- {0.47865206606147104},
- {0.5682919003945333},
- {0.21902404832260425},
- {0.26690340152883163},
- {0.48853807709312325},
- {0.5664064501089786},
- {0.5237384659106149},
- {0.36184433439375346},
- {0.41739953778842015},
- {0.26750879210664696},
- {0.02665152868903164},
- {0.3795420597283657},
- {0.18004375994637362},
- {0.04779519100166377},
- {0.2546825011757729},
- {0.342284313735016},
- {0.3031701977770985},
- {0.35994656673143355},
- {0.1387261619787453},
- {0.16905214197588866},
- {0.3094318315027277},
- {0.3587523541154223},
- {0.3317271679199306},
- {0.22918613790875922},
- {0.26437387278953794},
- {0.07825719306016068},
- {0.00779665524090315},
- {0.11103147679263035},
- {0.052670116635955194},
- {0.013982035730897825},
- {0.07450498171144719},
- {0.10013207196101044},
- {0.08868960347318612},
- {0.1052989987439889},
- {0.04058304011233296},
- {0.049454621687972884},
- {0.09052138580631862},
- {0.1049496430218457},
- {0.097043677775125},
- {0.06704625930159372},
- {0.07734010175899245},
- {0.5866749749979797},
- {0.0584496113348757},
- {0.8323757385628295},
- {0.3948549411526292},
- {0.10481989120845805},
- {0.5585455671683207},
- {0.7506655748444895},
- {0.6648841961429963},
- {0.7894007571668346},
- {0.3042410941693449},
- {0.3707491644892185},
- {0.6786166188439499},
- {0.7867817230366914},
- {0.7275126414087688},
- {0.5026293553518083},
- {0.5797997665328599},
- {0.6352207811255709},
- {0.06328616244242158},
- {0.9012526345472215},
- {0.427528145633156},
- {0.11349346061874102},
- {0.6047637390227996},
- {0.8127811703889949},
- {0.7199016089504342},
- {0.8547215868383691},
- {0.3294162419138726},
- {0.4014276795585241},
- {0.7347703533942828},
- {0.8518858345447761},
- {0.7877123928048863},
- {0.5442206082240294},
- {0.6277766673015074},
- {0.5341945673541657},
- {0.05322106135370881},
- {0.757916421335691},
- {0.35953359772574184},
- {0.09544333544209174},
- {0.5085814468259799},
- {0.683515556434121},
- {0.6054076629064555},
- {0.7187857227849886},
- {0.2770255194057167},
- {0.3375841785682413},
- {0.6179116658315601},
- {0.7164009716644172},
- {0.662433744891508},
- {0.45766716233735216},
- {0.5279343736046248},
- {0.6777617320430052},
- {0.06752445818181053},
- {0.9616098288168192},
- {0.4561598503878002},
- {0.1210941561266501},
- {0.6452649715121176},
- {0.8672134007308072},
- {0.7681136635961848},
- {0.9119625810787241},
- {0.3514773592372579},
- {0.42831142725761406},
- {0.7839781728927966},
- {0.9089369174933091},
- {0.8404657586188788},
- {0.5806672467324412},
- {0.6698190833941644},
- {0.07779822043559961},
- {0.00775092843703013},
- {0.11038028542836524},
- {0.052361210314081905},
- {0.013900032129884646},
- {0.07406801552774202},
- {0.09954480479650389},
- {0.08816944553644444},
- {0.1046814279376858},
- {0.04034502359647473},
- {0.04916457400513108},
- {0.08999048460225305},
- {0.10433412116090375},
- {0.09647452381312094},
- {0.06665303797080822},
- {0.07688650780679362},
- {0.22055690660979213},
- {0.021973777675806303},
- {0.3129266218234226},
- {0.1484433256770758},
- {0.03940640378634195},
- {0.2099818259602447},
- {0.2822081802393772},
- {0.24995919001921385},
- {0.29677043762901983},
- {0.11437759824986612},
- {0.13938090481563256},
- {0.2551218112324177},
- {0.29578582759677524},
- {0.2735039750232905},
- {0.18896046450259882},
- {0.21797221359238583},
- {0.4956734013275706},
- {0.04938325118901165},
- {0.7032625066671834},
- {0.3336073636220727},
- {0.08856084581119424},
- {0.4719072618969506},
- {0.634226743255864},
- {0.5617512677991446},
- {0.6669535517801691},
- {0.25704900395838465},
- {0.3132407333419305},
- {0.5733535978093398},
- {0.6647407668297192},
- {0.6146651567627056},
- {0.42466444418423144},
- {0.4898646347873687},
- {0.5746524703012932},
- {0.05725182592261149},
- {0.8153181825859208},
- {0.3867633306581919},
- {0.10267185747928084},
- {0.5470995076110373},
- {0.7352824738365764},
- {0.6512589799474199},
- {0.7732238709605687},
- {0.29800639840174614},
- {0.36315154440770814},
- {0.6647099893898316},
- {0.7706585076898831},
- {0.7126040045638686},
- {0.4923291652245057},
- {0.5679181528398554},
- {0.6820393879780796},
- {0.06795063508978293},
- {0.9676789764198638},
- {0.45903887822177386},
- {0.12185843524004378},
- {0.6493375259284966},
- {0.8726867704641943},
- {0.7729615707832572},
- {0.917718382805325},
- {0.353695689279666},
- {0.4310146912990139},
- {0.7889262080586871},
- {0.9146736229104228},
- {0.8457703120786111},
- {0.5843320961579186},
- {0.6740466097386665},
- {0.23304161764413123},
- {0.023217612062278754},
- {0.3306399571638082},
- {0.15684601890732397},
- {0.0416370188767384},
- {0.22186793036691643},
- {0.29818268603006953},
- {0.2641082289486018},
- {0.31356924576558703},
- {0.12085198748981708},
- {0.14727061612449907},
- {0.2695630823798637},
- {0.3125289014925833},
- {0.28898577583105206},
- {0.19965664641996297},
- {0.23031061705499295},
- {0.4569822442538541},
- {0.04552850505285143},
- {0.6483674083289662},
- {0.30756671897122145},
- {0.08164798426428696},
- {0.4350712365113238},
- {0.584720422202644},
- {0.5179022202598508},
- {0.6148926492510337},
- {0.23698433363078794},
- {0.28878986229829867},
- {0.5285988983394739},
- {0.612852589344653},
- {0.5666857693992715},
- {0.39151608748494554},
- {0.4516268970377667},
- {0.2487572876060689},
- {0.02478334239046533},
- {0.35293738410216124},
- {0.16742327241641802},
- {0.04444490209296731},
- {0.2368300783473222},
- {0.3182912860706369},
- {0.28191894362844233},
- {0.33471547203402535},
- {0.1290019049544928},
- {0.15720213145425516},
- {0.28774165700284693},
- {0.33360496987503285},
- {0.30847416216550766},
- {0.21312092800435767},
- {0.24584211603340145},
- {0.309205853189704},
- {0.030805748858589152},
- {0.4387019412539558},
- {0.20810749421464503},
- {0.05524511062104675},
- {0.29438030596447795},
- {0.3956367655373902},
- {0.3504258642384629},
- {0.4160520646533627},
- {0.1603496503295122},
- {0.19540259361779233},
- {0.35766350971264493},
- {0.4146717080381062},
- {0.38343405902709277},
- {0.264909780173054},
- {0.30558228854162645},
- {0.29160884303268425},
- {0.029052583224862906},
- {0.41373526472919464},
- {0.19626402601483614},
- {0.052101092606200806},
- {0.2776270227369922},
- {0.37312094279395547},
- {0.3304830092482522},
- {0.392374400301186},
- {0.15122409725082636},
- {0.18428216562741176},
- {0.33730875785952474},
- {0.3910726002498768},
- {0.3616126964570011},
- {0.2498336745809031},
- {0.28819149667982674},
- {0.21748188875385682},
- {0.02166741792605246},
- {0.30856377975923394},
- {0.14637371976870583},
- {0.03885699729917362},
- {0.20705424652428525},
- {0.2782736165629724},
- {0.2464742437331106},
- {0.29263284607113},
- {0.1127829387928418},
- {0.13743764773213182},
- {0.25156488736620575},
- {0.29166196353206086},
- {0.2696907659073599},
- {0.186325966171339},
- {0.21493323168428277},
- {0.22318181758046476},
- {0.022235293902955748},
- {0.31665085125366693},
- {0.15020999224890189},
- {0.03987539069409055},
- {0.21248087986464165},
- {0.2855668206905442},
- {0.2529340259932361},
- {0.30030238767981526},
- {0.11573883883425837},
- {0.1410397169189421},
- {0.2581580890414215},
- {0.29930605952132744},
- {0.2767590242330228},
- {0.19120933715827945},
- {0.2205663633905271},
- {0.20955809572405326},
- {0.02087798145334181},
- {0.29732148486601057},
- {0.14104070069711602},
- {0.03744127111561652},
- {0.199510376987373},
- {0.2681349215390595},
- {0.23749413552405915},
- {0.28197098305680635},
- {0.10867377517738817},
- {0.13243020788795698},
- {0.24239930529186712},
- {0.2810354739106202},
- {0.2598647807490384},
- {0.17953731631879496},
- {0.20710229710461944},
- {0.15614385407471984},
- {0.015556394889740012},
- {0.2215372419079903},
- {0.10509085087910991},
- {0.0278978693390456},
- {0.14865719734221186},
- {0.19979003873113435},
- {0.17695927953889104},
- {0.2100994279395606},
- {0.08097392770447533},
- {0.09867508570401896},
- {0.18061417108478908},
- {0.20940237062424694},
- {0.19362787328373082},
- {0.13377506807068684},
- {0.15431401371496245},
- {0.025058016526480473},
- {0.0024964953154866017},
- {0.035552368691404636},
- {0.01686501395597985},
- {0.004477059152240935},
- {0.02385655541715306},
- {0.03206237044690368},
- {0.028398482780357656},
- {0.033716824582761276},
- {0.012994722274895395},
- {0.015835409872360172},
- {0.0289850209653046},
- {0.03360496059790872},
- {0.03107346413012958},
- {0.021468266467549957},
- {0.02476436314993656},
- {0.6429734670568275},
- {0.06405855175301875},
- {0.9122521623145301},
- {0.43274600301180366},
- {0.11487861548390373},
- {0.6121447055632021},
- {0.8227009295217167},
- {0.7286877998960603},
- {0.865153216624916},
- {0.33343667188105314},
- {0.4063269882968431},
- {0.7437380130658864},
- {0.8622828547946638},
- {0.7973261947569475},
- {0.5508626633617757},
- {0.6354384999763383},
- {0.34401686396875303},
- {0.034273921419071374},
- {0.4880918795369537},
- {0.23153665038867866},
- {0.061464715203173245},
- {0.32752222710974827},
- {0.4401783405678618},
- {0.38987750595683157},
- {0.46289203471825047},
- {0.17840213332249347},
- {0.21740140677903558},
- {0.3979299799732861},
- {0.46135627480607405},
- {0.42660182905522853},
- {0.2947338508300281},
- {0.3399853511957562},
- {0.02188784350986324},
- {0.002180655389493123},
- {0.03105452027697753},
- {0.014731364945427863},
- {0.003910651507675984},
- {0.020838383241675015},
- {0.028006053318524956},
- {0.024805696267186497},
- {0.029451196958749988},
- {0.011350716737953783},
- {0.013832019499008806},
- {0.02531802955546217},
- {0.029353485258693645},
- {0.027142256829102377},
- {0.01875224467081062},
- {0.021631341198710886},
- {0.6673035087471993},
- {0.06648251994864267},
- {0.94677167871517},
- {0.44912106175693917},
- {0.1192256090182552},
- {0.635308190481277},
- {0.8538318376221624},
- {0.7562612620357813},
- {0.8978905143634915},
- {0.3460538770125487},
- {0.4217023545781888},
- {0.7718809735327264},
- {0.8949115383732863},
- {0.82749692582624},
- {0.571707242884801},
- {0.6594834193831376},
- {0.22954443361431673},
- {0.022869192484113017},
- {0.32567814480813884},
- {0.1544922788414603},
- {0.04101218491387443},
- {0.21853842643259325},
- {0.29370794998037403},
- {0.2601448378180438},
- {0.30886360833645204},
- {0.11903839880598753},
- {0.145060571189272},
- {0.26551783193809064},
- {0.30783887619064615},
- {0.2846490549899566},
- {0.19666046040664556},
- {0.2268544163128088},
- {0.3515936642056134},
- {0.035028787482700566},
- {0.49884186029609784},
- {0.23663612989461977},
- {0.0628184449690264},
- {0.3347357411779643},
- {0.44987304947427836},
- {0.3984643640119895},
- {0.47308700143538374},
- {0.1823313515312178},
- {0.22218956457855202},
- {0.4066941897615286},
- {0.4715174171753771},
- {0.4359975220516169},
- {0.30122521722706197},
- {0.34747335936998053},
- {0.4016632029015832},
- {0.04001714594558887},
- {0.5698806313834475},
- {0.27033486530668427},
- {0.07176425623187652},
- {0.3824045869283612},
- {0.5139382996539678},
- {0.45520863708625037},
- {0.5404580900994755},
- {0.20829668478489657},
- {0.25383100222118427},
- {0.46461045090263553},
- {0.538664985429849},
- {0.49808679448214627},
- {0.3441219164728486},
- {0.39695613617741343},
- {0.6012714149125197},
- {0.05990383433097446},
- {0.8530851994603137},
- {0.404678909566338},
- {0.10742780412289274},
- {0.5724421490205347},
- {0.7693420915293352},
- {0.681426477018641},
- {0.8090410029784404},
- {0.31181059523864146},
- {0.37997338255451335},
- {0.6955005616131094},
- {0.8063568074285266},
- {0.745613114430356},
- {0.5151347450434376},
- {0.5942251516529433},
- {0.26944793772200254},
- {0.026844723068150424},
- {0.38229332377157466},
- {0.1813488799198994},
- {0.048141653764012936},
- {0.25652867023651127},
- {0.3447654999455972},
- {0.3053678495069586},
- {0.3625557849225175},
- {0.1397317746414833},
- {0.17027758476338523},
- {0.31167487321580434},
- {0.36135291557361937},
- {0.33413182639152883},
- {0.2308474862738958},
- {0.2662902936749869},
- {0.3620111912650925},
- {0.03606667120647658},
- {0.5136222704885763},
- {0.2436475283849691},
- {0.0646797209728981},
- {0.34465377724205265},
- {0.4632025407118906},
- {0.41027064414992026},
- {0.48710430931286247},
- {0.1877337292807129},
- {0.22877291927739357},
- {0.4187443151138899},
- {0.485488219133764},
- {0.44891588903670104},
- {0.31015035488149156},
- {0.3577688040614071},
- {0.6744049397713864},
- {0.06719002563914292},
- {0.9568472045949487},
- {0.45390059940325594},
- {0.1204944056417727},
- {0.6420691279477589},
- {0.8629182995119136},
- {0.7643093797486559},
- {0.9074458478383522},
- {0.3497365756737183},
- {0.4261901028734083},
- {0.7800953159130264},
- {0.9044351696433184},
- {0.8363031320943807},
- {0.5777913402979806},
- {0.6665016291676729},
- {0.024093184798800828},
- {0.0024003704731296797},
- {0.03418346332447815},
- {0.016215644899363026},
- {0.0043046748491092105},
- {0.02293798464538855},
- {0.030827843674239932},
- {0.027305030025408038},
- {0.03241859484938715},
- {0.012494374598535814},
- {0.015225684603422034},
- {0.02786898419418856},
- {0.03231103806585105},
- {0.029877014121806617},
- {0.020641654169474243},
- {0.023810838226781143},
- {0.6695754154827858},
- {0.06670886685509554},
- {0.9499950649640654},
- {0.45065014283013016},
- {0.11963152545752508},
- {0.6374711657065045},
- {0.8567388001624819},
- {0.758836035032716},
- {0.9009474794186151},
- {0.34723205474390306},
- {0.42313808570685835},
- {0.7745089255213683},
- {0.8979583611834964},
- {0.8303142283202598},
- {0.5736536818273026},
- {0.6617287017814227},
- {0.33373467139660784},
- {0.033249520881935286},
- {0.47350348221130667},
- {0.22461633724082647},
- {0.059627619106138625},
- {0.3177330366266149},
- {0.4270220132541603},
- {0.378224601649908},
- {0.4490568262166188},
- {0.1730699380663039},
- {0.21090357668963522},
- {0.3860363982543189},
- {0.44756696806338353},
- {0.41385128506336877},
- {0.28592465997582767},
- {0.32982365501501115},
- {0.39341767593089566},
- {0.03919565556807689},
- {0.5581818596707298},
- {0.26478530685348034},
- {0.07029104657259823},
- {0.37455440968420617},
- {0.5033879378571855},
- {0.44586390481485966},
- {0.5293633178468791},
- {0.20402067463536966},
- {0.24862024266020888},
- {0.45507271387293885},
- {0.5276070228546337},
- {0.48786183967429414},
- {0.33705762349558827},
- {0.3888072380374144},
- {0.6637274976796576},
- {0.06612624694240483},
- {0.941698026385847},
- {0.44671426804694625},
- {0.11858669120680215},
- {0.6319036390430173},
- {0.8492562403697386},
- {0.752208535491498},
- {0.8930788111808831},
- {0.34419940977546504},
- {0.41944249490801977},
- {0.7677445425564228},
- {0.8901157992174982},
- {0.823062454665333},
- {0.5686435224020657},
- {0.6559493153725023},
- {0.15552548489626722},
- {0.015494787629020998},
- {0.220659898364198},
- {0.10467466451361963},
- {0.02778738671617202},
- {0.14806847721911576},
- {0.1989988196156252},
- {0.17625847600770841},
- {0.2092673810337235},
- {0.0806532504581795},
- {0.09828430739230049},
- {0.17989889325811806},
- {0.2085730842417872},
- {0.19286105790289174},
- {0.13324528494582094},
- {0.1537028911674238},
- {0.646043956990007},
- {0.06436446039212956},
- {0.916608580152003},
- {0.4348125614530932},
- {0.11542721297735171},
- {0.6150679741775117},
- {0.826629699605616},
- {0.732167614645265},
- {0.8692847156344544},
- {0.33502898322330826},
- {0.40826738396022183},
- {0.7472896994091737},
- {0.8664006465245774},
- {0.8011337889733435},
- {0.5534932824294011},
- {0.638473007024138},
- {0.6327640556822088},
- {0.06304140230530902},
- {0.8977670271112275},
- {0.4258746744238715},
- {0.1130545230388602},
- {0.602424806624764},
- {0.8096377276042013},
- {0.7171173791960299},
- {0.8514159388939554},
- {0.3281422198934776},
- {0.39987515227455567},
- {0.7319286185583833},
- {0.8485911539128588},
- {0.7846659038754368},
- {0.542115827249048},
- {0.6253487320746783},
- {0.16391480020251567},
- {0.016330603438307282},
- {0.23256267728211427},
- {0.11032099807603381},
- {0.029286286712234485},
- {0.15605554855431045},
- {0.20973316225046892},
- {0.18576616493479167},
- {0.22055562774117282},
- {0.08500382714352979},
- {0.10358593397086546},
- {0.18960295262687116},
- {0.21982387937203968},
- {0.20326431898980082},
- {0.14043276749395117},
- {0.16199389259619645},
- {0.5561285808368304},
- {0.055406316593341436},
- {0.7890364476711299},
- {0.3742960368479634},
- {0.0993622360344098},
- {0.5294637863206801},
- {0.7115806854089302},
- {0.6302656840324825},
- {0.7482990437698878},
- {0.28840017921886796},
- {0.351445375174797},
- {0.6432831009559827},
- {0.7458163748372905},
- {0.6896332552942209},
- {0.47645896278377065},
- {0.5496113437130249},
- {0.45169768327040305},
- {0.04500201159613082},
- {0.6408696616395058},
- {0.30401000510909487},
- {0.08070380370268773},
- {0.43004005529936323},
- {0.5779586918110302},
- {0.5119131782328535},
- {0.6077820060168564},
- {0.2342438373009158},
- {0.2854502847591109},
- {0.5224861594985568},
- {0.6057655374449765},
- {0.5601325924553096},
- {0.3869885797615447},
- {0.4464042655041068},
- {0.24725305518933516},
- {0.02463347780809464},
- {0.3508031758570367},
- {0.16641086584088388},
- {0.04417614428840132},
- {0.23539796962586118},
- {0.31636658237620874},
- {0.28021418306452756},
- {0.3326914514786427},
- {0.1282218319398672},
- {0.15625153199890332},
- {0.2860016865590712},
- {0.3315876645132531},
- {0.30660882250483024},
- {0.21183218823848513},
- {0.24435551162516606},
- {0.2518649294855597},
- {0.025092952426286008},
- {0.35734651320237354},
- {0.16951483555400373},
- {0.04500013744065569},
- {0.23978871757706297},
- {0.3222675930162106},
- {0.2854408630233384},
- {0.33889696086040977},
- {0.1306134827548004},
- {0.15916600528466165},
- {0.29133631761513085},
- {0.33777258556809214},
- {0.3123278270543307},
- {0.2157833767214827},
- {0.24891333964610574},
- {0.07719674703848063},
- {0.007691004479493006},
- {0.10952691365610832},
- {0.05195639546268125},
- {0.013792568238057641},
- {0.07349538108099127},
- {0.0987752042635963},
- {0.08748779015111591},
- {0.10387211515746525},
- {0.0400331082562067},
- {0.04878447297995078},
- {0.0892947504044907},
- {0.10352749347792198},
- {0.09572866022847316},
- {0.06613773017903439},
- {0.07629208303995144},
- {0.3609580585109307},
- {0.035961749055732045},
- {0.5121280834320154},
- {0.24293872932349234},
- {0.06449156012502882},
- {0.34365113922859575},
- {0.4618550305265564},
- {0.4090771190218284},
- {0.48568726609649654},
- {0.18718758997856716},
- {0.22810739218770806},
- {0.4175261390892085},
- {0.4840758773121128},
- {0.4476099403864506},
- {0.3092480913456623},
- {0.35672801290614564},
- {0.6795730825935409},
- {0.06770492051646251},
- {0.9641797769423611},
- {0.45737895934168227},
- {0.12141778603373485},
- {0.6469894729204028},
- {0.8695310699006359},
- {0.7701664839925726},
- {0.9143998445670677},
- {0.3524166992413567},
- {0.42945610997262257},
- {0.7860733919468391},
- {0.9113660947514304},
- {0.8427119434396002},
- {0.582219107640664},
- {0.6716092068374108},
- {0.03211163462747727},
- {0.0031992374709864622},
- {0.04556005749111451},
- {0.0216123716563689},
- {0.0057373131488854},
- {0.030571972455051357},
- {0.041087654483497354},
- {0.036392413663462214},
- {0.04320782335889237},
- {0.01665262585073371},
- {0.0202929427977753},
- {0.037144057348834365},
- {0.04306447061563901},
- {0.03982037946627896},
- {0.027511400519780627},
- {0.031735320328029906},
- {0.46113166953578694},
- {0.0459419065192987},
- {0.6542546220006794},
- {0.31035944261776943},
- {0.0823893526968357},
- {0.43902170857215733},
- {0.5900297175489251},
- {0.5226048024571618},
- {0.6204759101688465},
- {0.23913616512479965},
- {0.2914120909972343},
- {0.533398606994135},
- {0.6184173264001962},
- {0.5718313090521222},
- {0.3950710762665031},
- {0.4557276954563775},
- {0.5334009649203333},
- {0.05314199584761308},
- {0.7567904564656388},
- {0.35899947260422876},
- {0.09530154428971241},
- {0.507825895387106},
- {0.6825001219046477},
- {0.6045082658999996},
- {0.7177178906993283},
- {0.2766139687463325},
- {0.33708266162646106},
- {0.6169936928084981},
- {0.7153366823783454},
- {0.6614496296190475},
- {0.45698724944397506},
- {0.5271500713496027},
- {0.3127110422262491},
- {0.031154965964435597},
- {0.44367511113069485},
- {0.21046662195954097},
- {0.05587137482036257},
- {0.29771743108807136},
- {0.4001217441971086},
- {0.35439832751747113},
- {0.42076847322264105},
- {0.16216739029319918},
- {0.19761769731584994},
- {0.36171801967771944},
- {0.4193724687442396},
- {0.38778070656327374},
- {0.267912824415449},
- {0.30904640048035265},
- {0.5505636020783424},
- {0.05485188550392676},
- {0.7811408436287063},
- {0.37055059098127047},
- {0.09836795386301823},
- {0.5241656325738802},
- {0.7044601533310926},
- {0.6239588419375},
- {0.7408110842816159},
- {0.2855142623165536},
- {0.34792858766376206},
- {0.6368459982501166},
- {0.7383532585244107},
- {0.6827323432585828},
- {0.47169120924880026},
- {0.5441115806032336},
- {0.23012188408379866},
- {0.022926723070800265},
- {0.32649743279808613},
- {0.15488092533374784},
- {0.04111535668354055},
- {0.21908818978322792},
- {0.29444681256543553},
- {0.2607992677964407},
- {0.3096405970563765},
- {0.11933785620599746},
- {0.14542549092885196},
- {0.2661857784192765},
- {0.3086132870564734},
- {0.28536512868363506},
- {0.19715518673654278},
- {0.22742509967524654},
- {0.5682621258987293},
- {0.056615164802666595},
- {0.8062515479612322},
- {0.38246238180141123},
- {0.10153010909455787},
- {0.5410155621713273},
- {0.7271058653926566},
- {0.6440167433049072},
- {0.7646253403858528},
- {0.2946924589020058},
- {0.3591131671988335},
- {0.6573181726317856},
- {0.7620885048874549},
- {0.7046795889437255},
- {0.4868542859055987},
- {0.5616026964959336},
- {0.03474283321662075},
- {0.0034613801248142297},
- {0.04929320780820673},
- {0.02338327003852796},
- {0.00620742345120879},
- {0.033077012504374566},
- {0.04445434010266187},
- {0.03937437545387482},
- {0.04674823371734224},
- {0.01801712710245423},
- {0.0219557283606562},
- {0.040187608149816915},
- {0.04659313477866241},
- {0.043083225705229905},
- {0.02976566004511376},
- {0.03433568406042233},
- {0.07028014053245879},
- {0.007001912598533466},
- {0.09971361720722156},
- {0.04730125186307476},
- {0.012556793793280242},
- {0.06691040631911503},
- {0.0899252300528608},
- {0.07964913578067921},
- {0.09456547239006667},
- {0.036446256897261074},
- {0.044413524511904875},
- {0.08129419759242168},
- {0.09425172782183039},
- {0.08715164760099856},
- {0.060211979776341906},
- {0.06945653182625781},
- {0.1765271320894434},
- {0.01758715251272438},
- {0.250457081367472},
- {0.11880958507435843},
- {0.031539703531789955},
- {0.16806315475418868},
- {0.2258709621729263},
- {0.20005983776131286},
- {0.23752615616914},
- {0.09154439869819517},
- {0.11155629525882611},
- {0.20419184491919043},
- {0.23673810383430138},
- {0.21890437741467983},
- {0.15123828761321545},
- {0.1744584213303577},
- {0.49054636906254434},
- {0.04887245209928878},
- {0.6959882620682019},
- {0.3301566726780768},
- {0.08764481054951608},
- {0.4670260563463487},
- {0.6276665748721939},
- {0.5559407545313119},
- {0.6600548713787348},
- {0.25439019972669147},
- {0.3100007060532698},
- {0.5674230750349399},
- {0.6578649745231597},
- {0.6083073250080273},
- {0.42027189800097736},
- {0.48479768590263245},
- {0.06216778384359126},
- {0.006193689790877797},
- {0.08820378778181531},
- {0.04184132215838102},
- {0.011107377367133499},
- {0.059187014217942084},
- {0.07954526302390535},
- {0.0704553266260932},
- {0.0836498874656858},
- {0.03223930691559267},
- {0.03928692189101327},
- {0.0719105008239097},
- {0.0833723580761251},
- {0.07709183203994034},
- {0.05326177943257668},
- {0.06143924335361949},
- {0.43082991986613933},
- {0.04292298536800245},
- {0.6112624332489677},
- {0.2899651935147263},
- {0.07697540760090021},
- {0.4101728422037153},
- {0.551257856972056},
- {0.48826354822026624},
- {0.5797033782694212},
- {0.22342211924314104},
- {0.2722629047333716},
- {0.49834807342408993},
- {0.5777800675565001},
- {0.5342552969824945},
- {0.36911028101945975},
- {0.4257810501540798},
- {0.6106695367888403},
- {0.06084015613496929},
- {0.8664192753477892},
- {0.41100420895452583},
- {0.10910694530774241},
- {0.5813896575004125},
- {0.7813672278678523},
- {0.6920774557978414},
- {0.8216866497867762},
- {0.31668432431290183},
- {0.3859125242972231},
- {0.7063715241783936},
- {0.8189604991458797},
- {0.7572673570040181},
- {0.5231865150038472},
- {0.6035131375087519},
- {0.5149442437978193},
- {0.05130317840677909},
- {0.7306040201414141},
- {0.3465773856851032},
- {0.09200392366061803},
- {0.49025412190643625},
- {0.6588842770815},
- {0.5835910924906167},
- {0.6928834418991562},
- {0.26704258208694504},
- {0.3254189394174029},
- {0.5956444991035011},
- {0.6905846280633829},
- {0.6385621731775462},
- {0.4411745929730744},
- {0.5089096434229938},
- {0.5109547416228051},
- {0.050905709856923144},
- {0.7249437057238153},
- {0.34389229647271785},
- {0.09129112832796842},
- {0.4864559050912905},
- {0.6537796074242325},
- {0.579069752635181},
- {0.6875153655845225},
- {0.2649736843860989},
- {0.3228977741024523},
- {0.5910297761440158},
- {0.6852343616823648},
- {0.6336149479013009},
- {0.4377566171059276},
- {0.504966893982107},
- {0.15753320437620924},
- {0.015694813926840287},
- {0.22350845515656753},
- {0.10602593734932601},
- {0.028146101415849386},
- {0.149979932221339},
- {0.2015677478327225},
- {0.1785338431349776},
- {0.21196886881688706},
- {0.08169442452796964},
- {0.0995530854234749},
- {0.182221255491261},
- {0.21126560916465195},
- {0.19535075213616884},
- {0.13496538345169976},
- {0.15568708230449738},
- {0.4836422023111398},
- {0.04818459957377045},
- {0.6861926151703927},
- {0.3255099015142937},
- {0.0864112586875677},
- {0.46045292488799533},
- {0.6188325176443683},
- {0.5481161982502798},
- {0.6507649669283471},
- {0.2508097994432429},
- {0.3056376188863316},
- {0.5594369114921894},
- {0.6486058916505327},
- {0.5997457384326698},
- {0.4143568052641314},
- {0.4779744286628259},
- {0.36144748169541774},
- {0.03601050960651512},
- {0.5128224781173497},
- {0.24326813004952472},
- {0.06457900425872995},
- {0.3441170959538943},
- {0.4624812599581535},
- {0.40963178686085217},
- {0.48634580966640156},
- {0.18744139771113782},
- {0.22841668309743343},
- {0.41809226295812174},
- {0.4847322359992822},
- {0.4482168548942905},
- {0.3096674009637584},
- {0.35721170057000473},
- {0.4780731851704725},
- {0.0476297661459591},
- {0.6782912814624942},
- {0.3217617376602555},
- {0.08541625498756363},
- {0.455150926388034},
- {0.6117068183536627},
- {0.541804779419279},
- {0.6432715735932504},
- {0.2479217882947696},
- {0.3021182793202701},
- {0.5529951375230565},
- {0.6411373595189718},
- {0.5928398185575778},
- {0.4095855918757191},
- {0.47247067449641117},
- {0.5018428896271402},
- {0.04999790872276132},
- {0.7120157901695633},
- {0.33775966778244154},
- {0.08966313433538937},
- {0.4777809406599373},
- {0.642120760690149},
- {0.5687432061695976},
- {0.675254909333436},
- {0.2602484107009894},
- {0.31713954056887805},
- {0.5804899466707611},
- {0.6730145825564029},
- {0.622315697386116},
- {0.4299501067043924},
- {0.49596182322757776},
- {0.45913421811290395},
- {0.04574290321371505},
- {0.6514206335501386},
- {0.30901508058146404},
- {0.0820324725676952},
- {0.43712002930266197},
- {0.5874739275723924},
- {0.5203410722142912},
- {0.617788238574139},
- {0.23810031591979455},
- {0.2901498018632138},
- {0.5310881219919298},
- {0.6157385718271323},
- {0.5693543478339411},
- {0.39335977484098433},
- {0.4537536520456247},
- {0.4091398655771744},
- {0.04076203544334149},
- {0.5804885367514953},
- {0.27536694836221054},
- {0.0731000946460862},
- {0.38952276474850545},
- {0.5235048799999428},
- {0.4636820083134958},
- {0.5505183166793003},
- {0.21217397311335273},
- {0.25855587810352904},
- {0.47325882992232},
- {0.5486918346958946},
- {0.507358310813758},
- {0.35052749077031764},
- {0.4043451802963784},
- {0.6399130413470763},
- {0.06375364579848262},
- {0.9079100236192847},
- {0.4306862181820008},
- {0.11433181614249872},
- {0.6092310186212367},
- {0.8187850368680593},
- {0.7252193910247082},
- {0.861035259535407},
- {0.3318495796984321},
- {0.40439295271798537},
- {0.7401979681758148},
- {0.8581785600560786},
- {0.7935310807895518},
- {0.5482406667415864},
- {0.6324139392099429},
- {0.3061758873200515},
- {0.030503877575533765},
- {0.4344030190465089},
- {0.20606821003491632},
- {0.05470375347039717},
- {0.29149561839932053},
- {0.3917598470250407},
- {0.3469919757866987},
- {0.41197509281439587},
- {0.15877835417616593},
- {0.1934878071304219},
- {0.3541586982219499},
- {0.4106082625712602},
- {0.3796767171135112},
- {0.26231387979089327},
- {0.30258783065831024},
- {0.035075478215733896},
- {0.0034945210831629652},
- {0.049765165260997335},
- {0.02360715298419134},
- {0.006266856381031982},
- {0.033393708115425635},
- {0.04487996785247219},
- {0.03975136511980883},
- {0.04719582433456361},
- {0.018189631952350876},
- {0.022165943319105964},
- {0.04057238410617041},
- {0.04703924040224501},
- {0.04349572573040493},
- {0.03005065113658791},
- {0.03466443081295731},
- {0.5787802480645718},
- {0.05766307067690021},
- {0.8211746827107884},
- {0.38954148468771427},
- {0.10340935819862046},
- {0.5510293700905871},
- {0.7405640706313137},
- {0.655937028810854},
- {0.7787780040506325},
- {0.3001470038079886},
- {0.36576009296040213},
- {0.6694846580026612},
- {0.7761942135565193},
- {0.7177226999773241},
- {0.49586560765789817},
- {0.5719975574257707},
- {0.17651073476500206},
- {0.017585518870109007},
- {0.25043381680766635},
- {0.11879854904102946},
- {0.031536773858909226},
- {0.1680475436351356},
- {0.22584998137861556},
- {0.20004125452128269},
- {0.23750409274240264},
- {0.09153589528464919},
- {0.11154593297204797},
- {0.20417287786358945},
- {0.23671611360849157},
- {0.2188840437353433},
- {0.1512242393293024},
- {0.17444221616516736},
- {0.2050082366365497},
- {0.020424685324094177},
- {0.29086613483453766},
- {0.13797846961719795},
- {0.036628358080477125},
- {0.1951786707908127},
- {0.26231326093832563},
- {0.23233773797707136},
- {0.27584891826498514},
- {0.10631428454613501},
- {0.12955492510426328},
- {0.2371364082504709},
- {0.2749337205974633},
- {0.2542226788291486},
- {0.17563925889764562},
- {0.20260575753992938},
- {0.18873324776971137},
- {0.018803230831767475},
- {0.2677751450097492},
- {0.1270247728598115},
- {0.0337205426202272},
- {0.17968402166704936},
- {0.24148899811144273},
- {0.21389314198931633},
- {0.253950100210903},
- {0.097874312446664},
- {0.11926994827450771},
- {0.21831086022607324},
- {0.2531075573405456},
- {0.2340407030435739},
- {0.16169578506441287},
- {0.18652149428095832},
- {0.6328442439189897},
- {0.06304939134774856},
- {0.8978807983570775},
- {0.42592864420759263},
- {0.11306885008980624},
- {0.6025011500621045},
- {0.8097403304957922},
- {0.7172082572692805},
- {0.8515238362093828},
- {0.3281838043447281},
- {0.39992582721903996},
- {0.7320213736143075},
- {0.8486986932519995},
- {0.7847653421648414},
- {0.5421845279154777},
- {0.6254279805903737},
- {0.5888306383404175},
- {0.05866437707383493},
- {0.8354341984311078},
- {0.3963057859278407},
- {0.10520503870352066},
- {0.5605978725427403},
- {0.7534238010022147},
- {0.6673272294232152},
- {0.7923013108758503},
- {0.30535898977068066},
- {0.37211143562262006},
- {0.6811101101826864},
- {0.7896726534344913},
- {0.7301857950271762},
- {0.5044762036448835},
- {0.5819301677872737},
- {0.5157877992574507},
- {0.05138722066331992},
- {0.7318008584738004},
- {0.3471451311243438},
- {0.09215463980716437},
- {0.4910572312646279},
- {0.6599636277799332},
- {0.5845471017249989},
- {0.6940184882995033},
- {0.2674800376576921},
- {0.3259520241665176},
- {0.5966202536153148},
- {0.6917159086638689},
- {0.6396082332393603},
- {0.44189730274415245},
- {0.5097433133073339},
- {0.26584568599878144},
- {0.02648583574190409},
- {0.3771824411425419},
- {0.17892442523407556},
- {0.04749804759394438},
- {0.25309913630788833},
- {0.34015632710580523},
- {0.30128538418396295},
- {0.35770877361472125},
- {0.1378636993826912},
- {0.1680011423147046},
- {0.3075080892403237},
- {0.3565219854361654},
- {0.3296648152220326},
- {0.22776128430752798},
- {0.2627302565213255},
- {0.004686031478610467},
- {0.00046686279507442407},
- {0.006648551718011301},
- {0.0031538803640507687},
- {0.0008372426483489438},
- {0.004461349506169239},
- {0.005995896643865903},
- {0.005310722982120424},
- {0.006305291609439216},
- {0.0024301076492470996},
- {0.0029613369063014668},
- {0.005420409891902923},
- {0.006284372230054663},
- {0.005810963964740917},
- {0.004014722089109682},
- {0.004631116159800982},
- {0.16984568466227914},
- {0.016921489203541126},
- {0.2409774291343531},
- {0.11431271262692462},
- {0.030345944427896347},
- {0.16170206385760894},
- {0.2173218799937814},
- {0.1924876913582775},
- {0.2285359317983254},
- {0.0880794974112732},
- {0.10733395553620828},
- {0.19646330449180738},
- {0.22777770677775147},
- {0.21061897634369184},
- {0.1455140079758504},
- {0.16785527338053288},
- {0.02417702986852377},
- {0.0024087238407463373},
- {0.03430242289290993},
- {0.01627207587304058},
- {0.004319655258128284},
- {0.023017809580861262},
- {0.030935125576730598},
- {0.027400052421383738},
- {0.03253141261790408},
- {0.012537855430070004},
- {0.015278670482948304},
- {0.027965969169084268},
- {0.03242348153324963},
- {0.029980987106411},
- {0.02071348779991743},
- {0.02389370072121507},
- {0.19801945136663665},
- {0.019728402373333016},
- {0.2809504309974668},
- {0.13327474691880029},
- {0.03537968761916405},
- {0.18852497803288548},
- {0.2533709321605862},
- {0.22441728274337377},
- {0.2664451553317447},
- {0.10269000233188125},
- {0.12513836327695207},
- {0.22905236507185886},
- {0.26556115699593147},
- {0.2455561601456635},
- {0.16965166988394906},
- {0.19569887342090275},
- {0.5562613813683044},
- {0.055419547325485326},
- {0.7892248653558412},
- {0.3743854167401949},
- {0.0993859632050831},
- {0.5295902194418008},
- {0.7117506070717707},
- {0.6304161881077872},
- {0.7484777335803712},
- {0.28846904763958436},
- {0.35152929845120384},
- {0.6434367135208443},
- {0.7459944717997076},
- {0.6897979360281034},
- {0.47657273863644856},
- {0.5497425879631216},
- {0.5108297920341069},
- {0.05089326130328253},
- {0.7247664269738974},
- {0.3438082005685204},
- {0.09126880386748851},
- {0.48633694648241654},
- {0.6536197312426602},
- {0.5789281461062162},
- {0.6873472396133639},
- {0.2649088873499177},
- {0.3228188122281823},
- {0.5908852448941382},
- {0.6850667935110976},
- {0.6334600028138321},
- {0.4376495674891972},
- {0.5048434086700638},
- {0.09006879973003432},
- {0.008973429176244293},
- {0.1277898101875115},
- {0.06061978460426595},
- {0.016092388786501596},
- {0.085750255206565},
- {0.11524532357142425},
- {0.10207580697689483},
- {0.12119211102236278},
- {0.04670836723601445},
- {0.056918964792340015},
- {0.10418406603475668},
- {0.12079002593162781},
- {0.11169078824325225},
- {0.07716576413673373},
- {0.08901328892637467},
- {0.06718559453184748},
- {0.006693607286901164},
- {0.09532306856862598},
- {0.04521850275830906},
- {0.012003898256659198},
- {0.06396423505785431},
- {0.08596567961790386},
- {0.07614205806690584},
- {0.09040160472896765},
- {0.0348414704289332},
- {0.042457926620237445},
- {0.07771468519921088},
- {0.09010167483144052},
- {0.08331422239827294},
- {0.05756075085457116},
- {0.06639825062262235},
- {0.08428092401675696},
- {0.008396791173410113},
- {0.11957795945778558},
- {0.05672432046899628},
- {0.01505828212020669},
- {0.08023989178432532},
- {0.10783958916209349},
- {0.09551635369356494},
- {0.11340423244365844},
- {0.0437068592205588},
- {0.05326131758338517},
- {0.09748913474533732},
- {0.11302798558478969},
- {0.10451347043056292},
- {0.07220704531865052},
- {0.0832932409776941},
- {0.14564268506014938},
- {0.014510178034375426},
- {0.2066381603265639},
- {0.09802315811908327},
- {0.026021649216186778},
- {0.1386595297185096},
- {0.18635352548137657},
- {0.16505820719668238},
- {0.1959695755945422},
- {0.07552817445573459},
- {0.0920388734839128},
- {0.1684672957035762},
- {0.19531939759269448},
- {0.18060578518853573},
- {0.12477827080274116},
- {0.14393590726344554},
- {0.6803837442185459},
- {0.06778568560603497},
- {0.9653299454301857},
- {0.4579245659584245},
- {0.12156262511322716},
- {0.6477612656104208},
- {0.870568332099762},
- {0.7710852143387702},
- {0.9154906306545213},
- {0.35283709654873024},
- {0.42996840746776466},
- {0.7870110976176653},
- {0.9124532618836628},
- {0.843717213146388},
- {0.5829136358672788},
- {0.6724103683679782},
- {0.35782195622205465},
- {0.03564930354893017},
- {0.507678574640677},
- {0.24082801123000788},
- {0.06393123982034954},
- {0.3406654041857057},
- {0.457842307762204},
- {0.40552294518073567},
- {0.48146748235439996},
- {0.18556125302462104},
- {0.22612553280576064},
- {0.4138985578520283},
- {0.4798700937562867},
- {0.4437209828594721},
- {0.3065612593876765},
- {0.3536286624098683},
- {0.18401332130133732},
- {0.018332991126031595},
- {0.2610785030060765},
- {0.12384807985714681},
- {0.032877244030699686},
- {0.17519040234013017},
- {0.2354497319647694},
- {0.20854400550059918},
- {0.24759920118385806},
- {0.0954266273495761},
- {0.11628719143439151},
- {0.212851243440525},
- {0.24677772900688158},
- {0.22818770723056214},
- {0.15765202369873513},
- {0.18185688034472394},
- {0.33113331300733073},
- {0.03299035116569421},
- {0.46981266923509507},
- {0.22286552246690763},
- {0.059162840284851456},
- {0.3152564060238661},
- {0.4236935089308423},
- {0.375276458035055},
- {0.44555656735153815},
- {0.17172091150746185},
- {0.2092596486366876},
- {0.38302736410463717},
- {0.444078322181124},
- {0.4106254424866671},
- {0.2836959658164324},
- {0.32725278178699185},
- {0.3236559923353992},
- {0.03224539611268187},
- {0.45920383030039946},
- {0.2178329965544038},
- {0.05782688430792349},
- {0.3081376017564474},
- {0.4141260866617888},
- {0.3668023410944479},
- {0.4354954554044633},
- {0.16784328195169063},
- {0.20453435693365202},
- {0.3743782239697343},
- {0.43405059048525535},
- {0.40135311019958425},
- {0.27728982778556677},
- {0.3198630873827058},
- {0.23795694169934956},
- {0.023707318957674226},
- {0.3376138296913556},
- {0.16015422204071317},
- {0.04251522871127937},
- {0.22654757851834384},
- {0.3044719683664605},
- {0.2696788113366565},
- {0.32018306209706265},
- {0.12340100292849618},
- {0.1503768544409915},
- {0.2752487187765518},
- {0.31912077483686846},
- {0.29508107653278093},
- {0.20386781319289057},
- {0.23516833872559728},
- {0.19230886873339711},
- {0.019159464972500997},
- {0.2728482438588673},
- {0.12943130401482644},
- {0.03435939073270637},
- {0.1830882017058309},
- {0.24606409621604555},
- {0.21794542642527753},
- {0.2587612784891052},
- {0.09972857738157169},
- {0.121529561418602},
- {0.222446839962813},
- {0.257902773333429},
- {0.2384746904519793},
- {0.16475917132861473},
- {0.1900552127593409},
- {0.10478201955725665},
- {0.010439286792531222},
- {0.14866495868070168},
- {0.0705223504143443},
- {0.018721166503875484},
- {0.0997580177045246},
- {0.13407126312927437},
- {0.11875043561182443},
- {0.14098949009415868},
- {0.054338428666542725},
- {0.06621698190634367},
- {0.1212030900548144},
- {0.14052172225482526},
- {0.12993607545729652},
- {0.08977120413684908},
- {0.10355408542242349},
- {0.4580666710548128},
- {0.04563654498592916},
- {0.6499059954476147},
- {0.3082965801361337},
- {0.08184173634873614},
- {0.4361036681104321},
- {0.5861079739180061},
- {0.5191312112217269},
- {0.6163518001851124},
- {0.23754670156964774},
- {0.2894751656562722},
- {0.5298532727041771},
- {0.6143068991811488},
- {0.5680305245703655},
- {0.3924451619590936},
- {0.45269861550678786},
- {0.6626224351317221},
- {0.0660161510985728},
- {0.9401301612242232},
- {0.44597051822646605},
- {0.11838925218010168},
- {0.6308515611227086},
- {0.8478422846904669},
- {0.7509561578459809},
- {0.8915918938088581},
- {0.34362634043888635},
- {0.4187441507927679},
- {0.7664662984828733},
- {0.8886338150651472},
- {0.8216921099132442},
- {0.5676967684074982},
- {0.6548572029855724},
- {0.6357431341995826},
- {0.06333820375227235},
- {0.9019937502318859},
- {0.42787970944802733},
- {0.1135867882613433},
- {0.6052610467424394},
- {0.8134495344530598},
- {0.7204935965389935},
- {0.855424439234851},
- {0.32968712660736166},
- {0.40175778050710964},
- {0.735374567809479},
- {0.8525863550529261},
- {0.7883601423780184},
- {0.5446681302763505},
- {0.6282928989515122},
- {0.6811197044066534},
- {0.0678590082954048},
- {0.9663741273558438},
- {0.4584198956199068},
- {0.121694117455902},
- {0.6484619385864263},
- {0.871510011907513},
- {0.7719192848529672},
- {0.9164809021924178},
- {0.35321875477933},
- {0.4304334974008049},
- {0.787862394904479},
- {0.9134402479484556},
- {0.8446298485292483},
- {0.5835441642018381},
- {0.6731377038832584},
- {0.2984962262561542},
- {0.02973876363084928},
- {0.42350709912083667},
- {0.20089950121540726},
- {0.053331645793163594},
- {0.2841841753901658},
- {0.3819335250702629},
- {0.3382885446012495},
- {0.40164172166856493},
- {0.15479579384122427},
- {0.18863464644633082},
- {0.34527550761872455},
- {0.4003091749645121},
- {0.3701534704372076},
- {0.2557343881569091},
- {0.294998167076845},
- {0.5490625367857439},
- {0.05470233645772625},
- {0.7790111289062366},
- {0.36954031600273185},
- {0.09809976192136005},
- {0.5227365391218985},
- {0.7025395020526713},
- {0.6222576707047728},
- {0.7387913252514338},
- {0.28473583172635947},
- {0.3469799896720434},
- {0.6351096912710593},
- {0.7363402005491574},
- {0.6808709310244081},
- {0.47040518289261835},
- {0.5426281062037976},
- {0.2015454521459351},
- {0.0200796929241481},
- {0.28595312862037425},
- {0.13564788177122658},
- {0.03600967020549864},
- {0.19188191703495555},
- {0.2578825399752937},
- {0.2284133321636708},
- {0.27118956715016024},
- {0.10451853496213265},
- {0.12736661895279328},
- {0.23313094832299702},
- {0.27028982804343055},
- {0.24992861550830386},
- {0.17267254442981642},
- {0.1991835532108307},
- {0.37042199430437567},
- {0.03690462780870252},
- {0.5255555362491517},
- {0.2493083240225092},
- {0.06618246013363435},
- {0.3526613060341809},
- {0.47396437744850783},
- {0.4198026853243544},
- {0.49842146884845384},
- {0.1920954491913383},
- {0.2340881250257014},
- {0.42847322969781326},
- {0.4967678311666315},
- {0.4593457962191215},
- {0.3173562468826639},
- {0.36608104140977366},
- {0.06266560101045542},
- {0.006243286622443928},
- {0.0889100918677178},
- {0.04217637235909495},
- {0.011196321234685688},
- {0.05966096245787378},
- {0.08018223276977328},
- {0.07101950744327873},
- {0.08431972556207737},
- {0.03249746764512363},
- {0.03960151737667194},
- {0.07248633415066953},
- {0.08403997381736918},
- {0.07770915559631876},
- {0.05368828053169865},
- {0.061931226631285086},
- {0.46777645873435736},
- {0.04660391762018119},
- {0.6636822634588367},
- {0.31483164266001973},
- {0.08357656215791709},
- {0.4453478988986532},
- {0.5985318945907914},
- {0.5301354037493787},
- {0.6294168090448955},
- {0.2425820559884839},
- {0.29561126455766346},
- {0.5410847442439473},
- {0.6273285616116263},
- {0.5800712516906728},
- {0.4007639492432951},
- {0.4622946147731669},
- {0.3875282585612945},
- {0.038608901111329794},
- {0.5498259414167708},
- {0.2608215012575366},
- {0.06923879768817133},
- {0.36894737324123167},
- {0.4958522783120242},
- {0.43918937342965547},
- {0.5214388098501801},
- {0.20096650859640816},
- {0.24489842621641827},
- {0.4482603276750559},
- {0.5197088063920123},
- {0.48055860403358525},
- {0.33201190963010324},
- {0.3829868383929245},
- {0.18614142449663723},
- {0.01854501108588452},
- {0.26409786047727557},
- {0.12528037558775942},
- {0.03325746741659146},
- {0.17721646899861615},
- {0.2381726942121939},
- {0.21095580461018482},
- {0.25046267132540395},
- {0.09653023066015799},
- {0.11763204593684748},
- {0.21531285550255372},
- {0.24963169887120673},
- {0.23082668459074085},
- {0.15947526004383303},
- {0.18396004442769334},
- {0.37502896574083905},
- {0.03736361396179876},
- {0.5320919174063287},
- {0.25240899392144744},
- {0.06700557730302142},
- {0.35704738620389764},
- {0.47985911475455506},
- {0.42502380882667734},
- {0.5046203811852256},
- {0.19448455745463414},
- {0.23699949994995204},
- {0.4338021895351307},
- {0.5029461770638192},
- {0.4650587209244028},
- {0.3213032348775784},
- {0.3706340240272685},
- {0.0038436813682070268},
- {0.0003829406257997925},
- {0.005453423537747673},
- {0.002586946171443684},
- {0.0006867418588236615},
- {0.003659387704114861},
- {0.0049180882204735545},
- {0.004356079781209249},
- {0.005171867067248146},
- {0.0019932771550476604},
- {0.002429013877454784},
- {0.004446049627419546},
- {0.005154708106805417},
- {0.004766398609259912},
- {0.003293044991882101},
- {0.0037986374992742987},
- {0.21421340196120436},
- {0.021341783135367262},
- {0.303926443544192},
- {0.14417390178571554},
- {0.03827302415454905},
- {0.20394247444061914},
- {0.274091504453816},
- {0.2427700373047655},
- {0.28823493230479197},
- {0.11108794916408175},
- {0.13537212798242013},
- {0.24778417479026274},
- {0.28727864094282884},
- {0.2656376435461403},
- {0.1835257147892642},
- {0.21170304809020302},
- {0.4011495641256562},
- {0.03996597282912935},
- {0.5691518795639784},
- {0.2699891665513503},
- {0.07167248555320849},
- {0.3819155756808288},
- {0.5132810857562811},
- {0.45462652549261834},
- {0.5397669632304141},
- {0.20803031919942674},
- {0.25350640827199655},
- {0.46401631645974756},
- {0.5379761515467544},
- {0.4974498511685067},
- {0.3436818603296174},
- {0.39644851670316245},
- {0.17607140091726792},
- {0.017541748650241686},
- {0.24981048898294603},
- {0.11850286037526693},
- {0.031458279073745016},
- {0.16762927460438354},
- {0.2252878425293164},
- {0.199543353392655},
- {0.23691294690044554},
- {0.09130806315231609},
- {0.11126829601134443},
- {0.2036646931565563},
- {0.23612692904047794},
- {0.21833924305072838},
- {0.15084784337228788},
- {0.17400803084416044},
- {0.11723207133921555},
- {0.011679668125921283},
- {0.16632911939795267},
- {0.07890171662768843},
- {0.02094558910401979},
- {0.11161112467206338},
- {0.15000142152367327},
- {0.1328601948886965},
- {0.15774166245923785},
- {0.06079484412319523},
- {0.07408479030574688},
- {0.13560427027344252},
- {0.15721831510496243},
- {0.14537489668467216},
- {0.10043769200141871},
- {0.11585823580232787},
- {0.2513285766143799},
- {0.025039516336125674},
- {0.3565855345748462},
- {0.16915384933435548},
- {0.04490430848594937},
- {0.23927808131098308},
- {0.3215813158550533},
- {0.2848330093346676},
- {0.33817527103101247},
- {0.13033533797047722},
- {0.15882705716630705},
- {0.29071590940367004},
- {0.33705329012491425},
- {0.3116627168814611},
- {0.21532386044863824},
- {0.24838327226170717}};
-
-FLA_Obj_attach_buffer(A_arr, 1, m, &A);
-FLA_Obj_attach_buffer(B_arr, 1, p, &B);
-FLA_Obj_attach_buffer(C_arr_ref, 1, r, &C_ref);
-
-// Execute kernel being tested
-kernel_kron_prod_rec(A, B, C, 2);
-
-// Check success
-bool success = FLA_Obj_equals(C, C_ref);
-if (success)
-  printf ("Passed test 2 \n");
-else
-  printf ("Failed test 2 \n");
-}
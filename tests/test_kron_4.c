@@ -1,4662 +0,0 @@
-
-#include "FLAME.h"
-#include "FQAM.h"
-#include "__kernels.h"
-#include "assertf.h"
-  int main (void)    
-{ 
-FLA_Init();
-  
-// Turn on parameter checking
-FLA_Check_error_level_set(FLA_FULL_ERROR_CHECKING);
-FLA_Obj A, B, C_ref, C, ZERO;
-int m, n, p, q, r, c;
-
-// Square matrices dimension
-m = 512;
-n = 1;
-p = 8;
-q = 1;
-r = 4096;
-c = 1;
-
-// Create FLA objects
-FLA_Obj_create_without_buffer(FLA_DOUBLE, m, n, &A);
-FLA_Obj_create_without_buffer(FLA_DOUBLE, p, q, &B);
-FLA_Obj_create_without_buffer(FLA_DOUBLE, r, c, &C_ref);
-FLA_Obj_create(FLA_DOUBLE, r, c, 1, c, &C);
-FLA_Obj_create_constant (0.0, &ZERO);
-FLA_Set(ZERO, C); // Initialize C to all zeros
-
-// Create buffer for operands and reference
-double A_arr[512][1] = {{0.033482275760191915},
- {0.1481264551619601},
- {0.6915591921597377},
- {0.0016225880265601234},
- {0.7128937358392846},
- {0.945972139879377},
- {0.9737407937051845},
- {0.6676995623379554},
- {0.05116050685045803},
- {0.3686079884186796},
- {0.3837357710050443},
- {0.5708691372794282},
- {0.9823038601860649},
- {0.6004961214266981},
- {0.917087766893067},
- {0.24120830956394546},
- {0.9362925892039076},
- {0.2802260688606353},
- {0.4616138948159709},
- {0.6319819870584752},
- {0.8764717890117593},
- {0.10390692298424042},
- {0.8467311901648683},
- {0.9930654110902475},
- {0.5894155975172042},
- {0.7493117412897592},
- {0.11462509449897618},
- {0.9536058065429995},
- {0.8561442050272732},
- {0.4629101875965773},
- {0.19965256310488155},
- {0.8812042857402511},
- {0.24329474086721858},
- {0.27707859215993724},
- {0.02034993278511943},
- {0.4070668642857682},
- {0.5472329870734238},
- {0.5243958654682427},
- {0.879934941470055},
- {0.7324234287632754},
- {0.3998591515184866},
- {0.23149344636165747},
- {0.022243112870847348},
- {0.7432353996421073},
- {0.46914290830048866},
- {0.29058578645611},
- {0.6697497282015775},
- {0.30399423286435845},
- {0.06286673939708887},
- {0.262302201130838},
- {0.26570121146114445},
- {0.7848643868850057},
- {0.40795781241810336},
- {0.5901169804853617},
- {0.6384127054614186},
- {0.2690757355703104},
- {0.771585370223678},
- {0.8510434567096392},
- {0.6651275647896396},
- {0.5862781051329199},
- {0.9217797851651517},
- {0.10353055092541585},
- {0.034702032889194157},
- {0.11543760071195497},
- {0.710350058462625},
- {0.7036964732978324},
- {0.19293319397476438},
- {0.012225744765097635},
- {0.36521732921567795},
- {0.6225279963389749},
- {0.27162035142941},
- {0.14341402624570299},
- {0.6537292852594865},
- {0.6112962623675487},
- {0.8652409258576514},
- {0.0584600633287542},
- {0.6146999566623547},
- {0.2090061364339021},
- {0.6957751407245869},
- {0.7186481520980563},
- {0.6347548555158271},
- {0.4934365339311866},
- {0.5862064411192957},
- {0.9081821322102956},
- {0.42731814299814164},
- {0.3553619713428895},
- {0.6509207116713397},
- {0.10273207591979727},
- {0.813872730795491},
- {0.45621356851888717},
- {0.33824291563228914},
- {0.541318643410364},
- {0.1584137401668586},
- {0.8309512791804508},
- {0.9473466172434157},
- {0.15800743369248504},
- {0.9415871841197061},
- {0.34842042103184423},
- {0.8217801470058179},
- {0.05447005364081725},
- {0.5146372059982269},
- {0.10884843464186267},
- {0.1936919028942441},
- {0.5414549429575417},
- {0.20704397832074317},
- {0.16221510748292367},
- {0.3459771445149241},
- {0.8818536708020747},
- {0.7968294684661672},
- {0.8998891351433302},
- {0.17701961536179756},
- {0.6817426913718598},
- {0.7015917441903908},
- {0.7500748547963451},
- {0.7671045130961776},
- {0.07326419806510476},
- {0.009349789057498836},
- {0.75994151798073},
- {0.8233030888366284},
- {0.3189038842942531},
- {0.07742927111232889},
- {0.2620838625940002},
- {0.31040423423128827},
- {0.4647741170025037},
- {0.9105542989967744},
- {0.4544302317886042},
- {0.037950543242791235},
- {0.638293161720198},
- {0.23160667468206442},
- {0.09268577881509876},
- {0.4836909675906824},
- {0.7646070975925656},
- {0.1677349425293353},
- {0.3717722566288971},
- {0.5662428884617564},
- {0.9694510895915144},
- {0.4695700639209698},
- {0.16581323487408772},
- {0.2831967301347904},
- {0.499106207524149},
- {0.6269163799361158},
- {0.02278930673862878},
- {0.6447906398978083},
- {0.8152582243832659},
- {0.8477782092576187},
- {0.6383635026653263},
- {0.7684878963318176},
- {0.25732209157524555},
- {0.9146915949613917},
- {0.8805883646748257},
- {0.08401706349462257},
- {0.415982771883314},
- {0.20733489421914675},
- {0.6814828058948614},
- {0.680313615431934},
- {0.2429966848019075},
- {0.9266321711687044},
- {0.7396976303746832},
- {0.9013971945567986},
- {0.39931919143135686},
- {0.6766074604729769},
- {0.2321903648234458},
- {0.6257457572634427},
- {0.692324810382718},
- {0.8732262216585349},
- {0.5132787062550681},
- {0.996212194419482},
- {0.7872465573552491},
- {0.9592285219323505},
- {0.3310781102986504},
- {0.260360394867178},
- {0.7405703201204015},
- {0.7394236355984609},
- {0.23041865967824182},
- {0.9569246305304906},
- {0.1239859499625533},
- {0.8163574197904427},
- {0.6358039824750504},
- {0.916843374082419},
- {0.10093412132763602},
- {0.8596956253479917},
- {0.6829529082942739},
- {0.7159317342630813},
- {0.40777898379633526},
- {0.18716423434213925},
- {0.6700101020797333},
- {0.5064412902382991},
- {0.40306308630604426},
- {0.10846890917662788},
- {0.6782079626459891},
- {0.5183515740801877},
- {0.7349561469928005},
- {0.7263969692247828},
- {0.7016826293103867},
- {0.3217929931987963},
- {0.137992515016098},
- {0.9599517217725151},
- {0.5885357380054661},
- {0.29705721160030385},
- {0.3474625730079428},
- {0.747480643778958},
- {0.7093361784386353},
- {0.22499559895663068},
- {0.25938103129180456},
- {0.1449427187935034},
- {0.3513255755389323},
- {0.9650997231819792},
- {0.08272152708753466},
- {0.659427532961477},
- {0.185019822785352},
- {0.08849042408665464},
- {0.7298405167856633},
- {0.9345681959378744},
- {0.08305963019507334},
- {0.5866773840428376},
- {0.8917285270247592},
- {0.8033480489992375},
- {0.5735128103189104},
- {0.7732320267194009},
- {0.17133152262904805},
- {0.8536361065952125},
- {0.22179148977502328},
- {0.8956903300526293},
- {0.14931915060488377},
- {0.705514300612304},
- {0.18532397141978785},
- {0.49426986361162206},
- {0.3377241759526822},
- {0.7341629010113242},
- {0.07723839523097553},
- {0.1450178975711448},
- {0.029575921422051676},
- {0.6833126831892239},
- {0.7415420545813474},
- {0.35918533289325083},
- {0.9526870218261805},
- {0.7534149526038907},
- {0.946157929292077},
- {0.38720893707993886},
- {0.4389104808851966},
- {0.4852308844599076},
- {0.4341199913960391},
- {0.40498046402911503},
- {0.8312990955993075},
- {0.6305412371387551},
- {0.23551455516500608},
- {0.3045134203265143},
- {0.7670142595772776},
- {0.20447876563834555},
- {0.20181976593572593},
- {0.551873829791872},
- {0.781009626889657},
- {0.7156462764382661},
- {0.4753906053034249},
- {0.7232052050459166},
- {0.4231038583273359},
- {0.32663712269172906},
- {0.24613941026852515},
- {0.9499883369117026},
- {0.02571885504914495},
- {0.17619237890367612},
- {0.30431416633788677},
- {0.045509475642230623},
- {0.7424741195902859},
- {0.18320598846335245},
- {0.007089212999956684},
- {0.36416863945317735},
- {0.972669394132966},
- {0.6717132317607714},
- {0.680819974644693},
- {0.3253760204941757},
- {0.08433340760039088},
- {0.42381338659125456},
- {0.9299569874966073},
- {0.16066875195820185},
- {0.9153423461964605},
- {0.6082920229341324},
- {0.12037685692778399},
- {0.02799354648615926},
- {0.8869785856820814},
- {0.07079953610844003},
- {0.0890867893297782},
- {0.3597632355569116},
- {0.35925447565119806},
- {0.8414643039136166},
- {0.3477458466684905},
- {0.3375911375210374},
- {0.44152360269204727},
- {0.8638618468054869},
- {0.5214211604332},
- {0.460535864777071},
- {0.4807741050016231},
- {0.8059306777213836},
- {0.06995533805065568},
- {0.5613011447439024},
- {0.8051814332484668},
- {0.5163476495504323},
- {0.3166099577711078},
- {0.7424016401122815},
- {0.17509713537392657},
- {0.4161945934405771},
- {0.97200981012119},
- {0.8067224082136027},
- {0.07309043898485168},
- {0.32906951549958063},
- {0.4938432585736844},
- {0.6898357429698923},
- {0.3188343132581989},
- {0.651154823316652},
- {0.18908483380406138},
- {0.4386331558757477},
- {0.2804892003634565},
- {0.06233124610620655},
- {0.8877773090975273},
- {0.06303201522097401},
- {0.23267486195643694},
- {0.6675989947817288},
- {0.1724045872504133},
- {0.509526625756038},
- {0.20100129458568883},
- {0.9457747198349006},
- {0.07180975046412053},
- {0.3473232498583323},
- {0.16675513996308056},
- {0.7070513316681968},
- {0.18869873652996982},
- {0.1503979679277485},
- {0.5627257832815946},
- {0.8869770761017247},
- {0.958990172892612},
- {0.4108918169982536},
- {0.4798040493620319},
- {0.08322853482905257},
- {0.37876613466979225},
- {0.44964116549032995},
- {0.7405069508203576},
- {0.7248430319565561},
- {0.6743283439141764},
- {0.7625261866603755},
- {0.42097374152736544},
- {0.6607075524230812},
- {0.9583513913758007},
- {0.16138992488564863},
- {0.9571977437220839},
- {0.28285886467097776},
- {0.9447843036421508},
- {0.5304434269427795},
- {0.8774677100419083},
- {0.9256506894267343},
- {0.08899003955813822},
- {0.8114602827142262},
- {0.2569856351546679},
- {0.028126894335687047},
- {0.27192082381167215},
- {0.6132384888472346},
- {0.2864251485422584},
- {0.7055147927533342},
- {0.40614788443623007},
- {0.6857747880412409},
- {0.1924679419039984},
- {0.292913385823124},
- {0.9707309511671137},
- {0.6280182287851607},
- {0.8556325247511072},
- {0.8836474873457312},
- {0.6963032437718696},
- {0.07718694156868189},
- {0.3734593692589757},
- {0.9442063753637241},
- {0.09666965907225433},
- {0.11362646213793848},
- {0.4420137722614359},
- {0.5188724383145857},
- {0.6782661991390267},
- {0.33197430923940574},
- {0.7526182842681315},
- {0.9766788418099196},
- {0.10691850390094648},
- {0.5241566835060669},
- {0.2894998149908853},
- {0.5607067469786147},
- {0.686119117428246},
- {0.4931772093950817},
- {0.45189946608783527},
- {0.7913325564825378},
- {0.08729009535648447},
- {0.6955863863263512},
- {0.13098635179166684},
- {0.31807610840879097},
- {0.3578043267770765},
- {0.20841189174309316},
- {0.024630506725824897},
- {0.67720591857481},
- {0.8687304754373912},
- {0.36495503037969435},
- {0.3421605713872903},
- {0.7393775984993105},
- {0.8529406051445279},
- {0.14814970718711007},
- {0.19715779893287033},
- {0.9192124040855938},
- {0.6750523313032857},
- {0.35196935535594376},
- {0.017815394194912404},
- {0.908031166955573},
- {0.10124537618833429},
- {0.5685820839612314},
- {0.8896192728690052},
- {0.537435339745286},
- {0.3209138646552703},
- {0.055878774225518124},
- {0.06287670919173072},
- {0.6254670115495419},
- {0.3879445601592528},
- {0.7814721193425539},
- {0.6970130103443261},
- {0.9726359503594212},
- {0.3977191128581705},
- {0.9882185973607795},
- {0.6328583384186628},
- {0.7447048262210777},
- {0.6581782862132501},
- {0.8697669293969814},
- {0.8812891913212869},
- {0.3619482240707276},
- {0.06879248318464004},
- {0.5491520509537523},
- {0.9387176934924558},
- {0.364333420227423},
- {0.4691273453410415},
- {0.025543226556216214},
- {0.7074739455674638},
- {0.8989581532111302},
- {0.6396187792306173},
- {0.879873521089694},
- {0.9668174716049469},
- {0.8920260175045499},
- {0.3465673625642136},
- {0.21567763623293645},
- {0.12884991671062318},
- {0.9378610447505361},
- {0.4051156725378364},
- {0.10212139528392905},
- {0.7898635056211543},
- {0.49937753645636695},
- {0.5862734015216488},
- {0.9666118678230952},
- {0.026273006905901508},
- {0.6734210835333362},
- {0.04867618432543286},
- {0.6416531151772666},
- {0.5405510589715382},
- {0.815375518369918},
- {0.1752167549625081},
- {0.7099309260226648},
- {0.8702664535074918},
- {0.7703633588668902},
- {0.0011101985292495398},
- {0.8531867626521153},
- {0.38843395055999896},
- {0.2950033596283479},
- {0.6014478520211116},
- {0.2304058098631272},
- {0.33463157216677053},
- {0.15173377986167036},
- {0.38068112988690817},
- {0.018335878298209707},
- {0.20104681435785365},
- {0.16442137534364443},
- {0.4990004273837043},
- {0.6955758761677298},
- {0.4567322032789727},
- {0.1966255973098271},
- {0.2636969737637085},
- {0.2540833635914679},
- {0.9186366035573426},
- {0.8698804910598973},
- {0.264816158654154},
- {0.14452571987352747},
- {0.4497231818261562},
- {0.06493840461172196},
- {0.8807901502385465},
- {0.24658104682441173},
- {0.14445517857135715},
- {0.04177669379590643},
- {0.25513384421030083},
- {0.9998908156377245},
- {0.2693950223724577},
- {0.11890582339657263},
- {0.004605561223998467},
- {0.6836667596139829},
- {0.4613510752212283},
- {0.6682643666455047},
- {0.07869705520067838},
- {0.7894118706492917},
- {0.42612283693146424},
- {0.8626348033781476},
- {0.8862299948342647},
- {0.23614517695326254},
- {0.061416992887822985},
- {0.7549583520030744},
- {0.09956348694227046},
- {0.34173909321865814},
- {0.6574599141754052},
- {0.6621479445211594},
- {0.388930254163128},
- {0.741246872498967},
- {0.7475526758771625},
- {0.47486808467375785},
- {0.13033186466773217},
- {0.17026264327634688},
- {0.16596832506493364}};
-double B_arr[8][1] = {{0.7342818702086782},
- {0.8433441041023496},
- {0.15765687769672898},
- {0.17967389771648967},
- {0.21737851932133723},
- {0.4017725779724509},
- {0.576173087195647},
- {0.06534712839126988}};
-double C_arr_ref[4096][1] = {{0.02458542806403641},
- {0.02823707985428687},
- {0.00527871105453273},
- {0.006015890990252024},
- {0.00727832752825922},
- {0.01345226024855681},
- {0.019291586191085754},
- {0.0021879705729331645},
- {0.10876657052370597},
- {0.1249215726224201},
- {0.023353154425119153},
- {0.026614457553876213},
- {0.032199509495425334},
- {0.05951314775634137},
- {0.08534647696601413},
- {0.009679638483612288},
- {0.5077993769790549},
- {0.5832223673456987},
- {0.10902906297837646},
- {0.12425513555700694},
- {0.1503301132147439},
- {0.2778495194545634},
- {0.39845779472520376},
- {0.04519140732022526},
- {0.0011914369707207758},
- {0.0013684000455865468},
- {0.0002558121620555662},
- {0.00029153671512016443},
- {0.00035271578268217024},
- {0.0006519113744182924},
- {0.0009348915525098387},
- {0.0001060314680977616},
- {0.5234649456121213},
- {0.6012147289715586},
- {0.11239260052197832},
- {0.12808839617591383},
- {0.1549677847302002},
- {0.2864211540685608},
- {0.41075018462095864},
- {0.046585558485221765},
- {0.6946101920359343},
- {0.7977800268123557},
- {0.14913901396147594},
- {0.16996650150333603},
- {0.20563402308621587},
- {0.38006566532945324},
- {0.5450436882353731},
- {0.06181656287926196},
- {0.7150002111003256},
- {0.8211985572952096},
- {0.15351693322149407},
- {0.1749558037705588},
- {0.2116703319384167},
- {0.3912223489638725},
- {0.5610432392374558},
- {0.06363116466606973},
- {0.4902796833710298},
- {0.5631004892094339},
- {0.1052674282376745},
- {0.11996818286885472},
- {0.14514354221252965},
- {0.26826337447159754},
- {0.3847105181514421},
- {0.043632249026893076},
- {0.037566232650978214},
- {0.04314591181522165},
- {0.008065805771425327},
- {0.009192207674972966},
- {0.011121195226881696},
- {0.02055488872768576},
- {0.02947730717452245},
- {0.0033431922097193235},
- {0.27066216310992686},
- {0.3108633737579206},
- {0.05811358454816106},
- {0.06622923400861884},
- {0.0801274587324692},
- {0.14809658176821222},
- {0.21238200265216792},
- {0.024087473545243175},
- {0.281770219599553},
- {0.32362130001027345},
- {0.06049858351720227},
- {0.06894730166971863},
- {0.08341591371170826},
- {0.15417450997694274},
- {0.2210982238473782},
- {0.025076030696189567},
- {0.4191788577659532},
- {0.48143912113860066},
- {0.0900014457569},
- {0.10257028298104469},
- {0.1240946877880513},
- {0.22935956496966486},
- {0.32891943321100375},
- {0.037304658808412265},
- {0.7212879155706277},
- {0.8284201689248966},
- {0.1548669595463792},
- {0.176494363301584},
- {0.21353175865088064},
- {0.39466275425924524},
- {0.5659770476876061},
- {0.0641907364708188},
- {0.4409334150942534},
- {0.5064248635415344},
- {0.09467234357312905},
- {0.1078934787003693},
- {0.13053495773394155},
- {0.2412628747680624},
- {0.3459897041314327},
- {0.039240697145330024},
- {0.6734009206197415},
- {0.7734205611536581},
- {0.14458519390222657},
- {0.16477673362578885},
- {0.1993551808549266},
- {0.3684607163316257},
- {0.5284012898801402},
- {0.05992905204922424},
- {0.17711488865648767},
- {0.2034216057312478},
- {0.038028148960357694},
- {0.043338837140959714},
- {0.05243350518101321},
- {0.09691088436188336},
- {0.13897773637870176},
- {0.015762270374116316},
- {0.687502673463171},
- {0.7896168348198387},
- {0.14761296622447417},
- {0.16822733890533018},
- {0.20352989669268648},
- {0.3761766873009549},
- {0.5394665916400211},
- {0.061184032038502256},
- {0.2057649219242131},
- {0.2363270029893958},
- {0.04417956706579633},
- {0.050349310033959774},
- {0.06091512792416398},
- {0.11258715010122299},
- {0.16145871920813218},
- {0.01831196890041677},
- {0.33895471399978316},
- {0.38929935656477127},
- {0.07277660535811224},
- {0.08293996772167518},
- {0.10034494495325126},
- {0.18546380454811642},
- {0.2659695028685246},
- {0.030165142451733403},
- {0.4640529153954938},
- {0.5329782826846524},
- {0.09963630684021378},
- {0.11355066690140837},
- {0.13737930858452785},
- {0.25391303217263567},
- {0.36413101253552105},
- {0.04129820804928004},
- {0.6435773444207006},
- {0.7391673156751057},
- {0.13818180564486018},
- {0.15747910257028755},
- {0.1905261397222997},
- {0.3521423301913806},
- {0.504999456514797},
- {0.05727491452787744},
- {0.07629696973649715},
- {0.08762929087417608},
- {0.01638164104876983},
- {0.018669361852305583},
- {0.022587133065550408},
- {0.04174695231656319},
- {0.05986837259683013},
- {0.006790019036992951},
- {0.6217393618782795},
- {0.7140857569851071},
- {0.13349299568982842},
- {0.1521354932550441},
- {0.18406117238123268},
- {0.3401933731222207},
- {0.4878637238621366},
- {0.055331451796596404},
- {0.7291899272948967},
- {0.8374958594309363},
- {0.15656359206110704},
- {0.1784279330980129},
- {0.21587108865203306},
- {0.3989864503090005},
- {0.5721775636950822},
- {0.06489397291944361},
- {0.43279718727509825},
- {0.4970801690320976},
- {0.09292542277031429},
- {0.10590259778080979},
- {0.1281262898531911},
- {0.23681102411165966},
- {0.33960540446275445},
- {0.0385166167267738},
- {0.5502060267635656},
- {0.6319276391513835},
- {0.1181341495532426},
- {0.13463176116226097},
- {0.16288427683166076},
- {0.30105291000301276},
- {0.4317332592508665},
- {0.0489653705631479},
- {0.0841671287615547},
- {0.09666839762788623},
- {0.018071434504401088},
- {0.020595137504752007},
- {0.024917033319255797},
- {0.04605321971718946},
- {0.06604389456756787},
- {0.007490420767086039},
- {0.7002154550702486},
- {0.8042178345858044},
- {0.15034251401304027},
- {0.17133807214665753},
- {0.2072934182425468},
- {0.38313266326427925},
- {0.5494420015235749},
- {0.06231540107482586},
- {0.6286511680357482},
- {0.7220241675711441},
- {0.13497702222274807},
- {0.15382676632463566},
- {0.186107359614372},
- {0.3439752643699821},
- {0.4932872496952269},
- {0.055946565287358904},
- {0.33990655828706484},
- {0.3903925774384861},
- {0.07298097483048346},
- {0.08317287769814848},
- {0.10062673115850643},
- {0.18598461944038774},
- {0.26671639188183605},
- {0.030249851462500366},
- {0.14660125742860858},
- {0.16837581196342416},
- {0.031476599723264775},
- {0.035872354202141486},
- {0.043400178546448995},
- {0.0802149249774557},
- {0.11503443365066333},
- {0.013046721674860807},
- {0.6470523309692541},
- {0.743158438888763},
- {0.1389279163027842},
- {0.1583294087034262},
- {0.19155488285383235},
- {0.35404371760223297},
- {0.5077261937649955},
- {0.05758416959920546},
- {0.17864691733591698},
- {0.20518118526947776},
- {0.03835708920516045},
- {0.04371371438553649},
- {0.05288705052838441},
- {0.09774915524536182},
- {0.14017988194393027},
- {0.01589861266837087},
- {0.2034537868459863},
- {0.23367259707106258},
- {0.043683345716541075},
- {0.04978379062717352},
- {0.06023093409936783},
- {0.11132258027307532},
- {0.15964522784061463},
- {0.018106290336347725},
- {0.01494258670407839},
- {0.017161995833209577},
- {0.003208306864240229},
- {0.003656351741770988},
- {0.004423638257117998},
- {0.00817604495664353},
- {0.011725083597026172},
- {0.0013298096704629117},
- {0.29890181840773605},
- {0.34329743997083395},
- {0.06417689083709234},
- {0.0731392901374533},
- {0.08848759222322003},
- {0.1635483034712549},
- {0.2345409718905825},
- {0.026600650644313727},
- {0.4018232611881551},
- {0.4615057132186893},
- {0.08627504411465045},
- {0.09832348374651947},
- {0.11895669645381335},
- {0.2198632079680544},
- {0.3153009195773902},
- {0.03576010426622516},
- {0.38505437682571964},
- {0.44224616135829137},
- {0.08267461482679708},
- {0.09422024909509111},
- {0.11399239677371775},
- {0.2106878787472704},
- {0.30214278471947054},
- {0.03426776394860434},
- {0.6461202744845957},
- {0.742087944882417},
- {0.13872779544842284},
- {0.158101340670856},
- {0.19127895467586808},
- {0.35353372988246173},
- {0.5069948317581225},
- {0.057501221596208234},
- {0.5378052450569504},
- {0.6176849803539356},
- {0.1154715909307506},
- {0.1315973722247734},
- {0.1592131204608177},
- {0.2942676491416429},
- {0.4220026680849574},
- {0.047861767836167864},
- {0.29360932559704955},
- {0.33721885790448375},
- {0.06304054534686787},
- {0.07184425229093491},
- {0.08692079029417485},
- {0.16065244213145924},
- {0.2303880817738384},
- {0.026129647312702783},
- {0.16998144073549018},
- {0.19522863312743735},
- {0.036496533960634125},
- {0.04159332980362213},
- {0.050321702602690505},
- {0.09300771872845041},
- {0.1333802936557561},
- {0.01512743196113278},
- {0.016332714518068513},
- {0.0187585980965122},
- {0.0035067797254737187},
- {0.003996506786852962},
- {0.004835174940962175},
- {0.008936672800252543},
- {0.012815883011637346},
- {0.0014535235525927693},
- {0.5457442792545009},
- {0.6268031922483247},
- {0.1171761725012552},
- {0.1335400011745703},
- {0.16156341068140362},
- {0.2986116025545943},
- {0.4282322347248834},
- {0.04856829908534956},
- {0.34448313210202125},
- {0.39564890569664635},
- {0.07396360611621788},
- {0.08429273492039849},
- {0.10198159075646611},
- {0.18848875570538048},
- {0.27030751781143686},
- {0.030657141862565785},
- {0.21337187473505204},
- {0.24506380974370476},
- {0.04581284779571874},
- {0.052210680873580814},
- {0.06316710799565547},
- {0.11674940054662343},
- {0.1674277096775919},
- {0.018988946696225553},
- {0.49178508299560825},
- {0.5648294845029516},
- {0.10559065098649359},
- {0.120336544160537},
- {0.14558920423232696},
- {0.2690870748958961},
- {0.3858917685463484},
- {0.04376622147880659},
- {0.22321745384029354},
- {0.2563717439672734},
- {0.04792678159120711},
- {0.054619828702073485},
- {0.06608181622228003},
- {0.12213654662667085},
- {0.17515329563912982},
- {0.019865150165192826},
- {0.046161906978416004},
- {0.0530182940146738},
- {0.009911373844318973},
- {0.011295512104201757},
- {0.013665878724699555},
- {0.02525813195629064},
- {0.0362221233203449},
- {0.004108160890922071},
- {0.1926037508062046},
- {0.2212110148167609},
- {0.04135374604326734},
- {0.04712885885679229},
- {0.05701886409654915},
- {0.10538583155618512},
- {0.15113146900376848},
- {0.01714069561460957},
- {0.19509958246840062},
- {0.2240775501386078},
- {0.04188962339920237},
- {0.04773957229121706},
- {0.0577577359293091},
- {0.10675146069914733},
- {0.153089887279191},
- {0.017362811179067354},
- {0.5763116898621096},
- {0.6619107531993751},
- {0.12373926865164753},
- {0.1410196435704919},
- {0.1706126582891117},
- {0.31533698807755584},
- {0.4522177368214524},
- {0.05128863385950978},
- {0.29955602546860605},
- {0.3440488158252998},
- {0.06431735493782602},
- {0.07329937026105318},
- {0.08868126520901914},
- {0.16390626199922292},
- {0.23505431222652126},
- {0.026658871546307396},
- {0.4333122000726894},
- {0.49767167622301106},
- {0.09303600061914366},
- {0.1060286179924906},
- {0.12827875544428638},
- {0.23709282055492226},
- {0.3400095224528242},
- {0.03856245008964543},
- {0.46877487533119244},
- {0.5384015911349173},
- {0.10065015382496874},
- {0.11470609914198238},
- {0.13877720862913215},
- {0.25649671848360117},
- {0.3678362194106308},
- {0.041718437030405287},
- {0.19757743434234326},
- {0.22692343515022415},
- {0.04242164033396582},
- {0.048345886190849174},
- {0.05849128498357374},
- {0.10810725194991712},
- {0.15503419725298528},
- {0.01758332663928846},
- {0.5665611486734976},
- {0.6507119727897674},
- {0.12164574034593975},
- {0.13863375088910895},
- {0.16772608530922892},
- {0.3100018433205951},
- {0.4445667247967728},
- {0.05042088825283219},
- {0.6249057810216121},
- {0.7177224815509574},
- {0.13417285416907304},
- {0.15291029499313552},
- {0.18499856649765392},
- {0.3419259235688177},
- {0.4903483357900478},
- {0.05561324603215492},
- {0.4883911122010804},
- {0.5609314102412961},
- {0.1048619351347634},
- {0.11950606204443157},
- {0.14458444519377867},
- {0.2672300163860719},
- {0.3832286023837694},
- {0.04346417637288126},
- {0.4304933834994005},
- {0.4944341833281455},
- {0.09243077551721077},
- {0.10533887229506962},
- {0.12744426640431342},
- {0.23555046570805682},
- {0.33779766578964854},
- {0.03831159060911134},
- {0.6768461845716212},
- {0.7773775470997611},
- {0.14532492285309945},
- {0.16561976683689128},
- {0.200375124839541},
- {0.37034584060869497},
- {0.5311047045331456},
- {0.06023566196966434},
- {0.07602060655724915},
- {0.08731187971741751},
- {0.016322303405123258},
- {0.01860173761750499},
- {0.0225053178646892},
- {0.041595736344212444},
- {0.059651517145763},
- {0.006765424203742054},
- {0.025481073609920545},
- {0.029265754837467718},
- {0.0054710141550395495},
- {0.0062350495078873315},
- {0.007543476526893372},
- {0.013942325214776315},
- {0.019994377421731872},
- {0.0022676781986482406},
- {0.08476373734317694},
- {0.09735361995214842},
- {0.018199531697048518},
- {0.020741123662956773},
- {0.025093654716772516},
- {0.046379662432996585},
- {0.06651203878066551},
- {0.007543515714904269},
- {0.5215971694307802},
- {0.5990695336532141},
- {0.11199157228890635},
- {0.12763136374711614},
- {0.15441484390843077},
- {0.2853991742514101},
- {0.40928458617401897},
- {0.04641933647310322},
- {0.5167115624723835},
- {0.5934582718333434},
- {0.11094258882633587},
- {0.12643588816676923},
- {0.15296849741712973},
- {0.2827259461869921},
- {0.40545096946870124},
- {0.04598454378907727},
- {0.14166734649712368},
- {0.1627090716242525},
- {0.030417244966118716},
- {0.034665058960337475},
- {0.04193953203417062},
- {0.07751526671970002},
- {0.11116291399495659},
- {0.012607630197606705},
- {0.008977142730809849},
- {0.010310509765905255},
- {0.0019274727471824224},
- {0.0021966472144320614},
- {0.0026576142946375136},
- {0.004911968991906473},
- {0.007044145104572324},
- {0.0007989173128437307},
- {0.2681724635291065},
- {0.3080038813100488},
- {0.05757902380488214},
- {0.06562002105378725},
- {0.07939040225539742},
- {0.14673430787919625},
- {0.21042839607154612},
- {0.02386590370297359},
- {0.4571110214090437},
- {0.5250053153511236},
- {0.09814582018160352},
- {0.11185203153986024},
- {0.13532421408024523},
- {0.25011467794913445},
- {0.3586838775163476},
- {0.04068041690392298},
- {0.19944589963432557},
- {0.22906942193220112},
- {0.04282281652524904},
- {0.04880308724044479},
- {0.059044429811266404},
- {0.10912960882357714},
- {0.1565003364282497},
- {0.0177496099785395},
- {0.10530631940585125},
- {0.12094737347989323},
- {0.022610207595814277},
- {0.025767757082780403},
- {0.03117512867520231},
- {0.05761982304214482},
- {0.08263130224914422},
- {0.009371694786186902},
- {0.4800215621905182},
- {0.551318738402631},
- {0.10306491797292491},
- {0.11745808873398687},
- {0.14210670406670325},
- {0.26265050023479164},
- {0.3766612204781621},
- {0.042719331536984755},
- {0.44886376278281853},
- {0.5155330987274752},
- {0.09637506007254819},
- {0.1098339821190994},
- {0.13288267638012544},
- {0.2456020752363338},
- {0.35221245467947077},
- {0.03994645534203561},
- {0.6353307252198446},
- {0.7296958334501086},
- {0.1364111828261443},
- {0.1554612096126685},
- {0.1880847913191592},
- {0.3476300773490989},
- {0.49852853541942294},
- {0.05654100987140118},
- {0.0429261646335554},
- {0.04930194973375483},
- {0.00921663105436443},
- {0.01050374743903009},
- {0.012707962005836192},
- {0.023487650352026313},
- {0.03368311516578133},
- {0.0038201972641058687},
- {0.4513630337952272},
- {0.5184035842431666},
- {0.09691167588770146},
- {0.11044553713968254},
- {0.13362256640615283},
- {0.2469695862677881},
- {0.3541735717291793},
- {0.04016887699012292},
- {0.15346941674577577},
- {0.1762640928827426},
- {0.03295125488962555},
- {0.03755294717974361},
- {0.04543344446707503},
- {0.08397293424711064},
- {0.12042371087195596},
- {0.01365795083210947},
- {0.5108950715759559},
- {0.5867778627110629},
- {0.10969373626564059},
- {0.12501263146822564},
- {0.15124656987130575},
- {0.2795433719780621},
- {0.40088691082527095},
- {0.04546690745238345},
- {0.5276903091445714},
- {0.6060676819959444},
- {0.11329982382230355},
- {0.12912231457421047},
- {0.15621867121609062},
- {0.2887331207235741},
- {0.41406572440178396},
- {0.046961593063300534},
- {0.4660889824322008},
- {0.5353167649496116},
- {0.10007346862346363},
- {0.1140488789849959},
- {0.13798207062405984},
- {0.25502709468112444},
- {0.36572866471498094},
- {0.04147940704037472},
- {0.36232150096427956},
- {0.4161367916395652},
- {0.07779366328108694},
- {0.08865766532713121},
- {0.10726250312501412},
- {0.1982492683033236},
- {0.2843048510902514},
- {0.03224466053574445},
- {0.4304407619134498},
- {0.49437374590477917},
- {0.09241947719257955},
- {0.10532599614241575},
- {0.12742868818714315},
- {0.23552167307255517},
- {0.3377563749136778},
- {0.038306907571612},
- {0.666861674529481},
- {0.7659100466506534},
- {0.14318115934423312},
- {0.16317662353069615},
- {0.197419287173969},
- {0.36488267652664774},
- {0.5232701028515313},
- {0.05934709439620343},
- {0.31377196521477485},
- {0.36037623647344746},
- {0.06736964420825137},
- {0.0767779163174484},
- {0.09288978520407948},
- {0.1716847119267638},
- {0.2462092136659502},
- {0.027924013554418585},
- {0.2609358529186996},
- {0.299692423354214},
- {0.05602525885407444},
- {0.06384927049139245},
- {0.07724805915362878},
- {0.14277469533980494},
- {0.20475000410056368},
- {0.023221884366718567},
- {0.47795927752359507},
- {0.5489501444261298},
- {0.1026221270302362},
- {0.11695346137038096},
- {0.14149618049870688},
- {0.26152209238385654},
- {0.3750429959632634},
- {0.0425357993181238},
- {0.07543430083680866},
- {0.086638490529156},
- {0.016196418328818556},
- {0.018458272501016306},
- {0.022331746550252735},
- {0.041274930982758494},
- {0.05919145733672718},
- {0.006713246155032678},
- {0.5976119908803572},
- {0.6863747690060562},
- {0.12831263357972755},
- {0.1462316857871892},
- {0.17691844913633714},
- {0.32699174519318297},
- {0.4689315638867898},
- {0.05318424583344638},
- {0.3349893523066234},
- {0.3847450232218968},
- {0.07192520677557047},
- {0.08196967004693728},
- {0.09917103001893912},
- {0.18329410152984468},
- {0.26285798019407003},
- {0.02981224663584312},
- {0.24836564067531341},
- {0.28525516865287953},
- {0.053326321981624826},
- {0.06077342302664317},
- {0.073526744171079},
- {0.13589672819450302},
- {0.1948864649219128},
- {0.022103203235260667},
- {0.3974804658621866},
- {0.45651788636081264},
- {0.08534260715910699},
- {0.09726083056814268},
- {0.11767104518557986},
- {0.21748698686753182},
- {0.31189323393030893},
- {0.03537361889152509},
- {0.11632033739647255},
- {0.13359729377852178},
- {0.02497501565896783},
- {0.028462814147626726},
- {0.034435744277626766},
- {0.06364629677309679},
- {0.09127373372614798},
- {0.010351883017624975},
- {0.6101524593289148},
- {0.7007778620931386},
- {0.13100518419369284},
- {0.14930025514285455},
- {0.1806309586964175},
- {0.33385343760583547},
- {0.47877176383457226},
- {0.05430027992749486},
- {0.6956194458453602},
- {0.7989391841935399},
- {0.14935570977115512},
- {0.17021345920865597},
- {0.2059328049404513},
- {0.38061789264336787},
- {0.5458356251014918},
- {0.06190638102804069},
- {0.11602199391859162},
- {0.13325463760890022},
- {0.02491095864883013},
- {0.028389811479708583},
- {0.03434742197783677},
- {0.06348305397344081},
- {0.09103963087046059},
- {0.010325332056277883},
- {0.6913903985199408},
- {0.7940820002256876},
- {0.14844769552756792},
- {0.1691786394106816},
- {0.20468082789588904},
- {0.3783039103495951},
- {0.5425171947381071},
- {0.061530018612244705},
- {0.2558387983741576},
- {0.2938383078260641},
- {0.054930875705660284},
- {0.06260205509081185},
- {0.0757391152252192},
- {0.1399857707762108},
- {0.2007504696279248},
- {0.022768273987308234},
- {0.6034182632437944},
- {0.6930434418457186},
- {0.1295592921300962},
- {0.14765244207856518},
- {0.17863735156379554},
- {0.33016872818910714},
- {0.4734876042964347},
- {0.053700972775785824},
- {0.039996372857746314},
- {0.045936998588121954},
- {0.008587578584984592},
- {0.009786846846471905},
- {0.011840619607794667},
- {0.021884573873568833},
- {0.031384178965942165},
- {0.0035594615887458423},
- {0.37788877009934685},
- {0.434016253430311},
- {0.08113609504424878},
- {0.09246687271162544},
- {0.11187107382756457},
- {0.2067671169744469},
- {0.29652010776574056},
- {0.03363006357529054},
- {0.079925432158114},
- {0.09179668559598483},
- {0.01716070434781254},
- {0.019557222512442043},
- {0.023661311552893458},
- {0.043732316194327},
- {0.06271553862401562},
- {0.007112932633730548},
- {0.14222445270146325},
- {0.1633489243182256},
- {0.030536860645444548},
- {0.034801379149132665},
- {0.04210445905568301},
- {0.07782009515821008},
- {0.11160006165537609},
- {0.012657209646779547},
- {0.3975805481485969},
- {0.4566328337803168},
- {0.08536409572014653},
- {0.0972853200390411},
- {0.11770067377932952},
- {0.2175417482879779},
- {0.31197176606118976},
- {0.03538252567553419},
- {0.15202863961680033},
- {0.17460931840669344},
- {0.03264190716795761},
- {0.03720039858361631},
- {0.0450069134417622},
- {0.08318459292359723},
- {0.1192931681743312},
- {0.013529729433964901},
- {0.11911161249866294},
- {0.1368031544920526},
- {0.025574327360997042},
- {0.029145820629956205},
- {0.03526207987618952},
- {0.06517358191949246},
- {0.09346397926820983},
- {0.010600291455690258},
- {0.2540447447238766},
- {0.29177778498082785},
- {0.05454567635865292},
- {0.06216306207581764},
- {0.07520799939367852},
- {0.13900412927130826},
- {0.19934271945429832},
- {0.02260861288306168},
- {0.6475291626469354},
- {0.743706093951944},
- {0.1390302963240542},
- {0.15844608624860293},
- {0.19169604521704095},
- {0.3543046227126186},
- {0.5081003519608451},
- {0.05762660504821582},
- {0.5850974323427243},
- {0.6720014342059513},
- {0.12562564605512008},
- {0.14316945641467496},
- {0.1732136100067836},
- {0.3201442297500698},
- {0.459111694814618},
- {0.05207051758180596},
- {0.6607722771335145},
- {0.7589161964688901},
- {0.14187371131990723},
- {0.16168658842392308},
- {0.19561656775081587},
- {0.3615507777159351},
- {0.5184919011293534},
- {0.05880517085212002},
- {0.12998229423148158},
- {0.14928844892583767},
- {0.027908359849016923},
- {0.031805804264327955},
- {0.0384802618781802},
- {0.07112162721560109},
- {0.10199393827719287},
- {0.011567723532820595},
- {0.500591298421627},
- {0.5749436792833258},
- {0.10748142411425216},
- {0.12249136659851192},
- {0.14819621680855827},
- {0.2739055186263491},
- {0.3928017911607936},
- {0.0445499271828868},
- {0.5151660980470887},
- {0.59168326094985},
- {0.11061076380685922},
- {0.12605772328439788},
- {0.15251097452018156},
- {0.2818803237475616},
- {0.4042382812011561},
- {0.045847005785864446},
- {0.550766367176363},
- {0.6325712064279236},
- {0.11825445964601912},
- {0.13476887274038934},
- {0.1630501613157965},
- {0.3013595080838393},
- {0.4321729447158368},
- {0.049015237839439875},
- {0.5632709365217787},
- {0.646933068349965},
- {0.1209393024018129},
- {0.13782865782390022},
- {0.16675204322156242},
- {0.308201557800953},
- {0.44198497551233823},
- {0.050128077106818485},
- {0.05379657237458414},
- {0.06178692947999287},
- {0.011550604713899149},
- {0.013163664029430273},
- {0.01592606289465765},
- {0.02943554572970139},
- {0.04221285918008475},
- {0.004787604957443827},
- {0.00686538059519688},
- {0.007885089476242307},
- {0.001474058549928309},
- {0.0016799130427878003},
- {0.002032443301285938},
- {0.0037564888531299197},
- {0.0053870968258871825},
- {0.0006109818659716667},
- {0.5580112790721122},
- {0.6408921986516383},
- {0.11981000695695451},
- {0.13654165457218356},
- {0.16519496194946046},
- {0.3053236627874155},
- {0.43785785050310344},
- {0.04965999594534329},
- {0.604536531819541},
- {0.6943278058596235},
- {0.12979939438405552},
- {0.14792607497330237},
- {0.17896840640398964},
- {0.33078060445457397},
- {0.4743650823927122},
- {0.05380049265113623},
- {0.23416534057639607},
- {0.26894571059489625},
- {0.05027739068319087},
- {0.05729870388807689},
- {0.06932285417370779},
- {0.12812683571833028},
- {0.1837438355325032},
- {0.02083945307145123},
- {0.056854910001255636},
- {0.06529951927752495},
- {0.012207257125903306},
- {0.01391201893809893},
- {0.016831460306528444},
- {0.0311089578653282},
- {0.044612662176099264},
- {0.0050597805206198},
- {0.19244342877703668},
- {0.22102688029902037},
- {0.04131932347126861},
- {0.04708962912085692},
- {0.05697140198870056},
- {0.10529810911936906},
- {0.15100566821494482},
- {0.017126427818210065},
- {0.22792420163204297},
- {0.2617775808273617},
- {0.04893736239274903},
- {0.05577153863203779},
- {0.06747521282827099},
- {0.12471190940066919},
- {0.17884656591564208},
- {0.020284025347505803},
- {0.34127520785718546},
- {0.3919645113134371},
- {0.07327483612086894},
- {0.08350777715957966},
- {0.1010319093728862},
- {0.18673349516296545},
- {0.2677903378419634},
- {0.0303716538967017},
- {0.6686035135939035},
- {0.7679105995239777},
- {0.14355514775316525},
- {0.1636028399832564},
- {0.197934945277597},
- {0.36583574809183195},
- {0.5246368815122397},
- {0.059502108683764966},
- {0.3336798804770994},
- {0.3832410567047835},
- {0.07164405147479218},
- {0.08164925098566636},
- {0.09878337092105885},
- {0.18257760573432594},
- {0.2618304695646735},
- {0.02969571070156445},
- {0.027866395867752063},
- {0.03200536689128925},
- {0.005983164154553162},
- {0.006818722024890491},
- {0.008249632897558338},
- {0.015247487594111212},
- {0.021866081660950925},
- {0.0024799590218051184},
- {0.4686870965293173},
- {0.5383007746255766},
- {0.1006313069319797},
- {0.11468462025204966},
- {0.13875122238767149},
- {0.2564486890865105},
- {0.3677673415241968},
- {0.04171062519019937},
- {0.17006458223835919},
- {0.19532412356386997},
- {0.036514385184096325},
- {0.04161367397728154},
- {0.05034631600732581},
- {0.0930532107626398},
- {0.13344553276668294},
- {0.015134831106723938},
- {0.0680574870100986},
- {0.078166005097848},
- {0.014612550494878099},
- {0.016653215142597242},
- {0.020147897360971136},
- {0.037238604295926604},
- {0.053403051319028345},
- {0.006056749488275101},
- {0.35516550828553145},
- {0.40791792572516267},
- {0.07625720772045672},
- {0.08690664143727819},
- {0.10514402634396745},
- {0.1943337669908977},
- {0.2786897180453731},
- {0.031607815760845884},
- {0.5614371295950984},
- {0.6448268877095},
- {0.12054556767120204},
- {0.13737993744614868},
- {0.1662091587372571},
- {0.3071981647357985},
- {0.44054603191161185},
- {0.049964878175257604},
- {0.12316472729978548},
- {0.14145827483406137},
- {0.02644456731981528},
- {0.030137590907497062},
- {0.036461973445476505},
- {0.06739130027607194},
- {0.09664435966771154},
- {0.010960996825166748},
- {0.27298562788916725},
- {0.31353194069680607},
- {0.05861245319437897},
- {0.06679777041136901},
- {0.08081530267074186},
- {0.1493678979644276},
- {0.21420516883556398},
- {0.024294249386240675},
- {0.4157818871320625},
- {0.4775376014741066},
- {0.08927208581285768},
- {0.10173906682416729},
- {0.12308904067005372},
- {0.22750086505584685},
- {0.32625391314759056},
- {0.037002346732953904},
- {0.7118503591410981},
- {0.8175808606226024},
- {0.15284063186469005},
- {0.1741850559124052},
- {0.21073784240986043},
- {0.3894988634833842},
- {0.5585716271751265},
- {0.06335084482059317},
- {0.3447967847298983},
- {0.3960091448707133},
- {0.07403095013763354},
- {0.08436948363566184},
- {0.10207444521276608},
- {0.1886603751202166},
- {0.27055363338400246},
- {0.030685055255740418},
- {0.12175365220869595},
- {0.1398376140132},
- {0.026141596891043044},
- {0.029792310202807117},
- {0.03604423548081031},
- {0.06661921083731373},
- {0.09553712343530003},
- {0.010835418748288798},
- {0.20794622464035623},
- {0.2388322926602397},
- {0.04464791224697422},
- {0.05088306032388266},
- {0.06156088587334506},
- {0.11378068033962321},
- {0.1631703342854747},
- {0.018506093084105956},
- {0.3664846394935928},
- {0.42091827743637483},
- {0.078687526317313},
- {0.08967635768035902},
- {0.10849496837568758},
- {0.20052718767903044},
- {0.2875715644277002},
- {0.03261515742396036},
- {0.4603333319239454},
- {0.5287062327843118},
- {0.09883767903766429},
- {0.11264050952543365},
- {0.13627815440880575},
- {0.25187781014008975},
- {0.361212346041311},
- {0.04096718517027549},
- {0.01673377477279957},
- {0.019219227474602526},
- {0.003592890945285239},
- {0.004094643567986096},
- {0.0049539057552028965},
- {0.009156118518583832},
- {0.013130585218644304},
- {0.0014892157533972067},
- {0.47345807695721304},
- {0.5437803845381979},
- {0.10165567905436437},
- {0.11585204748154873},
- {0.1401636345732431},
- {0.2590591976442487},
- {0.3715110135847769},
- {0.04213521673089114},
- {0.5986293337031506},
- {0.6875432168545776},
- {0.128531066172845},
- {0.1464806228203659},
- {0.17721962568097685},
- {0.3275483985237076},
- {0.46972984800454776},
- {0.05327478386081198},
- {0.6225081690158484},
- {0.7149687543638608},
- {0.1336580654508803},
- {0.15232361525642216},
- {0.18428877184131595},
- {0.34061403668230145},
- {0.48846698808515937},
- {0.05539987148767848},
- {0.4687387466100583},
- {0.5383600962469275},
- {0.10064239666576287},
- {0.11469725868382992},
- {0.13876651299817114},
- {0.25647695014937166},
- {0.36780787008370763},
- {0.04171522176897183},
- {0.5642867297512598},
- {0.648099736445456},
- {0.12115740228340191},
- {0.1380772156818833},
- {0.1670527610209798},
- {0.30875736324986},
- {0.44278204370199165},
- {0.05021847722873218},
- {0.18894694664788006},
- {0.2170110687852682},
- {0.04056859752014498},
- {0.04623406316188386},
- {0.05593629525529642},
- {0.1033849601014495},
- {0.1482620639065502},
- {0.016815259756077675},
- {0.6716414550124095},
- {0.7713997636826642},
- {0.1442074209170541},
- {0.1643462040752259},
- {0.19883430454837966},
- {0.3674980001573713},
- {0.5270206801008154},
- {0.059772469094357496},
- {0.6466000712974326},
- {0.742639005489644},
- {0.13883081211070158},
- {0.15821874376491554},
- {0.19142099484461136},
- {0.35379625740794945},
- {0.5073713166232605},
- {0.057543920926264217},
- {0.061692206512272724},
- {0.0708552951421827},
- {0.013245867903810023},
- {0.015095673272772633},
- {0.018263504860187827},
- {0.033755752193909604},
- {0.048408370850809374},
- {0.005490273835240575},
- {0.30544860771306975},
- {0.3508166180759455},
- {0.06558254499075394},
- {0.07474124600718442},
- {0.09042571901518039},
- {0.16713047065168504},
- {0.2396780778962116},
- {0.02718327960281525},
- {0.15224225388675353},
- {0.17485466061440175},
- {0.03268777206017226},
- {0.03725266857699018},
- {0.0450701523090042},
- {0.083301474954072},
- {0.11946078608562868},
- {0.013548739952528942},
- {0.5004004692275364},
- {0.5747245063985573},
- {0.10744045138138987},
- {0.12244467196189972},
- {0.14813972328837524},
- {0.2738011037682779},
- {0.39265205214319415},
- {0.04453294441325436},
- {0.499541953867788},
- {0.5737384765150748},
- {0.10725612046357194},
- {0.12223459895425261},
- {0.14788556639673944},
- {0.2733313551018467},
- {0.39197839606464957},
- {0.0444565411739596},
- {0.17842806017085333},
- {0.2049298214441057},
- {0.038310098616524936},
- {0.04366016149054401},
- {0.052822259542232346},
- {0.09762940449162145},
- {0.1400081500606226},
- {0.015879135560403188},
- {0.6804092036412843},
- {0.7814697782266862},
- {0.14608993487979888},
- {0.16649161394337456},
- {0.2014299293241689},
- {0.3722953962426598},
- {0.5339005187570777},
- {0.0605527514608425},
- {0.5431465594204499},
- {0.6238196353949681},
- {0.11661841884454166},
- {0.13290435638107062},
- {0.16079437563635043},
- {0.29719022387574956},
- {0.42619386728428577},
- {0.048337116022812515},
- {0.6618796178200218},
- {0.7601880094838747},
- {0.1421114672584158},
- {0.16195754733672896},
- {0.1959443874731642},
- {0.36215667463421986},
- {0.5193608043772858},
- {0.058903718204233596},
- {0.2932128426944339},
- {0.3367634857485523},
- {0.06295541692545013},
- {0.07174723555746897},
- {0.08680341456994196},
- {0.1604355009752509},
- {0.23007697130347443},
- {0.02609436247156295},
- {0.4968205914732418},
- {0.5706129125815487},
- {0.10667181964448251},
- {0.12156869964723549},
- {0.14707992791938593},
- {0.27184232366962113},
- {0.3898430093203218},
- {0.044214354590018684},
- {0.17049317532699507},
- {0.19581637520322662},
- {0.03660640794932888},
- {0.04171854786004222},
- {0.050473197706001754},
- {0.0932877214554797},
- {0.1337818393174083},
- {0.015172973581333507},
- {0.4594737649185463},
- {0.5277189950551844},
- {0.09865312232212965},
- {0.11243017918707918},
- {0.1360236861855361},
- {0.2514074860510569},
- {0.36053786476205574},
- {0.04089068834018659},
- {0.5083615565596906},
- {0.5838680469600424},
- {0.10914976795691925},
- {0.12439269716729258},
- {0.1504965421704208},
- {0.27815712386175284},
- {0.39889892334035154},
- {0.04524143827254105},
- {0.6411941831546868},
- {0.7364301855832969},
- {0.13767011962959638},
- {0.15689595883363233},
- {0.18982062309669814},
- {0.3508383502288924},
- {0.5031294479531884},
- {0.05706282602134377},
- {0.3768912483672622},
- {0.4328705706814935},
- {0.08092191821639055},
- {0.09222278576772526},
- {0.1115757651648983},
- {0.20622130903046307},
- {0.29573737677477024},
- {0.03354128951815483},
- {0.7315005532430285},
- {0.8401496805985337},
- {0.15705970409558226},
- {0.1789933279240457},
- {0.2165551317527671},
- {0.40025074155950774},
- {0.573990655560623},
- {0.0650996061736786},
- {0.5780608744501557},
- {0.6639197426204215},
- {0.12411483421012744},
- {0.14144765742390564},
- {0.17113049097870422},
- {0.31629407884855537},
- {0.4535902793355188},
- {0.05144430185907867},
- {0.7043441130419924},
- {0.8089597184584592},
- {0.1512289737655027},
- {0.17234832733641273},
- {0.2085156757884492},
- {0.38539171612146417},
- {0.5526816588078798},
- {0.06268282937928135},
- {0.24310465401524806},
- {0.27921277231771424},
- {0.052196741143418476},
- {0.059486094525968404},
- {0.07196926939642699},
- {0.13301810588493623},
- {0.19075829691367432},
- {0.02163500378122492},
- {0.1911779176713414},
- {0.2195734039529942},
- {0.04104760693064675},
- {0.0467799669567902},
- {0.05659675712614584},
- {0.10460566704771138},
- {0.15001265249409962},
- {0.017013804151387205},
- {0.5437873596790479},
- {0.6245556131467302},
- {0.11675600438504956},
- {0.13306115594918103},
- {0.1609840796411016},
- {0.2975408466846569},
- {0.4266966876292403},
- {0.048394143791671715},
- {0.542945370023738},
- {0.6235885635158862},
- {0.11657522168361725},
- {0.1328551266716728},
- {0.16073481505759346},
- {0.29708014028815577},
- {0.4260359988681943},
- {0.04831921125099218},
- {0.16919224435951635},
- {0.19432221811481104},
- {0.036327086447936786},
- {0.041400218690999066},
- {0.050088067064863316},
- {0.09257589891188404},
- {0.13276103049429572},
- {0.015057197737738389},
- {0.702652407354677},
- {0.8070167452282085},
- {0.15086574944053313},
- {0.17193437818832505},
- {0.20801485928683575},
- {0.38446607573357033},
- {0.5513542185863066},
- {0.06253227669204446},
- {0.09104063521810322},
- {0.10456281989244826},
- {0.019547237749359025},
- {0.022277038891853607},
- {0.026951882219509244},
- {0.04981415474881834},
- {0.07143736755880935},
- {0.008102125790916534},
- {0.5994364529624573},
- {0.6884702168204767},
- {0.12870436188871906},
- {0.14667811954352544},
- {0.17745856715103375},
- {0.3279900250961445},
- {0.47036317481573214},
- {0.053346613124211864},
- {0.4668593373379057},
- {0.5362015399851274},
- {0.10023887070416224},
- {0.11423737971495901},
- {0.1382101282890359},
- {0.255448605124152},
- {0.36633314343393686},
- {0.041547964474477825},
- {0.6732214674096734},
- {0.773214453917713},
- {0.14454666369476826},
- {0.16473282261692582},
- {0.19930205510761514},
- {0.36836252600205366},
- {0.5282604773199407},
- {0.05991308168084892},
- {0.07411409537632621},
- {0.08512219612441306},
- {0.015912958421577916},
- {0.018135226991525432},
- {0.021940909843201722},
- {0.04055256213118846},
- {0.05815552428872404},
- {0.006595754985457043},
- {0.6312589115907424},
- {0.7250192369598113},
- {0.13553692806190126},
- {0.15446486385608868},
- {0.1868793621051775},
- {0.34540212766770095},
- {0.4953334825053447},
- {0.05617864040702827},
- {0.5014799387667753},
- {0.5759643085895285},
- {0.1076722231355757},
- {0.12270881099004452},
- {0.14845929197121027},
- {0.2743917505991733},
- {0.39349908558115737},
- {0.044629011383497084},
- {0.5256956927764378},
- {0.6037768070305397},
- {0.11287156186792169},
- {0.12863424519397393},
- {0.1556281803292657},
- {0.28764173852716585},
- {0.4125005975516931},
- {0.04678408295827408},
- {0.2994247148537673},
- {0.3438980017614869},
- {0.06428916137567525},
- {0.07326723942555684},
- {0.08864239170800692},
- {0.1638344135628399},
- {0.2349512759874382},
- {0.02664718560940068},
- {0.13743130402892131},
- {0.15784385353127364},
- {0.029507728802880568},
- {0.03362852749737463},
- {0.040685484131206005},
- {0.07519745693588122},
- {0.1078389947135199},
- {0.012230645251809497},
- {0.49197627081381395},
- {0.5650490692779565},
- {0.10563170071915742},
- {0.1203833265500888},
- {0.14564580392043044},
- {0.26919168598015947},
- {0.38604178896755054},
- {0.04378323616405217},
- {0.37187065774707423},
- {0.42710427619645636},
- {0.07984395255567314},
- {0.09099428058168321},
- {0.11008945779518906},
- {0.20347422277073568},
- {0.29179784167994743},
- {0.03309448401584251},
- {0.29596191682488404},
- {0.33992087741749893},
- {0.06354566770181813},
- {0.07241991574224485},
- {0.08761725689429625},
- {0.1619396952707119},
- {0.232234102771559},
- {0.026339015250622568},
- {0.07964675348970958},
- {0.09147661503252237},
- {0.017100869547957226},
- {0.019489031692820645},
- {0.023578810869215976},
- {0.04357983326975342},
- {0.06249686626504193},
- {0.007088131734426094},
- {0.4979958112021143},
- {0.5719626866527615},
- {0.10692414981982645},
- {0.1218562681109643},
- {0.1474278427119259},
- {0.27248536155372277},
- {0.39076517559840956},
- {0.044318942811009024},
- {0.38061616324121245},
- {0.43714874385269864},
- {0.08172169071866711},
- {0.09313424770246508},
- {0.11267849766143566},
- {0.2082594482142749},
- {0.29866022669050485},
- {0.03387278686323487},
- {0.5396649741352377},
- {0.6198209333401582},
- {0.11587089137890312},
- {0.1320524355808898},
- {0.15976367899941005},
- {0.295285225873997},
- {0.4234619521662596},
- {0.04802727369949156},
- {0.5333801250762892},
- {0.6126026012335365},
- {0.1145214781363462},
- {0.13051457475006173},
- {0.15790309760959026},
- {0.2918463829568161},
- {0.4185303842878045},
- {0.047467956010961196},
- {0.5152328333429734},
- {0.5917599083799492},
- {0.11062509247110686},
- {0.12607405296815197},
- {0.1525307309929946},
- {0.28191683889652175},
- {0.40429064676132426},
- {0.04585294486746967},
- {0.2362867608660606},
- {0.27138222355565234},
- {0.050732878572406964},
- {0.05781780134588358},
- {0.06995088438953548},
- {0.12928760045095175},
- {0.1854084623292783},
- {0.021028248041972775},
- {0.10132540200081955},
- {0.11637517394908119},
- {0.021755469062957},
- {0.024793653028643555},
- {0.029996608591626776},
- {0.05544160849891983},
- {0.07950757338671685},
- {0.009017414595791192},
- {0.7048751455731631},
- {0.8095696247797497},
- {0.15134299119425382},
- {0.17247826747052303},
- {0.20867288389887761},
- {0.3856822779856363},
- {0.5530983470924468},
- {0.06273008841208913},
- {0.4321511223872983},
- {0.49633814470043497},
- {0.0927867068668819},
- {0.10574450999289288},
- {0.12793502729531867},
- {0.23645752068737508},
- {0.3390984530915779},
- {0.03845912043429397},
- {0.21812372489284618},
- {0.25052144798420034},
- {0.04683311247820045},
- {0.053373427053018625},
- {0.06457385681139921},
- {0.11934944170996192},
- {0.17115637068147763},
- {0.01941183574599768},
- {0.2551354679357916},
- {0.2930305123424808},
- {0.054779864376904006},
- {0.06242995480293744},
- {0.07553089964004864},
- {0.13960093370634213},
- {0.2001985833749293},
- {0.022705681369511024},
- {0.5488614850588001},
- {0.6303833938616128},
- {0.11784546443693142},
- {0.13430276073539635},
- {0.1624862355660298},
- {0.3003172252355792},
- {0.43067823014511186},
- {0.04884571359901263},
- {0.5208526957105978},
- {0.5982144839127153},
- {0.11183172712996504},
- {0.127449195971389},
- {0.15419444817004638},
- {0.2849918250604169},
- {0.40870041579055083},
- {0.04635308232500222},
- {0.1652101891905965},
- {0.18974871182905126},
- {0.035472103627007805},
- {0.04042583623359399},
- {0.048909210155009784},
- {0.0903970618252612},
- {0.1296364088562756},
- {0.014702816292489613},
- {0.19045878875360195},
- {0.21874746345593044},
- {0.04089320352722346},
- {0.0466040008859213},
- {0.05638386452225391},
- {0.10421218561926128},
- {0.14944836955938975},
- {0.016949805554085543},
- {0.1064288106288242},
- {0.12223658732706592},
- {0.022851216489858748},
- {0.026042423231253855},
- {0.031507433597740726},
- {0.05823400978800187},
- {0.08351209375378338},
- {0.009471590454378793},
- {0.25797200065886744},
- {0.2962883527511232},
- {0.05538889329447437},
- {0.06312403552456898},
- {0.07637063341036972},
- {0.14115298219193187},
- {0.20242434146905408},
- {0.022958117491879395},
- {0.7086552296759413},
- {0.8139111614163319},
- {0.1521546090228483},
- {0.17340322894921142},
- {0.20979194882273108},
- {0.38775060378332254},
- {0.5560644869574253},
- {0.06306649552115182},
- {0.06074091761635279},
- {0.06976271215161517},
- {0.013041617678926106},
- {0.014862899196877532},
- {0.017981883074288173},
- {0.03323524119177673},
- {0.047661917639563185},
- {0.005405614251311037},
- {0.48420568217004817},
- {0.5561243220058195},
- {0.10396328591396331},
- {0.11848191510875755},
- {0.14334538071488817},
- {0.264939899903946},
- {0.3799443974482235},
- {0.04309169566117199},
- {0.1358567015005065},
- {0.15603537668808817},
- {0.02916964757234071},
- {0.03324323271465838},
- {0.04021933512217603},
- {0.07433589117647689},
- {0.10660344248662777},
- {0.012090514114484398},
- {0.06497691409390784},
- {0.07462787742299673},
- {0.013951123967561391},
- {0.01589941940623438},
- {0.01923591736207418},
- {0.0355530258111707},
- {0.05098580083325984},
- {0.005782595104188541},
- {0.535908659619445},
- {0.6155066967662011},
- {0.11506437709299479},
- {0.13113329036229723},
- {0.15865165087958705},
- {0.2932299059377218},
- {0.420514463716862},
- {0.0476929819555435},
- {0.6862364827508128},
- {0.7881625779257758},
- {0.1473411037662301},
- {0.16791751044602593},
- {0.20315505063778852},
- {0.37548387337302247},
- {0.5384730426483915},
- {0.06107134789034975},
- {0.06098918059847965},
- {0.07004784941393659},
- {0.013094921959200215},
- {0.014923647500039064},
- {0.018055379427182876},
- {0.03337108174891304},
- {0.04785672355082418},
- {0.005427708318488854},
- {0.43078656676410976},
- {0.494770912842717},
- {0.09249372458347856},
- {0.10541061229309054},
- {0.12753106106254755},
- {0.23571088502502452},
- {0.338027719551828},
- {0.03833768233930166},
- {0.65478009054217},
- {0.7520339957262034},
- {0.14058713532382675},
- {0.16022034015552258},
- {0.1938426268412392},
- {0.35827206915431387},
- {0.5137899783562825},
- {0.058271898545644914},
- {0.589883907847653},
- {0.6774988406656324},
- {0.12665334510897863},
- {0.14434067518663055},
- {0.1746306093911393},
- {0.32276321665556246},
- {0.46286752548449056},
- {0.05249648810082934},
- {0.42112005894960447},
- {0.48366864720962227},
- {0.09041823899395579},
- {0.10304528202033646},
- {0.12466936551894368},
- {0.2304217203020539},
- {0.3304426464676981},
- {0.037477415249947854},
- {0.5677702586847684},
- {0.6521006708369173},
- {0.12190534706769447},
- {0.13892961207989565},
- {0.16808403306010003},
- {0.3106634247459168},
- {0.44551548395346424},
- {0.05052849252627452},
- {0.12580563086175786},
- {0.14449142945608598},
- {0.027011592908722182},
- {0.030783802472462016},
- {0.03724379270217265},
- {0.06883630753461795},
- {0.09871661232710946},
- {0.011196023006712163},
- {0.6268095168283871},
- {0.7199089775459573},
- {0.13458160325499333},
- {0.1533761265034907},
- {0.18556215289089847},
- {0.34296757919712445},
- {0.491842150878636},
- {0.05578266825710109},
- {0.16285746990837302},
- {0.18704654524184244},
- {0.03496695377763616},
- {0.0398501414482254},
- {0.048212705645368066},
- {0.0891097386192616},
- {0.12779028737739692},
- {0.014493436958419467},
- {0.6576891706788729},
- {0.7553751589513725},
- {0.1412117408192502},
- {0.160932172747525},
- {0.1947038377172804},
- {0.35986381297024034},
- {0.5160726626377115},
- {0.05853079099676806},
- {0.10964234516412533},
- {0.12592742529219952},
- {0.023541191064693615},
- {0.026828753792895003},
- {0.032458775864809386},
- {0.059992340079180806},
- {0.08603367598144764},
- {0.009757577705852703},
- {0.5180463601125702},
- {0.5949913257812793},
- {0.1112291818049273},
- {0.12676250428573585},
- {0.15336365402713145},
- {0.2834562993534361},
- {0.40649835264446893},
- {0.04610333358398921},
- {0.13608003232862145},
- {0.15629187864571042},
- {0.02921759869640159},
- {0.03329788028529262},
- {0.0402854505019833},
- {0.07445808975742098},
- {0.10677868474429701},
- {0.012110389354348907},
- {0.36293339984053014},
- {0.41683957531233395},
- {0.07792504343659641},
- {0.08880739291889789},
- {0.1074436510970537},
- {0.1985840773173331},
- {0.28478499322487966},
- {0.03229911623736412},
- {0.2479847395332202},
- {0.2848176926025191},
- {0.0532445391034006},
- {0.060680219046507985},
- {0.07341398130761283},
- {0.13568831281613075},
- {0.1945875810792628},
- {0.022069305086815746},
- {0.5390825079924239},
- {0.6191519540185771},
- {0.11574583069421808},
- {0.13190990998354998},
- {0.15959124436249914},
- {0.294966521391053},
- {0.42300490518020684},
- {0.04797543735249416},
- {0.05671475330211776},
- {0.06513854522837026},
- {0.012177164230421525},
- {0.013877723524516102},
- {0.016789967990065695},
- {0.0310322691704041},
- {0.044502684630268706},
- {0.005047307329894206},
- {0.10648401304227073},
- {0.12229998890594342},
- {0.02286306894121075},
- {0.026055930895258247},
- {0.0315237758491088},
- {0.058264214559303674},
- {0.08355540974218861},
- {0.009476503171613625},
- {0.021717062894929015},
- {0.02494267895468166},
- {0.004662847426404468},
- {0.005314021080456649},
- {0.006429170006289812},
- {0.011882794195648338},
- {0.017040849952399385},
- {0.0019327015344569201},
- {0.5017441149494933},
- {0.5762677226259887},
- {0.10772894412218718},
- {0.12277345314772073},
- {0.1485374993051635},
- {0.2745362982862071},
- {0.3937063781930762},
- {0.04465252163974934},
- {0.5445008866763774},
- {0.625375119675122},
- {0.11690920500611261},
- {0.13323575126732462},
- {0.16119531383939553},
- {0.29793126294413586},
- {0.42725657487353785},
- {0.048457643848253365},
- {0.2637432779883829},
- {0.3029168327755628},
- {0.05662803809841013},
- {0.06453622876352524},
- {0.07807917582627646},
- {0.14431081716641436},
- {0.2069529221285005},
- {0.023471730064836275},
- {0.6995408081100636},
- {0.8034429829119357},
- {0.1501976612833111},
- {0.1711729905154243},
- {0.20709369418122958},
- {0.38276352076000114},
- {0.5489126224968172},
- {0.06225536113197195},
- {0.5532189404411675},
- {0.6353880582210424},
- {0.11878104903755846},
- {0.13536900113222536},
- {0.1637762268315892},
- {0.3027014677906571},
- {0.43409741918114575},
- {0.04923350363970896},
- {0.6947466138333566},
- {0.7979367112181609},
- {0.14916830494019132},
- {0.1699998830112703},
- {0.20567440971365417},
- {0.3801403104207537},
- {0.5451507350948567},
- {0.061828703683867406},
- {0.2843205024805719},
- {0.3265503741421041},
- {0.06104615203629235},
- {0.06957133895581162},
- {0.08417090541042595},
- {0.15556993286457957},
- {0.2230993686670934},
- {0.025302992125609908},
- {0.32228400875857244},
- {0.37015256628325754},
- {0.06919725600472994},
- {0.07886075684926211},
- {0.09540971044944012},
- {0.17634219540437357},
- {0.2528884067741497},
- {0.028681539546678948},
- {0.356296241324232},
- {0.4092166055376315},
- {0.07649998620597129},
- {0.08718332430333126},
- {0.10547877119287757},
- {0.19495246336130953},
- {0.27957697670193926},
- {0.031708444906211025},
- {0.31876643917725883},
- {0.3661125352168123},
- {0.06844200238923037},
- {0.0780000309307753},
- {0.09436836093746263},
- {0.17441750809256484},
- {0.25012825565600355},
- {0.02836849481497394},
- {0.2973698125252769},
- {0.3415378866155878},
- {0.06384795548700274},
- {0.07276441847114373},
- {0.0880340536247171},
- {0.16271004506145698},
- {0.23333884421358086},
- {0.026464310378866634},
- {0.6104078546194422},
- {0.7010711910192915},
- {0.13106001984430143},
- {0.14936274867452035},
- {0.18070656651454423},
- {0.3339931807051007},
- {0.47897216629440226},
- {0.054323008731674484},
- {0.4629949988499387},
- {0.5317632347343706},
- {0.0994091627063289},
- {0.11329180174769754},
- {0.13706612050026676},
- {0.2533341783631761},
- {0.3633008912063991},
- {0.04120405917929638},
- {0.17293406802792557},
- {0.19861981152869546},
- {0.037130489419448895},
- {0.042315818095461866},
- {0.051195805280392415},
- {0.0946232899786795},
- {0.13569714832893107},
- {0.015390199874380466},
- {0.22359868378099423},
- {0.2568095976524064},
- {0.04800863506542989},
- {0.05471311313704456},
- {0.06619467642405368},
- {0.12234514191179219},
- {0.17545243748203343},
- {0.01989907757494146},
- {0.563204664999128},
- {0.6468569535769263},
- {0.120925073313822},
- {0.13781244162237685},
- {0.16673242404526042},
- {0.3081652964119935},
- {0.4419329738637234},
- {0.05012217929853117},
- {0.15014505045088639},
- {0.17244596141522484},
- {0.032237483745822755},
- {0.03673949682249816},
- {0.044449291307118284},
- {0.0821539608111427},
- {0.11781516166380074},
- {0.01336210015145735},
- {0.14819259517636252},
- {0.1702035096932107},
- {0.03181827415491121},
- {0.036261743981901504},
- {0.043871281888886955},
- {0.08108564764579324},
- {0.11628311759629008},
- {0.013188342156497918},
- {0.40523094785880154},
- {0.46541954056335894},
- {0.0870067048875226},
- {0.09915732204643225},
- {0.11996551597235283},
- {0.22172777131101},
- {0.31797484825366795},
- {0.03606337001119128},
- {0.5734812094835193},
- {0.6586598640845681},
- {0.12313153922651059},
- {0.140327043817366},
- {0.1697747162689837},
- {0.3137882512167595},
- {0.44999672785453404},
- {0.051036736363176204},
- {0.5254860862709667},
- {0.603536067857012},
- {0.11282655747854721},
- {0.1285829558739557},
- {0.15556612792997865},
- {0.2875270494009874},
- {0.41233612443550516},
- {0.04676542910914559},
- {0.34907070274183444},
- {0.40091786412829056},
- {0.07494859851849602},
- {0.08541528299266768},
- {0.10333970588013275},
- {0.19099890903664093},
- {0.27390727268148163},
- {0.031065410920766413},
- {0.5310364705057662},
- {0.6099108457316046},
- {0.11401827456156187},
- {0.12994109803945295},
- {0.15720927663836542},
- {0.2905640196343929},
- {0.4166913756672666},
- {0.04725938338737017},
- {0.3106774923851038},
- {0.35682214434331455},
- {0.06670523324532694},
- {0.07602071936455788},
- {0.09197369024234112},
- {0.16999152791026437},
- {0.24378105625685076},
- {0.02764862215295808},
- {0.2398437173296643},
- {0.27546749160302547},
- {0.05149658890342139},
- {0.058688164972922216},
- {0.07100389408611002},
- {0.13123383884535975},
- {0.18819951937399684},
- {0.02134479799389139},
- {0.18073570650403378},
- {0.20758022043719002},
- {0.038805570901049864},
- {0.044224827224584075},
- {0.05350542055079915},
- {0.0988920654042041},
- {0.14181890389493207},
- {0.016084503644968766},
- {0.6975592127039568},
- {0.8011670629004809},
- {0.14977219504580727},
- {0.17068810727813138},
- {0.20650705805040556},
- {0.381679263164776},
- {0.5473577128782741},
- {0.062079009822377976},
- {0.01888488898511206},
- {0.02168984476995934},
- {0.004054754384982946},
- {0.004621006931485294},
- {0.005590726629223227},
- {0.010333130695594753},
- {0.0148185121128032},
- {0.0016806533229729347},
- {0.12937486949790736},
- {0.14859080393618246},
- {0.027777940331912596},
- {0.03165717146556409},
- {0.03830043844178513},
- {0.07078926629122882},
- {0.10151730689327625},
- {0.011513666005781794},
- {0.22345237518957828},
- {0.2566415579758785},
- {0.047977221303714256},
- {0.05467731239627229},
- {0.06615136288703695},
- {0.12226508712311002},
- {0.17533763269626984},
- {0.019886056898964145},
- {0.03341678288679339},
- {0.038380147963664686},
- {0.00717488183536942},
- {0.008176864871673224},
- {0.009892782430198555},
- {0.01828445935095346},
- {0.026221335077439116},
- {0.002973913547812214},
- {0.5451852851142969},
- {0.6261611712050504},
- {0.11705615146523222},
- {0.13340321902040575},
- {0.1613979247509498},
- {0.298305741105615},
- {0.427793605647205},
- {0.04851855162006148},
- {0.13452483584229996},
- {0.15450569020681137},
- {0.0288836841164751},
- {0.032917334032212774},
- {0.03982504650296555},
- {0.07360714228491222},
- {0.10555835996565986},
- {0.011971985250164201},
- {0.005205480579915868},
- {0.0059786459862392},
- {0.0011176631869002321},
- {0.0012737465314446262},
- {0.0015410426250841592},
- {0.0028482513827884095},
- {0.004084613739972557},
- {0.000463259712101229},
- {0.2674024296490289},
- {0.3071194749818114},
- {0.057413690651253776},
- {0.06543159887666339},
- {0.0791624396275976},
- {0.14631297308982305},
- {0.20982416925357567},
- {0.02379737483842085},
- {0.7142135018186963},
- {0.8202949987828414},
- {0.1533480197101725},
- {0.17476330123340653},
- {0.21143743268580634},
- {0.3907918899957037},
- {0.5604259276383106},
- {0.06356115178066563},
- {0.4932268480612145},
- {0.5664853936529817},
- {0.1059002108269825},
- {0.12068933449819755},
- {0.1460160277287067},
- {0.2698759567827315},
- {0.38702308645376876},
- {0.04389453079798595},
- {0.49991376425753004},
- {0.574165511571713},
- {0.10733595147604849},
- {0.12232557848765367},
- {0.14799563801265372},
- {0.273534796348137},
- {0.39227014661549486},
- {0.04448963029444786},
- {0.2389177128495205},
- {0.27440394850004834},
- {0.05129776746849864},
- {0.05846157782566897},
- {0.070729757557693},
- {0.13072716256436198},
- {0.1874729062275633},
- {0.02126238858667336},
- {0.061924492253885764},
- {0.07112208207864992},
- {0.013295741727803219},
- {0.015152512051275662},
- {0.018332271273495775},
- {0.03388285058081053},
- {0.04859063981084605},
- {0.005510946014136038},
- {0.31119848612569995},
- {0.3574205208213843},
- {0.06681709525605393},
- {0.07614820307327616},
- {0.0921279264457684},
- {0.1702765969100033},
- {0.24418986734712536},
- {0.027694987787517607},
- {0.6828505559926371},
- {0.7842737424740462},
- {0.14661411504097113},
- {0.16708899665220028},
- {0.2021526729745438},
- {0.37363121627000623},
- {0.5358161884450838},
- {0.06077001866029935},
- {0.11797615167196268},
- {0.13549904467743237},
- {0.025330533777160314},
- {0.02886798090557401},
- {0.03492593540188112},
- {0.06455229867386303},
- {0.0925730108316288},
- {0.010499241562677711},
- {0.6721192898463364},
- {0.7719485708999967},
- {0.14431001632493232},
- {0.16446312708607452},
- {0.19897576388830543},
- {0.3677594541587036},
- {0.5273956254489213},
- {0.059814993818866305},
- {0.4466578042330949},
- {0.5129994911139918},
- {0.09590142106362237},
- {0.1092941987104239},
- {0.1322296192604026},
- {0.24439505421432361},
- {0.3504814927704444},
- {0.039750136922062036},
- {0.0883905436347757},
- {0.1015191125604187},
- {0.018978239410180283},
- {0.021628579079075172},
- {0.02616734291951814},
- {0.048364120136096665},
- {0.06935790528299},
- {0.007866281924997425},
- {0.020555153667630593},
- {0.02360819238201746},
- {0.004413375134666108},
- {0.005029709608075978},
- {0.006085195685714323},
- {0.011247039338335851},
- {0.016129128100485238},
- {0.001829297876358031},
- {0.6512922947296871},
- {0.7480281607000241},
- {0.13983827440249755},
- {0.15936689968055898},
- {0.1928100916253047},
- {0.3563636729758483},
- {0.5110531899888735},
- {0.05796150351887395},
- {0.05198681578361219},
- {0.05970837135023431},
- {0.011162033805233477},
- {0.012720828609122771},
- {0.015390298327890245},
- {0.028445312141541577},
- {0.04079278729161957},
- {0.004626546376120579},
- {0.06541481427995606},
- {0.07513081853467656},
- {0.014045145049759103},
- {0.016006570673929032},
- {0.019365554355599092},
- {0.03579262901231362},
- {0.051329410436486526},
- {0.005821565860299028},
- {0.26416762143705425},
- {0.30340420357970616},
- {0.056719148427975506},
- {0.06464006278760591},
- {0.0782047994516149},
- {0.1445430026094105},
- {0.2072858940903205},
- {0.02350949434439617},
- {0.26379404826199976},
- {0.302975143912819},
- {0.056638938929743435},
- {0.06454865191234449},
- {0.07809420597662083},
- {0.14433859683052294},
- {0.20699276032480418},
- {0.02347624834551718},
- {0.617871982791534},
- {0.7096439595181362},
- {0.13266263484827223},
- {0.15118917127345233},
- {0.1829162644465017},
- {0.3380772826551677},
- {0.4848290857508446},
- {0.05498727590451365},
- {0.25534347064903945},
- {0.29326940951395114},
- {0.05482452441775968},
- {0.062480851685648466},
- {0.07559247724894123},
- {0.13971474529521208},
- {0.20036179803444826},
- {0.0227241924897767},
- {0.24788705182482243},
- {0.2847054954255724},
- {0.05322356467965381},
- {0.060656315512948276},
- {0.07338506161032905},
- {0.1356348616224794},
- {0.19451092791538635},
- {0.02206061140734208},
- {0.32420277672598985},
- {0.3723563271523664},
- {0.06960923262983926},
- {0.07933026662950693},
- {0.09597774699861962},
- {0.177392076089268},
- {0.2543940172328211},
- {0.028852299552893246},
- {0.6343180924742556},
- {0.7285327952623746},
- {0.1361937615286831},
- {0.15521342510410693},
- {0.1877850091567726},
- {0.34707600120308296},
- {0.49773394718445046},
- {0.05645089101551767},
- {0.3828701048492693},
- {0.43973746140554454},
- {0.08220563211890351},
- {0.09368577224688812},
- {0.11334575979778244},
- {0.20949272383663367},
- {0.30042883973593354},
- {0.03407337551675325},
- {0.3381631360866786},
- {0.38839020628741977},
- {0.07260664650811599},
- {0.08274627386273058},
- {0.10011060437961128},
- {0.18503068164025585},
- {0.265348370972922},
- {0.030094696284371763},
- {0.3530237089684952},
- {0.40545800685820277},
- {0.07579734427199523},
- {0.08638255736679849},
- {0.10450996307329394},
- {0.19316185158889992},
- {0.2770091003225093},
- {0.03141720716673893},
- {0.5917802852958051},
- {0.6796768853715397},
- {0.12706051428956208},
- {0.14480470615549307},
- {0.1751920173987162},
- {0.3238008460552048},
- {0.4643555666484096},
- {0.052665255471522406},
- {0.05136693645491576},
- {0.058996421895507224},
- {0.011028940175285554},
- {0.012569148253635967},
- {0.015206787804075132},
- {0.028106136511546222},
- {0.040306383090461397},
- {0.004571380457250884},
- {0.4121532543128246},
- {0.4733700110456696},
- {0.08849298592792339},
- {0.10085116446886448},
- {0.12201481173780108},
- {0.22551540794264546},
- {0.32340661341354493},
- {0.03667941797174655},
- {0.5912301286629882},
- {0.6790450144627741},
- {0.12694239074533048},
- {0.1446700864807016},
- {0.17502914774458384},
- {0.3234998201717894},
- {0.46392387214738484},
- {0.052616294496754264},
- {0.3791447177897466},
- {0.43545874591546335},
- {0.08140575823416599},
- {0.09277419477147424},
- {0.11224288751432572},
- {0.20745432628989283},
- {0.2975056193076886},
- {0.033741836149702525},
- {0.23248095191885965},
- {0.26701114118635766},
- {0.04991573738988607},
- {0.05688654516858813},
- {0.06882420382267451},
- {0.1272051989454468},
- {0.18242213680586258},
- {0.020689551560423115},
- {0.5451320647476361},
- {0.626100046064607},
- {0.11704472457703297},
- {0.13339019635008825},
- {0.16138216926934004},
- {0.29827662083888706},
- {0.4277518449226049},
- {0.048513815294306595},
- {0.1285706520305489},
- {0.14766713676281193},
- {0.02760526765669474},
- {0.03146038479162523},
- {0.038062356024991896},
- {0.0703492274747737},
- {0.10088625704750939},
- {0.011442094986223544},
- {0.3056041444422874},
- {0.3509952565373851},
- {0.0656159401161009},
- {0.07477930481199825},
- {0.09047176447165857},
- {0.16721557474481677},
- {0.23980012377679447},
- {0.02719712153331376},
- {0.7137291812369696},
- {0.81973874249535},
- {0.1532440317542972},
- {0.17464479120313925},
- {0.21129405328995843},
- {0.39052688722690304},
- {0.5600458930819807},
- {0.06351804985956326},
- {0.5923616386423329},
- {0.6803445866141907},
- {0.12718533604694263},
- {0.1449469594589711},
- {0.17536412260081635},
- {0.3241189416561231},
- {0.46481174045033846},
- {0.05271699278564873},
- {0.053668984232170175},
- {0.06164039078412719},
- {0.011523210399834994},
- {0.01313244405821757},
- {0.0158882914030736},
- {0.029365734096081987},
- {0.042112743874387064},
- {0.00477625030051738},
- {0.24162977926969567},
- {0.2775188357363881},
- {0.05188007235883924},
- {0.059125202469486465},
- {0.07153264403308866},
- {0.1322111075744119},
- {0.18960099864736918},
- {0.02150374787900407},
- {0.3626201514954328},
- {0.41647980046880884},
- {0.07785778621830547},
- {0.08873074312894613},
- {0.10735091632557178},
- {0.19841267911146485},
- {0.2845391948831579},
- {0.032271238823177645},
- {0.5065338794847255},
- {0.5817689066327225},
- {0.10875734936023647},
- {0.12394547672355108},
- {0.14995547238172974},
- {0.2771570848305546},
- {0.39746478968486565},
- {0.0450787848647406},
- {0.23411425582592985},
- {0.26888703827182364},
- {0.050266422330868435},
- {0.05728620378886085},
- {0.06930773092490267},
- {0.12809888398382255},
- {0.18370375057388044},
- {0.020834906804025884},
- {0.4781311814603526},
- {0.5491475811019056},
- {0.10265903634126856},
- {0.11699552512219503},
- {0.14154707134152075},
- {0.26161615202312705},
- {0.37517788479269143},
- {0.04255109784186791},
- {0.1388415653937433},
- {0.15946357976382783},
- {0.02981052451735323},
- {0.033973609088650374},
- {0.041102981198448},
- {0.07596910113295018},
- {0.10894559243476187},
- {0.012356150911435927},
- {0.3220803740319787},
- {0.3699186858716187},
- {0.06915353380963302},
- {0.07881092878388016},
- {0.09534942594951534},
- {0.17623077382039107},
- {0.252728619567299},
- {0.02866341715368038},
- {0.20595813461621548},
- {0.23654891339090364},
- {0.04422105155695477},
- {0.05039658789668366},
- {0.06097232706063405},
- {0.11269286912345723},
- {0.1616103284984511},
- {0.018329163788515415},
- {0.04576870396330274},
- {0.05256668890502183},
- {0.00982694964405092},
- {0.011199297937427901},
- {0.013549473986021047},
- {0.0250429854363259},
- {0.035913586497764674},
- {0.00407316794209012},
- {0.6518787828529601},
- {0.7487017593832489},
- {0.13996419864232001},
- {0.15951040942980954},
- {0.19298371693870162},
- {0.35668457814155896},
- {0.5115133929249664},
- {0.0580136978004522},
- {0.04628326601947867},
- {0.053157678406297995},
- {0.00993743071467146},
- {0.011325207855677505},
- {0.013701806138575322},
- {0.025324535250129496},
- {0.036317350802031606},
- {0.004118961191405466},
- {0.17084893278791854},
- {0.1962249730037892},
- {0.036682792254569274},
- {0.0418055993483592},
- {0.050578516975386796},
- {0.09348237911762182},
- {0.13406099352626127},
- {0.015204634077688281},
- {0.4902058384377614},
- {0.5630156761538262},
- {0.10525157307076223},
- {0.11995011350404367},
- {0.14512168098606534},
- {0.268222969185272},
- {0.3846525738320993},
- {0.04362567722588434},
- {0.12659356275878872},
- {0.14539639217783518},
- {0.02718076892649345},
- {0.03097660417548438},
- {0.037477053900701135},
- {0.0692674354738749},
- {0.09933488328276191},
- {0.011266144698296648},
- {0.37413616368126085},
- {0.4297062757145191},
- {0.08033037692004669},
- {0.09154863483991849},
- {0.11076014346164467},
- {0.2047138259756076},
- {0.2935755289702375},
- {0.03329610183205033},
- {0.14759160650274505},
- {0.1695132567057802},
- {0.031689236517380134},
- {0.036114686044271066},
- {0.04369336379870895},
- {0.08075680830149225},
- {0.11581153643175801},
- {0.013134857404102468},
- {0.6944652300764594},
- {0.797613533781815},
- {0.14910788933366903},
- {0.1699310302744576},
- {0.20559110820926324},
- {0.37998634736924053},
- {0.5449299401188727},
- {0.06180366204626855},
- {0.05272859787001292},
- {0.060560329670977006},
- {0.011321301046354476},
- {0.012902337759937038},
- {0.015609897228725229},
- {0.028851188567528108},
- {0.04137484561566136},
- {0.004692560983323936},
- {0.25503316547293226},
- {0.2929130149856918},
- {0.05475789912414553},
- {0.06240492206960478},
- {0.07550061378007912},
- {0.13954495748535187},
- {0.20011830912570036},
- {0.02269657700176555},
- {0.12244527603900068},
- {0.1406319641166261},
- {0.026290094706460314},
- {0.029961545961425456},
- {0.0362489854143968},
- {0.06699764247312374},
- {0.09607982379827033},
- {0.010896969541071604},
- {0.5191749741508599},
- {0.5962875718600886},
- {0.11147150532212226},
- {0.1270386686464594},
- {0.15369777156221234},
- {0.28407383628318583},
- {0.40738394857305826},
- {0.04620377414974},
- {0.13855806116524086},
- {0.15913796690411272},
- {0.029749653626632736},
- {0.03390423748651663},
- {0.04101905194469197},
- {0.07581397783579027},
- {0.10872313357639071},
- {0.012330920563294346},
- {0.11043450116557198},
- {0.12683723952084097},
- {0.023711274035421614},
- {0.02702258910621818},
- {0.03269328757707193},
- {0.060425779296149514},
- {0.08665526148888276},
- {0.009828075319960671},
- {0.4131993405626526},
- {0.4745714715569094},
- {0.08871758999162238},
- {0.10110713482776877},
- {0.12232449755369273},
- {0.226087788640613},
- {0.32422745179794493},
- {0.036772514009180274},
- {0.6512911862721995},
- {0.7480268876043306},
- {0.1398380364067719},
- {0.15936662844837235},
- {0.19280976347496195},
- {0.3563630664678567},
- {0.511052320209299},
- {0.05796140487213256},
- {0.7041690976633308},
- {0.8087587082010772},
- {0.15119139640009552},
- {0.17230550223542593},
- {0.20846386382710919},
- {0.3852959540133111},
- {0.5525443285058235},
- {0.06266725395397962},
- {0.3017104118389196},
- {0.3465231912893788},
- {0.06477992093908042},
- {0.07382653429988681},
- {0.08931905478033424},
- {0.16508506458317287},
- {0.2367448067033126},
- {0.026850600320307047},
- {0.35231141469924976},
- {0.4046399161539023},
- {0.07564440832866517},
- {0.08620826368903128},
- {0.10429909381470029},
- {0.19277210983380466},
- {0.2764501803698945},
- {0.03135381681631189},
- {0.06111320420900483},
- {0.07019029414115854},
- {0.013121550936421889},
- {0.01495399525396849},
- {0.018092095666423794},
- {0.03343894299913837},
- {0.04795404185522565},
- {0.0054387457512913755},
- {0.2781211057370471},
- {0.31943018650740584},
- {0.059715086169298215},
- {0.0680543877391304},
- {0.08233562152358566},
- {0.15217784637494294},
- {0.21823485313785637},
- {0.024751279232531932},
- {0.3301633559190493},
- {0.37920222587797864},
- {0.07088902223512362},
- {0.08078878077743275},
- {0.09774233078020828},
- {0.1806534902215873},
- {0.2590711384508122},
- {0.02938275897129682},
- {0.5437408287508978},
- {0.6245021710211571},
- {0.11674601377906281},
- {0.13304977014004657},
- {0.1609703045164876},
- {0.297515386637614},
- {0.4266601759440005},
- {0.04839000278988568},
- {0.5322390971127887},
- {0.6112920974002326},
- {0.11427648923850098},
- {0.13023537278427252},
- {0.1575653050271049},
- {0.29122205357455316},
- {0.4176350474546619},
- {0.04736641067278241},
- {0.4951470775040222},
- {0.5686908330691222},
- {0.1063125012439151},
- {0.1211592018917656},
- {0.14658449693647313},
- {0.27092663713429216},
- {0.38852984369655896},
- {0.04406542086763208},
- {0.5599091544240722},
- {0.6430719637436754},
- {0.12021749775086796},
- {0.13700605206816122},
- {0.16575681339997803},
- {0.3063621117860414},
- {0.4393470670356327},
- {0.049828896621400984},
- {0.3091133862374586},
- {0.3550257228990101},
- {0.06636940568151425},
- {0.07563799297651581},
- {0.09151064860638203},
- {0.16913570539215783},
- {0.2425537402841245},
- {0.02750942513694201},
- {0.48514557725421836},
- {0.5572038188718996},
- {0.10416508978567086},
- {0.11871190119457693},
- {0.1436236294501542},
- {0.2654541766228896},
- {0.38068191021308645},
- {0.043175341257272765},
- {0.7037000519765119},
- {0.8082199955750649},
- {0.15109068810062468},
- {0.17219072987051118},
- {0.20832500644681493},
- {0.3850393091165407},
- {0.5521762797872388},
- {0.06262551141618658},
- {0.11850569587787217},
- {0.13610724161383284},
- {0.02544423164918098},
- {0.02899755685637598},
- {0.03508270290502413},
- {0.06484204618008726},
- {0.09298853126363774},
- {0.010546368142559883},
- {0.7028529494197788},
- {0.8072470736280912},
- {0.1509088076135775},
- {0.1719834494999764},
- {0.2080742282280314},
- {0.384575805124635},
- {0.5515115790570608},
- {0.06255012385484086},
- {0.20769813615570895},
- {0.23854735581335348},
- {0.04459464543286795},
- {0.05082235471909565},
- {0.06148744117909165},
- {0.11364493526121935},
- {0.16297566529813298},
- {0.018484014546263215},
- {0.6937379854221623},
- {0.7967782721250519},
- {0.14895174340909983},
- {0.16975307833674472},
- {0.20537581300377142},
- {0.37958842530221376},
- {0.5443592889634876},
- {0.06173894119216014},
- {0.3894949915754445},
- {0.4473463366720385},
- {0.08362805448655157},
- {0.09530683803690122},
- {0.11530700673255731},
- {0.21311762311134194},
- {0.30562722688425986},
- {0.034662954724735},
- {0.6443086311772985},
- {0.7400072198040334},
- {0.13833881944490597},
- {0.15765804358359226},
- {0.19074263156119448},
- {0.35254246395112054},
- {0.505573279409341},
- {0.05733999510730215},
- {0.6796885193922149},
- {0.7806420513863115},
- {0.1459351975328435},
- {0.1663152672932572},
- {0.2012165762763585},
- {0.37190106379295557},
- {0.5333350153917805},
- {0.06048861444743629},
- {0.06534377267669399},
- {0.07504922518519073},
- {0.014029891782844472},
- {0.015989187265355295},
- {0.019344523033495313},
- {0.03575375760714358},
- {0.051273665821875244},
- {0.005815243540549844},
- {0.5958405739914647},
- {0.6843402451402685},
- {0.1279322945476299},
- {0.14579823183738969},
- {0.1763940347444922},
- {0.3260224897083485},
- {0.4675415762281082},
- {0.053026599278942696},
- {0.18869989279813457},
- {0.21672732024668667},
- {0.040515552851395686},
- {0.04617361072538693},
- {0.05586315685677509},
- {0.10324978113797863},
- {0.14806820677199917},
- {0.01679327329516412},
- {0.02065306857597016},
- {0.023720650504711446},
- {0.004434398340270232},
- {0.005053668735952747},
- {0.006114182643799358},
- {0.011300614847607712},
- {0.016205959542618564},
- {0.0018380117754018231},
- {0.1996665310571191},
- {0.2293228235442275},
- {0.04287018806287059},
- {0.04885707428452199},
- {0.05910974605281951},
- {0.10925033038720813},
- {0.15667346052835474},
- {0.017769244985881217},
- {0.4502899044746911},
- {0.5171710639779498},
- {0.09668126543511538},
- {0.11018294952095273},
- {0.13330487469646624},
- {0.24638240857608354},
- {0.3533315133063045},
- {0.04007337426516856},
- {0.21031679374640797},
- {0.24155496028975335},
- {0.04515689461299427},
- {0.0514631228426121},
- {0.06226267468651021},
- {0.11507777032596536},
- {0.1650304620860648},
- {0.018717060956279508},
- {0.5180467214828062},
- {0.5949917408255154},
- {0.1112292593943455},
- {0.12676259271063298},
- {0.15336376100801988},
- {0.2834564970822065},
- {0.4064986362028856},
- {0.04610336574399229},
- {0.29822702816513313},
- {0.34252242373293706},
- {0.06403200734334794},
- {0.07297417344596387},
- {0.08828782574424128},
- {0.16317908256800123},
- {0.23401148043360354},
- {0.02654059795009697},
- {0.5035519939048823},
- {0.5783441242366191},
- {0.10811711188571817},
- {0.1232158291230693},
- {0.14907270801230882},
- {0.2755255044998405},
- {0.39512497674666225},
- {0.04481341312162686},
- {0.14132572033648316},
- {0.1623167040334506},
- {0.030343894777299815},
- {0.03458146530736229},
- {0.04183839622791633},
- {0.07732834119582135},
- {0.1108948482730192},
- {0.012577227310804056},
- {0.21508098875135961},
- {0.24702677694658837},
- {0.046179809844451046},
- {0.052628889724174656},
- {0.06367307809963026},
- {0.11768456614479568},
- {0.168768809790639},
- {0.019141048630905256},
- {0.7127901382924373},
- {0.8186602243364512},
- {0.15304241084458303},
- {0.1744150136302307},
- {0.2110160568241005},
- {0.39001307676806063},
- {0.5593090489703227},
- {0.06343448009929692},
- {0.4611423995575093},
- {0.5296354705147658},
- {0.09901139308689844},
- {0.11283848300283597},
- {0.13651767268012704},
- {0.25232050279270646},
- {0.36184720169428813},
- {0.041039187828481795},
- {0.6282754504856161},
- {0.721592645027054},
- {0.13489635230802874},
- {0.15373483073503225},
- {0.1859961313135731},
- {0.34376968526632923},
- {0.49299243329085124},
- {0.055913128450657004},
- {0.6488463296134228},
- {0.7452188985578779},
- {0.1393131038394878},
- {0.15876838825879},
- {0.19208598240123512},
- {0.3550253290097731},
- {0.5091339007766663},
- {0.05774382580820452},
- {0.5112828480691776},
- {0.5872232353023473},
- {0.10977699534317731},
- {0.12510751780112686},
- {0.15136136812977313},
- {0.279755549300804},
- {0.40119118958838124},
- {0.045501417470018055},
- {0.056676971810739704},
- {0.06509515208564043},
- {0.012169052206678247},
- {0.013868478644460015},
- {0.016778783069142645},
- {0.031011596499858258},
- {0.04447303841481746},
- {0.005043944980818102},
- {0.27422444410643404},
- {0.3149547571863394},
- {0.05887843810395988},
- {0.06710090051350195},
- {0.08118204471619667},
- {0.15004573355514417},
- {0.21517723772808314},
- {0.024404497351888956},
- {0.6933136231650325},
- {0.7962908797188467},
- {0.14886062904119043},
- {0.16964923971035922},
- {0.20525018381033308},
- {0.3793562295679071},
- {0.5440263022431288},
- {0.061701175238748844},
- {0.07098277805601022},
- {0.0815257870241699},
- {0.015240636617338888},
- {0.017369014436436153},
- {0.021013907352425122},
- {0.03883921813717755},
- {0.05569845590581146},
- {0.006317084622934891},
- {0.08343385112384102},
- {0.09582620691403927},
- {0.017913993244392974},
- {0.020415709336058543},
- {0.024699952095267052},
- {0.04565199661904863},
- {0.06546850947713531},
- {0.0074251630099736315},
- {0.3245626993541199},
- {0.3727697087687207},
- {0.06968651123369102},
- {0.07941833730658099},
- {0.0960842993338297},
- {0.1775890127808049},
- {0.25467643974686516},
- {0.02888433072667758},
- {0.380998624405371},
- {0.437588011633816},
- {0.08180380854756619},
- {0.09322783340964047},
- {0.11279172235747653},
- {0.20846871718050264},
- {0.29896033464444777},
- {0.033906823845234496},
- {0.4980385732031363},
- {0.5720118000558083},
- {0.10693333120348676},
- {0.1218667316886577},
- {0.1474405020745529},
- {0.27250875937966257},
- {0.3907987298983905},
- {0.04432274839859661},
- {0.24376271664954494},
- {0.279968576410503},
- {0.05233803307021308},
- {0.0596471180827833},
- {0.07216408379518574},
- {0.13337817404373967},
- {0.1912746626241108},
- {0.02169356780847058},
- {0.5526339613256502},
- {0.6347161926771548},
- {0.1186554487951828},
- {0.1352258606271522},
- {0.16360304824837169},
- {0.3023813882996101},
- {0.43363840032666034},
- {0.04918144365168684},
- {0.7171575665574336},
- {0.823676342841907},
- {0.1539801367122094},
- {0.1754836943252151},
- {0.21230900048511886},
- {0.392402776125119},
- {0.5627360634842903},
- {0.06382315767278958},
- {0.07850831900430083},
- {0.09016908988430729},
- {0.01685643749302876},
- {0.01921046433389876},
- {0.023241786066040365},
- {0.04295692294524082},
- {0.061603564470948155},
- {0.006986817201817639},
- {0.38487874984721304},
- {0.4420444486606828},
- {0.08263690614543907},
- {0.09417727433968352},
- {0.11394040375293162},
- {0.21059178199372255},
- {0.30200497450992225},
- {0.03425213409421317},
- {0.21257446557657358},
- {0.24414796211128412},
- {0.045641636925243666},
- {0.052015560147615006},
- {0.0629310411265197},
- {0.11631308699143557},
- {0.16680200214586702},
- {0.01891798157945826},
- {0.4117167988100813},
- {0.4728687291948226},
- {0.08839927503213821},
- {0.10074436670558126},
- {0.12188560243169493},
- {0.22527659522014476},
- {0.3230641374180969},
- {0.03664057578466281},
- {0.5038048287311402},
- {0.578634512395019},
- {0.10817139778177262},
- {0.12327769612613085},
- {0.14914755782461483},
- {0.27566384660532917},
- {0.39532337007258517},
- {0.04483591405828837},
- {0.3621310836589175},
- {0.41591809182099204},
- {0.07775277898441449},
- {0.08861107147695572},
- {0.10720613154133195},
- {0.19814507881592122},
- {0.28415543527169823},
- {0.032227714421988594},
- {0.3318215851052788},
- {0.38110675037217556},
- {0.07124505885622696},
- {0.08119453844800201},
- {0.09823323682027647},
- {0.18156081347448375},
- {0.2603723104778926},
- {0.029530332430388082},
- {0.5810611495310123},
- {0.6673656458937878},
- {0.12475902007480734},
- {0.14218180481317177},
- {0.17201869941894252},
- {0.3179357212515193},
- {0.45594452206696745},
- {0.05171131016865622},
- {0.06409553446905326},
- {0.07361558726542305},
- {0.013761883887753082},
- {0.01568375166474362},
- {0.018974991680010926},
- {0.03507076664283583},
- {0.050294203723148065},
- {0.005704157068546381},
- {0.5107564726434093},
- {0.5866186778021875},
- {0.10966397783656322},
- {0.12497871722978349},
- {0.15120553871970188},
- {0.2794675356368793},
- {0.40077815562091773},
- {0.045454572894487524},
- {0.09618090336539697},
- {0.11046656750137847},
- {0.020650899244359536},
- {0.023534828374072083},
- {0.028473619203776328},
- {0.05262672423854435},
- {0.07547081069229974},
- {0.008559581948034098},
- {0.2335575197511053},
- {0.2682476106823736},
- {0.05014688612165626},
- {0.05714997416830019},
- {0.06914291347739612},
- {0.12779425806684472},
- {0.18326689334507038},
- {0.02078536029438474},
- {0.2627292302346288},
- {0.30175216940975796},
- {0.056410312986054006},
- {0.06428809801186189},
- {0.07777897476156878},
- {0.14375596677892327},
- {0.20615722357110827},
- {0.023381485280853504},
- {0.15303307364284702},
- {0.17576294012635477},
- {0.032857568127084756},
- {0.037446176919948636},
- {0.045304268436072416},
- {0.0837341830257379},
- {0.12008132307390296},
- {0.013619118648003348},
- {0.01808573454282613},
- {0.020771992628277693},
- {0.0038831687864818365},
- {0.004425459146161173},
- {0.005354143082194054},
- {0.00989586218400246},
- {0.014191435099411677},
- {0.001609532885354516},
- {0.4972600284074974},
- {0.5711176186932819},
- {0.10676617068024984},
- {0.12167622694701186},
- {0.14721001985543827},
- {0.27208276772400314},
- {0.39018782477241226},
- {0.04425346210843597},
- {0.6378930382114418},
- {0.7326387245141549},
- {0.136961334317454},
- {0.15608819058693527},
- {0.18884334443990142},
- {0.34903208267971364},
- {0.5005391199737038},
- {0.05676904191581613},
- {0.26797986224926695},
- {0.3077826731332091},
- {0.05753767058937748},
- {0.06557289279955958},
- {0.0793333841228116},
- {0.14662892339966394},
- {0.21027726654144963},
- {0.023848763227261687},
- {0.25124230426992944},
- {0.28855910053576234},
- {0.05394396735584893},
- {0.061477323506055656},
- {0.07437835837831186},
- {0.13747073484679845},
- {0.1971437127328416},
- {0.02235921078887552},
- {0.5429115658164749},
- {0.6235497383997478},
- {0.11656796361830699},
- {0.13284685500662888},
- {0.1607248075811463},
- {0.29706164384414774},
- {0.4260094735306513},
- {0.04831620285876324},
- {0.6262988227224456},
- {0.7193224304981277},
- {0.13447195266784484},
- {0.1532511630469787},
- {0.18541096581536282},
- {0.3426881457862993},
- {0.4914414216606459},
- {0.05573721923450689},
- {0.10878364406421924},
- {0.12494118208073876},
- {0.023356820266804423},
- {0.02661863533586471},
- {0.03220456398622366},
- {0.05952248978242895},
- {0.08535987415712834},
- {0.00968115793668512},
- {0.14476939732665456},
- {0.16627186730783272},
- {0.031083282993315822},
- {0.03542411019947278},
- {0.042857870404681274},
- {0.07921259714463344},
- {0.11359701767585054},
- {0.01288369600020645},
- {0.6749610031909851},
- {0.775212361403332},
- {0.14492015756823867},
- {0.16515847547140355},
- {0.1998170313419331},
- {0.3693143372937233},
- {0.5296254486505291},
- {0.06006789098862915},
- {0.49567868831810485},
- {0.569301403565172},
- {0.10642664283517388},
- {0.12128928352786444},
- {0.146741876243125},
- {0.2712175154140341},
- {0.3889469857456328},
- {0.04411273136450186},
- {0.2584447165069052},
- {0.29683128066413994},
- {0.055490389610348564},
- {0.06323970595356264},
- {0.07651057731376062},
- {0.14141163526865919},
- {0.20279527007369583},
- {0.02300018665423735},
- {0.013081520967945109},
- {0.0150245076565386},
- {0.0028087194237063203},
- {0.0032009613143556353},
- {0.003872684011216005},
- {0.007157736853285393},
- {0.010264750672890087},
- {0.001164184851796025},
- {0.6667508234799067},
- {0.7657827309931587},
- {0.14315735863353285},
- {0.16314949901496037},
- {0.1973864705704284},
- {0.36482202282707354},
- {0.5231831207346584},
- {0.05933722925032044},
- {0.07434264417755128},
- {0.08538469107605615},
- {0.015962029891083536},
- {0.018191151365530293},
- {0.022008569963951882},
- {0.04067761579897766},
- {0.058334860962717214},
- {0.006616094596801499},
- {0.41749951597820073},
- {0.47951034820693167},
- {0.08964087607162716},
- {0.10215935919707884},
- {0.12359753152413273},
- {0.2284406896620525},
- {0.32760169464007727},
- {0.037155206441590385},
- {0.6532313034559376},
- {0.750255168669895},
- {0.14025459689936173},
- {0.15984136224008355},
- {0.19338412029598903},
- {0.3574246286745575},
- {0.5125746828776814},
- {0.05813406484351904},
- {0.39462902638440495},
- {0.45324292511043013},
- {0.08473037762812255},
- {0.0965631022626214},
- {0.11682689838479009},
- {0.21592678194296358},
- {0.30965577886908285},
- {0.035119856148340955},
- {0.23564123271496648},
- {0.2706408156817216},
- {0.05059427791114058},
- {0.05765984489387444},
- {0.06975978072845067},
- {0.12893439070965013},
- {0.1849019321223131},
- {0.020970799516166552},
- {0.04103077084328193},
- {0.04712503478755705},
- {0.008809673073915643},
- {0.010039957164718562},
- {0.012146845202634432},
- {0.02245055917452696},
- {0.03219584585422532},
- {0.003651517433661715},
- {0.04616922761787122},
- {0.05302670198220411},
- {0.009912945651013484},
- {0.011297303416064492},
- {0.013668045943896737},
- {0.02526213754638575},
- {0.0362278676477024},
- {0.004108812388372567},
- {0.45926908699443053},
- {0.5274839165008224},
- {0.09860917614320469},
- {0.11238009585819085},
- {0.13596309285498115},
- {0.25129549366698417},
- {0.3603772589835349},
- {0.0408724731082318},
- {0.2848606571710192},
- {0.32717075752888514},
- {0.06116212807413864},
- {0.06970351122172216},
- {0.08433081406618581},
- {0.15586548604557157},
- {0.2235232148877141},
- {0.025351062981421417},
- {0.5738208093067898},
- {0.6590499043679106},
- {0.12320445434259261},
- {0.14041014163904245},
- {0.1698752521935917},
- {0.3139740680018527},
- {0.45026320355892435},
- {0.05106695891687565},
- {0.5118040167954125},
- {0.5878218127565173},
- {0.10988889492488431},
- {0.125235044327669},
- {0.1515156561363575},
- {0.2800407140463785},
- {0.4016001379856218},
- {0.0455477986773562},
- {0.7141889446621109},
- {0.8202667941736035},
- {0.15334274706925702},
- {0.17475729226025938},
- {0.21143016272783263},
- {0.3907784532045894},
- {0.5604066582360597},
- {0.06355896632610189},
- {0.2920379340072338},
- {0.3354140689177551},
- {0.06270315353353215},
- {0.07145974320357194},
- {0.08645559185890492},
- {0.15979263328194332},
- {0.22915504909220605},
- {0.025989801931604824},
- {0.72563099984507},
- {0.8334083276485071},
- {0.1557994585417415},
- {0.1775570871837336},
- {0.214817495460095},
- {0.3970391334619599},
- {0.5693849600655124},
- {0.0645772475603755},
- {0.4646964043112123},
- {0.5337173484373887},
- {0.09977446965942624},
- {0.11370812436606242},
- {0.13756980854561066},
- {0.2542651261178279},
- {0.36463594260418847},
- {0.04135547509413008},
- {0.5468232525510416},
- {0.6280424244901107},
- {0.11740783770770026},
- {0.13380401877542214},
- {0.16188283245539162},
- {0.2992019778593685},
- {0.42907887877329615},
- {0.04866432189266709},
- {0.48328838293140797},
- {0.5550707771261333},
- {0.10376633357216505},
- {0.11825745807629397},
- {0.14307382130649163},
- {0.26443798681738717},
- {0.37922461509262845},
- {0.04301006097352323},
- {0.6386540875632749},
- {0.7335128118501488},
- {0.13712473841259942},
- {0.15627441430965852},
- {0.1890686472669819},
- {0.3494485014590079},
- {0.5011362968513371},
- {0.05683677120578511},
- {0.6471146755980881},
- {0.7432300435099349},
- {0.13894130225158932},
- {0.1583446640201088},
- {0.19157333950332003},
- {0.35407783033640994},
- {0.507775114075741},
- {0.05758971793511054},
- {0.2657720188893636},
- {0.30524690076036426},
- {0.05706362689486695},
- {0.06503264819034899},
- {0.07867976901948236},
- {0.14542087107744653},
- {0.20854482566781288},
- {0.023652277069341955},
- {0.050513073209116535},
- {0.058015735100326205},
- {0.01084560810789508},
- {0.012360213587380351},
- {0.014954008135115042},
- {0.027638933314219308},
- {0.03963637741234868},
- {0.004495391231020947},
- {0.4032323950032526},
- {0.46312414442756006},
- {0.0865775977341236},
- {0.09866828943386502},
- {0.1193738597186022},
- {0.22063423521054779},
- {0.3164066325378447},
- {0.035885509580004034},
- {0.6892833835756172},
- {0.7916620322234191},
- {0.14799530059469562},
- {0.16866306684522261},
- {0.2040570622721309},
- {0.377151027702817},
- {0.5408638714647254},
- {0.06134250563980824},
- {0.2675234251841164},
- {0.3072584418762409},
- {0.05743966947362579},
- {0.06546120568064084},
- {0.07919825942831574},
- {0.14637917748629203},
- {0.20991911150098327},
- {0.023808142788831893},
- {0.34447170450305237},
- {0.3956357807665542},
- {0.07396115250862371},
- {0.08428993866281462},
- {0.10197820770338523},
- {0.1884825029350425},
- {0.27029855085304627},
- {0.030656124867856644},
- {0.018755928166862418},
- {0.02154172951593551},
- {0.004027065345153219},
- {0.004589451075610715},
- {0.00555254876747974},
- {0.010262567983225357},
- {0.01471731970183293},
- {0.0016691765052963554},
- {0.5194852918751899},
- {0.5966439808003472},
- {0.11153813330995194},
- {0.12711460133296987},
- {0.15378963874587961},
- {0.28424363095898136},
- {0.4076274473280907},
- {0.046231390754475334},
- {0.6600886739792081},
- {0.7581310583453433},
- {0.1417269356152845},
- {0.16151931527146104},
- {0.19541419227687928},
- {0.3611767347049893},
- {0.5179554943953543},
- {0.05874433385626658},
- {0.4696604734340493},
- {0.5394187263372835},
- {0.10084029964969252},
- {0.11492279911702792},
- {0.13903938315927286},
- {0.25698128585107705},
- {0.3685311266576157},
- {0.041797250487850456},
- {0.6460751746128354},
- {0.7420361463667677},
- {0.13871811210302817},
- {0.15809030503171728},
- {0.19126560320452907},
- {0.353509052857904},
- {0.5069594429879531},
- {0.05749720795072694},
- {0.7099165412005061},
- {0.8153598144211728},
- {0.15242542387588187},
- {0.17371186350366238},
- {0.21016535043148235},
- {0.38844074799552636},
- {0.557054207369312},
- {0.06317874544789139},
- {0.65499853240804},
- {0.7522848825683615},
- {0.14063403674401506},
- {0.16027379142956014},
- {0.1939072948812483},
- {0.35839159267130166},
- {0.5139613843644347},
- {0.058291338694222976},
- {0.2544781311369398},
- {0.2922755418928309},
- {0.05463872829346415},
- {0.06226910885323611},
- {0.0753363001193098},
- {0.13924126269853718},
- {0.19968278720987603},
- {0.022647181937707445},
- {0.15836817809530757},
- {0.18189046290377825},
- {0.03400306271749567},
- {0.038751641552250894},
- {0.04688368521504172},
- {0.08665335992031137},
- {0.12426764950739072},
- {0.0140939141860393},
- {0.0946121578185088},
- {0.10866481757198287},
- {0.020314075560080434},
- {0.023150966755842724},
- {0.028009204109232893},
- {0.05176836320836266},
- {0.07423985429606174},
- {0.008419972050493524},
- {0.6886543619352885},
- {0.7909395825576345},
- {0.14786024402876174},
- {0.16850914942678796},
- {0.20387084523703394},
- {0.3768068497293591},
- {0.5403702935144512},
- {0.06128652610448379},
- {0.297469093681929},
- {0.3416519139142425},
- {0.06386927203832578},
- {0.07278871191091014},
- {0.0880634450501426},
- {0.16276436813256978},
- {0.23341674771746598},
- {0.026473145866645644},
- {0.07498588911740312},
- {0.08612347661540705},
- {0.016100140326497717},
- {0.01834854913090988},
- {0.022198997697849488},
- {0.041029576249367865},
- {0.05883959958946838},
- {0.006673339929114534},
- {0.579982452117084},
- {0.6661267305112135},
- {0.12452741410282392},
- {0.14191785471896323},
- {0.17169935931788724},
- {0.3173454968997686},
- {0.4550980944969167},
- {0.051615311913404086},
- {0.3666838714093835},
- {0.4211471010916332},
- {0.07873030318959526},
- {0.08972510840717386},
- {0.10855394945722215},
- {0.20063620020360615},
- {0.2877278968562217},
- {0.03263288799053027},
- {0.43048992972291955},
- {0.49443021656531194},
- {0.09243003396054386},
- {0.1053380271788992},
- {0.12744324394025983},
- {0.23554857592603065},
- {0.33779495569542145},
- {0.0383112832416217},
- {0.7097655700710459},
- {0.815186419683967},
- {0.15239300902559247},
- {0.17367492187079184},
- {0.21012065658581655},
- {0.38835814203405095},
- {0.5569357440035834},
- {0.06316530983116099},
- {0.01929179264687088},
- {0.02215718547113235},
- {0.00414212023648903},
- {0.004720573555515574},
- {0.005711187339324138},
- {0.010555773715672056},
- {0.015137799498885825},
- {0.001716865555504666},
- {0.4944808926548126},
- {0.5679257003760549},
- {0.10616946540501389},
- {0.12099619088289629},
- {0.14638727801824716},
- {0.2705621247921897},
- {0.38800710468203997},
- {0.044006134007041},
- {0.035742039661101184},
- {0.04105077306105301},
- {0.007674135238938205},
- {0.00874583976371682},
- {0.010581156874875078},
- {0.019556756062291368},
- {0.02804590739568901},
- {0.0031808488667111794},
- {0.47115424943758777},
- {0.5411343715636537},
- {0.10116102670322748},
- {0.11528831618582717},
- {0.13948160409515767},
- {0.2577986262488244},
- {0.36970325628038975},
- {0.041930188500147125},
- {0.39691684252490256},
- {0.45587054854992826},
- {0.08522159219311314},
- {0.09712291568019234},
- {0.11750418881681382},
- {0.21717859248873325},
- {0.31145097243450737},
- {0.03532345945265},
- {0.5987154605510338},
- {0.6876421360466674},
- {0.12854955837655316},
- {0.1465016974881264},
- {0.17724512287412056},
- {0.3275955240311054},
- {0.4697974296429466},
- {0.05328244868601726},
- {0.12865848652576614},
- {0.14776801723757732},
- {0.027624126507541872},
- {0.03148187730934891},
- {0.03808835875403958},
- {0.07039728734525412},
- {0.1009551786351515},
- {0.011449911782836691},
- {0.5212894080789011},
- {0.5987160607811357},
- {0.11192549317708082},
- {0.1275560565879691},
- {0.15432373351923268},
- {0.28523077833049537},
- {0.4090430933421433},
- {0.0463919473717362},
- {0.6390208790613547},
- {0.7339340825636047},
- {0.1372034918241967},
- {0.1563641657535973},
- {0.18917723307848994},
- {0.34964919654864707},
- {0.5014241092002185},
- {0.05686941367196917},
- {0.5656638478890192},
- {0.6496813967168744},
- {0.12145308185091865},
- {0.13841418734558106},
- {0.16746044628989654},
- {0.30951087266746685},
- {0.4438626347407442},
- {0.05034103331980459},
- {0.000815198652360276},
- {0.0009362793840256993},
- {0.00017503043374498308},
- {0.0001994736969893791},
- {0.00024133331244099125},
- {0.00044604732515781103},
- {0.0006396665139977741},
- {7.254828583066866e-05},
- {0.6264795717174829},
- {0.7195300259808323},
- {0.13451076109191268},
- {0.15329539112581914},
- {0.18546447516988201},
- {0.34278704512270997},
- {0.491583250991729},
- {0.05575330492075969},
- {0.28522000766974126},
- {0.3275834820379587},
- {0.06123928383669503},
- {0.06979144190252926},
- {0.08443719702687008},
- {0.15606210968851433},
- {0.2238051884657559},
- {0.02538304323877243},
- {0.21661561862574658},
- {0.2487893440329523},
- {0.0465093085890506},
- {0.053004403463884596},
- {0.06412739351083022},
- {0.11852426030841538},
- {0.1699729964501529},
- {0.019277622417489614},
- {0.44163225361505415},
- {0.5072274999270269},
- {0.09482239044705275},
- {0.10806447984584362},
- {0.130741843521348},
- {0.2416452540225152},
- {0.3465380656861945},
- {0.03930289000667707},
- {0.16918280897324214},
- {0.1943113812989953},
- {0.03632506058620684},
- {0.041397909914632484},
- {0.050085273791080145},
- {0.09257073620853898},
- {0.13275362677665126},
- {0.015056358039220289},
- {0.24571389664148652},
- {0.28220956343334586},
- {0.05275696884656068},
- {0.06012455887020046},
- {0.07274171567578377},
- {0.13444578942041766},
- {0.19280570600846111},
- {0.021867212310154448},
- {0.11141536365065918},
- {0.12796378863950353},
- {0.02392187397411376},
- {0.027262599643002122},
- {0.03298366439735964},
- {0.06096247190052766},
- {0.08742492037476329},
- {0.009915366793913253},
- {0.2795272520065117},
- {0.3210451864331448},
- {0.06001699833603288},
- {0.06839846239389806},
- {0.08275190034838975},
- {0.15294723894012852},
- {0.21933822184406696},
- {0.024876418670853474},
- {0.013463703008728138},
- {0.01546345485633338},
- {0.002890777322322955},
- {0.0032944787218945337},
- {0.003985826074921066},
- {0.00736685309326083},
- {0.010564639605523153},
- {0.001198196993319809},
- {0.14762503084618173},
- {0.1695516455372555},
- {0.03169641302253311},
- {0.03612286475915909},
- {0.04370325881938199},
- {0.08077509689770362},
- {0.11583776369941466},
- {0.013137831990498464},
- {0.12073163498961428},
- {0.13866379748446198},
- {0.02592216066328092},
- {0.029542229375898527},
- {0.03574167511697925},
- {0.066059999845592},
- {0.09473517143270184},
- {0.010744464724850309},
- {0.36640696705423614},
- {0.4208290683785997},
- {0.07867084935064816},
- {0.08965735175022432},
- {0.1084719740453841},
- {0.20048468811930567},
- {0.2875106167576162},
- {0.03260824499554147},
- {0.5107487552244806},
- {0.586609814121881},
- {0.10966232083777087},
- {0.12497682882861837},
- {0.15120325403698293},
- {0.2794633129433551},
- {0.4007720999503779},
- {0.045453886085802676},
- {0.33537017640821426},
- {0.38518241078899745},
- {0.07200697311251056},
- {0.08206285517577311},
- {0.09928377007515508},
- {0.18350247475443035},
- {0.2631568035849155},
- {0.029846137928098603},
- {0.14437861132355828},
- {0.1658230382068455},
- {0.030999377747121692},
- {0.03532848745948956},
- {0.04274218120388372},
- {0.07899877312654224},
- {0.11329037742369118},
- {0.0128489181524154},
- {0.19362790706358463},
- {0.22238728809325553},
- {0.04157364154166254},
- {0.04737946309216842},
- {0.05732205770627246},
- {0.10594621295257892},
- {0.15193509945758543},
- {0.017231840000926386},
- {0.1865688074068546},
- {0.21427970663535803},
- {0.040057989778513575},
- {0.04565214828139506},
- {0.05523226536169825},
- {0.10208372801005562},
- {0.1463959960055501},
- {0.016603618182697358},
- {0.6745382033022336},
- {0.7747267634226924},
- {0.14482937865477846},
- {0.16505501914618545},
- {0.1996918646756774},
- {0.3690829964310899},
- {0.5292936878825577},
- {0.06003026407758175},
- {0.6387374738335048},
- {0.733608583409021},
- {0.13714264218980077},
- {0.1562948183762658},
- {0.18909333313311819},
- {0.3494941274210765},
- {0.5012017280252464},
- {0.056844192134352},
- {0.19444970423805022},
- {0.22333114607201315},
- {0.04175008873705553},
- {0.04758055140370016},
- {0.057565344460604316},
- {0.10639587075124102},
- {0.15257994367105615},
- {0.017304975519655895},
- {0.10612261588198928},
- {0.12188491374648718},
- {0.022785473742132432},
- {0.025967499409958215},
- {0.031416786989957764},
- {0.058066471056911415},
- {0.08327183019870359},
- {0.009444340772416104},
- {0.33022357902750743},
- {0.3792713938712378},
- {0.07090195267455013},
- {0.08080351697216707},
- {0.09776015936985036},
- {0.18068644213626808},
- {0.2591183940562257},
- {0.02938811850332424},
- {0.04768309318666305},
- {0.05476542065910854},
- {0.01023798611369095},
- {0.011667736268078552},
- {0.014116214241586015},
- {0.026090470230269627},
- {0.037415761062695875},
- {0.004243538263686427},
- {0.6467482387785425},
- {0.7428091801551009},
- {0.13886262499264207},
- {0.15825499936365217},
- {0.1914648586916734},
- {0.35387732931408317},
- {0.507487580034461},
- {0.057557107033404185},
- {0.1810599922202427},
- {0.20795267202275303},
- {0.03887519794152768},
- {0.0443041777859543},
- {0.05360142285139594},
- {0.09906950286178953},
- {0.1420733629927557},
- {0.016113363325688565},
- {0.1060708186827047},
- {0.12182542315520613},
- {0.0227743524206836},
- {0.025954824979247275},
- {0.03140145282614098},
- {0.05803812949608491},
- {0.08323118619885732},
- {0.009439731100886294},
- {0.030675868851593454},
- {0.035232128401666896},
- {0.006586383104354916},
- {0.0075061814080188},
- {0.009081355839495035},
- {0.016784729965547023},
- {0.024070606637214637},
- {0.002729986973243865},
- {0.18734015628026923},
- {0.2151656232717246},
- {0.040223605272959706},
- {0.0458408922286564},
- {0.05546061728319592},
- {0.10250578231639423},
- {0.14700125466674227},
- {0.016672264074568777},
- {0.734201698110949},
- {0.8432520241141644},
- {0.15763966403107932},
- {0.17965428013654994},
- {0.21735478498633273},
- {0.40172871068974525},
- {0.5761101781045612},
- {0.06533999350672995},
- {0.19781188085255696},
- {0.22719270379233278},
- {0.04247197809428213},
- {0.04840325369508042},
- {0.058560691075863376},
- {0.10823553263152842},
- {0.15521816171547934},
- {0.017604191114942016},
- {0.08731039038233815},
- {0.10027852510493475},
- {0.018746320856662307},
- {0.021364272750850774},
- {0.025847571828631375},
- {0.047773099201977955},
- {0.06851033535194365},
- {0.007770154107965494},
- {0.003381780108918163},
- {0.0038840729043415076},
- {0.0007260984026167237},
- {0.0008274991362877315},
- {0.0010011500795165521},
- {0.0018503882059758205},
- {0.002653600428699759},
- {0.00030096020061848186},
- {0.5020041068488622},
- {0.5765663308912109},
- {0.10778476670578072},
- {0.12283707143904671},
- {0.1486144679141042},
- {0.2746785564841818},
- {0.3939103874998328},
- {0.04467565951733839},
- {0.3387617303362281},
- {0.3890777092091025},
- {0.0727351700414076},
- {0.08289274590069151},
- {0.10028781361889748},
- {0.18535821084199502},
- {0.2658180732912463},
- {0.030147967945932014},
- {0.490694408934279},
- {0.5635768135921773},
- {0.10535647352131239},
- {0.12006966346023916},
- {0.14526631853661104},
- {0.2684902973542916},
- {0.3850359431929842},
- {0.043669157366494446},
- {0.0577858208726697},
- {0.06636869751370926},
- {0.01240713200686608},
- {0.014139806646715629},
- {0.017107049334473007},
- {0.03161831874681683},
- {0.045343125248181106},
- {0.005142626570213583},
- {0.5796508247452931},
- {0.6657458468204869},
- {0.12445621074330143},
- {0.14183670770322362},
- {0.17160118357643003},
- {0.3171640423528209},
- {0.45483787458089314},
- {0.0515857988649118},
- {0.3128942736406632},
- {0.3593681821495173},
- {0.06718119598588705},
- {0.07656315101748432},
- {0.09262995134116933},
- {0.1712044707268887},
- {0.24552051047936901},
- {0.027845903735412552},
- {0.6334170967316016},
- {0.7274979754224504},
- {0.13600030969313046},
- {0.15499295742884947},
- {0.1875182762733946},
- {0.34658300880199666},
- {0.4970269577847972},
- {0.05637070725112966},
- {0.6507426180419311},
- {0.7473968410221329},
- {0.13972025390675843},
- {0.15923239744513684},
- {0.19264736405522878},
- {0.3560629097010744},
- {0.5106218720890405},
- {0.05791258525662914},
- {0.17339712217400086},
- {0.19915164269574},
- {0.037229911281592934},
- {0.042429124370142846},
- {0.05133288891097538},
- {0.0948766565202729},
- {0.13606049563152361},
- {0.015431409197343992},
- {0.04509738440026375},
- {0.05179565884364146},
- {0.009682811336216382},
- {0.011035030498181081},
- {0.01335073497512406},
- {0.024675663563856323},
- {0.035386818398450065},
- {0.004013424119646278},
- {0.554352230638479},
- {0.636689675004619},
- {0.11902437656787276},
- {0.13564630971800998},
- {0.1641117287077052},
- {0.30332156334610827},
- {0.4349866843777493},
- {0.04933436035840642},
- {0.07310766339646767},
- {0.08396627969663507},
- {0.01569686848391741},
- {0.01788895976916256},
- {0.021642963369980048},
- {0.04000187882072246},
- {0.057365801643491456},
- {0.00650618796429907},
- {0.2509328204920141},
- {0.2882036494072386},
- {0.05387751842376505},
- {0.06140159488069511},
- {0.07428673807808835},
- {0.137301396476428},
- {0.19690086835523524},
- {0.0223316684008758},
- {0.4827608953679536},
- {0.5544649423034648},
- {0.10365307727965378},
- {0.11812838537224382},
- {0.14291766265658304},
- {0.2641493646317989},
- {0.37881070845782827},
- {0.04296311742373348},
- {0.48620323105782903},
- {0.5584185650554095},
- {0.10439217750651292},
- {0.11897070205707867},
- {0.1439367397516766},
- {0.26603288666942565},
- {0.3815118253750084},
- {0.043269466744639655},
- {0.28558443440763814},
- {0.3280020367555023},
- {0.06131752951315399},
- {0.06988061470535419},
- {0.08454508276925211},
- {0.15626151086660048},
- {0.22409114524495707},
- {0.02541547525404715},
- {0.5442841398248751},
- {0.6251261796063099},
- {0.11686266752065251},
- {0.13318271475204727},
- {0.1611311475953975},
- {0.2978126668779266},
- {0.42708649890184797},
- {0.048438354546817254},
- {0.5489143769225847},
- {0.6304441417069397},
- {0.11785682079262828},
- {0.13431570302324145},
- {0.1625018937968811},
- {0.30034616575737155},
- {0.4307197331015115},
- {0.04885042068978229},
- {0.34868702531665985},
- {0.40047719943598903},
- {0.07486621954749058},
- {0.08532139967449813},
- {0.10322612111934087},
- {0.1907889745762158},
- {0.2736062103571629},
- {0.03103126569809247},
- {0.09570032533600673},
- {0.10991460964419726},
- {0.020547714847907284},
- {0.023417234121509485},
- {0.028331347761860526},
- {0.05236376925951134},
- {0.0750937128255725},
- {0.008516813093915904},
- {0.12502077213162902},
- {0.1435899963559887},
- {0.026843076727340816},
- {0.030591752752973517},
- {0.03701144129114932},
- {0.06840686112154168},
- {0.09810075281062394},
- {0.011126174810416424},
- {0.12186753212408132},
- {0.139968408411254},
- {0.026166047926293203},
- {0.029820175861893998},
- {0.03607794875685766},
- {0.06668152182310813},
- {0.0956264822293535},
- {0.010845553446902235}};
-
-FLA_Obj_attach_buffer(A_arr, 1, m, &A);
-FLA_Obj_attach_buffer(B_arr, 1, p, &B);
-FLA_Obj_attach_buffer(C_arr_ref, 1, r, &C_ref);
-
-// Execute kernel being tested
-kernel_kron_prod_rec(A, B, C, 2);
-
-// Check success
-bool success = FLA_Obj_equals(C, C_ref);
-if (success)
-  printf ("Passed test 4 \n");
-else
-  printf ("Failed test 4 \n");
-}
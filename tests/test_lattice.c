@@ -0,0 +1,203 @@
+/*
+    Copyright (C) 2024, Chuck Garcia
+
+    This file is part of libfqam and is available under the 3-Clause
+    BSD license, which can be found in the LICENSE file at the top-level
+    directory, or at http://opensource.org/licenses/BSD-3-Clause
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "FLAME.h"
+#include "FQAM.h"
+#include "__FQAM_Stage.h"
+#include "assertf.h"
+
+#define TOL 1e-10
+
+/* Fills operator on 'dim' qubits with fixed entries, no symmetry */
+static void rule_create (FQAM_Op *A, int dim)
+{
+  FQAM_Op_create (A, "Rule", dim);
+
+  dcomplex *buf = FLA_Obj_buffer_at_view (A->mat_repr);
+  int size = 1 << dim;
+
+  for (int i = 0; i < size * size; i++)
+  {
+    buf[i].real = sin (3 * i + 1) / size;
+    buf[i].imag = cos (5 * i + 2) / size;
+  }
+}
+
+/* Returns copy of the final statevector */
+static dcomplex *final_state (void)
+{
+  size_t bytes = main_stage.state_space * sizeof (dcomplex);
+  dcomplex *result = malloc (bytes);
+
+  FQAM_compute_outcomes ();
+  memcpy (result, FLA_Obj_buffer_at_view (main_stage.statevector), bytes);
+  return result;
+}
+
+static bool states_equal (const dcomplex *a, const dcomplex *b, size_t N)
+{
+  for (size_t i = 0; i < N; i++)
+    if (fabs (a[i].real - b[i].real) > TOL || fabs (a[i].imag - b[i].imag) > TOL)
+      return false;
+  return true;
+}
+
+int main (void)
+{
+  FQAM_Op rule;
+  dcomplex *layered, *reference;
+  bool success = true;
+
+  // Open chain of 6 sites, brick-wall: bonds (0,1) (2,3) (4,5), then (1,2) (3,4)
+  FQAM_Lattice chain = FQAM_Lattice_1d (6, false);
+  int bonds[][2] = {{0, 1}, {2, 3}, {4, 5}, {1, 2}, {3, 4}};
+
+  FQAM_init (6, 5);
+  rule_create (&rule, 2);
+  success &= FQAM_Part_as_lattice (chain, rule, FQAM_PARTITION_BRICKWALL) == 2;
+  layered = final_state ();
+  FQAM_finalize ();
+
+  FQAM_init (6, 5);
+  rule_create (&rule, 2);
+  for (int b = 0; b < 5; b++)
+    FQAM_stage_append_on (rule, bonds[b], 2);
+  reference = final_state ();
+  FQAM_finalize ();
+
+  success &= states_equal (layered, reference, 1 << 6);
+  free (layered);
+  free (reference);
+
+  // Periodic 4 x 4 grid, checkerboard of 2 x 2 blocks. Blocks on the lower rows
+  // reach above the tile size and are applied to gathered tiles
+  FQAM_Lattice grid = FQAM_Lattice_2d (4, 4, true);
+
+  FQAM_init (16, 5);
+  rule_create (&rule, 4);
+  success &= FQAM_Part_as_lattice (grid, rule, FQAM_PARTITION_CHECKERBOARD) == 2;
+  layered = final_state ();
+  FQAM_finalize ();
+
+  FQAM_init (16, 5);
+  rule_create (&rule, 4);
+  for (int shift = 0; shift < 2; shift++)
+    for (int r = shift; r < 4; r += 2)
+      for (int c = shift; c < 4; c += 2)
+      {
+        int block[] = {FQAM_Lattice_site (grid, r, c), FQAM_Lattice_site (grid, r, c + 1),
+                       FQAM_Lattice_site (grid, r + 1, c),
+                       FQAM_Lattice_site (grid, r + 1, c + 1)};
+        FQAM_stage_append_on (rule, block, 4);
+      }
+  reference = final_state ();
+  FQAM_finalize ();
+
+  success &= states_equal (layered, reference, 1 << 16);
+  free (layered);
+  free (reference);
+
+  // Overlapping repeated operator keeps its order, across the fused tile size
+  int sites[] = {9, 10, 10, 11, 11, 12, 12, 13, 0, 1, 1, 2};
+
+  FQAM_init (14, 5);
+  rule_create (&rule, 2);
+  FQAM_stage_append_repeated (rule, sites, 6);
+  layered = final_state ();
+  FQAM_finalize ();
+
+  FQAM_init (14, 5);
+  rule_create (&rule, 2);
+  for (int s = 0; s < 6; s++)
+    FQAM_stage_append_on (rule, sites + 2 * s, 2);
+  reference = final_state ();
+  FQAM_finalize ();
+
+  success &= states_equal (layered, reference, 1 << 14);
+  free (layered);
+  free (reference);
+
+  // Overlapping chain over 14 qubits, wider than a tile, then a bond on 10 and
+  // 11. That bond fits the first tile but must follow the bonds on 11 and 12
+  int chain_sites[28];
+
+  for (int s = 0; s < 13; s++)
+  {
+    chain_sites[2 * s] = s;
+    chain_sites[2 * s + 1] = s + 1;
+  }
+  chain_sites[26] = 10;
+  chain_sites[27] = 11;
+
+  FQAM_init (14, 5);
+  rule_create (&rule, 2);
+  FQAM_stage_append_repeated (rule, chain_sites, 14);
+  layered = final_state ();
+  FQAM_finalize ();
+
+  FQAM_init (14, 5);
+  FQAM_stage_set_checkpoint_budget (SIZE_MAX);
+  rule_create (&rule, 2);
+  for (int s = 0; s < 14; s++)
+    FQAM_stage_append_on (rule, chain_sites + 2 * s, 2);
+  reference = final_state ();
+  FQAM_finalize ();
+
+  success &= states_equal (layered, reference, 1 << 14);
+  free (layered);
+  free (reference);
+
+  // Periodic 4 x 4 grid, brick-wall bonds, most of them above the tile size.
+  // Reference applies one bond per step, checkpointing every step
+  int num_bonds = 0, grid_bonds[32][2];
+
+  for (int r = 0; r < 4; r++)
+    for (int c = 0; c < 4; c++)
+    {
+      int site = FQAM_Lattice_site (grid, r, c);
+
+      grid_bonds[num_bonds][0] = site;
+      grid_bonds[num_bonds++][1] = FQAM_Lattice_site (grid, r, c + 1);
+      grid_bonds[num_bonds][0] = site;
+      grid_bonds[num_bonds++][1] = FQAM_Lattice_site (grid, r + 1, c);
+    }
+
+  FQAM_init (16, 5);
+  rule_create (&rule, 2);
+  FQAM_Part_as_lattice (grid, rule, FQAM_PARTITION_BRICKWALL);
+  layered = final_state ();
+  FQAM_finalize ();
+
+  // Brick-wall order: even then odd bonds along rows, then along columns
+  FQAM_init (16, 5);
+  FQAM_stage_set_checkpoint_budget (SIZE_MAX);
+  rule_create (&rule, 2);
+  for (int axis = 0; axis < 2; axis++)
+    for (int parity = 0; parity < 2; parity++)
+      for (int b = 0; b < num_bonds; b++)
+      {
+        int r = b / 8, c = (b / 2) % 4;
+
+        if (b % 2 == axis && (axis ? r : c) % 2 == parity)
+          FQAM_stage_append_on (rule, grid_bonds[b], 2);
+      }
+  reference = final_state ();
+  FQAM_finalize ();
+
+  success &= states_equal (layered, reference, 1 << 16);
+  free (layered);
+  free (reference);
+
+  if (success)
+    printf ("Passed test lattice \n");
+  else
+    printf ("Failed test lattice \n");
+}
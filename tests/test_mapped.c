@@ -0,0 +1,60 @@
+/*
+    Copyright (C) 2024, Chuck Garcia
+
+    This file is part of libfqam and is available under the 3-Clause
+    BSD license, which can be found in the LICENSE file at the top-level
+    directory, or at http://opensource.org/licenses/BSD-3-Clause
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "FLAME.h"
+#include "FQAM.h"
+#include "assertf.h"
+
+#define TOL 1e-12
+#define QUBITS 10
+
+/* Marginal of the first four qubits of a GHZ-like circuit, measuring qubit 9
+ * midway. Staged operators must outlive the stage */
+static void run (const char *state_dir, double *probs, double *p)
+{
+  static FQAM_Op H, cx, T;
+  FQAM_Config config = FQAM_CONFIG_DEFAULT;
+
+  config.state_dir = state_dir;
+  FQAM_init_config (QUBITS, 0, config);
+  FQAM_hadamard (&H);
+  FQAM_cnot (&cx);
+  FQAM_Phase_T (&T);
+
+  FQAM_stage_append_on (H, (int[]){0}, 1);
+  for (int q = 1; q < QUBITS; q++)
+    FQAM_stage_append_on (cx, (int[]){q - 1, q}, 2);
+  FQAM_stage_append_repeated (H, (int[]){1, 4, 9}, 3);
+
+  *p = FQAM_collapse ((int[]){9}, 1, 1);
+
+  FQAM_stage_append_on (T, (int[]){4}, 1);
+  FQAM_stage_append_on (H, (int[]){4}, 1);
+  FQAM_marginal ((int[]){0, 1, 4, 9}, 4, probs);
+  FQAM_finalize ();
+}
+
+int main (void)
+{
+  double probs[2][16], p[2];
+  bool success = true;
+
+  run (NULL, probs[0], &p[0]);
+  run ("/tmp", probs[1], &p[1]);
+
+  success &= fabs (p[0] - p[1]) < TOL;
+  for (int i = 0; i < 16; i++)
+    success &= fabs (probs[0][i] - probs[1][i]) < TOL;
+
+  if (success)
+    printf ("Passed test mapped \n");
+  else
+    printf ("Failed test mapped \n");
+}
@@ -0,0 +1,66 @@
+/*
+    Copyright (C) 2024, Chuck Garcia
+
+    This file is part of libfqam and is available under the 3-Clause
+    BSD license, which can be found in the LICENSE file at the top-level
+    directory, or at http://opensource.org/licenses/BSD-3-Clause
+*/
+
+#include <stdio.h>
+#include "FLAME.h"
+#include "FQAM.h"
+#include "__FQAM_Stage.h"
+#include "assertf.h"
+
+#define TOL 1e-12
+
+int main (void)
+{
+  double p[8] = {0.10, 0.20, 0.05, 0.15, 0.30, 0.00, 0.10, 0.10};
+  double probs[4];
+  bool success = true;
+
+  // Load a 3 qubit state with known outcome probabilities p
+  FQAM_init (3, 0);
+  dcomplex *buf = FLA_Obj_buffer_at_view (main_stage.statevector);
+  for (int i = 0; i < 8; i++)
+  {
+    buf[i].real = sqrt (p[i]) * 0.6;
+    buf[i].imag = sqrt (p[i]) * 0.8;
+  }
+
+  // Single qubit marginal: P(q0 = 1) = p1 + p3 + p5 + p7
+  int q0[1] = {0};
+  FQAM_marginal (q0, 1, probs);
+  success &= fabs (probs[1] - 0.45) < TOL && fabs (probs[0] - 0.55) < TOL;
+
+  // Reordered pair: bit 0 of outcome is q2, bit 1 is q0
+  int q20[2] = {2, 0};
+  FQAM_marginal (q20, 2, probs);
+  success &= fabs (probs[0] - (p[0] + p[2])) < TOL;
+  success &= fabs (probs[1] - (p[4] + p[6])) < TOL;
+  success &= fabs (probs[2] - (p[1] + p[3])) < TOL;
+  success &= fabs (probs[3] - (p[5] + p[7])) < TOL;
+
+  // Collapse q1 onto 1: survivors are indices 2, 3, 6, 7
+  int q1[1] = {1};
+  double p1 = FQAM_collapse (q1, 1, 1);
+  success &= fabs (p1 - 0.40) < TOL;
+
+  FQAM_marginal (q1, 1, probs);
+  success &= fabs (probs[1] - 1.0) < TOL;
+  success &= fabs (buf[3].real * buf[3].real + buf[3].imag * buf[3].imag -
+                   p[3] / p1) < TOL;
+
+  // Measuring a collapsed qubit is deterministic
+  FQAM_Rng rng;
+  FQAM_Rng_init (&rng, 1, 0);
+  success &= FQAM_measure (q1, 1, &rng) == 1;
+
+  if (success)
+    printf ("Passed test marginal \n");
+  else
+    printf ("Failed test marginal \n");
+
+  FQAM_finalize ();
+}
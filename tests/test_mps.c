@@ -0,0 +1,142 @@
+/*
+    Copyright (C) 2024, Chuck Garcia
+
+    This file is part of libfqam and is available under the 3-Clause
+    BSD license, which can be found in the LICENSE file at the top-level
+    directory, or at http://opensource.org/licenses/BSD-3-Clause
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "FLAME.h"
+#include "FQAM.h"
+#include "__FQAM_Stage.h"
+#include "assertf.h"
+
+#define TOL 1e-10
+
+/* Fills operator on 'dim' qubits with fixed entries, no symmetry */
+static void rule_create (FQAM_Op *A, int dim)
+{
+  FQAM_Op_create (A, "Rule", dim);
+
+  dcomplex *buf = FLA_Obj_buffer_at_view (A->mat_repr);
+  int size = 1 << dim;
+
+  for (int i = 0; i < size * size; i++)
+  {
+    buf[i].real = sin (3 * i + 1) / size;
+    buf[i].imag = cos (5 * i + 2) / size;
+  }
+}
+
+/* Controlled NOT, control on target 0 */
+static void cnot_create (FQAM_Op *A)
+{
+  FQAM_Op_create (A, "CNOT", 2);
+
+  dcomplex *buf = FLA_Obj_buffer_at_view (A->mat_repr);
+  int out[4] = {0, 3, 2, 1};
+
+  for (int in = 0; in < 4; in++)
+    buf[out[in] + 4 * in].real = 1.0;
+}
+
+/* Stages the same circuit on 6 qubits: brick-wall rule layers plus gates on
+ * distant and unordered targets. Staged operators must outlive the stage */
+static void stage_circuit (void)
+{
+  static FQAM_Op rule2, rule3, H;
+  int far[2] = {5, 0}, spread[3] = {4, 1, 2}, first[1] = {0};
+
+  rule_create (&rule2, 2);
+  rule_create (&rule3, 3);
+  FQAM_hadamard (&H);
+
+  FQAM_stage_append_on (H, first, 1);
+  FQAM_Part_as_lattice (FQAM_Lattice_1d (6, false), rule2, FQAM_PARTITION_BRICKWALL);
+  FQAM_stage_append_on (rule2, far, 2);
+  FQAM_stage_append_on (rule3, spread, 3);
+}
+
+int main (void)
+{
+  FQAM_Config config = FQAM_CONFIG_DEFAULT;
+  dcomplex reference[64];
+  unsigned char bits[80];
+  double probs[8], marginal[8] = {0};
+  bool success = true;
+
+  // Statevector reference
+  FQAM_init (6, 5);
+  stage_circuit ();
+  FQAM_compute_outcomes ();
+  memcpy (reference, FLA_Obj_buffer_at_view (main_stage.statevector), sizeof (reference));
+  FQAM_finalize ();
+
+  for (int b = 0; b < 64; b++)
+  {
+    double p = reference[b].real * reference[b].real + reference[b].imag * reference[b].imag;
+    marginal[(b >> 2) & 7] += p;
+  }
+
+  // Untruncated MPS reproduces every amplitude, and marginals of sites 2..4
+  config.backend = FQAM_BACKEND_MPS;
+  FQAM_init_config (6, 5, config);
+  stage_circuit ();
+
+  for (int b = 0; b < 64; b++)
+  {
+    for (int q = 0; q < 6; q++)
+      bits[q] = (b >> q) & 1;
+
+    dcomplex a = FQAM_mps_amplitude (bits);
+    success &= fabs (a.real - reference[b].real) < TOL;
+    success &= fabs (a.imag - reference[b].imag) < TOL;
+  }
+
+  FQAM_mps_window_probabilities (2, 3, probs);
+  for (int s = 0; s < 8; s++)
+    success &= fabs (probs[s] - marginal[s]) < TOL;
+  FQAM_finalize ();
+
+  // GHZ state on 80 sites, past the reach of a statevector
+  FQAM_Op H, cx;
+
+  FQAM_init_config (80, 0, config);
+  FQAM_hadamard (&H);
+  cnot_create (&cx);
+  FQAM_stage_append_on (H, (int[]){0}, 1);
+  for (int q = 0; q + 1 < 80; q++)
+    FQAM_stage_append_on (cx, (int[]){q, q + 1}, 2);
+
+  memset (bits, 1, sizeof (bits));
+  success &= fabs (FQAM_mps_amplitude (bits).real - sqrt (0.5)) < TOL;
+  bits[40] = 0;
+  success &= fabs (FQAM_mps_amplitude (bits).real) < TOL;
+
+  FQAM_mps_window_probabilities (39, 3, probs);
+  success &= fabs (probs[0] - 0.5) < TOL && fabs (probs[7] - 0.5) < TOL;
+  success &= FQAM_mps_max_bond () == 2;
+  success &= FQAM_mps_truncation_error () < TOL;
+
+  // Layer on sites 0 and 64, beyond a 64 bit mask of touched qubits
+  FQAM_Op X;
+
+  FQAM_Pauli_x (&X);
+  FQAM_stage_append_layer ((FQAM_Op[]){X, X}, (int[]){0, 64}, (int[]){1, 1}, 2);
+  memset (bits, 1, sizeof (bits));
+  bits[0] = bits[64] = 0;
+  success &= fabs (FQAM_mps_amplitude (bits).real - sqrt (0.5)) < TOL;
+
+  // No statevector to checkpoint, so a budget leaves checkpointing disabled
+  FQAM_stage_set_checkpoint_budget (1 << 20);
+  success &= main_stage.checkpoint_stride == 0;
+  FQAM_finalize ();
+
+  if (success)
+    printf ("Passed test mps \n");
+  else
+    printf ("Failed test mps \n");
+}
@@ -0,0 +1,128 @@
+/*
+    Copyright (C) 2024, Chuck Garcia
+
+    This file is part of libfqam and is available under the 3-Clause
+    BSD license, which can be found in the LICENSE file at the top-level
+    directory, or at http://opensource.org/licenses/BSD-3-Clause
+*/
+
+#include <stdio.h>
+#include "FLAME.h"
+#include "FQAM.h"
+#include "__FQAM_Stage.h"
+#include "assertf.h"
+
+#define TOL 1e-12
+
+/* Controlled not, control on target 0 */
+static void cnot (FQAM_Op *A)
+{
+  FQAM_Op_create (A, "CX", 2);
+
+  dcomplex *buf = FLA_Obj_buffer_at_view (A->mat_repr);
+  dim_t cs = FLA_Obj_col_stride (A->mat_repr);
+
+  buf[0 + 0 * cs].real = 1.0;
+  buf[3 + 1 * cs].real = 1.0;
+  buf[2 + 2 * cs].real = 1.0;
+  buf[1 + 3 * cs].real = 1.0;
+}
+
+/* Real rotation [[c, -s], [s, c]] */
+static void rotation (double theta, FQAM_Op *A)
+{
+  FQAM_Op_create (A, "R", 1);
+
+  dcomplex *buf = FLA_Obj_buffer_at_view (A->mat_repr);
+  dim_t cs = FLA_Obj_col_stride (A->mat_repr);
+
+  buf[0 + 0 * cs].real = cos (theta);
+  buf[1 + 0 * cs].real = sin (theta);
+  buf[0 + 1 * cs].real = -sin (theta);
+  buf[1 + 1 * cs].real = cos (theta);
+}
+
+static bool amp_equals (dcomplex a, double re, double im)
+{
+  return fabs (a.real - re) < TOL && fabs (a.imag - im) < TOL;
+}
+
+int main (void)
+{
+  FQAM_Op H, CX, P, R;
+  FQAM_Path *paths;
+  bool success = true;
+  int q0[] = {0}, q2[] = {2}, q3[] = {3}, q01[] = {0, 1}, q32[] = {3, 2};
+
+  // Path sums agree with the statevector
+  FQAM_init (4, 5);
+  FQAM_hadamard (&H);
+  FQAM_PhaseA (M_PI / 3, &P);
+  cnot (&CX);
+
+  FQAM_stage_append_on (H, q0, 1);
+  FQAM_stage_append_on (H, q3, 1);
+  FQAM_stage_append_on (CX, q01, 2);
+  FQAM_stage_append_on (P, q3, 1);
+  FQAM_stage_append_on (CX, q32, 2);
+  FQAM_stage_append_on (H, q2, 1);
+  FQAM_compute_outcomes ();
+
+  uint64_t outputs[16];
+  dcomplex amps[16];
+  dcomplex *psi = FLA_Obj_buffer_at_view (main_stage.statevector);
+
+  for (int i = 0; i < 16; i++)
+    outputs[i] = i;
+  FQAM_amplitudes (outputs, 16, amps);
+
+  for (int i = 0; i < 16; i++)
+    success &= amp_equals (amps[i], psi[i].real, psi[i].imag);
+
+  FQAM_finalize ();
+
+  // 48 qubit GHZ state without a statevector
+  FQAM_init_config (48, 0, (FQAM_Config){.backend = FQAM_BACKEND_PATHSUM});
+  FQAM_hadamard (&H);
+  cnot (&CX);
+
+  FQAM_stage_append_on (H, q0, 1);
+  for (int q = 0; q < 47; q++)
+  {
+    int targets[] = {q, q + 1};
+    FQAM_stage_append_on (CX, targets, 2);
+  }
+
+  success &= amp_equals (FQAM_amplitude (0), M_SQRT1_2, 0);
+  success &= amp_equals (FQAM_amplitude ((1ULL << 48) - 1), M_SQRT1_2, 0);
+  success &= amp_equals (FQAM_amplitude (1), 0, 0);
+
+  // Dominant paths: both GHZ branches, most probable first
+  success &= FQAM_dominant_paths (4, 0.0, &paths) == 2;
+  success &= fabs (paths[0].probability - 0.5) < TOL;
+  success &= paths[0].states[48] == 0 || paths[0].states[48] == (1ULL << 48) - 1;
+  FQAM_paths_free (paths, 2);
+
+  FQAM_finalize ();
+
+  // Two rotations of |0>: paths 000 (c^4), 011 and 001 (c^2 s^2), 010 (s^4)
+  double c = cos (0.3), s = sin (0.3);
+
+  FQAM_init (1, 0);
+  rotation (0.3, &R);
+  FQAM_stage_append (R);
+  FQAM_stage_append (R);
+
+  success &= FQAM_dominant_paths (0, 0.5 * c * c * s * s, &paths) == 3;
+  success &= fabs (paths[0].probability - c * c * c * c) < TOL;
+  success &= paths[0].states[1] == 0 && paths[0].states[2] == 0;
+  success &= fabs (paths[2].probability - c * c * s * s) < TOL;
+  FQAM_paths_free (paths, 3);
+
+  if (success)
+    printf ("Passed test pathsum \n");
+  else
+    printf ("Failed test pathsum \n");
+
+  FQAM_finalize ();
+}
@@ -0,0 +1,95 @@
+/*
+    Copyright (C) 2024, Chuck Garcia
+
+    This file is part of libfqam and is available under the 3-Clause
+    BSD license, which can be found in the LICENSE file at the top-level
+    directory, or at http://opensource.org/licenses/BSD-3-Clause
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "FLAME.h"
+#include "FQAM.h"
+#include "assertf.h"
+
+#define TOL 1e-5
+#define QUBITS 8
+#define OUTCOMES (1 << 3)
+
+/* Stages a circuit covering local, layer, whole register and rotation steps.
+ * Staged operators must outlive the stage */
+static void stage_circuit (void)
+{
+  static FQAM_Op H, cx, T, W;
+  FQAM_Op layer[2];
+  FQAM_Pauli_term rotations[2] = {{0.3, 0x13, 0x46}, {-0.8, 0x13, 0x81}};
+
+  FQAM_hadamard (&H);
+  FQAM_cnot (&cx);
+  FQAM_Phase_T (&T);
+
+  // Whole register: cyclic shift of basis states with phases
+  FQAM_Op_create (&W, "Shift", QUBITS);
+  dcomplex *w = FLA_Obj_buffer_at_view (W.mat_repr);
+  for (int b = 0; b < 1 << QUBITS; b++)
+    w[(b + 1) % (1 << QUBITS) + b * (1 << QUBITS)] = FQAM_CMPXA (0.1 * b);
+
+  layer[0] = H;
+  layer[1] = cx;
+
+  FQAM_stage_append_repeated (H, (int[]){0, 3, 5, 7}, 4);
+  FQAM_stage_append_on (cx, (int[]){0, 6}, 2);
+  FQAM_stage_append_layer (layer, (int[]){1, 2, 4}, (int[]){1, 2}, 2);
+  FQAM_stage_append_on (T, (int[]){5}, 1);
+  FQAM_stage_append (W);
+  FQAM_stage_append_rotations (rotations, 2);
+}
+
+/* Marginal, expectation and partial measurement of the circuit in 'precision' */
+static void run (FQAM_Precision precision, double *probs, double *values)
+{
+  FQAM_Config config = FQAM_CONFIG_DEFAULT;
+  FQAM_Pauli_sum H;
+
+  config.precision = precision;
+  FQAM_init_config (QUBITS, 5, config);
+  stage_circuit ();
+
+  FQAM_marginal ((int[]){0, 4, 6}, 3, probs);
+
+  FQAM_Pauli_sum_create (&H);
+  FQAM_Pauli_sum_add (&H, 1.0, "ZIIXIIYZ");
+  FQAM_Pauli_sum_add (&H, 0.5, "XXIIZIII");
+  FQAM_Pauli_sum_add (&H, -0.2, "IIZIIZII");
+  FQAM_Pauli_sum_add (&H, 0.7, "ZIIIZIZI");
+  values[0] = FQAM_expectation (&H);
+
+  values[1] = FQAM_collapse ((int[]){1}, 1, 1);
+  values[2] = FQAM_expectation (&H);
+  FQAM_Pauli_sum_free (&H);
+
+  FQAM_finalize ();
+}
+
+int main (void)
+{
+  double probs[2][OUTCOMES], values[2][3];
+  bool success = true;
+
+  run (FQAM_PRECISION_DOUBLE, probs[0], values[0]);
+  run (FQAM_PRECISION_SINGLE, probs[1], values[1]);
+
+  for (int i = 0; i < OUTCOMES; i++)
+    success &= fabs (probs[0][i] - probs[1][i]) < TOL;
+  for (int i = 0; i < 3; i++)
+    success &= fabs (values[0][i] - values[1][i]) < TOL;
+
+  // The observable does not vanish, so amplitudes are compared
+  success &= fabs (values[0][0]) > 1e-2;
+
+  if (success)
+    printf ("Passed test precision \n");
+  else
+    printf ("Failed test precision \n");
+}
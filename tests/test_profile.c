@@ -0,0 +1,116 @@
+/*
+    Copyright (C) 2024, Chuck Garcia
+
+    This file is part of libfqam and is available under the 3-Clause
+    BSD license, which can be found in the LICENSE file at the top-level
+    directory, or at http://opensource.org/licenses/BSD-3-Clause
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "FLAME.h"
+#include "FQAM.h"
+#include "__FQAM_Stage.h"
+#include "assertf.h"
+
+#define QUBITS 6
+#define TRACE_FILE "/tmp/fqam_test_profile.json"
+
+/* Occurrences of 'pattern' in the trace file */
+static int count (const char *pattern)
+{
+  static char text[1 << 16];
+  FILE *f = fopen (TRACE_FILE, "r");
+  int n = 0;
+
+  assertf (f, "Error: Failed to open %s", TRACE_FILE);
+  text[fread (text, 1, sizeof (text) - 1, f)] = '\0';
+  fclose (f);
+
+  for (const char *s = strstr (text, pattern); s; s = strstr (s + 1, pattern))
+    n++;
+  return n;
+}
+
+int main (void)
+{
+  static FQAM_Op H, X, cx, U;
+  bool success = true;
+
+  FQAM_init (QUBITS, 0);
+
+  // Every step checkpointed: no fused runs, one scope per step
+  FQAM_stage_set_checkpoint_budget (SIZE_MAX);
+
+  // Counters are optional; timers are recorded either way
+  FQAM_profile_start (true);
+
+  FQAM_hadamard (&H);
+  FQAM_Pauli_x (&X);
+  FQAM_cnot (&cx);
+
+  // Whole register identity, applied by Gemv
+  FQAM_Op_create (&U, "U", QUBITS);
+  dcomplex *u = FLA_Obj_buffer_at_view (U.mat_repr);
+  for (int i = 0; i < 1 << QUBITS; i++)
+    u[i + i * FLA_Obj_col_stride (U.mat_repr)].real = 1.0;
+
+  FQAM_stage_append_on (H, (int[]){0}, 1);
+  FQAM_stage_append_on (cx, (int[]){0, 3}, 2);
+  FQAM_stage_append (U);
+  FQAM_stage_append_on (X, (int[]){5}, 1);
+  FQAM_compute_outcomes ();
+
+  FQAM_profile_stop ();
+
+  // Not recorded once stopped
+  FQAM_stage_append_on (X, (int[]){4}, 1);
+  FQAM_compute_outcomes ();
+
+  FQAM_profile_write_trace (TRACE_FILE);
+  FQAM_profile_report ();
+
+  success &= count ("\"traceEvents\"") == 1;
+  success &= count ("\"cat\": \"compute_outcomes\"") == 1;
+  success &= count ("\"cat\": \"apply\"") == 4;
+  success &= count ("\"cat\": \"gemv\"") == 1;
+  success &= count ("\"cat\": \"checkpoint_store\"") == 4;
+
+  // Hadamard and Pauli X (named Not) are built from 4 and 2 outer products
+  success &= count ("\"cat\": \"op_add\"") == 6;
+  success &= count ("\"name\": \"Not\", \"cat\": \"apply\"") == 1;
+  success &= count ("\"step\": 2") == 2;
+
+  FQAM_finalize ();
+
+  // Trajectories apply steps after the channel in parallel, unrecorded
+  unsigned long outcomes[64];
+
+  FQAM_init (QUBITS, 0);
+  FQAM_hadamard (&H);
+  FQAM_Op_create (&U, "U", QUBITS);
+  u = FLA_Obj_buffer_at_view (U.mat_repr);
+  for (int i = 0; i < 1 << QUBITS; i++)
+    u[i + i * FLA_Obj_col_stride (U.mat_repr)].real = 1.0;
+
+  FQAM_stage_append_on (H, (int[]){0}, 1);
+  FQAM_stage_append_depolarizing (0, 0.5);
+  FQAM_stage_append (U);
+
+  FQAM_profile_start (false);
+  FQAM_trajectories (64, 3, NULL, outcomes, NULL);
+  FQAM_profile_stop ();
+
+  FQAM_profile_write_trace (TRACE_FILE);
+  success &= count ("\"cat\": \"gemv\"") == 0;
+  success &= count ("\"cat\": \"apply\"") == 1;
+
+  FQAM_finalize ();
+  remove (TRACE_FILE);
+
+  if (success)
+    printf ("Passed test profile \n");
+  else
+    printf ("Failed test profile \n");
+}
@@ -0,0 +1,69 @@
+/*
+    Copyright (C) 2024, Chuck Garcia
+
+    This file is part of libfqam and is available under the 3-Clause
+    BSD license, which can be found in the LICENSE file at the top-level
+    directory, or at http://opensource.org/licenses/BSD-3-Clause
+*/
+
+#include <stdio.h>
+#include <string.h>
+#include "FLAME.h"
+#include "FQAM.h"
+#include "assertf.h"
+
+#define SHOTS 1000000
+
+int main (void)
+{
+  FQAM_Op H;
+  bool success = true;
+  unsigned long *a = malloc (SHOTS * sizeof (unsigned long));
+  unsigned long *b = malloc (SHOTS * sizeof (unsigned long));
+
+  // |+> measures 0 and 1 with equal probability
+  FQAM_init (1, 0);
+  FQAM_hadamard (&H);
+  FQAM_stage_append (H);
+
+  FQAM_sample (SHOTS, 42, a);
+  FQAM_sample (SHOTS, 42, b);
+
+  // Same seed reproduces the same samples
+  success &= memcmp (a, b, SHOTS * sizeof (unsigned long)) == 0;
+
+  size_t ones = 0;
+  for (size_t i = 0; i < SHOTS; i++)
+    ones += a[i];
+
+  // Five standard deviations of a fair coin over SHOTS draws
+  success &= fabs ((double)ones / SHOTS - 0.5) < 5 * 0.5 / sqrt (SHOTS);
+
+  // H -> H returns to |0>, which must always be sampled
+  FQAM_stage_append (H);
+  FQAM_sample (SHOTS, 7, a);
+  for (size_t i = 0; i < SHOTS; i++)
+    success &= a[i] == 0;
+
+  FQAM_finalize ();
+
+  // A new session reaching the same state version must not sample from the
+  // previous session's table: H -> H on |1> always measures 1
+  FQAM_init (1, 1);
+  FQAM_hadamard (&H);
+  FQAM_stage_append (H);
+  FQAM_compute_outcomes ();
+  FQAM_stage_append (H);
+  FQAM_sample (SHOTS, 7, a);
+  for (size_t i = 0; i < SHOTS; i++)
+    success &= a[i] == 1;
+
+  if (success)
+    printf ("Passed test sample \n");
+  else
+    printf ("Failed test sample \n");
+
+  free (a);
+  free (b);
+  FQAM_finalize ();
+}
@@ -0,0 +1,113 @@
+/*
+    Copyright (C) 2024, Chuck Garcia
+
+    This file is part of libfqam and is available under the 3-Clause
+    BSD license, which can be found in the LICENSE file at the top-level
+    directory, or at http://opensource.org/licenses/BSD-3-Clause
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "FLAME.h"
+#include "FQAM.h"
+#include "__FQAM_Stage.h"
+#include "assertf.h"
+
+#define TOL 1e-12
+#define QUBITS 17
+#define RAW_FILE "/tmp/fqam_test_snapshot.raw"
+#define BLOCKS_FILE "/tmp/fqam_test_snapshot.blk"
+
+static FQAM_Op H, cx, T;
+
+/* First half of the circuit, on qubits below 16: amplitudes with qubit 16 set,
+ * the upper half of the statevector, stay zero */
+static void stage_first (void)
+{
+  FQAM_stage_append_repeated (H, (int[]){0, 3, 15, 7}, 4);
+  FQAM_stage_append_on (cx, (int[]){0, 9}, 2);
+  FQAM_stage_append_on (T, (int[]){9}, 1);
+}
+
+static void stage_second (void)
+{
+  FQAM_stage_append_on (H, (int[]){16}, 1);
+  FQAM_stage_append_on (cx, (int[]){16, 3}, 2);
+  FQAM_stage_append_on (T, (int[]){3}, 1);
+}
+
+static void init (void)
+{
+  FQAM_init (QUBITS, 6);
+  FQAM_hadamard (&H);
+  FQAM_cnot (&cx);
+  FQAM_Phase_T (&T);
+}
+
+static bool equal (const dcomplex *a, const dcomplex *b)
+{
+  bool same = true;
+
+  for (size_t i = 0; i < 1 << QUBITS; i++)
+    same &= fabs (a[i].real - b[i].real) < TOL && fabs (a[i].imag - b[i].imag) < TOL;
+  return same;
+}
+
+/* Resumes the circuit from snapshot 'path'. The last step is popped and staged
+ * again, so it is recomputed from the loaded base state */
+static bool resume (const char *path, const dcomplex *expected)
+{
+  bool success;
+
+  init ();
+  FQAM_snapshot_load (path);
+  stage_second ();
+  FQAM_compute_outcomes ();
+  success = equal (FLA_Obj_buffer_at_view (main_stage.statevector), expected);
+
+  FQAM_stage_set_checkpoint_budget (0);
+  FQAM_stage_pop ();
+  FQAM_stage_append_on (T, (int[]){3}, 1);
+  FQAM_compute_outcomes ();
+  success &= equal (FLA_Obj_buffer_at_view (main_stage.statevector), expected);
+
+  FQAM_finalize ();
+  return success;
+}
+
+int main (void)
+{
+  dcomplex *expected = malloc ((1 << QUBITS) * sizeof (dcomplex));
+  struct stat raw, blocks;
+  bool success = true;
+
+  init ();
+  stage_first ();
+  FQAM_snapshot_save (RAW_FILE, FQAM_SNAPSHOT_RAW);
+  FQAM_snapshot_save (BLOCKS_FILE, FQAM_SNAPSHOT_BLOCKS);
+  stage_second ();
+  FQAM_compute_outcomes ();
+  memcpy (expected, FLA_Obj_buffer_at_view (main_stage.statevector),
+          (1 << QUBITS) * sizeof (dcomplex));
+  FQAM_finalize ();
+
+  success &= resume (RAW_FILE, expected);
+  success &= resume (BLOCKS_FILE, expected);
+
+  // The zero upper half is elided from block snapshots
+  stat (RAW_FILE, &raw);
+  stat (BLOCKS_FILE, &blocks);
+  success &= blocks.st_size < raw.st_size / 2 + 4096;
+
+  unlink (RAW_FILE);
+  unlink (BLOCKS_FILE);
+  free (expected);
+
+  if (success)
+    printf ("Passed test snapshot \n");
+  else
+    printf ("Failed test snapshot \n");
+}
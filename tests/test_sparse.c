@@ -0,0 +1,139 @@
+/*
+    Copyright (C) 2024, Chuck Garcia
+
+    This file is part of libfqam and is available under the 3-Clause
+    BSD license, which can be found in the LICENSE file at the top-level
+    directory, or at http://opensource.org/licenses/BSD-3-Clause
+*/
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "FLAME.h"
+#include "FQAM.h"
+#include "__FQAM_Stage.h"
+#include "assertf.h"
+
+#define TOL 1e-10
+#define QUBITS 10
+#define TERMS 64
+#define SHOTS 1000
+
+static int all[QUBITS] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+
+/* Results of one run of the circuit */
+typedef struct
+{
+  double probs[3][1 << QUBITS]; // Before collapse, at the end, after a pop
+  double values[TERMS];         // Pauli expectations before collapse
+  bool sparse[2];               // sparse_active () before collapse and at the end
+  bool samples_valid;           // Every sample has nonzero probability
+} result;
+
+/*
+Stages a circuit keeping 8 nonzero amplitudes, measures qubit 0, then spreads the
+state over the whole register with Hadamards, which densifies the sparse backend.
+Staged operators must outlive the stage, so they are static.
+*/
+static void run (FQAM_Backend backend, result *r)
+{
+  static FQAM_Op X, Y, H, T, cx, layer[2];
+  FQAM_Config config = FQAM_CONFIG_DEFAULT;
+  FQAM_Pauli_term rotations[2] = {{0.3, 1 << 2 | 1 << 5, 1 << 5},
+                                  {-0.2, 0, 1 << 0 | 1 << 9}};
+  FQAM_Rng rng;
+  unsigned long outcomes[SHOTS];
+
+  config.backend = backend;
+  FQAM_init_config (QUBITS, 0x2B, config);
+  FQAM_Pauli_x (&X);
+  FQAM_Pauli_y (&Y);
+  FQAM_hadamard (&H);
+  FQAM_Phase_T (&T);
+  FQAM_cnot (&cx);
+  layer[0] = H;
+  layer[1] = cx;
+
+  FQAM_stage_append_on (X, (int[]){3}, 1);
+  FQAM_stage_append_on (H, (int[]){0}, 1);
+  FQAM_stage_append_on (cx, (int[]){0, 4}, 2);
+  FQAM_stage_append_layer (layer, (int[]){1, 6, 7}, (int[]){1, 2}, 2);
+  FQAM_stage_append_on (T, (int[]){1}, 1);
+  FQAM_stage_append_repeated (cx, (int[]){4, 8, 8, 9}, 2);
+  FQAM_stage_append_rotations (rotations, 2);
+  FQAM_stage_append_on (Y, (int[]){7}, 1);
+
+  FQAM_marginal (all, QUBITS, r->probs[0]);
+  r->sparse[0] = sparse_active ();
+
+  FQAM_Rng_init (&rng, 3, 0);
+  for (int t = 0; t < TERMS; t++)
+  {
+    FQAM_Pauli_sum P;
+    uint64_t x = FQAM_Rng_u32 (&rng) % (1 << QUBITS);
+    uint64_t z = FQAM_Rng_u32 (&rng) % (1 << QUBITS);
+
+    // Every other term flips no qubit, so diagonal terms are covered too. The
+    // first two are Y_1 and Y_1 Y_2 Y_5, of nonzero expectation, covering both
+    // signs of i^{|x & z|}
+    if (t < 2)
+      x = z = t ? 1 << 1 | 1 << 2 | 1 << 5 : 1 << 1;
+
+    FQAM_Pauli_sum_create (&P);
+    FQAM_Pauli_sum_add_masks (&P, 1.0, t % 2 || t < 2 ? x : 0, z);
+    r->values[t] = FQAM_expectation (&P);
+    FQAM_Pauli_sum_free (&P);
+  }
+
+  r->samples_valid = true;
+  FQAM_sample (SHOTS, 5, outcomes);
+  for (int s = 0; s < SHOTS; s++)
+    r->samples_valid &= r->probs[0][outcomes[s]] > 0.0;
+
+  FQAM_collapse (all, 1, 1);
+
+  FQAM_stage_append_layer ((FQAM_Op[]){H, H}, (int[]){2, 3}, (int[]){1, 1}, 2);
+  FQAM_stage_append_repeated (H, all, QUBITS);
+  FQAM_stage_append_rotations (rotations, 2);
+  FQAM_stage_append_on (cx, (int[]){9, 2}, 2);
+
+  FQAM_marginal (all, QUBITS, r->probs[1]);
+  r->sparse[1] = sparse_active ();
+
+  // Recomputed from the collapsed base on the densified statevector
+  FQAM_stage_pop ();
+  FQAM_stage_pop ();
+  FQAM_marginal (all, QUBITS, r->probs[2]);
+
+  FQAM_finalize ();
+}
+
+static bool results_equal (const double *a, const double *b, size_t n)
+{
+  for (size_t i = 0; i < n; i++)
+    if (fabs (a[i] - b[i]) > TOL)
+      return false;
+  return true;
+}
+
+int main (void)
+{
+  static result dense, sparse;
+  bool success = true;
+
+  run (FQAM_BACKEND_STATEVECTOR, &dense);
+  run (FQAM_BACKEND_SPARSE, &sparse);
+
+  // Sparse until the Hadamards on every qubit, dense afterwards
+  success &= sparse.sparse[0] && !sparse.sparse[1];
+  success &= sparse.samples_valid && dense.samples_valid;
+  success &= results_equal (dense.values, sparse.values, TERMS);
+  for (int i = 0; i < 3; i++)
+    success &= results_equal (dense.probs[i], sparse.probs[i], 1 << QUBITS);
+
+  if (success)
+    printf ("Passed test sparse \n");
+  else
+    printf ("Failed test sparse \n");
+}
@@ -0,0 +1,173 @@
+/*
+    Copyright (C) 2024, Chuck Garcia
+
+    This file is part of libfqam and is available under the 3-Clause
+    BSD license, which can be found in the LICENSE file at the top-level
+    directory, or at http://opensource.org/licenses/BSD-3-Clause
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "FLAME.h"
+#include "FQAM.h"
+#include "__FQAM_Stage.h"
+#include "assertf.h"
+
+#define TOL 1e-10
+#define QUBITS 6
+#define DEPTH 60
+#define PAULIS (1 << (2 * QUBITS))
+
+/* Stages a fixed pseudo-random circuit of H, S, X, Y, Z, CNOT and SWAP gates,
+ * ending with a T gate if 't_gate' is set. Staged operators must outlive the
+ * stage, so they are kept in 'ops' */
+static void stage_circuit (FQAM_Op *ops, bool t_gate)
+{
+  FQAM_Rng rng;
+  int n = 0;
+
+  FQAM_Rng_init (&rng, 7, 0);
+
+  for (int d = 0; d < DEPTH; d++)
+  {
+    int a = FQAM_Rng_u32 (&rng) % QUBITS;
+    int b = (a + 1 + FQAM_Rng_u32 (&rng) % (QUBITS - 1)) % QUBITS;
+    int targets[2] = {a, b};
+    FQAM_Op *op = &ops[n++];
+
+    switch (FQAM_Rng_u32 (&rng) % 7)
+    {
+    case 0: FQAM_hadamard (op); break;
+    case 1: FQAM_Phase (op); break;
+    case 2: FQAM_Pauli_x (op); break;
+    case 3: FQAM_Pauli_y (op); break;
+    case 4: FQAM_Pauli_z (op); break;
+    case 5: FQAM_cnot (op); break;
+    default:
+      // SWAP from the CNOT basis: entries moved by hand
+      FQAM_Op_create (op, "SWAP", 2);
+      dcomplex *buf = FLA_Obj_buffer_at_view (op->mat_repr);
+      buf[0].real = buf[2 + 4].real = buf[1 + 8].real = buf[3 + 12].real = 1.0;
+      break;
+    }
+
+    FQAM_stage_append_on (*op, targets, op->dimension);
+  }
+
+  if (t_gate)
+  {
+    FQAM_Phase_T (&ops[n]);
+    FQAM_stage_append_on (ops[n], (int[]){2}, 1);
+  }
+}
+
+/* Full distribution and Pauli expectations of the circuit on 'backend'. Returns
+ * true if they were computed from a tableau */
+static bool run (FQAM_Backend backend, bool t_gate, double *probs, double *values,
+                 bool *clifford)
+{
+  static FQAM_Op ops[DEPTH + 1];
+  FQAM_Config config = FQAM_CONFIG_DEFAULT;
+  int qubits[QUBITS] = {0, 1, 2, 3, 4, 5};
+
+  config.backend = backend;
+  FQAM_init_config (QUBITS, 5, config);
+  stage_circuit (ops, t_gate);
+
+  *clifford = FQAM_stage_is_clifford ();
+  FQAM_marginal (qubits, QUBITS, probs);
+  bool tableau = stabilizer_active ();
+
+  // Every Pauli string: the 2^QUBITS stabilizers give +-1, all others 0
+  for (int s = 0; s < PAULIS; s++)
+  {
+    FQAM_Pauli_sum H;
+    FQAM_Pauli_sum_create (&H);
+    FQAM_Pauli_sum_add_masks (&H, 1.0, s >> QUBITS, s & ((1 << QUBITS) - 1));
+    values[s] = FQAM_expectation (&H);
+    FQAM_Pauli_sum_free (&H);
+  }
+
+  FQAM_finalize ();
+  return tableau;
+}
+
+static bool results_equal (const double *a, const double *b, size_t n)
+{
+  for (size_t i = 0; i < n; i++)
+    if (fabs (a[i] - b[i]) > TOL)
+      return false;
+  return true;
+}
+
+int main (void)
+{
+  double probs[2][1 << QUBITS], values[2][PAULIS];
+  bool clifford, tableau, success = true;
+
+  // Clifford circuit: tableau matches statevector
+  run (FQAM_BACKEND_STATEVECTOR, false, probs[0], values[0], &clifford);
+  tableau = run (FQAM_BACKEND_STABILIZER, false, probs[1], values[1], &clifford);
+  success &= clifford && tableau;
+  success &= results_equal (probs[0], probs[1], 1 << QUBITS);
+  success &= results_equal (values[0], values[1], PAULIS);
+
+  // Trailing T gate: stage falls back to a statevector
+  run (FQAM_BACKEND_STATEVECTOR, true, probs[0], values[0], &clifford);
+  tableau = run (FQAM_BACKEND_STABILIZER, true, probs[1], values[1], &clifford);
+  success &= !clifford && !tableau;
+  success &= results_equal (probs[0], probs[1], 1 << QUBITS);
+  success &= results_equal (values[0], values[1], PAULIS);
+
+  // GHZ state on 2000 qubits: measuring one qubit fixes all others
+  FQAM_Config config = FQAM_CONFIG_DEFAULT;
+  FQAM_Op H, cx;
+  FQAM_Pauli_sum ZZ;
+  FQAM_Rng rng;
+  int n = 2000, first = 0, last = n - 1;
+
+  config.backend = FQAM_BACKEND_STABILIZER;
+  FQAM_init_config (n, 0, config);
+  FQAM_hadamard (&H);
+  FQAM_cnot (&cx);
+  FQAM_stage_append_on (H, &first, 1);
+  for (int q = 0; q + 1 < n; q++)
+    FQAM_stage_append_on (cx, (int[]){q, q + 1}, 2);
+
+  FQAM_Pauli_sum_create (&ZZ);
+  FQAM_Pauli_sum_add_masks (&ZZ, 1.0, 0, 1ULL | 1ULL << 63);
+  success &= fabs (FQAM_expectation (&ZZ) - 1.0) < TOL;
+  FQAM_Pauli_sum_free (&ZZ);
+
+  FQAM_marginal (&last, 1, probs[0]);
+  success &= fabs (probs[0][0] - 0.5) < TOL && fabs (probs[0][1] - 0.5) < TOL;
+
+  FQAM_Rng_init (&rng, 11, 0);
+  unsigned long outcome = FQAM_measure (&first, 1, &rng);
+  FQAM_marginal (&last, 1, probs[0]);
+  success &= fabs (probs[0][outcome] - 1.0) < TOL;
+  FQAM_finalize ();
+
+  // GHZ state on 48 qubits, past the statevector sampling limit: shots are all
+  // zeros or all ones
+  unsigned long shots[64];
+
+  n = 48;
+  FQAM_init_config (n, 0, config);
+  FQAM_hadamard (&H);
+  FQAM_cnot (&cx);
+  FQAM_stage_append_on (H, &first, 1);
+  for (int q = 0; q + 1 < n; q++)
+    FQAM_stage_append_on (cx, (int[]){q, q + 1}, 2);
+
+  FQAM_sample (64, 5, shots);
+  for (int s = 0; s < 64; s++)
+    success &= shots[s] == 0 || shots[s] == (1UL << n) - 1;
+  FQAM_finalize ();
+
+  if (success)
+    printf ("Passed test stabilizer \n");
+  else
+    printf ("Failed test stabilizer \n");
+}
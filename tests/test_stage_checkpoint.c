@@ -0,0 +1,71 @@
+/*
+    Copyright (C) 2024, Chuck Garcia
+
+    This file is part of libfqam and is available under the 3-Clause
+    BSD license, which can be found in the LICENSE file at the top-level
+    directory, or at http://opensource.org/licenses/BSD-3-Clause
+*/
+
+#include <stdio.h>
+#include "FLAME.h"
+#include "FQAM.h"
+#include "__FQAM_Stage.h"
+#include "arraylist.h"
+#include "assertf.h"
+
+/* Returns true if statevector is within tolerance of (a0, a1) */
+static bool state_equals (double a0, double a1)
+{
+  dcomplex *buf = FLA_Obj_buffer_at_view (main_stage.statevector);
+
+  return fabs (buf[0].real - a0) < 1e-12 && fabs (buf[1].real - a1) < 1e-12 &&
+         fabs (buf[0].imag) < 1e-12 && fabs (buf[1].imag) < 1e-12;
+}
+
+int main (void)
+{
+  FQAM_Op H, Z, X;
+  bool success = true;
+
+  FQAM_init (1, 0);
+  FQAM_hadamard (&H);
+  FQAM_Pauli_z (&Z);
+  FQAM_Pauli_x (&X);
+
+  // Incremental appends: H -> Z -> H takes |0> to |1>
+  FQAM_stage_append (H);
+  FQAM_compute_outcomes ();
+  FQAM_stage_append (Z);
+  FQAM_compute_outcomes ();
+  FQAM_stage_append (H);
+  FQAM_compute_outcomes ();
+  success &= state_equals (0, 1);
+
+  // Recomputing an up to date stage must not reapply operators
+  FQAM_compute_outcomes ();
+  success &= state_equals (0, 1);
+
+  // Editing a middle operator recomputes from the step before it: H -> X -> H takes |0> to |0>
+  FQAM_stage_replace (1, X);
+  FQAM_compute_outcomes ();
+  success &= state_equals (1, 0);
+
+  // Sparse checkpoints: budget of 4 states over a deep stage
+  FQAM_stage_set_checkpoint_budget (4 * main_stage.state_space * sizeof (dcomplex));
+  for (int i = 0; i < 31; i++)
+    FQAM_stage_append (X);
+  FQAM_compute_outcomes ();
+  success &= state_equals (0, 1);
+
+  // Replacing the final X with Z: X^30 Z keeps |0>
+  FQAM_stage_replace (main_stage.stage->size - 1, Z);
+  FQAM_compute_outcomes ();
+  success &= state_equals (1, 0);
+
+  if (success)
+    printf ("Passed test stage checkpoint \n");
+  else
+    printf ("Failed test stage checkpoint \n");
+
+  FQAM_finalize ();
+}
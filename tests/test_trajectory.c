@@ -0,0 +1,100 @@
+/*
+    Copyright (C) 2024, Chuck Garcia
+
+    This file is part of libfqam and is available under the 3-Clause
+    BSD license, which can be found in the LICENSE file at the top-level
+    directory, or at http://opensource.org/licenses/BSD-3-Clause
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "FLAME.h"
+#include "FQAM.h"
+#include "assertf.h"
+
+#define QUBITS 3
+#define TRAJECTORIES 20000
+
+/* Stages a noisy circuit mixing state independent (depolarizing, dephasing) and
+ * state dependent (amplitude damping) channels. Staged operators must outlive
+ * the stage */
+static void stage_circuit (void)
+{
+  static FQAM_Op H, cx, T;
+
+  FQAM_hadamard (&H);
+  FQAM_cnot (&cx);
+  FQAM_Phase_T (&T);
+
+  FQAM_stage_append_on (H, (int[]){0}, 1);
+  FQAM_stage_append_on (cx, (int[]){0, 1}, 2);
+  FQAM_stage_append_amplitude_damping (0, 0.3);
+  FQAM_stage_append_on (H, (int[]){2}, 1);
+  FQAM_stage_append_depolarizing (1, 0.2);
+  FQAM_stage_append_on (cx, (int[]){1, 2}, 2);
+  FQAM_stage_append_on (T, (int[]){2}, 1);
+  FQAM_stage_append_dephasing (2, 0.1);
+  FQAM_stage_append_on (H, (int[]){1}, 1);
+  FQAM_stage_append_amplitude_damping (2, 0.5);
+}
+
+static void observable (FQAM_Pauli_sum *H)
+{
+  FQAM_Pauli_sum_create (H);
+  FQAM_Pauli_sum_add (H, 1.0, "ZII");
+  FQAM_Pauli_sum_add (H, 0.5, "IXI");
+  FQAM_Pauli_sum_add (H, 0.3, "ZIZ");
+  FQAM_Pauli_sum_add (H, -0.7, "IYX");
+}
+
+int main (void)
+{
+  FQAM_Config config = FQAM_CONFIG_DEFAULT;
+  FQAM_Trajectory_stats stats;
+  FQAM_Pauli_sum H;
+  double exact, probs[1 << QUBITS];
+  unsigned long *outcomes = malloc (2 * TRAJECTORIES * sizeof (unsigned long));
+  size_t counts[1 << QUBITS] = {0};
+  bool success = true;
+
+  observable (&H);
+
+  // Reference: density matrix backend
+  config.backend = FQAM_BACKEND_DENSITY;
+  FQAM_init_config (QUBITS, 0, config);
+  stage_circuit ();
+  exact = FQAM_expectation (&H);
+  FQAM_marginal ((int[]){0, 1, 2}, QUBITS, probs);
+  FQAM_finalize ();
+
+  FQAM_init (QUBITS, 0);
+  stage_circuit ();
+  FQAM_trajectories (TRAJECTORIES, 42, &H, outcomes, &stats);
+
+  success &= stats.count == TRAJECTORIES;
+  success &= fabs (stats.mean - exact) < 5 * stats.std_error;
+
+  // Sampled outcomes against populations, within 5 binomial deviations
+  for (size_t t = 0; t < TRAJECTORIES; t++)
+    counts[outcomes[t]]++;
+  for (int b = 0; b < 1 << QUBITS; b++)
+  {
+    double sigma = sqrt (probs[b] * (1 - probs[b]) / TRAJECTORIES);
+    success &= fabs ((double)counts[b] / TRAJECTORIES - probs[b]) <= 5 * sigma + 1e-12;
+  }
+
+  // Trajectories draw from their own streams: reruns reproduce outcomes
+  FQAM_trajectories (TRAJECTORIES, 42, NULL, outcomes + TRAJECTORIES, NULL);
+  success &= memcmp (outcomes, outcomes + TRAJECTORIES,
+                     TRAJECTORIES * sizeof (unsigned long)) == 0;
+  FQAM_finalize ();
+
+  FQAM_Pauli_sum_free (&H);
+  free (outcomes);
+
+  if (success)
+    printf ("Passed test trajectory \n");
+  else
+    printf ("Failed test trajectory \n");
+}
@@ -0,0 +1,122 @@
+/*
+    Copyright (C) 2024, Chuck Garcia
+
+    This file is part of libfqam and is available under the 3-Clause
+    BSD license, which can be found in the LICENSE file at the top-level
+    directory, or at http://opensource.org/licenses/BSD-3-Clause
+*/
+
+#include <stdio.h>
+#include <string.h>
+#include "FLAME.h"
+#include "FQAM.h"
+#include "__FQAM_Stage.h"
+#include "assertf.h"
+
+#define DIM 3
+#define N (1 << DIM)
+
+/* y = H x for Pauli sum H, using P|b> = i^{|x & z|} (-1)^{|b & z|} |b ^ x> */
+static void apply_pauli_sum (FQAM_Pauli_sum *H, const dcomplex *x, dcomplex *y)
+{
+  memset (y, 0, N * sizeof (dcomplex));
+
+  for (size_t t = 0; t < H->size; t++)
+  {
+    FQAM_Pauli_term P = H->terms[t];
+    int n = __builtin_popcountll (P.x_mask & P.z_mask) & 3;
+
+    for (int b = 0; b < N; b++)
+    {
+      double w = P.coeff * (1.0 - 2.0 * __builtin_parityll (b & P.z_mask));
+      dcomplex a = x[b], *out = &y[b ^ P.x_mask];
+
+      // out += w * i^n * a
+      for (int k = 0; k < n; k++)
+        a = (dcomplex){-a.imag, a.real};
+      out->real += w * a.real;
+      out->imag += w * a.imag;
+    }
+  }
+}
+
+/* Reference e^{-i H time}|initial> by Taylor series */
+static void evolve_exact (FQAM_Pauli_sum *H, double time, int initial, dcomplex *psi)
+{
+  dcomplex term[N], next[N];
+
+  memset (term, 0, sizeof (term));
+  term[initial].real = 1.0;
+  memcpy (psi, term, sizeof (term));
+
+  for (int k = 1; k < 80; k++)
+  {
+    apply_pauli_sum (H, term, next);
+    for (int b = 0; b < N; b++) // term := -i time / k * H term
+      term[b] = (dcomplex){next[b].imag * time / k, -next[b].real * time / k};
+    for (int b = 0; b < N; b++)
+    {
+      psi[b].real += term[b].real;
+      psi[b].imag += term[b].imag;
+    }
+  }
+}
+
+/* Largest amplitude error of Trotterized evolution against 'exact' */
+static double trotter_error (FQAM_Pauli_sum *H, int steps, int order, const dcomplex *exact)
+{
+  double error = 0.0;
+
+  FQAM_init (DIM, 1);
+  FQAM_stage_append_trotter (H, 1.0, steps, order);
+  FQAM_compute_outcomes ();
+
+  dcomplex *psi = FLA_Obj_buffer_at_view (main_stage.statevector);
+  for (int b = 0; b < N; b++)
+    error = fmax (error, hypot (psi[b].real - exact[b].real, psi[b].imag - exact[b].imag));
+
+  FQAM_finalize ();
+  return error;
+}
+
+int main (void)
+{
+  FQAM_Pauli_sum H, C;
+  dcomplex exact[N];
+  bool success = true;
+
+  // Transverse field Ising chain with a Y coupling
+  FQAM_Pauli_sum_create (&H);
+  FQAM_Pauli_sum_add (&H, 1.0, "ZZI");
+  FQAM_Pauli_sum_add (&H, 0.8, "IZZ");
+  FQAM_Pauli_sum_add (&H, 0.6, "XII");
+  FQAM_Pauli_sum_add (&H, 0.6, "IXI");
+  FQAM_Pauli_sum_add (&H, 0.6, "IIX");
+  FQAM_Pauli_sum_add (&H, 0.3, "YYI");
+  FQAM_Pauli_sum_add (&H, 0.2, "ZII");
+  evolve_exact (&H, 1.0, 1, exact);
+
+  // Error shrinks with the order of the product formula
+  double e1 = trotter_error (&H, 64, 1, exact);
+  double e2 = trotter_error (&H, 64, 2, exact);
+  double e4 = trotter_error (&H, 64, 4, exact);
+
+  success &= e1 < 5e-2 && e2 < 5e-4 && e4 < 1e-7;
+  success &= e2 < e1 / 10 && e4 < e2 / 100;
+
+  // Commuting terms are evolved exactly in a single step
+  FQAM_Pauli_sum_create (&C);
+  FQAM_Pauli_sum_add (&C, 0.7, "ZZI");
+  FQAM_Pauli_sum_add (&C, 0.4, "XXI");
+  FQAM_Pauli_sum_add (&C, -0.3, "YYZ");
+  evolve_exact (&C, 1.0, 1, exact);
+  success &= trotter_error (&C, 1, 1, exact) < 1e-12;
+
+  if (success)
+    printf ("Passed test trotter \n");
+  else
+    printf ("Failed test trotter (errors %g %g %g)\n", e1, e2, e4);
+
+  FQAM_Pauli_sum_free (&H);
+  FQAM_Pauli_sum_free (&C);
+}
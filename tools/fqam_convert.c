@@ -0,0 +1,379 @@
+/*
+    Copyright (C) 2024, Chuck Garcia
+
+    This file is part of libfqam and is available under the 3-Clause
+    BSD license, which can be found in the LICENSE file at the top-level
+    directory, or at http://opensource.org/licenses/BSD-3-Clause
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "FLAME.h"
+#include "FQAM.h"
+#include "assertf.h"
+
+/*
+Converts a text circuit into a binary circuit file (see FQAM_Circuit.c).
+
+    usage: fqam_convert circuit.txt circuit.fqc
+
+Statements, one per line, '#' starting a comment:
+
+    qubits 5                       Register size, before any other statement
+    h 0                            Gate on targets: i x y z h s t cx
+    rz 0.25 3                      Gates taking an angle: phase rx ry rz
+    matrix sw 2 1 0 0 0 ...        Defines gate 'sw' on 2 qubits from its 4^2
+                                   entries (real imag pairs, column major)
+    layer h 0 ; cx 1 2 ; t 4       Gates on disjoint targets, as one step
+    repeat cx 0 1 1 2 2 3          Gate at each site, in order
+    rotate 0.3 XXI -0.2 ZZI        Commuting Pauli rotations e^{-i theta P}
+    depolarizing 0 0.1             Noise channels on a qubit: depolarizing,
+    damping 2 0.05                 dephasing, damping (amplitude damping)
+
+Targets and Pauli strings follow the stage: qubit q is bit q of a basis index,
+and character q of a Pauli string acts on qubit q.
+*/
+
+#define DELIMITERS " \t\r\n"
+
+/* Gate defined by name */
+typedef struct
+{
+  char name[32];
+  FQAM_Op *op;
+} named_op;
+
+static named_op *named;
+static size_t num_named, named_capacity;
+
+// Every operator created, freed once saved
+static FQAM_Op **created;
+static size_t num_created, created_capacity;
+
+static size_t line_number;
+
+static void *grow (void *array, size_t size, size_t *capacity, size_t elem)
+{
+  if (size == *capacity)
+  {
+    *capacity = *capacity ? 2 * *capacity : 16;
+    array = realloc (array, *capacity * elem);
+    assertf (array, "Error: Failed to allocate converter tables");
+  }
+  return array;
+}
+
+static FQAM_Op *op_new (void)
+{
+  FQAM_Op *op = malloc (sizeof (FQAM_Op));
+
+  assertf (op, "Error: Failed to allocate operator");
+  created = grow (created, num_created, &created_capacity, sizeof (FQAM_Op *));
+  created[num_created++] = op;
+  return op;
+}
+
+static void op_name (const char *name, FQAM_Op *op)
+{
+  assertf (strlen (name) < sizeof (named->name), "Error: line %zu: Gate name %s too long",
+           line_number, name);
+
+  named = grow (named, num_named, &named_capacity, sizeof (named_op));
+  strcpy (named[num_named].name, name);
+  named[num_named++].op = op;
+}
+
+static char *token (char **save) { return strtok_r (NULL, DELIMITERS, save); }
+
+static double number (char **save)
+{
+  char *t = token (save), *end;
+
+  assertf (t, "Error: line %zu: Expected number", line_number);
+
+  double x = strtod (t, &end);
+  assertf (*end == '\0', "Error: line %zu: Invalid number %s", line_number, t);
+  return x;
+}
+
+static int integer (const char *t)
+{
+  char *end;
+  long x = strtol (t, &end, 10);
+
+  assertf (*end == '\0', "Error: line %zu: Invalid integer %s", line_number, t);
+  return x;
+}
+
+/* Single qubit gate with entries [[a, b], [c, d]] */
+static FQAM_Op *qubit_gate (char *name, dcomplex a, dcomplex b, dcomplex c, dcomplex d)
+{
+  FQAM_Op *op = op_new ();
+
+  FQAM_Op_create (op, name, 1);
+
+  dcomplex *u = FLA_Obj_buffer_at_view (op->mat_repr);
+  dim_t cs = FLA_Obj_col_stride (op->mat_repr);
+
+  u[0] = a;
+  u[1] = c;
+  u[cs] = b;
+  u[1 + cs] = d;
+  return op;
+}
+
+/* Returns gate 'name', reading its angle if it takes one */
+static FQAM_Op *gate (const char *name, char **save)
+{
+  if (!strcmp (name, "phase") || !strcmp (name, "rx") || !strcmp (name, "ry") ||
+      !strcmp (name, "rz"))
+  {
+    double theta = number (save), c = cos (theta / 2), s = sin (theta / 2);
+
+    if (!strcmp (name, "phase"))
+    {
+      FQAM_Op *op = op_new ();
+      FQAM_PhaseA (theta, op);
+      return op;
+    }
+    if (!strcmp (name, "rx"))
+      return qubit_gate ("Rx", FQAM_CMPX (c, 0), FQAM_CMPX (0, -s), FQAM_CMPX (0, -s),
+                         FQAM_CMPX (c, 0));
+    if (!strcmp (name, "ry"))
+      return qubit_gate ("Ry", FQAM_CMPX (c, 0), FQAM_CMPX (-s, 0), FQAM_CMPX (s, 0),
+                         FQAM_CMPX (c, 0));
+    return qubit_gate ("Rz", FQAM_CMPX (c, -s), FQAM_CMPX (0, 0), FQAM_CMPX (0, 0),
+                       FQAM_CMPX (c, s));
+  }
+
+  for (size_t i = 0; i < num_named; i++)
+    if (!strcmp (named[i].name, name))
+      return named[i].op;
+
+  FQAM_Op *op = op_new ();
+
+  if (!strcmp (name, "i"))
+    FQAM_Pauli_eye (op);
+  else if (!strcmp (name, "x"))
+    FQAM_Pauli_x (op);
+  else if (!strcmp (name, "y"))
+    FQAM_Pauli_y (op);
+  else if (!strcmp (name, "z"))
+    FQAM_Pauli_z (op);
+  else if (!strcmp (name, "h"))
+    FQAM_hadamard (op);
+  else if (!strcmp (name, "s"))
+    FQAM_Phase (op);
+  else if (!strcmp (name, "t"))
+    FQAM_Phase_T (op);
+  else if (!strcmp (name, "cx"))
+    FQAM_cnot (op);
+  else
+    assertf (false, "Error: line %zu: Unknown gate %s", line_number, name);
+
+  op_name (name, op);
+  return op;
+}
+
+/* Reads targets up to the end of line or a ';' token */
+static int targets (char **save, int *t, int max)
+{
+  int n = 0;
+
+  for (char *s = token (save); s && strcmp (s, ";"); s = token (save))
+  {
+    assertf (n < max, "Error: line %zu: Too many targets", line_number);
+    t[n++] = integer (s);
+  }
+  return n;
+}
+
+/* matrix NAME k entries... */
+static void define_matrix (char **save)
+{
+  char *name = token (save);
+  assertf (name, "Error: line %zu: Expected gate name", line_number);
+
+  char *k_token = token (save);
+  assertf (k_token, "Error: line %zu: Expected qubit count", line_number);
+
+  int k = integer (k_token), d = 1 << k;
+  assertf (k > 0 && k <= FQAM_MAX_TARGETS, "Error: line %zu: Gates act on 1 to %d qubits",
+           line_number, FQAM_MAX_TARGETS);
+
+  FQAM_Op *op = op_new ();
+  FQAM_Op_create (op, name, k);
+
+  dcomplex *u = FLA_Obj_buffer_at_view (op->mat_repr);
+  dim_t cs = FLA_Obj_col_stride (op->mat_repr);
+
+  for (int c = 0; c < d; c++)
+    for (int r = 0; r < d; r++)
+    {
+      u[r + c * cs].real = number (save);
+      u[r + c * cs].imag = number (save);
+    }
+
+  op_name (name, op);
+}
+
+static void layer (char **save)
+{
+  FQAM_Op ops[64];
+  int t[64 * FQAM_MAX_TARGETS], num_targets[64], n = 0, total = 0;
+
+  for (char *name = token (save); name; name = token (save))
+  {
+    assertf (n < 64, "Error: line %zu: Layer of more than 64 gates", line_number);
+
+    ops[n] = *gate (name, save);
+    num_targets[n] = targets (save, t + total, FQAM_MAX_TARGETS);
+    total += num_targets[n++];
+  }
+
+  FQAM_stage_append_layer (ops, t, num_targets, n);
+}
+
+static void repeat (char **save)
+{
+  char *name = token (save);
+  assertf (name, "Error: line %zu: Expected gate name", line_number);
+
+  FQAM_Op *op = gate (name, save);
+  int *sites = NULL;
+  size_t n = 0, capacity = 0;
+
+  for (char *s = token (save); s; s = token (save))
+  {
+    sites = grow (sites, n, &capacity, sizeof (int));
+    sites[n++] = integer (s);
+  }
+
+  assertf (n > 0 && n % op->dimension == 0,
+           "Error: line %zu: Expected sites of %d qubits", line_number, op->dimension);
+  FQAM_stage_append_repeated (*op, sites, n / op->dimension);
+  free (sites);
+}
+
+static void rotate (char **save)
+{
+  FQAM_Pauli_sum rotations;
+
+  FQAM_Pauli_sum_create (&rotations);
+  for (char *t = token (save); t; t = token (save))
+  {
+    char *end, *pauli;
+    double theta = strtod (t, &end);
+
+    assertf (*end == '\0', "Error: line %zu: Invalid angle %s", line_number, t);
+    pauli = token (save);
+    assertf (pauli, "Error: line %zu: Expected Pauli string", line_number);
+    FQAM_Pauli_sum_add (&rotations, theta, pauli);
+  }
+
+  FQAM_stage_append_rotations (rotations.terms, rotations.size);
+  FQAM_Pauli_sum_free (&rotations);
+}
+
+/* Stages statement 'command' of the current line */
+static void statement (const char *command, char **save)
+{
+  int t[FQAM_MAX_TARGETS];
+
+  if (!strcmp (command, "matrix"))
+    define_matrix (save);
+  else if (!strcmp (command, "layer"))
+    layer (save);
+  else if (!strcmp (command, "repeat"))
+    repeat (save);
+  else if (!strcmp (command, "rotate"))
+    rotate (save);
+  else if (!strcmp (command, "depolarizing") || !strcmp (command, "dephasing") ||
+           !strcmp (command, "damping"))
+  {
+    char *q = token (save);
+    assertf (q, "Error: line %zu: Expected qubit", line_number);
+
+    int qubit = integer (q);
+    double p = number (save);
+
+    if (!strcmp (command, "depolarizing"))
+      FQAM_stage_append_depolarizing (qubit, p);
+    else if (!strcmp (command, "dephasing"))
+      FQAM_stage_append_dephasing (qubit, p);
+    else
+      FQAM_stage_append_amplitude_damping (qubit, p);
+  }
+  else
+  {
+    FQAM_Op *op = gate (command, save);
+    int n = targets (save, t, FQAM_MAX_TARGETS);
+
+    FQAM_stage_append_on (*op, t, n);
+  }
+}
+
+int main (int argc, char **argv)
+{
+  assertf (argc == 3, "usage: %s circuit.txt circuit.fqc", argv[0]);
+
+  FILE *in = fopen (argv[1], "r");
+  assertf (in, "Error: Failed to open %s", argv[1]);
+
+  char *line = NULL, *save;
+  size_t capacity = 0;
+  bool initialized = false;
+
+  while (getline (&line, &capacity, in) != -1)
+  {
+    line_number++;
+
+    char *comment = strchr (line, '#');
+    if (comment)
+      *comment = '\0';
+
+    char *command = strtok_r (line, DELIMITERS, &save);
+    if (!command)
+      continue;
+
+    if (!strcmp (command, "qubits"))
+    {
+      FQAM_Config config = FQAM_CONFIG_DEFAULT;
+      char *n = token (&save);
+      int qubits;
+
+      assertf (!initialized && n, "Error: line %zu: Expected a single qubits statement",
+               line_number);
+
+      // Path sums allocate no statevector, but index basis states in 64 bits
+      qubits = integer (n);
+      assertf (qubits > 0 && qubits < 64, "Error: line %zu: Expected 1 to 63 qubits",
+               line_number);
+      config.backend = FQAM_BACKEND_PATHSUM;
+      FQAM_init_config (qubits, 0, config);
+      initialized = true;
+      continue;
+    }
+
+    assertf (initialized, "Error: line %zu: Expected qubits statement first", line_number);
+    statement (command, &save);
+  }
+
+  assertf (initialized, "Error: %s declares no qubits", argv[1]);
+
+  FQAM_circuit_save (argv[2]);
+
+  // Staged operators are freed by FQAM_finalize, unused definitions here
+  for (size_t i = 0; i < num_created; i++)
+    FQAM_Operator_free (created[i]);
+  FQAM_finalize ();
+
+  for (size_t i = 0; i < num_created; i++)
+    free (created[i]);
+  free (created);
+  free (named);
+  free (line);
+  fclose (in);
+  return 0;
+}